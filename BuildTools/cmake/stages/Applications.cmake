@@ -75,6 +75,19 @@ if(FO_BUILD_CLIENT)
 endif()
 
 if(FO_BUILD_SERVER)
+    # Produced by the baker from ScriptSettings::AotNamespaces, so it exists only after scripts were baked once
+    SetValue(serverAotSource "")
+
+    if(FO_ANGELSCRIPT_SCRIPTING AND FO_ANGELSCRIPT_AOT_SERVER_SOURCE)
+        GetFilenameComponent(serverAotSource "${FO_ANGELSCRIPT_AOT_SERVER_SOURCE}" ABSOLUTE BASE_DIR "${CMAKE_CURRENT_SOURCE_DIR}")
+
+        if(NOT EXISTS "${serverAotSource}")
+            AbortMessage("AngelScript native translation ${serverAotSource} not found, bake server scripts first")
+        endif()
+
+        StatusMessage("+ AngelScript native translation ${serverAotSource}")
+    endif()
+
     AddExecutableApplication(
         ${FO_DEV_NAME}_Server
         "${FO_ENGINE_ROOT}/Source/Applications/ServerApp.cpp"
@@ -84,7 +97,7 @@ if(FO_BUILD_SERVER)
         OUTPUT_NAME ${FO_DEV_NAME}_Server
         TESTING_APP 0
         LINK_LIBS ServerLib ClientLib AppFrontend
-        EXTRA_SOURCES ${FO_RC_FILE}
+        EXTRA_SOURCES ${FO_RC_FILE} ${serverAotSource}
         WRITE_BUILD_HASH)
 
     AddExecutableApplication(
@@ -95,6 +108,7 @@ if(FO_BUILD_SERVER)
         OUTPUT_NAME ${FO_DEV_NAME}_ServerHeadless
         TESTING_APP 0
         LINK_LIBS ServerLib ClientLib AppHeadless
+        EXTRA_SOURCES ${serverAotSource}
         WRITE_BUILD_HASH)
 
     if(FO_WINDOWS)
@@ -106,6 +120,7 @@ if(FO_BUILD_SERVER)
             OUTPUT_NAME ${FO_DEV_NAME}_ServerService
             TESTING_APP 0
             LINK_LIBS ServerLib ClientLib AppHeadless
+            EXTRA_SOURCES ${serverAotSource}
             WRITE_BUILD_HASH)
     else()
         AddExecutableApplication(
@@ -116,6 +131,7 @@ if(FO_BUILD_SERVER)
             OUTPUT_NAME ${FO_DEV_NAME}_ServerDaemon
             TESTING_APP 0
             LINK_LIBS ServerLib ClientLib AppHeadless
+            EXTRA_SOURCES ${serverAotSource}
             WRITE_BUILD_HASH)
     endif()
 endif()
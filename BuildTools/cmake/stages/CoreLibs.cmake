@@ -51,6 +51,8 @@ if(FO_ANGELSCRIPT_SCRIPTING)
     SetValue(FO_ANGELSCRIPT_SCRIPTING_DIR
         "${FO_ENGINE_ROOT}/Source/Scripting/AngelScript")
     SetValue(FO_ANGELSCRIPT_SCRIPTING_SOURCE
+        "${FO_ANGELSCRIPT_SCRIPTING_DIR}/AngelScriptAot.cpp"
+        "${FO_ANGELSCRIPT_SCRIPTING_DIR}/AngelScriptAot.h"
         "${FO_ANGELSCRIPT_SCRIPTING_DIR}/AngelScriptArray.cpp"
         "${FO_ANGELSCRIPT_SCRIPTING_DIR}/AngelScriptArray.h"
         "${FO_ANGELSCRIPT_SCRIPTING_DIR}/AngelScriptAttributes.cpp"
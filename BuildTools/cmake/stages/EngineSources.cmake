@@ -139,6 +139,8 @@ AppendList(FO_COMMON_SOURCE
     "${FO_ENGINE_ROOT}/Source/Common/Timer.h"
     "${FO_ENGINE_ROOT}/Source/Common/TwoDimensionalGrid.cpp"
     "${FO_ENGINE_ROOT}/Source/Common/TwoDimensionalGrid.h"
+    "${FO_ENGINE_ROOT}/Source/Common/UpdateDelta.cpp"
+    "${FO_ENGINE_ROOT}/Source/Common/UpdateDelta.h"
     "${FO_ENGINE_ROOT}/Source/Common/ImGuiExt/ImGuiStuff.cpp"
     "${FO_ENGINE_ROOT}/Source/Common/ImGuiExt/ImGuiStuff.h"
     "${FO_ENGINE_ROOT}/Source/Scripting/CommonImGuiScriptMethods.cpp"
@@ -162,20 +164,29 @@ AppendList(FO_SERVER_BASE_SOURCE
     "${FO_ENGINE_ROOT}/Source/Server/DataBase-Mongo.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/DataBase-SQLite.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/DataBase.h"
+    "${FO_ENGINE_ROOT}/Source/Server/DataBaseBulkWriter.cpp"
+    "${FO_ENGINE_ROOT}/Source/Server/DataBaseBulkWriter.h"
     "${FO_ENGINE_ROOT}/Source/Server/EntityManager.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/EntityManager.h"
     "${FO_ENGINE_ROOT}/Source/Server/EntitySync.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/EntitySync.h"
+    "${FO_ENGINE_ROOT}/Source/Server/InventoryIndex.h"
     "${FO_ENGINE_ROOT}/Source/Server/Item.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/Item.h"
     "${FO_ENGINE_ROOT}/Source/Server/ItemManager.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/ItemManager.h"
+    "${FO_ENGINE_ROOT}/Source/Server/LatencyStats.cpp"
+    "${FO_ENGINE_ROOT}/Source/Server/LatencyStats.h"
     "${FO_ENGINE_ROOT}/Source/Server/Location.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/Location.h"
     "${FO_ENGINE_ROOT}/Source/Server/Map.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/Map.h"
+    "${FO_ENGINE_ROOT}/Source/Server/MapItemIndex.cpp"
+    "${FO_ENGINE_ROOT}/Source/Server/MapItemIndex.h"
     "${FO_ENGINE_ROOT}/Source/Server/MapManager.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/MapManager.h"
+    "${FO_ENGINE_ROOT}/Source/Server/MapSightCache.cpp"
+    "${FO_ENGINE_ROOT}/Source/Server/MapSightCache.h"
     "${FO_ENGINE_ROOT}/Source/Server/NetworkServer.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/NetworkServer-Asio.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/NetworkServer-Interthread.cpp"
@@ -190,6 +201,9 @@ AppendList(FO_SERVER_BASE_SOURCE
     "${FO_ENGINE_ROOT}/Source/Server/ServerConnection.h"
     "${FO_ENGINE_ROOT}/Source/Server/ServerEntity.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/ServerEntity.h"
+    "${FO_ENGINE_ROOT}/Source/Server/StripedRegistry.h"
+    "${FO_ENGINE_ROOT}/Source/Server/UpdateFileCache.cpp"
+    "${FO_ENGINE_ROOT}/Source/Server/UpdateFileCache.h"
     "${FO_ENGINE_ROOT}/Source/Server/UpdaterBackend.cpp"
     "${FO_ENGINE_ROOT}/Source/Server/UpdaterBackend.h"
     "${FO_ENGINE_ROOT}/Source/Server/WorkerPool.cpp"
@@ -231,6 +245,8 @@ AppendList(FO_CLIENT_BASE_SOURCE
     "${FO_ENGINE_ROOT}/Source/Client/ItemHexView.h"
     "${FO_ENGINE_ROOT}/Source/Client/ItemView.cpp"
     "${FO_ENGINE_ROOT}/Source/Client/ItemView.h"
+    "${FO_ENGINE_ROOT}/Source/Client/LocalFileHashes.cpp"
+    "${FO_ENGINE_ROOT}/Source/Client/LocalFileHashes.h"
     "${FO_ENGINE_ROOT}/Source/Client/LocationView.cpp"
     "${FO_ENGINE_ROOT}/Source/Client/LocationView.h"
     "${FO_ENGINE_ROOT}/Source/Client/MapSprite.cpp"
@@ -270,6 +286,10 @@ AppendList(FO_CLIENT_BASE_SOURCE
     "${FO_ENGINE_ROOT}/Source/Client/ResourceManager.h"
     "${FO_ENGINE_ROOT}/Source/Client/SoundManager.cpp"
     "${FO_ENGINE_ROOT}/Source/Client/SoundManager.h"
+    "${FO_ENGINE_ROOT}/Source/Client/SoundMixer.cpp"
+    "${FO_ENGINE_ROOT}/Source/Client/SoundMixer.h"
+    "${FO_ENGINE_ROOT}/Source/Client/SoundStream.cpp"
+    "${FO_ENGINE_ROOT}/Source/Client/SoundStream.h"
     "${FO_ENGINE_ROOT}/Source/Client/SparkExtension.cpp"
     "${FO_ENGINE_ROOT}/Source/Client/SparkExtension.h"
     "${FO_ENGINE_ROOT}/Source/Client/SpriteManager.cpp"
@@ -280,6 +300,8 @@ AppendList(FO_CLIENT_BASE_SOURCE
     "${FO_ENGINE_ROOT}/Source/Client/Updater.h"
     "${FO_ENGINE_ROOT}/Source/Client/VideoClip.cpp"
     "${FO_ENGINE_ROOT}/Source/Client/VideoClip.h"
+    "${FO_ENGINE_ROOT}/Source/Client/VideoColorConverter.cpp"
+    "${FO_ENGINE_ROOT}/Source/Client/VideoColorConverter.h"
     "${FO_ENGINE_ROOT}/Source/Client/VisualParticles.cpp"
     "${FO_ENGINE_ROOT}/Source/Client/VisualParticles.h"
     "${FO_ENGINE_ROOT}/Source/Scripting/ClientEntityScriptMethods.cpp"
@@ -414,6 +436,7 @@ AppendList(FO_SOURCE_META_FILES
 
 AppendList(FO_TESTS_SOURCE
     "${FO_ENGINE_ROOT}/Source/Tests/Test_AngelScriptAlignment.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_AngelScriptAot.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_AngelScriptAttributes.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_AngelScriptBytecode.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_AngelScriptCall.cpp"
@@ -435,6 +458,7 @@ AppendList(FO_TESTS_SOURCE
     "${FO_ENGINE_ROOT}/Source/Tests/Test_ClientRuntimeApi.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_Containers.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_DataBase.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_DataBaseBulkWriter.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_DataSerialization.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_DataSource.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_DiskFileSystem.cpp"
@@ -455,10 +479,14 @@ AppendList(FO_TESTS_SOURCE
     "${FO_ENGINE_ROOT}/Source/Tests/Test_HashedString.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_ImGui.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_ImageBaker.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_InventoryIndex.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_LineTracer.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_LocalFileHashes.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_Logging.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_MapLoader.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_MapBaker.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_MapItemIndex.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_MapSightCache.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_Mapper.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_MemorySystem.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_MetadataBaker.cpp"
@@ -502,14 +530,21 @@ AppendList(FO_TESTS_SOURCE
     "${FO_ENGINE_ROOT}/Source/Tests/Test_ServerItems.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_ServerMapOperations.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_ServerScriptMethods.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_SoundMixer.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_SoundStream.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_StrongType.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_StringUtils.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_StripedRegistry.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_TextBaker.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_TextPack.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_TextureAtlas.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_Timer.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_TimeRelated.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_TwoDimensionalGrid.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_UpdateDelta.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_UpdateFileCache.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_UpdaterBackend.cpp"
+    "${FO_ENGINE_ROOT}/Source/Tests/Test_VideoClip.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_WorkerPool.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_EntitySync.cpp"
     "${FO_ENGINE_ROOT}/Source/Tests/Test_WorkThread.cpp")
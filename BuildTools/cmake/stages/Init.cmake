@@ -33,7 +33,8 @@ DeclareValueOptions(
 	FO_MODEL_BONES_PER_VERTEX "Number of bone influences per 3D vertex" 4
 	FO_MSAN_LIBCXX_ROOT "Path to an MSan-instrumented libc++ install prefix for San_Memory builds" ""
 	FO_MSAN_IGNORELIST "Path to MemorySanitizer ignorelist" "${CMAKE_CURRENT_SOURCE_DIR}/${FO_ENGINE_ROOT}/BuildTools/sanitizers/msan-ignorelist.txt"
-	FO_RESHARPER_SETTINGS "Path to ReSharper solution settings (empty is default config)" "")
+	FO_RESHARPER_SETTINGS "Path to ReSharper solution settings (empty is default config)" ""
+	FO_ANGELSCRIPT_AOT_SERVER_SOURCE "Baked AngelScript native translation linked into server binaries (empty to run scripts interpreted)" "")
 
 DeclareBoolOptions(
 	FO_ENABLE_3D "Supporting of 3d models" OFF
@@ -0,0 +1,219 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "LocalFileHashes.h"
+
+FO_BEGIN_NAMESPACE
+
+LocalFileHashes::LocalFileHashes(ptr<CacheStorage> cache, size_t worker_count) :
+    _cache {cache},
+    _workerCount {worker_count}
+{
+    FO_STACK_TRACE_ENTRY();
+}
+
+auto LocalFileHashes::GetHash(string_view path) -> optional<uint64_t>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto state = GetFileState(path);
+
+    if (!state.has_value()) {
+        return std::nullopt;
+    }
+
+    if (auto known_hash = FindHash(path, *state); known_hash.has_value()) {
+        return known_hash;
+    }
+
+    auto hash = fs_hash_file(path);
+
+    if (!hash.has_value()) {
+        return std::nullopt;
+    }
+
+    _hashedCount++;
+    StoreHash(path, *state, *hash);
+    return hash;
+}
+
+void LocalFileHashes::Prefetch(const vector<string>& paths)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    struct PendingHash
+    {
+        string Path {};
+        FileState State {};
+        optional<uint64_t> Hash {};
+    };
+
+    vector<PendingHash> pending;
+    unordered_set<string> seen_paths;
+
+    for (const auto& path : paths) {
+        if (!seen_paths.emplace(path).second) {
+            continue;
+        }
+
+        auto state = GetFileState(path);
+
+        if (!state.has_value() || FindHash(path, *state).has_value()) {
+            continue;
+        }
+
+        pending.emplace_back(PendingHash {.Path = path, .State = *state, .Hash = {}});
+    }
+
+    if (pending.empty()) {
+        return;
+    }
+
+    // Largest first, so the last file left running is a small one rather than a pack that started late
+    std::ranges::stable_sort(pending, [](const PendingHash& a, const PendingHash& b) { return a.State.Size > b.State.Size; });
+
+    size_t worker_count = std::min(_workerCount, pending.size() - 1);
+
+    while (_workers.size() < worker_count) {
+        _workers.emplace_back(SafeAlloc::MakeUnique<WorkThread>(strex("FileHasher{}", _workers.size())));
+    }
+
+    // Files are taken one at a time from a shared cursor, every slot written by exactly one thread
+    std::atomic_size_t next_file {};
+    vector<std::exception_ptr> hasher_errors(worker_count + 1);
+
+    auto hash_files = [&pending, &next_file, &hasher_errors](size_t hasher_index) noexcept {
+        try {
+            for (size_t i = next_file++; i < pending.size(); i = next_file++) {
+                pending[i].Hash = fs_hash_file(pending[i].Path);
+            }
+        }
+        catch (...) {
+            hasher_errors[hasher_index] = std::current_exception();
+        }
+    };
+
+    for (size_t i = 0; i < worker_count; i++) {
+        _workers[i]->AddJob([&hash_files, i]() -> optional<timespan> {
+            hash_files(i);
+            return std::nullopt;
+        });
+    }
+
+    hash_files(worker_count);
+
+    for (size_t i = 0; i < worker_count; i++) {
+        _workers[i]->Wait();
+    }
+
+    for (const auto& error : hasher_errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // The cache storage is not shared with the workers, results land in it from this thread only
+    for (const auto& entry : pending) {
+        if (entry.Hash.has_value()) {
+            _hashedCount++;
+            StoreHash(entry.Path, entry.State, *entry.Hash);
+        }
+    }
+}
+
+auto LocalFileHashes::GetFileState(string_view path) -> optional<FileState>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto size = fs_file_size(path);
+
+    if (!size.has_value()) {
+        return std::nullopt;
+    }
+
+    return FileState {.Size = *size, .Mtime = fs_last_write_time(path)};
+}
+
+auto LocalFileHashes::MakeCacheKey(string_view path) -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Keyed by the whole path: two same-named files in different directories would otherwise share one
+    // entry, and a size plus write-time collision would answer this check with the other file's hash
+    return strex("{}-{:016x}.hash", strex(path).extract_file_name(), hashing::hash<string_view> {}(path)).str();
+}
+
+auto LocalFileHashes::FindHash(string_view path, const FileState& state) -> optional<uint64_t>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (const auto it = _hashes.find(string(path)); it != _hashes.end()) {
+        if (it->second.Size == state.Size && it->second.Mtime == state.Mtime) {
+            return it->second.Hash;
+        }
+    }
+
+    string cache_key = MakeCacheKey(path);
+
+    if (!_cache->HasEntry(cache_key)) {
+        return std::nullopt;
+    }
+
+    auto data = _cache->GetData(cache_key);
+
+    if (data.size() != sizeof(CachedHash)) {
+        return std::nullopt;
+    }
+
+    CachedHash cached {};
+    auto target = make_ptr(&cached).reinterpret_as<uint8_t>();
+    MemCopy(target, data.data(), sizeof(cached));
+
+    if (cached.Size != state.Size || cached.Mtime != state.Mtime) {
+        return std::nullopt;
+    }
+
+    _hashes[string(path)] = cached;
+    return cached.Hash;
+}
+
+void LocalFileHashes::StoreHash(string_view path, const FileState& state, uint64_t hash)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    CachedHash entry {state.Size, state.Mtime, hash};
+    _hashes[string(path)] = entry;
+    _cache->SetData(MakeCacheKey(path), const_span<uint8_t> {make_ptr(&entry).reinterpret_as<uint8_t>().get(), sizeof(CachedHash)});
+}
+
+FO_END_NAMESPACE
@@ -0,0 +1,89 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+#include "CacheStorage.h"
+#include "WorkThread.h"
+
+FO_BEGIN_NAMESPACE
+
+// Content hashes of local files, answered from the cache storage while a file keeps the size and write time it
+// was hashed at. Files the updater is about to check are hashed ahead on a bounded set of workers, so verifying a
+// full install reads several files at once instead of one after another
+class LocalFileHashes final
+{
+public:
+    LocalFileHashes(ptr<CacheStorage> cache, size_t worker_count);
+    LocalFileHashes(const LocalFileHashes&) = delete;
+    LocalFileHashes(LocalFileHashes&&) noexcept = delete;
+    auto operator=(const LocalFileHashes&) = delete;
+    auto operator=(LocalFileHashes&&) noexcept = delete;
+    ~LocalFileHashes() = default;
+
+    [[nodiscard]] auto GetHashedCount() const noexcept -> size_t { return _hashedCount; }
+
+    auto GetHash(string_view path) -> optional<uint64_t>;
+    void Prefetch(const vector<string>& paths);
+
+private:
+    struct CachedHash
+    {
+        uint64_t Size;
+        uint64_t Mtime;
+        uint64_t Hash;
+    };
+    static_assert(std::is_trivially_copyable_v<CachedHash>);
+
+    struct FileState
+    {
+        uint64_t Size {};
+        uint64_t Mtime {};
+    };
+
+    [[nodiscard]] static auto GetFileState(string_view path) -> optional<FileState>;
+    [[nodiscard]] static auto MakeCacheKey(string_view path) -> string;
+
+    auto FindHash(string_view path, const FileState& state) -> optional<uint64_t>;
+    void StoreHash(string_view path, const FileState& state, uint64_t hash);
+
+    ptr<CacheStorage> _cache;
+    size_t _workerCount;
+    vector<unique_ptr<WorkThread>> _workers {};
+    unordered_map<string, CachedHash> _hashes {};
+    size_t _hashedCount {};
+};
+
+FO_END_NAMESPACE
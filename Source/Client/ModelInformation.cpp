@@ -102,6 +102,7 @@ auto ModelInformation::Load(string_view name) -> bool
 
     // Create animation
     _fileName = name;
+    _fileNameHashed = _modelMngr->GetBoneHashedString(name);
     _hierarchy = hierarchy;
     IndexDirectPoseJoints();
 
@@ -228,6 +229,7 @@ auto ModelInformation::LoadBaked(string_view name, DataReader& reader) -> bool
     FO_VERIFY_AND_THROW(!hierarchy->_allDrawBones.empty(), "Model hierarchy has no drawable meshes for a baked model description", model, name);
 
     _fileName = name;
+    _fileNameHashed = _modelMngr->GetBoneHashedString(name);
     _hierarchy = hierarchy;
     IndexAnimationPoseJoints(*animation_runtime_rig);
 
@@ -162,6 +162,7 @@ class ModelInformation final
 
     ptr<ModelManager> _modelMngr;
     string _fileName {};
+    hstring _fileNameHashed {}; // Identity that survives the manager, e.g. for sprite frame cache keys
     string _pathName {};
     nptr<ModelHierarchy> _hierarchy {};
     optional<ModelAnimationController> _animController {};
@@ -1599,6 +1599,28 @@ void ModelInstance::ProcessAnimation(float32_t elapsed, ipos32 pos, float32_t sc
 {
     FO_STACK_TRACE_ENTRY();
 
+    PoseHierarchy(elapsed, pos, scale);
+    ApplyPoseEffects(elapsed);
+}
+
+auto ModelInstance::CanPoseOnWorker() const noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    // A finishing turn animation refreshes the movement layer mid-pose, which runs the script init callback
+    if (_turnAnimPlaying) {
+        return false;
+    }
+
+    return std::ranges::all_of(_children, [](const unique_ptr<ModelInstance>& child) { return child->CanPoseOnWorker(); });
+}
+
+void ModelInstance::PoseHierarchy(float32_t elapsed, ipos32 pos, float32_t scale)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Touches only this hierarchy's own state, so independent roots may be posed on animation workers
+
     // Update world matrix, only for root
     if (!_parent) {
         _parentMatrix = MakeRootTransformation(pos, scale, _directSceneDraw);
@@ -1612,11 +1634,8 @@ void ModelInstance::ProcessAnimation(float32_t elapsed, ipos32 pos, float32_t sc
     }
 
     // Advance animation time
-    float32_t prev_track_pos = 0.0f;
-    float32_t new_track_pos = 0.0f;
-
     if (_bodyAnimController && elapsed >= 0.0f) {
-        prev_track_pos = _bodyAnimController->GetTrackPosition(_curTrack);
+        float32_t prev_track_pos = _bodyAnimController->GetTrackPosition(_curTrack);
 
         _bodyAnimController->AdvanceTimeline(elapsed * GetSpeed());
 
@@ -1629,7 +1648,13 @@ void ModelInstance::ProcessAnimation(float32_t elapsed, ipos32 pos, float32_t sc
             }
         }
 
-        new_track_pos = _bodyAnimController->GetTrackPosition(_curTrack);
+        float32_t new_track_pos = _bodyAnimController->GetTrackPosition(_curTrack);
+
+        // Zero-time re-poses keep the advanced range, so callbacks still see the step this frame took
+        if (elapsed > 0.0f) {
+            _advancePrevTrackPos = prev_track_pos;
+            _advanceNewTrackPos = new_track_pos;
+        }
 
         if (_animDuration > 0.0f) {
             _animPosProc = new_track_pos / _animDuration;
@@ -1690,7 +1715,17 @@ void ModelInstance::ProcessAnimation(float32_t elapsed, ipos32 pos, float32_t sc
 
     // Move child animations
     for (size_t i = 0; i != _children.size(); ++i) {
-        _children[i]->ProcessAnimation(elapsed, pos, 1.0f);
+        _children[i]->PoseHierarchy(elapsed, pos, 1.0f);
+    }
+}
+
+void ModelInstance::ApplyPoseEffects(float32_t elapsed)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Children first, matching the order the whole hierarchy used when each child was posed and applied in turn
+    for (size_t i = 0; i != _children.size(); ++i) {
+        _children[i]->ApplyPoseEffects(elapsed);
     }
 
     // Placed only after the whole hierarchy is posed: a child-joint effect left one pose behind is a harmless lag
@@ -1730,8 +1765,11 @@ void ModelInstance::ProcessAnimation(float32_t elapsed, ipos32 pos, float32_t sc
         RefreshConfigurationLayout();
     }
 
-    // Animation callbacks
-    if (_bodyAnimController && elapsed >= 0.0f && _animDuration > 0.0f) {
+    // Animation callbacks; a zero step cannot cross a callback time
+    if (_bodyAnimController && elapsed > 0.0f && _animDuration > 0.0f) {
+        float32_t prev_track_pos = _advancePrevTrackPos;
+        float32_t new_track_pos = _advanceNewTrackPos;
+
         for (auto& callback : _animationCallbacks) {
             if ((callback.StateAnim == CritterStateAnim::None || callback.StateAnim == _curStateAnim) && (callback.ActionAnim == CritterActionAnim::None || callback.ActionAnim == _curActionAnim)) {
                 float32_t fire_track_pos1 = floorf(prev_track_pos / _animDuration) * _animDuration + callback.NormalizedTime * _animDuration;
@@ -2791,33 +2829,69 @@ void ModelInstance::DrawInScene(const mat44& proj, float32_t scale)
     DrawPosed(true);
 }
 
-void ModelInstance::Pose(float32_t scale, bool advance_animation)
+void ModelInstance::PrepareSpriteFramePose()
 {
     FO_STACK_TRACE_ENTRY();
 
-    _spriteBoundsPoseReady = false;
+    // A pose prepared for a frame whose draw never happened already holds that time step
+    if (_preparedPose.has_value()) {
+        return;
+    }
+
+    _directSceneDraw = false;
+
+    float32_t dt = AdvanceDrawTime();
+    _forceDraw = false;
+    PoseHierarchy(dt, _framePivot, const_numeric_cast<float32_t>(FRAME_SCALE));
 
-    // The atlas frame-sizing loop re-poses the model several times to converge, and those re-poses must not step the
-    // animation, so time advances once per displayed frame
+    _preparedPose = PreparedPose {.Elapsed = dt, .FramePivot = _framePivot};
+}
+
+auto ModelInstance::AdvanceDrawTime() -> float32_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    nanotime time = GetTime();
     float32_t dt = 0.0f;
 
-    if (advance_animation) {
-        nanotime time = GetTime();
+    // Full-resolution delta, because truncating to whole milliseconds drops sub-millisecond frames and freezes
+    // the animation on an uncapped high-frame-rate viewer
+    if (!_resetDrawTimeOnNextAnimationAdvance) {
+        dt = numeric_cast<float32_t>((time - _lastDrawTime).nanoseconds()) * 1e-9f;
+    }
 
-        // Full-resolution delta, because truncating to whole milliseconds drops sub-millisecond frames and freezes
-        // the animation on an uncapped high-frame-rate viewer
-        if (!_resetDrawTimeOnNextAnimationAdvance) {
-            dt = numeric_cast<float32_t>((time - _lastDrawTime).nanoseconds()) * 1e-9f;
+    _resetDrawTimeOnNextAnimationAdvance = false;
+    _lastDrawTime = time;
+
+    return dt;
+}
+
+void ModelInstance::Pose(float32_t scale, bool advance_animation)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _spriteBoundsPoseReady = false;
+
+    if (advance_animation && _preparedPose.has_value() && !_directSceneDraw) {
+        PreparedPose prepared = _preparedPose.value();
+        _preparedPose.reset();
+
+        // Time already advanced on the animation worker; a frame moved since then only needs the zero-step
+        // re-pose the frame-sizing loop uses anyway
+        if (prepared.FramePivot != _framePivot) {
+            PoseHierarchy(0.0f, _framePivot, scale);
         }
 
-        _resetDrawTimeOnNextAnimationAdvance = false;
-        _lastDrawTime = time;
+        ApplyPoseEffects(prepared.Elapsed);
     }
+    else {
+        // The atlas frame-sizing loop re-poses the model several times to converge, and those re-poses must not
+        // step the animation, so time advances once per displayed frame
+        float32_t dt = advance_animation ? AdvanceDrawTime() : 0.0f;
+        _forceDraw = false;
 
-    _forceDraw = false;
-
-    // Move animation
-    ProcessAnimation(dt, _framePivot, scale);
+        ProcessAnimation(dt, _framePivot, scale);
+    }
 
     _spriteBoundsPoseReady = !_directSceneDraw;
 }
@@ -3016,6 +3090,90 @@ void ModelInstance::CollectAttachPoints(ptr<const ModelInstance> projector, int3
     }
 }
 
+auto ModelInstance::GetSpriteFrameCacheKey(float32_t time_step) const -> optional<ModelSpriteFrameKey>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(time_step > 0.0f, "Model frame cache time step must be positive", time_step);
+
+    ModelSpriteFrameKey key {.FrameSize = _frameSize, .FramePivot = _framePivot};
+
+    if (!AppendSpriteFrameCacheKey(key, time_step)) {
+        return std::nullopt;
+    }
+
+    return key;
+}
+
+auto ModelInstance::AppendSpriteFrameCacheKey(ModelSpriteFrameKey& key, float32_t time_step) const -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Particles evolve on their own clock, so no other instance can stand in for this frame
+    if (!_modelParticles.empty()) {
+        return false;
+    }
+
+    key.Models.emplace_back(_modelInfo->_fileNameHashed.as_hash());
+
+    for (int32_t layer : _curLayers) {
+        key.PoseWords.emplace_back(layer);
+    }
+
+    key.PoseWords.emplace_back(_shadowDisabled ? 1 : 0);
+    key.PoseWords.emplace_back(iround<int32_t>(_lookDirAngle * 4.0f));
+    key.PoseWords.emplace_back(iround<int32_t>(_moveDirAngle * 4.0f));
+    key.PoseWords.emplace_back(_isMovingBack ? 1 : 0); // Flips the body and head turn and the move rotation
+
+    for (const mat44* mat : {&_matRot, &_matScale}) {
+        for (int32_t col = 0; col < 4; col++) {
+            for (int32_t row = 0; row < 4; row++) {
+                key.PoseWords.emplace_back(iround<int32_t>((*mat)[col][row] * 4096.0f));
+            }
+        }
+    }
+
+    for (int32_t axis = 0; axis < 3; axis++) {
+        key.PoseWords.emplace_back(iround<int32_t>(_moveOffset[axis] * 64.0f));
+    }
+
+    // Track positions are bucketed by the time step; blend weights are part of the key, so transitions only match
+    // instances caught at the same point of the same transition
+    auto append_tracks = [&key, time_step](const optional<ModelAnimationController>& controller) {
+        if (!controller) {
+            key.PoseWords.emplace_back(-2);
+            return;
+        }
+
+        for (int32_t track = 0; track < 2; track++) {
+            ModelAnimationController::TrackState state = controller->GetTrackState(track);
+
+            if (!state.Enabled || state.Weight <= 0.0f) {
+                key.PoseWords.emplace_back(-1);
+                continue;
+            }
+
+            key.PoseWords.emplace_back(state.ClipIndex);
+            key.PoseWords.emplace_back(state.Reversed ? 1 : 0);
+            key.PoseWords.emplace_back(iround<int32_t>(std::floor(state.Position / time_step)));
+            key.PoseWords.emplace_back(iround<int32_t>(state.Weight * 64.0f));
+        }
+    };
+
+    append_tracks(_bodyAnimController);
+    append_tracks(_moveAnimController);
+
+    key.PoseWords.emplace_back(numeric_cast<int32_t>(_children.size()));
+
+    for (const auto& child : _children) {
+        if (!child->AppendSpriteFrameCacheKey(key, time_step)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 auto ModelInstance::CollectActiveAnimationBounds() const -> optional<ModelBounds3D>
 {
     FO_STACK_TRACE_ENTRY();
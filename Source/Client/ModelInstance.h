@@ -103,6 +103,7 @@ class ModelInstance final
     [[nodiscard]] auto GetMovingAnim() const noexcept -> CritterActionAnim;
     [[nodiscard]] auto ResolveAnimation(CritterStateAnim& state_anim, CritterActionAnim& action_anim) -> bool;
     [[nodiscard]] auto NeedForceDraw() const noexcept -> bool { return _forceDraw; }
+    [[nodiscard]] auto HasPreparedPose() const noexcept -> bool { return _preparedPose.has_value(); }
     [[nodiscard]] auto NeedDraw() const -> bool;
     [[nodiscard]] auto IsAnimationPlaying() const -> bool;
     [[nodiscard]] auto GetDrawSize() const -> isize32;
@@ -119,6 +120,9 @@ class ModelInstance final
     [[nodiscard]] auto GetAnimDuration(CritterStateAnim state_anim, CritterActionAnim action_anim) -> timespan;
     [[nodiscard]] auto HasBodyRotation() const { return !!_moveAnimController; }
     [[nodiscard]] auto GetMoveDirAngle() const noexcept -> float32_t { return _moveDirAngle; }
+    [[nodiscard]] auto GetWorldMatrices() const noexcept -> const_span<mat44> { return _worldMatrices; }
+    [[nodiscard]] auto CanPoseOnWorker() const noexcept -> bool;
+    [[nodiscard]] auto GetSpriteFrameCacheKey(float32_t time_step) const -> optional<ModelSpriteFrameKey>;
 
     void SetupFrame(isize32 draw_size, ipos32 frame_pivot);
     void PrepareFrameLayout();
@@ -134,6 +138,7 @@ class ModelInstance final
     void SetSpeed(float32_t speed);
     void EnableShadow(bool enabled);
     void PoseSpriteFrame(bool advance_animation);
+    void PrepareSpriteFramePose();
     void DrawSpriteFrame();
     void DrawInScene(const mat44& proj, float32_t scale);
     void AddMoveOffset(ipos32 offset);
@@ -147,6 +152,12 @@ class ModelInstance final
     void ClearAnimationCallbacks();
 
 private:
+    struct PreparedPose
+    {
+        float32_t Elapsed {};
+        ipos32 FramePivot {};
+    };
+
     struct PoseJointBinding
     {
         nptr<const ModelInstance> Owner {};
@@ -216,8 +227,12 @@ class ModelInstance final
     void CutCombinedMeshes(ptr<const ModelInstance> cur);
     void CutCombinedMesh(ptr<CombinedMesh> combined_mesh, ptr<const ModelCutData> cut);
     void ProcessAnimation(float32_t elapsed, ipos32 pos, float32_t scale);
+    void PoseHierarchy(float32_t elapsed, ipos32 pos, float32_t scale);
+    void ApplyPoseEffects(float32_t elapsed);
+    auto AdvanceDrawTime() -> float32_t;
     void Pose(float32_t scale, bool advance_animation);
     void DrawPosed(bool draw_particles);
+    auto AppendSpriteFrameCacheKey(ModelSpriteFrameKey& key, float32_t time_step) const -> bool;
     void FillAnimationTrackInputs(nptr<const ModelAnimationController> controller, bool active, array<vector<uint8_t>, 2>& joint_masks, array<ModelAnimationRuntimePose::TrackInput, 2>& track_inputs) const;
     void SnapshotAnimationWorldMatrices();
     void BuildRestWorldMatrices();
@@ -260,6 +275,9 @@ class ModelInstance final
     int32_t _curTrack {};
     nanotime _lastDrawTime {};
     bool _resetDrawTimeOnNextAnimationAdvance {};
+    optional<PreparedPose> _preparedPose {};
+    float32_t _advancePrevTrackPos {};
+    float32_t _advanceNewTrackPos {};
     mat44 _matRot {};
     mat44 _matScale {1.0f};
     mat44 _matScaleBase {};
@@ -113,6 +113,67 @@ auto ModelManager::GetBoneHashedString(string_view name) const -> hstring
     return _engineMetadata->Hashes.ToHashedString(name);
 }
 
+void ModelManager::PrepareSpriteFramePoses(const_span<ptr<ModelInstance>> models)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    vector<ptr<ModelInstance>> worker_models;
+    worker_models.reserve(models.size());
+
+    for (ptr<ModelInstance> model : models) {
+        if (model->CanPoseOnWorker()) {
+            worker_models.emplace_back(model);
+        }
+        else {
+            model->PrepareSpriteFramePose();
+        }
+    }
+
+    size_t worker_count = std::min(numeric_cast<size_t>(std::max(_settings->AnimationWorkerThreads, 0)), worker_models.size() / 2);
+
+    while (_animationWorkers.size() < worker_count) {
+        _animationWorkers.emplace_back(SafeAlloc::MakeUnique<WorkThread>(strex("ModelAnimation{}", _animationWorkers.size())));
+    }
+
+    // Hierarchies are split into contiguous chunks, one per worker plus one for the calling thread, and every chunk
+    // poses only its own models, so the result does not depend on which thread ran which chunk
+    size_t chunk_count = worker_count + 1;
+    vector<std::exception_ptr> chunk_errors(chunk_count);
+
+    auto pose_chunk = [&worker_models, &chunk_errors, chunk_count](size_t chunk_index) noexcept {
+        size_t begin = worker_models.size() * chunk_index / chunk_count;
+        size_t end = worker_models.size() * (chunk_index + 1) / chunk_count;
+
+        try {
+            for (size_t i = begin; i < end; i++) {
+                worker_models[i]->PrepareSpriteFramePose();
+            }
+        }
+        catch (...) {
+            chunk_errors[chunk_index] = std::current_exception();
+        }
+    };
+
+    for (size_t i = 0; i < worker_count; i++) {
+        _animationWorkers[i]->AddJob([&pose_chunk, i]() -> optional<timespan> {
+            pose_chunk(i);
+            return std::nullopt;
+        });
+    }
+
+    pose_chunk(worker_count);
+
+    for (size_t i = 0; i < worker_count; i++) {
+        _animationWorkers[i]->Wait();
+    }
+
+    for (const auto& error : chunk_errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
 auto ModelManager::LoadModel(string_view fname) -> nptr<ModelBone>
 {
     FO_STACK_TRACE_ENTRY();
@@ -75,6 +75,7 @@ class ModelManager final
 
     auto CreateModel(string_view name) -> unique_nptr<ModelInstance>;
     void PreloadModel(string_view name);
+    void PrepareSpriteFramePoses(const_span<ptr<ModelInstance>> models);
 
 private:
     auto LoadModel(string_view fname) -> nptr<ModelBone>;
@@ -103,6 +104,7 @@ class ModelManager final
     hstring _headBone {};
     unordered_set<hstring> _legBones {};
     uint32_t _linkId {};
+    vector<unique_ptr<WorkThread>> _animationWorkers {};
 };
 
 FO_END_NAMESPACE
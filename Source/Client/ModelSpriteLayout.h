@@ -55,6 +55,18 @@ struct ModelSpriteLayout
     irect32 ViewRect {};
 };
 
+// Identifies what an atlas model frame looks like rather than which instance drew it: instances whose hierarchies
+// share models, layers, quantized track times, orientation and frame placement produce interchangeable pixels
+struct ModelSpriteFrameKey
+{
+    isize32 FrameSize {};
+    ipos32 FramePivot {};
+    vector<hstring::hash_t> Models {}; // Model file name hashes, so a key never matches a different model at a reused address
+    vector<int32_t> PoseWords {};
+
+    [[nodiscard]] auto operator<(const ModelSpriteFrameKey& other) const noexcept -> bool { return std::tie(FrameSize.width, FrameSize.height, FramePivot.x, FramePivot.y, Models, PoseWords) < std::tie(other.FrameSize.width, other.FrameSize.height, other.FramePivot.x, other.FramePivot.y, other.Models, other.PoseWords); }
+};
+
 struct ModelSpriteBoundsEnvelopeId
 {
     array<int32_t, 2> BodyAnimationIndices {-1, -1};
@@ -52,7 +52,13 @@ ModelSprite::ModelSprite(ptr<SpriteManager> spr_mngr, ptr<ModelSpriteFactory> fa
     FO_STACK_TRACE_ENTRY();
 }
 
-ModelSprite::~ModelSprite() = default;
+ModelSprite::~ModelSprite()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _factory->_animatedSprites.erase(make_ptr(this));
+    DetachCachedFrame();
+}
 
 auto ModelSprite::GetModel() -> ptr<ModelInstance>
 {
@@ -166,6 +172,7 @@ void ModelSprite::Play(hstring anim_name, bool looped, bool reversed)
     ignore_unused(looped);
     ignore_unused(reversed);
 
+    _factory->_animatedSprites.emplace(make_ptr(this));
     StartUpdate();
 }
 
@@ -181,7 +188,8 @@ auto ModelSprite::Update() -> bool
     _model->PrepareFrameLayout();
     bool direct_draw = IsDirectDraw();
 
-    if (_model->NeedForceDraw() || (!direct_draw && _model->NeedDraw())) {
+    // A pose prepared by the factory pre-pass has already consumed this frame's time step and must be drawn
+    if (_model->HasPreparedPose() || _model->NeedForceDraw() || (!direct_draw && _model->NeedDraw())) {
         DrawToAtlas();
     }
 
@@ -244,7 +252,7 @@ void ModelSprite::SetupFrame(isize32 frame_size)
     _cropEnvelopeId.reset();
 }
 
-auto ModelSprite::PrepareFrameCrop(isize32 frame_size, optional<ModelSpriteBounds> bounds) -> PreparedFrameCrop
+auto ModelSprite::PrepareFrameCrop(isize32 frame_size, optional<ModelSpriteBounds> bounds, bool shared_frame) -> PreparedFrameCrop
 {
     FO_STACK_TRACE_ENTRY();
 
@@ -282,7 +290,8 @@ auto ModelSprite::PrepareFrameCrop(isize32 frame_size, optional<ModelSpriteBound
     bool same_frame = frame_size == _frameSize;
     bool same_envelope = envelope_id && _cropEnvelopeId && envelope_id->BodyAnimationIndices == _cropEnvelopeId->BodyAnimationIndices && envelope_id->MoveAnimationIndices == _cropEnvelopeId->MoveAnimationIndices && envelope_id->CombinedMeshGenerationRevision == _cropEnvelopeId->CombinedMeshGenerationRevision && envelope_id->BodyAnimationCount == _cropEnvelopeId->BodyAnimationCount && envelope_id->MoveAnimationCount == _cropEnvelopeId->MoveAnimationCount && envelope_id->ShadowEnabled == _cropEnvelopeId->ShadowEnabled && envelope_id->FullFrame == _cropEnvelopeId->FullFrame;
 
-    if (same_frame && same_envelope && has_bounded_crop && _boundedCropEstablished) {
+    // A shared frame must not depend on this sprite's history, or equal keys could carry different crops
+    if (!shared_frame && same_frame && same_envelope && has_bounded_crop && _boundedCropEstablished) {
         // Keep the slot stable across small pose-to-pose bounds changes
         normalized_crop.expand(_cropRect);
     }
@@ -301,7 +310,7 @@ auto ModelSprite::PrepareFrameCrop(isize32 frame_size, optional<ModelSpriteBound
         .CropEnvelopeId = envelope_id,
     };
 
-    if (_atlasAllocation && same_frame && normalized_crop == _cropRect) {
+    if (!shared_frame && _atlasAllocation && same_frame && normalized_crop == _cropRect) {
         prepared_crop.Atlas = _atlas;
         prepared_crop.AtlasRect = _atlasRect;
         prepared_crop.ReuseAtlasAllocation = true;
@@ -323,6 +332,8 @@ void ModelSprite::CommitFrameCrop(PreparedFrameCrop&& prepared_crop)
 {
     FO_STACK_TRACE_ENTRY();
 
+    // A cached frame owns the region this sprite showed, so its own slot was released and cannot be reused here
+    DetachCachedFrame();
     SetupFrame(prepared_crop.FrameSize);
     _cropRect = prepared_crop.CropRect;
     _size = prepared_crop.Size;
@@ -337,6 +348,46 @@ void ModelSprite::CommitFrameCrop(PreparedFrameCrop&& prepared_crop)
     }
 }
 
+void ModelSprite::AttachCachedFrame(ptr<ModelSpriteCachedFrame> cached_frame)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (_cachedFrame != cached_frame.get()) {
+        DetachCachedFrame();
+        SetupFrame(cached_frame->FrameSize);
+        _cachedFrame = cached_frame;
+
+        if (cached_frame->Users++ == 0) {
+            _factory->UnlinkIdleFrame(cached_frame);
+        }
+    }
+
+    _cropRect = cached_frame->CropRect;
+    _size = cached_frame->Size;
+    _offset = cached_frame->Offset;
+    _boundedCropEstablished = false;
+    _cropEnvelopeId.reset();
+    _atlas = cached_frame->Atlas;
+    _atlasRect = cached_frame->AtlasRect;
+    _atlasAllocation = nullptr;
+}
+
+void ModelSprite::DetachCachedFrame() noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (_cachedFrame) {
+        FO_STRONG_ASSERT(_cachedFrame->Users != 0, "Cached model frame released more often than it was attached");
+        _cachedFrame->Users--;
+
+        if (_cachedFrame->Users == 0) {
+            _factory->LinkIdleFrame(_cachedFrame.as_ptr());
+        }
+
+        _cachedFrame = nullptr;
+    }
+}
+
 void ModelSprite::ApplyFrameCrop(isize32 frame_size, optional<ModelSpriteBounds> bounds)
 {
     FO_STACK_TRACE_ENTRY();
@@ -367,6 +418,84 @@ auto ModelSpriteFactory::GetModelMngr() -> ptr<ModelManager>
     return _modelMngr;
 }
 
+auto ModelSpriteFactory::GetFrameCacheStats() const noexcept -> ModelSpriteFrameCacheStats
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    ModelSpriteFrameCacheStats stats = _frameCacheStats;
+    stats.Entries = _frameCache.size();
+    return stats;
+}
+
+void ModelSpriteFactory::ClenupCache()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    TrimFrameCache(0);
+}
+
+void ModelSpriteFactory::TrimFrameCache(size_t budget)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Frames still shown by a sprite are pinned and never listed; idle ones go least recently released first
+    while (_frameCacheStats.Pixels > budget && !_idleFrames.empty()) {
+        ptr<ModelSpriteCachedFrame> victim = _idleFrames.front();
+        _idleFrames.pop_front();
+
+        auto it = _frameCache.find(*victim->Key);
+        FO_VERIFY_AND_THROW(it != _frameCache.end() && it->second.get() == victim.get(), "Idle model frame is missing from the frame cache");
+
+        _frameCacheStats.Pixels -= numeric_cast<size_t>(victim->Size.square());
+        _frameCacheStats.Evictions++;
+        _frameCache.erase(it);
+    }
+}
+
+void ModelSpriteFactory::LinkIdleFrame(ptr<ModelSpriteCachedFrame> cached_frame) noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    FO_STRONG_ASSERT(!cached_frame->IdlePos.has_value(), "Model frame is already in the idle list");
+    cached_frame->IdlePos = _idleFrames.emplace(_idleFrames.end(), cached_frame);
+}
+
+void ModelSpriteFactory::UnlinkIdleFrame(ptr<ModelSpriteCachedFrame> cached_frame) noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (cached_frame->IdlePos.has_value()) {
+        _idleFrames.erase(cached_frame->IdlePos.value());
+        cached_frame->IdlePos.reset();
+    }
+}
+
+void ModelSpriteFactory::Update()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Posing is the CPU-heavy part of atlas redraws, so the hierarchies due this frame are posed up front across
+    // the animation workers; sprites then draw the prepared poses in their usual order on the render thread
+    if (_settings->AnimationWorkerThreads <= 0 || _settings->ModelDirectDraw) {
+        return;
+    }
+
+    _posingModels.clear();
+
+    for (ptr<ModelSprite> model_spr : _animatedSprites) {
+        ptr<ModelInstance> model = model_spr->GetModel();
+        model->PrepareFrameLayout();
+
+        if (model->NeedForceDraw() || model->NeedDraw()) {
+            _posingModels.emplace_back(model);
+        }
+    }
+
+    if (!_posingModels.empty()) {
+        _modelMngr->PrepareSpriteFramePoses(_posingModels);
+    }
+}
+
 auto ModelSpriteFactory::LoadSprite(hstring path, AtlasType atlas_type) -> shared_ptr<Sprite>
 {
     FO_STACK_TRACE_ENTRY();
@@ -461,6 +590,27 @@ void ModelSpriteFactory::DrawModelToAtlas(ptr<ModelSprite> model_spr)
         model_spr->_poseRect = {bounds->PoseRect.x - frame_pivot.x, bounds->PoseRect.y - frame_pivot.y, bounds->PoseRect.width, bounds->PoseRect.height};
     }
 
+    // Crowds of one model in one animation pose identically, so the frame another instance already rendered is
+    // reused instead of paying another offscreen render; posing above still runs, since it advances the timeline
+    optional<ModelSpriteFrameKey> cache_key;
+
+    if (_settings->ModelFrameCacheBudget > 0 && !model_spr->IsDirectDraw()) {
+        float32_t time_step = numeric_cast<float32_t>(std::max(_settings->ModelFrameCacheTimeStep, 1)) / 1000.0f;
+        cache_key = model_spr->GetModel()->GetSpriteFrameCacheKey(time_step);
+    }
+
+    if (cache_key) {
+        if (auto it = _frameCache.find(*cache_key); it != _frameCache.end()) {
+            _frameCacheStats.Hits++;
+            model_spr->AttachCachedFrame(it->second.as_ptr());
+            model_spr->_requestedFrameSize.reset();
+            request_redraw_on_fail.release();
+            return;
+        }
+
+        _frameCacheStats.Misses++;
+    }
+
     // Render the posed model once, at the settled size, into the full logical frame before applying the tight atlas crop
     isize32 frame_size = {render_frame_size.width * ModelInstance::FRAME_SCALE, render_frame_size.height * ModelInstance::FRAME_SCALE};
     FO_VERIFY_AND_THROW(frame_size.width <= AppRender::MAX_ATLAS_WIDTH && frame_size.height <= AppRender::MAX_ATLAS_HEIGHT, "Model sprite frame exceeds the device texture limit", frame_size.width, frame_size.height, render_frame_size.width, render_frame_size.height, ModelInstance::FRAME_SCALE, AppRender::MAX_ATLAS_WIDTH, AppRender::MAX_ATLAS_HEIGHT);
@@ -484,7 +634,7 @@ void ModelSpriteFactory::DrawModelToAtlas(ptr<ModelSprite> model_spr)
     _sprMngr->GetRtMngr().PopRenderTarget();
     pop_model_rt_on_fail.release();
 
-    auto prepared_crop = model_spr->PrepareFrameCrop(render_frame_size, bounds);
+    auto prepared_crop = model_spr->PrepareFrameCrop(render_frame_size, bounds, cache_key.has_value());
 
     // Copy render
     int32_t l = iround<int32_t>(prepared_crop.AtlasRect.x * numeric_cast<float32_t>(prepared_crop.Atlas->GetSize().width));
@@ -506,7 +656,29 @@ void ModelSpriteFactory::DrawModelToAtlas(ptr<ModelSprite> model_spr)
     _sprMngr->DrawRenderTarget(rt_model, false, &region_from, &region_to);
     _sprMngr->GetRtMngr().PopRenderTarget();
     pop_atlas_rt_on_fail.release();
-    model_spr->CommitFrameCrop(std::move(prepared_crop));
+
+    if (cache_key) {
+        auto cached_frame = SafeAlloc::MakeUnique<ModelSpriteCachedFrame>();
+        cached_frame->Atlas = prepared_crop.Atlas;
+        cached_frame->AtlasRect = prepared_crop.AtlasRect;
+        cached_frame->AtlasAllocation = std::move(prepared_crop.AtlasAllocation);
+        cached_frame->FrameSize = prepared_crop.FrameSize;
+        cached_frame->CropRect = prepared_crop.CropRect;
+        cached_frame->Size = prepared_crop.Size;
+        cached_frame->Offset = prepared_crop.Offset;
+
+        ptr<ModelSpriteCachedFrame> cached_frame_ptr = cached_frame.as_ptr();
+        _frameCacheStats.Pixels += numeric_cast<size_t>(cached_frame->Size.square());
+        auto [cache_it, inserted] = _frameCache.emplace(std::move(*cache_key), std::move(cached_frame));
+        FO_VERIFY_AND_THROW(inserted, "Model frame is already cached");
+        cache_it->second->Key = &cache_it->first;
+        model_spr->AttachCachedFrame(cached_frame_ptr);
+        TrimFrameCache(numeric_cast<size_t>(_settings->ModelFrameCacheBudget));
+    }
+    else {
+        model_spr->CommitFrameCrop(std::move(prepared_crop));
+    }
+
     model_spr->_requestedFrameSize.reset();
     request_redraw_on_fail.release();
 }
@@ -48,6 +48,30 @@ class ModelInstance;
 class ModelManager;
 class ModelSpriteFactory;
 
+// Atlas region holding one rendered model frame, shared by every sprite currently showing that frame
+struct ModelSpriteCachedFrame
+{
+    nptr<TextureAtlas> Atlas {};
+    frect32 AtlasRect {};
+    unique_del_nptr<TextureAtlasLayout::Allocation> AtlasAllocation {};
+    isize32 FrameSize {};
+    irect32 CropRect {};
+    isize32 Size {};
+    ipos32 Offset {};
+    size_t Users {};
+    nptr<const ModelSpriteFrameKey> Key {}; // Owned by the factory cache entry
+    optional<list<ptr<ModelSpriteCachedFrame>>::iterator> IdlePos {}; // Place in the factory idle list while no sprite shows the frame
+};
+
+struct ModelSpriteFrameCacheStats
+{
+    size_t Hits {};
+    size_t Misses {};
+    size_t Evictions {};
+    size_t Entries {};
+    size_t Pixels {};
+};
+
 class ModelSprite final : public AtlasSprite
 {
     friend class ModelSpriteFactory;
@@ -94,8 +118,10 @@ class ModelSprite final : public AtlasSprite
     };
 
     void SetupFrame(isize32 frame_size);
-    auto PrepareFrameCrop(isize32 frame_size, optional<ModelSpriteBounds> bounds) -> PreparedFrameCrop;
+    auto PrepareFrameCrop(isize32 frame_size, optional<ModelSpriteBounds> bounds, bool shared_frame = false) -> PreparedFrameCrop;
     void CommitFrameCrop(PreparedFrameCrop&& prepared_crop);
+    void AttachCachedFrame(ptr<ModelSpriteCachedFrame> cached_frame);
+    void DetachCachedFrame() noexcept;
     void ApplyFrameCrop(isize32 frame_size, optional<ModelSpriteBounds> bounds);
 
     ptr<ModelSpriteFactory> _factory;
@@ -109,6 +135,7 @@ class ModelSprite final : public AtlasSprite
     optional<isize32> _requestedFrameSize {};
     bool _boundedCropEstablished {};
     optional<ModelSpriteBoundsEnvelopeId> _cropEnvelopeId {};
+    nptr<ModelSpriteCachedFrame> _cachedFrame {};
 };
 
 class ModelSpriteFactory : public SpriteFactory
@@ -125,18 +152,29 @@ class ModelSpriteFactory : public SpriteFactory
 
     [[nodiscard]] auto GetExtensions() const -> vector<string> override { return {"fo3d", "fbx", "dae", "obj"}; }
     [[nodiscard]] auto GetModelMngr() -> ptr<ModelManager>;
+    [[nodiscard]] auto GetFrameCacheStats() const noexcept -> ModelSpriteFrameCacheStats;
 
     auto LoadSprite(hstring path, AtlasType atlas_type) -> shared_ptr<Sprite> override;
+    void Update() override;
+    void ClenupCache() override;
 
 private:
     auto LoadTexture(hstring path) -> pair<nptr<RenderTexture>, frect32>;
     void DrawModelToAtlas(ptr<ModelSprite> model_spr);
+    void TrimFrameCache(size_t budget);
+    void LinkIdleFrame(ptr<ModelSpriteCachedFrame> cached_frame) noexcept;
+    void UnlinkIdleFrame(ptr<ModelSpriteCachedFrame> cached_frame) noexcept;
 
     ptr<SpriteManager> _sprMngr;
     ptr<RenderSettings> _settings;
     unique_ptr<ModelManager> _modelMngr;
     unordered_map<hstring, shared_ptr<AtlasSprite>> _loadedMeshTextures {};
     vector<ptr<RenderTarget>> _rtIntermediate {};
+    unordered_set<ptr<ModelSprite>> _animatedSprites {};
+    vector<ptr<ModelInstance>> _posingModels {};
+    map<ModelSpriteFrameKey, unique_ptr<ModelSpriteCachedFrame>> _frameCache {};
+    ModelSpriteFrameCacheStats _frameCacheStats {};
+    list<ptr<ModelSpriteCachedFrame>> _idleFrames {}; // Least recently released first
 };
 
 FO_END_NAMESPACE
@@ -150,7 +150,8 @@ auto ParticleSprite::Update() -> bool
         _particle->Update();
     }
 
-    if (!_drawInScene) {
+    // An effect outside the map view keeps its atlas frame until it is back in view
+    if (!_drawInScene && !_particle->IsCulled()) {
         if (_particle->NeedForceDraw() || _particle->NeedDraw()) {
             DrawToAtlas();
         }
@@ -159,6 +160,13 @@ auto ParticleSprite::Update() -> bool
     return _particle->IsActive();
 }
 
+void ParticleSprite::SetInView(bool in_view) const
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _particle->SetInView(in_view);
+}
+
 void ParticleSprite::DrawToAtlas()
 {
     FO_STACK_TRACE_ENTRY();
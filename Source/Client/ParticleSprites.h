@@ -68,6 +68,7 @@ class ParticleSprite final : public AtlasSprite
     auto Update() -> bool override;
     void DrawToAtlas();
     void DrawInScene(fpos32 scene_pos, float32_t depth) const override;
+    void SetInView(bool in_view) const override;
 
 private:
     void ApplyAtlasSetup() const;
@@ -92,6 +93,7 @@ class ParticleSpriteFactory : public SpriteFactory
     ~ParticleSpriteFactory() override = default;
 
     [[nodiscard]] auto GetExtensions() const -> vector<string> override;
+    [[nodiscard]] auto GetParticleStats() const -> ParticleFrameStats { return _particleMngr.GetFrameStats(); }
 
     auto LoadSprite(hstring path, AtlasType atlas_type) -> shared_ptr<Sprite> override;
     void RetryFailedLoads() override;
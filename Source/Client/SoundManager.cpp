@@ -53,7 +53,16 @@ struct SoundManager::Sound
     bool IsMusic {};
     nanotime NextPlayTime {};
     timespan RepeatTime {};
-    unique_del_nptr<OggVorbis_File> OggStream {};
+    shared_ptr<SoundStream> Stream {};
+
+    ~Sound()
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        if (Stream) {
+            Stream->Cancel();
+        }
+    }
 };
 
 struct OggFileContext
@@ -62,6 +71,76 @@ struct OggFileContext
     FileReader Reader;
 };
 
+// Decodes the rest of a streamed Ogg file on the sound decoder worker
+class OggSoundStreamSource final : public SoundStreamSource
+{
+public:
+    using ConvertFunc = function<bool(vector<uint8_t>&)>;
+
+    OggSoundStreamSource(unique_del_nptr<OggVorbis_File> ogg_stream, size_t portion, ConvertFunc convert) :
+        _oggStream {std::move(ogg_stream)},
+        _portion {portion},
+        _convert {std::move(convert)}
+    {
+        FO_STACK_TRACE_ENTRY();
+    }
+    OggSoundStreamSource(const OggSoundStreamSource&) = delete;
+    OggSoundStreamSource(OggSoundStreamSource&&) noexcept = delete;
+    auto operator=(const OggSoundStreamSource&) = delete;
+    auto operator=(OggSoundStreamSource&&) noexcept = delete;
+    ~OggSoundStreamSource() override = default;
+
+    auto Decode(vector<uint8_t>& output) -> bool override
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        auto ogg_stream = _oggStream.as_nptr();
+        FO_VERIFY_AND_THROW(ogg_stream, "Ogg stream is null");
+        long result;
+        size_t decoded = 0;
+        output.resize(_portion);
+
+        while (true) {
+            auto buf = make_ptr(output.data()).offset(decoded).reinterpret_as<char>();
+            int32_t read_size = numeric_cast<int32_t>(_portion - decoded);
+            result = ov_read(ogg_stream.get(), buf.get(), read_size, 0, 2, 1, nullptr);
+
+            if (result <= 0) {
+                break;
+            }
+
+            decoded += numeric_cast<size_t>(result);
+
+            if (decoded >= _portion) {
+                break;
+            }
+        }
+
+        if (result < 0 || decoded == 0) {
+            return false;
+        }
+
+        output.resize(decoded);
+
+        return _convert(output);
+    }
+
+    auto Rewind() -> bool override
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        auto ogg_stream = _oggStream.as_nptr();
+        FO_VERIFY_AND_THROW(ogg_stream, "Ogg stream is null");
+
+        return ov_raw_seek(ogg_stream.get(), 0) == 0;
+    }
+
+private:
+    unique_del_nptr<OggVorbis_File> _oggStream;
+    size_t _portion;
+    ConvertFunc _convert;
+};
+
 static constexpr auto MakeUInt(uint8_t ch0, uint8_t ch1, uint8_t ch2, uint8_t ch3) -> uint32_t
 {
     return ch0 | ch1 << 8 | ch2 << 16 | ch3 << 24;
@@ -92,6 +171,18 @@ SoundManager::SoundManager(ptr<AudioSettings> settings, ptr<FileSystem> resource
     _streamingPortion = 0x10000; // 64kb
 #endif
 
+    if (int32_t format = _audio->GetOutputFormat(); format == AppAudio::AUDIO_FORMAT_U8) {
+        _mixer.emplace(SoundSampleFormat::U8);
+    }
+    else if (format == AppAudio::AUDIO_FORMAT_S16) {
+        _mixer.emplace(SoundSampleFormat::S16);
+    }
+    else if (format == AppAudio::AUDIO_FORMAT_F32) {
+        _mixer.emplace(SoundSampleFormat::F32);
+    }
+
+    _streamDecoder = SafeAlloc::MakeUnique<WorkThread>("SoundDecoder");
+
     _audio->SetSource([this](uint8_t silence, span<uint8_t> output) FO_DEFERRED { ProcessSounds(silence, output); });
     _isActive = true;
 }
@@ -106,6 +197,10 @@ SoundManager::~SoundManager()
         _audio->LockDevice();
         _playingSounds.clear();
         _audio->UnlockDevice();
+
+        // Decoding jobs convert through this manager, so they must be gone before it is
+        _streamDecoder->Clear();
+        _streamDecoder = nullptr;
     }
 }
 
@@ -113,6 +208,29 @@ void SoundManager::ProcessSounds(uint8_t silence, span<uint8_t> output)
 {
     FO_STACK_TRACE_ENTRY();
 
+    if (_mixer) {
+        // Every voice adds straight from its decoded buffer into one accumulator, and the device buffer is written
+        // once; a voice that ends early simply stops adding, so nothing pads it with silence
+        _mixer->Begin(output);
+
+        for (auto it = _playingSounds.begin(); it != _playingSounds.end();) {
+            auto sound = it->as_ptr();
+            int32_t volume = sound->IsMusic ? _settings->MusicVolume : _settings->SoundVolume;
+            float32_t gain = numeric_cast<float32_t>(std::clamp(volume, 0, 100)) / 100.0f;
+
+            if (ProcessSound(sound, output.size(), [this, gain](size_t offset, const_span<uint8_t> data) { _mixer->AddVoice(offset, data, gain); })) {
+                ++it;
+            }
+            else {
+                it = _playingSounds.erase(it);
+            }
+        }
+
+        _mixer->Resolve(output);
+        return;
+    }
+
+    // Device formats the mixer does not cover are mixed voice by voice through the device
     if (output.size() > _outputBuf.size()) {
         _outputBuf.resize(output.size());
     }
@@ -120,8 +238,19 @@ void SoundManager::ProcessSounds(uint8_t silence, span<uint8_t> output)
     for (auto it = _playingSounds.begin(); it != _playingSounds.end();) {
         auto sound = it->as_ptr();
         span<uint8_t> mix_buffer = span<uint8_t> {_outputBuf.data(), output.size()};
+        size_t written = 0;
+
+        bool playing = ProcessSound(sound, output.size(), [&mix_buffer, &written](size_t offset, const_span<uint8_t> data) {
+            MemCopy(mix_buffer.data() + offset, data.data(), data.size());
+            written = offset + data.size();
+        });
+
+        // Cut off end
+        if (written < mix_buffer.size()) {
+            MemFill(mix_buffer.data() + written, silence, mix_buffer.size() - written);
+        }
 
-        if (ProcessSound(sound, silence, mix_buffer)) {
+        if (playing) {
             int32_t volume = sound->IsMusic ? _settings->MusicVolume : _settings->SoundVolume;
             _audio->MixAudio(output, mix_buffer, numeric_cast<int32_t>(volume));
             ++it;
@@ -132,55 +261,30 @@ void SoundManager::ProcessSounds(uint8_t silence, span<uint8_t> output)
     }
 }
 
-auto SoundManager::ProcessSound(ptr<Sound> sound, uint8_t silence, span<uint8_t> output) -> bool
+auto SoundManager::ProcessSound(ptr<Sound> sound, size_t output_size, const function<void(size_t, const_span<uint8_t>)>& write) -> bool
 {
     FO_STACK_TRACE_ENTRY();
 
-    // Playing
-    if (sound->ConvertedBufCur < sound->ConvertedBuf.size()) {
-        if (output.size() > sound->ConvertedBuf.size() - sound->ConvertedBufCur) {
-            // Flush last part of buffer
-            auto offset = sound->ConvertedBuf.size() - sound->ConvertedBufCur;
-            auto target = make_ptr(output.data());
-            auto source = make_ptr(sound->ConvertedBuf.data()).offset(sound->ConvertedBufCur);
-            MemCopy(target, source, offset);
-            sound->ConvertedBufCur += offset;
-
-            // Stream new parts
-            while (offset < output.size() && sound->OggStream && StreamOgg(sound)) {
-                auto write = sound->ConvertedBuf.size() - sound->ConvertedBufCur;
-
-                if (offset + write > output.size()) {
-                    write = output.size() - offset;
-                }
+    // Playing from the read-ahead ring, decoding happens on the stream decoder worker
+    if (sound->Stream && !sound->Stream->IsPassFinished()) {
+        sound->Stream->Read(output_size, write);
 
-                auto stream_target = make_ptr(output.data()).offset(offset);
-                auto stream_source = make_ptr(sound->ConvertedBuf.data()).offset(sound->ConvertedBufCur);
-                MemCopy(stream_target, stream_source, write);
-                sound->ConvertedBufCur += write;
-                offset += write;
-            }
+        // Continue processing
+        return true;
+    }
 
-            // Cut off end
-            if (offset < output.size()) {
-                auto silence_target = make_ptr(output.data()).offset(offset);
-                MemFill(silence_target, silence, output.size() - offset);
-            }
-        }
-        else {
-            // Copy
-            if (!output.empty()) {
-                auto target = make_ptr(output.data());
-                auto source = make_ptr(sound->ConvertedBuf.data()).offset(sound->ConvertedBufCur);
-                MemCopy(target, source, output.size());
-            }
-            sound->ConvertedBufCur += output.size();
-        }
+    // Playing
+    if (!sound->Stream && sound->ConvertedBufCur < sound->ConvertedBuf.size()) {
+        const_span<uint8_t> converted_buf = sound->ConvertedBuf;
+        size_t write_size = std::min(output_size, sound->ConvertedBuf.size() - sound->ConvertedBufCur);
 
-        if (sound->OggStream && sound->ConvertedBufCur == sound->ConvertedBuf.size()) {
-            StreamOgg(sound);
+        if (write_size != 0) {
+            write(0, converted_buf.subspan(sound->ConvertedBufCur, write_size));
         }
 
+        // Whatever is left past the end stays silent
+        sound->ConvertedBufCur += write_size;
+
         // Continue processing
         return true;
     }
@@ -192,36 +296,27 @@ auto SoundManager::ProcessSound(ptr<Sound> sound, uint8_t silence, span<uint8_t>
         }
 
         if (nanotime::now() >= sound->NextPlayTime) {
-            // Set buffer to beginning
-            sound->ConvertedBufCur = 0;
-
-            if (sound->OggStream) {
-                auto ogg_stream = sound->OggStream.as_nptr();
-                FO_VERIFY_AND_THROW(ogg_stream, "Ogg stream is null");
-                ov_raw_seek(ogg_stream.get(), 0);
+            // Set buffer to beginning, a stream has already rewound and decoded ahead on the worker
+            if (sound->Stream) {
+                if (!sound->Stream->StartNextPass()) {
+                    return false;
+                }
+            }
+            else {
+                sound->ConvertedBufCur = 0;
             }
 
             // Drop timer
             sound->NextPlayTime = nanotime::zero;
 
             // Process without silent
-            return ProcessSound(sound, silence, output);
+            return ProcessSound(sound, output_size, write);
         }
 
         // Give silent
-        if (!output.empty()) {
-            auto silence_target = make_ptr(output.data());
-            MemFill(silence_target, silence, output.size());
-        }
         return true;
     }
 
-    // Give silent
-    if (!output.empty()) {
-        auto silence_target = make_ptr(output.data());
-        MemFill(silence_target, silence, output.size());
-    }
-
     return false;
 }
 
@@ -239,6 +334,8 @@ auto SoundManager::Load(string_view fname, bool is_music, timespan repeat_time)
     }
 
     auto sound = SafeAlloc::MakeUnique<Sound>();
+    sound->IsMusic = is_music;
+    sound->RepeatTime = repeat_time;
 
     if (ext == "wav" && !LoadWav(sound, fixed_fname)) {
         return false;
@@ -250,9 +347,6 @@ auto SoundManager::Load(string_view fname, bool is_music, timespan repeat_time)
         return false;
     }
 
-    sound->IsMusic = is_music;
-    sound->RepeatTime = repeat_time;
-
     _audio->LockDevice();
     _playingSounds.emplace_back(std::move(sound));
     _audio->UnlockDevice();
@@ -478,12 +572,12 @@ auto SoundManager::LoadOgg(ptr<Sound> sound, string_view fname) -> bool
 
     auto ogg_stream_owner = SafeAlloc::MakeUnique<OggVorbis_File>();
     auto released_ogg_stream = ogg_stream_owner.release();
-    sound->OggStream = make_unique_del_ptr(released_ogg_stream, [](OggVorbis_File* raw_vf) noexcept {
+    unique_del_nptr<OggVorbis_File> ogg_stream_holder = make_unique_del_ptr(released_ogg_stream, [](OggVorbis_File* raw_vf) noexcept {
         auto vf = make_ptr(raw_vf);
         auto owned_vf = adopt_unique_ptr(vf);
         ov_clear(owned_vf.get());
     });
-    auto ogg_stream = sound->OggStream.as_nptr();
+    auto ogg_stream = ogg_stream_holder.as_nptr();
     FO_VERIFY_AND_THROW(ogg_stream, "Ogg stream is null");
 
     FileReader reader = file.GetReader();
@@ -553,62 +647,65 @@ auto SoundManager::LoadOgg(ptr<Sound> sound, string_view fname) -> bool
 
     sound->BaseBufLen = decoded;
 
+    if (!ConvertData(sound)) {
+        return false;
+    }
+
     // No need streaming
     if (result == 0) {
-        sound->OggStream.reset();
+        return true;
     }
 
-    return ConvertData(sound);
-}
+    // The rest is decoded ahead on the worker, starting from the portion decoded here
+    size_t read_ahead_portions = numeric_cast<size_t>(std::max(_settings->SoundStreamReadAhead, 2));
+    size_t read_ahead = sound->ConvertedBuf.size() * read_ahead_portions;
+    int32_t format = sound->OriginalFormat;
+    int32_t channels = sound->OriginalChannels;
+    int32_t rate = sound->OriginalRate;
 
-auto SoundManager::StreamOgg(ptr<Sound> sound) -> bool
-{
-    FO_STACK_TRACE_ENTRY();
+    // Vorbis decodes to 16-bit samples, which gives the playback time of the portion decoded here
+    float64_t portion_seconds = static_cast<float64_t>(sound->BaseBufLen) / (static_cast<float64_t>(rate) * static_cast<float64_t>(channels) * static_cast<float64_t>(sizeof(int16_t)));
+    timespan read_ahead_time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<float64_t> {portion_seconds * static_cast<float64_t>(read_ahead_portions)});
+    auto convert = [this, format, channels, rate](vector<uint8_t>& buf) { return ConvertSamples(format, channels, rate, buf); };
+    auto source = SafeAlloc::MakeUnique<OggSoundStreamSource>(std::move(ogg_stream_holder), numeric_cast<size_t>(_streamingPortion), std::move(convert));
 
-    FO_VERIFY_AND_THROW(sound->OggStream, "Sound has no Ogg stream to read");
-    auto ogg_stream = sound->OggStream.as_nptr();
-    FO_VERIFY_AND_THROW(ogg_stream, "Ogg stream is null");
-    long result;
-    int32_t decoded = 0;
-    span<uint8_t> base_buf = span<uint8_t> {sound->BaseBuf.data(), sound->BaseBuf.size()};
+    sound->Stream = SafeAlloc::MakeShared<SoundStream>(std::max(read_ahead, size_t {1}), read_ahead_time, sound->RepeatTime != timespan::zero, std::move(source));
+    sound->Stream->Prime(sound->ConvertedBuf);
+    sound->ConvertedBuf.clear();
 
-    while (true) {
-        auto output = make_ptr(base_buf.data()).offset(numeric_cast<size_t>(decoded)).reinterpret_as<char>();
-        int32_t read_size = numeric_cast<int32_t>(_streamingPortion - decoded);
-        result = ov_read(ogg_stream.get(), output.get(), read_size, 0, 2, 1, nullptr);
+    _streamDecoder->AddJob([stream = sound->Stream]() FO_DEFERRED { return stream->Fill(); });
 
-        if (result <= 0) {
-            break;
-        }
+    return true;
+}
 
-        decoded += result;
+auto SoundManager::ConvertData(ptr<Sound> sound) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
 
-        if (decoded >= _streamingPortion) {
-            break;
-        }
-    }
+    sound->ConvertedBuf = sound->BaseBuf;
+    sound->ConvertedBuf.resize(sound->BaseBufLen);
 
-    if (result < 0 || decoded == 0) {
+    if (!ConvertSamples(sound->OriginalFormat, sound->OriginalChannels, sound->OriginalRate, sound->ConvertedBuf)) {
         return false;
     }
 
-    sound->BaseBufLen = decoded;
+    sound->ConvertedBufCur = 0;
 
-    return ConvertData(sound);
+    return true;
 }
 
-auto SoundManager::ConvertData(ptr<Sound> sound) -> bool
+auto SoundManager::ConvertSamples(int32_t format, int32_t channels, int32_t rate, vector<uint8_t>& buf) -> bool
 {
     FO_STACK_TRACE_ENTRY();
 
-    sound->ConvertedBuf = sound->BaseBuf;
-    sound->ConvertedBuf.resize(sound->BaseBufLen);
-
-    if (!_audio->ConvertAudio(sound->OriginalFormat, sound->OriginalChannels, sound->OriginalRate, sound->ConvertedBuf)) {
+    if (!_audio->ConvertAudio(format, channels, rate, buf)) {
         return false;
     }
 
-    sound->ConvertedBufCur = 0;
+    // A truncated trailing sample cannot be mixed, and would misalign every voice segment streamed after it
+    if (_mixer) {
+        buf.resize(buf.size() - buf.size() % SoundMixer::GetSampleSize(_mixer->GetFormat()));
+    }
 
     return true;
 }
@@ -37,6 +37,8 @@
 
 #include "FileSystem.h"
 #include "Settings.h"
+#include "SoundMixer.h"
+#include "SoundStream.h"
 
 FO_BEGIN_NAMESPACE
 
@@ -66,9 +68,9 @@ class SoundManager final
     auto LoadAcm(ptr<Sound> sound, string_view fname, bool is_music) -> bool;
     auto LoadOgg(ptr<Sound> sound, string_view fname) -> bool;
     void ProcessSounds(uint8_t silence, span<uint8_t> output);
-    auto ProcessSound(ptr<Sound> sound, uint8_t silence, span<uint8_t> output) -> bool;
-    auto StreamOgg(ptr<Sound> sound) -> bool;
+    auto ProcessSound(ptr<Sound> sound, size_t output_size, const function<void(size_t, const_span<uint8_t>)>& write) -> bool;
     auto ConvertData(ptr<Sound> sound) -> bool;
+    auto ConvertSamples(int32_t format, int32_t channels, int32_t rate, vector<uint8_t>& buf) -> bool;
 
     ptr<AudioSettings> _settings;
     ptr<FileSystem> _resources;
@@ -77,6 +79,8 @@ class SoundManager final
     int32_t _streamingPortion {};
     vector<unique_ptr<Sound>> _playingSounds;
     vector<uint8_t> _outputBuf {};
+    optional<SoundMixer> _mixer {};
+    unique_nptr<WorkThread> _streamDecoder {};
     std::mt19937 _randomGenerator {MakeSeededRandomGenerator()};
 };
 
@@ -0,0 +1,313 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "SoundMixer.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FO_SOUND_MIXER_SSE2 1
+#define FO_SOUND_MIXER_NEON 0
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define FO_SOUND_MIXER_SSE2 0
+#define FO_SOUND_MIXER_NEON 1
+#include <arm_neon.h>
+#else
+#define FO_SOUND_MIXER_SSE2 0
+#define FO_SOUND_MIXER_NEON 0
+#endif
+
+FO_BEGIN_NAMESPACE
+
+SoundMixer::SoundMixer(SoundSampleFormat format) noexcept :
+    _format {format}
+{
+    FO_NO_STACK_TRACE_ENTRY();
+}
+
+auto SoundMixer::GetSampleSize(SoundSampleFormat format) noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    switch (format) {
+    case SoundSampleFormat::U8:
+        return sizeof(uint8_t);
+    case SoundSampleFormat::S16:
+        return sizeof(int16_t);
+    case SoundSampleFormat::F32:
+        return sizeof(float32_t);
+    }
+
+    return 1;
+}
+
+void SoundMixer::Begin(const_span<uint8_t> output)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    size_t sample_size = GetSampleSize(_format);
+    FO_VERIFY_AND_THROW(output.size() % sample_size == 0, "Sound mix buffer is not a whole number of samples", output.size(), sample_size);
+
+    _samplesCount = output.size() / sample_size;
+
+    // The device buffer arrives pre-filled (normally with silence) and voices add on top of it
+    switch (_format) {
+    case SoundSampleFormat::U8:
+        _intAccum.resize(_samplesCount);
+
+        for (size_t i = 0; i < _samplesCount; i++) {
+            _intAccum[i] = output[i];
+        }
+        break;
+    case SoundSampleFormat::S16:
+        _intAccum.resize(_samplesCount);
+
+        for (size_t i = 0; i < _samplesCount; i++) {
+            int16_t sample;
+            MemCopy(&sample, output.data() + i * sizeof(int16_t), sizeof(int16_t));
+            _intAccum[i] = sample;
+        }
+        break;
+    case SoundSampleFormat::F32:
+        _floatAccum.resize(_samplesCount);
+
+        if (!output.empty()) {
+            MemCopy(_floatAccum.data(), output.data(), output.size());
+        }
+        break;
+    }
+}
+
+void SoundMixer::AddVoice(size_t output_offset, const_span<uint8_t> voice, float32_t gain)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    size_t sample_size = GetSampleSize(_format);
+    FO_VERIFY_AND_THROW(output_offset % sample_size == 0 && voice.size() % sample_size == 0, "Sound voice is not sample aligned", output_offset, voice.size(), sample_size);
+    FO_VERIFY_AND_THROW(output_offset + voice.size() <= _samplesCount * sample_size, "Sound voice overruns the mix buffer", output_offset, voice.size(), _samplesCount * sample_size);
+
+    // Same volume range the device mixer accepts; it also keeps every scaled sample inside its own format's range
+    gain = std::clamp(gain, 0.0f, 1.0f);
+
+    if (voice.empty() || gain == 0.0f) {
+        return;
+    }
+
+    size_t count = voice.size() / sample_size;
+    const uint8_t* src = voice.data();
+    size_t i = 0;
+
+    switch (_format) {
+    case SoundSampleFormat::U8: {
+        int32_t* acc = _intAccum.data() + output_offset;
+
+#if FO_SOUND_MIXER_SSE2
+        const __m128 gain4 = _mm_set1_ps(gain);
+        const __m128 bias4 = _mm_set1_ps(128.0f);
+        const __m128i zero = _mm_setzero_si128();
+
+        for (; i + 16 <= count; i += 16) {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            __m128i words_lo = _mm_unpacklo_epi8(bytes, zero);
+            __m128i words_hi = _mm_unpackhi_epi8(bytes, zero);
+            const __m128i dwords[4] = {_mm_unpacklo_epi16(words_lo, zero), _mm_unpackhi_epi16(words_lo, zero), _mm_unpacklo_epi16(words_hi, zero), _mm_unpackhi_epi16(words_hi, zero)};
+
+            for (size_t k = 0; k < 4; k++) {
+                __m128 centered = _mm_sub_ps(_mm_cvtepi32_ps(dwords[k]), bias4);
+                __m128i scaled = _mm_cvttps_epi32(_mm_mul_ps(centered, gain4));
+                auto* dst = reinterpret_cast<__m128i*>(acc + i + k * 4);
+                _mm_storeu_si128(dst, _mm_add_epi32(_mm_loadu_si128(dst), scaled));
+            }
+        }
+#elif FO_SOUND_MIXER_NEON
+        const float32x4_t gain4 = vdupq_n_f32(gain);
+        const float32x4_t bias4 = vdupq_n_f32(128.0f);
+
+        for (; i + 8 <= count; i += 8) {
+            uint16x8_t words = vmovl_u8(vld1_u8(src + i));
+            const int32x4_t dwords[2] = {vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(words))), vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(words)))};
+
+            for (size_t k = 0; k < 2; k++) {
+                float32x4_t centered = vsubq_f32(vcvtq_f32_s32(dwords[k]), bias4);
+                int32x4_t scaled = vcvtq_s32_f32(vmulq_f32(centered, gain4));
+                vst1q_s32(acc + i + k * 4, vaddq_s32(vld1q_s32(acc + i + k * 4), scaled));
+            }
+        }
+#endif
+
+        // Centered samples truncate toward zero, as the device mixer's integer volume scaling did
+        for (; i < count; i++) {
+            acc[i] += static_cast<int32_t>((static_cast<float32_t>(src[i]) - 128.0f) * gain);
+        }
+    } break;
+    case SoundSampleFormat::S16: {
+        int32_t* acc = _intAccum.data() + output_offset / sizeof(int16_t);
+
+#if FO_SOUND_MIXER_SSE2
+        const __m128 gain4 = _mm_set1_ps(gain);
+
+        for (; i + 8 <= count; i += 8) {
+            __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * sizeof(int16_t)));
+            const __m128i dwords[2] = {_mm_srai_epi32(_mm_unpacklo_epi16(words, words), 16), _mm_srai_epi32(_mm_unpackhi_epi16(words, words), 16)};
+
+            for (size_t k = 0; k < 2; k++) {
+                __m128i scaled = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(dwords[k]), gain4));
+                auto* dst = reinterpret_cast<__m128i*>(acc + i + k * 4);
+                _mm_storeu_si128(dst, _mm_add_epi32(_mm_loadu_si128(dst), scaled));
+            }
+        }
+#elif FO_SOUND_MIXER_NEON
+        const float32x4_t gain4 = vdupq_n_f32(gain);
+
+        for (; i + 8 <= count; i += 8) {
+            int16x8_t words = vreinterpretq_s16_u8(vld1q_u8(src + i * sizeof(int16_t)));
+            const int32x4_t dwords[2] = {vmovl_s16(vget_low_s16(words)), vmovl_s16(vget_high_s16(words))};
+
+            for (size_t k = 0; k < 2; k++) {
+                int32x4_t scaled = vcvtq_s32_f32(vmulq_f32(vcvtq_f32_s32(dwords[k]), gain4));
+                vst1q_s32(acc + i + k * 4, vaddq_s32(vld1q_s32(acc + i + k * 4), scaled));
+            }
+        }
+#endif
+
+        for (; i < count; i++) {
+            int16_t sample;
+            MemCopy(&sample, src + i * sizeof(int16_t), sizeof(int16_t));
+            acc[i] += static_cast<int32_t>(static_cast<float32_t>(sample) * gain);
+        }
+    } break;
+    case SoundSampleFormat::F32: {
+        float32_t* acc = _floatAccum.data() + output_offset / sizeof(float32_t);
+
+#if FO_SOUND_MIXER_SSE2
+        const __m128 gain4 = _mm_set1_ps(gain);
+
+        for (; i + 4 <= count; i += 4) {
+            __m128 samples = _mm_loadu_ps(reinterpret_cast<const float32_t*>(src + i * sizeof(float32_t)));
+            _mm_storeu_ps(acc + i, _mm_add_ps(_mm_loadu_ps(acc + i), _mm_mul_ps(samples, gain4)));
+        }
+#elif FO_SOUND_MIXER_NEON
+        const float32x4_t gain4 = vdupq_n_f32(gain);
+
+        for (; i + 4 <= count; i += 4) {
+            float32x4_t samples = vreinterpretq_f32_u8(vld1q_u8(src + i * sizeof(float32_t)));
+            vst1q_f32(acc + i, vaddq_f32(vld1q_f32(acc + i), vmulq_f32(samples, gain4)));
+        }
+#endif
+
+        for (; i < count; i++) {
+            float32_t sample;
+            MemCopy(&sample, src + i * sizeof(float32_t), sizeof(float32_t));
+            acc[i] += sample * gain;
+        }
+    } break;
+    }
+}
+
+void SoundMixer::Resolve(span<uint8_t> output) const
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(output.size() == _samplesCount * GetSampleSize(_format), "Sound mix output size mismatch", output.size(), _samplesCount, GetSampleSize(_format));
+
+    uint8_t* dst = output.data();
+    size_t i = 0;
+
+    switch (_format) {
+    case SoundSampleFormat::U8: {
+        const int32_t* acc = _intAccum.data();
+
+#if FO_SOUND_MIXER_SSE2
+        for (; i + 16 <= _samplesCount; i += 16) {
+            __m128i words_lo = _mm_packs_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(acc + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc + i + 4)));
+            __m128i words_hi = _mm_packs_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(acc + i + 8)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc + i + 12)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(words_lo, words_hi));
+        }
+#elif FO_SOUND_MIXER_NEON
+        for (; i + 8 <= _samplesCount; i += 8) {
+            int16x8_t words = vcombine_s16(vqmovn_s32(vld1q_s32(acc + i)), vqmovn_s32(vld1q_s32(acc + i + 4)));
+            vst1_u8(dst + i, vqmovun_s16(words));
+        }
+#endif
+
+        for (; i < _samplesCount; i++) {
+            dst[i] = static_cast<uint8_t>(std::clamp(acc[i], 0, 255));
+        }
+    } break;
+    case SoundSampleFormat::S16: {
+        const int32_t* acc = _intAccum.data();
+
+#if FO_SOUND_MIXER_SSE2
+        for (; i + 8 <= _samplesCount; i += 8) {
+            __m128i words = _mm_packs_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(acc + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc + i + 4)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * sizeof(int16_t)), words);
+        }
+#elif FO_SOUND_MIXER_NEON
+        for (; i + 8 <= _samplesCount; i += 8) {
+            int16x8_t words = vcombine_s16(vqmovn_s32(vld1q_s32(acc + i)), vqmovn_s32(vld1q_s32(acc + i + 4)));
+            vst1q_u8(dst + i * sizeof(int16_t), vreinterpretq_u8_s16(words));
+        }
+#endif
+
+        for (; i < _samplesCount; i++) {
+            auto sample = static_cast<int16_t>(std::clamp<int32_t>(acc[i], std::numeric_limits<int16_t>::min(), std::numeric_limits<int16_t>::max()));
+            MemCopy(dst + i * sizeof(int16_t), &sample, sizeof(int16_t));
+        }
+    } break;
+    case SoundSampleFormat::F32: {
+        const float32_t* acc = _floatAccum.data();
+
+#if FO_SOUND_MIXER_SSE2
+        const __m128 min4 = _mm_set1_ps(-1.0f);
+        const __m128 max4 = _mm_set1_ps(1.0f);
+
+        for (; i + 4 <= _samplesCount; i += 4) {
+            _mm_storeu_ps(reinterpret_cast<float32_t*>(dst + i * sizeof(float32_t)), _mm_min_ps(_mm_max_ps(_mm_loadu_ps(acc + i), min4), max4));
+        }
+#elif FO_SOUND_MIXER_NEON
+        const float32x4_t min4 = vdupq_n_f32(-1.0f);
+        const float32x4_t max4 = vdupq_n_f32(1.0f);
+
+        for (; i + 4 <= _samplesCount; i += 4) {
+            vst1q_u8(dst + i * sizeof(float32_t), vreinterpretq_u8_f32(vminq_f32(vmaxq_f32(vld1q_f32(acc + i), min4), max4)));
+        }
+#endif
+
+        for (; i < _samplesCount; i++) {
+            float32_t sample = std::clamp(acc[i], -1.0f, 1.0f);
+            MemCopy(dst + i * sizeof(float32_t), &sample, sizeof(float32_t));
+        }
+    } break;
+    }
+}
+
+FO_END_NAMESPACE
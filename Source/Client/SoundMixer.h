@@ -0,0 +1,77 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+FO_BEGIN_NAMESPACE
+
+enum class SoundSampleFormat : uint8_t
+{
+    U8,
+    S16,
+    F32,
+};
+
+// Sums every playing voice of one device buffer in a wide accumulator and saturates once on resolve, so the output
+// is walked twice per buffer regardless of the voice count. Integer output accumulates per-voice truncated samples
+// in int32 and float output accumulates in float32, in voice order, so a mix that never clips matches mixing the
+// voices one by one into the device buffer
+class SoundMixer final
+{
+public:
+    explicit SoundMixer(SoundSampleFormat format) noexcept;
+    SoundMixer(const SoundMixer&) = delete;
+    SoundMixer(SoundMixer&&) noexcept = default;
+    auto operator=(const SoundMixer&) = delete;
+    auto operator=(SoundMixer&&) noexcept -> SoundMixer& = default;
+    ~SoundMixer() = default;
+
+    [[nodiscard]] static auto GetSampleSize(SoundSampleFormat format) noexcept -> size_t;
+
+    [[nodiscard]] auto GetFormat() const noexcept -> SoundSampleFormat { return _format; }
+    [[nodiscard]] auto GetSamplesCount() const noexcept -> size_t { return _samplesCount; }
+
+    void Begin(const_span<uint8_t> output);
+    void AddVoice(size_t output_offset, const_span<uint8_t> voice, float32_t gain);
+    void Resolve(span<uint8_t> output) const;
+
+private:
+    SoundSampleFormat _format;
+    size_t _samplesCount {};
+    vector<int32_t> _intAccum {};
+    vector<float32_t> _floatAccum {};
+};
+
+FO_END_NAMESPACE
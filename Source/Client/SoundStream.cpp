@@ -0,0 +1,203 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SoundStream.h"
+
+FO_BEGIN_NAMESPACE
+
+// Shortest sleep of a stream with a full ring, or one waiting for the consumer to reach its pass end
+static constexpr auto MIN_FILL_RETRY_DELAY = std::chrono::milliseconds {1};
+
+SoundStream::SoundStream(size_t capacity, timespan capacity_time, bool repeat, unique_ptr<SoundStreamSource> source) :
+    _capacityTime {capacity_time},
+    _repeat {repeat},
+    _source {std::move(source)}
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(capacity != 0, "Sound stream capacity is zero");
+
+    _ring.resize(capacity);
+}
+
+auto SoundStream::GetBufferedSize() const noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    uint64_t write_pos = _writePos.load(std::memory_order_acquire);
+    uint64_t read_pos = _readPos.load(std::memory_order_acquire);
+
+    return static_cast<size_t>(write_pos - read_pos);
+}
+
+auto SoundStream::IsPassFinished() const noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return _readPos.load(std::memory_order_relaxed) == _passEnd.load(std::memory_order_acquire);
+}
+
+auto SoundStream::Read(size_t size, const function<void(size_t, const_span<uint8_t>)>& write) -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Write position first: the pass end is published before any data of the next pass
+    uint64_t read_pos = _readPos.load(std::memory_order_relaxed);
+    uint64_t write_pos = _writePos.load(std::memory_order_acquire);
+    uint64_t pass_end = _passEnd.load(std::memory_order_acquire);
+    size_t count = numeric_cast<size_t>(std::min<uint64_t>(std::min(write_pos, pass_end) - read_pos, size));
+    const_span<uint8_t> ring = _ring;
+
+    for (size_t offset = 0; offset < count;) {
+        size_t index = numeric_cast<size_t>((read_pos + offset) % ring.size());
+        size_t chunk = std::min(count - offset, ring.size() - index);
+        write(offset, ring.subspan(index, chunk));
+        offset += chunk;
+    }
+
+    _readPos.store(read_pos + count, std::memory_order_release);
+
+    if (count < size && read_pos + count != pass_end) {
+        _underruns.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return count;
+}
+
+auto SoundStream::StartNextPass() noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (!IsPassFinished() || _finalPass.load(std::memory_order_relaxed)) {
+        return false;
+    }
+
+    _passEnd.store(NO_PASS_END, std::memory_order_release);
+    return true;
+}
+
+void SoundStream::Cancel() noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    _cancelled.store(true, std::memory_order_release);
+}
+
+void SoundStream::Prime(const_span<uint8_t> data)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _pending.insert(_pending.end(), data.begin(), data.end());
+
+    PushPending();
+}
+
+auto SoundStream::Fill() -> optional<timespan>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (IsCancelled()) {
+        return std::nullopt;
+    }
+
+    if (_pendingOffset == _pending.size()) {
+        if (_sourceEnded) {
+            // Only one pass end can be pending, so the next pass is held back until the consumer reaches it
+            if (_passEnd.load(std::memory_order_acquire) != NO_PASS_END) {
+                return _finalPass.load(std::memory_order_relaxed) ? optional<timespan> {} : optional<timespan> {GetRetryDelay()};
+            }
+
+            uint64_t write_pos = _writePos.load(std::memory_order_relaxed);
+
+            // An empty pass would loop forever
+            if (!_repeat || write_pos == _passStart || !_source->Rewind()) {
+                _finalPass.store(true, std::memory_order_relaxed);
+                _passEnd.store(write_pos, std::memory_order_release);
+                return std::nullopt;
+            }
+
+            _passEnd.store(write_pos, std::memory_order_release);
+            _passStart = write_pos;
+            _sourceEnded = false;
+            return timespan::zero;
+        }
+
+        _pending.clear();
+        _pendingOffset = 0;
+
+        if (!_source->Decode(_pending) || _pending.empty()) {
+            _pending.clear();
+            _sourceEnded = true;
+            return timespan::zero;
+        }
+    }
+
+    PushPending();
+
+    return _pendingOffset == _pending.size() ? timespan::zero : GetRetryDelay();
+}
+
+auto SoundStream::GetRetryDelay() const noexcept -> timespan
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    // Half the playback time of what is buffered: the consumer still has the other half when the worker is back,
+    // and a stream parked at its pass end keeps the next pass behind it as that margin
+    auto playback_ns = static_cast<float64_t>(_capacityTime.nanoseconds()) * static_cast<float64_t>(GetBufferedSize()) / static_cast<float64_t>(_ring.size());
+    timespan delay = std::chrono::nanoseconds {static_cast<int64_t>(playback_ns / 2.0)};
+
+    return std::max(delay, timespan {MIN_FILL_RETRY_DELAY});
+}
+
+void SoundStream::PushPending()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    uint64_t write_pos = _writePos.load(std::memory_order_relaxed);
+    uint64_t read_pos = _readPos.load(std::memory_order_acquire);
+    size_t free_size = _ring.size() - numeric_cast<size_t>(write_pos - read_pos);
+    size_t count = std::min(free_size, _pending.size() - _pendingOffset);
+
+    for (size_t offset = 0; offset < count;) {
+        size_t index = numeric_cast<size_t>((write_pos + offset) % _ring.size());
+        size_t chunk = std::min(count - offset, _ring.size() - index);
+        MemCopy(_ring.data() + index, _pending.data() + _pendingOffset + offset, chunk);
+        offset += chunk;
+    }
+
+    _pendingOffset += count;
+    _writePos.store(write_pos + count, std::memory_order_release);
+}
+
+FO_END_NAMESPACE
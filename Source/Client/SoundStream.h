@@ -0,0 +1,108 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+#include "Common.h"
+
+FO_BEGIN_NAMESPACE
+
+// Produces the decoded, device-converted PCM of one streamed sound; only the decoder worker calls it
+class SoundStreamSource
+{
+public:
+    SoundStreamSource() = default;
+    SoundStreamSource(const SoundStreamSource&) = delete;
+    SoundStreamSource(SoundStreamSource&&) noexcept = delete;
+    auto operator=(const SoundStreamSource&) = delete;
+    auto operator=(SoundStreamSource&&) noexcept = delete;
+    virtual ~SoundStreamSource() = default;
+
+    virtual auto Decode(vector<uint8_t>& output) -> bool = 0; // False when nothing more can be decoded
+    virtual auto Rewind() -> bool = 0;
+};
+
+// Read-ahead of one streamed sound. A decoder worker keeps a single-producer/single-consumer ring of decoded PCM
+// filled through repeated Fill jobs, and the audio callback only copies out of it with Read. A repeating stream
+// rewinds on the worker as soon as its source ends and decodes the next pass behind a pass end mark, so a loop
+// restart never waits for a seek. While the ring is full the worker sleeps for half the playback time of what is
+// buffered, so a long read-ahead costs few wakeups
+class SoundStream final
+{
+public:
+    SoundStream(size_t capacity, timespan capacity_time, bool repeat, unique_ptr<SoundStreamSource> source);
+    SoundStream(const SoundStream&) = delete;
+    SoundStream(SoundStream&&) noexcept = delete;
+    auto operator=(const SoundStream&) = delete;
+    auto operator=(SoundStream&&) noexcept = delete;
+    ~SoundStream() = default;
+
+    [[nodiscard]] auto GetCapacity() const noexcept -> size_t { return _ring.size(); }
+    [[nodiscard]] auto GetBufferedSize() const noexcept -> size_t;
+    [[nodiscard]] auto GetUnderruns() const noexcept -> uint64_t { return _underruns.load(std::memory_order_relaxed); }
+    [[nodiscard]] auto IsPassFinished() const noexcept -> bool;
+    [[nodiscard]] auto IsCancelled() const noexcept -> bool { return _cancelled.load(std::memory_order_acquire); }
+
+    // Consumer side
+    auto Read(size_t size, const function<void(size_t, const_span<uint8_t>)>& write) -> size_t;
+    auto StartNextPass() noexcept -> bool;
+    void Cancel() noexcept;
+
+    // Producer side
+    void Prime(const_span<uint8_t> data);
+    auto Fill() -> optional<timespan>;
+
+private:
+    static constexpr uint64_t NO_PASS_END = std::numeric_limits<uint64_t>::max();
+
+    void PushPending();
+    [[nodiscard]] auto GetRetryDelay() const noexcept -> timespan;
+
+    vector<uint8_t> _ring;
+    timespan _capacityTime;
+    bool _repeat;
+    unique_ptr<SoundStreamSource> _source;
+    vector<uint8_t> _pending {};
+    size_t _pendingOffset {};
+    bool _sourceEnded {};
+    uint64_t _passStart {};
+    std::atomic_uint64_t _writePos {};
+    std::atomic_uint64_t _readPos {};
+    std::atomic_uint64_t _passEnd {NO_PASS_END};
+    std::atomic_bool _finalPass {};
+    std::atomic_bool _cancelled {};
+    std::atomic_uint64_t _underruns {};
+};
+
+FO_END_NAMESPACE
@@ -1201,6 +1201,10 @@ void SpriteManager::DrawSprites(MapSpriteList& mspr_list, irect32 draw_area, boo
         FO_VERIFY_AND_THROW(mspr->IsValid(), "Map sprite is invalid");
 
         if (mspr->IsHidden()) {
+            if (auto hidden_spr = mspr->GetSprite()) {
+                hidden_spr->SetInView(false);
+            }
+
             continue;
         }
 
@@ -1212,7 +1216,10 @@ void SpriteManager::DrawSprites(MapSpriteList& mspr_list, irect32 draw_area, boo
         mspr_rect.y -= draw_area.y;
 
         // Skip not visible
-        if (mspr_rect.x > draw_area.width || mspr_rect.x + mspr_rect.width < 0 || mspr_rect.y > draw_area.height || mspr_rect.y + mspr_rect.height < 0) {
+        bool in_view = mspr_rect.x <= draw_area.width && mspr_rect.x + mspr_rect.width >= 0 && mspr_rect.y <= draw_area.height && mspr_rect.y + mspr_rect.height >= 0;
+        spr->SetInView(in_view);
+
+        if (!in_view) {
             continue;
         }
 
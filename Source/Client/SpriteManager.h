@@ -98,6 +98,7 @@ class Sprite : public enable_shared_from_this<Sprite>
     virtual void Stop() { }
     virtual auto Update() -> bool { return false; }
     virtual void DrawInScene(fpos32 scene_pos, float32_t depth) const { ignore_unused(scene_pos, depth); }
+    virtual void SetInView(bool in_view) const { ignore_unused(in_view); } // Map drawing reports every frame whether the sprite is inside the view
 
 protected:
     void StartUpdate();
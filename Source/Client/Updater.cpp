@@ -61,6 +61,7 @@ Updater::Updater(ptr<GlobalSettings> settings, ptr<IAppWindow> window) :
     _settings {settings},
     _conn(settings),
     _cache(fs_make_writable_path(settings->UserWritablePath, settings->CacheResources)),
+    _localHashes(make_ptr(&_cache), numeric_cast<size_t>(std::max(settings->UpdaterHashThreads, 0))),
     _binaryDir {settings->UserWritablePath.empty() ? GetClientBinaryDir() : string(settings->UserWritablePath)},
     _gameTime(settings),
     _effectMngr(settings, make_ptr(&_resources), window->GetRender()),
@@ -114,6 +115,7 @@ Updater::Updater(ptr<GlobalSettings> settings, ptr<IAppWindow> window) :
     _conn.AddMessageHandler(NetMessage::TimeSync, [this]() FO_DEFERRED { Net_OnTimeSync(); });
     _conn.AddMessageHandler(NetMessage::HashList, [this]() FO_DEFERRED { Net_OnHashList(); });
     _conn.AddMessageHandler(NetMessage::UpdateFileData, [this]() FO_DEFERRED { Net_OnUpdateFileData(); });
+    _conn.AddMessageHandler(NetMessage::UpdateFileDelta, [this]() FO_DEFERRED { Net_OnUpdateFileDelta(); });
 
     // Connect
     AddText(StrConnectToServer);
@@ -232,6 +234,8 @@ void Updater::Abort(string_view text)
     if (_tempFile.is_open()) {
         _tempFile.close();
     }
+
+    ResetUpdateFileDelta();
 }
 
 void Updater::FinishResourcesUpdate()
@@ -310,25 +314,36 @@ void Updater::GetNextFile()
             return;
         }
 
-        const auto& prev_update_file = _filesToUpdate.front();
+        auto& prev_update_file = _filesToUpdate.front();
         string prev_path_str = make_final_path(prev_update_file);
         string temp_path_str = make_temp_path(prev_update_file);
 
         if (!IsDiskFileHashMatch(temp_path_str, prev_update_file.Size, prev_update_file.Hash)) {
-            WriteLog("Client updater: downloaded file hash mismatch, temp {}, file {}", temp_path_str, prev_update_file.Name);
-            Abort(StrFilesystemError);
-            return;
+            // Block signatures can collide where the whole-file hash does not, so a rebuilt file gets one plain retry
+            if (prev_update_file.DeltaApplied) {
+                WriteLog("Client updater: delta rebuilt file hash mismatch, temp {}, file {}, downloading in full", temp_path_str, prev_update_file.Name);
+                fs_remove_file(temp_path_str);
+                prev_update_file.BasisPath.clear();
+                prev_update_file.DeltaApplied = false;
+                prev_update_file.RemaningSize = prev_update_file.Size;
+            }
+            else {
+                WriteLog("Client updater: downloaded file hash mismatch, temp {}, file {}", temp_path_str, prev_update_file.Name);
+                Abort(StrFilesystemError);
+                return;
+            }
         }
+        else {
+            if (!ReplaceFileSafely(temp_path_str, prev_path_str)) {
+                WriteLog("Client updater: failed to promote downloaded file from {} to {}", temp_path_str, prev_path_str);
+                Abort(StrFilesystemError);
+                return;
+            }
 
-        if (!ReplaceFileSafely(temp_path_str, prev_path_str)) {
-            WriteLog("Client updater: failed to promote downloaded file from {} to {}", temp_path_str, prev_path_str);
-            Abort(StrFilesystemError);
-            return;
+            WriteLog("Client updater: promoted downloaded file to {}, binary {}", prev_path_str, prev_update_file.IsClientBinary ? "yes" : "no");
+            try_promote_staged_binary(prev_update_file, prev_path_str);
+            _filesToUpdate.erase(_filesToUpdate.begin());
         }
-
-        WriteLog("Client updater: promoted downloaded file to {}, binary {}", prev_path_str, prev_update_file.IsClientBinary ? "yes" : "no");
-        try_promote_staged_binary(prev_update_file, prev_path_str);
-        _filesToUpdate.erase(_filesToUpdate.begin());
     }
 
     if (!_filesToUpdate.empty()) {
@@ -387,8 +402,14 @@ void Updater::GetNextFile()
             return;
         }
 
-        WriteLog("Client updater: requesting file {}, binary {}, size {}, remaining {}, temp {}, final {}", next_update_file.Name, next_update_file.IsClientBinary ? "yes" : "no", next_update_file.Size, next_update_file.RemaningSize, temp_path, prev_path_str);
-        RequestUpdateFile(next_update_file);
+        // A partial temp file is already a prefix of the new content, so only a fresh transfer starts from a delta
+        if (next_update_file.RemaningSize == next_update_file.Size && RequestUpdateFileDelta(next_update_file)) {
+            WriteLog("Client updater: requesting delta for file {} against {}, binary {}, size {}, temp {}, final {}", next_update_file.Name, next_update_file.BasisPath, next_update_file.IsClientBinary ? "yes" : "no", next_update_file.Size, temp_path, prev_path_str);
+        }
+        else {
+            WriteLog("Client updater: requesting file {}, binary {}, size {}, remaining {}, temp {}, final {}", next_update_file.Name, next_update_file.IsClientBinary ? "yes" : "no", next_update_file.Size, next_update_file.RemaningSize, temp_path, prev_path_str);
+            RequestUpdateFile(next_update_file, next_update_file.RemaningSize);
+        }
     }
     else {
         if (_binariesMode) {
@@ -410,7 +431,7 @@ void Updater::GetNextFile()
     _bytesRealReceivedCheckpoint = _conn.GetUnpackedBytesReceived();
 }
 
-void Updater::RequestUpdateFile(const UpdateFile& update_file)
+void Updater::RequestUpdateFile(const UpdateFile& update_file, uint64_t size_limit)
 {
     FO_STACK_TRACE_ENTRY();
 
@@ -419,7 +440,121 @@ void Updater::RequestUpdateFile(const UpdateFile& update_file)
     _conn.OutBuf->StartMsg(NetMessage::GetUpdateFile);
     _conn.OutBuf->Write(update_file.Index);
     _conn.OutBuf->Write(numeric_cast<uint64_t>(start_offset));
+    _conn.OutBuf->Write(size_limit);
+    _conn.OutBuf->EndMsg();
+}
+
+auto Updater::RequestUpdateFileDelta(const UpdateFile& update_file) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (update_file.BasisPath.empty()) {
+        return false;
+    }
+
+    auto basis_size = fs_file_size(update_file.BasisPath);
+    uint32_t block_size = GetUpdateDeltaBlockSize(update_file.Size);
+
+    if (!basis_size.has_value() || *basis_size < block_size || *basis_size / block_size > UPDATE_DELTA_MAX_BLOCKS) {
+        return false;
+    }
+
+    _deltaBasisFile = fs_open_ifstream(update_file.BasisPath);
+
+    if (!_deltaBasisFile) {
+        WriteLog("Client updater: can't open delta basis {}", update_file.BasisPath);
+        ResetUpdateFileDelta();
+        return false;
+    }
+
+    UpdateBlockSignatures signatures;
+    signatures.BlockSize = block_size;
+    signatures.Blocks.reserve(numeric_cast<size_t>(*basis_size / block_size));
+    _updateFileBuf.resize(block_size);
+
+    for (uint64_t i = 0; i < *basis_size / block_size; i++) {
+        if (!stream_read_exact(_deltaBasisFile, _updateFileBuf)) {
+            WriteLog("Client updater: can't read delta basis {}", update_file.BasisPath);
+            ResetUpdateFileDelta();
+            return false;
+        }
+
+        signatures.Blocks.emplace_back(MakeUpdateBlockSignature(_updateFileBuf));
+    }
+
+    _deltaBasisSize = *basis_size;
+    _deltaRequested = true;
+
+    _conn.OutBuf->StartMsg(NetMessage::GetUpdateFileDelta);
+    _conn.OutBuf->Write(update_file.Index);
+    WriteUpdateBlockSignatures(*_conn.OutBuf, signatures);
     _conn.OutBuf->EndMsg();
+
+    return true;
+}
+
+void Updater::ContinueUpdateFileDelta()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto& update_file = _filesToUpdate.front();
+
+    while (_deltaOpIndex < _deltaOps.size()) {
+        const auto& op = _deltaOps[_deltaOpIndex];
+
+        if (op.Type == UpdateDeltaOpType::Literal) {
+            RequestUpdateFile(update_file, op.Size - _deltaOpDone);
+            _bytesRealReceivedCheckpoint = _conn.GetUnpackedBytesReceived();
+            return;
+        }
+
+        _deltaBasisFile.seekg(numeric_cast<std::streamoff>(op.Offset), std::ios::beg);
+
+        for (uint64_t copied = 0; copied < op.Size;) {
+            auto chunk_size = numeric_cast<size_t>(std::min(op.Size - copied, numeric_cast<uint64_t>(UPDATE_DELTA_MAX_BLOCK_SIZE)));
+            _updateFileBuf.resize(chunk_size);
+
+            if (!_deltaBasisFile || !stream_read_exact(_deltaBasisFile, _updateFileBuf)) {
+                WriteLog("Client updater: can't read delta basis {}", update_file.BasisPath);
+                Abort(StrFilesystemError);
+                return;
+            }
+
+            _tempFile.write(make_ptr(_updateFileBuf.data()).reinterpret_as<char>().get(), numeric_cast<std::streamsize>(chunk_size));
+
+            if (!_tempFile) {
+                Abort(StrFilesystemError);
+                return;
+            }
+
+            copied += chunk_size;
+        }
+
+        update_file.RemaningSize -= op.Size;
+        _deltaOpIndex++;
+        _deltaOpDone = 0;
+    }
+
+    // The basis may be the very file the rebuilt one replaces, so it is released before promotion
+    ResetUpdateFileDelta();
+    GetNextFile();
+}
+
+void Updater::ResetUpdateFileDelta()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (_deltaBasisFile.is_open()) {
+        _deltaBasisFile.close();
+    }
+
+    _deltaBasisFile.clear();
+    _deltaBasisSize = 0;
+    _deltaRequested = false;
+    _deltaActive = false;
+    _deltaOps.clear();
+    _deltaOpIndex = 0;
+    _deltaOpDone = 0;
 }
 
 void Updater::Net_OnConnect(ClientConnection::ConnectResult result)
@@ -572,6 +707,17 @@ void Updater::Net_OnInitData()
         return strex("{}{}", runtime_local_prefix, rest).str();
     };
 
+    struct UpdateListEntry
+    {
+        string Name {};
+        uint64_t Size {};
+        uint64_t Hash {};
+        UpdateFileTarget Target {};
+        uint32_t DataIndex {};
+    };
+
+    vector<UpdateListEntry> update_list;
+
     while (true) {
         int16_t name_len = reader.Read<int16_t>();
 
@@ -581,36 +727,90 @@ void Updater::Net_OnInitData()
 
         FO_VERIFY_AND_THROW(name_len > 0, "Update file name length must be positive", name_len);
         size_t fname_size = numeric_cast<size_t>(name_len);
-        string fname;
-        fname.resize(fname_size);
-        reader.ReadStringBytes(fname);
-        auto size = reader.Read<uint64_t>();
-        auto hash = reader.Read<uint64_t>();
-        auto target = reader.Read<UpdateFileTarget>();
-        auto data_index = reader.Read<uint32_t>();
+        UpdateListEntry entry;
+        entry.Name.resize(fname_size);
+        reader.ReadStringBytes(entry.Name);
+        entry.Size = reader.Read<uint64_t>();
+        entry.Hash = reader.Read<uint64_t>();
+        entry.Target = reader.Read<UpdateFileTarget>();
+        entry.DataIndex = reader.Read<uint32_t>();
+        update_list.emplace_back(std::move(entry));
+    }
+
+    reader.VerifyEnd();
+
+    struct LocalBinaryName
+    {
+        string LocalName {};
+        bool IsDebugSymbols {};
+    };
+
+    auto get_local_binary_name = [&](const string& fname) -> optional<LocalBinaryName> {
+        string fname_basename = strex(fname).extract_file_name().str();
+        auto remapped = remap_runtime_name(fname_basename);
+
+        if (!remapped.has_value()) {
+            return std::nullopt;
+        }
+
+        string fname_dir = strex(fname).extract_dir().str();
+        string local_name = fname_dir.empty() ? *remapped : strex(fname_dir).combine_path(*remapped).str();
+        return LocalBinaryName {.LocalName = std::move(local_name), .IsDebugSymbols = *remapped == strex("{}.pdb", runtime_local_prefix).str()};
+    };
+
+    // Every local file the checks below are going to hash is hashed up front, several at once
+    vector<string> hash_check_paths;
+
+    for (const auto& entry : update_list) {
+        if (entry.Target == UpdateFileTarget::ClientBinaries) {
+            if (!accept_binaries || !_binariesMode) {
+                continue;
+            }
+
+            auto local_binary_name = get_local_binary_name(entry.Name);
+
+            if (local_binary_name.has_value() && !local_binary_name->IsDebugSymbols) {
+                hash_check_paths.emplace_back(strex(_binaryDir).combine_path(local_binary_name->LocalName).str());
+            }
+        }
+        else if (entry.Target == our_target) {
+            auto file_header = resources.ReadFileHeader(entry.Name);
+
+            if (file_header && file_header.GetSize() == entry.Size && file_header.GetDataSource()->IsDiskDir()) {
+                hash_check_paths.emplace_back(file_header.GetDiskPath());
+            }
+        }
+    }
+
+    _localHashes.Prefetch(hash_check_paths);
+
+    for (const auto& entry : update_list) {
+        const string& fname = entry.Name;
+        auto size = entry.Size;
+        auto hash = entry.Hash;
+        auto target = entry.Target;
+        auto data_index = entry.DataIndex;
 
         string local_name = fname;
         bool is_client_binary = false;
+        string basis_path;
 
         if (target == UpdateFileTarget::ClientBinaries) {
             if (!accept_binaries) {
                 continue;
             }
 
-            string fname_basename = strex(fname).extract_file_name().str();
-            auto remapped = remap_runtime_name(fname_basename);
+            auto local_binary_name = get_local_binary_name(fname);
 
-            if (!remapped.has_value()) {
+            if (!local_binary_name.has_value()) {
                 continue;
             }
 
-            auto remapped_basename = *remapped;
-            string fname_dir = strex(fname).extract_dir().str();
-            local_name = fname_dir.empty() ? remapped_basename : strex(fname_dir).combine_path(remapped_basename).str();
+            local_name = local_binary_name->LocalName;
 
             string file_path = strex(_binaryDir).combine_path(local_name).str();
 
-            if (remapped_basename == strex("{}.pdb", runtime_local_prefix).str()) {
+            if (local_binary_name->IsDebugSymbols) {
                 if (fs_exists(file_path)) {
                     continue;
                 }
@@ -630,6 +830,10 @@ void Updater::Net_OnInitData()
                 WriteLog("Client updater: binary already matches {}", file_path);
                 continue;
             }
+
+            if (fs_exists(file_path)) {
+                basis_path = file_path;
+            }
         }
         else if (target == our_target) {
             auto file_header = resources.ReadFileHeader(fname);
@@ -646,6 +850,10 @@ void Updater::Net_OnInitData()
                         continue;
                     }
                 }
+
+                if (file_header.GetDataSource()->IsDiskDir()) {
+                    basis_path = file_header.GetDiskPath();
+                }
             }
         }
         else {
@@ -659,11 +867,10 @@ void Updater::Net_OnInitData()
         update_file.RemaningSize = size;
         update_file.Hash = hash;
         update_file.IsClientBinary = is_client_binary;
+        update_file.BasisPath = std::move(basis_path);
         _filesToUpdate.emplace_back(std::move(update_file));
     }
 
-    reader.VerifyEnd();
-
     if (!_filesToUpdate.empty()) {
         WriteLog("Client updater: {} files need update in {} mode", _filesToUpdate.size(), _binariesMode ? "binaries" : "resources");
         GetNextFile();
@@ -738,6 +945,11 @@ void Updater::Net_OnUpdateFileData()
         return;
     }
 
+    if (_deltaActive && numeric_cast<uint64_t>(data_size) > _deltaOps[_deltaOpIndex].Size - _deltaOpDone) {
+        Abort(StrFilesystemError);
+        return;
+    }
+
     // Write data to temp file
     size_t write_size = GetUpdateWriteSize(update_file.RemaningSize, _updateFileBuf.size());
 
@@ -752,13 +964,30 @@ void Updater::Net_OnUpdateFileData()
 
     update_file.RemaningSize -= data_size;
 
+    if (_deltaActive) {
+        if (data_size == 0) {
+            Abort(StrFilesystemError);
+            return;
+        }
+
+        _deltaOpDone += data_size;
+
+        if (_deltaOpDone == _deltaOps[_deltaOpIndex].Size) {
+            _deltaOpIndex++;
+            _deltaOpDone = 0;
+        }
+
+        ContinueUpdateFileDelta();
+        return;
+    }
+
     if (update_file.RemaningSize > 0) {
         if (data_size == 0) {
             Abort(StrFilesystemError);
             return;
         }
 
-        RequestUpdateFile(update_file);
+        RequestUpdateFile(update_file, update_file.RemaningSize);
         _bytesRealReceivedCheckpoint = _conn.GetUnpackedBytesReceived();
     }
     else {
@@ -766,54 +995,74 @@ void Updater::Net_OnUpdateFileData()
     }
 }
 
-auto Updater::IsDiskFileHashMatch(string_view file_path, uint64_t expected_size, uint64_t expected_hash) -> bool
+void Updater::Net_OnUpdateFileDelta()
 {
     FO_STACK_TRACE_ENTRY();
 
-    auto local_size = fs_file_size(file_path);
+    auto delta_ops = ReadUpdateDeltaOps(*_conn.InBuf);
 
-    if (!local_size.has_value() || *local_size != expected_size) {
-        return false;
+    if (!_deltaRequested || _filesToUpdate.empty() || !_tempFile.is_open()) {
+        Abort(StrFilesystemError);
+        return;
     }
 
-    struct CachedHash
-    {
-        uint64_t Size;
-        uint64_t Mtime;
-        uint64_t Hash;
-    };
-    static_assert(std::is_trivially_copyable_v<CachedHash>);
-
-    uint64_t local_mtime = fs_last_write_time(file_path);
+    _deltaRequested = false;
 
-    // Keyed by the whole path: two same-named files in different directories would otherwise share one
-    // entry, and a size plus write-time collision would answer this check with the other file's hash
-    string cache_key = strex("{}-{:016x}.hash", strex(file_path).extract_file_name(), hashing::hash<string_view> {}(file_path)).str();
+    auto& update_file = _filesToUpdate.front();
+    uint64_t output_size = 0;
+    uint64_t copy_size = 0;
 
-    if (_cache.HasEntry(cache_key)) {
-        auto data = _cache.GetData(cache_key);
+    // Copies must stay inside the basis and literals must continue the output, which is what lets a literal be
+    // fetched as a plain resumable portion
+    for (const auto& op : delta_ops) {
+        bool op_valid = op.Size <= update_file.Size - output_size;
 
-        if (data.size() == sizeof(CachedHash)) {
-            CachedHash cached {};
-            auto target = make_ptr(&cached).reinterpret_as<uint8_t>();
-            MemCopy(target, data.data(), sizeof(cached));
+        if (op.Type == UpdateDeltaOpType::CopyBlocks) {
+            op_valid = op_valid && op.Offset <= _deltaBasisSize && op.Size <= _deltaBasisSize - op.Offset;
+            copy_size += op.Size;
+        }
+        else {
+            op_valid = op_valid && op.Offset == output_size;
+        }
 
-            if (cached.Size == *local_size && cached.Mtime == local_mtime) {
-                return cached.Hash == expected_hash;
-            }
+        if (!op_valid) {
+            WriteLog("Client updater: invalid delta for file {}, op offset {}, size {}", update_file.Name, op.Offset, op.Size);
+            Abort(StrFilesystemError);
+            return;
         }
+
+        output_size += op.Size;
     }
 
-    auto local_hash = fs_hash_file(file_path);
+    if (output_size != update_file.Size) {
+        WriteLog("Client updater: delta for file {} covers {} of {} bytes", update_file.Name, output_size, update_file.Size);
+        Abort(StrFilesystemError);
+        return;
+    }
+
+    WriteLog("Client updater: delta for file {} reuses {} bytes, downloads {} bytes in {} ops", update_file.Name, copy_size, update_file.Size - copy_size, delta_ops.size());
+
+    update_file.DeltaApplied = true;
+    _deltaOps = std::move(delta_ops);
+    _deltaOpIndex = 0;
+    _deltaOpDone = 0;
+    _deltaActive = true;
 
-    if (!local_hash.has_value()) {
+    ContinueUpdateFileDelta();
+}
+
+auto Updater::IsDiskFileHashMatch(string_view file_path, uint64_t expected_size, uint64_t expected_hash) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto local_size = fs_file_size(file_path);
+
+    if (!local_size.has_value() || *local_size != expected_size) {
         return false;
     }
 
-    CachedHash entry {*local_size, local_mtime, *local_hash};
-    _cache.SetData(cache_key, const_span<uint8_t> {make_ptr(&entry).reinterpret_as<uint8_t>().get(), sizeof(CachedHash)});
-
-    return *local_hash == expected_hash;
+    auto local_hash = _localHashes.GetHash(file_path);
+    return local_hash.has_value() && *local_hash == expected_hash;
 }
 
 auto Updater::IsDataHashMatch(const vector<uint8_t>& data, uint64_t expected_size, uint64_t expected_hash) noexcept -> bool
@@ -40,8 +40,10 @@
 #include "EffectManager.h"
 #include "FileSystem.h"
 #include "FontManager.h"
+#include "LocalFileHashes.h"
 #include "Settings.h"
 #include "SpriteManager.h"
+#include "UpdateDelta.h"
 
 FO_BEGIN_NAMESPACE
 
@@ -99,6 +101,8 @@ class Updater final
         uint64_t RemaningSize {};
         uint64_t Hash {};
         bool IsClientBinary {};
+        string BasisPath {}; // Outdated local copy the delta transfer reuses blocks from, empty if none
+        bool DeltaApplied {};
     };
 
     void AddText(string_view text);
@@ -106,7 +110,10 @@ class Updater final
     void GetNextFile();
     void FinishResourcesUpdate();
     auto ReadLocalMetadataVersion() const -> string;
-    void RequestUpdateFile(const UpdateFile& update_file);
+    void RequestUpdateFile(const UpdateFile& update_file, uint64_t size_limit);
+    auto RequestUpdateFileDelta(const UpdateFile& update_file) -> bool;
+    void ContinueUpdateFileDelta();
+    void ResetUpdateFileDelta();
 
     void Net_OnConnect(ClientConnection::ConnectResult result);
     void Net_OnDisconnect();
@@ -114,6 +121,7 @@ class Updater final
     void Net_OnTimeSync();
     void Net_OnHashList();
     void Net_OnUpdateFileData();
+    void Net_OnUpdateFileDelta();
 
     auto IsDiskFileHashMatch(string_view file_path, uint64_t expected_size, uint64_t expected_hash) -> bool;
 
@@ -126,6 +134,7 @@ class Updater final
     ptr<ClientSettings> _settings;
     ClientConnection _conn;
     CacheStorage _cache;
+    LocalFileHashes _localHashes;
     string _binaryDir;
     string _serverMetadataVersion {};
     optional<UpdaterResult> _result;
@@ -137,6 +146,13 @@ class Updater final
     vector<UpdateFile> _filesToUpdate {};
     std::ofstream _tempFile {};
     vector<uint8_t> _updateFileBuf {};
+    std::ifstream _deltaBasisFile {};
+    uint64_t _deltaBasisSize {};
+    bool _deltaRequested {};
+    bool _deltaActive {};
+    vector<UpdateDeltaOp> _deltaOps {};
+    size_t _deltaOpIndex {};
+    uint64_t _deltaOpDone {};
     vector<string> _messages {};
     FileSystem _resources {};
     GameTimer _gameTime;
@@ -32,6 +32,7 @@
 //
 
 #include "VideoClip.h"
+#include "VideoColorConverter.h"
 
 #include "theora/theoradec.h"
 
@@ -41,7 +42,11 @@ using TheoraInfo = scoped_init_clear<th_info, th_info_init, th_info_clear>;
 using TheoraComment = scoped_init_clear<th_comment, th_comment_init, th_comment_clear>;
 using OggSyncState = scoped_init_clear<ogg_sync_state, ogg_sync_init, ogg_sync_clear>;
 
-struct VideoClip::Impl
+// Converted frames the decoder worker keeps ready ahead of playback
+static constexpr size_t DECODE_AHEAD_FRAMES = 4;
+
+// Demuxes and decodes one pass over the clip data; a looped clip starts a fresh one for every pass
+struct VideoDecoderState
 {
     struct StreamStates
     {
@@ -52,10 +57,16 @@ struct VideoClip::Impl
         int32_t MainIndex {-1};
     };
 
-    bool Stopped {};
-    bool Paused {};
-    bool Looped {};
-    vector<uint8_t> RawVideoData {};
+    explicit VideoDecoderState(const_span<uint8_t> video_data);
+    VideoDecoderState(const VideoDecoderState&) = delete;
+    VideoDecoderState(VideoDecoderState&&) noexcept = delete;
+    auto operator=(const VideoDecoderState&) = delete;
+    auto operator=(VideoDecoderState&&) noexcept = delete;
+    ~VideoDecoderState();
+
+    auto DecodePacket() -> int32_t;
+
+    const_span<uint8_t> RawVideoData;
     size_t ReadPos {};
     unique_del_nptr<th_dec_ctx> DecoderContext {};
     TheoraInfo VideoInfo {};
@@ -65,31 +76,88 @@ struct VideoClip::Impl
     OggSyncState SyncState {};
     ogg_packet Packet {};
     StreamStates Streams {};
+};
+
+struct VideoClip::Impl
+{
+    struct DecodedFrame
+    {
+        int32_t Pass {};
+        int32_t Index {};
+        bool Last {};
+        vector<ucolor> Pixels {};
+    };
+
+    auto DecodeNextFrame() -> optional<timespan>;
+    void ConvertFrame(vector<ucolor>& pixels);
+    void WakeDecoder(bool at_end_of_stream);
+
+    // Decoding, owned by the decoder worker once the clip is constructed
+    vector<uint8_t> RawVideoData {};
+    unique_nptr<VideoDecoderState> Decoding {};
+    VideoChromaLayout ChromaLayout {};
+    int32_t DecodedPass {};
+    int32_t DecodedFrames {};
+    bool DecodeEnded {};
+
+    // Playback, owned by the caller
+    isize32 Size {};
+    float64_t FramesPerSecond {};
+    bool Stopped {};
+    bool Paused {};
+    std::atomic_bool Looped {};
     vector<ucolor> RenderedTextureData {};
+    int32_t CurPass {};
     int32_t CurFrame {};
-    timespan AverageRenderTime {};
     nanotime StartTime {};
     nanotime RenderTime {};
     nanotime PauseTime {};
+
+    // Hand-over between them
+    mutex FramesLocker {};
+    vector<DecodedFrame> ReadyFrames FO_TSA_GUARDED_BY(FramesLocker) {};
+    vector<vector<ucolor>> FreeBuffers FO_TSA_GUARDED_BY(FramesLocker) {};
+    int32_t TargetPass FO_TSA_GUARDED_BY(FramesLocker) {};
+    int32_t TargetFrame FO_TSA_GUARDED_BY(FramesLocker) {};
+    bool DecodeFailed FO_TSA_GUARDED_BY(FramesLocker) {};
+    // No decode job is scheduled while parked, playback frees a frame or enables looping to go on
+    bool DecoderParked FO_TSA_GUARDED_BY(FramesLocker) {};
+    bool DecoderParkedAtEnd FO_TSA_GUARDED_BY(FramesLocker) {};
+
+    // Declared last so the worker is joined before anything it touches is destroyed
+    unique_nptr<WorkThread> Decoder {};
 };
 
-VideoClip::VideoClip(VideoClip&&) noexcept = default;
+static auto GetChromaLayout(th_pixel_fmt pixel_fmt) noexcept -> optional<VideoChromaLayout>
+{
+    FO_NO_STACK_TRACE_ENTRY();
 
-VideoClip::VideoClip(vector<uint8_t> video_data) :
-    _impl {SafeAlloc::MakeUnique<Impl>()}
+    switch (pixel_fmt) {
+    case TH_PF_420:
+        return VideoChromaLayout::Yuv420;
+    case TH_PF_422:
+        return VideoChromaLayout::Yuv422;
+    case TH_PF_444:
+        return VideoChromaLayout::Yuv444;
+    default:
+        return std::nullopt;
+    }
+}
+
+VideoDecoderState::VideoDecoderState(const_span<uint8_t> video_data) :
+    RawVideoData {video_data}
 {
     FO_STACK_TRACE_ENTRY();
 
-    _impl->SetupInfo = make_unique_del_ptr(nptr<th_setup_info> {}, [](th_setup_info* raw_setup_info) noexcept {
+    SetupInfo = make_unique_del_ptr(nptr<th_setup_info> {}, [](th_setup_info* raw_setup_info) noexcept {
         if (raw_setup_info != nullptr) {
             auto owned_setup_info = make_ptr(raw_setup_info);
             th_setup_free(owned_setup_info.get());
         }
     });
-    _impl->RawVideoData = std::move(video_data);
 
-    _impl->Streams.Streams.resize(Impl::StreamStates::COUNT);
-    _impl->Streams.StreamsState.resize(Impl::StreamStates::COUNT);
+    Streams.Streams.resize(StreamStates::COUNT);
+    Streams.StreamsState.resize(StreamStates::COUNT);
 
     // Decode header
     while (true) {
@@ -99,16 +167,16 @@ VideoClip::VideoClip(vector<uint8_t> video_data) :
             throw VideoClipException("Decode header packet failed");
         }
 
-        th_setup_info* setup_info_raw = _impl->SetupInfo.release();
-        int32_t r = th_decode_headerin(&_impl->VideoInfo.Value, &_impl->Comment.Value, &setup_info_raw, &_impl->Packet);
-        _impl->SetupInfo.reset(setup_info_raw);
+        th_setup_info* setup_info_raw = SetupInfo.release();
+        int32_t r = th_decode_headerin(&VideoInfo.Value, &Comment.Value, &setup_info_raw, &Packet);
+        SetupInfo.reset(setup_info_raw);
 
         if (r == 0) {
-            if (stream_index != _impl->Streams.MainIndex) {
+            if (stream_index != Streams.MainIndex) {
                 while (true) {
                     stream_index = DecodePacket();
 
-                    if (stream_index == _impl->Streams.MainIndex) {
+                    if (stream_index == Streams.MainIndex) {
                         break;
                     }
                     if (stream_index < 0) {
@@ -120,26 +188,226 @@ VideoClip::VideoClip(vector<uint8_t> video_data) :
             break;
         }
         else {
-            _impl->Streams.MainIndex = stream_index;
+            Streams.MainIndex = stream_index;
         }
     }
 
-    FO_VERIFY_AND_THROW(_impl->SetupInfo, "Setup info is null");
-    auto decoder_context = make_nptr(th_decode_alloc(&_impl->VideoInfo.Value, _impl->SetupInfo.get()));
+    FO_VERIFY_AND_THROW(SetupInfo, "Setup info is null");
+    auto decoder_context = make_nptr(th_decode_alloc(&VideoInfo.Value, SetupInfo.get()));
     FO_VERIFY_AND_THROW(decoder_context, "Theora decoder context allocation failed");
-    _impl->DecoderContext = make_unique_del_ptr(decoder_context, [](th_dec_ctx* raw_decoder_context) noexcept {
+    DecoderContext = make_unique_del_ptr(decoder_context, [](th_dec_ctx* raw_decoder_context) noexcept {
         if (raw_decoder_context != nullptr) {
             auto owned_decoder_context = make_ptr(raw_decoder_context);
             th_decode_free(owned_decoder_context.get());
         }
     });
-    _impl->RenderedTextureData.resize(numeric_cast<size_t>(_impl->VideoInfo.Value.pic_width) * _impl->VideoInfo.Value.pic_height);
+}
+
+VideoDecoderState::~VideoDecoderState()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    for (size_t i = 0; i < Streams.Streams.size(); i++) {
+        if (Streams.StreamsState[i]) {
+            ogg_stream_clear(&Streams.Streams[i]);
+        }
+    }
+}
+
+VideoClip::VideoClip(VideoClip&&) noexcept = default;
+
+VideoClip::VideoClip(vector<uint8_t> video_data) :
+    _impl {SafeAlloc::MakeUnique<Impl>()}
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _impl->RawVideoData = std::move(video_data);
+    _impl->Decoding = SafeAlloc::MakeUnique<VideoDecoderState>(_impl->RawVideoData);
+
+    const th_info& info = _impl->Decoding->VideoInfo.Value;
+    _impl->Size = {numeric_cast<int32_t>(info.pic_width), numeric_cast<int32_t>(info.pic_height)};
+    _impl->FramesPerSecond = numeric_cast<float64_t>(info.fps_numerator) / numeric_cast<float64_t>(info.fps_denominator);
+    _impl->RenderedTextureData.resize(numeric_cast<size_t>(info.pic_width) * info.pic_height);
     _impl->StartTime = nanotime::now();
+
+    auto chroma_layout = GetChromaLayout(info.pixel_fmt);
+
+    if (!chroma_layout) {
+        WriteLog("Wrong pixel format {}", info.pixel_fmt);
+        scoped_lock locker {_impl->FramesLocker};
+        _impl->DecodeFailed = true;
+        return;
+    }
+
+    _impl->ChromaLayout = chroma_layout.value();
+
+    // Frames are decoded and converted ahead of playback, RenderFrame only picks the one that is due
+    auto impl = make_ptr(_impl.get());
+    _impl->Decoder = SafeAlloc::MakeUnique<WorkThread>("VideoDecoder");
+    _impl->Decoder->AddJob([impl]() FO_DEFERRED { return impl->DecodeNextFrame(); });
 }
 
 VideoClip::~VideoClip()
 {
     FO_STACK_TRACE_ENTRY();
+
+    if (_impl && _impl->Decoder) {
+        _impl->Decoder->Clear();
+    }
+}
+
+auto VideoClip::Impl::DecodeNextFrame() -> optional<timespan>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    int32_t target_pass;
+    int32_t target_frame;
+
+    {
+        scoped_lock locker {FramesLocker};
+
+        if (DecodeFailed) {
+            return std::nullopt;
+        }
+        if (ReadyFrames.size() >= DECODE_AHEAD_FRAMES) {
+            DecoderParked = true;
+            return std::nullopt;
+        }
+
+        target_pass = TargetPass;
+        target_frame = TargetFrame;
+    }
+
+    // The last frame is queued, a looped clip goes on with a fresh pass and any other one parks at end of stream
+    if (DecodeEnded) {
+        if (!Looped) {
+            scoped_lock locker {FramesLocker};
+
+            // Checked again under the lock, so a concurrent SetLooped either is seen here or finds the decoder parked
+            if (!Looped) {
+                DecoderParkedAtEnd = true;
+                return std::nullopt;
+            }
+        }
+
+        try {
+            Decoding = SafeAlloc::MakeUnique<VideoDecoderState>(RawVideoData);
+        }
+        catch (const std::exception& ex) {
+            ReportExceptionAndContinue(ex);
+            scoped_lock locker {FramesLocker};
+            DecodeFailed = true;
+            return std::nullopt;
+        }
+
+        DecodedPass++;
+        DecodedFrames = 0;
+        DecodeEnded = false;
+    }
+
+    // Decode frame
+    FO_VERIFY_AND_THROW(Decoding->DecoderContext, "Decoder context is null");
+    int32_t r = th_decode_packetin(Decoding->DecoderContext.get(), &Decoding->Packet, nullptr);
+
+    if (r != TH_DUPFRAME && r != 0) {
+        WriteLog("Frame does not contain encoded video data, error {}", r);
+        scoped_lock locker {FramesLocker};
+        DecodeFailed = true;
+        return std::nullopt;
+    }
+
+    DecodedFrames++;
+
+    // Seek next packet
+    bool last_frame = false;
+
+    do {
+        r = Decoding->DecodePacket();
+
+        if (r == -2) {
+            last_frame = true;
+            break;
+        }
+    } while (r != Decoding->Streams.MainIndex);
+
+    DecodeEnded = last_frame;
+
+    // Frames playback has already passed still feed the decoder but are not converted
+    if (!last_frame && (DecodedPass < target_pass || (DecodedPass == target_pass && DecodedFrames < target_frame))) {
+        return timespan::zero;
+    }
+
+    r = th_decode_ycbcr_out(Decoding->DecoderContext.get(), Decoding->ColorBuffer);
+
+    if (r != 0) {
+        WriteLog("th_decode_ycbcr_out() failed, error {}", r);
+        scoped_lock locker {FramesLocker};
+        DecodeFailed = true;
+        return std::nullopt;
+    }
+
+    vector<ucolor> pixels;
+
+    {
+        scoped_lock locker {FramesLocker};
+
+        if (!FreeBuffers.empty()) {
+            pixels = std::move(FreeBuffers.back());
+            FreeBuffers.pop_back();
+        }
+    }
+
+    ConvertFrame(pixels);
+
+    scoped_lock locker {FramesLocker};
+    ReadyFrames.emplace_back(DecodedFrame {.Pass = DecodedPass, .Index = DecodedFrames, .Last = last_frame, .Pixels = std::move(pixels)});
+
+    return timespan::zero;
+}
+
+void VideoClip::Impl::WakeDecoder(bool at_end_of_stream)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    {
+        scoped_lock locker {FramesLocker};
+
+        if (at_end_of_stream) {
+            if (!DecoderParkedAtEnd) {
+                return;
+            }
+
+            DecoderParkedAtEnd = false;
+        }
+        else {
+            if (!DecoderParked || ReadyFrames.size() >= DECODE_AHEAD_FRAMES) {
+                return;
+            }
+
+            DecoderParked = false;
+        }
+    }
+
+    auto impl = make_ptr(this);
+    Decoder->AddJob([impl]() FO_DEFERRED { return impl->DecodeNextFrame(); });
+}
+
+void VideoClip::Impl::ConvertFrame(vector<ucolor>& pixels)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    array<VideoPicturePlane, 3> planes;
+
+    for (size_t i = 0; i < planes.size(); i++) {
+        const th_img_plane& plane = Decoding->ColorBuffer[i];
+        FO_VERIFY_AND_THROW(plane.stride > 0 && plane.width > 0 && plane.height > 0, "Unexpected decoded video plane layout", i, plane.stride, plane.width, plane.height);
+        size_t stride = numeric_cast<size_t>(plane.stride);
+        size_t plane_size = (numeric_cast<size_t>(plane.height) - 1) * stride + numeric_cast<size_t>(plane.width);
+        planes[i] = VideoPicturePlane {.Data = const_span<uint8_t> {plane.data, plane_size}, .Stride = stride};
+    }
+
+    pixels.resize(numeric_cast<size_t>(Size.width) * numeric_cast<size_t>(Size.height));
+    ConvertVideoPicture(ChromaLayout, planes, Size, pixels);
 }
 
 auto VideoClip::IsPlaying() const noexcept -> bool
@@ -189,7 +457,14 @@ auto VideoClip::GetSize() const -> isize32
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    return {numeric_cast<int32_t>(_impl->VideoInfo.Value.pic_width), numeric_cast<int32_t>(_impl->VideoInfo.Value.pic_height)};
+    return _impl->Size;
+}
+
+auto VideoClip::GetFrameIndex() const noexcept -> int32_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return _impl->CurFrame;
 }
 
 void VideoClip::Stop()
@@ -227,13 +502,18 @@ void VideoClip::SetLooped(bool enabled)
     FO_STACK_TRACE_ENTRY();
 
     _impl->Looped = enabled;
+
+    if (enabled) {
+        _impl->WakeDecoder(true);
+    }
 }
 
 void VideoClip::SetTime(timespan time)
 {
     FO_STACK_TRACE_ENTRY();
 
-    _impl->StartTime = nanotime::now() - time;
+    // A paused clip keeps showing the requested time until it is resumed
+    _impl->StartTime = (_impl->Paused ? _impl->PauseTime : nanotime::now()) - time;
 }
 
 auto VideoClip::RenderFrame() -> const vector<ucolor>&
@@ -244,120 +524,60 @@ auto VideoClip::RenderFrame() -> const vector<ucolor>&
         return _impl->RenderedTextureData;
     }
 
-    nanotime start_frame_render = nanotime::now();
-
     if (_impl->Paused) {
         _impl->RenderTime = _impl->PauseTime;
     }
     else {
-        _impl->RenderTime = start_frame_render;
+        _impl->RenderTime = nanotime::now();
     }
 
     // Calculate next frame
-    float64_t cur_second = (_impl->RenderTime - _impl->StartTime + _impl->AverageRenderTime).to_ms<float64_t>() / 1000.0;
-    int32_t new_frame = iround<int32_t>(cur_second * numeric_cast<float64_t>(_impl->VideoInfo.Value.fps_numerator) / numeric_cast<float64_t>(_impl->VideoInfo.Value.fps_denominator));
-    int32_t next_frame_diff = new_frame - _impl->CurFrame;
+    float64_t cur_second = (_impl->RenderTime - _impl->StartTime).to_ms<float64_t>() / 1000.0;
+    int32_t new_frame = iround<int32_t>(cur_second * _impl->FramesPerSecond);
 
-    if (next_frame_diff <= 0) {
+    if (new_frame <= _impl->CurFrame) {
         return _impl->RenderedTextureData;
     }
 
     bool last_frame = false;
+    bool failed;
 
-    _impl->CurFrame = new_frame;
-    FO_VERIFY_AND_THROW(_impl->DecoderContext, "Decoder context is null");
+    {
+        scoped_lock locker {_impl->FramesLocker};
 
-    for (int32_t i = 0; i < next_frame_diff; i++) {
-        // Decode frame
-        int32_t r = th_decode_packetin(_impl->DecoderContext.get(), &_impl->Packet, nullptr);
+        _impl->TargetPass = _impl->CurPass;
+        _impl->TargetFrame = new_frame;
 
-        if (r != TH_DUPFRAME) {
-            if (r != 0) {
-                WriteLog("Frame does not contain encoded video data, error {}", r);
-                Stop();
-                return _impl->RenderedTextureData;
-            }
+        // Show the newest decoded frame that is due, the ones it overtakes are recycled unseen
+        auto& ready_frames = _impl->ReadyFrames;
+        auto due_end = std::ranges::find_if(ready_frames, [&](const Impl::DecodedFrame& frame) { return frame.Pass > _impl->CurPass || (frame.Pass == _impl->CurPass && frame.Index > new_frame); });
 
-            // Decode color
-            r = th_decode_ycbcr_out(_impl->DecoderContext.get(), _impl->ColorBuffer);
+        if (due_end != ready_frames.begin()) {
+            auto& frame = *std::prev(due_end);
 
-            if (r != 0) {
-                WriteLog("th_decode_ycbcr_out() failed, error {}", r);
-                Stop();
-                return _impl->RenderedTextureData;
+            if (frame.Pass == _impl->CurPass) {
+                std::swap(_impl->RenderedTextureData, frame.Pixels);
+                _impl->CurFrame = frame.Index;
+                last_frame = frame.Last;
             }
-        }
-
-        // Seek next packet
-        do {
-            r = DecodePacket();
 
-            if (r == -2) {
-                last_frame = true;
-                break;
+            for (auto it = ready_frames.begin(); it != due_end; ++it) {
+                _impl->FreeBuffers.emplace_back(std::move(it->Pixels));
             }
-        } while (r != _impl->Streams.MainIndex);
 
-        if (last_frame) {
-            break;
+            ready_frames.erase(ready_frames.begin(), due_end);
         }
-    }
-
-    // Data offsets
-    int32_t di;
-    int32_t dj;
 
-    switch (_impl->VideoInfo.Value.pixel_fmt) {
-    case TH_PF_420:
-        di = 2;
-        dj = 2;
-        break;
-    case TH_PF_422:
-        di = 2;
-        dj = 1;
-        break;
-    case TH_PF_444:
-        di = 1;
-        dj = 1;
-        break;
-    default:
-        WriteLog("Wrong pixel format {}", _impl->VideoInfo.Value.pixel_fmt);
-        Stop();
-        return _impl->RenderedTextureData;
+        failed = _impl->DecodeFailed && ready_frames.empty();
     }
 
-    // Fill texture data
-    int32_t w = numeric_cast<int32_t>(_impl->VideoInfo.Value.pic_width);
-    int32_t h = numeric_cast<int32_t>(_impl->VideoInfo.Value.pic_height);
-
-    for (int32_t y = 0; y < h; y++) {
-        for (int32_t x = 0; x < w; x++) {
-            const th_ycbcr_buffer& cbuf = _impl->ColorBuffer;
-            uint8_t cy = cbuf[0].data[y * cbuf[0].stride + x];
-            uint8_t cu = cbuf[1].data[y / dj * cbuf[1].stride + x / di];
-            uint8_t cv = cbuf[2].data[y / dj * cbuf[2].stride + x / di];
-
-            // YUV to RGB
-            float32_t cr = numeric_cast<float32_t>(cy) + 1.402f * numeric_cast<float32_t>(cv - 127);
-            float32_t cg = numeric_cast<float32_t>(cy) - 0.344f * numeric_cast<float32_t>(cu - 127) - 0.714f * numeric_cast<float32_t>(cv - 127);
-            float32_t cb = numeric_cast<float32_t>(cy) + 1.722f * numeric_cast<float32_t>(cu - 127);
-
-            ucolor& pixel = _impl->RenderedTextureData[numeric_cast<size_t>(y) * numeric_cast<size_t>(w) + numeric_cast<size_t>(x)];
-            pixel.comp.r = iround<uint8_t>(std::clamp(cr, 0.0f, 255.0f));
-            pixel.comp.g = iround<uint8_t>(std::clamp(cg, 0.0f, 255.0f));
-            pixel.comp.b = iround<uint8_t>(std::clamp(cb, 0.0f, 255.0f));
-            pixel.comp.a = 0xFF;
-        }
+    if (!failed) {
+        _impl->WakeDecoder(false);
     }
 
-    // Store render time
-    timespan frame_render_duration = nanotime::now() - start_frame_render;
-
-    if (_impl->AverageRenderTime > std::chrono::milliseconds(0)) {
-        _impl->AverageRenderTime = std::chrono::milliseconds(iround<uint64_t>((_impl->AverageRenderTime + frame_render_duration).to_ms<float64_t>() / 2.0));
-    }
-    else {
-        _impl->AverageRenderTime = frame_render_duration;
+    if (failed) {
+        Stop();
+        return _impl->RenderedTextureData;
     }
 
     // End cycle
@@ -366,21 +586,23 @@ auto VideoClip::RenderFrame() -> const vector<ucolor>&
 
         if (_impl->Looped) {
             Resume();
+            _impl->CurPass++;
+            _impl->CurFrame = 0;
         }
     }
 
     return _impl->RenderedTextureData;
 }
 
-int32_t VideoClip::DecodePacket()
+auto VideoDecoderState::DecodePacket() -> int32_t
 {
     FO_STACK_TRACE_ENTRY();
 
     int32_t b = 0;
     int32_t rv = 0;
 
-    for (int32_t i = 0; i < numeric_cast<int32_t>(_impl->Streams.StreamsState.size()) && _impl->Streams.StreamsState[i]; i++) {
-        int32_t a = ogg_stream_packetout(&_impl->Streams.Streams[i], &_impl->Packet);
+    for (int32_t i = 0; i < numeric_cast<int32_t>(Streams.StreamsState.size()) && Streams.StreamsState[i]; i++) {
+        int32_t a = ogg_stream_packetout(&Streams.Streams[i], &Packet);
 
         switch (a) {
         case 1:
@@ -401,31 +623,31 @@ int32_t VideoClip::DecodePacket()
     do {
         ogg_page op;
 
-        while (ogg_sync_pageout(&_impl->SyncState.Value, &op) != 1) {
-            int32_t read_bytes = numeric_cast<int32_t>(_impl->RawVideoData.size() - _impl->ReadPos);
+        while (ogg_sync_pageout(&SyncState.Value, &op) != 1) {
+            int32_t read_bytes = numeric_cast<int32_t>(RawVideoData.size() - ReadPos);
             read_bytes = std::min(1024, read_bytes);
 
             if (read_bytes == 0) {
                 return -2;
             }
 
-            auto dest_buf = make_ptr(ogg_sync_buffer(&_impl->SyncState.Value, read_bytes));
-            auto source = make_ptr(_impl->RawVideoData.data()).offset(_impl->ReadPos);
+            auto dest_buf = make_ptr(ogg_sync_buffer(&SyncState.Value, read_bytes));
+            auto source = make_ptr(RawVideoData.data()).offset(ReadPos);
             MemCopy(dest_buf, source, read_bytes);
-            _impl->ReadPos += read_bytes;
-            ogg_sync_wrote(&_impl->SyncState.Value, read_bytes);
+            ReadPos += read_bytes;
+            ogg_sync_wrote(&SyncState.Value, read_bytes);
         }
 
         if (ogg_page_bos(&op) != 0 && rv != 1) {
             int32_t i = 0;
 
-            while (i < numeric_cast<int32_t>(_impl->Streams.StreamsState.size()) && _impl->Streams.StreamsState[i]) {
+            while (i < numeric_cast<int32_t>(Streams.StreamsState.size()) && Streams.StreamsState[i]) {
                 i++;
             }
 
-            if (!_impl->Streams.StreamsState[i]) {
-                int32_t a = ogg_stream_init(&_impl->Streams.Streams[i], ogg_page_serialno(&op));
-                _impl->Streams.StreamsState[i] = true;
+            if (!Streams.StreamsState[i]) {
+                int32_t a = ogg_stream_init(&Streams.Streams[i], ogg_page_serialno(&op));
+                Streams.StreamsState[i] = true;
 
                 if (a != 0) {
                     return -1;
@@ -436,9 +658,9 @@ int32_t VideoClip::DecodePacket()
             }
         }
 
-        for (int32_t i = 0; i < numeric_cast<int32_t>(_impl->Streams.StreamsState.size()) && _impl->Streams.StreamsState[i]; i++) {
-            ogg_stream_pagein(&_impl->Streams.Streams[i], &op);
-            int32_t a = ogg_stream_packetout(&_impl->Streams.Streams[i], &_impl->Packet);
+        for (int32_t i = 0; i < numeric_cast<int32_t>(Streams.StreamsState.size()) && Streams.StreamsState[i]; i++) {
+            ogg_stream_pagein(&Streams.Streams[i], &op);
+            int32_t a = ogg_stream_packetout(&Streams.Streams[i], &Packet);
 
             switch (a) {
             case 1:
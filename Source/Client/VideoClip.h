@@ -39,6 +39,8 @@ FO_BEGIN_NAMESPACE
 
 FO_DECLARE_EXCEPTION(VideoClipException);
 
+// Theora clip playback. A decoder worker decodes and converts a few frames ahead of playback, so RenderFrame only
+// picks the newest frame that is due for the current time
 class VideoClip
 {
 public:
@@ -55,6 +57,7 @@ class VideoClip
     [[nodiscard]] auto IsLooped() const noexcept -> bool;
     [[nodiscard]] auto GetTime() const -> timespan;
     [[nodiscard]] auto GetSize() const -> isize32;
+    [[nodiscard]] auto GetFrameIndex() const noexcept -> int32_t;
 
     void Stop();
     void Pause();
@@ -65,7 +68,6 @@ class VideoClip
 
 private:
     struct Impl;
-    auto DecodePacket() -> int32_t;
 
     unique_nptr<Impl> _impl {};
 };
@@ -0,0 +1,318 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "VideoColorConverter.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FO_VIDEO_CONVERTER_SSE2 1
+#define FO_VIDEO_CONVERTER_NEON 0
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define FO_VIDEO_CONVERTER_SSE2 0
+#define FO_VIDEO_CONVERTER_NEON 1
+#include <arm_neon.h>
+#else
+#define FO_VIDEO_CONVERTER_SSE2 0
+#define FO_VIDEO_CONVERTER_NEON 0
+#endif
+
+FO_BEGIN_NAMESPACE
+
+static constexpr size_t VECTOR_PIXELS = 8;
+
+static auto GetChromaShift(VideoChromaLayout layout) noexcept -> pair<size_t, size_t>
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    switch (layout) {
+    case VideoChromaLayout::Yuv420:
+        return {1, 1};
+    case VideoChromaLayout::Yuv422:
+        return {1, 0};
+    case VideoChromaLayout::Yuv444:
+        return {0, 0};
+    }
+
+    return {0, 0};
+}
+
+static void ValidatePicture(VideoChromaLayout layout, const array<VideoPicturePlane, 3>& planes, isize32 size, span<ucolor> output)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(size.width >= 0 && size.height >= 0, "Video picture size is negative", size);
+
+    size_t w = numeric_cast<size_t>(size.width);
+    size_t h = numeric_cast<size_t>(size.height);
+    FO_VERIFY_AND_THROW(output.size() >= w * h, "Video picture output is too small", output.size(), w, h);
+
+    if (w == 0 || h == 0) {
+        return;
+    }
+
+    auto [shift_x, shift_y] = GetChromaShift(layout);
+
+    for (size_t i = 0; i < planes.size(); i++) {
+        size_t plane_w = i == 0 ? w : ((w - 1) >> shift_x) + 1;
+        size_t plane_h = i == 0 ? h : ((h - 1) >> shift_y) + 1;
+        FO_VERIFY_AND_THROW(planes[i].Stride >= plane_w, "Video picture plane stride is too small", i, planes[i].Stride, plane_w);
+        FO_VERIFY_AND_THROW(planes[i].Data.size() >= (plane_h - 1) * planes[i].Stride + plane_w, "Video picture plane is too small", i, planes[i].Data.size());
+    }
+}
+
+static auto ConvertPixel(uint8_t cy, uint8_t cu, uint8_t cv) -> ucolor
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    // YUV to RGB
+    float32_t cr = numeric_cast<float32_t>(cy) + 1.402f * numeric_cast<float32_t>(cv - 127);
+    float32_t cg = numeric_cast<float32_t>(cy) - 0.344f * numeric_cast<float32_t>(cu - 127) - 0.714f * numeric_cast<float32_t>(cv - 127);
+    float32_t cb = numeric_cast<float32_t>(cy) + 1.722f * numeric_cast<float32_t>(cu - 127);
+
+    return {iround<uint8_t>(std::clamp(cr, 0.0f, 255.0f)), iround<uint8_t>(std::clamp(cg, 0.0f, 255.0f)), iround<uint8_t>(std::clamp(cb, 0.0f, 255.0f)), 0xFF};
+}
+
+static void ConvertRowScalar(const uint8_t* y_row, const uint8_t* u_row, const uint8_t* v_row, size_t shift_x, size_t from, size_t to, ucolor* out_row)
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    for (size_t x = from; x < to; x++) {
+        out_row[x] = ConvertPixel(y_row[x], u_row[x >> shift_x], v_row[x >> shift_x]);
+    }
+}
+
+#if FO_VIDEO_CONVERTER_SSE2
+static auto RoundChannel(__m128 value) noexcept -> __m128i
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    // Truncate and add one when the fraction reaches a half, which is llround for non-negative values
+    __m128 clamped = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(255.0f));
+    __m128i truncated = _mm_cvttps_epi32(clamped);
+    __m128 fraction = _mm_sub_ps(clamped, _mm_cvtepi32_ps(truncated));
+    return _mm_sub_epi32(truncated, _mm_castps_si128(_mm_cmpge_ps(fraction, _mm_set1_ps(0.5f))));
+}
+
+static void ConvertHalf(__m128i y16, __m128i u16, __m128i v16, __m128i& r, __m128i& g, __m128i& b) noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    __m128i zero = _mm_setzero_si128();
+    __m128i bias = _mm_set1_epi32(127);
+    __m128 yf = _mm_cvtepi32_ps(_mm_unpacklo_epi16(y16, zero));
+    __m128 uf = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_unpacklo_epi16(u16, zero), bias));
+    __m128 vf = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_unpacklo_epi16(v16, zero), bias));
+
+    r = RoundChannel(_mm_add_ps(yf, _mm_mul_ps(_mm_set1_ps(1.402f), vf)));
+    g = RoundChannel(_mm_sub_ps(_mm_sub_ps(yf, _mm_mul_ps(_mm_set1_ps(0.344f), uf)), _mm_mul_ps(_mm_set1_ps(0.714f), vf)));
+    b = RoundChannel(_mm_add_ps(yf, _mm_mul_ps(_mm_set1_ps(1.722f), uf)));
+}
+
+static void ConvertRowVector(const uint8_t* y_row, const uint8_t* u_row, const uint8_t* v_row, size_t shift_x, size_t count, ucolor* out_row) noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    __m128i zero = _mm_setzero_si128();
+    __m128i alpha = _mm_set1_epi8(static_cast<char>(0xFF));
+
+    for (size_t x = 0; x < count; x += VECTOR_PIXELS) {
+        __m128i y8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(y_row + x));
+        __m128i u8;
+        __m128i v8;
+
+        if (shift_x != 0) {
+            int32_t u4;
+            int32_t v4;
+            MemCopy(&u4, u_row + (x >> 1), sizeof(int32_t));
+            MemCopy(&v4, v_row + (x >> 1), sizeof(int32_t));
+            u8 = _mm_cvtsi32_si128(u4);
+            v8 = _mm_cvtsi32_si128(v4);
+            u8 = _mm_unpacklo_epi8(u8, u8);
+            v8 = _mm_unpacklo_epi8(v8, v8);
+        }
+        else {
+            u8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(u_row + x));
+            v8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(v_row + x));
+        }
+
+        __m128i y16 = _mm_unpacklo_epi8(y8, zero);
+        __m128i u16 = _mm_unpacklo_epi8(u8, zero);
+        __m128i v16 = _mm_unpacklo_epi8(v8, zero);
+
+        __m128i r_lo;
+        __m128i g_lo;
+        __m128i b_lo;
+        __m128i r_hi;
+        __m128i g_hi;
+        __m128i b_hi;
+        ConvertHalf(y16, u16, v16, r_lo, g_lo, b_lo);
+        ConvertHalf(_mm_srli_si128(y16, 8), _mm_srli_si128(u16, 8), _mm_srli_si128(v16, 8), r_hi, g_hi, b_hi);
+
+        __m128i r = _mm_packus_epi16(_mm_packs_epi32(r_lo, r_hi), zero);
+        __m128i g = _mm_packus_epi16(_mm_packs_epi32(g_lo, g_hi), zero);
+        __m128i b = _mm_packus_epi16(_mm_packs_epi32(b_lo, b_hi), zero);
+        __m128i rg = _mm_unpacklo_epi8(r, g);
+        __m128i ba = _mm_unpacklo_epi8(b, alpha);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out_row + x), _mm_unpacklo_epi16(rg, ba));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out_row + x + 4), _mm_unpackhi_epi16(rg, ba));
+    }
+}
+#elif FO_VIDEO_CONVERTER_NEON
+static auto RoundChannel(float32x4_t value) noexcept -> int32x4_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    // Truncate and add one when the fraction reaches a half, which is llround for non-negative values
+    float32x4_t clamped = vminq_f32(vmaxq_f32(value, vdupq_n_f32(0.0f)), vdupq_n_f32(255.0f));
+    int32x4_t truncated = vcvtq_s32_f32(clamped);
+    float32x4_t fraction = vsubq_f32(clamped, vcvtq_f32_s32(truncated));
+    return vsubq_s32(truncated, vreinterpretq_s32_u32(vcgeq_f32(fraction, vdupq_n_f32(0.5f))));
+}
+
+static void ConvertHalf(uint16x4_t y16, uint16x4_t u16, uint16x4_t v16, int32x4_t& r, int32x4_t& g, int32x4_t& b) noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    int32x4_t bias = vdupq_n_s32(127);
+    float32x4_t yf = vcvtq_f32_s32(vreinterpretq_s32_u32(vmovl_u16(y16)));
+    float32x4_t uf = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vmovl_u16(u16)), bias));
+    float32x4_t vf = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vmovl_u16(v16)), bias));
+
+    // Separate multiply and add, a fused multiply-add would round differently from the scalar path
+    r = RoundChannel(vaddq_f32(yf, vmulq_f32(vdupq_n_f32(1.402f), vf)));
+    g = RoundChannel(vsubq_f32(vsubq_f32(yf, vmulq_f32(vdupq_n_f32(0.344f), uf)), vmulq_f32(vdupq_n_f32(0.714f), vf)));
+    b = RoundChannel(vaddq_f32(yf, vmulq_f32(vdupq_n_f32(1.722f), uf)));
+}
+
+static auto NarrowChannel(int32x4_t lo, int32x4_t hi) noexcept -> uint8x8_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return vqmovn_u16(vcombine_u16(vqmovun_s32(lo), vqmovun_s32(hi)));
+}
+
+static void ConvertRowVector(const uint8_t* y_row, const uint8_t* u_row, const uint8_t* v_row, size_t shift_x, size_t count, ucolor* out_row) noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    for (size_t x = 0; x < count; x += VECTOR_PIXELS) {
+        uint8x8_t y8 = vld1_u8(y_row + x);
+        uint8x8_t u8;
+        uint8x8_t v8;
+
+        if (shift_x != 0) {
+            uint32_t u4;
+            uint32_t v4;
+            MemCopy(&u4, u_row + (x >> 1), sizeof(uint32_t));
+            MemCopy(&v4, v_row + (x >> 1), sizeof(uint32_t));
+            uint8x8_t u_pair = vreinterpret_u8_u32(vdup_n_u32(u4));
+            uint8x8_t v_pair = vreinterpret_u8_u32(vdup_n_u32(v4));
+            u8 = vzip_u8(u_pair, u_pair).val[0];
+            v8 = vzip_u8(v_pair, v_pair).val[0];
+        }
+        else {
+            u8 = vld1_u8(u_row + x);
+            v8 = vld1_u8(v_row + x);
+        }
+
+        uint16x8_t y16 = vmovl_u8(y8);
+        uint16x8_t u16 = vmovl_u8(u8);
+        uint16x8_t v16 = vmovl_u8(v8);
+
+        int32x4_t r_lo;
+        int32x4_t g_lo;
+        int32x4_t b_lo;
+        int32x4_t r_hi;
+        int32x4_t g_hi;
+        int32x4_t b_hi;
+        ConvertHalf(vget_low_u16(y16), vget_low_u16(u16), vget_low_u16(v16), r_lo, g_lo, b_lo);
+        ConvertHalf(vget_high_u16(y16), vget_high_u16(u16), vget_high_u16(v16), r_hi, g_hi, b_hi);
+
+        uint8x8x4_t rgba;
+        rgba.val[0] = NarrowChannel(r_lo, r_hi);
+        rgba.val[1] = NarrowChannel(g_lo, g_hi);
+        rgba.val[2] = NarrowChannel(b_lo, b_hi);
+        rgba.val[3] = vdup_n_u8(0xFF);
+        vst4_u8(reinterpret_cast<uint8_t*>(out_row + x), rgba);
+    }
+}
+#endif
+
+void ConvertVideoPicture(VideoChromaLayout layout, const array<VideoPicturePlane, 3>& planes, isize32 size, span<ucolor> output)
+{
+    FO_STACK_TRACE_ENTRY();
+
+#if FO_VIDEO_CONVERTER_SSE2 || FO_VIDEO_CONVERTER_NEON
+    ValidatePicture(layout, planes, size, output);
+
+    auto [shift_x, shift_y] = GetChromaShift(layout);
+    size_t w = numeric_cast<size_t>(size.width);
+    size_t h = numeric_cast<size_t>(size.height);
+    size_t vector_w = w - w % VECTOR_PIXELS;
+
+    for (size_t y = 0; y < h; y++) {
+        const uint8_t* y_row = planes[0].Data.data() + y * planes[0].Stride;
+        const uint8_t* u_row = planes[1].Data.data() + (y >> shift_y) * planes[1].Stride;
+        const uint8_t* v_row = planes[2].Data.data() + (y >> shift_y) * planes[2].Stride;
+        ucolor* out_row = output.data() + y * w;
+
+        ConvertRowVector(y_row, u_row, v_row, shift_x, vector_w, out_row);
+        ConvertRowScalar(y_row, u_row, v_row, shift_x, vector_w, w, out_row);
+    }
+#else
+    ConvertVideoPictureScalar(layout, planes, size, output);
+#endif
+}
+
+void ConvertVideoPictureScalar(VideoChromaLayout layout, const array<VideoPicturePlane, 3>& planes, isize32 size, span<ucolor> output)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    ValidatePicture(layout, planes, size, output);
+
+    auto [shift_x, shift_y] = GetChromaShift(layout);
+    size_t w = numeric_cast<size_t>(size.width);
+    size_t h = numeric_cast<size_t>(size.height);
+
+    for (size_t y = 0; y < h; y++) {
+        const uint8_t* y_row = planes[0].Data.data() + y * planes[0].Stride;
+        const uint8_t* u_row = planes[1].Data.data() + (y >> shift_y) * planes[1].Stride;
+        const uint8_t* v_row = planes[2].Data.data() + (y >> shift_y) * planes[2].Stride;
+
+        ConvertRowScalar(y_row, u_row, v_row, shift_x, 0, w, output.data() + y * w);
+    }
+}
+
+FO_END_NAMESPACE
@@ -0,0 +1,60 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+#include "Common.h"
+
+FO_BEGIN_NAMESPACE
+
+enum class VideoChromaLayout : uint8_t
+{
+    Yuv420,
+    Yuv422,
+    Yuv444,
+};
+
+struct VideoPicturePlane
+{
+    const_span<uint8_t> Data {};
+    size_t Stride {};
+};
+
+// Converts a decoded YCbCr picture to RGBA with the coefficients video playback has always used. Every channel is
+// computed in float32 in the same operation order as the scalar path, clamped and rounded half away from zero, so
+// the vectorized rows are bit-exact with it
+void ConvertVideoPicture(VideoChromaLayout layout, const array<VideoPicturePlane, 3>& planes, isize32 size, span<ucolor> output);
+void ConvertVideoPictureScalar(VideoChromaLayout layout, const array<VideoPicturePlane, 3>& planes, isize32 size, span<ucolor> output);
+
+FO_END_NAMESPACE
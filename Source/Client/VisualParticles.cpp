@@ -43,6 +43,9 @@ struct ParticleManager::Impl
     auto FindBackend(string_view ext) const -> nptr<const ParticleRuntimeBackend>;
 
     vector<unique_ptr<ParticleRuntimeBackend>> Backends;
+    nanotime FrameTime {};
+    uint64_t FrameIndex {};
+    ParticleFrameStats FrameStats {};
 };
 
 ParticleManager::Impl::Impl(const ParticleRuntimeServices& services) :
@@ -131,6 +134,92 @@ auto ParticleManager::GetExtensions() const -> vector<string>
     return exts;
 }
 
+auto ParticleManager::GetFrameStats() const -> ParticleFrameStats
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Nothing is scheduled yet in a frame that has just begun
+    if (_impl->FrameIndex == 0 || _gameTime->GetFrameTime() != _impl->FrameTime) {
+        return {};
+    }
+
+    return _impl->FrameStats;
+}
+
+auto ParticleManager::SyncFrame() -> uint64_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    nanotime frame_time = _gameTime->GetFrameTime();
+
+    if (_impl->FrameIndex == 0 || frame_time != _impl->FrameTime) {
+        _impl->FrameTime = frame_time;
+        _impl->FrameIndex++;
+        _impl->FrameStats = {};
+    }
+
+    return _impl->FrameIndex;
+}
+
+void ParticleManager::AdvanceSystem(ptr<ParticleSystem> system, float32_t delta_seconds)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    ignore_unused(SyncFrame());
+
+    if (!system->IsActive()) {
+        system->_pendingTime = 0.0;
+        return;
+    }
+
+    // Time missed beyond the catch-up window is dropped, a looping effect looks the same after it anyway
+    float64_t catch_up_window = std::max(numeric_cast<float64_t>(_settings->ParticleMaxCatchUpTime) / 1000.0, numeric_cast<float64_t>(delta_seconds));
+    system->_pendingTime = std::min(system->_pendingTime + numeric_cast<float64_t>(delta_seconds), catch_up_window);
+
+    ParticleFrameStats& stats = _impl->FrameStats;
+    size_t max_steps = numeric_cast<size_t>(std::max(_settings->ParticleMaxStepsPerFrame, 0));
+    auto has_step_budget = [&]() -> bool { return max_steps == 0 || stats.SimulationSteps < max_steps; };
+    auto simulate_step = [&](float64_t step_seconds) {
+        system->Update(numeric_cast<float32_t>(step_seconds));
+        system->_pendingTime -= step_seconds;
+        stats.SimulationSteps++;
+    };
+
+    // A negative off-screen rate keeps culled systems simulating like visible ones
+    int32_t offscreen_rate = _settings->ParticleOffscreenUpdateRate;
+
+    if (system->IsCulled()) {
+        stats.CulledSystems++;
+    }
+
+    if (system->IsCulled() && offscreen_rate >= 0) {
+        // Outside the view the simulation runs at a reduced rate, every update one coarse step over the time since
+        // the previous one, or not at all until the system is back in view
+        if (offscreen_rate > 0 && system->_pendingTime >= 1.0 / numeric_cast<float64_t>(offscreen_rate) && has_step_budget()) {
+            simulate_step(system->_pendingTime);
+            stats.SimulatedSystems++;
+        }
+    }
+    else {
+        // In view the first step is never held back; time saved up while culled is replayed in steps of the regular
+        // size for as long as the frame budget lasts, and the rest waits for the next frame
+        float64_t step_limit = std::max(numeric_cast<float64_t>(delta_seconds), numeric_cast<float64_t>(std::max(_animUpdateThreshold, 1)) / 1000.0);
+
+        do {
+            simulate_step(std::min(system->_pendingTime, step_limit));
+        } while (system->_pendingTime > 0.0 && system->IsActive() && has_step_budget());
+
+        stats.SimulatedSystems++;
+    }
+
+    if (!system->IsActive()) {
+        system->_pendingTime = 0.0;
+    }
+    else if (system->_pendingTime > 0.0) {
+        stats.DeferredSystems++;
+    }
+}
+
 void ParticleManager::InvalidateResource(string_view name)
 {
     FO_STACK_TRACE_ENTRY();
@@ -309,6 +398,31 @@ auto ParticleSystem::NeedDraw() const -> bool
     return _renderPending && (!IsActive() || GetTime() - _lastRenderTime >= std::chrono::milliseconds(_particleMngr->_animUpdateThreshold));
 }
 
+auto ParticleSystem::IsCulled() const -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // A report from the map view holds for the frame it was drawn in and the next one; a system nobody reports on,
+    // like an interface or preview effect, is always in view
+    return _viewFrame && *_viewFrame + 1 >= _particleMngr->_impl->FrameIndex && !_inView;
+}
+
+void ParticleSystem::SetInView(bool in_view)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    uint64_t frame = _particleMngr->SyncFrame();
+
+    // A system shown by several map sprites is in view when any of them is
+    if (_viewFrame != frame) {
+        _viewFrame = frame;
+        _inView = in_view;
+    }
+    else {
+        _inView = _inView || in_view;
+    }
+}
+
 void ParticleSystem::Setup(const mat44& proj, const mat44& world, const vec3& pos_offset, float32_t look_dir_angle, const vec3& view_offset, bool tilt_in_proj)
 {
     FO_STACK_TRACE_ENTRY();
@@ -341,6 +455,7 @@ void ParticleSystem::Prewarm()
     FO_VERIFY_AND_THROW(std::isfinite(elapsed_seconds) && elapsed_seconds >= 0.0f, "Particle runtime returned an invalid prewarm duration", elapsed_seconds);
 
     _elapsedTime += numeric_cast<float64_t>(elapsed_seconds);
+    _pendingTime = 0.0;
     _forceDraw = true;
     _renderPending = true;
     _lastUpdateTime = GetTime();
@@ -384,8 +499,9 @@ void ParticleSystem::Update()
         delta_seconds = numeric_cast<float32_t>(std::max(_particleMngr->_animUpdateThreshold, 1)) * 0.001f;
     }
 
+    // The manager decides how much of the frame delta is simulated now, depending on the map view and the frame budget
     _lastUpdateTime = time;
-    Update(delta_seconds);
+    _particleMngr->AdvanceSystem(this, delta_seconds);
 }
 
 void ParticleSystem::Update(float32_t delta_seconds)
@@ -461,6 +577,7 @@ void ParticleSystem::ResetTiming()
     FO_STACK_TRACE_ENTRY();
 
     _elapsedTime = 0.0;
+    _pendingTime = 0.0;
     _forceDraw = true;
     _renderPending = true;
     _lastUpdateTime = GetTime();
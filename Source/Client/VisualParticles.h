@@ -57,6 +57,15 @@ struct ParticleSpriteFrame
     mat44 World {1.0f};
 };
 
+// Frame-driven particle simulation over the current frame, as scheduled by ParticleManager
+struct ParticleFrameStats
+{
+    size_t SimulatedSystems {}; // Systems whose simulation advanced
+    size_t CulledSystems {}; // Systems the map view reported outside of it
+    size_t DeferredSystems {}; // Systems holding simulation time back for a later frame
+    size_t SimulationSteps {};
+};
+
 class ParticleSystem final
 {
     friend class ParticleManager;
@@ -79,6 +88,7 @@ class ParticleSystem final
     [[nodiscard]] auto ComputeSpriteFrame(const RenderSettings& settings) const -> ParticleSpriteFrame;
     [[nodiscard]] auto NeedForceDraw() const -> bool { return _forceDraw; }
     [[nodiscard]] auto NeedDraw() const -> bool;
+    [[nodiscard]] auto IsCulled() const -> bool;
 
     void RebaseWorldParticles(vec3 delta) noexcept;
     void Setup(const mat44& proj, const mat44& world, const vec3& pos_offset, float32_t look_dir_angle, const vec3& view_offset, bool tilt_in_proj = false);
@@ -90,6 +100,7 @@ class ParticleSystem final
     void RefreshRenderTransform();
     void Draw();
     void SetScale(float32_t scale);
+    void SetInView(bool in_view);
 
 private:
     explicit ParticleSystem(ptr<ParticleManager> particle_mngr, unique_ptr<ParticleRuntimeSystem>&& runtime_system);
@@ -108,6 +119,9 @@ class ParticleSystem final
     bool _renderPending {};
     nanotime _lastUpdateTime {};
     nanotime _lastRenderTime {};
+    float64_t _pendingTime {}; // Frame time not simulated yet, held back while culled or over the frame step budget
+    optional<uint64_t> _viewFrame {};
+    bool _inView {};
 };
 
 class ParticleManager final
@@ -123,6 +137,7 @@ class ParticleManager final
     ~ParticleManager();
 
     [[nodiscard]] auto GetExtensions() const -> vector<string>;
+    [[nodiscard]] auto GetFrameStats() const -> ParticleFrameStats;
 
     void InvalidateResource(string_view name);
     auto CreateParticle(string_view name) -> optional<ParticleSystem>;
@@ -130,6 +145,10 @@ class ParticleManager final
 private:
     struct Impl;
 
+    [[nodiscard]] auto SyncFrame() -> uint64_t;
+
+    void AdvanceSystem(ptr<ParticleSystem> system, float32_t delta_seconds);
+
     unique_ptr<Impl> _impl;
     ptr<RenderSettings> _settings;
     ptr<GameTimer> _gameTime;
@@ -419,6 +419,903 @@ auto AnyData::ReadToken(nptr<const char> str, string& result) -> nptr<const char
     return next_token;
 }
 
+// Packed document layout, integers are little-endian and unaligned:
+// header: magic "FOPD", uint32 root offset, uint32 key table offset, uint32 key count
+// value: uint8 value type followed by payload
+//   Int64/Float64 - 8 bytes, Bool - 1 byte, String - uint32 size and bytes
+//   Array - uint32 count and count * uint32 element offset
+//   Dict - uint32 count and count * (uint32 key index, uint32 value offset) ordered by key
+// key table: key count * (uint32 offset, uint32 size) followed by key bytes
+// Values are written depth-first right after their parent index, so a valid document tiles without gaps or sharing
+static constexpr array<uint8_t, 4> PACKED_DOC_MAGIC = {'F', 'O', 'P', 'D'};
+static constexpr size_t PACKED_DOC_HEADER_SIZE = 16;
+static constexpr size_t PACKED_DOC_MAX_DEPTH = 64;
+
+template<typename T>
+static auto ReadPacked(const_span<uint8_t> data, size_t offset) noexcept -> T
+{
+    T value {};
+    MemCopy(&value, &data[offset], sizeof(T));
+    return value;
+}
+
+static auto GetPackedKey(const_span<uint8_t> data, size_t key_index) noexcept -> string_view
+{
+    const auto key_table_offset = ReadPacked<uint32_t>(data, 8);
+    const size_t entry_offset = key_table_offset + key_index * 8;
+    const auto key_offset = ReadPacked<uint32_t>(data, entry_offset);
+    const auto key_size = ReadPacked<uint32_t>(data, entry_offset + 4);
+    return span_to_string(data.subspan(key_offset, key_size));
+}
+
+static void RequirePackedRange(const_span<uint8_t> data, size_t offset, size_t size)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (offset > data.size() || size > data.size() - offset) {
+        throw AnyDataException("Packed document range is out of bounds", offset, size, data.size());
+    }
+}
+
+static auto ValidatePackedValue(const_span<uint8_t> data, size_t values_size, size_t offset, size_t key_count, size_t depth) -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto values = data.first(values_size);
+
+    if (depth > PACKED_DOC_MAX_DEPTH) {
+        throw AnyDataException("Packed document is nested too deep", depth);
+    }
+
+    RequirePackedRange(values, offset, 1);
+    const size_t payload_offset = offset + 1;
+
+    switch (static_cast<AnyData::ValueType>(data[offset])) {
+    case AnyData::ValueType::Int64:
+    case AnyData::ValueType::Float64:
+        RequirePackedRange(values, payload_offset, 8);
+        return payload_offset + 8;
+    case AnyData::ValueType::Bool:
+        RequirePackedRange(values, payload_offset, 1);
+
+        if (data[payload_offset] > 1) {
+            throw AnyDataException("Invalid packed bool value", static_cast<int32_t>(data[payload_offset]));
+        }
+
+        return payload_offset + 1;
+    case AnyData::ValueType::String: {
+        RequirePackedRange(values, payload_offset, 4);
+        const auto size = ReadPacked<uint32_t>(data, payload_offset);
+        RequirePackedRange(values, payload_offset + 4, size);
+        return payload_offset + 4 + size;
+    }
+    case AnyData::ValueType::Array:
+    case AnyData::ValueType::Dict: {
+        const bool is_dict = static_cast<AnyData::ValueType>(data[offset]) == AnyData::ValueType::Dict;
+        const size_t entry_size = is_dict ? 8 : 4;
+
+        RequirePackedRange(values, payload_offset, 4);
+        const size_t count = ReadPacked<uint32_t>(data, payload_offset);
+        const size_t index_offset = payload_offset + 4;
+        RequirePackedRange(values, index_offset, count * entry_size);
+
+        size_t next_offset = index_offset + count * entry_size;
+        string_view prev_key;
+
+        for (size_t i = 0; i < count; i++) {
+            const size_t entry_offset = index_offset + i * entry_size;
+
+            if (is_dict) {
+                const size_t key_index = ReadPacked<uint32_t>(data, entry_offset);
+
+                if (key_index >= key_count) {
+                    throw AnyDataException("Packed document key index is out of range", key_index, key_count);
+                }
+
+                const string_view key = GetPackedKey(data, key_index);
+
+                if (i != 0 && key <= prev_key) {
+                    throw AnyDataException("Packed document keys are not ordered", prev_key, key);
+                }
+
+                prev_key = key;
+            }
+
+            const size_t value_offset = ReadPacked<uint32_t>(data, entry_offset + (is_dict ? 4 : 0));
+
+            if (value_offset != next_offset) {
+                throw AnyDataException("Packed document value is misplaced", value_offset, next_offset);
+            }
+
+            next_offset = ValidatePackedValue(data, values_size, value_offset, key_count, depth + 1);
+        }
+
+        return next_offset;
+    }
+    }
+
+    throw AnyDataException("Invalid packed value type", static_cast<int32_t>(data[offset]));
+}
+
+static void ValidatePackedDocument(const_span<uint8_t> data)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (!AnyData::PackedDocumentView::IsPacked(data)) {
+        throw AnyDataException("Invalid packed document header", data.size());
+    }
+
+    const size_t root_offset = ReadPacked<uint32_t>(data, 4);
+    const size_t key_table_offset = ReadPacked<uint32_t>(data, 8);
+    const size_t key_count = ReadPacked<uint32_t>(data, 12);
+
+    if (root_offset != PACKED_DOC_HEADER_SIZE || data[root_offset] != static_cast<uint8_t>(AnyData::ValueType::Dict)) {
+        throw AnyDataException("Invalid packed document root", root_offset);
+    }
+
+    RequirePackedRange(data, key_table_offset, key_count * 8);
+    size_t next_key_offset = key_table_offset + key_count * 8;
+
+    for (size_t i = 0; i < key_count; i++) {
+        const size_t key_offset = ReadPacked<uint32_t>(data, key_table_offset + i * 8);
+        const size_t key_size = ReadPacked<uint32_t>(data, key_table_offset + i * 8 + 4);
+
+        if (key_offset != next_key_offset) {
+            throw AnyDataException("Packed document key is misplaced", key_offset, next_key_offset);
+        }
+
+        RequirePackedRange(data, key_offset, key_size);
+        next_key_offset = key_offset + key_size;
+    }
+
+    if (next_key_offset != data.size()) {
+        throw AnyDataException("Packed document has trailing data", next_key_offset, data.size());
+    }
+
+    const size_t values_end = ValidatePackedValue(data, key_table_offset, root_offset, key_count, 0);
+
+    if (values_end != key_table_offset) {
+        throw AnyDataException("Packed document values do not reach key table", values_end, key_table_offset);
+    }
+}
+
+class PackedDocumentWriter final
+{
+public:
+    PackedDocumentWriter() :
+        _data(PACKED_DOC_HEADER_SIZE)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        _data.reserve(256);
+    }
+
+    void WriteValue(const AnyData::Value& value)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        switch (value.Type()) {
+        case AnyData::ValueType::Int64:
+            WriteScalar(AnyData::ValueType::Int64, value.AsInt64());
+            break;
+        case AnyData::ValueType::Float64:
+            WriteScalar(AnyData::ValueType::Float64, value.AsDouble());
+            break;
+        case AnyData::ValueType::Bool:
+            WriteScalar(AnyData::ValueType::Bool, static_cast<uint8_t>(value.AsBool() ? 1 : 0));
+            break;
+        case AnyData::ValueType::String:
+            WriteString(value.AsString());
+            break;
+        case AnyData::ValueType::Array: {
+            const auto& arr = value.AsArray();
+            size_t index_offset = BeginContainer(AnyData::ValueType::Array, arr.Size(), 4);
+
+            for (const auto& element : arr) {
+                PatchU32(index_offset, _data.size());
+                WriteValue(element);
+                index_offset += 4;
+            }
+        } break;
+        case AnyData::ValueType::Dict:
+            WriteDict(value.AsDict());
+            break;
+        }
+    }
+
+    void WriteValue(const AnyData::PackedValue& value)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        switch (value.Type()) {
+        case AnyData::ValueType::Int64:
+            WriteScalar(AnyData::ValueType::Int64, value.AsInt64());
+            break;
+        case AnyData::ValueType::Float64:
+            WriteScalar(AnyData::ValueType::Float64, value.AsDouble());
+            break;
+        case AnyData::ValueType::Bool:
+            WriteScalar(AnyData::ValueType::Bool, static_cast<uint8_t>(value.AsBool() ? 1 : 0));
+            break;
+        case AnyData::ValueType::String:
+            WriteString(value.AsString());
+            break;
+        case AnyData::ValueType::Array: {
+            const size_t count = value.Size();
+            size_t index_offset = BeginContainer(AnyData::ValueType::Array, count, 4);
+
+            for (size_t i = 0; i < count; i++) {
+                PatchU32(index_offset, _data.size());
+                WriteValue(value.GetElement(i));
+                index_offset += 4;
+            }
+        } break;
+        case AnyData::ValueType::Dict: {
+            const size_t count = value.Size();
+            size_t index_offset = BeginContainer(AnyData::ValueType::Dict, count, 8);
+
+            for (size_t i = 0; i < count; i++) {
+                PatchU32(index_offset, InternKey(value.GetKey(i)));
+                PatchU32(index_offset + 4, _data.size());
+                WriteValue(value.GetValue(i));
+                index_offset += 8;
+            }
+        } break;
+        }
+    }
+
+    void WriteDict(const AnyData::Dict& dict)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        size_t index_offset = BeginContainer(AnyData::ValueType::Dict, dict.Size(), 8);
+
+        for (const auto& [key, value] : dict) {
+            PatchU32(index_offset, InternKey(key));
+            PatchU32(index_offset + 4, _data.size());
+            WriteValue(value);
+            index_offset += 8;
+        }
+    }
+
+    void WriteMergedDict(const AnyData::PackedDocumentView& base, const AnyData::Document& patch)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        // Both sides are ordered by key so single merge walk keeps result ordered, patch entries win
+        struct MergeEntry
+        {
+            string_view Key {};
+            optional<AnyData::PackedValue> BaseValue {};
+            nptr<const AnyData::Value> PatchValue {};
+        };
+
+        vector<MergeEntry> entries;
+        entries.reserve(base.Size() + patch.Size());
+
+        const size_t base_count = base.Size();
+        size_t base_index = 0;
+        auto patch_it = patch.begin();
+
+        while (base_index < base_count || patch_it != patch.end()) {
+            if (patch_it == patch.end() || (base_index < base_count && base.GetKey(base_index) < string_view(patch_it->first))) {
+                entries.emplace_back(MergeEntry {.Key = base.GetKey(base_index), .BaseValue = base.GetValue(base_index), .PatchValue = nullptr});
+                base_index++;
+            }
+            else {
+                if (base_index < base_count && base.GetKey(base_index) == string_view(patch_it->first)) {
+                    base_index++;
+                }
+
+                entries.emplace_back(MergeEntry {.Key = patch_it->first, .BaseValue = std::nullopt, .PatchValue = &patch_it->second});
+                ++patch_it;
+            }
+        }
+
+        size_t index_offset = BeginContainer(AnyData::ValueType::Dict, entries.size(), 8);
+
+        for (const auto& entry : entries) {
+            PatchU32(index_offset, InternKey(entry.Key));
+            PatchU32(index_offset + 4, _data.size());
+
+            if (entry.PatchValue) {
+                WriteValue(*entry.PatchValue);
+            }
+            else {
+                WriteValue(*entry.BaseValue);
+            }
+
+            index_offset += 8;
+        }
+    }
+
+    void WriteMergedDict(const AnyData::PackedDocumentView& base, const AnyData::PackedDocumentView& patch)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        // Same walk as for a document patch, both sides are packed so values are copied record to record
+        struct MergeEntry
+        {
+            string_view Key {};
+            AnyData::PackedValue EntryValue;
+        };
+
+        vector<MergeEntry> entries;
+        entries.reserve(base.Size() + patch.Size());
+
+        const size_t base_count = base.Size();
+        const size_t patch_count = patch.Size();
+        size_t base_index = 0;
+        size_t patch_index = 0;
+
+        while (base_index < base_count || patch_index < patch_count) {
+            if (patch_index == patch_count || (base_index < base_count && base.GetKey(base_index) < patch.GetKey(patch_index))) {
+                entries.emplace_back(MergeEntry {.Key = base.GetKey(base_index), .EntryValue = base.GetValue(base_index)});
+                base_index++;
+            }
+            else {
+                if (base_index < base_count && base.GetKey(base_index) == patch.GetKey(patch_index)) {
+                    base_index++;
+                }
+
+                entries.emplace_back(MergeEntry {.Key = patch.GetKey(patch_index), .EntryValue = patch.GetValue(patch_index)});
+                patch_index++;
+            }
+        }
+
+        size_t index_offset = BeginContainer(AnyData::ValueType::Dict, entries.size(), 8);
+
+        for (const auto& entry : entries) {
+            PatchU32(index_offset, InternKey(entry.Key));
+            PatchU32(index_offset + 4, _data.size());
+            WriteValue(entry.EntryValue);
+            index_offset += 8;
+        }
+    }
+
+    // Writers fed by short-lived values keep their own copy of every key
+    void SetKeysOwned() noexcept { _keysOwned = true; }
+
+    [[nodiscard]] auto GetWrittenSize() const noexcept -> size_t { return _data.size(); }
+
+    struct RootEntry
+    {
+        string Key {};
+        size_t Begin {};
+        size_t End {};
+    };
+
+    // Values of the root entries were written one after another in arrival order, the root index goes in front of
+    // them and the values are moved into key order with their container offsets shifted along
+    [[nodiscard]] auto FinishWithRoot(vector<RootEntry>& entries) -> vector<uint8_t>
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        std::ranges::sort(entries, [](const RootEntry& left, const RootEntry& right) { return left.Key < right.Key; });
+
+        if (const auto it = std::ranges::adjacent_find(entries, [](const RootEntry& left, const RootEntry& right) { return left.Key == right.Key; }); it != entries.end()) {
+            throw AnyDataException("Packed document builder got duplicate key", it->Key);
+        }
+
+        auto values = std::move(_data);
+        _data.assign(PACKED_DOC_HEADER_SIZE, 0);
+        _data.reserve(values.size() + 5 + entries.size() * 8);
+
+        size_t index_offset = BeginContainer(AnyData::ValueType::Dict, entries.size(), 8);
+
+        for (const auto& entry : entries) {
+            const size_t value_offset = _data.size();
+
+            PatchU32(index_offset, InternKey(entry.Key));
+            PatchU32(index_offset + 4, value_offset);
+            _data.insert(_data.end(), values.begin() + numeric_cast<ptrdiff_t>(entry.Begin), values.begin() + numeric_cast<ptrdiff_t>(entry.End));
+            RelocateValue(value_offset, entry.Begin, value_offset);
+            index_offset += 8;
+        }
+
+        return Finish();
+    }
+
+    [[nodiscard]] auto Finish() -> vector<uint8_t>
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        const size_t key_table_offset = _data.size();
+        size_t key_offset = key_table_offset + _keys.size() * 8;
+
+        for (const auto& key : _keys) {
+            AppendU32(key_offset);
+            AppendU32(key.size());
+            key_offset += key.size();
+        }
+
+        for (const auto& key : _keys) {
+            const auto key_bytes = make_const_span(key);
+            _data.insert(_data.end(), key_bytes.begin(), key_bytes.end());
+        }
+
+        MemCopy(_data.data(), PACKED_DOC_MAGIC.data(), PACKED_DOC_MAGIC.size());
+        PatchU32(4, PACKED_DOC_HEADER_SIZE);
+        PatchU32(8, key_table_offset);
+        PatchU32(12, _keys.size());
+
+        return std::move(_data);
+    }
+
+private:
+    template<typename T>
+    void WriteScalar(AnyData::ValueType type, T value)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        _data.emplace_back(static_cast<uint8_t>(type));
+        const size_t offset = _data.size();
+        _data.resize(offset + sizeof(T));
+        MemCopy(&_data[offset], &value, sizeof(T));
+    }
+
+    void WriteString(string_view str)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        _data.emplace_back(static_cast<uint8_t>(AnyData::ValueType::String));
+        AppendU32(str.size());
+        const auto str_bytes = make_const_span(str);
+        _data.insert(_data.end(), str_bytes.begin(), str_bytes.end());
+    }
+
+    auto BeginContainer(AnyData::ValueType type, size_t count, size_t entry_size) -> size_t
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        _data.emplace_back(static_cast<uint8_t>(type));
+        AppendU32(count);
+        const size_t index_offset = _data.size();
+        _data.resize(index_offset + count * entry_size);
+        return index_offset;
+    }
+
+    void AppendU32(size_t value)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        const size_t offset = _data.size();
+        _data.resize(offset + 4);
+        PatchU32(offset, value);
+    }
+
+    void PatchU32(size_t offset, size_t value)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        const auto u32_value = numeric_cast<uint32_t>(value);
+        MemCopy(&_data[offset], &u32_value, sizeof(u32_value));
+    }
+
+    void RelocateValue(size_t offset, size_t old_base, size_t new_base)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        const auto type = static_cast<AnyData::ValueType>(_data[offset]);
+
+        if (type != AnyData::ValueType::Array && type != AnyData::ValueType::Dict) {
+            return;
+        }
+
+        const size_t entry_size = type == AnyData::ValueType::Dict ? 8 : 4;
+        const size_t value_field = type == AnyData::ValueType::Dict ? 4 : 0;
+        const size_t count = ReadPacked<uint32_t>(_data, offset + 1);
+
+        for (size_t i = 0; i < count; i++) {
+            const size_t field_offset = offset + 5 + i * entry_size + value_field;
+            const size_t value_offset = ReadPacked<uint32_t>(_data, field_offset) - old_base + new_base;
+            PatchU32(field_offset, value_offset);
+            RelocateValue(value_offset, old_base, new_base);
+        }
+    }
+
+    auto InternKey(string_view key) -> size_t
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        if (const auto it = _keyIndices.find(key); it != _keyIndices.end()) {
+            return it->second;
+        }
+
+        if (_keysOwned) {
+            key = _ownedKeys.emplace_back(key);
+        }
+
+        const size_t key_index = _keys.size();
+        _keys.emplace_back(key);
+        _keyIndices.emplace(key, key_index);
+        return key_index;
+    }
+
+    vector<uint8_t> _data;
+    vector<string_view> _keys {};
+    unordered_map<string_view, size_t> _keyIndices {};
+    bool _keysOwned {};
+    deque<string> _ownedKeys {}; // Deque doesn't move its elements on growth, so key views stay valid
+};
+
+AnyData::PackedValue::PackedValue(const_span<uint8_t> data, size_t offset) noexcept :
+    _data {data},
+    _offset {offset}
+{
+    FO_STACK_TRACE_ENTRY();
+}
+
+auto AnyData::PackedValue::Type() const -> ValueType
+{
+    FO_STACK_TRACE_ENTRY();
+
+    return static_cast<ValueType>(_data[_offset]);
+}
+
+auto AnyData::PackedValue::AsInt64() const -> int64_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (Type() != ValueType::Int64) {
+        throw AnyDataException("Packed value is not int64", static_cast<int32_t>(Type()));
+    }
+
+    return ReadPacked<int64_t>(_data, _offset + 1);
+}
+
+auto AnyData::PackedValue::AsDouble() const -> float64_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (Type() != ValueType::Float64) {
+        throw AnyDataException("Packed value is not float64", static_cast<int32_t>(Type()));
+    }
+
+    return ReadPacked<float64_t>(_data, _offset + 1);
+}
+
+auto AnyData::PackedValue::AsBool() const -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (Type() != ValueType::Bool) {
+        throw AnyDataException("Packed value is not bool", static_cast<int32_t>(Type()));
+    }
+
+    return _data[_offset + 1] != 0;
+}
+
+auto AnyData::PackedValue::AsString() const -> string_view
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (Type() != ValueType::String) {
+        throw AnyDataException("Packed value is not string", static_cast<int32_t>(Type()));
+    }
+
+    const auto size = ReadPacked<uint32_t>(_data, _offset + 1);
+    return span_to_string(_data.subspan(_offset + 5, size));
+}
+
+auto AnyData::PackedValue::Size() const -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (Type() != ValueType::Array && Type() != ValueType::Dict) {
+        throw AnyDataException("Packed value is not container", static_cast<int32_t>(Type()));
+    }
+
+    return ReadPacked<uint32_t>(_data, _offset + 1);
+}
+
+auto AnyData::PackedValue::GetElement(size_t index) const -> PackedValue
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (Type() != ValueType::Array) {
+        throw AnyDataException("Packed value is not array", static_cast<int32_t>(Type()));
+    }
+    if (index >= Size()) {
+        throw AnyDataException("Packed array index is out of range", index, Size());
+    }
+
+    return {_data, ReadPacked<uint32_t>(_data, _offset + 5 + index * 4)};
+}
+
+auto AnyData::PackedValue::GetKey(size_t index) const -> string_view
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (Type() != ValueType::Dict) {
+        throw AnyDataException("Packed value is not dict", static_cast<int32_t>(Type()));
+    }
+    if (index >= Size()) {
+        throw AnyDataException("Packed dict index is out of range", index, Size());
+    }
+
+    return GetPackedKey(_data, ReadPacked<uint32_t>(_data, _offset + 5 + index * 8));
+}
+
+auto AnyData::PackedValue::GetValue(size_t index) const -> PackedValue
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (Type() != ValueType::Dict) {
+        throw AnyDataException("Packed value is not dict", static_cast<int32_t>(Type()));
+    }
+    if (index >= Size()) {
+        throw AnyDataException("Packed dict index is out of range", index, Size());
+    }
+
+    return {_data, ReadPacked<uint32_t>(_data, _offset + 5 + index * 8 + 4)};
+}
+
+auto AnyData::PackedValue::Find(string_view key) const -> optional<PackedValue>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    size_t low = 0;
+    size_t high = Size();
+
+    while (low < high) {
+        const size_t mid = low + (high - low) / 2;
+        const string_view mid_key = GetKey(mid);
+
+        if (mid_key == key) {
+            return GetValue(mid);
+        }
+
+        if (mid_key < key) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
+    }
+
+    return std::nullopt;
+}
+
+auto AnyData::PackedValue::ToValue() const -> Value
+{
+    FO_STACK_TRACE_ENTRY();
+
+    switch (Type()) {
+    case ValueType::Int64:
+        return AsInt64();
+    case ValueType::Float64:
+        return AsDouble();
+    case ValueType::Bool:
+        return AsBool();
+    case ValueType::String:
+        return string(AsString());
+    case ValueType::Array: {
+        const size_t count = Size();
+        Array arr;
+        arr.Reserve(count);
+
+        for (size_t i = 0; i < count; i++) {
+            arr.EmplaceBack(GetElement(i).ToValue());
+        }
+
+        return arr;
+    }
+    case ValueType::Dict: {
+        const size_t count = Size();
+        Dict dict;
+
+        for (size_t i = 0; i < count; i++) {
+            dict.Emplace(string(GetKey(i)), GetValue(i).ToValue());
+        }
+
+        return dict;
+    }
+    }
+
+    FO_UNREACHABLE_PLACE();
+}
+
+AnyData::PackedDocumentView::PackedDocumentView(const_span<uint8_t> data) :
+    _data {data}
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (!_data.empty()) {
+        ValidatePackedDocument(_data);
+    }
+}
+
+AnyData::PackedDocumentView::PackedDocumentView(const_span<uint8_t> data, TrustedTag /*tag*/) noexcept :
+    _data {data}
+{
+    FO_STACK_TRACE_ENTRY();
+}
+
+auto AnyData::PackedDocumentView::IsPacked(const_span<uint8_t> data) noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return data.size() > PACKED_DOC_HEADER_SIZE && std::equal(PACKED_DOC_MAGIC.begin(), PACKED_DOC_MAGIC.end(), data.begin());
+}
+
+auto AnyData::PackedDocumentView::GetRoot() const -> PackedValue
+{
+    FO_STACK_TRACE_ENTRY();
+
+    return {_data, PACKED_DOC_HEADER_SIZE};
+}
+
+auto AnyData::PackedDocumentView::Size() const -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    return !_data.empty() ? GetRoot().Size() : 0;
+}
+
+auto AnyData::PackedDocumentView::GetKey(size_t index) const -> string_view
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (_data.empty()) {
+        throw AnyDataException("Packed document is empty", index);
+    }
+
+    return GetRoot().GetKey(index);
+}
+
+auto AnyData::PackedDocumentView::GetValue(size_t index) const -> PackedValue
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (_data.empty()) {
+        throw AnyDataException("Packed document is empty", index);
+    }
+
+    return GetRoot().GetValue(index);
+}
+
+auto AnyData::PackedDocumentView::Find(string_view key) const -> optional<PackedValue>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (_data.empty()) {
+        return std::nullopt;
+    }
+
+    return GetRoot().Find(key);
+}
+
+auto AnyData::PackedDocumentView::ToDocument() const -> Document
+{
+    FO_STACK_TRACE_ENTRY();
+
+    Document doc;
+    const size_t count = Size();
+
+    for (size_t i = 0; i < count; i++) {
+        doc.Emplace(string(GetKey(i)), GetValue(i).ToValue());
+    }
+
+    return doc;
+}
+
+AnyData::PackedDocument::PackedDocument(const Document& doc)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    PackedDocumentWriter writer;
+    writer.WriteDict(doc);
+    _data = writer.Finish();
+}
+
+AnyData::PackedDocument::PackedDocument(const PackedDocumentView& base, const Document& patch)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    PackedDocumentWriter writer;
+    writer.WriteMergedDict(base, patch);
+    _data = writer.Finish();
+}
+
+AnyData::PackedDocument::PackedDocument(const PackedDocumentView& base, const PackedDocumentView& patch)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    PackedDocumentWriter writer;
+    writer.WriteMergedDict(base, patch);
+    _data = writer.Finish();
+}
+
+auto AnyData::PackedDocument::FromData(vector<uint8_t> data) -> PackedDocument
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Validate once on load, views over owned data are trusted afterwards
+    const auto view = PackedDocumentView(data);
+    ignore_unused(view);
+
+    PackedDocument packed;
+    packed._data = std::move(data);
+    return packed;
+}
+
+auto AnyData::PackedDocument::Copy() const -> PackedDocument
+{
+    FO_STACK_TRACE_ENTRY();
+
+    PackedDocument packed;
+    packed._data = _data;
+    return packed;
+}
+
+struct AnyData::PackedDocumentBuilder::Impl
+{
+    PackedDocumentWriter Writer {};
+    vector<PackedDocumentWriter::RootEntry> Entries {};
+};
+
+AnyData::PackedDocumentBuilder::PackedDocumentBuilder() :
+    _impl {SafeAlloc::MakeUnique<Impl>()}
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _impl->Writer.SetKeysOwned();
+}
+
+AnyData::PackedDocumentBuilder::PackedDocumentBuilder(PackedDocumentBuilder&&) noexcept = default;
+auto AnyData::PackedDocumentBuilder::operator=(PackedDocumentBuilder&&) noexcept -> PackedDocumentBuilder& = default;
+AnyData::PackedDocumentBuilder::~PackedDocumentBuilder() = default;
+
+auto AnyData::PackedDocumentBuilder::Size() const noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return _impl ? _impl->Entries.size() : 0;
+}
+
+void AnyData::PackedDocumentBuilder::Add(string_view key, const Value& value)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (!_impl) {
+        throw AnyDataException("Packed document builder is already finished", key);
+    }
+    const size_t begin = _impl->Writer.GetWrittenSize();
+    _impl->Writer.WriteValue(value);
+    _impl->Entries.emplace_back(PackedDocumentWriter::RootEntry {.Key = string(key), .Begin = begin, .End = _impl->Writer.GetWrittenSize()});
+}
+
+void AnyData::PackedDocumentBuilder::Add(string_view key, const PackedValue& value)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (!_impl) {
+        throw AnyDataException("Packed document builder is already finished", key);
+    }
+    const size_t begin = _impl->Writer.GetWrittenSize();
+    _impl->Writer.WriteValue(value);
+    _impl->Entries.emplace_back(PackedDocumentWriter::RootEntry {.Key = string(key), .Begin = begin, .End = _impl->Writer.GetWrittenSize()});
+}
+
+auto AnyData::PackedDocumentBuilder::Finish() -> PackedDocument
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (!_impl) {
+        throw AnyDataException("Packed document builder is already finished");
+    }
+
+    PackedDocument packed;
+
+    if (!_impl->Entries.empty()) {
+        packed._data = _impl->Writer.FinishWithRoot(_impl->Entries);
+    }
+
+    _impl.reset();
+    return packed;
+}
+
 void StringEscaping::AppendCodeString(string& result, string_view str)
 {
     FO_STACK_TRACE_ENTRY();
@@ -56,6 +56,9 @@ class AnyData final
 
     class Dict;
     class Array;
+    class PackedDocumentView;
+    class PackedDocument;
+    class PackedDocumentBuilder;
 
     class Value
     {
@@ -174,6 +177,111 @@ class AnyData final
         [[nodiscard]] auto Copy() const -> Document;
     };
 
+    // Flat binary form of a document: contiguous value records followed by an interned key table, where every
+    // container carries an offset index, so stored documents are read in place without building the Value tree
+    class PackedValue
+    {
+        friend class PackedDocumentView;
+
+    public:
+        [[nodiscard]] auto Type() const -> ValueType;
+        [[nodiscard]] auto AsInt64() const -> int64_t;
+        [[nodiscard]] auto AsDouble() const -> float64_t;
+        [[nodiscard]] auto AsBool() const -> bool;
+        [[nodiscard]] auto AsString() const -> string_view;
+        [[nodiscard]] auto Size() const -> size_t;
+        [[nodiscard]] auto GetElement(size_t index) const -> PackedValue;
+        [[nodiscard]] auto GetKey(size_t index) const -> string_view;
+        [[nodiscard]] auto GetValue(size_t index) const -> PackedValue;
+        [[nodiscard]] auto Find(string_view key) const -> optional<PackedValue>;
+        [[nodiscard]] auto ToValue() const -> Value;
+
+    private:
+        PackedValue(const_span<uint8_t> data, size_t offset) noexcept;
+
+        const_span<uint8_t> _data {};
+        size_t _offset {};
+    };
+
+    class PackedDocumentView
+    {
+        friend class PackedDocument;
+
+    public:
+        PackedDocumentView() noexcept = default;
+        explicit PackedDocumentView(const_span<uint8_t> data);
+
+        [[nodiscard]] static auto IsPacked(const_span<uint8_t> data) noexcept -> bool;
+        [[nodiscard]] auto GetData() const noexcept -> const_span<uint8_t> { return _data; }
+        [[nodiscard]] auto Empty() const -> bool { return Size() == 0; }
+        [[nodiscard]] auto Size() const -> size_t;
+        [[nodiscard]] auto GetKey(size_t index) const -> string_view;
+        [[nodiscard]] auto GetValue(size_t index) const -> PackedValue;
+        [[nodiscard]] auto Find(string_view key) const -> optional<PackedValue>;
+        [[nodiscard]] auto ToDocument() const -> Document;
+
+    private:
+        struct TrustedTag
+        {
+        };
+
+        PackedDocumentView(const_span<uint8_t> data, TrustedTag) noexcept;
+
+        [[nodiscard]] auto GetRoot() const -> PackedValue;
+
+        const_span<uint8_t> _data {};
+    };
+
+    class PackedDocument
+    {
+    public:
+        PackedDocument() noexcept = default;
+        explicit PackedDocument(const Document& doc);
+        PackedDocument(const PackedDocumentView& base, const Document& patch);
+        PackedDocument(const PackedDocumentView& base, const PackedDocumentView& patch);
+        PackedDocument(const PackedDocument&) = delete;
+        PackedDocument(PackedDocument&&) noexcept = default;
+        auto operator=(const PackedDocument&) = delete;
+        auto operator=(PackedDocument&&) noexcept -> PackedDocument& = default;
+        ~PackedDocument() = default;
+
+        [[nodiscard]] static auto FromData(vector<uint8_t> data) -> PackedDocument;
+        [[nodiscard]] auto GetView() const noexcept -> PackedDocumentView { return {_data, PackedDocumentView::TrustedTag {}}; }
+        [[nodiscard]] auto GetData() const noexcept -> const_span<uint8_t> { return _data; }
+        [[nodiscard]] auto Empty() const -> bool { return GetView().Empty(); }
+        [[nodiscard]] auto ToDocument() const -> Document { return GetView().ToDocument(); }
+        [[nodiscard]] auto Copy() const -> PackedDocument;
+
+    private:
+        friend class PackedDocumentBuilder;
+
+        vector<uint8_t> _data {};
+    };
+
+    // Assembles a packed document from top level entries added in any order, every value is packed as it arrives
+    // and the entries are only put in key order once on finish, so no intermediate document is built
+    class PackedDocumentBuilder
+    {
+    public:
+        PackedDocumentBuilder();
+        PackedDocumentBuilder(const PackedDocumentBuilder&) = delete;
+        PackedDocumentBuilder(PackedDocumentBuilder&&) noexcept;
+        auto operator=(const PackedDocumentBuilder&) = delete;
+        auto operator=(PackedDocumentBuilder&&) noexcept -> PackedDocumentBuilder&;
+        ~PackedDocumentBuilder();
+
+        [[nodiscard]] auto Size() const noexcept -> size_t;
+
+        void Add(string_view key, const Value& value);
+        void Add(string_view key, const PackedValue& value);
+        [[nodiscard]] auto Finish() -> PackedDocument;
+
+    private:
+        struct Impl;
+
+        unique_nptr<Impl> _impl {};
+    };
+
     [[nodiscard]] static auto ValueToString(const Value& value) -> string;
     [[nodiscard]] static auto ParseValue(const string& str, bool as_dict, bool as_array, ValueType value_type) -> Value;
 
@@ -413,7 +413,7 @@ enum class EngineInfoMessage : uint16_t
     ServerLog = 5001,
 };
 
-static constexpr uint32_t FO_UPDATER_VERSION = 2;
+static constexpr uint32_t FO_UPDATER_VERSION = 3;
 
 enum class UpdatePlatform : uint8_t
 {
@@ -443,7 +443,9 @@ enum class NetMessage : uint8_t
     Ping = 15,
     PlaceToGameComplete = 17,
     GetUpdateFile = 19,
+    GetUpdateFileDelta = 20,
     UpdateFileData = 23,
+    UpdateFileDelta = 24,
     AddCritter = 25,
     RemoveCritter = 27,
     InfoMessage = 32,
@@ -35,79 +35,91 @@
 
 FO_BEGIN_NAMESPACE
 
-ConfigFile::ConfigFile(string str, ConfigFileOption options) :
-    _options {options}
+ConfigLineReader::ConfigLineReader(string_view text) noexcept :
+    _text {text}
 {
-    FO_STACK_TRACE_ENTRY();
-
-    // The input is the first owned node, so the section views into it keep a stable address even
-    // after this object is moved; appending further nodes never invalidates it
-    const string& input = _ownedStrings.emplace_back(std::move(str));
-
-    auto cur_section_it = _sectionKeyValues.emplace(string_view {}, map<string_view, string_view> {});
-    ptr<map<string_view, string_view>> cur_section = &cur_section_it->second;
-    bool skip_cur_section = false;
-
-    _orderedSections.emplace_back(string_view {}, cur_section);
-
-    string section_content;
-
-    if (IsEnumSet(_options, ConfigFileOption::CollectContent)) {
-        section_content.reserve(input.length());
-    }
-
-    string accum_line;
-    size_t line_begin = 0;
-
-    while (line_begin <= input.length()) {
-        size_t line_end = input.find('\n', line_begin);
-        size_t view_end = line_end != string::npos ? line_end : input.length();
-        string_view line;
+    FO_NO_STACK_TRACE_ENTRY();
+}
 
-        if (view_end != line_begin) {
-            auto line_begin_ptr = make_ptr(input.data() + line_begin);
-            line = {line_begin_ptr.get(), view_end - line_begin};
-        }
+auto ConfigLineReader::ReadLine() -> bool
+{
+    FO_STACK_TRACE_ENTRY();
 
+    while (_nextOffset <= _text.length()) {
+        size_t line_begin = _nextOffset;
+        size_t line_end = _text.find('\n', line_begin);
+        size_t view_end = line_end != string_view::npos ? line_end : _text.length();
+        string_view line = _text.substr(line_begin, view_end - line_begin);
         bool line_stable = true;
-        string merged_line;
+        size_t line_offset = line_begin;
 
         if (!line.empty() && line.back() == '\r') {
             line.remove_suffix(1);
         }
 
-        line_begin = line_end != string::npos ? line_end + 1 : input.length() + 1;
+        _nextOffset = line_end != string_view::npos ? line_end + 1 : _text.length() + 1;
         line = strvex(line).trim();
 
-        if (!accum_line.empty()) {
-            accum_line.append(line);
-            merged_line = std::move(accum_line);
-            line = merged_line;
+        if (!_accumLine.empty()) {
+            _accumLine.append(line);
+            _mergedLine = std::move(_accumLine);
+            line = _mergedLine;
             line_stable = false;
+            line_offset = _accumOffset;
         }
 
-        accum_line.clear();
+        _accumLine.clear();
 
         if (line.empty()) {
             continue;
         }
 
         if (line.size() >= 2 && line.back() == '\\' && (line[line.size() - 2] == ' ' || line[line.size() - 2] == '\t')) {
-            accum_line.assign(strvex(line.substr(0, line.length() - 1)).trim());
-            accum_line.append(" ");
+            _accumLine.assign(strvex(line.substr(0, line.length() - 1)).trim());
+            _accumLine.append(" ");
+            _accumOffset = line_offset;
             continue;
         }
 
-        // New section
-        if (line.front() == '[') {
-            // Parse name
-            size_t end = line.find(']');
+        _line = line;
+        _lineStable = line_stable;
+        _lineOffset = line_offset;
+        return true;
+    }
 
-            if (end == string_view::npos) {
-                continue;
-            }
+    return false;
+}
+
+ConfigFile::ConfigFile(string str, ConfigFileOption options) :
+    _options {options}
+{
+    FO_STACK_TRACE_ENTRY();
 
-            string_view raw_section_name = strvex(line.substr(1, end - 1)).trim();
+    // The input is the first owned node, so the section views into it keep a stable address even
+    // after this object is moved; appending further nodes never invalidates it
+    const string& input = _ownedStrings.emplace_back(std::move(str));
+
+    auto cur_section_it = _sectionKeyValues.emplace(string_view {}, map<string_view, string_view> {});
+    ptr<map<string_view, string_view>> cur_section = &cur_section_it->second;
+    bool skip_cur_section = false;
+
+    _orderedSections.emplace_back(string_view {}, cur_section);
+
+    string section_content;
+
+    if (IsEnumSet(_options, ConfigFileOption::CollectContent)) {
+        section_content.reserve(input.length());
+    }
+
+    ConfigLineReader line_reader {input};
+
+    while (line_reader.ReadLine()) {
+        string_view line = line_reader.GetLine();
+        bool line_stable = line_reader.IsLineStable();
+
+        // New section
+        if (line.front() == '[') {
+            string_view raw_section_name = ParseSectionNameLine(line);
 
             if (raw_section_name.empty()) {
                 continue;
@@ -188,6 +200,19 @@ ConfigFile::ConfigFile(string str, ConfigFileOption options) :
     }
 }
 
+auto ConfigFile::ParseSectionNameLine(string_view line) -> string_view
+{
+    FO_STACK_TRACE_ENTRY();
+
+    size_t end = line.find(']');
+
+    if (end == string_view::npos) {
+        return {};
+    }
+
+    return strvex(line.substr(1, end - 1)).trim();
+}
+
 auto ConfigFile::ParseConfigKeyValueLine(string_view line, string_view& key, string_view& value, bool& append_value) -> bool
 {
     FO_STACK_TRACE_ENTRY();
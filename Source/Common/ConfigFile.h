@@ -47,6 +47,37 @@ enum class ConfigFileOption : uint8_t
     SkipNestedSections = 0x2,
 };
 
+// Walks config text one logical line at a time the way ConfigFile reads it: lines are trimmed, CR tolerant and
+// joined across a trailing " \" continuation. A joined line lives in the reader until the next ReadLine call,
+// any other line views the text itself
+class ConfigLineReader final
+{
+public:
+    explicit ConfigLineReader(string_view text) noexcept;
+    ConfigLineReader(const ConfigLineReader&) = delete;
+    ConfigLineReader(ConfigLineReader&&) noexcept = delete;
+    auto operator=(const ConfigLineReader&) = delete;
+    auto operator=(ConfigLineReader&&) noexcept = delete;
+    ~ConfigLineReader() = default;
+
+    [[nodiscard]] auto GetLine() const noexcept -> string_view { return _line; }
+    [[nodiscard]] auto IsLineStable() const noexcept -> bool { return _lineStable; }
+    [[nodiscard]] auto GetLineOffset() const noexcept -> size_t { return _lineOffset; } // Where the first joined physical line starts
+    [[nodiscard]] auto GetNextOffset() const noexcept -> size_t { return std::min(_nextOffset, _text.length()); }
+
+    auto ReadLine() -> bool;
+
+private:
+    string_view _text;
+    size_t _nextOffset {};
+    string_view _line {};
+    bool _lineStable {};
+    size_t _lineOffset {};
+    string _accumLine {};
+    size_t _accumOffset {};
+    string _mergedLine {};
+};
+
 class ConfigFile final
 {
 public:
@@ -70,10 +101,14 @@ class ConfigFile final
     [[nodiscard]] auto GetSectionKeyValues(string_view section_name) noexcept -> nptr<const map<string_view, string_view>>;
     [[nodiscard]] auto GetSectionContent(string_view section_name) const -> string_view;
 
+    // Line level grammar shared with readers that scan config shaped text without building a ConfigFile;
+    // a section line is one that starts with '[', an empty name means a malformed one that is skipped
+    static auto ParseSectionNameLine(string_view line) -> string_view;
+    static auto ParseConfigKeyValueLine(string_view line, string_view& key, string_view& value, bool& append_value) -> bool;
+
 private:
-    auto ParseConfigKeyValueLine(string_view line, string_view& key, string_view& value, bool& append_value) -> bool;
-    void TrimConfigRange(string_view line, size_t& begin, size_t& end);
-    auto IsConfigSpace(char ch) -> bool;
+    static void TrimConfigRange(string_view line, size_t& begin, size_t& end);
+    static auto IsConfigSpace(char ch) -> bool;
     auto GetRawValue(string_view section_name, string_view key_name) const noexcept -> nptr<const string_view>;
     auto StoreOwnedString(string_view value) -> string_view;
     auto StoreOwnedString(string&& value) -> string_view;
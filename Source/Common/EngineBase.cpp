@@ -513,6 +513,10 @@ void EngineMetadata::RegisterEntityEvents(string_view entity_name, vector<Entity
 
     FO_VERIFY_AND_THROW(entity_info->Events.empty(), "Entity info events must be empty before this operation");
     entity_info->Events = std::move(events);
+
+    for (auto& event : entity_info->Events) {
+        event.Id = Entity::RegisterEventName(event.Name);
+    }
 }
 
 void EngineMetadata::RegisterEntityEvent(string_view entity_name, EntityEventDesc&& event)
@@ -525,6 +529,7 @@ void EngineMetadata::RegisterEntityEvent(string_view entity_name, EntityEventDes
     FO_VERIFY_AND_THROW(it != _entityTypesByStr.end(), "Lookup failed in entity types by str");
     auto entity_info = it->second;
 
+    event.Id = Entity::RegisterEventName(event.Name);
     entity_info->Events.emplace_back(std::move(event));
 }
 
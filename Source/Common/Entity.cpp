@@ -32,9 +32,33 @@
 //
 
 #include "Entity.h"
+#include "TimeEvents.h"
 
 FO_BEGIN_NAMESPACE
 
+// Names are only ever appended, so an id resolves to its name through atomically published chunks without the lock
+struct EntityEventNameRegistry
+{
+    static constexpr size_t NAMES_PER_CHUNK = 256;
+    static constexpr size_t MAX_CHUNKS = 256;
+
+    using NameChunk = array<std::atomic<const string*>, NAMES_PER_CHUNK>;
+
+    shared_mutex Locker {};
+    deque<string> Names FO_TSA_GUARDED_BY(Locker) {}; // Deque keeps names stable for the lookup keys and the published pointers
+    unordered_map<string_view, uint32_t> Ids FO_TSA_GUARDED_BY(Locker) {};
+    vector<unique_ptr<NameChunk>> ChunkStorage FO_TSA_GUARDED_BY(Locker) {};
+    array<std::atomic<const NameChunk*>, MAX_CHUNKS> Chunks {};
+};
+
+static auto GetEntityEventNameRegistry() noexcept -> EntityEventNameRegistry&
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    static EntityEventNameRegistry registry;
+    return registry;
+}
+
 Entity::Entity(ptr<const PropertyRegistrar> registrar, nptr<const Properties> init_props, nptr<const Properties> base_props) noexcept :
     _props {registrar, base_props}
 {
@@ -82,33 +106,116 @@ auto Entity::TryAddRef() const noexcept -> bool
     return false;
 }
 
+auto Entity::RegisterEventName(string_view event_name) -> uint32_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(!event_name.empty(), "Empty event name");
+
+    auto& registry = GetEntityEventNameRegistry();
+
+    {
+        shared_lock lock {registry.Locker};
+
+        if (const auto it = registry.Ids.find(event_name); it != registry.Ids.end()) {
+            return it->second;
+        }
+    }
+
+    scoped_lock lock {registry.Locker};
+
+    if (const auto it = registry.Ids.find(event_name); it != registry.Ids.end()) {
+        return it->second;
+    }
+
+    const auto event_id = numeric_cast<uint32_t>(registry.Names.size());
+    const size_t chunk_index = event_id / EntityEventNameRegistry::NAMES_PER_CHUNK;
+    FO_VERIFY_AND_THROW(chunk_index < EntityEventNameRegistry::MAX_CHUNKS, "Too many distinct entity event names", event_name);
+
+    if (chunk_index == registry.ChunkStorage.size()) {
+        registry.ChunkStorage.emplace_back(SafeAlloc::MakeUnique<EntityEventNameRegistry::NameChunk>());
+        registry.Chunks[chunk_index].store(registry.ChunkStorage.back().get(), std::memory_order_release);
+    }
+
+    const string& stored_name = registry.Names.emplace_back(event_name);
+    registry.Ids.emplace(stored_name, event_id);
+    (*registry.ChunkStorage[chunk_index])[event_id % EntityEventNameRegistry::NAMES_PER_CHUNK].store(&stored_name, std::memory_order_release);
+    return event_id;
+}
+
+auto Entity::FindEventId(string_view event_name) noexcept -> optional<uint32_t>
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    auto& registry = GetEntityEventNameRegistry();
+    shared_lock lock {registry.Locker};
+
+    if (const auto it = registry.Ids.find(event_name); it != registry.Ids.end()) {
+        return it->second;
+    }
+
+    return std::nullopt;
+}
+
+auto Entity::GetEventName(uint32_t event_id) noexcept -> string_view
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    const auto& registry = GetEntityEventNameRegistry();
+    const size_t chunk_index = event_id / EntityEventNameRegistry::NAMES_PER_CHUNK;
+
+    if (chunk_index >= EntityEventNameRegistry::MAX_CHUNKS) {
+        return {};
+    }
+
+    const auto* chunk = registry.Chunks[chunk_index].load(std::memory_order_acquire);
+
+    if (chunk == nullptr) {
+        return {};
+    }
+
+    const string* name = (*chunk)[event_id % EntityEventNameRegistry::NAMES_PER_CHUNK].load(std::memory_order_acquire);
+    return name != nullptr ? string_view {*name} : string_view {};
+}
+
 auto Entity::HasEventCallbacks(string_view event_name) const noexcept -> bool
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    if (_events) {
-        if (auto it = _events->find(event_name); it != _events->end() && !it->second.empty()) {
-            return true;
-        }
+    if (!_events) {
+        return false;
     }
 
-    return false;
+    const auto event_id = FindEventId(event_name);
+    return event_id.has_value() && HasEventCallbacks(event_id.value());
 }
 
-auto Entity::FindEventCallbacks(string_view event_name) noexcept -> nptr<vector<EventCallbackData>>
+auto Entity::HasEventCallbacks(uint32_t event_id) const noexcept -> bool
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    if (_events) {
-        if (auto it = _events->find(event_name); it != _events->end()) {
-            return &it->second;
-        }
+    if (!_events) {
+        return false;
     }
 
-    return nullptr;
+    const auto it = std::ranges::lower_bound(*_events, event_id, {}, [](const auto& entry) { return entry.first; });
+    return it != _events->end() && it->first == event_id && !it->second.empty();
 }
 
-auto Entity::EnsureEventCallbacks(string_view event_name) -> ptr<vector<EventCallbackData>>
+auto Entity::FindEventCallbacks(uint32_t event_id) noexcept -> nptr<vector<EventCallbackData>>
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (!_events) {
+        return nullptr;
+    }
+
+    // An entity subscribes to a handful of the registered events, so it keeps only those and searches them by id
+    const auto it = std::ranges::lower_bound(*_events, event_id, {}, [](const auto& entry) { return entry.first; });
+    return it != _events->end() && it->first == event_id ? &it->second : nullptr;
+}
+
+auto Entity::EnsureEventCallbacks(uint32_t event_id) -> ptr<vector<EventCallbackData>>
 {
     FO_NO_STACK_TRACE_ENTRY();
 
@@ -118,20 +225,29 @@ auto Entity::EnsureEventCallbacks(string_view event_name) -> ptr<vector<EventCal
         _events.emplace();
     }
 
-    if (auto it = _events->find(event_name); it != _events->end()) {
-        return &it->second;
+    auto it = std::ranges::lower_bound(*_events, event_id, {}, [](const auto& entry) { return entry.first; });
+
+    if (it == _events->end() || it->first != event_id) {
+        it = _events->emplace(it, event_id, vector<EventCallbackData> {});
     }
 
-    return &_events->emplace(event_name, vector<EventCallbackData>()).first->second;
+    return &it->second;
 }
 
 void Entity::SubscribeEvent(string_view event_name, EventCallbackData&& callback)
 {
     FO_STACK_TRACE_ENTRY();
 
+    SubscribeEvent(RegisterEventName(event_name), std::move(callback));
+}
+
+void Entity::SubscribeEvent(uint32_t event_id, EventCallbackData&& callback)
+{
+    FO_STACK_TRACE_ENTRY();
+
     FO_VERIFY_AND_THROW(!IsDestroyed(), "Object is already destroyed");
 
-    auto callbacks = EnsureEventCallbacks(event_name);
+    auto callbacks = EnsureEventCallbacks(event_id);
     SubscribeEvent(callbacks, std::move(callback));
 }
 
@@ -139,10 +255,17 @@ void Entity::UnsubscribeEvent(string_view event_name, uintptr_t subscription_ptr
 {
     FO_STACK_TRACE_ENTRY();
 
-    if (_events) {
-        if (auto it = _events->find(event_name); it != _events->end()) {
-            UnsubscribeEvent(&it->second, subscription_ptr);
-        }
+    if (const auto event_id = FindEventId(event_name)) {
+        UnsubscribeEvent(event_id.value(), subscription_ptr);
+    }
+}
+
+void Entity::UnsubscribeEvent(uint32_t event_id, uintptr_t subscription_ptr) noexcept
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (auto callbacks = FindEventCallbacks(event_id)) {
+        UnsubscribeEvent(callbacks.as_ptr(), subscription_ptr);
     }
 }
 
@@ -150,10 +273,17 @@ void Entity::UnsubscribeAllEvent(string_view event_name) noexcept
 {
     FO_STACK_TRACE_ENTRY();
 
-    if (_events) {
-        if (auto it = _events->find(event_name); it != _events->end()) {
-            it->second.clear();
-        }
+    if (const auto event_id = FindEventId(event_name)) {
+        UnsubscribeAllEvent(event_id.value());
+    }
+}
+
+void Entity::UnsubscribeAllEvent(uint32_t event_id) noexcept
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (auto callbacks = FindEventCallbacks(event_id)) {
+        callbacks->clear();
     }
 }
 
@@ -168,7 +298,13 @@ void Entity::ClearAllTimeEvents() noexcept
 {
     FO_STACK_TRACE_ENTRY();
 
+    // Queued deadlines hold a reference to this entity, so they leave the queue together with the list
+    if (_timeEventMngr && _timeEvents && !_timeEvents->empty()) {
+        _timeEventMngr->CancelAllForEntity(this);
+    }
+
     _timeEvents.reset();
+    _timeEventMngr = nullptr;
 }
 
 auto Entity::FireEvent(string_view event_name, FuncCallData& call) noexcept -> EventResult
@@ -177,15 +313,32 @@ auto Entity::FireEvent(string_view event_name, FuncCallData& call) noexcept -> E
 
     FO_VERIFY_AND_RETURN_VALUE(!IsDestroyed(), EventResult::ContinueChain, "Destroyed entity tried to fire an event", GetName(), GetTypeName(), GetId(), event_name);
 
-    if (_events) {
-        if (auto it = _events->find(event_name); it != _events->end()) {
-            return FireEvent(it->second, call);
+    if (!_events) {
+        return EventResult::ContinueChain;
+    }
+
+    if (const auto event_id = FindEventId(event_name)) {
+        if (auto callbacks = FindEventCallbacks(event_id.value()); callbacks && !callbacks->empty()) {
+            return FireEvent(event_id.value(), *callbacks, call);
         }
     }
 
     return EventResult::ContinueChain;
 }
 
+auto Entity::FireEvent(uint32_t event_id, FuncCallData& call) noexcept -> EventResult
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_RETURN_VALUE(!IsDestroyed(), EventResult::ContinueChain, "Destroyed entity tried to fire an event", GetName(), GetTypeName(), GetId(), event_id);
+
+    if (auto callbacks = FindEventCallbacks(event_id); callbacks && !callbacks->empty()) {
+        return FireEvent(event_id, *callbacks, call);
+    }
+
+    return EventResult::ContinueChain;
+}
+
 void Entity::SubscribeEvent(ptr<vector<EventCallbackData>> callbacks, EventCallbackData&& callback)
 {
     FO_STACK_TRACE_ENTRY();
@@ -217,10 +370,12 @@ void Entity::UnsubscribeEvent(ptr<vector<EventCallbackData>> callbacks, uintptr_
     }
 }
 
-auto Entity::FireEvent(const vector<EventCallbackData>& callbacks, FuncCallData& call) noexcept -> EventResult
+auto Entity::FireEvent(uint32_t event_id, const vector<EventCallbackData>& callbacks, FuncCallData& call) noexcept -> EventResult
 {
     FO_STACK_TRACE_ENTRY();
 
+    ignore_unused(event_id);
+
     FO_VERIFY_AND_RETURN_VALUE(!IsDestroyed(), EventResult::ContinueChain, "Destroyed entity tried to fire cached event callbacks", GetName(), GetTypeName(), GetId());
 
     if (callbacks.empty()) {
@@ -489,8 +644,9 @@ auto Entity::EnsureTimeEvents() -> ptr<TimeEventList>
     return make_ptr(&*_timeEvents);
 }
 
-EntityEvent::EntityEvent(ptr<Entity> entity, string_view callback_name) noexcept :
+EntityEvent::EntityEvent(ptr<Entity> entity, uint32_t event_id, string_view callback_name) noexcept :
     _entity {entity},
+    _eventId {event_id},
     _callbackName {callback_name}
 {
     FO_NO_STACK_TRACE_ENTRY();
@@ -502,9 +658,9 @@ auto EntityEvent::FireEvent(FuncCallData& call) noexcept -> Entity::EventResult
 
     FO_VERIFY_AND_RETURN_VALUE(!_entity->IsDestroyed(), Entity::EventResult::ContinueChain, "Destroyed entity tried to fire an entity event", _entity->GetName(), _entity->GetTypeName(), _entity->GetId(), _callbackName);
 
-    nptr<vector<Entity::EventCallbackData>> callbacks = _callbacks.load(std::memory_order_acquire);
-    FO_STRONG_ASSERT(callbacks, "Entity event fired without cached callbacks", _callbackName);
-    return _entity->FireEvent(*callbacks, call);
+    auto callbacks = _entity->FindEventCallbacks(_eventId);
+    FO_STRONG_ASSERT(callbacks, "Entity event fired without callbacks", _callbackName);
+    return _entity->FireEvent(_eventId, *callbacks, call);
 }
 
 auto EntityEvent::CheckCallbacks() -> bool
@@ -513,16 +669,7 @@ auto EntityEvent::CheckCallbacks() -> bool
 
     FO_VERIFY_AND_RETURN_VALUE(!_entity->IsDestroyed(), false, "Destroyed entity tried to check callbacks for an event", _entity->GetName(), _entity->GetTypeName(), _entity->GetId(), _callbackName);
 
-    if (auto callbacks = _callbacks.load(std::memory_order_acquire); callbacks) {
-        return !callbacks->empty();
-    }
-
-    if (auto callbacks = _entity->FindEventCallbacks(_callbackName)) {
-        _callbacks.store(callbacks.get(), std::memory_order_release);
-        return !callbacks->empty();
-    }
-
-    return false;
+    return _entity->HasEventCallbacks(_eventId);
 }
 
 void EntityEvent::Subscribe(Entity::EventCallbackData&& callback)
@@ -531,7 +678,7 @@ void EntityEvent::Subscribe(Entity::EventCallbackData&& callback)
 
     FO_VERIFY_AND_THROW(!_entity->IsDestroyed(), "Entity event wrapper target is already destroyed");
 
-    _entity->SubscribeEvent(_callbackName, std::move(callback));
+    _entity->SubscribeEvent(_eventId, std::move(callback));
 }
 
 void EntityEvent::Unsubscribe(uintptr_t subscription_ptr) noexcept
@@ -540,7 +687,7 @@ void EntityEvent::Unsubscribe(uintptr_t subscription_ptr) noexcept
 
     FO_VERIFY_AND_RETURN(!_entity->IsDestroyed(), "Destroyed entity tried to unsubscribe an event callback", _entity->GetName(), _entity->GetTypeName(), _entity->GetId(), _callbackName, subscription_ptr);
 
-    _entity->UnsubscribeEvent(_callbackName, subscription_ptr);
+    _entity->UnsubscribeEvent(_eventId, subscription_ptr);
 }
 
 void EntityEvent::UnsubscribeAll() noexcept
@@ -549,8 +696,7 @@ void EntityEvent::UnsubscribeAll() noexcept
 
     FO_VERIFY_AND_RETURN(!_entity->IsDestroyed(), "Destroyed entity tried to unsubscribe all callbacks for an event", _entity->GetName(), _entity->GetTypeName(), _entity->GetId(), _callbackName);
 
-    _entity->UnsubscribeAllEvent(_callbackName);
-    _callbacks.store(nullptr, std::memory_order_release);
+    _entity->UnsubscribeAllEvent(_eventId);
 }
 
 Entity::~Entity() = default;
@@ -96,6 +96,7 @@ class EntityProperties
 };
 
 class TimeEventContext;
+class TimeEventManager;
 
 enum class EntityHolderEntrySync : uint8_t
 {
@@ -107,6 +108,7 @@ enum class EntityHolderEntrySync : uint8_t
 struct EntityEventDesc
 {
     string Name {};
+    uint32_t Id {}; // Interned at metadata registration, see Entity::RegisterEventName
     vector<ArgDesc> Args {};
     bool Exported {};
 };
@@ -134,6 +136,7 @@ struct EntityTypeDesc
 class Entity
 {
     friend class EntityEvent;
+    friend class TimeEventManager;
 
 public:
     using InnerEntityMap = map<hstring, vector<refcount_ptr<Entity>>>;
@@ -206,6 +209,7 @@ class Entity
     [[nodiscard]] auto GetInnerEntities(hstring entry) const noexcept -> nptr<const vector<refcount_ptr<Entity>>>;
     [[nodiscard]] auto GetInnerEntities(hstring entry) noexcept -> nptr<vector<refcount_ptr<Entity>>>;
     [[nodiscard]] auto HasEventCallbacks(string_view event_name) const noexcept -> bool;
+    [[nodiscard]] auto HasEventCallbacks(uint32_t event_id) const noexcept -> bool;
     [[nodiscard]] auto GetTimeEvents() const noexcept -> nptr<const TimeEventList> { return _timeEvents ? make_nptr(&*_timeEvents) : nullptr; }
     [[nodiscard]] auto GetTimeEvents() noexcept -> nptr<TimeEventList> { return _timeEvents ? make_nptr(&*_timeEvents) : nullptr; }
     [[nodiscard]] auto HasTimeEvents() const noexcept -> bool;
@@ -219,11 +223,15 @@ class Entity
     void SetValueAsAny(int32_t prop_index, const any_t& value);
     auto EnsureTimeEvents() -> ptr<TimeEventList>;
     void SubscribeEvent(string_view event_name, EventCallbackData&& callback);
+    void SubscribeEvent(uint32_t event_id, EventCallbackData&& callback);
     void UnsubscribeEvent(string_view event_name, uintptr_t subscription_ptr) noexcept;
+    void UnsubscribeEvent(uint32_t event_id, uintptr_t subscription_ptr) noexcept;
     void UnsubscribeAllEvent(string_view event_name) noexcept;
+    void UnsubscribeAllEvent(uint32_t event_id) noexcept;
     void UnsubscribeAllEvents() noexcept;
     void ClearAllTimeEvents() noexcept;
     auto FireEvent(string_view event_name, FuncCallData& call) noexcept -> EventResult;
+    auto FireEvent(uint32_t event_id, FuncCallData& call) noexcept -> EventResult;
     void AddInnerEntity(hstring entry, ptr<Entity> entity);
     void RemoveInnerEntity(hstring entry, ptr<Entity> entity);
     void ClearInnerEntities();
@@ -242,6 +250,13 @@ class Entity
     void MarkAsDestroying() noexcept;
     void MarkAsDestroyed() noexcept;
 
+    // Process-wide event name interning, callbacks are stored per entity in a flat table indexed by these ids
+    // String based api above is a compatibility layer that resolves names here, lookups never intern new names
+    // Id to name resolution is lock-free and meant for diagnostics; firing by id never touches names
+    static auto RegisterEventName(string_view event_name) -> uint32_t;
+    [[nodiscard]] static auto FindEventId(string_view event_name) noexcept -> optional<uint32_t>;
+    [[nodiscard]] static auto GetEventName(uint32_t event_id) noexcept -> string_view;
+
 protected:
     Entity(ptr<const PropertyRegistrar> registrar, nptr<const Properties> init_props, nptr<const Properties> base_props) noexcept;
     virtual ~Entity();
@@ -249,17 +264,18 @@ class Entity
     auto GetInitRef() noexcept -> ptr<Properties> { return &_props; }
 
 protected:
-    virtual auto FireEvent(const vector<EventCallbackData>& callbacks, FuncCallData& call) noexcept -> EventResult;
+    virtual auto FireEvent(uint32_t event_id, const vector<EventCallbackData>& callbacks, FuncCallData& call) noexcept -> EventResult;
 
 private:
-    auto FindEventCallbacks(string_view event_name) noexcept -> nptr<vector<EventCallbackData>>;
-    auto EnsureEventCallbacks(string_view event_name) -> ptr<vector<EventCallbackData>>;
+    auto FindEventCallbacks(uint32_t event_id) noexcept -> nptr<vector<EventCallbackData>>;
+    auto EnsureEventCallbacks(uint32_t event_id) -> ptr<vector<EventCallbackData>>;
     void SubscribeEvent(ptr<vector<EventCallbackData>> callbacks, EventCallbackData&& callback);
     void UnsubscribeEvent(ptr<vector<EventCallbackData>> callbacks, uintptr_t subscription_ptr) noexcept;
 
     Properties _props;
-    optional<map<string, vector<EventCallbackData>>> _events {};
+    optional<vector<pair<uint32_t, vector<EventCallbackData>>>> _events {}; // Subscribed event ids in ascending order
     optional<TimeEventList> _timeEvents {};
+    nptr<TimeEventManager> _timeEventMngr {}; // Manager whose deadline queue holds this entity, set while the list is queued
     optional<InnerEntityMap> _innerEntities {};
     std::atomic_bool _isDestroying {};
     std::atomic_bool _isDestroyed {};
@@ -280,21 +296,21 @@ class EntityEvent
     void UnsubscribeAll() noexcept;
 
 protected:
-    EntityEvent(ptr<Entity> entity, string_view callback_name) noexcept;
+    EntityEvent(ptr<Entity> entity, uint32_t event_id, string_view callback_name) noexcept;
     auto FireEvent(FuncCallData& call) noexcept -> Entity::EventResult;
     auto CheckCallbacks() -> bool;
 
     ptr<Entity> _entity;
+    uint32_t _eventId;
     string_view _callbackName;
-    std::atomic<vector<Entity::EventCallbackData>*> _callbacks {};
 };
 
 template<fixed_string Name, typename... Args>
 class EntityEventWrapper final : public EntityEvent
 {
 public:
-    explicit EntityEventWrapper(ptr<Entity> entity) noexcept :
-        EntityEvent(entity, Name.c_str())
+    explicit EntityEventWrapper(ptr<Entity> entity) :
+        EntityEvent(entity, GetEventId(), Name.c_str())
     {
     }
     EntityEventWrapper(const EntityEventWrapper&) = delete;
@@ -332,6 +348,14 @@ class EntityEventWrapper final : public EntityEvent
             return FireEvent(call);
         }
     }
+
+private:
+    // Interning may throw on the first call, so neither this nor the constructor is noexcept
+    static auto GetEventId() -> uint32_t
+    {
+        static const uint32_t event_id = Entity::RegisterEventName(Name.c_str());
+        return event_id;
+    }
 };
 
 class EntityManagerApi
@@ -165,6 +165,16 @@ auto File::GetStr() const -> string
     return result;
 }
 
+auto File::GetStrView() const -> string_view
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(_isLoaded, "Resource is not loaded");
+    FO_VERIFY_AND_THROW(_fileBuf, "Input file buffer is empty");
+
+    return string_view {_fileBuf.reinterpret_as<const char>().get(), _fileSize};
+}
+
 auto File::GetData() const -> vector<uint8_t>
 {
     FO_STACK_TRACE_ENTRY();
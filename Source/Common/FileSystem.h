@@ -138,6 +138,7 @@ class File final : public FileHeader
     ~File() = default;
 
     [[nodiscard]] auto GetStr() const -> string;
+    [[nodiscard]] auto GetStrView() const -> string_view;
     [[nodiscard]] auto GetData() const -> vector<uint8_t>;
     [[nodiscard]] auto GetDataSpan() const -> const_span<uint8_t>;
     [[nodiscard]] auto GetReader() const -> FileReader;
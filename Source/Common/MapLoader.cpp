@@ -39,13 +39,114 @@ FO_BEGIN_NAMESPACE
 
 static constexpr string_view MAP_ANCHOR_SECTION = "ProtoMap";
 static constexpr string_view CONTEXT_PREFIX = "$Name";
+static constexpr string_view MAP_NAME_CATALOG_HEADER = "FONLINE_MAP_NAME_CATALOG_V1\n";
 
-void MapLoader::Load(string_view name, string_view file_name, const string& buf, const EngineMetadata& meta, HashResolver& hash_resolver, const CrLoadFunc& cr_load, const ItemLoadFunc& item_load)
+// A section is kept as the byte range of its body, so key/values are tokenized only for sections a caller needs
+struct MapTextSection
+{
+    string_view Name {};
+    size_t BodyBegin {};
+    size_t BodyEnd {};
+};
+
+// Walks lines with the config grammar but looks only at section lines; a body never runs into the next section
+// line because a continuation would have made that line content
+static auto ScanMapTextSections(string_view text, list<string>& owned_strings) -> vector<MapTextSection>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    vector<MapTextSection> sections;
+    ConfigLineReader line_reader {text};
+
+    while (line_reader.ReadLine()) {
+        string_view line = line_reader.GetLine();
+
+        if (line.front() != '[') {
+            continue;
+        }
+
+        string_view section_name = ConfigFile::ParseSectionNameLine(line);
+
+        if (section_name.empty()) {
+            continue;
+        }
+
+        if (!sections.empty()) {
+            sections.back().BodyEnd = line_reader.GetLineOffset();
+        }
+
+        if (!line_reader.IsLineStable()) {
+            section_name = owned_strings.emplace_back(section_name);
+        }
+
+        sections.emplace_back(MapTextSection {.Name = section_name, .BodyBegin = line_reader.GetNextOffset(), .BodyEnd = text.length()});
+    }
+
+    return sections;
+}
+
+// Fills kv exactly as ConfigFile fills a section; values view the text unless they come from joined lines or appends
+static void ReadMapTextSection(string_view text, const MapTextSection& section, map<string_view, string_view>& kv, list<string>& owned_strings)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    kv.clear();
+
+    ConfigLineReader line_reader {text.substr(section.BodyBegin, section.BodyEnd - section.BodyBegin)};
+
+    while (line_reader.ReadLine()) {
+        string_view line = line_reader.GetLine();
+
+        // Malformed section lines are dropped
+        if (line.front() == '[') {
+            continue;
+        }
+
+        string_view key;
+        string_view value;
+        bool append_value = false;
+
+        if (!ConfigFile::ParseConfigKeyValueLine(line, key, value, append_value)) {
+            continue;
+        }
+
+        if (!line_reader.IsLineStable()) {
+            key = owned_strings.emplace_back(key);
+            value = owned_strings.emplace_back(value);
+        }
+
+        auto existing_it = append_value ? kv.find(key) : kv.end();
+
+        if (existing_it != kv.end()) {
+            if (!value.empty()) {
+                existing_it->second = owned_strings.emplace_back(strex("{} {}", existing_it->second, value).str());
+            }
+        }
+        else {
+            kv[key] = value;
+        }
+    }
+}
+
+static auto ResolveAnchorName(string_view text, const MapTextSection& anchor, string_view file_stem, list<string>& owned_strings) -> string_view
 {
     FO_STACK_TRACE_ENTRY();
 
-    // Load from file
-    ConfigFile map_data(buf);
+    map<string_view, string_view> anchor_kv;
+    ReadMapTextSection(text, anchor, anchor_kv, owned_strings);
+
+    auto anchor_name_it = anchor_kv.find("$Name");
+    return anchor_name_it != anchor_kv.end() ? anchor_name_it->second : file_stem;
+}
+
+void MapLoader::Load(string_view name, string_view file_name, string_view buf, const EngineMetadata& meta, HashResolver& hash_resolver, const CrLoadFunc& cr_load, const ItemLoadFunc& item_load)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Only section lines are scanned up front, entity sections are tokenized right before their callback and
+    // sections addressed to other maps of the file are never tokenized at all
+    list<string> owned_strings;
+    vector<MapTextSection> sections = ScanMapTextSections(buf, owned_strings);
 
     // A [ProtoMap] anchor owns the nested sections that follow it, so a nested prefix is either the
     // CONTEXT_PREFIX token for that anchor or an explicit map name
@@ -55,7 +156,7 @@ void MapLoader::Load(string_view name, string_view file_name, const string& buf,
     {
         string_view Owner {};
         string_view Type {};
-        ptr<map<string_view, string_view>> KeyValues;
+        ptr<const MapTextSection> Section;
     };
 
     vector<string_view> anchor_names;
@@ -63,11 +164,8 @@ void MapLoader::Load(string_view name, string_view file_name, const string& buf,
     string_view cur_anchor_name;
     bool has_anchor = false;
 
-    for (const auto& [section_name, section_kv] : map_data.GetOrderedSections()) {
-        if (section_name.empty()) {
-            continue;
-        }
-
+    for (const auto& section : sections) {
+        string_view section_name = section.Name;
         size_t slash_pos = section_name.find('/');
 
         if (slash_pos == string_view::npos) {
@@ -75,8 +173,7 @@ void MapLoader::Load(string_view name, string_view file_name, const string& buf,
                 throw MapLoaderException("Invalid map file section, expected a ProtoMap anchor or nested map content", section_name, name, file_name);
             }
 
-            auto anchor_name_it = section_kv->find("$Name");
-            cur_anchor_name = anchor_name_it != section_kv->end() ? anchor_name_it->second : string_view {file_stem};
+            cur_anchor_name = ResolveAnchorName(buf, section, file_stem, owned_strings);
             has_anchor = true;
             anchor_names.emplace_back(cur_anchor_name);
             continue;
@@ -94,10 +191,10 @@ void MapLoader::Load(string_view name, string_view file_name, const string& buf,
                 throw MapLoaderException("Nested map section appears before any ProtoMap anchor", section_name, name, file_name);
             }
 
-            nested_sections.emplace_back(NestedMapSection {cur_anchor_name, nested_type, section_kv});
+            nested_sections.emplace_back(NestedMapSection {cur_anchor_name, nested_type, &section});
         }
         else {
-            nested_sections.emplace_back(NestedMapSection {prefix, nested_type, section_kv});
+            nested_sections.emplace_back(NestedMapSection {prefix, nested_type, &section});
         }
     }
 
@@ -114,16 +211,16 @@ void MapLoader::Load(string_view name, string_view file_name, const string& buf,
         }
     }
 
-    auto collect_map_sections = [&](string_view nested_type) -> vector<ptr<map<string_view, string_view>>> {
-        vector<ptr<map<string_view, string_view>>> sections;
+    auto collect_map_sections = [&](string_view nested_type) -> vector<ptr<const MapTextSection>> {
+        vector<ptr<const MapTextSection>> map_sections;
 
         for (const auto& nested_section : nested_sections) {
             if (nested_section.Owner == name && nested_section.Type == nested_type) {
-                sections.emplace_back(nested_section.KeyValues);
+                map_sections.emplace_back(nested_section.Section);
             }
         }
 
-        return sections;
+        return map_sections;
     };
 
     size_t errors = 0;
@@ -148,19 +245,21 @@ void MapLoader::Load(string_view name, string_view file_name, const string& buf,
         return ident_t {id};
     };
 
+    map<string_view, string_view> kv;
+
     // Critters
-    for (const auto& pkv : collect_map_sections("Critter")) {
-        auto kv = pkv;
-        auto proto_it = kv->find("$Proto");
+    for (const auto& section : collect_map_sections("Critter")) {
+        ReadMapTextSection(buf, *section, kv, owned_strings);
+        auto proto_it = kv.find("$Proto");
 
-        if (proto_it == kv->end()) {
+        if (proto_it == kv.end()) {
             WriteLog(LogType::Warning, "Proto critter invalid data");
             errors++;
             continue;
         }
 
-        auto id_it = kv->find("$Id");
-        ident_t id = process_id(id_it != kv->end() ? strex(id_it->second).to_int64() : 0);
+        auto id_it = kv.find("$Id");
+        ident_t id = process_id(id_it != kv.end() ? strex(id_it->second).to_int64() : 0);
         const auto& proto_name = proto_it->second;
         hstring hashed_proto_name = hash_resolver.ToHashedString(proto_name);
         auto proto = meta.GetProtoCritter(hashed_proto_name);
@@ -171,7 +270,7 @@ void MapLoader::Load(string_view name, string_view file_name, const string& buf,
         }
         else {
             try {
-                cr_load(id, proto, kv);
+                cr_load(id, proto, &kv);
             }
             catch (const std::exception& ex) {
                 WriteLog(LogType::Warning, "Unable to load critter '{}'", proto_name);
@@ -182,18 +281,18 @@ void MapLoader::Load(string_view name, string_view file_name, const string& buf,
     }
 
     // Items
-    for (const auto& pkv : collect_map_sections("Item")) {
-        auto kv = pkv;
-        auto proto_it = kv->find("$Proto");
+    for (const auto& section : collect_map_sections("Item")) {
+        ReadMapTextSection(buf, *section, kv, owned_strings);
+        auto proto_it = kv.find("$Proto");
 
-        if (proto_it == kv->end()) {
+        if (proto_it == kv.end()) {
             WriteLog(LogType::Warning, "Proto item invalid data");
             errors++;
             continue;
         }
 
-        auto id_it = kv->find("$Id");
-        ident_t id = process_id(id_it != kv->end() ? strex(id_it->second).to_int64() : 0);
+        auto id_it = kv.find("$Id");
+        ident_t id = process_id(id_it != kv.end() ? strex(id_it->second).to_int64() : 0);
         const auto& proto_name = proto_it->second;
         hstring hashed_proto_name = hash_resolver.ToHashedString(proto_name);
         auto proto = meta.GetProtoItem(hashed_proto_name);
@@ -204,7 +303,7 @@ void MapLoader::Load(string_view name, string_view file_name, const string& buf,
         }
         else {
             try {
-                item_load(id, proto, kv);
+                item_load(id, proto, &kv);
             }
             catch (const std::exception& ex) {
                 WriteLog(LogType::Warning, "Unable to load item '{}'", proto_name);
@@ -221,19 +320,27 @@ void MapLoader::Load(string_view name, string_view file_name, const string& buf,
 
 // Doubles as the map-file detector, since map files are recognized by their [ProtoMap] anchors rather
 // than by an extension: an empty result means the file is not a map container
-auto MapLoader::EnumerateMaps(string_view file_name, const string& buf) -> vector<string>
+auto MapLoader::EnumerateMaps(string_view file_name, string_view buf) -> vector<string>
 {
     FO_STACK_TRACE_ENTRY();
 
-    auto map_data = ConfigFile(buf, ConfigFileOption::SkipNestedSections);
-    auto anchor_sections = map_data.GetSections(MAP_ANCHOR_SECTION);
+    // Every anchor spells the section name out on one line, so a text without it declares nothing
+    if (buf.find(MAP_ANCHOR_SECTION) == string_view::npos) {
+        return {};
+    }
+
+    list<string> owned_strings;
+    vector<MapTextSection> sections = ScanMapTextSections(buf, owned_strings);
+    string file_stem = strex(file_name).extract_file_name().erase_file_extension().str();
 
     vector<string> map_names;
-    map_names.reserve(anchor_sections.size());
 
-    for (const auto& anchor_kv : anchor_sections) {
-        auto anchor_name_it = anchor_kv->find("$Name");
-        string map_name = anchor_name_it != anchor_kv->end() ? string(anchor_name_it->second) : strex(file_name).extract_file_name().erase_file_extension().str();
+    for (const auto& section : sections) {
+        if (section.Name != MAP_ANCHOR_SECTION) {
+            continue;
+        }
+
+        string map_name {ResolveAnchorName(buf, section, file_stem, owned_strings)};
 
         // Several anchors without $Name all resolve to the file stem; enumerating the id once is
         // enough — the duplicate itself is reported by the generic proto collision check on bake
@@ -245,4 +352,164 @@ auto MapLoader::EnumerateMaps(string_view file_name, const string& buf) -> vecto
     return map_names;
 }
 
+// Path and names are saved tab separated on one line, so only values that survive that round trip are persisted
+static auto IsMapNameCatalogToken(string_view value) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    return !value.empty() && value.find_first_of("\t\r\n") == string_view::npos && strvex(value).trim().strv() == value;
+}
+
+auto MapNameCatalog::FindEntry(const FileHeader& file_header) const -> nptr<const Entry>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (file_header.GetWriteTime() == 0) {
+        return nullptr;
+    }
+
+    auto it = _entries.find(file_header.GetPath());
+
+    if (it == _entries.end() || it->second.Size != file_header.GetSize() || it->second.WriteTime != file_header.GetWriteTime()) {
+        return nullptr;
+    }
+
+    return &it->second;
+}
+
+auto MapNameCatalog::StoreEntry(const FileHeader& file_header, vector<string> map_names) -> vector<string>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (file_header.GetWriteTime() == 0) {
+        return map_names;
+    }
+
+    _entries[string {file_header.GetPath()}] = Entry {.Size = file_header.GetSize(), .WriteTime = file_header.GetWriteTime(), .MapNames = map_names};
+    _changed = true;
+    return map_names;
+}
+
+auto MapNameCatalog::GetMapNames(const FileHeader& file_header) -> vector<string>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (auto entry = FindEntry(file_header)) {
+        return entry->MapNames;
+    }
+
+    return GetMapNames(File::Load(file_header));
+}
+
+auto MapNameCatalog::GetMapNames(const File& file) -> vector<string>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (auto entry = FindEntry(file)) {
+        return entry->MapNames;
+    }
+
+    return StoreEntry(file, MapLoader::EnumerateMaps(file.GetPath(), file.GetStrView()));
+}
+
+void MapNameCatalog::Forget(string_view path)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (auto it = _entries.find(path); it != _entries.end()) {
+        _entries.erase(it);
+        _changed = true;
+    }
+}
+
+void MapNameCatalog::RetainPaths(const unordered_set<string>& paths)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    for (auto it = _entries.begin(); it != _entries.end();) {
+        if (!paths.contains(it->first)) {
+            it = _entries.erase(it);
+            _changed = true;
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+void MapNameCatalog::LoadFromText(string_view text)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // A damaged table is dropped as a whole and rebuilt by the next lookups
+    _entries.clear();
+    _changed = false;
+
+    if (!text.starts_with(MAP_NAME_CATALOG_HEADER)) {
+        return;
+    }
+
+    map<string, Entry> entries;
+    size_t line_begin = MAP_NAME_CATALOG_HEADER.length();
+
+    while (line_begin < text.length()) {
+        size_t line_end = text.find('\n', line_begin);
+
+        if (line_end == string_view::npos) {
+            return;
+        }
+
+        string_view line = text.substr(line_begin, line_end - line_begin);
+        line_begin = line_end + 1;
+
+        // Path, size, write time, then the declared map names
+        vector<string_view> fields = strvex(line).split('\t');
+
+        if (fields.size() < 3 || !strvex(fields[1]).is_number() || !strvex(fields[2]).is_number()) {
+            return;
+        }
+
+        auto size = strvex(fields[1]).to_int64();
+        auto write_time = strvex(fields[2]).to_int64();
+
+        if (size < 0 || write_time <= 0) {
+            return;
+        }
+
+        Entry entry {.Size = numeric_cast<size_t>(size), .WriteTime = numeric_cast<uint64_t>(write_time)};
+
+        for (size_t i = 3; i < fields.size(); i++) {
+            entry.MapNames.emplace_back(fields[i]);
+        }
+
+        entries[string {fields[0]}] = std::move(entry);
+    }
+
+    _entries = std::move(entries);
+}
+
+auto MapNameCatalog::SaveToText() const -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    string text {MAP_NAME_CATALOG_HEADER};
+
+    for (const auto& [path, entry] : _entries) {
+        if (!IsMapNameCatalogToken(path) || !std::ranges::all_of(entry.MapNames, [](const string& map_name) { return IsMapNameCatalogToken(map_name); })) {
+            continue;
+        }
+
+        text += strex("{}\t{}\t{}", path, entry.Size, entry.WriteTime);
+
+        for (const auto& map_name : entry.MapNames) {
+            text += '\t';
+            text += map_name;
+        }
+
+        text += '\n';
+    }
+
+    return text;
+}
+
 FO_END_NAMESPACE
@@ -37,6 +37,7 @@
 
 #include "ConfigFile.h"
 #include "EntityProtos.h"
+#include "FileSystem.h"
 
 FO_BEGIN_NAMESPACE
 
@@ -52,8 +53,49 @@ class MapLoader final
 
     MapLoader() = delete;
 
-    static void Load(string_view name, string_view file_name, const string& buf, const EngineMetadata& meta, HashResolver& hash_resolver, const CrLoadFunc& cr_load, const ItemLoadFunc& item_load);
-    static auto EnumerateMaps(string_view file_name, const string& buf) -> vector<string>;
+    // Entity sections are tokenized straight from buf one at a time, kv is only valid during the callback
+    static void Load(string_view name, string_view file_name, string_view buf, const EngineMetadata& meta, HashResolver& hash_resolver, const CrLoadFunc& cr_load, const ItemLoadFunc& item_load);
+    static auto EnumerateMaps(string_view file_name, string_view buf) -> vector<string>;
+};
+
+// Remembers which maps every container file declares, so a lookup reads and scans only files whose size or write
+// time changed since the last one. Files without a write time are always scanned. The table round-trips as text
+// for tools that keep it between runs
+class MapNameCatalog final
+{
+public:
+    MapNameCatalog() = default;
+    MapNameCatalog(const MapNameCatalog&) = delete;
+    MapNameCatalog(MapNameCatalog&&) noexcept = default;
+    auto operator=(const MapNameCatalog&) = delete;
+    auto operator=(MapNameCatalog&&) noexcept -> MapNameCatalog& = default;
+    ~MapNameCatalog() = default;
+
+    [[nodiscard]] auto IsChanged() const noexcept -> bool { return _changed; }
+    [[nodiscard]] auto GetEntriesCount() const noexcept -> size_t { return _entries.size(); }
+    [[nodiscard]] auto GetMapNames(const FileHeader& file_header) -> vector<string>;
+    [[nodiscard]] auto GetMapNames(const File& file) -> vector<string>;
+    [[nodiscard]] auto SaveToText() const -> string;
+
+    void Forget(string_view path);
+    void RetainPaths(const unordered_set<string>& paths);
+    void LoadFromText(string_view text);
+    void MarkSaved() noexcept { _changed = false; }
+
+private:
+    struct Entry
+    {
+        size_t Size {};
+        uint64_t WriteTime {};
+        vector<string> MapNames {};
+    };
+
+    [[nodiscard]] auto FindEntry(const FileHeader& file_header) const -> nptr<const Entry>;
+
+    auto StoreEntry(const FileHeader& file_header, vector<string> map_names) -> vector<string>;
+
+    map<string, Entry> _entries {}; // Ordered by path so the saved text is stable
+    bool _changed {};
 };
 
 FO_END_NAMESPACE
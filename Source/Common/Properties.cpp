@@ -168,11 +168,17 @@ void Property::AddSetter(PropertySetCallback setter) const
     _setters.emplace(_setters.begin(), std::move(setter));
 }
 
-void Property::AddPostSetter(PropertyPostSetCallback setter) const
+void Property::AddPostSetter(PropertyPostSetCallback setter, bool leading) const
 {
     FO_STACK_TRACE_ENTRY();
 
-    _postSetters.emplace(_postSetters.begin(), std::move(setter));
+    if (leading) {
+        _postSetters.emplace(_postSetters.begin(), std::move(setter));
+        _leadingPostSetters++;
+    }
+    else {
+        _postSetters.emplace(_postSetters.begin() + numeric_cast<ptrdiff_t>(_leadingPostSetters), std::move(setter));
+    }
 }
 
 Properties::Properties(ptr<const PropertyRegistrar> registrar, nptr<const Properties> base) noexcept :
@@ -751,6 +757,52 @@ void Properties::RebuildOverlayFromFullData(const Properties& other) noexcept
     _storeDataRevision++;
 }
 
+void Properties::AttachSnapshotSlot(shared_ptr<PropertiesSnapshotSlot> slot) noexcept
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // A previous snapshot that still reads this data gets its copy now, before the slot is taken over
+    if (_snapshotSlot) {
+        _snapshotSlot->PreserveBeforeChange(*this);
+    }
+
+    _snapshotSlot = std::move(slot);
+}
+
+void Properties::PreserveForSnapshot() noexcept
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _snapshotSlot->PreserveBeforeChange(*this);
+    _snapshotSlot.reset();
+}
+
+void PropertiesSnapshotSlot::PreserveBeforeChange(const Properties& live_props) noexcept
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (!IsPending()) {
+        return;
+    }
+
+    scoped_lock locker {_lock};
+
+    if (IsPending()) {
+        _preserved.emplace(live_props.Copy());
+        _pending.store(false, std::memory_order_release);
+    }
+}
+
+void PropertiesSnapshotSlot::Release() noexcept
+{
+    FO_STACK_TRACE_ENTRY();
+
+    scoped_lock locker {_lock};
+
+    _pending.store(false, std::memory_order_release);
+    _preserved.reset();
+}
+
 auto Properties::Copy() const noexcept -> Properties
 {
     FO_STACK_TRACE_ENTRY();
@@ -764,6 +816,8 @@ void Properties::CopyFrom(const Properties& other) noexcept
 {
     FO_STACK_TRACE_ENTRY();
 
+    BeforeDataChange();
+
     FO_STRONG_ASSERT(_registrar == other._registrar, "Properties registrar mismatch in copy", _registrar->GetTypeName(), other._registrar->GetTypeName());
 
     if ((!_baseProps && !other._baseProps) || (_baseProps && _baseProps == other._baseProps)) {
@@ -927,6 +981,8 @@ void Properties::RestoreAllData(const vector<uint8_t>& all_data)
 {
     FO_STACK_TRACE_ENTRY();
 
+    BeforeDataChange();
+
     auto reader = DataReader(all_data);
     auto whole_pod_data_size = reader.Read<uint32_t>();
     FO_VERIFY_AND_THROW(whole_pod_data_size == _registrar->_wholePodDataSize, "Serialized POD property block was baked for a different property layout", _registrar->GetTypeName(), whole_pod_data_size, _registrar->_wholePodDataSize);
@@ -1084,6 +1140,8 @@ void Properties::RestoreData(const vector<nptr<const uint8_t>>& all_data, const
 {
     FO_STACK_TRACE_ENTRY();
 
+    BeforeDataChange();
+
     FO_VERIFY_AND_THROW(all_data.size() == all_data_sizes.size(), "Serialized property payload pointer list and size list have different lengths", _registrar->GetTypeName(), all_data.size(), all_data_sizes.size());
 
     auto read_raw_data_span = [](nptr<const uint8_t> data, size_t size) noexcept -> span<const uint8_t> {
@@ -1589,6 +1647,8 @@ void Properties::SetRawData(ptr<const Property> prop, span<const uint8_t> raw_da
 {
     FO_STACK_TRACE_ENTRY();
 
+    BeforeDataChange();
+
     FO_STRONG_ASSERT(_registrar == prop->_registrar, "Invalid property for raw data write", _registrar->GetTypeName(), string_view {prop->GetName()}, prop->_registrar->GetTypeName());
     FO_STRONG_ASSERT(!prop->IsPlainData() || prop->GetBaseSize() == raw_data.size(), "Plain property raw data write size mismatch", prop->GetName(), _registrar->GetTypeName(), prop->GetBaseSize(), raw_data.size());
 
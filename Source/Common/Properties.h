@@ -45,6 +45,7 @@ class Entity;
 class Property;
 class PropertyRegistrar;
 class Properties;
+class PropertiesSnapshotSlot;
 
 class PropertyRawData
 {
@@ -205,7 +206,8 @@ class Property final
 
     void SetGetter(PropertyGetCallback getter) const;
     void AddSetter(PropertySetCallback setter) const;
-    void AddPostSetter(PropertyPostSetCallback setter) const;
+    // Post-setters run from the last added to the first; leading ones run ahead of all others, even ones added later
+    void AddPostSetter(PropertyPostSetCallback setter, bool leading = false) const;
 
 private:
     explicit Property(ptr<const PropertyRegistrar> registrar);
@@ -215,6 +217,7 @@ class Property final
     mutable PropertyGetCallback _getter {};
     mutable vector<PropertySetCallback> _setters {};
     mutable vector<PropertyPostSetCallback> _postSetters {};
+    mutable size_t _leadingPostSetters {};
 
     string _propName {};
     string _propNameWithoutComponent {};
@@ -320,6 +323,7 @@ class Properties final
 
     void AllocData() noexcept;
     void SetEntity(ptr<Entity> entity) const noexcept { _entity = entity; }
+    void AttachSnapshotSlot(shared_ptr<PropertiesSnapshotSlot> slot) noexcept;
     void CopyFrom(const Properties& other) noexcept;
     void ValidateForRawData(ptr<const Property> prop) const noexcept(false);
     void ApplyFromText(const map<string, string>& key_values);
@@ -411,6 +415,14 @@ class Properties final
     auto MakeOverlayPackOrder() const noexcept -> vector<size_t>;
     auto IsRawDataEqual(ptr<const Property> prop, span<const uint8_t> raw_data) const noexcept -> bool;
     static void ValidateFiniteRawData(ptr<const Property> prop, span<const uint8_t> raw_data);
+    void PreserveForSnapshot() noexcept;
+
+    FO_FORCE_INLINE void BeforeDataChange() noexcept
+    {
+        if (_snapshotSlot) [[unlikely]] {
+            PreserveForSnapshot();
+        }
+    }
 
     ptr<const PropertyRegistrar> _registrar;
     nptr<const Properties> _baseProps {};
@@ -428,6 +440,47 @@ class Properties final
     uint32_t _storeDataRevision {1};
     mutable optional<StoreDataCache> _storeDataCaches[2] {};
     mutable nptr<Entity> _entity {};
+    shared_ptr<PropertiesSnapshotSlot> _snapshotSlot {}; // Attached only while every writer is stopped
+};
+
+// Copy-on-write share of one Properties in a snapshot serialized on another thread. The first data change after
+// the snapshot preserves the snapshot-time data; if none happens, the reader uses the live data in place
+class PropertiesSnapshotSlot final
+{
+public:
+    PropertiesSnapshotSlot() = default;
+    PropertiesSnapshotSlot(const PropertiesSnapshotSlot&) = delete;
+    PropertiesSnapshotSlot(PropertiesSnapshotSlot&&) noexcept = delete;
+    auto operator=(const PropertiesSnapshotSlot&) = delete;
+    auto operator=(PropertiesSnapshotSlot&&) noexcept = delete;
+    ~PropertiesSnapshotSlot() = default;
+
+    [[nodiscard]] auto IsPending() const noexcept -> bool { return _pending.load(std::memory_order_acquire); }
+
+    void PreserveBeforeChange(const Properties& live_props) noexcept;
+    void Release() noexcept;
+
+    // Data changes of the live properties wait until the reader returns; the slot is released afterwards
+    template<typename T>
+    auto Read(const Properties& live_props, const T& reader) -> decltype(reader(live_props))
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        scoped_lock locker {_lock};
+
+        FO_VERIFY_AND_THROW(IsPending() || _preserved.has_value(), "Properties snapshot slot is already released");
+        auto result = _preserved.has_value() ? reader(std::as_const(_preserved.value())) : reader(live_props);
+
+        _pending.store(false, std::memory_order_release);
+        _preserved.reset();
+
+        return result;
+    }
+
+private:
+    mutex _lock {};
+    std::atomic_bool _pending {true};
+    optional<Properties> _preserved FO_TSA_GUARDED_BY(_lock) {};
 };
 
 class PropertyRegistrar final
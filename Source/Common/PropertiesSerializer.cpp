@@ -38,14 +38,13 @@ FO_BEGIN_NAMESPACE
 
 static auto RawBytesEqual(span<const uint8_t> lhs, span<const uint8_t> rhs) -> bool;
 
-auto PropertiesSerializer::SaveToDocument(ptr<const Properties> props, nptr<const Properties> base, HashResolver& hash_resolver, NameResolver& name_resolver) -> AnyData::Document
+template<typename T>
+static void ForEachSavedProperty(ptr<const Properties> props, nptr<const Properties> base, const T& callback)
 {
     FO_STACK_TRACE_ENTRY();
 
     FO_VERIFY_AND_THROW(!base || props->GetRegistrar() == base->GetRegistrar(), "Serialized properties use a different base registrar");
 
-    AnyData::Document doc;
-
     for (size_t i = 1; i < props->GetRegistrar()->GetPropertiesCount(); i++) {
         auto prop = props->GetRegistrar()->GetPropertyByIndex(numeric_cast<int32_t>(i));
         FO_VERIFY_AND_THROW(prop, "Property is null");
@@ -83,13 +82,53 @@ auto PropertiesSerializer::SaveToDocument(ptr<const Properties> props, nptr<cons
             }
         }
 
+        callback(prop);
+    }
+}
+
+static auto FindLoadedProperty(ptr<const Properties> props, string_view doc_key) -> nptr<const Property>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Skip technical fields
+    if (doc_key.empty() || doc_key[0] == '$' || doc_key[0] == '_') {
+        return nullptr;
+    }
+
+    auto prop = props->GetRegistrar()->FindProperty(doc_key);
+
+    if (!prop || prop->IsDisabled() || !prop->IsPersistent()) {
+        // WriteLog(LogType::Warning, "Skip unknown property {}", key);
+        return nullptr;
+    }
+
+    return prop;
+}
+
+auto PropertiesSerializer::SaveToDocument(ptr<const Properties> props, nptr<const Properties> base, HashResolver& hash_resolver, NameResolver& name_resolver) -> AnyData::Document
+{
+    FO_STACK_TRACE_ENTRY();
+
+    AnyData::Document doc;
+
+    ForEachSavedProperty(props, base, [&](auto prop) {
         auto value = SavePropertyToValue(props, prop, hash_resolver, name_resolver);
         doc.Emplace(string {prop->GetName()}, std::move(value));
-    }
+    });
 
     return doc;
 }
 
+void PropertiesSerializer::SaveToPackedDocument(ptr<const Properties> props, nptr<const Properties> base, AnyData::PackedDocumentBuilder& builder, HashResolver& hash_resolver, NameResolver& name_resolver)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    ForEachSavedProperty(props, base, [&](auto prop) {
+        // Each value goes straight into the packed buffer, there is no document to collect them in
+        builder.Add(prop->GetName(), SavePropertyToValue(props, prop, hash_resolver, name_resolver));
+    });
+}
+
 auto PropertiesSerializer::LoadFromDocument(ptr<Properties> props, const AnyData::Document& doc, HashResolver& hash_resolver, NameResolver& name_resolver) noexcept -> bool
 {
     FO_STACK_TRACE_ENTRY();
@@ -99,21 +138,10 @@ auto PropertiesSerializer::LoadFromDocument(ptr<Properties> props, const AnyData
     bool is_error = false;
 
     for (auto&& [doc_key, doc_value] : doc) {
-        // Skip technical fields
-        if (doc_key.empty() || doc_key[0] == '$' || doc_key[0] == '_') {
-            continue;
-        }
-
         try {
-            // Find property
-            auto prop = props->GetRegistrar()->FindProperty(doc_key);
-
-            if (prop && !prop->IsDisabled() && prop->IsPersistent()) {
+            if (auto prop = FindLoadedProperty(props, doc_key)) {
                 LoadPropertyFromValue(props, prop, doc_value, hash_resolver, name_resolver);
             }
-            else {
-                // WriteLog(LogType::Warning, "Skip unknown property {}", key);
-            }
         }
         catch (const std::exception& ex) {
             WriteLog(LogType::Warning, "Unable to load property {}: {}", doc_key, ex.what());
@@ -124,6 +152,40 @@ auto PropertiesSerializer::LoadFromDocument(ptr<Properties> props, const AnyData
     return !is_error;
 }
 
+auto PropertiesSerializer::LoadFromPackedDocument(ptr<Properties> props, const AnyData::PackedDocumentView& doc, HashResolver& hash_resolver, NameResolver& name_resolver) noexcept -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_STRONG_ASSERT(props.get(), "Missing required properties to load into");
+
+    bool is_error = false;
+
+    try {
+        const size_t count = doc.Size();
+
+        for (size_t i = 0; i < count; i++) {
+            const string_view doc_key = doc.GetKey(i);
+
+            try {
+                // Only values of known properties are unpacked, one at a time
+                if (auto prop = FindLoadedProperty(props, doc_key)) {
+                    LoadPropertyFromValue(props, prop, doc.GetValue(i).ToValue(), hash_resolver, name_resolver);
+                }
+            }
+            catch (const std::exception& ex) {
+                WriteLog(LogType::Warning, "Unable to load property {}: {}", doc_key, ex.what());
+                is_error = true;
+            }
+        }
+    }
+    catch (const std::exception& ex) {
+        WriteLog(LogType::Warning, "Unable to read packed properties document: {}", ex.what());
+        is_error = true;
+    }
+
+    return !is_error;
+}
+
 auto PropertiesSerializer::SavePropertyToValue(ptr<const Properties> props, ptr<const Property> prop, HashResolver& hash_resolver, NameResolver& name_resolver) -> AnyData::Value
 {
     FO_STACK_TRACE_ENTRY();
@@ -49,6 +49,8 @@ class PropertiesSerializer final
 
     [[nodiscard]] static auto SaveToDocument(ptr<const Properties> props, nptr<const Properties> base, HashResolver& hash_resolver, NameResolver& name_resolver) -> AnyData::Document;
     [[nodiscard]] static auto LoadFromDocument(ptr<Properties> props, const AnyData::Document& doc, HashResolver& hash_resolver, NameResolver& name_resolver) noexcept -> bool;
+    static void SaveToPackedDocument(ptr<const Properties> props, nptr<const Properties> base, AnyData::PackedDocumentBuilder& builder, HashResolver& hash_resolver, NameResolver& name_resolver);
+    [[nodiscard]] static auto LoadFromPackedDocument(ptr<Properties> props, const AnyData::PackedDocumentView& doc, HashResolver& hash_resolver, NameResolver& name_resolver) noexcept -> bool;
     [[nodiscard]] static auto SavePropertyToValue(ptr<const Properties> props, ptr<const Property> prop, HashResolver& hash_resolver, NameResolver& name_resolver) -> AnyData::Value;
     [[nodiscard]] static auto SavePropertyToValue(ptr<const Property> prop, const_span<uint8_t> raw_data, HashResolver& hash_resolver, NameResolver& name_resolver) -> AnyData::Value;
     [[nodiscard]] static auto SavePropertyToText(ptr<const Properties> props, ptr<const Property> prop, HashResolver& hash_resolver, NameResolver& name_resolver) -> string;
@@ -106,7 +106,55 @@ auto ProtoManager::CreateProto(hstring type_name, hstring pid, nptr<const Proper
     return proto;
 }
 
-void ProtoManager::LoadFromResources(const FileSystem& resources)
+// Runs the job for every index on up to thread_count threads, the calling one included. Indices are handed out in
+// ascending order and a failure rethrows the error of the lowest failed index, the one a serial loop stops at
+static void ForEachIndexParallel(string_view task_name, size_t count, size_t thread_count, const function<void(size_t)>& job)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const size_t workers_count = std::max(std::min(thread_count, count), size_t {1});
+    std::atomic_size_t next_index {};
+    std::atomic_size_t first_failed_index {count};
+    vector<pair<size_t, std::exception_ptr>> errors(workers_count, {count, nullptr});
+
+    auto run_jobs = [&](size_t worker_index) noexcept {
+        for (size_t i = next_index++; i < count && i < first_failed_index; i = next_index++) {
+            try {
+                job(i);
+            }
+            catch (...) {
+                errors[worker_index] = {i, std::current_exception()};
+                auto failed_index = first_failed_index.load();
+
+                while (i < failed_index && !first_failed_index.compare_exchange_weak(failed_index, i)) {
+                }
+
+                return;
+            }
+        }
+    };
+
+    vector<std::future<void>> helpers;
+    helpers.reserve(workers_count - 1);
+
+    for (size_t i = 1; i < workers_count; i++) {
+        helpers.emplace_back(run_async(launch_async_and_deferred, task_name, [&run_jobs, i]() FO_DEFERRED { run_jobs(i); }));
+    }
+
+    run_jobs(0);
+
+    for (auto& helper : helpers) {
+        helper.get();
+    }
+
+    auto first_error = std::ranges::min_element(errors, {}, [](const pair<size_t, std::exception_ptr>& error) { return error.first; });
+
+    if (first_error->second) {
+        std::rethrow_exception(first_error->second);
+    }
+}
+
+void ProtoManager::LoadFromResources(const FileSystem& resources, size_t thread_count)
 {
     FO_STACK_TRACE_ENTRY();
 
@@ -124,62 +172,114 @@ void ProtoManager::LoadFromResources(const FileSystem& resources)
         break;
     }
 
+    if (thread_count == 0) {
+        thread_count = std::max(numeric_cast<size_t>(std::thread::hardware_concurrency()), size_t {1});
+    }
+
+    struct StagedProto
+    {
+        string_view Name {};
+        const_span<uint8_t> Data {};
+        nptr<ProtoEntity> Proto {};
+    };
+
+    struct StagedProtoType
+    {
+        string_view TypeName {};
+        vector<StagedProto> Protos {};
+    };
+
+    struct StagedProtoFile
+    {
+        File Data {};
+        vector<string_view> Hashes {};
+        vector<StagedProtoType> Types {};
+    };
+
     auto proto_files = resources.FilterFiles(protos_ext);
+    vector<StagedProtoFile> staged_files(proto_files.GetFilesCount());
 
-    for (const auto& proto_file_header : proto_files) {
-        auto proto_file = File::Load(proto_file_header);
-        auto reader = DataReader(proto_file.GetDataSpan());
+    // Read and split every file, names and records stay views into the loaded file data
+    ForEachIndexParallel("LoadProtoFiles", staged_files.size(), thread_count, [&](size_t file_index) {
+        auto& staged = staged_files[file_index];
+        staged.Data = File::Load(proto_files.GetFileByIndex(file_index));
+        auto reader = DataReader(staged.Data.GetDataSpan());
 
         // Hashes
         {
             auto hashes_count = reader.Read<uint32_t>();
-            string str;
+            staged.Hashes.reserve(hashes_count);
 
             for (uint32_t i = 0; i < hashes_count; i++) {
                 auto str_len = reader.Read<uint32_t>();
-                str.resize(str_len);
-                reader.ReadStringBytes(str);
-                hstring hstr = _meta->Hashes.ToHashedString(str);
-                ignore_unused(hstr);
+                staged.Hashes.emplace_back(reader.ReadStringView(str_len));
             }
         }
 
         // Protos
         {
             auto types_count = reader.Read<uint32_t>();
-            vector<uint8_t> props_data;
+            staged.Types.reserve(types_count);
 
             for (uint32_t i = 0; i < types_count; i++) {
                 auto protos_count = reader.Read<uint32_t>();
+                auto& staged_type = staged.Types.emplace_back();
 
                 auto type_name_len = reader.Read<uint16_t>();
-                string type_name_str;
-                type_name_str.resize(type_name_len);
-                reader.ReadStringBytes(type_name_str);
-                hstring type_name = _meta->Hashes.ToHashedString(type_name_str);
-
-                FO_VERIFY_AND_THROW(_meta->IsValidEntityType(type_name) || _meta->IsFixedType(type_name), "Proto file references unknown entity or fixed type");
+                staged_type.TypeName = reader.ReadStringView(type_name_len);
+                staged_type.Protos.reserve(protos_count);
 
                 for (uint32_t j = 0; j < protos_count; j++) {
-                    auto proto_name_len = reader.Read<uint16_t>();
-                    string proto_name;
-                    proto_name.resize(proto_name_len);
-                    reader.ReadStringBytes(proto_name);
-                    hstring proto_id = _meta->Hashes.ToHashedString(proto_name);
+                    auto& staged_proto = staged_type.Protos.emplace_back();
 
-                    auto proto = CreateProto(type_name, proto_id, nullptr);
+                    auto proto_name_len = reader.Read<uint16_t>();
+                    staged_proto.Name = reader.ReadStringView(proto_name_len);
 
                     auto data_size = reader.Read<uint32_t>();
-                    props_data.resize(data_size);
-                    span<uint8_t> props_data_span = props_data;
-                    reader.ReadBytes(props_data_span);
-                    proto->GetPropertiesForEdit()->RestoreAllData(props_data);
+                    staged_proto.Data = reader.ReadBytes(data_size);
                 }
             }
         }
 
         reader.VerifyEnd();
+    });
+
+    // Intern and register in file order, exactly as a serial load would
+    vector<ptr<StagedProto>> restore_queue;
+
+    for (auto& staged : staged_files) {
+        for (const auto str : staged.Hashes) {
+            hstring hstr = _meta->Hashes.ToHashedString(str);
+            ignore_unused(hstr);
+        }
+
+        for (auto& staged_type : staged.Types) {
+            hstring type_name = _meta->Hashes.ToHashedString(staged_type.TypeName);
+
+            FO_VERIFY_AND_THROW(_meta->IsValidEntityType(type_name) || _meta->IsFixedType(type_name), "Proto file references unknown entity or fixed type");
+
+            for (auto& staged_proto : staged_type.Protos) {
+                hstring proto_id = _meta->Hashes.ToHashedString(staged_proto.Name);
+                staged_proto.Proto = CreateProto(type_name, proto_id, nullptr);
+                restore_queue.emplace_back(&staged_proto);
+            }
+        }
     }
+
+    // Every proto owns its properties, so their data is restored independently
+    constexpr size_t restore_chunk_size = 64;
+    const size_t restore_chunks_count = (restore_queue.size() + restore_chunk_size - 1) / restore_chunk_size;
+
+    ForEachIndexParallel("RestoreProtoData", restore_chunks_count, thread_count, [&](size_t chunk_index) {
+        vector<uint8_t> props_data;
+        const size_t chunk_end = std::min((chunk_index + 1) * restore_chunk_size, restore_queue.size());
+
+        for (size_t i = chunk_index * restore_chunk_size; i < chunk_end; i++) {
+            auto staged_proto = restore_queue[i];
+            props_data.assign(staged_proto->Data.begin(), staged_proto->Data.end());
+            staged_proto->Proto->GetPropertiesForEdit()->RestoreAllData(props_data);
+        }
+    });
 }
 
 auto ProtoManager::GetProtoItem(hstring proto_id) const noexcept -> nptr<const ProtoItem>
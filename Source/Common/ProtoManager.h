@@ -67,7 +67,9 @@ class ProtoManager final
     [[nodiscard]] auto GetProtoEntities(hstring type_name) const noexcept -> const unordered_map<hstring, refcount_ptr<ProtoEntity>>&;
 
     void AddProto(hstring type_name, refcount_ptr<ProtoEntity> proto);
-    void LoadFromResources(const FileSystem& resources);
+    // Files are read and proto data decoded on up to thread_count threads (0 for one per hardware thread), while
+    // names are interned and protos registered on the calling thread in file order, so the tables don't depend on it
+    void LoadFromResources(const FileSystem& resources, size_t thread_count = 0);
 
 private:
     auto CreateProto(hstring type_name, hstring pid, nptr<const Properties> props) -> ptr<ProtoEntity>;
@@ -84,6 +84,16 @@ TimeEventManager::TimeEventManager(ptr<BaseEngine> engine) :
     FO_STACK_TRACE_ENTRY();
 }
 
+TimeEventManager::~TimeEventManager()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Owners may outlive the engine, so they must not keep pointing at this queue
+    for (const auto& entry : _timeEventQueue | std::views::values) {
+        entry.OwnerEntity->_timeEventMngr = nullptr;
+    }
+}
+
 auto TimeEventManager::StartTimeEvent(ptr<Entity> entity, Entity::TimeEventData::FuncType func, timespan delay, timespan repeat, vector<any_t> data) -> uint32_t
 {
     FO_STACK_TRACE_ENTRY();
@@ -106,9 +116,9 @@ auto TimeEventManager::StartTimeEvent(ptr<Entity> entity, Entity::TimeEventData:
         std::scoped_lock lock {_timeEventLocker};
 
         auto time_events = entity->EnsureTimeEvents();
-        time_events->emplace_back(std::move(te));
+        time_events->emplace_back(te);
 
-        AddEntityTimeEventPolling(entity);
+        QueueTimeEvent(entity, te);
     }
 
     NotifySchedule(entity, event_id, effective_delay);
@@ -193,6 +203,7 @@ void TimeEventManager::ModifyTimeEvent(ptr<Entity> entity, ScriptFuncName func_n
             if (repeat.has_value()) {
                 te->FireTime = fire_time;
                 te->RepeatDuration = repeat.value();
+                QueueTimeEvent(entity, te);
                 to_resubmit.push_back({te->Id, effective_delay});
             }
             if (data.has_value()) {
@@ -244,6 +255,7 @@ void TimeEventManager::StopTimeEvent(ptr<Entity> entity, ScriptFuncName func_nam
             }
 
             uint32_t removed_id = te->Id;
+            UnqueueTimeEvent(removed_id);
             te->Id = 0;
             time_events->erase(time_events->begin() + numeric_cast<ptrdiff_t>(i)); // te is not valid anymore
             cancelled_ids.push_back(removed_id);
@@ -260,51 +272,86 @@ void TimeEventManager::StopTimeEvent(ptr<Entity> entity, ScriptFuncName func_nam
     }
 }
 
-void TimeEventManager::AddEntityTimeEventPolling(ptr<Entity> entity)
+void TimeEventManager::QueueTimeEvent(ptr<Entity> entity, const shared_ptr<Entity::TimeEventData>& te)
 {
-    FO_NO_STACK_TRACE_ENTRY();
+    FO_STACK_TRACE_ENTRY();
 
-    std::scoped_lock lock {_timeEventLocker};
+    // Caller holds _timeEventLocker; with dispatcher hooks set the dispatcher owns every deadline instead
+    if (_dispatcher.Schedule) {
+        return;
+    }
+
+    UnqueueTimeEvent(te->Id);
 
-    _timeEventEntities.emplace(entity.hold_ref());
+    entity->_timeEventMngr = this;
+    _timeEventQueue.emplace(QueueKey {.FireTime = te->FireTime, .Id = te->Id}, QueuedTimeEvent {.OwnerEntity = entity.hold_ref(), .Event = te});
+    _timeEventQueueIndex.emplace(te->Id, te->FireTime);
 }
 
-void TimeEventManager::RemoveEntityTimeEventPolling(ptr<Entity> entity)
+void TimeEventManager::UnqueueTimeEvent(uint32_t event_id) noexcept
 {
     FO_NO_STACK_TRACE_ENTRY();
 
-    std::scoped_lock lock {_timeEventLocker};
+    // Caller holds _timeEventLocker
+    if (const auto it = _timeEventQueueIndex.find(event_id); it != _timeEventQueueIndex.end()) {
+        _timeEventQueue.erase(QueueKey {.FireTime = it->second, .Id = event_id});
+        _timeEventQueueIndex.erase(it);
+    }
+}
 
-    _timeEventEntities.erase(entity.hold_ref());
+auto TimeEventManager::IsQueuedTimeEventAlive(const QueuedTimeEvent& entry) const -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    // Every removal path unqueues the event, this only guards an owner destroyed mid-tick by a handler
+    return entry.Event->Id != 0 && !entry.OwnerEntity->IsDestroyed();
 }
 
 void TimeEventManager::ProcessTimeEvents()
 {
     FO_STACK_TRACE_ENTRY();
 
-    auto entities = [&] {
-        std::scoped_lock lock {_timeEventLocker};
+    nanotime time = _engine->GameTime.GetFrameTime();
 
-        return copy_hold_ref(_timeEventEntities);
-    }();
+    // Every pass fires or drops the queue head, and a fired event is either removed or moved past `time`,
+    // so only due events are visited and the loop stops at the first future deadline
+    while (true) {
+        QueueKey key;
+        optional<QueuedTimeEvent> entry;
 
-    for (ptr<Entity> entity : entities) {
-        if (entity->IsDestroyed()) {
-            RemoveEntityTimeEventPolling(entity);
-            continue;
+        {
+            std::scoped_lock lock {_timeEventLocker};
+
+            if (_timeEventQueue.empty() || _timeEventQueue.begin()->first.FireTime > time) {
+                break;
+            }
+
+            key = _timeEventQueue.begin()->first;
+            entry = _timeEventQueue.begin()->second;
+
+            if (!IsQueuedTimeEventAlive(entry.value())) {
+                UnqueueTimeEvent(key.Id);
+                continue;
+            }
+
+            if (entry->Event->FireTime > time) {
+                QueueTimeEvent(entry->OwnerEntity, entry->Event);
+                continue;
+            }
         }
 
-        ProcessEntityTimeEvents(entity);
+        ptr<Entity> entity = entry->OwnerEntity;
+        FiredTimeEvent result = FireTimeEvent(entity, entry->Event);
 
-        if (entity->IsDestroyed()) {
-            RemoveEntityTimeEventPolling(entity);
-            continue;
+        if (!entity->IsDestroyed()) {
+            PostFireTimeEvent(entity, entry->Event, result);
         }
 
         std::scoped_lock lock {_timeEventLocker};
 
-        if (!entity->HasTimeEvents()) {
-            RemoveEntityTimeEventPolling(entity);
+        // The handler destroyed its owner or stopped the event before PostFire could touch it
+        if (const auto it = _timeEventQueue.find(key); it != _timeEventQueue.end() && it->second.Event == entry->Event) {
+            UnqueueTimeEvent(key.Id);
         }
     }
 }
@@ -318,7 +365,13 @@ void TimeEventManager::ClearTimeEvents()
     {
         std::scoped_lock lock {_timeEventLocker};
 
-        for (ptr<Entity> entity : copy_hold_ref(_timeEventEntities)) {
+        unordered_set<refcount_ptr<Entity>> owners;
+
+        for (const auto& entry : _timeEventQueue | std::views::values) {
+            owners.emplace(entry.OwnerEntity);
+        }
+
+        for (ptr<Entity> entity : owners) {
             auto time_events = entity->GetTimeEvents();
 
             if (time_events && !time_events->empty()) {
@@ -329,12 +382,13 @@ void TimeEventManager::ClearTimeEvents()
                         cancelled_ids.push_back(te->Id);
                     }
                 }
-            }
 
-            entity->ClearAllTimeEvents();
+                time_events->clear();
+            }
         }
 
-        _timeEventEntities.clear();
+        _timeEventQueue.clear();
+        _timeEventQueueIndex.clear();
     }
 
     for (auto cid : cancelled_ids) {
@@ -342,65 +396,6 @@ void TimeEventManager::ClearTimeEvents()
     }
 }
 
-void TimeEventManager::ProcessEntityTimeEvents(ptr<Entity> entity)
-{
-    FO_STACK_TRACE_ENTRY();
-
-    small_vector<shared_ptr<Entity::TimeEventData>, 8> ready_events;
-    nanotime time = _engine->GameTime.GetFrameTime();
-
-    {
-        std::scoped_lock lock {_timeEventLocker};
-
-        auto time_events = entity->GetTimeEvents();
-
-        if (!time_events || time_events->empty()) {
-            return;
-        }
-
-        ready_events.reserve(time_events->size());
-
-        for (auto& te : *time_events) {
-            if (te->FireTime <= time) {
-                ready_events.emplace_back(te);
-            }
-        }
-    }
-
-    for (auto& te : ready_events) {
-        {
-            std::scoped_lock lock {_timeEventLocker};
-
-            auto time_events = entity->GetTimeEvents();
-
-            if (!time_events || time_events->empty()) {
-                return;
-            }
-
-            if (te->Id == 0) {
-                continue;
-            }
-
-            auto it = std::ranges::find(time_events->begin(), time_events->end(), te);
-
-            if (it == time_events->end()) {
-                continue;
-            }
-            if (te->FireTime > time) {
-                continue;
-            }
-        }
-
-        FiredTimeEvent result = FireTimeEvent(entity, te);
-
-        if (entity->IsDestroyed()) {
-            return;
-        }
-
-        PostFireTimeEvent(entity, te, result);
-    }
-}
-
 auto TimeEventManager::CollectReadyTimeEvents(optional<timespan>& time_until_next) -> vector<ReadyTimeEvent>
 {
     FO_STACK_TRACE_ENTRY();
@@ -408,39 +403,25 @@ auto TimeEventManager::CollectReadyTimeEvents(optional<timespan>& time_until_nex
     std::scoped_lock lock {_timeEventLocker};
 
     vector<ReadyTimeEvent> ready;
-    optional<nanotime> next_future_fire_time;
     nanotime time = _engine->GameTime.GetFrameTime();
+    time_until_next = std::nullopt;
 
-    for (ptr<Entity> entity : copy_hold_ref(_timeEventEntities)) {
-        if (entity->IsDestroyed()) {
-            RemoveEntityTimeEventPolling(entity);
+    for (auto it = _timeEventQueue.begin(); it != _timeEventQueue.end();) {
+        if (!IsQueuedTimeEventAlive(it->second)) {
+            _timeEventQueueIndex.erase(it->first.Id);
+            it = _timeEventQueue.erase(it);
             continue;
         }
 
-        auto time_events = entity->GetTimeEvents();
-
-        if (!time_events || time_events->empty()) {
-            RemoveEntityTimeEventPolling(entity);
-            continue;
-        }
-
-        for (size_t i = 0; i < time_events->size(); i++) {
-            auto& te = (*time_events)[i];
-
-            if (te->FireTime <= time) {
-                ready.emplace_back(ReadyTimeEvent {entity.hold_ref(), te});
-            }
-            else if (!next_future_fire_time.has_value() || te->FireTime < next_future_fire_time.value()) {
-                next_future_fire_time = te->FireTime;
-            }
+        if (it->first.FireTime > time) {
+            time_until_next = it->first.FireTime - time;
+            break;
         }
 
-        if (!entity->HasTimeEvents()) {
-            RemoveEntityTimeEventPolling(entity);
-        }
+        ready.emplace_back(ReadyTimeEvent {it->second.OwnerEntity, it->second.Event});
+        ++it;
     }
 
-    time_until_next = next_future_fire_time.has_value() ? optional {next_future_fire_time.value() - time} : std::nullopt;
     return ready;
 }
 
@@ -460,11 +441,11 @@ void TimeEventManager::PostFireTimeEvent(ptr<Entity> entity, shared_ptr<Entity::
 
     nanotime time = _engine->GameTime.GetFrameTime();
 
-    auto remove_event = [entity, &te]() mutable {
+    auto remove_event = [this, entity, &te]() mutable {
+        uint32_t id = te->Id;
         auto time_events = entity->GetTimeEvents();
 
         if (time_events) {
-            uint32_t id = te->Id;
             auto it = std::ranges::find_if(*time_events, [id](const shared_ptr<Entity::TimeEventData>& te2) { return te2->Id == id; });
 
             if (it != time_events->end()) {
@@ -472,6 +453,8 @@ void TimeEventManager::PostFireTimeEvent(ptr<Entity> entity, shared_ptr<Entity::
                 te->Id = 0;
             }
         }
+
+        UnqueueTimeEvent(id);
     };
 
     if (result.Context) {
@@ -491,6 +474,7 @@ void TimeEventManager::PostFireTimeEvent(ptr<Entity> entity, shared_ptr<Entity::
         if (context->IsRepeatChanged()) {
             te->RepeatDuration = context->GetRepeat();
             te->FireTime = time + std::max(te->RepeatDuration, MIN_REPEAT_TIME);
+            QueueTimeEvent(entity, te);
             return;
         }
     }
@@ -498,6 +482,7 @@ void TimeEventManager::PostFireTimeEvent(ptr<Entity> entity, shared_ptr<Entity::
     if (te->RepeatDuration && result.CallResult) {
         auto next_fire_time = std::max(te->FireTime + te->RepeatDuration, time + MIN_REPEAT_TIME);
         te->FireTime = next_fire_time;
+        QueueTimeEvent(entity, te);
     }
     else {
         remove_event();
@@ -576,8 +561,33 @@ void TimeEventManager::SetDispatcherHooks(DispatcherHooks hooks)
 {
     FO_STACK_TRACE_ENTRY();
 
-    _dispatcher = std::move(hooks);
-    _dispatcherPaused.store(false, std::memory_order_release);
+    vector<QueuedTimeEvent> handed_over;
+
+    {
+        std::scoped_lock lock {_timeEventLocker};
+
+        _dispatcher = std::move(hooks);
+        _dispatcherPaused.store(false, std::memory_order_release);
+
+        // The dispatcher takes over scheduling, so events queued so far move to it and the queue stays empty
+        if (_dispatcher.Schedule) {
+            handed_over.reserve(_timeEventQueue.size());
+
+            for (const auto& entry : _timeEventQueue | std::views::values) {
+                entry.OwnerEntity->_timeEventMngr = nullptr;
+                handed_over.emplace_back(entry);
+            }
+
+            _timeEventQueue.clear();
+            _timeEventQueueIndex.clear();
+        }
+    }
+
+    nanotime time = _engine->GameTime.GetFrameTime();
+
+    for (const auto& entry : handed_over) {
+        NotifySchedule(entry.OwnerEntity, entry.Event->Id, std::max(entry.Event->FireTime - time, MIN_REPEAT_TIME));
+    }
 }
 
 void TimeEventManager::PauseDispatcherHooks()
@@ -630,13 +640,14 @@ void TimeEventManager::CancelAllForEntity(ptr<Entity> entity) noexcept
 
             for (auto& te : *time_events) {
                 if (te->Id != 0) {
+                    UnqueueTimeEvent(te->Id);
                     cancelled_ids.push_back(te->Id);
                 }
             }
-        }
 
-        entity->ClearAllTimeEvents();
-        RemoveEntityTimeEventPolling(entity);
+            // Not Entity::ClearAllTimeEvents, which routes back here for queued entities
+            time_events->clear();
+        }
     }
 
     for (auto cid : cancelled_ids) {
@@ -95,6 +95,8 @@ class TimeEventManager
         refcount_nptr<TimeEventContext> Context {};
     };
 
+    // The server sets a Schedule hook and drives deadlines from its worker pool through FireAndAdvance, the manager
+    // then keeps no queue of its own; without it (client) ProcessTimeEvents fires events from the deadline queue
     struct DispatcherHooks
     {
         function<void(refcount_ptr<Entity> entity, uint32_t event_id, timespan delay)> Schedule {};
@@ -106,7 +108,7 @@ class TimeEventManager
     TimeEventManager(TimeEventManager&&) noexcept = delete;
     auto operator=(const TimeEventManager&) = delete;
     auto operator=(TimeEventManager&&) noexcept = delete;
-    ~TimeEventManager() = default;
+    ~TimeEventManager();
 
     [[nodiscard]] auto CountTimeEvent(ptr<Entity> entity, ScriptFuncName func_name, uint32_t id) const -> size_t;
 
@@ -126,15 +128,31 @@ class TimeEventManager
     auto FireAndAdvance(ptr<Entity> entity, uint32_t event_id) -> optional<timespan>;
 
 private:
-    void AddEntityTimeEventPolling(ptr<Entity> entity);
-    void RemoveEntityTimeEventPolling(ptr<Entity> entity);
-    void ProcessEntityTimeEvents(ptr<Entity> entity);
+    struct QueueKey
+    {
+        nanotime FireTime {};
+        uint32_t Id {};
+
+        [[nodiscard]] auto operator<(const QueueKey& other) const noexcept -> bool { return FireTime != other.FireTime ? FireTime < other.FireTime : Id < other.Id; }
+    };
+
+    struct QueuedTimeEvent
+    {
+        refcount_ptr<Entity> OwnerEntity;
+        shared_ptr<Entity::TimeEventData> Event {};
+    };
+
+    [[nodiscard]] auto IsQueuedTimeEventAlive(const QueuedTimeEvent& entry) const -> bool;
+
+    void QueueTimeEvent(ptr<Entity> entity, const shared_ptr<Entity::TimeEventData>& te);
+    void UnqueueTimeEvent(uint32_t event_id) noexcept;
     void NotifySchedule(ptr<Entity> entity, uint32_t event_id, timespan delay);
     void NotifyCancel(uint32_t event_id);
 
     ptr<BaseEngine> _engine;
     mutable std::recursive_mutex _timeEventLocker {}; // Recursive: not modelable by TSA
-    unordered_set<refcount_ptr<Entity>> _timeEventEntities {};
+    map<QueueKey, QueuedTimeEvent> _timeEventQueue {}; // Every pending event ordered by deadline, so a tick only visits due ones; unused while dispatcher hooks are set
+    unordered_map<uint32_t, nanotime> _timeEventQueueIndex {}; // Event id -> queued deadline
     std::atomic_uint32_t _timeEventCounter {};
     DispatcherHooks _dispatcher {};
     std::atomic_bool _dispatcherPaused {};
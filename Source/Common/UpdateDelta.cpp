@@ -0,0 +1,370 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "UpdateDelta.h"
+
+FO_BEGIN_NAMESPACE
+
+static constexpr size_t UPDATE_DELTA_SCAN_CHUNK_SIZE = 1024 * 1024;
+static constexpr size_t UPDATE_DELTA_FILTER_BITS = 20;
+static constexpr uint64_t UPDATE_DELTA_MISSED_HASH_RATIO = 2; // Strong-hashed bytes of failed weak matches per target byte
+
+void UpdateRollingChecksum::Reset(const_span<uint8_t> window) noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    uint32_t a = 0;
+    uint32_t b = 0;
+    auto window_size = numeric_cast<uint32_t>(window.size());
+
+    for (uint32_t i = 0; i < window_size; i++) {
+        a += window[i];
+        b += (window_size - i) * window[i];
+    }
+
+    _a = a & 0xFFFF;
+    _b = b & 0xFFFF;
+    _windowSize = window_size;
+}
+
+void UpdateRollingChecksum::Roll(uint8_t out_byte, uint8_t in_byte) noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    _a = (_a - out_byte + in_byte) & 0xFFFF;
+    _b = (_b - _windowSize * out_byte + _a) & 0xFFFF;
+}
+
+auto GetUpdateDeltaBlockSize(uint64_t file_size) noexcept -> uint32_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    // Square root of the size balances the signature upload against the literal overhead of one changed block
+    auto root = numeric_cast<uint64_t>(std::sqrt(numeric_cast<float64_t>(file_size)));
+    uint64_t block_size = std::clamp(std::bit_ceil(std::max(root, uint64_t {1})), uint64_t {UPDATE_DELTA_MIN_BLOCK_SIZE}, uint64_t {UPDATE_DELTA_MAX_BLOCK_SIZE});
+
+    while (block_size < UPDATE_DELTA_MAX_BLOCK_SIZE && file_size / block_size > UPDATE_DELTA_MAX_BLOCKS) {
+        block_size *= 2;
+    }
+
+    return numeric_cast<uint32_t>(block_size);
+}
+
+auto IsValidUpdateDeltaBlockSize(uint32_t block_size) noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return block_size >= UPDATE_DELTA_MIN_BLOCK_SIZE && block_size <= UPDATE_DELTA_MAX_BLOCK_SIZE && std::has_single_bit(block_size);
+}
+
+auto MakeUpdateBlockSignature(const_span<uint8_t> block) noexcept -> UpdateBlockSignature
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    UpdateRollingChecksum weak;
+    weak.Reset(block);
+
+    return {.Weak = weak.GetValue(), .Strong = hashing_ex::hash(block.data(), block.size())};
+}
+
+auto MakeUpdateBlockSignatures(const_span<uint8_t> data, uint32_t block_size) -> UpdateBlockSignatures
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(IsValidUpdateDeltaBlockSize(block_size), "Update delta block size is out of range", block_size);
+
+    UpdateBlockSignatures signatures;
+    signatures.BlockSize = block_size;
+
+    // Only whole blocks are described, a trailing partial block always travels as a literal
+    size_t block_count = data.size() / block_size;
+    signatures.Blocks.reserve(block_count);
+
+    for (size_t i = 0; i < block_count; i++) {
+        signatures.Blocks.emplace_back(MakeUpdateBlockSignature(data.subspan(i * block_size, block_size)));
+    }
+
+    return signatures;
+}
+
+auto HashUpdateBlockSignatures(const UpdateBlockSignatures& signatures) noexcept -> uint64_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    // Field by field rather than over the raw vector, the signature struct has padding between its members
+    uint64_t hash = hashing_ex::hash(signatures.BlockSize);
+
+    for (const auto& block : signatures.Blocks) {
+        hash = hashing_ex::hash(hash ^ block.Weak);
+        hash = hashing_ex::hash(hash ^ block.Strong);
+    }
+
+    return hash;
+}
+
+auto MakeUpdateDelta(const_span<uint8_t> target, const UpdateBlockSignatures& basis) -> vector<UpdateDeltaOp>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto read_target = [&target](uint64_t offset, span<uint8_t> buf) -> bool {
+        MemCopy(buf.data(), target.data() + numeric_cast<size_t>(offset), buf.size());
+        return true;
+    };
+
+    auto ops = MakeUpdateDelta(numeric_cast<uint64_t>(target.size()), read_target, basis);
+    FO_STRONG_ASSERT(ops.has_value(), "In-memory update delta target can't fail to read");
+    return std::move(*ops);
+}
+
+auto MakeUpdateDelta(uint64_t target_size, const UpdateDeltaReader& read_target, const UpdateBlockSignatures& basis) -> optional<vector<UpdateDeltaOp>>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(IsValidUpdateDeltaBlockSize(basis.BlockSize), "Update delta block size is out of range", basis.BlockSize);
+
+    vector<UpdateDeltaOp> ops;
+
+    auto emit = [&ops](UpdateDeltaOpType type, uint64_t offset, uint64_t size) {
+        if (size == 0) {
+            return;
+        }
+
+        if (!ops.empty() && ops.back().Type == type && ops.back().Offset + ops.back().Size == offset) {
+            ops.back().Size += size;
+        }
+        else {
+            ops.emplace_back(UpdateDeltaOp {.Type = type, .Offset = offset, .Size = size});
+        }
+    };
+
+    uint64_t block_size = basis.BlockSize;
+
+    if (basis.Blocks.empty() || target_size < block_size) {
+        emit(UpdateDeltaOpType::Literal, 0, target_size);
+        return ops;
+    }
+
+    // Weak sums sorted for lookup, with a bit filter in front so the common miss costs no search at all
+    vector<pair<uint32_t, uint32_t>> weak_lookup;
+    weak_lookup.reserve(basis.Blocks.size());
+    vector<bool> weak_filter(size_t {1} << UPDATE_DELTA_FILTER_BITS);
+
+    auto filter_slot = [](uint32_t weak) noexcept -> size_t { return (weak * 0x9E3779B1u) >> (32 - UPDATE_DELTA_FILTER_BITS); };
+
+    for (size_t i = 0; i < basis.Blocks.size(); i++) {
+        weak_lookup.emplace_back(basis.Blocks[i].Weak, numeric_cast<uint32_t>(i));
+        weak_filter[filter_slot(basis.Blocks[i].Weak)] = true;
+    }
+
+    std::ranges::sort(weak_lookup);
+
+    // Sliding buffer over the target, always holding the current window plus the byte rolled in next
+    vector<uint8_t> buf(std::max(UPDATE_DELTA_SCAN_CHUNK_SIZE, numeric_cast<size_t>(block_size) * 4));
+    uint64_t buf_offset = 0;
+    size_t buf_len = 0;
+
+    auto ensure_window = [&](uint64_t pos) -> bool {
+        uint64_t needed_end = std::min(pos + block_size + 1, target_size);
+
+        if (needed_end <= buf_offset + buf_len) {
+            return true;
+        }
+
+        size_t keep = numeric_cast<size_t>(buf_offset + buf_len - pos);
+        MemMove(buf.data(), buf.data() + numeric_cast<size_t>(pos - buf_offset), keep);
+        buf_offset = pos;
+        buf_len = keep;
+
+        auto read_size = numeric_cast<size_t>(std::min(numeric_cast<uint64_t>(buf.size() - buf_len), target_size - (buf_offset + buf_len)));
+
+        if (!read_target(buf_offset + buf_len, span<uint8_t> {buf.data() + buf_len, read_size})) {
+            return false;
+        }
+
+        buf_len += read_size;
+        return true;
+    };
+
+    // Crafted signatures can make every window a weak match with no strong one, each costing a full block hash;
+    // past the budget the rest of the target goes as a literal
+    const uint64_t missed_hash_budget = target_size * UPDATE_DELTA_MISSED_HASH_RATIO;
+    uint64_t missed_hash_bytes = 0;
+
+    auto find_block = [&](uint32_t weak, const_span<uint8_t> window, optional<uint32_t> preferred_block) -> optional<uint32_t> {
+        if (!weak_filter[filter_slot(weak)]) {
+            return std::nullopt;
+        }
+
+        auto [first, last] = std::equal_range(weak_lookup.begin(), weak_lookup.end(), pair<uint32_t, uint32_t> {weak, 0}, [](const auto& l, const auto& r) { return l.first < r.first; });
+
+        if (first == last) {
+            return std::nullopt;
+        }
+
+        uint64_t strong = hashing_ex::hash(window.data(), window.size());
+
+        // The block following the previous match keeps copies contiguous, which merges them into one op
+        if (preferred_block.has_value()) {
+            for (auto it = first; it != last; ++it) {
+                if (it->second == *preferred_block && basis.Blocks[it->second].Strong == strong) {
+                    return it->second;
+                }
+            }
+        }
+
+        for (auto it = first; it != last; ++it) {
+            if (basis.Blocks[it->second].Strong == strong) {
+                return it->second;
+            }
+        }
+
+        missed_hash_bytes += window.size();
+        return std::nullopt;
+    };
+
+    UpdateRollingChecksum weak;
+    bool weak_valid = false;
+    optional<uint32_t> preferred_block;
+    uint64_t pos = 0;
+    uint64_t literal_start = 0;
+
+    while (pos + block_size <= target_size && missed_hash_bytes <= missed_hash_budget) {
+        if (!ensure_window(pos)) {
+            return std::nullopt;
+        }
+
+        auto window_start = numeric_cast<size_t>(pos - buf_offset);
+        auto window = const_span<uint8_t> {buf.data() + window_start, numeric_cast<size_t>(block_size)};
+
+        if (!weak_valid) {
+            weak.Reset(window);
+            weak_valid = true;
+        }
+
+        auto matched_block = find_block(weak.GetValue(), window, preferred_block);
+
+        if (matched_block.has_value()) {
+            emit(UpdateDeltaOpType::Literal, literal_start, pos - literal_start);
+            emit(UpdateDeltaOpType::CopyBlocks, numeric_cast<uint64_t>(*matched_block) * block_size, block_size);
+
+            preferred_block = *matched_block + 1;
+            pos += block_size;
+            literal_start = pos;
+            weak_valid = false;
+        }
+        else {
+            if (pos + block_size < target_size) {
+                weak.Roll(window[0], buf[window_start + numeric_cast<size_t>(block_size)]);
+            }
+
+            pos++;
+        }
+    }
+
+    emit(UpdateDeltaOpType::Literal, literal_start, target_size - literal_start);
+    return ops;
+}
+
+void WriteUpdateBlockSignatures(NetOutBuffer& out_buf, const UpdateBlockSignatures& signatures)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    out_buf.Write<uint32_t>(signatures.BlockSize);
+    out_buf.Write<uint32_t>(numeric_cast<uint32_t>(signatures.Blocks.size()));
+
+    for (const auto& block : signatures.Blocks) {
+        out_buf.Write<uint32_t>(block.Weak);
+        out_buf.Write<uint64_t>(block.Strong);
+    }
+}
+
+auto ReadUpdateBlockSignatures(NetInBuffer& in_buf) -> optional<UpdateBlockSignatures>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    UpdateBlockSignatures signatures;
+    signatures.BlockSize = in_buf.Read<uint32_t>();
+    auto block_count = in_buf.Read<uint32_t>();
+
+    if (!IsValidUpdateDeltaBlockSize(signatures.BlockSize) || block_count > UPDATE_DELTA_MAX_BLOCKS) {
+        return std::nullopt;
+    }
+
+    signatures.Blocks.resize(block_count);
+
+    for (auto& block : signatures.Blocks) {
+        block.Weak = in_buf.Read<uint32_t>();
+        block.Strong = in_buf.Read<uint64_t>();
+    }
+
+    return signatures;
+}
+
+void WriteUpdateDeltaOps(NetOutBuffer& out_buf, const_span<UpdateDeltaOp> ops)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    out_buf.Write<uint32_t>(numeric_cast<uint32_t>(ops.size()));
+
+    for (const auto& op : ops) {
+        out_buf.Write<UpdateDeltaOpType>(op.Type);
+        out_buf.Write<uint64_t>(op.Offset);
+        out_buf.Write<uint64_t>(op.Size);
+    }
+}
+
+auto ReadUpdateDeltaOps(NetInBuffer& in_buf) -> vector<UpdateDeltaOp>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto op_count = in_buf.Read<uint32_t>();
+
+    // Copies and literals alternate at worst, so one more op than two per basis block is the ceiling
+    FO_VERIFY_AND_THROW(op_count <= UPDATE_DELTA_MAX_BLOCKS * 2 + 1, "Update delta op count is out of range", op_count);
+
+    vector<UpdateDeltaOp> ops;
+    ops.resize(op_count);
+
+    for (auto& op : ops) {
+        op.Type = in_buf.Read<UpdateDeltaOpType>();
+        op.Offset = in_buf.Read<uint64_t>();
+        op.Size = in_buf.Read<uint64_t>();
+
+        FO_VERIFY_AND_THROW(op.Type == UpdateDeltaOpType::CopyBlocks || op.Type == UpdateDeltaOpType::Literal, "Unknown update delta op type", static_cast<int32_t>(op.Type));
+    }
+
+    return ops;
+}
+
+FO_END_NAMESPACE
@@ -0,0 +1,107 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+#include "Common.h"
+
+#include "NetBuffer.h"
+
+FO_BEGIN_NAMESPACE
+
+// Block-level delta for the updater, in the rsync manner: the client describes the file it already has by
+// per-block signatures, the server scans its own file with a rolling checksum for blocks the client can reuse
+// and answers with a script of block copies and literal ranges. Literal ranges always start at the current
+// output position, so the client fetches them with the regular resumable portion requests
+static constexpr uint32_t UPDATE_DELTA_MIN_BLOCK_SIZE = 1024;
+static constexpr uint32_t UPDATE_DELTA_MAX_BLOCK_SIZE = 1024 * 1024;
+static constexpr uint32_t UPDATE_DELTA_MAX_BLOCKS = 32768; // Keeps a signature request well under the inbound message limit
+
+struct UpdateBlockSignature
+{
+    uint32_t Weak {};
+    uint64_t Strong {};
+};
+
+struct UpdateBlockSignatures
+{
+    uint32_t BlockSize {};
+    vector<UpdateBlockSignature> Blocks {};
+};
+
+enum class UpdateDeltaOpType : uint8_t
+{
+    CopyBlocks = 0, // Offset and size address the client's existing file
+    Literal = 1, // Offset and size address the server's file, fetched through GetUpdateFile
+};
+
+struct UpdateDeltaOp
+{
+    UpdateDeltaOpType Type {};
+    uint64_t Offset {};
+    uint64_t Size {};
+};
+
+// Adler-style checksum of the rsync paper, rolled one byte at a time over a fixed-length window
+class UpdateRollingChecksum
+{
+public:
+    [[nodiscard]] auto GetValue() const noexcept -> uint32_t { return (_b << 16) | _a; }
+
+    void Reset(const_span<uint8_t> window) noexcept;
+    void Roll(uint8_t out_byte, uint8_t in_byte) noexcept;
+
+private:
+    uint32_t _a {};
+    uint32_t _b {};
+    uint32_t _windowSize {};
+};
+
+// Reads the target file range starting at the offset into the buffer, false on any read failure
+using UpdateDeltaReader = function<bool(uint64_t offset, span<uint8_t> buf)>;
+
+[[nodiscard]] auto GetUpdateDeltaBlockSize(uint64_t file_size) noexcept -> uint32_t;
+[[nodiscard]] auto IsValidUpdateDeltaBlockSize(uint32_t block_size) noexcept -> bool;
+[[nodiscard]] auto MakeUpdateBlockSignature(const_span<uint8_t> block) noexcept -> UpdateBlockSignature;
+[[nodiscard]] auto MakeUpdateBlockSignatures(const_span<uint8_t> data, uint32_t block_size) -> UpdateBlockSignatures;
+[[nodiscard]] auto HashUpdateBlockSignatures(const UpdateBlockSignatures& signatures) noexcept -> uint64_t;
+[[nodiscard]] auto MakeUpdateDelta(const_span<uint8_t> target, const UpdateBlockSignatures& basis) -> vector<UpdateDeltaOp>;
+[[nodiscard]] auto MakeUpdateDelta(uint64_t target_size, const UpdateDeltaReader& read_target, const UpdateBlockSignatures& basis) -> optional<vector<UpdateDeltaOp>>;
+
+void WriteUpdateBlockSignatures(NetOutBuffer& out_buf, const UpdateBlockSignatures& signatures);
+[[nodiscard]] auto ReadUpdateBlockSignatures(NetInBuffer& in_buf) -> optional<UpdateBlockSignatures>;
+void WriteUpdateDeltaOps(NetOutBuffer& out_buf, const_span<UpdateDeltaOp> ops);
+[[nodiscard]] auto ReadUpdateDeltaOps(NetInBuffer& in_buf) -> vector<UpdateDeltaOp>;
+
+FO_END_NAMESPACE
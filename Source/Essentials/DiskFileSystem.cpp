@@ -312,7 +312,8 @@ auto fs_hash_file(string_view path) -> optional<uint64_t>
         return std::nullopt;
     }
 
-    array<char, 0x10000> buf {};
+    // Large sequential reads: the updater hashes several packs at once, and small ones would interleave seeks
+    vector<char> buf(0x100000);
     uint64_t hash = offset;
 
     while (stream) {
@@ -46,6 +46,7 @@
 #if FO_LINUX || FO_MAC
 #include <dlfcn.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -557,6 +558,95 @@ auto Platform::GetCpuUsageSnapshot() noexcept -> CpuUsageSnapshot
     return result;
 }
 
+auto Platform::OpenReadOnlyFile(const string& path) noexcept -> intptr_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+#if FO_WINDOWS
+    wstring path_wide = strex(path).to_wide_char();
+    auto path_cstr = make_ptr(path_wide.c_str());
+
+    // Shared for writing and deleting so a held handle never blocks replacing the file
+    HANDLE file_handle = ::CreateFileW(path_cstr.get(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    return file_handle != INVALID_HANDLE_VALUE ? reinterpret_cast<intptr_t>(file_handle) : INVALID_FILE_HANDLE;
+#elif FO_LINUX || FO_MAC
+    auto path_cstr = make_ptr(path.c_str());
+    int32_t fd = ::open(path_cstr.get(), O_RDONLY | O_CLOEXEC);
+
+    return fd >= 0 ? static_cast<intptr_t>(fd) : INVALID_FILE_HANDLE;
+#else
+    ignore_unused(path);
+    return INVALID_FILE_HANDLE;
+#endif
+}
+
+auto Platform::ReadFileAt(intptr_t file_handle, uint64_t offset, span<uint8_t> buf) noexcept -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (file_handle == INVALID_FILE_HANDLE) {
+        return false;
+    }
+
+#if FO_WINDOWS
+    size_t total_read = 0;
+
+    while (total_read < buf.size()) {
+        uint64_t read_offset = offset + total_read;
+        OVERLAPPED overlapped {};
+        overlapped.Offset = static_cast<DWORD>(read_offset & 0xFFFFFFFF);
+        overlapped.OffsetHigh = static_cast<DWORD>(read_offset >> 32);
+
+        DWORD chunk_size = static_cast<DWORD>(std::min<size_t>(buf.size() - total_read, 0x40000000));
+        DWORD chunk_read = 0;
+
+        if (::ReadFile(reinterpret_cast<HANDLE>(file_handle), buf.data() + total_read, chunk_size, &chunk_read, &overlapped) == FALSE || chunk_read == 0) {
+            return false;
+        }
+
+        total_read += chunk_read;
+    }
+
+    return true;
+#elif FO_LINUX || FO_MAC
+    size_t total_read = 0;
+
+    while (total_read < buf.size()) {
+        ssize_t chunk_read = ::pread(static_cast<int32_t>(file_handle), buf.data() + total_read, buf.size() - total_read, static_cast<off_t>(offset + total_read));
+
+        if (chunk_read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (chunk_read <= 0) {
+            return false;
+        }
+
+        total_read += static_cast<size_t>(chunk_read);
+    }
+
+    return true;
+#else
+    ignore_unused(offset, buf);
+    return false;
+#endif
+}
+
+void Platform::CloseFile(intptr_t file_handle) noexcept
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (file_handle == INVALID_FILE_HANDLE) {
+        return;
+    }
+
+#if FO_WINDOWS
+    ::CloseHandle(reinterpret_cast<HANDLE>(file_handle));
+#elif FO_LINUX || FO_MAC
+    ::close(static_cast<int32_t>(file_handle));
+#endif
+}
+
 auto Platform::LoadModule(const string& module_name) noexcept -> nptr<void>
 {
     FO_STACK_TRACE_ENTRY();
@@ -89,6 +89,16 @@ struct Platform
     // LogicalCoreCount is always populated for normalization
     static auto GetCpuUsageSnapshot() noexcept -> CpuUsageSnapshot;
 
+    // Windows: CreateFileW shared for writing and deleting; Linux and macOS: open; other: INVALID_FILE_HANDLE.
+    // A held handle never blocks replacing the file and keeps reading the one it was opened on
+    static constexpr intptr_t INVALID_FILE_HANDLE = -1;
+    static auto OpenReadOnlyFile(const string& path) noexcept -> intptr_t;
+
+    // Windows: ReadFile at an offset; Linux and macOS: pread. Safe to call concurrently on one handle.
+    // False on any failure or on reaching the end of the file before the buffer is full
+    static auto ReadFileAt(intptr_t file_handle, uint64_t offset, span<uint8_t> buf) noexcept -> bool;
+    static void CloseFile(intptr_t file_handle) noexcept;
+
     // Windows: LoadLibraryW family; Linux and macOS: dlopen family; other: nullptr
     static auto LoadModule(const string& module_name) noexcept -> nptr<void>;
     static void UnloadModule(nptr<void> module_handle) noexcept;
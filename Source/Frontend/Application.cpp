@@ -69,6 +69,7 @@ int32_t AppRender::MAX_ATLAS_HEIGHT {};
 int32_t AppRender::MAX_BONES {};
 const int32_t AppAudio::AUDIO_FORMAT_U8 {SDL_AUDIO_U8};
 const int32_t AppAudio::AUDIO_FORMAT_S16 {SDL_AUDIO_S16};
+const int32_t AppAudio::AUDIO_FORMAT_F32 {SDL_AUDIO_F32};
 
 static constexpr float32_t GAMEPAD_STICK_DEADZONE = 0.2f;
 static constexpr float32_t GAMEPAD_TRIGGER_DEADZONE = 0.15f;
@@ -3047,6 +3048,15 @@ auto AppAudio::IsEnabled() const -> bool
     return !!_app->_ctx->AudioStream;
 }
 
+auto AppAudio::GetOutputFormat() const -> int32_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(IsEnabled(), "Application subsystem is not enabled");
+
+    return static_cast<int32_t>(_app->_ctx->AudioSpec.format);
+}
+
 void AppAudio::SetSource(AudioStreamCallback stream_callback)
 {
     FO_STACK_TRACE_ENTRY();
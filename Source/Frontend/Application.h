@@ -420,6 +420,7 @@ class IAppAudio
     virtual ~IAppAudio() = default;
 
     [[nodiscard]] virtual auto IsEnabled() const -> bool = 0;
+    [[nodiscard]] virtual auto GetOutputFormat() const -> int32_t = 0;
 
     virtual auto ConvertAudio(int32_t format, int32_t channels, int32_t rate, vector<uint8_t>& buf) -> bool = 0;
     virtual void SetSource(AudioStreamCallback stream_callback) = 0;
@@ -607,10 +608,12 @@ class AppAudio final : public IAppAudio
 public:
     static const int32_t AUDIO_FORMAT_U8;
     static const int32_t AUDIO_FORMAT_S16;
+    static const int32_t AUDIO_FORMAT_F32;
 
     using AudioStreamCallback = IAppAudio::AudioStreamCallback;
 
     [[nodiscard]] auto IsEnabled() const -> bool override;
+    [[nodiscard]] auto GetOutputFormat() const -> int32_t override;
 
     auto ConvertAudio(int32_t format, int32_t channels, int32_t rate, vector<uint8_t>& buf) -> bool override;
     void SetSource(AudioStreamCallback stream_callback) override;
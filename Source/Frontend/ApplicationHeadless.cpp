@@ -47,6 +47,7 @@ int32_t AppRender::MAX_ATLAS_HEIGHT {8192};
 int32_t AppRender::MAX_BONES {32};
 const int32_t AppAudio::AUDIO_FORMAT_U8 = 0;
 const int32_t AppAudio::AUDIO_FORMAT_S16 = 1;
+const int32_t AppAudio::AUDIO_FORMAT_F32 = 2;
 
 Application::Application(GlobalSettings&& settings, AppInitFlags flags) :
     Settings {std::move(settings)},
@@ -872,6 +873,15 @@ auto AppAudio::IsEnabled() const -> bool
     return false;
 }
 
+auto AppAudio::GetOutputFormat() const -> int32_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(IsEnabled(), "Application subsystem is not enabled");
+
+    return AUDIO_FORMAT_S16;
+}
+
 void AppAudio::SetSource(AudioStreamCallback stream_callback)
 {
     FO_STACK_TRACE_ENTRY();
@@ -211,6 +211,7 @@ class StubAppAudio final : public IAppAudio
 {
 public:
     [[nodiscard]] auto IsEnabled() const -> bool override { return false; }
+    [[nodiscard]] auto GetOutputFormat() const -> int32_t override { return -1; }
 
     auto ConvertAudio(int32_t format, int32_t channels, int32_t rate, vector<uint8_t>& buf) -> bool override
     {
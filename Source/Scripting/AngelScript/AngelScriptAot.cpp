@@ -0,0 +1,993 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "AngelScriptAot.h"
+
+#if FO_ANGELSCRIPT_SCRIPTING
+
+#include "AngelScriptHelpers.h"
+
+FO_BEGIN_NAMESPACE
+
+static auto GetAotRegistry() -> unordered_map<string, vector<AngelScriptAotFunction>>&
+{
+    FO_STACK_TRACE_ENTRY();
+
+    static unordered_map<string, vector<AngelScriptAotFunction>> registry;
+    return registry;
+}
+
+static auto GetAotOpcode(const_span<AngelScript::asDWORD> bytecode, size_t pos) noexcept -> AngelScript::asEBCInstr
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return static_cast<AngelScript::asEBCInstr>(MemReadUnaligned<uint8_t>(&bytecode[pos]));
+}
+
+static auto GetAotInstructionSize(AngelScript::asEBCInstr op) noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return numeric_cast<size_t>(AngelScript::asBCTypeSize[AngelScript::asBCInfo[op].type]);
+}
+
+template<typename T>
+static auto ReadAotArg(const_span<AngelScript::asDWORD> bytecode, size_t pos, size_t byte_offset) noexcept -> T
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return MemReadUnaligned<T>(reinterpret_cast<const uint8_t*>(&bytecode[pos]) + byte_offset);
+}
+
+static auto GetAotOperandBytes(AngelScript::asEBCType type) noexcept -> uint32_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    // Mask of the instruction bytes that hold operands, the rest is padding the bytecode loader leaves uninitialized
+    switch (type) {
+    case AngelScript::asBCTYPE_W_ARG:
+    case AngelScript::asBCTYPE_wW_ARG:
+    case AngelScript::asBCTYPE_rW_ARG:
+        return 0x000C;
+    case AngelScript::asBCTYPE_DW_ARG:
+        return 0x00F0;
+    case AngelScript::asBCTYPE_rW_DW_ARG:
+    case AngelScript::asBCTYPE_wW_DW_ARG:
+    case AngelScript::asBCTYPE_W_DW_ARG:
+    case AngelScript::asBCTYPE_wW_rW_rW_ARG:
+        return 0x00FC;
+    case AngelScript::asBCTYPE_QW_ARG:
+    case AngelScript::asBCTYPE_DW_DW_ARG:
+        return 0x0FF0;
+    case AngelScript::asBCTYPE_wW_QW_ARG:
+    case AngelScript::asBCTYPE_rW_QW_ARG:
+    case AngelScript::asBCTYPE_rW_DW_DW_ARG:
+    case AngelScript::asBCTYPE_W_DW_DW_ARG:
+        return 0x0FFC;
+    case AngelScript::asBCTYPE_wW_rW_ARG:
+    case AngelScript::asBCTYPE_rW_rW_ARG:
+    case AngelScript::asBCTYPE_wW_W_ARG:
+    case AngelScript::asBCTYPE_W_rW_ARG:
+        return 0x003C;
+    case AngelScript::asBCTYPE_wW_rW_DW_ARG:
+    case AngelScript::asBCTYPE_rW_W_DW_ARG:
+        return 0x0F3C;
+    case AngelScript::asBCTYPE_QW_DW_ARG:
+        return 0xFFF0;
+    case AngelScript::asBCTYPE_W_QW_DW_ARG:
+        return 0xFFFC;
+    default:
+        return 0;
+    }
+}
+
+static auto IsAotTranslatable(AngelScript::asEBCInstr op) noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    switch (op) {
+    case AngelScript::asBC_JitEntry:
+    case AngelScript::asBC_SUSPEND:
+    case AngelScript::asBC_JMP:
+    case AngelScript::asBC_JZ:
+    case AngelScript::asBC_JNZ:
+    case AngelScript::asBC_JS:
+    case AngelScript::asBC_JNS:
+    case AngelScript::asBC_JP:
+    case AngelScript::asBC_JNP:
+    case AngelScript::asBC_JLowZ:
+    case AngelScript::asBC_JLowNZ:
+    case AngelScript::asBC_TZ:
+    case AngelScript::asBC_TNZ:
+    case AngelScript::asBC_TS:
+    case AngelScript::asBC_TNS:
+    case AngelScript::asBC_TP:
+    case AngelScript::asBC_TNP:
+    case AngelScript::asBC_NOT:
+    case AngelScript::asBC_NEGi:
+    case AngelScript::asBC_NEGf:
+    case AngelScript::asBC_NEGd:
+    case AngelScript::asBC_NEGi64:
+    case AngelScript::asBC_INCi8:
+    case AngelScript::asBC_DECi8:
+    case AngelScript::asBC_INCi16:
+    case AngelScript::asBC_DECi16:
+    case AngelScript::asBC_INCi:
+    case AngelScript::asBC_DECi:
+    case AngelScript::asBC_INCi64:
+    case AngelScript::asBC_DECi64:
+    case AngelScript::asBC_INCf:
+    case AngelScript::asBC_DECf:
+    case AngelScript::asBC_INCd:
+    case AngelScript::asBC_DECd:
+    case AngelScript::asBC_IncVi:
+    case AngelScript::asBC_DecVi:
+    case AngelScript::asBC_BNOT:
+    case AngelScript::asBC_BAND:
+    case AngelScript::asBC_BOR:
+    case AngelScript::asBC_BXOR:
+    case AngelScript::asBC_BSLL:
+    case AngelScript::asBC_BSRL:
+    case AngelScript::asBC_BSRA:
+    case AngelScript::asBC_BNOT64:
+    case AngelScript::asBC_BAND64:
+    case AngelScript::asBC_BOR64:
+    case AngelScript::asBC_BXOR64:
+    case AngelScript::asBC_BSLL64:
+    case AngelScript::asBC_BSRL64:
+    case AngelScript::asBC_BSRA64:
+    case AngelScript::asBC_CMPd:
+    case AngelScript::asBC_CMPu:
+    case AngelScript::asBC_CMPf:
+    case AngelScript::asBC_CMPi:
+    case AngelScript::asBC_CMPIi:
+    case AngelScript::asBC_CMPIf:
+    case AngelScript::asBC_CMPIu:
+    case AngelScript::asBC_CMPi64:
+    case AngelScript::asBC_CMPu64:
+    case AngelScript::asBC_SetV1:
+    case AngelScript::asBC_SetV2:
+    case AngelScript::asBC_SetV4:
+    case AngelScript::asBC_SetV8:
+    case AngelScript::asBC_CpyVtoV4:
+    case AngelScript::asBC_CpyVtoV8:
+    case AngelScript::asBC_CpyVtoR4:
+    case AngelScript::asBC_CpyVtoR8:
+    case AngelScript::asBC_CpyRtoV4:
+    case AngelScript::asBC_CpyRtoV8:
+    case AngelScript::asBC_WRTV1:
+    case AngelScript::asBC_WRTV2:
+    case AngelScript::asBC_WRTV4:
+    case AngelScript::asBC_WRTV8:
+    case AngelScript::asBC_RDR1:
+    case AngelScript::asBC_RDR2:
+    case AngelScript::asBC_RDR4:
+    case AngelScript::asBC_RDR8:
+    case AngelScript::asBC_LDV:
+    case AngelScript::asBC_PshC4:
+    case AngelScript::asBC_PshV4:
+    case AngelScript::asBC_PshC8:
+    case AngelScript::asBC_PshV8:
+    case AngelScript::asBC_PSF:
+    case AngelScript::asBC_PshNull:
+    case AngelScript::asBC_VAR:
+    case AngelScript::asBC_iTOf:
+    case AngelScript::asBC_fTOi:
+    case AngelScript::asBC_uTOf:
+    case AngelScript::asBC_fTOu:
+    case AngelScript::asBC_sbTOi:
+    case AngelScript::asBC_swTOi:
+    case AngelScript::asBC_ubTOi:
+    case AngelScript::asBC_uwTOi:
+    case AngelScript::asBC_dTOi:
+    case AngelScript::asBC_dTOu:
+    case AngelScript::asBC_dTOf:
+    case AngelScript::asBC_iTOd:
+    case AngelScript::asBC_uTOd:
+    case AngelScript::asBC_fTOd:
+    case AngelScript::asBC_iTOb:
+    case AngelScript::asBC_iTOw:
+    case AngelScript::asBC_i64TOi:
+    case AngelScript::asBC_uTOi64:
+    case AngelScript::asBC_iTOi64:
+    case AngelScript::asBC_fTOi64:
+    case AngelScript::asBC_dTOi64:
+    case AngelScript::asBC_fTOu64:
+    case AngelScript::asBC_dTOu64:
+    case AngelScript::asBC_i64TOf:
+    case AngelScript::asBC_u64TOf:
+    case AngelScript::asBC_i64TOd:
+    case AngelScript::asBC_u64TOd:
+    case AngelScript::asBC_ADDi:
+    case AngelScript::asBC_SUBi:
+    case AngelScript::asBC_MULi:
+    case AngelScript::asBC_DIVi:
+    case AngelScript::asBC_MODi:
+    case AngelScript::asBC_DIVu:
+    case AngelScript::asBC_MODu:
+    case AngelScript::asBC_ADDf:
+    case AngelScript::asBC_SUBf:
+    case AngelScript::asBC_MULf:
+    case AngelScript::asBC_DIVf:
+    case AngelScript::asBC_MODf:
+    case AngelScript::asBC_ADDd:
+    case AngelScript::asBC_SUBd:
+    case AngelScript::asBC_MULd:
+    case AngelScript::asBC_DIVd:
+    case AngelScript::asBC_MODd:
+    case AngelScript::asBC_ADDi64:
+    case AngelScript::asBC_SUBi64:
+    case AngelScript::asBC_MULi64:
+    case AngelScript::asBC_DIVi64:
+    case AngelScript::asBC_MODi64:
+    case AngelScript::asBC_DIVu64:
+    case AngelScript::asBC_MODu64:
+    case AngelScript::asBC_ADDIi:
+    case AngelScript::asBC_SUBIi:
+    case AngelScript::asBC_MULIi:
+    case AngelScript::asBC_ADDIf:
+    case AngelScript::asBC_SUBIf:
+    case AngelScript::asBC_MULIf:
+    case AngelScript::asBC_ClrHi:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static auto IsAotJump(AngelScript::asEBCInstr op) noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    switch (op) {
+    case AngelScript::asBC_JMP:
+    case AngelScript::asBC_JZ:
+    case AngelScript::asBC_JNZ:
+    case AngelScript::asBC_JS:
+    case AngelScript::asBC_JNS:
+    case AngelScript::asBC_JP:
+    case AngelScript::asBC_JNP:
+    case AngelScript::asBC_JLowZ:
+    case AngelScript::asBC_JLowNZ:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static auto GetAotJumpTarget(const_span<AngelScript::asDWORD> bytecode, size_t pos) -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto offset = ReadAotArg<int32_t>(bytecode, pos, 4);
+    return numeric_cast<size_t>(numeric_cast<int64_t>(pos) + 2 + offset);
+}
+
+AngelScriptAotRegistrar::AngelScriptAotRegistrar(const_span<AngelScriptAotFunction> functions)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto& registry = GetAotRegistry();
+
+    for (const auto& func : functions) {
+        registry[string(func.Declaration)].emplace_back(func);
+    }
+}
+
+auto AngelScriptAotCompiler::CompileFunction(AngelScript::asIScriptFunction* raw_func, AngelScript::asJITFunction* output) -> int
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto func = make_ptr(raw_func);
+    const auto& registry = GetAotRegistry();
+    const auto it = registry.find(GetAngelScriptAotDeclaration(func));
+
+    if (it == registry.end()) {
+        return AngelScript::asNOT_SUPPORTED;
+    }
+
+    const auto hash = GetAngelScriptAotBytecodeHash(func);
+    const auto translation = std::ranges::find_if(it->second, [&](const AngelScriptAotFunction& entry) { return entry.BytecodeHash == hash; });
+
+    if (translation == it->second.end()) {
+        ++_staleCount;
+        return AngelScript::asNOT_SUPPORTED;
+    }
+
+    AngelScript::asUINT length = 0;
+    auto* raw_bytecode = func->GetByteCode(&length);
+    FO_VERIFY_AND_THROW(raw_bytecode != nullptr && length != 0, "Translated script function has no bytecode", it->first);
+    const auto bytecode = span<AngelScript::asDWORD>(raw_bytecode, length);
+
+    for (const auto pos : translation->EntryPoints) {
+        FO_VERIFY_AND_THROW(pos + 1 < bytecode.size() && GetAotOpcode(bytecode, pos) == AngelScript::asBC_JitEntry, "Translated script function entry point is not a JitEntry instruction", it->first, pos);
+    }
+
+    // The VM only enters native code at JitEntry instructions with a non-zero argument
+    for (size_t i = 0; i < translation->EntryPoints.size(); i++) {
+        MemWriteUnaligned<AngelScript::asPWORD>(&bytecode[translation->EntryPoints[i] + 1], numeric_cast<AngelScript::asPWORD>(i + 1));
+    }
+
+    *output = translation->Entry;
+    ++_attachedCount;
+    return AngelScript::asSUCCESS;
+}
+
+void AngelScriptAotCompiler::ReleaseJITFunction(AngelScript::asJITFunction func)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Translations are static code linked into the binary
+    ignore_unused(func);
+}
+
+auto HasAngelScriptAotFunctions() noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return !GetAotRegistry().empty();
+}
+
+auto GetAngelScriptAotDeclaration(ptr<const AngelScript::asIScriptFunction> func) -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    nptr<const char> decl = func->GetDeclaration(true, true, false);
+    return decl ? string(decl.get()) : string();
+}
+
+auto GetAngelScriptAotBytecodeHash(ptr<AngelScript::asIScriptFunction> func) -> uint64_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // FNV-1a over the layout and every operand the translation depends on
+    // Operands of other instructions hold runtime addresses and are left out, as is the JitEntry argument
+    uint64_t hash = 14695981039346656037ull;
+
+    const auto mix = [&hash](uint8_t value) {
+        hash ^= value;
+        hash *= 1099511628211ull;
+    };
+
+    AngelScript::asUINT length = 0;
+    const auto* raw_bytecode = func->GetByteCode(&length);
+
+    mix(AS_PTR_SIZE);
+
+    for (size_t i = 0; i < sizeof(length); i++) {
+        mix(static_cast<uint8_t>(length >> (i * 8)));
+    }
+
+    if (raw_bytecode == nullptr || length == 0) {
+        return hash;
+    }
+
+    const auto bytecode = const_span<AngelScript::asDWORD>(raw_bytecode, length);
+
+    for (size_t pos = 0; pos < bytecode.size();) {
+        const auto op = GetAotOpcode(bytecode, pos);
+        const auto size = GetAotInstructionSize(op);
+        FO_VERIFY_AND_THROW(size != 0 && pos + size <= bytecode.size(), "Invalid script bytecode instruction", pos);
+
+        mix(static_cast<uint8_t>(op));
+
+        if (op != AngelScript::asBC_JitEntry && IsAotTranslatable(op)) {
+            const auto operand_bytes = GetAotOperandBytes(AngelScript::asBCInfo[op].type);
+            const auto* instruction = reinterpret_cast<const uint8_t*>(&bytecode[pos]);
+
+            for (size_t i = 0; i < size * sizeof(AngelScript::asDWORD); i++) {
+                if ((operand_bytes & (1u << i)) != 0) {
+                    mix(instruction[i]);
+                }
+            }
+        }
+
+        pos += size;
+    }
+
+    return hash;
+}
+
+static auto MakeAotInt32(int32_t value) -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (value == std::numeric_limits<int32_t>::min()) {
+        return "std::numeric_limits<int32_t>::min()";
+    }
+
+    return strex("{}", value).str();
+}
+
+static auto MakeAotUInt32(uint32_t value) -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    return strex("{}u", value).str();
+}
+
+static auto MakeAotUInt64(uint64_t value) -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    return strex("{}ull", value).str();
+}
+
+static auto MakeAotFloat32(uint32_t bits) -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Bit patterns keep constants exact, including NaN payloads and negative zero
+    return strex("std::bit_cast<float32_t>({}u)", bits).str();
+}
+
+static auto EmitAotInstruction(const_span<AngelScript::asDWORD> bytecode, size_t pos) -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto op = GetAotOpcode(bytecode, pos);
+    const auto a0 = ReadAotArg<int16_t>(bytecode, pos, 2);
+    const auto a1 = ReadAotArg<int16_t>(bytecode, pos, 4);
+    const auto a2 = ReadAotArg<int16_t>(bytecode, pos, 6);
+    const auto dw1 = ReadAotArg<uint32_t>(bytecode, pos, 4);
+    const auto dw2 = ReadAotArg<uint32_t>(bytecode, pos, 8);
+    const auto leave = strex("return AotLeave(regs, l_base + {}, l_sp, l_reg);", pos).str();
+
+    const auto var = [](string_view type, int16_t offset) -> string { return strex("AotVar<{}>(l_fp, {})", type, offset); };
+    const auto set_var = [](string_view type, int16_t offset, string_view value) -> string { return strex("AotSetVar<{}>(l_fp, {}, {});", type, offset, value); };
+    const auto cast = [](string_view type, string_view value) -> string { return strex("static_cast<{}>({})", type, value); };
+
+    const auto unary = [&](string_view type, string_view expr_op) -> string { return set_var(type, a0, strex("{}{}", expr_op, var(type, a0))); };
+    const auto binary = [&](string_view type, string_view expr_op) -> string { return set_var(type, a0, strex("{} {} {}", var(type, a1), expr_op, var(type, a2))); };
+    const auto shift = [&](string_view type, string_view expr_op) -> string { return set_var(type, a0, strex("{} {} {}", var(type, a1), expr_op, var("uint32_t", a2))); };
+    const auto convert = [&](string_view to, string_view from, int16_t src) -> string { return set_var(to, a0, cast(to, var(from, src))); };
+    const auto compare = [&](string_view type, string_view rhs) -> string { return strex("AotSetReg<int32_t>(l_reg, AotCompare<{}>({}, {}));", type, var(type, a0), rhs); };
+    const auto step_ref = [&](string_view type, string_view delta) -> string { return strex("AotSetRef<{0}>(l_reg, static_cast<{0}>(AotRef<{0}>(l_reg) {1}));", type, delta); };
+    const auto jump_if = [&](string_view cond) -> string { return strex("if ({}) {{\n            goto bc_{};\n        }}", cond, GetAotJumpTarget(bytecode, pos)); };
+    const auto test = [&](string_view cond) -> string { return strex("AotSetRegBool(l_reg, AotReg<int32_t>(l_reg) {});", cond); };
+    const auto divide = [&](string_view type, string_view expr_op, string_view guard) -> string {
+        return strex("if ({}) {{\n            {}\n        }}\n        {}", guard, leave, set_var(type, a0, strex("{} {} {}", var(type, a1), expr_op, var(type, a2))));
+    };
+    const auto signed_guard = [&](string_view type) -> string { return strex("{1} == 0 || ({1} == -1 && {0} == std::numeric_limits<{2}>::min())", var(type, a1), var(type, a2), type); };
+    const auto zero_guard = [&](string_view type) -> string { return strex("{} == 0", var(type, a2)); };
+    const auto immediate = [&](string_view type, string_view expr_op, string_view value) -> string { return set_var(type, a0, strex("{} {} {}", var(type, a1), expr_op, value)); };
+    const auto float_rem = [&](string_view type) -> string { return strex("if ({}) {{\n            {}\n        }}\n        {}", zero_guard(type), leave, set_var(type, a0, strex("std::fmod({}, {})", var(type, a1), var(type, a2)))); };
+
+    switch (op) {
+    case AngelScript::asBC_JitEntry:
+        return {};
+    case AngelScript::asBC_SUSPEND:
+        return strex("if (AotShouldSuspend(regs)) {{\n            {}\n        }}", leave);
+    case AngelScript::asBC_JMP:
+        return strex("goto bc_{};", GetAotJumpTarget(bytecode, pos));
+    case AngelScript::asBC_JZ:
+        return jump_if("AotReg<int32_t>(l_reg) == 0");
+    case AngelScript::asBC_JNZ:
+        return jump_if("AotReg<int32_t>(l_reg) != 0");
+    case AngelScript::asBC_JS:
+        return jump_if("AotReg<int32_t>(l_reg) < 0");
+    case AngelScript::asBC_JNS:
+        return jump_if("AotReg<int32_t>(l_reg) >= 0");
+    case AngelScript::asBC_JP:
+        return jump_if("AotReg<int32_t>(l_reg) > 0");
+    case AngelScript::asBC_JNP:
+        return jump_if("AotReg<int32_t>(l_reg) <= 0");
+    case AngelScript::asBC_JLowZ:
+        return jump_if("AotReg<uint8_t>(l_reg) == 0");
+    case AngelScript::asBC_JLowNZ:
+        return jump_if("AotReg<uint8_t>(l_reg) != 0");
+    case AngelScript::asBC_TZ:
+        return test("== 0");
+    case AngelScript::asBC_TNZ:
+        return test("!= 0");
+    case AngelScript::asBC_TS:
+        return test("< 0");
+    case AngelScript::asBC_TNS:
+        return test(">= 0");
+    case AngelScript::asBC_TP:
+        return test("> 0");
+    case AngelScript::asBC_TNP:
+        return test("<= 0");
+    case AngelScript::asBC_NOT:
+        return strex("AotSetVarBool(l_fp, {}, {} == 0);", a0, var("uint8_t", a0));
+    case AngelScript::asBC_NEGi:
+        return unary("uint32_t", "0u - ");
+    case AngelScript::asBC_NEGf:
+        return unary("float32_t", "-");
+    case AngelScript::asBC_NEGd:
+        return unary("float64_t", "-");
+    case AngelScript::asBC_NEGi64:
+        return unary("uint64_t", "0ull - ");
+    case AngelScript::asBC_INCi8:
+        return step_ref("uint8_t", "+ 1");
+    case AngelScript::asBC_DECi8:
+        return step_ref("uint8_t", "- 1");
+    case AngelScript::asBC_INCi16:
+        return step_ref("uint16_t", "+ 1");
+    case AngelScript::asBC_DECi16:
+        return step_ref("uint16_t", "- 1");
+    case AngelScript::asBC_INCi:
+        return step_ref("uint32_t", "+ 1u");
+    case AngelScript::asBC_DECi:
+        return step_ref("uint32_t", "- 1u");
+    case AngelScript::asBC_INCi64:
+        return step_ref("uint64_t", "+ 1ull");
+    case AngelScript::asBC_DECi64:
+        return step_ref("uint64_t", "- 1ull");
+    case AngelScript::asBC_INCf:
+        return step_ref("float32_t", "+ 1.0f");
+    case AngelScript::asBC_DECf:
+        return step_ref("float32_t", "- 1.0f");
+    case AngelScript::asBC_INCd:
+        return step_ref("float64_t", "+ 1.0");
+    case AngelScript::asBC_DECd:
+        return step_ref("float64_t", "- 1.0");
+    case AngelScript::asBC_IncVi:
+        return set_var("uint32_t", a0, strex("{} + 1u", var("uint32_t", a0)));
+    case AngelScript::asBC_DecVi:
+        return set_var("uint32_t", a0, strex("{} - 1u", var("uint32_t", a0)));
+    case AngelScript::asBC_BNOT:
+        return unary("uint32_t", "~");
+    case AngelScript::asBC_BAND:
+        return binary("uint32_t", "&");
+    case AngelScript::asBC_BOR:
+        return binary("uint32_t", "|");
+    case AngelScript::asBC_BXOR:
+        return binary("uint32_t", "^");
+    case AngelScript::asBC_BSLL:
+        return shift("uint32_t", "<<");
+    case AngelScript::asBC_BSRL:
+        return shift("uint32_t", ">>");
+    case AngelScript::asBC_BSRA:
+        return shift("int32_t", ">>");
+    case AngelScript::asBC_BNOT64:
+        return unary("uint64_t", "~");
+    case AngelScript::asBC_BAND64:
+        return binary("uint64_t", "&");
+    case AngelScript::asBC_BOR64:
+        return binary("uint64_t", "|");
+    case AngelScript::asBC_BXOR64:
+        return binary("uint64_t", "^");
+    case AngelScript::asBC_BSLL64:
+        return shift("uint64_t", "<<");
+    case AngelScript::asBC_BSRL64:
+        return shift("uint64_t", ">>");
+    case AngelScript::asBC_BSRA64:
+        return shift("int64_t", ">>");
+    case AngelScript::asBC_CMPd:
+        return compare("float64_t", var("float64_t", a1));
+    case AngelScript::asBC_CMPu:
+        return compare("uint32_t", var("uint32_t", a1));
+    case AngelScript::asBC_CMPf:
+        return compare("float32_t", var("float32_t", a1));
+    case AngelScript::asBC_CMPi:
+        return compare("int32_t", var("int32_t", a1));
+    case AngelScript::asBC_CMPIi:
+        return compare("int32_t", MakeAotInt32(std::bit_cast<int32_t>(dw1)));
+    case AngelScript::asBC_CMPIf:
+        return compare("float32_t", MakeAotFloat32(dw1));
+    case AngelScript::asBC_CMPIu:
+        return compare("uint32_t", MakeAotUInt32(dw1));
+    case AngelScript::asBC_CMPi64:
+        return compare("int64_t", var("int64_t", a1));
+    case AngelScript::asBC_CMPu64:
+        return compare("uint64_t", var("uint64_t", a1));
+    case AngelScript::asBC_SetV1:
+    case AngelScript::asBC_SetV2:
+    case AngelScript::asBC_SetV4:
+        return set_var("uint32_t", a0, MakeAotUInt32(dw1));
+    case AngelScript::asBC_SetV8:
+        return set_var("uint64_t", a0, MakeAotUInt64(ReadAotArg<uint64_t>(bytecode, pos, 4)));
+    case AngelScript::asBC_CpyVtoV4:
+        return set_var("uint32_t", a0, var("uint32_t", a1));
+    case AngelScript::asBC_CpyVtoV8:
+        return set_var("uint64_t", a0, var("uint64_t", a1));
+    case AngelScript::asBC_CpyVtoR4:
+        return strex("AotSetReg<uint32_t>(l_reg, {});", var("uint32_t", a0));
+    case AngelScript::asBC_CpyVtoR8:
+        return strex("l_reg = {};", var("uint64_t", a0));
+    case AngelScript::asBC_CpyRtoV4:
+        return set_var("uint32_t", a0, "AotReg<uint32_t>(l_reg)");
+    case AngelScript::asBC_CpyRtoV8:
+        return set_var("uint64_t", a0, "l_reg");
+    case AngelScript::asBC_WRTV1:
+        return strex("AotSetRef<uint8_t>(l_reg, {});", var("uint8_t", a0));
+    case AngelScript::asBC_WRTV2:
+        return strex("AotSetRef<uint16_t>(l_reg, {});", var("uint16_t", a0));
+    case AngelScript::asBC_WRTV4:
+        return strex("AotSetRef<uint32_t>(l_reg, {});", var("uint32_t", a0));
+    case AngelScript::asBC_WRTV8:
+        return strex("AotSetRef<uint64_t>(l_reg, {});", var("uint64_t", a0));
+    case AngelScript::asBC_RDR1:
+        return strex("AotSetVarLow<uint8_t>(l_fp, {}, AotRef<uint8_t>(l_reg));", a0);
+    case AngelScript::asBC_RDR2:
+        return strex("AotSetVarLow<uint16_t>(l_fp, {}, AotRef<uint16_t>(l_reg));", a0);
+    case AngelScript::asBC_RDR4:
+        return set_var("uint32_t", a0, "AotRef<uint32_t>(l_reg)");
+    case AngelScript::asBC_RDR8:
+        return set_var("uint64_t", a0, "AotRef<uint64_t>(l_reg)");
+    case AngelScript::asBC_LDV:
+        return strex("AotSetReg<AngelScript::asDWORD*>(l_reg, l_fp - {});", a0);
+    case AngelScript::asBC_PshC4:
+        return strex("AotPush<uint32_t>(l_sp, {});", MakeAotUInt32(dw1));
+    case AngelScript::asBC_PshV4:
+        return strex("AotPush<uint32_t>(l_sp, {});", var("uint32_t", a0));
+    case AngelScript::asBC_PshC8:
+        return strex("AotPush<uint64_t>(l_sp, {});", MakeAotUInt64(ReadAotArg<uint64_t>(bytecode, pos, 4)));
+    case AngelScript::asBC_PshV8:
+        return strex("AotPush<uint64_t>(l_sp, {});", var("uint64_t", a0));
+    case AngelScript::asBC_PSF:
+        return strex("AotPush<AngelScript::asDWORD*>(l_sp, l_fp - {});", a0);
+    case AngelScript::asBC_PshNull:
+        return "AotPush<AngelScript::asPWORD>(l_sp, 0);";
+    case AngelScript::asBC_VAR:
+        return strex("AotPush<AngelScript::asPWORD>(l_sp, static_cast<AngelScript::asPWORD>({}));", a0);
+    case AngelScript::asBC_iTOf:
+        return convert("float32_t", "int32_t", a0);
+    case AngelScript::asBC_fTOi:
+        return convert("int32_t", "float32_t", a0);
+    case AngelScript::asBC_uTOf:
+        return convert("float32_t", "uint32_t", a0);
+    case AngelScript::asBC_fTOu:
+        return set_var("uint32_t", a0, strex("AotToUnsigned<uint32_t, int32_t>({})", var("float32_t", a0)));
+    case AngelScript::asBC_sbTOi:
+        return convert("int32_t", "int8_t", a0);
+    case AngelScript::asBC_swTOi:
+        return convert("int32_t", "int16_t", a0);
+    case AngelScript::asBC_ubTOi:
+        return convert("uint32_t", "uint8_t", a0);
+    case AngelScript::asBC_uwTOi:
+        return convert("uint32_t", "uint16_t", a0);
+    case AngelScript::asBC_dTOi:
+        return convert("int32_t", "float64_t", a1);
+    case AngelScript::asBC_dTOu:
+        return set_var("uint32_t", a0, strex("AotToUnsigned<uint32_t, int32_t>({})", var("float64_t", a1)));
+    case AngelScript::asBC_dTOf:
+        return convert("float32_t", "float64_t", a1);
+    case AngelScript::asBC_iTOd:
+        return convert("float64_t", "int32_t", a1);
+    case AngelScript::asBC_uTOd:
+        return convert("float64_t", "uint32_t", a1);
+    case AngelScript::asBC_fTOd:
+        return convert("float64_t", "float32_t", a1);
+    case AngelScript::asBC_iTOb:
+        return strex("AotSetVarLow<uint8_t>(l_fp, {}, {});", a0, cast("uint8_t", var("uint32_t", a0)));
+    case AngelScript::asBC_iTOw:
+        return strex("AotSetVarLow<uint16_t>(l_fp, {}, {});", a0, cast("uint16_t", var("uint32_t", a0)));
+    case AngelScript::asBC_i64TOi:
+        return convert("int32_t", "int64_t", a1);
+    case AngelScript::asBC_uTOi64:
+        return convert("int64_t", "uint32_t", a1);
+    case AngelScript::asBC_iTOi64:
+        return convert("int64_t", "int32_t", a1);
+    case AngelScript::asBC_fTOi64:
+        return convert("int64_t", "float32_t", a1);
+    case AngelScript::asBC_dTOi64:
+        return convert("int64_t", "float64_t", a0);
+    case AngelScript::asBC_fTOu64:
+        return set_var("uint64_t", a0, strex("AotToUnsigned<uint64_t, int64_t>({})", var("float32_t", a1)));
+    case AngelScript::asBC_dTOu64:
+        return set_var("uint64_t", a0, strex("AotToUnsigned<uint64_t, int64_t>({})", var("float64_t", a0)));
+    case AngelScript::asBC_i64TOf:
+        return convert("float32_t", "int64_t", a1);
+    case AngelScript::asBC_u64TOf:
+        return convert("float32_t", "uint64_t", a1);
+    case AngelScript::asBC_i64TOd:
+        return convert("float64_t", "int64_t", a0);
+    case AngelScript::asBC_u64TOd:
+        return convert("float64_t", "uint64_t", a0);
+    case AngelScript::asBC_ADDi:
+        return binary("uint32_t", "+");
+    case AngelScript::asBC_SUBi:
+        return binary("uint32_t", "-");
+    case AngelScript::asBC_MULi:
+        return binary("uint32_t", "*");
+    case AngelScript::asBC_DIVi:
+        return divide("int32_t", "/", signed_guard("int32_t"));
+    case AngelScript::asBC_MODi:
+        return divide("int32_t", "%", signed_guard("int32_t"));
+    case AngelScript::asBC_DIVu:
+        return divide("uint32_t", "/", zero_guard("uint32_t"));
+    case AngelScript::asBC_MODu:
+        return divide("uint32_t", "%", zero_guard("uint32_t"));
+    case AngelScript::asBC_ADDf:
+        return binary("float32_t", "+");
+    case AngelScript::asBC_SUBf:
+        return binary("float32_t", "-");
+    case AngelScript::asBC_MULf:
+        return binary("float32_t", "*");
+    case AngelScript::asBC_DIVf:
+        return divide("float32_t", "/", zero_guard("float32_t"));
+    case AngelScript::asBC_MODf:
+        return float_rem("float32_t");
+    case AngelScript::asBC_ADDd:
+        return binary("float64_t", "+");
+    case AngelScript::asBC_SUBd:
+        return binary("float64_t", "-");
+    case AngelScript::asBC_MULd:
+        return binary("float64_t", "*");
+    case AngelScript::asBC_DIVd:
+        return divide("float64_t", "/", zero_guard("float64_t"));
+    case AngelScript::asBC_MODd:
+        return float_rem("float64_t");
+    case AngelScript::asBC_ADDi64:
+        return binary("uint64_t", "+");
+    case AngelScript::asBC_SUBi64:
+        return binary("uint64_t", "-");
+    case AngelScript::asBC_MULi64:
+        return binary("uint64_t", "*");
+    case AngelScript::asBC_DIVi64:
+        return divide("int64_t", "/", signed_guard("int64_t"));
+    case AngelScript::asBC_MODi64:
+        return divide("int64_t", "%", signed_guard("int64_t"));
+    case AngelScript::asBC_DIVu64:
+        return divide("uint64_t", "/", zero_guard("uint64_t"));
+    case AngelScript::asBC_MODu64:
+        return divide("uint64_t", "%", zero_guard("uint64_t"));
+    case AngelScript::asBC_ADDIi:
+        return immediate("uint32_t", "+", MakeAotUInt32(dw2));
+    case AngelScript::asBC_SUBIi:
+        return immediate("uint32_t", "-", MakeAotUInt32(dw2));
+    case AngelScript::asBC_MULIi:
+        return immediate("uint32_t", "*", MakeAotUInt32(dw2));
+    case AngelScript::asBC_ADDIf:
+        return immediate("float32_t", "+", MakeAotFloat32(dw2));
+    case AngelScript::asBC_SUBIf:
+        return immediate("float32_t", "-", MakeAotFloat32(dw2));
+    case AngelScript::asBC_MULIf:
+        return immediate("float32_t", "*", MakeAotFloat32(dw2));
+    case AngelScript::asBC_ClrHi:
+        return "AotClearRegHigh(l_reg);";
+    default:
+        return leave;
+    }
+}
+
+static auto IsAotFunctionSelected(ptr<AngelScript::asIScriptFunction> func, const vector<string>& namespaces) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (func->GetFuncType() != AngelScript::asFUNC_SCRIPT) {
+        return false;
+    }
+
+    nptr<const char> ns = func->GetNamespace();
+
+    if (nptr<AngelScript::asITypeInfo> obj_type = func->GetObjectType(); obj_type) {
+        ns = obj_type->GetNamespace();
+    }
+
+    return ns && IsScriptNamespaceAllowed(ns.get(), namespaces);
+}
+
+static auto TranslateAotFunction(ptr<AngelScript::asIScriptFunction> func, size_t index, string& code, string& table) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    AngelScript::asUINT length = 0;
+    const auto* raw_bytecode = func->GetByteCode(&length);
+
+    if (raw_bytecode == nullptr || length == 0) {
+        return false;
+    }
+
+    const auto bytecode = const_span<AngelScript::asDWORD>(raw_bytecode, length);
+    vector<size_t> positions;
+
+    for (size_t pos = 0; pos < bytecode.size();) {
+        const auto size = GetAotInstructionSize(GetAotOpcode(bytecode, pos));
+        FO_VERIFY_AND_THROW(size != 0 && pos + size <= bytecode.size(), "Invalid script bytecode instruction", pos);
+        positions.emplace_back(pos);
+        pos += size;
+    }
+
+    // Native code starts at a JitEntry only when it has some work to do before handing control back
+    vector<size_t> entry_points;
+    set<size_t> labels;
+
+    for (size_t i = 0; i + 1 < positions.size(); i++) {
+        const auto next_op = GetAotOpcode(bytecode, positions[i + 1]);
+
+        if (GetAotOpcode(bytecode, positions[i]) == AngelScript::asBC_JitEntry && IsAotTranslatable(next_op) && next_op != AngelScript::asBC_JitEntry) {
+            entry_points.emplace_back(positions[i]);
+            labels.emplace(positions[i + 1]);
+        }
+    }
+
+    if (entry_points.empty()) {
+        return false;
+    }
+
+    // Walk from the entry points so only referenced labels and reachable instructions are emitted
+    unordered_map<size_t, size_t> position_index;
+
+    for (size_t i = 0; i < positions.size(); i++) {
+        position_index.emplace(positions[i], i);
+    }
+
+    set<size_t> reached;
+    vector<size_t> pending(labels.begin(), labels.end());
+
+    while (!pending.empty()) {
+        const auto start = pending.back();
+        pending.pop_back();
+
+        const auto it = position_index.find(start);
+        FO_VERIFY_AND_THROW(it != position_index.end(), "Script bytecode jump target is not an instruction", start);
+
+        for (auto i = it->second; i < positions.size() && !reached.contains(positions[i]); i++) {
+            const auto pos = positions[i];
+            const auto op = GetAotOpcode(bytecode, pos);
+            reached.emplace(pos);
+
+            if (IsAotJump(op)) {
+                const auto target = GetAotJumpTarget(bytecode, pos);
+
+                if (labels.emplace(target).second) {
+                    pending.emplace_back(target);
+                }
+            }
+
+            if (!IsAotTranslatable(op) || op == AngelScript::asBC_JMP) {
+                break;
+            }
+        }
+    }
+
+    const auto decl = GetAngelScriptAotDeclaration(func);
+
+    code += strex("// {}\n", decl);
+    code += strex("static void AotFunc{}(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)\n", index);
+    code += "{\n";
+    code += "    AngelScript::asDWORD* l_base = regs->programPointer;\n";
+    code += "    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;\n";
+    code += "    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;\n";
+    code += "    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;\n";
+    code += "\n";
+    code += "    switch (entry) {\n";
+
+    for (size_t i = 0; i < entry_points.size(); i++) {
+        const auto entry_pos = entry_points[i];
+        code += strex("    case {}:\n", i + 1);
+        code += strex("        l_base -= {};\n", entry_pos);
+        code += strex("        goto bc_{};\n", entry_pos + GetAotInstructionSize(AngelScript::asBC_JitEntry));
+    }
+
+    code += "    default:\n";
+    code += "        regs->programPointer += 1 + AS_PTR_SIZE;\n";
+    code += "        return;\n";
+    code += "    }\n";
+
+    for (const auto pos : positions) {
+        if (labels.contains(pos)) {
+            code += strex("\nbc_{}:\n", pos);
+        }
+
+        if (!reached.contains(pos)) {
+            continue;
+        }
+
+        if (const auto instruction = EmitAotInstruction(bytecode, pos); !instruction.empty()) {
+            code += strex("    {{ // {}\n        {}\n    }}\n", AngelScript::asBCInfo[GetAotOpcode(bytecode, pos)].name, instruction);
+        }
+    }
+
+    if (reached.contains(positions.back()) && IsAotTranslatable(GetAotOpcode(bytecode, positions.back())) && GetAotOpcode(bytecode, positions.back()) != AngelScript::asBC_JMP) {
+        code += strex("    return AotLeave(regs, l_base + {}, l_sp, l_reg);\n", bytecode.size());
+    }
+
+    code += "}\n\n";
+
+    string entries;
+
+    for (const auto entry_pos : entry_points) {
+        entries += strex("{}{}", entries.empty() ? "" : ", ", entry_pos);
+    }
+
+    string escaped_decl;
+
+    for (const auto ch : decl) {
+        if (ch == '"' || ch == '\\') {
+            escaped_decl += '\\';
+        }
+
+        escaped_decl += ch;
+    }
+
+    code += strex("constexpr array<uint32_t, {}> AotEntries{} {{{}}};\n\n", entry_points.size(), index, entries);
+    table += strex("    AngelScriptAotFunction {{.Declaration = \"{}\", .BytecodeHash = {}ull, .Entry = &AotFunc{}, .EntryPoints = AotEntries{}}},\n", escaped_decl, GetAngelScriptAotBytecodeHash(func), index, index);
+    return true;
+}
+
+auto TranslateAngelScriptModule(ptr<AngelScript::asIScriptModule> mod, const vector<string>& namespaces) -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    vector<ptr<AngelScript::asIScriptFunction>> funcs;
+
+    for (AngelScript::asUINT i = 0; i < mod->GetFunctionCount(); i++) {
+        auto func = make_ptr(mod->GetFunctionByIndex(i));
+
+        if (IsAotFunctionSelected(func, namespaces)) {
+            funcs.emplace_back(func);
+        }
+    }
+
+    for (AngelScript::asUINT i = 0; i < mod->GetObjectTypeCount(); i++) {
+        auto ti = make_ptr(mod->GetObjectTypeByIndex(i));
+
+        for (AngelScript::asUINT j = 0; j < ti->GetMethodCount(); j++) {
+            auto func = make_ptr(ti->GetMethodByIndex(j, false));
+
+            if (IsAotFunctionSelected(func, namespaces)) {
+                funcs.emplace_back(func);
+            }
+        }
+    }
+
+    string code;
+    string table;
+    size_t count = 0;
+
+    for (auto func : funcs) {
+        if (TranslateAotFunction(func, count, code, table)) {
+            count++;
+        }
+    }
+
+    string result;
+    result += "// Generated by the AngelScript baker from script bytecode, do not edit\n";
+    result += "// Bytecode hashes tie every function to the exact build it was translated from\n\n";
+    result += "#include \"AngelScriptAot.h\"\n\n";
+    result += "#if FO_ANGELSCRIPT_SCRIPTING\n\n";
+    result += "FO_BEGIN_NAMESPACE\n\n";
+    result += "namespace\n{\n";
+
+    if (count != 0) {
+        result += "\n";
+        result += code;
+        result += strex("const array<AngelScriptAotFunction, {}> AotFunctions {{\n", count);
+        result += table;
+        result += "};\n\n";
+        result += "const AngelScriptAotRegistrar AotRegistrar {AotFunctions};\n";
+    }
+
+    result += "}\n\n";
+    result += "FO_END_NAMESPACE\n\n";
+    result += "#endif\n";
+    return result;
+}
+
+FO_END_NAMESPACE
+
+#endif
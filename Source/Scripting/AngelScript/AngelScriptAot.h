@@ -0,0 +1,198 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+#if FO_ANGELSCRIPT_SCRIPTING
+
+#include <angelscript.h>
+
+FO_BEGIN_NAMESPACE
+
+// Ahead-of-time translation of script bytecode into C++
+// The baker turns functions from the namespaces listed in ScriptSettings::AotNamespaces into C++ source, the server
+// binary links that source, and AngelScriptAotCompiler attaches each translation through the JIT interface when the
+// matching bytecode is loaded. A translation covers the plain data instructions (arithmetic, conversions, compares,
+// branches, local copies, argument pushes) and hands control back to the VM at the first instruction it does not
+// cover, so calls, object handling and exceptions keep their interpreted behaviour. The VM re-enters native code at
+// the next JitEntry instruction. Bytecode that no longer matches its translation simply stays interpreted
+
+struct AngelScriptAotFunction
+{
+    string_view Declaration {};
+    uint64_t BytecodeHash {};
+    AngelScript::asJITFunction Entry {};
+    const_span<uint32_t> EntryPoints {}; // JitEntry positions, JIT argument is the index in this list plus one
+};
+
+class AngelScriptAotRegistrar final
+{
+public:
+    explicit AngelScriptAotRegistrar(const_span<AngelScriptAotFunction> functions);
+    AngelScriptAotRegistrar(const AngelScriptAotRegistrar&) = delete;
+    AngelScriptAotRegistrar(AngelScriptAotRegistrar&&) noexcept = delete;
+    auto operator=(const AngelScriptAotRegistrar&) = delete;
+    auto operator=(AngelScriptAotRegistrar&&) noexcept = delete;
+    ~AngelScriptAotRegistrar() = default;
+};
+
+class AngelScriptAotCompiler final : public AngelScript::asIJITCompiler
+{
+public:
+    AngelScriptAotCompiler() = default;
+    AngelScriptAotCompiler(const AngelScriptAotCompiler&) = delete;
+    AngelScriptAotCompiler(AngelScriptAotCompiler&&) noexcept = delete;
+    auto operator=(const AngelScriptAotCompiler&) = delete;
+    auto operator=(AngelScriptAotCompiler&&) noexcept = delete;
+    ~AngelScriptAotCompiler() override = default;
+
+    [[nodiscard]] auto GetAttachedCount() const noexcept -> size_t { return _attachedCount.load(); }
+    [[nodiscard]] auto GetStaleCount() const noexcept -> size_t { return _staleCount.load(); }
+
+    auto CompileFunction(AngelScript::asIScriptFunction* raw_func, AngelScript::asJITFunction* output) -> int override;
+    void ReleaseJITFunction(AngelScript::asJITFunction func) override;
+
+private:
+    std::atomic_size_t _attachedCount {};
+    std::atomic_size_t _staleCount {};
+};
+
+[[nodiscard]] auto HasAngelScriptAotFunctions() noexcept -> bool;
+[[nodiscard]] auto GetAngelScriptAotDeclaration(ptr<const AngelScript::asIScriptFunction> func) -> string;
+[[nodiscard]] auto GetAngelScriptAotBytecodeHash(ptr<AngelScript::asIScriptFunction> func) -> uint64_t;
+[[nodiscard]] auto TranslateAngelScriptModule(ptr<AngelScript::asIScriptModule> mod, const vector<string>& namespaces) -> string;
+
+// Helpers used by generated code, each one mirrors the memory access of the matching VM instruction
+static_assert(sizeof(bool) == 1, "Translated boolean writes assume one byte booleans like the VM");
+
+template<typename T>
+[[nodiscard]] FO_FORCE_INLINE auto AotVar(const AngelScript::asDWORD* fp, int32_t offset) noexcept -> T
+{
+    return MemReadUnaligned<T>(fp - offset);
+}
+
+template<typename T>
+FO_FORCE_INLINE void AotSetVar(AngelScript::asDWORD* fp, int32_t offset, T value) noexcept
+{
+    MemWriteUnaligned<T>(fp - offset, value);
+}
+
+template<typename T>
+FO_FORCE_INLINE void AotSetVarLow(AngelScript::asDWORD* fp, int32_t offset, T value) noexcept
+{
+    static_assert(sizeof(T) < sizeof(AngelScript::asDWORD));
+    array<uint8_t, sizeof(AngelScript::asDWORD)> bytes {};
+    MemWriteUnaligned<T>(bytes.data(), value);
+    MemWriteUnaligned(fp - offset, bytes);
+}
+
+FO_FORCE_INLINE void AotSetVarBool(AngelScript::asDWORD* fp, int32_t offset, bool value) noexcept
+{
+    AotSetVarLow<uint8_t>(fp, offset, value ? 1 : 0);
+}
+
+template<typename T>
+[[nodiscard]] FO_FORCE_INLINE auto AotReg(const AngelScript::asQWORD& reg) noexcept -> T
+{
+    return MemReadUnaligned<T>(&reg);
+}
+
+template<typename T>
+FO_FORCE_INLINE void AotSetReg(AngelScript::asQWORD& reg, T value) noexcept
+{
+    MemWriteUnaligned<T>(&reg, value);
+}
+
+FO_FORCE_INLINE void AotSetRegBool(AngelScript::asQWORD& reg, bool value) noexcept
+{
+    const array<uint8_t, 8> bytes {static_cast<uint8_t>(value ? 1 : 0), 0, 0, 0, 0, 0, 0, 0};
+    MemWriteUnaligned(&reg, bytes);
+}
+
+FO_FORCE_INLINE void AotClearRegHigh(AngelScript::asQWORD& reg) noexcept
+{
+    const array<uint8_t, 3> bytes {};
+    MemWriteUnaligned(reinterpret_cast<uint8_t*>(&reg) + 1, bytes);
+}
+
+template<typename T>
+[[nodiscard]] FO_FORCE_INLINE auto AotRef(const AngelScript::asQWORD& reg) noexcept -> T
+{
+    return MemReadUnaligned<T>(AotReg<void*>(reg));
+}
+
+template<typename T>
+FO_FORCE_INLINE void AotSetRef(const AngelScript::asQWORD& reg, T value) noexcept
+{
+    MemWriteUnaligned<T>(AotReg<void*>(reg), value);
+}
+
+template<typename T>
+FO_FORCE_INLINE void AotPush(AngelScript::asDWORD*& sp, T value) noexcept
+{
+    static_assert(sizeof(T) % sizeof(AngelScript::asDWORD) == 0);
+    sp -= sizeof(T) / sizeof(AngelScript::asDWORD);
+    MemWriteUnaligned<T>(sp, value);
+}
+
+template<typename U, typename S, typename F>
+[[nodiscard]] FO_FORCE_INLINE auto AotToUnsigned(F value) noexcept -> U
+{
+    // Negative values go through the signed type first, same as the VM conversions
+    return value < 0 ? static_cast<U>(static_cast<S>(value)) : static_cast<U>(value);
+}
+
+template<typename T>
+[[nodiscard]] FO_FORCE_INLINE auto AotCompare(T a, T b) noexcept -> int32_t
+{
+    return a == b ? 0 : (a < b ? -1 : 1);
+}
+
+[[nodiscard]] FO_FORCE_INLINE auto AotShouldSuspend(const AngelScript::asSVMRegisters* regs) noexcept -> bool
+{
+    // Set from other threads by context suspension, so it must be re-read on every loop iteration
+    return *static_cast<const volatile bool*>(&regs->doProcessSuspend);
+}
+
+FO_FORCE_INLINE void AotLeave(AngelScript::asSVMRegisters* regs, AngelScript::asDWORD* pc, AngelScript::asDWORD* sp, AngelScript::asQWORD reg) noexcept
+{
+    regs->programPointer = pc;
+    regs->stackPointer = sp;
+    regs->valueRegister = reg;
+}
+
+FO_END_NAMESPACE
+
+#endif
@@ -224,6 +224,16 @@ void AngelScriptBackend::RegisterMetadata(ptr<EngineMetadata> meta)
     FO_AS_VERIFY(as_engine->SetEngineProperty(AngelScript::asEP_BUILD_WITHOUT_LINE_CUES, !_settings->DebuggerEnabled));
     FO_AS_VERIFY(as_engine->SetEngineProperty(AngelScript::asEP_OPTIMIZE_BYTECODE, !_settings->DebuggerEnabled));
 
+    // Server bytecode keeps JitEntry instructions for ahead-of-time translations, both when baking and when loading
+    if (_meta->GetSide() == EngineSideKind::ServerSide && !_settings->AotNamespaces.empty()) {
+        FO_AS_VERIFY(as_engine->SetEngineProperty(AngelScript::asEP_INCLUDE_JIT_INSTRUCTIONS, true));
+
+        if (HasAngelScriptAotFunctions()) {
+            _aotCompiler.emplace();
+            FO_AS_VERIFY(as_engine->SetJITCompiler(&*_aotCompiler));
+        }
+    }
+
     as_engine->SetFunctionUserDataCleanupCallback(CleanupScriptFunction);
     as_engine->SetEngineUserDataCleanupCallback(CleanupLineNumberTranslator, AS_PREPROCESSOR_LNT_USER_DATA);
 
@@ -445,6 +455,14 @@ void AngelScriptBackend::LoadBinaryScripts(const FileSystem& resources)
     if (string remote_call_error = ValidateAngelScriptRemoteCallAttributes(mod, *_meta, lnt); !remote_call_error.empty()) {
         throw ScriptException(remote_call_error);
     }
+
+    if (_aotCompiler) {
+        WriteLog("AngelScript native translations attached to {} functions", _aotCompiler->GetAttachedCount());
+
+        if (_aotCompiler->GetStaleCount() != 0) {
+            WriteLog(LogType::Warning, "{} script functions changed since their native translation was baked and stay interpreted", _aotCompiler->GetStaleCount());
+        }
+    }
 }
 
 auto AngelScriptBackend::CompileTextScripts(const vector<File>& files) -> vector<uint8_t>
@@ -676,6 +694,17 @@ auto AngelScriptBackend::CompileTextScripts(const vector<File>& files) -> vector
     return data;
 }
 
+auto AngelScriptBackend::TranslateCompiledScripts() -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(_asEngine->GetModuleCount() == 1, "AngelScript engine must contain exactly one compiled module", _asEngine->GetModuleCount());
+    nptr<AngelScript::asIScriptModule> mod = _asEngine->GetModuleByIndex(0);
+    FO_VERIFY_AND_THROW(mod, "Missing compiled root module");
+
+    return TranslateAngelScriptModule(mod, _settings->AotNamespaces);
+}
+
 void AngelScriptBackend::BindRequiredStuff()
 {
     FO_STACK_TRACE_ENTRY();
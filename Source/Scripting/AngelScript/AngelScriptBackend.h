@@ -37,6 +37,7 @@
 
 #if FO_ANGELSCRIPT_SCRIPTING
 
+#include "AngelScriptAot.h"
 #include "AngelScriptContext.h"
 #include "AngelScriptDebugger.h"
 #include "ScriptSystem.h"
@@ -73,6 +74,7 @@ class AngelScriptBackend : public ScriptSystemBackend
     void SendMessage(string_view message) const;
     void LoadBinaryScripts(const FileSystem& resources);
     auto CompileTextScripts(const vector<File>& files) -> vector<uint8_t>;
+    auto TranslateCompiledScripts() -> string;
     void BindRequiredStuff();
     void AddCleanupCallback(function<void()> callback);
     void AddPostCleanupCallback(function<void()> callback);
@@ -92,6 +94,7 @@ class AngelScriptBackend : public ScriptSystemBackend
     vector<function<void()>> _cleanupCallbacks {};
     vector<function<void()>> _postCleanupCallbacks {};
     optional<DebuggerEndpointServer> _debuggerEndpointServer {};
+    optional<AngelScriptAotCompiler> _aotCompiler {};
     std::atomic_int32_t _exceptionCounter {};
 };
 
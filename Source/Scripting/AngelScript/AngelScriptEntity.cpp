@@ -1007,7 +1007,7 @@ static void EntityEvent_Subscribe(AngelScript::asIScriptGeneric* gen)
     event_data.Priority = *priority;
     event_data.HasExplicitResult = func->GetReturnTypeId() != AngelScript::asTYPEID_VOID;
 
-    entity->SubscribeEvent(event->Name, std::move(event_data));
+    entity->SubscribeEvent(event->Id, std::move(event_data));
 }
 
 static void EntityEvent_Unsubscribe(AngelScript::asIScriptGeneric* gen)
@@ -1025,7 +1025,7 @@ static void EntityEvent_Unsubscribe(AngelScript::asIScriptGeneric* gen)
         return;
     }
 
-    entity->UnsubscribeEvent(event->Name, std::bit_cast<uintptr_t>(func.get()));
+    entity->UnsubscribeEvent(event->Id, std::bit_cast<uintptr_t>(func.get()));
 }
 
 static void EntityEvent_UnsubscribeAll(AngelScript::asIScriptGeneric* gen)
@@ -1041,7 +1041,7 @@ static void EntityEvent_UnsubscribeAll(AngelScript::asIScriptGeneric* gen)
         return;
     }
 
-    entity->UnsubscribeAllEvent(event->Name);
+    entity->UnsubscribeAllEvent(event->Id);
 }
 
 static void EntityEvent_Fire(AngelScript::asIScriptGeneric* gen)
@@ -1053,9 +1053,9 @@ static void EntityEvent_Fire(AngelScript::asIScriptGeneric* gen)
 
     // May call on unsynced entity
     // May call on destroyed entity
-    if (!entity->IsDestroyed() && entity->HasEventCallbacks(event->Name)) {
+    if (!entity->IsDestroyed() && entity->HasEventCallbacks(event->Id)) {
         ScriptGenericCall(gen, !entity->IsGlobal(), event->Args, [&](FuncCallData& call) {
-            auto result = entity->FireEvent(event->Name, call);
+            auto result = entity->FireEvent(event->Id, call);
             new (gen->GetAddressOfReturnLocation()) Entity::EventResult(result);
         });
     }
@@ -101,7 +101,7 @@ void InitAngelScriptScripting(ptr<EngineMetadata> meta, const ScriptSettings& se
     as_backend->BindRequiredStuff();
 }
 
-auto CompileAngelScript(ptr<EngineMetadata> meta, const ScriptSettings& settings, const vector<File>& files, function<void(string_view)> message_callback) -> vector<uint8_t>
+auto CompileAngelScript(ptr<EngineMetadata> meta, const ScriptSettings& settings, const vector<File>& files, function<void(string_view)> message_callback, nptr<string> aot_source) -> vector<uint8_t>
 {
     FO_STACK_TRACE_ENTRY();
 
@@ -118,6 +118,11 @@ auto CompileAngelScript(ptr<EngineMetadata> meta, const ScriptSettings& settings
     as_backend->RegisterMetadata(meta);
     auto result = as_backend->CompileTextScripts(files);
     as_backend->BindRequiredStuff();
+
+    if (aot_source) {
+        *aot_source = as_backend->TranslateCompiledScripts();
+    }
+
     return result;
 }
 
@@ -45,7 +45,7 @@ FO_BEGIN_NAMESPACE
 struct ScriptSettings;
 
 void InitAngelScriptScripting(ptr<EngineMetadata> meta, const ScriptSettings& settings, const FileSystem& resources);
-auto CompileAngelScript(ptr<EngineMetadata> meta, const ScriptSettings& settings, const vector<File>& files, function<void(string_view)> message_callback) -> vector<uint8_t>;
+auto CompileAngelScript(ptr<EngineMetadata> meta, const ScriptSettings& settings, const vector<File>& files, function<void(string_view)> message_callback, nptr<string> aot_source = nullptr) -> vector<uint8_t>;
 
 FO_END_NAMESPACE
 
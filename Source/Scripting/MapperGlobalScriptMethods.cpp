@@ -408,11 +408,12 @@ FO_SCRIPT_API vector<string> Mapper_Game_GetMapFileNames(ptr<MapperEngine> mappe
             continue;
         }
 
-        File map_file = File::Load(map_file_header);
-        auto declared_maps = MapLoader::EnumerateMaps(map_file.GetPath(), map_file.GetStr());
+        auto declared_maps = mapper->MapCatalog.GetMapNames(map_file_header);
         names.insert(names.end(), std::make_move_iterator(declared_maps.begin()), std::make_move_iterator(declared_maps.end()));
     }
 
+    mapper->SaveMapCatalog();
+
     return names;
 }
 
@@ -989,6 +989,9 @@ auto Critter::CanSeeItemOnMap(ptr<const Item> item) const -> bool
     if (!GetMapId() || item->GetMapId() != GetMapId()) {
         return false;
     }
+    if (int32_t look_margin = _engine->Settings->ItemLookMargin; look_margin >= 0 && GeometryHelper::GetDistance(GetHex(), item->GetHex()) > std::max(GetLookDistance(), 0) + look_margin) {
+        return false;
+    }
 
     auto map = require_refcount_ptr(GetParent<Map>());
 
@@ -1014,6 +1017,7 @@ void Critter::SetItem(ptr<Item> item)
     FO_VALIDATE_ENTITY(LOCKED, NOT_DESTROYED, NOT_DESTROYING);
 
     vec_add_unique_value(_invItems, item);
+    _invItemsIndex.Add(item->GetId(), item, item->GetProtoId(), item->GetCritterSlot());
     item->SetParent(this);
 }
 
@@ -1024,22 +1028,26 @@ void Critter::RemoveItem(ptr<Item> item)
     FO_VALIDATE_ENTITY(LOCKED, NOT_DESTROYED);
 
     vec_remove_unique_value(_invItems, item);
+    _invItemsIndex.Remove(item->GetId());
     item->SetParent(nullptr);
 }
 
+void Critter::ReindexItemSlot(ptr<Item> item)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VALIDATE_ENTITY(LOCKED);
+
+    _invItemsIndex.ChangeSlot(item->GetId(), item->GetCritterSlot());
+}
+
 auto Critter::GetInvItem(ident_t item_id) noexcept -> nptr<Item>
 {
     FO_STACK_TRACE_ENTRY();
 
     FO_VALIDATE_ENTITY(LOCKED, NOT_DESTROYED);
 
-    for (ptr<Item> item : _invItems) {
-        if (item->GetId() == item_id) {
-            return item;
-        }
-    }
-
-    return nullptr;
+    return _invItemsIndex.Find(item_id);
 }
 
 auto Critter::GetInvItems() noexcept -> vector<ptr<Item>>
@@ -1080,13 +1088,7 @@ auto Critter::GetInvItemByPid(hstring item_pid) noexcept -> nptr<Item>
 
     FO_VALIDATE_ENTITY(LOCKED, NOT_DESTROYED);
 
-    for (ptr<Item> item : _invItems) {
-        if (item->GetProtoId() == item_pid) {
-            return item;
-        }
-    }
-
-    return nullptr;
+    return _invItemsIndex.FindByPid(item_pid);
 }
 
 auto Critter::GetItemByPidInvPriority(hstring item_pid) -> nptr<Item>
@@ -1099,30 +1101,22 @@ auto Critter::GetItemByPidInvPriority(hstring item_pid) -> nptr<Item>
     FO_VERIFY_AND_THROW(proto, "Item proto not found", item_pid);
 
     if (proto->GetStackable()) {
-        for (auto& item : _invItems) {
-            if (item->GetProtoId() == item_pid) {
-                return item.get();
-            }
-        }
+        return _invItemsIndex.FindByPid(item_pid);
     }
     else {
         // Non-stackable: prefer an item actually in the Inventory slot over one equipped elsewhere
         nptr<Item> another_slot;
 
-        for (auto& item : _invItems) {
-            if (item->GetProtoId() == item_pid) {
-                if (item->GetCritterSlot() == CritterItemSlot::Inventory) {
-                    return item.get();
-                }
-
-                another_slot = item.get();
+        for (ptr<Item> item : _invItemsIndex.GetByPid(item_pid)) {
+            if (item->GetCritterSlot() == CritterItemSlot::Inventory) {
+                return item;
             }
+
+            another_slot = item;
         }
 
         return another_slot;
     }
-
-    return nullptr;
 }
 
 auto Critter::GetInvItemBySlot(CritterItemSlot slot) noexcept -> nptr<Item>
@@ -1131,13 +1125,7 @@ auto Critter::GetInvItemBySlot(CritterItemSlot slot) noexcept -> nptr<Item>
 
     FO_VALIDATE_ENTITY(LOCKED, NOT_DESTROYED);
 
-    auto it = std::ranges::find_if(_invItems, [&](ptr<Item> item) noexcept -> bool { return item->GetCritterSlot() == slot; });
-
-    if (it == _invItems.end()) {
-        return nullptr;
-    }
-
-    return it->as_nptr();
+    return _invItemsIndex.FindBySlot(slot);
 }
 
 auto Critter::CountInvItemByPid(hstring pid) const noexcept -> int32_t
@@ -1147,10 +1135,8 @@ auto Critter::CountInvItemByPid(hstring pid) const noexcept -> int32_t
     FO_VALIDATE_ENTITY(LOCKED, NOT_DESTROYED);
     int32_t count = 0;
 
-    for (ptr<const Item> item : _invItems) {
-        if (item->GetProtoId() == pid) {
-            count += item->GetCount();
-        }
+    for (ptr<const Item> item : _invItemsIndex.GetByPid(pid)) {
+        count += item->GetCount();
     }
 
     return count;
@@ -39,6 +39,7 @@
 #include "EntityProtos.h"
 #include "EntitySync.h"
 #include "Geometry.h"
+#include "InventoryIndex.h"
 #include "Movement.h"
 #include "ServerEntity.h"
 
@@ -135,6 +136,7 @@ class Critter final : public ServerEntity, public EntityWithProto, public Critte
     void ClearVisibleEnitites();
     void SetItem(ptr<Item> item);
     void RemoveItem(ptr<Item> item);
+    void ReindexItemSlot(ptr<Item> item);
     void ChangeDir(mdir dir);
     void LockMapTransfers() noexcept;
     void UnlockMapTransfers() noexcept;
@@ -213,6 +215,7 @@ class Critter final : public ServerEntity, public EntityWithProto, public Critte
     nanotime _playerDetachTime {};
     vector<ptr<Critter>> _attachedCritters {};
     vector<ptr<Item>> _invItems {};
+    InventoryIndex<Item> _invItemsIndex {};
     vector<ptr<Critter>> _visibleCrWhoSeeMe {};
     vector<ptr<Critter>> _visibleCr {};
     unordered_map<ident_t, ptr<Critter>> _visibleCrWhoSeeMeMap {};
@@ -33,15 +33,741 @@
 
 #include "DataBase.h"
 
-FO_DISABLE_WARNINGS_PUSH()
-#include <bson/bson.h>
-#include <json.hpp>
-FO_DISABLE_WARNINGS_POP()
-
 #include "WinApiUndef.inc"
 
 FO_BEGIN_NAMESPACE
 
+// Storage files keep the layout of the former conversion chain: canonical extended JSON for numbers,
+// dict keys in byte order, nlohmann style indentation and escaping, so files written before stay byte-identical
+static constexpr size_t JSON_STORAGE_MAX_DEPTH = 128;
+
+static auto GetJsonStorageUtf8Length(string_view str, size_t pos) noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    const auto byte_at = [str, pos](size_t offset) noexcept -> uint8_t { return pos + offset < str.size() ? static_cast<uint8_t>(str[pos + offset]) : 0; };
+    const auto in_range = [](uint8_t value, uint8_t min_value, uint8_t max_value) noexcept { return value >= min_value && value <= max_value; };
+    const auto tail = [&](size_t from, size_t to) noexcept {
+        for (size_t i = from; i < to; i++) {
+            if (!in_range(byte_at(i), 0x80, 0xBF)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Strict RFC 3629 table, no overlong forms, surrogates or code points above U+10FFFF
+    const uint8_t c = byte_at(0);
+
+    if (in_range(c, 0xC2, 0xDF)) {
+        return tail(1, 2) ? 2 : 0;
+    }
+    if (c == 0xE0) {
+        return in_range(byte_at(1), 0xA0, 0xBF) && tail(2, 3) ? 3 : 0;
+    }
+    if (in_range(c, 0xE1, 0xEC) || in_range(c, 0xEE, 0xEF)) {
+        return tail(1, 3) ? 3 : 0;
+    }
+    if (c == 0xED) {
+        return in_range(byte_at(1), 0x80, 0x9F) && tail(2, 3) ? 3 : 0;
+    }
+    if (c == 0xF0) {
+        return in_range(byte_at(1), 0x90, 0xBF) && tail(2, 4) ? 4 : 0;
+    }
+    if (in_range(c, 0xF1, 0xF3)) {
+        return tail(1, 4) ? 4 : 0;
+    }
+    if (c == 0xF4) {
+        return in_range(byte_at(1), 0x80, 0x8F) && tail(2, 4) ? 4 : 0;
+    }
+
+    return 0;
+}
+
+static void AppendJsonStorageString(string& out, string_view str)
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    static constexpr string_view HEX_DIGITS = "0123456789abcdef";
+
+    out.push_back('"');
+
+    size_t run_start = 0;
+    size_t pos = 0;
+
+    while (pos < str.size()) {
+        const auto c = static_cast<uint8_t>(str[pos]);
+
+        if (c >= 0x20 && c < 0x80 && c != '"' && c != '\\') {
+            pos++;
+            continue;
+        }
+
+        if (c >= 0x80) {
+            const size_t seq_length = GetJsonStorageUtf8Length(str, pos);
+
+            if (seq_length == 0) {
+                throw DataBaseException("DbJson invalid utf8 string", pos);
+            }
+
+            pos += seq_length;
+            continue;
+        }
+
+        out.append(str.substr(run_start, pos - run_start));
+
+        switch (c) {
+        case '"':
+            out.append("\\\"");
+            break;
+        case '\\':
+            out.append("\\\\");
+            break;
+        case '\b':
+            out.append("\\b");
+            break;
+        case '\f':
+            out.append("\\f");
+            break;
+        case '\n':
+            out.append("\\n");
+            break;
+        case '\r':
+            out.append("\\r");
+            break;
+        case '\t':
+            out.append("\\t");
+            break;
+        default:
+            out.append("\\u00");
+            out.push_back(HEX_DIGITS[c >> 4]);
+            out.push_back(HEX_DIGITS[c & 0x0F]);
+            break;
+        }
+
+        pos++;
+        run_start = pos;
+    }
+
+    out.append(str.substr(run_start));
+    out.push_back('"');
+}
+
+static void AppendJsonStorageLineBreak(string& out, int32_t indent, size_t depth)
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (indent > 0) {
+        out.push_back('\n');
+        out.append(numeric_cast<size_t>(indent) * depth, ' ');
+    }
+}
+
+static void AppendJsonStorageKey(string& out, string_view key, int32_t indent)
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    AppendJsonStorageString(out, key);
+    out.append(indent > 0 ? ": " : ":");
+}
+
+static void AppendJsonStorageNumber(string& out, string_view type_key, string_view number, int32_t indent, size_t depth)
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    out.push_back('{');
+    AppendJsonStorageLineBreak(out, indent, depth + 1);
+    AppendJsonStorageKey(out, type_key, indent);
+    out.push_back('"');
+    out.append(number);
+    out.push_back('"');
+    AppendJsonStorageLineBreak(out, indent, depth);
+    out.push_back('}');
+}
+
+template<typename T>
+static void AppendJsonStorageDict(string& out, const T& dict, int32_t indent, size_t depth);
+
+static void AppendJsonStorageValue(string& out, const AnyData::PackedValue& value, int32_t indent, size_t depth)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    array<char, 64> number_buf {};
+    auto number_begin = make_ptr(number_buf.data());
+    ptr<char> number_end = number_begin.offset(number_buf.size());
+
+    switch (value.Type()) {
+    case AnyData::ValueType::Int64: {
+        const auto result = std::to_chars(number_begin.get(), number_end.get(), value.AsInt64());
+        FO_VERIFY_AND_THROW(result.ec == std::errc(), "Integer does not fit JSON storage number buffer", value.AsInt64());
+        AppendJsonStorageNumber(out, "$numberLong", string_view(number_begin.get(), result.ptr), indent, depth);
+        break;
+    }
+    case AnyData::ValueType::Float64: {
+        const float64_t double_value = value.AsDouble();
+
+        // Canonical extended JSON spells out the values a plain number can't hold
+        if (std::isnan(double_value)) {
+            AppendJsonStorageNumber(out, "$numberDouble", "NaN", indent, depth);
+            break;
+        }
+        if (std::isinf(double_value)) {
+            AppendJsonStorageNumber(out, "$numberDouble", double_value > 0.0 ? "Infinity" : "-Infinity", indent, depth);
+            break;
+        }
+
+        // Same text as libbson "%.20g" with ".0" appended to integral values
+        const auto result = std::to_chars(number_begin.get(), number_end.get(), double_value, std::chars_format::general, 20);
+        FO_VERIFY_AND_THROW(result.ec == std::errc(), "Double does not fit JSON storage number buffer", double_value);
+        string_view number {number_begin.get(), result.ptr};
+
+        if (number.find_first_not_of("0123456789-") == string_view::npos) {
+            string integral_number {number};
+            integral_number.append(".0");
+            AppendJsonStorageNumber(out, "$numberDouble", integral_number, indent, depth);
+        }
+        else {
+            AppendJsonStorageNumber(out, "$numberDouble", number, indent, depth);
+        }
+        break;
+    }
+    case AnyData::ValueType::Bool:
+        out.append(value.AsBool() ? "true" : "false");
+        break;
+    case AnyData::ValueType::String:
+        AppendJsonStorageString(out, value.AsString());
+        break;
+    case AnyData::ValueType::Array: {
+        const size_t count = value.Size();
+
+        if (count == 0) {
+            out.append("[]");
+            break;
+        }
+
+        out.push_back('[');
+
+        for (size_t i = 0; i < count; i++) {
+            if (i != 0) {
+                out.push_back(',');
+            }
+
+            AppendJsonStorageLineBreak(out, indent, depth + 1);
+            AppendJsonStorageValue(out, value.GetElement(i), indent, depth + 1);
+        }
+
+        AppendJsonStorageLineBreak(out, indent, depth);
+        out.push_back(']');
+        break;
+    }
+    case AnyData::ValueType::Dict:
+        AppendJsonStorageDict(out, value, indent, depth);
+        break;
+    default:
+        FO_UNREACHABLE_PLACE();
+    }
+}
+
+// Takes a packed dict value or a whole packed document, both index their entries the same way
+template<typename T>
+static void AppendJsonStorageDict(string& out, const T& dict, int32_t indent, size_t depth)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const size_t count = dict.Size();
+
+    if (count == 0) {
+        out.append("{}");
+        return;
+    }
+
+    out.push_back('{');
+
+    // Dict keys are already ordered bytewise, the order nlohmann objects were dumped in
+    for (size_t i = 0; i < count; i++) {
+        if (i != 0) {
+            out.push_back(',');
+        }
+
+        AppendJsonStorageLineBreak(out, indent, depth + 1);
+        AppendJsonStorageKey(out, dict.GetKey(i), indent);
+        AppendJsonStorageValue(out, dict.GetValue(i), indent, depth + 1);
+    }
+
+    AppendJsonStorageLineBreak(out, indent, depth);
+    out.push_back('}');
+}
+
+auto PackedDocumentToJsonStorage(const AnyData::PackedDocumentView& doc, int32_t indent) -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    string out;
+    out.reserve(4096);
+    AppendJsonStorageDict(out, doc, indent, 0);
+    return out;
+}
+
+auto DocumentToJsonStorage(const AnyData::Document& doc, int32_t indent) -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    return PackedDocumentToJsonStorage(AnyData::PackedDocument(doc).GetView(), indent);
+}
+
+class JsonStorageReader final
+{
+public:
+    explicit JsonStorageReader(string_view json) noexcept :
+        _json {json}
+    {
+    }
+
+    // Top level entries go to the packed builder as they are read, only nested containers become values
+    auto ReadDocument() -> AnyData::PackedDocument
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        AnyData::PackedDocumentBuilder builder;
+        unordered_set<string> keys;
+
+        SkipWhitespace();
+        Expect('{');
+
+        if (Peek() == '}') {
+            _pos++;
+        }
+        else {
+            while (true) {
+                string key = ReadString();
+                Expect(':');
+
+                auto value = ReadValue(1);
+
+                // First entry wins and the top level id is dropped, as BsonToDocument did
+                if (key != "_id" && keys.emplace(key).second) {
+                    builder.Add(key, value);
+                }
+
+                if (Peek() == ',') {
+                    _pos++;
+                    continue;
+                }
+
+                Expect('}');
+                break;
+            }
+        }
+
+        SkipWhitespace();
+
+        if (_pos != _json.size()) {
+            Fail("trailing data");
+        }
+
+        return builder.Finish();
+    }
+
+private:
+    [[noreturn]] void Fail(string_view reason) const { throw DataBaseException("DbJson invalid storage json", reason, _pos); }
+
+    void SkipWhitespace() noexcept
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        while (_pos < _json.size() && (_json[_pos] == ' ' || _json[_pos] == '\n' || _json[_pos] == '\r' || _json[_pos] == '\t')) {
+            _pos++;
+        }
+    }
+
+    [[nodiscard]] auto Peek() -> char
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        SkipWhitespace();
+
+        if (_pos == _json.size()) {
+            Fail("unexpected end");
+        }
+
+        return _json[_pos];
+    }
+
+    void Expect(char c)
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        if (Peek() != c) {
+            Fail("unexpected character");
+        }
+
+        _pos++;
+    }
+
+    void ReadLiteral(string_view literal)
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        if (_json.substr(_pos, literal.size()) != literal) {
+            Fail("unknown literal");
+        }
+
+        _pos += literal.size();
+    }
+
+    auto ReadHexCodeUnit() -> uint32_t
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        if (_json.size() - _pos < 4) {
+            Fail("truncated unicode escape");
+        }
+
+        uint32_t code_unit = 0;
+
+        for (size_t i = 0; i < 4; i++) {
+            const char c = _json[_pos++];
+            code_unit <<= 4;
+
+            if (c >= '0' && c <= '9') {
+                code_unit |= numeric_cast<uint32_t>(c - '0');
+            }
+            else if (c >= 'a' && c <= 'f') {
+                code_unit |= numeric_cast<uint32_t>(c - 'a' + 10);
+            }
+            else if (c >= 'A' && c <= 'F') {
+                code_unit |= numeric_cast<uint32_t>(c - 'A' + 10);
+            }
+            else {
+                Fail("invalid unicode escape");
+            }
+        }
+
+        return code_unit;
+    }
+
+    auto ReadString() -> string
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        Expect('"');
+
+        string result;
+        size_t run_start = _pos;
+
+        while (true) {
+            if (_pos == _json.size()) {
+                Fail("unterminated string");
+            }
+
+            const auto c = static_cast<uint8_t>(_json[_pos]);
+
+            if (c == '"') {
+                result.append(_json.substr(run_start, _pos - run_start));
+                _pos++;
+                return result;
+            }
+
+            if (c < 0x20) {
+                Fail("control character in string");
+            }
+
+            if (c >= 0x80) {
+                const size_t seq_length = GetJsonStorageUtf8Length(_json, _pos);
+
+                if (seq_length == 0) {
+                    Fail("invalid utf8 string");
+                }
+
+                _pos += seq_length;
+                continue;
+            }
+
+            if (c != '\\') {
+                _pos++;
+                continue;
+            }
+
+            result.append(_json.substr(run_start, _pos - run_start));
+            _pos++;
+
+            if (_pos == _json.size()) {
+                Fail("unterminated escape");
+            }
+
+            switch (_json[_pos++]) {
+            case '"':
+                result.push_back('"');
+                break;
+            case '\\':
+                result.push_back('\\');
+                break;
+            case '/':
+                result.push_back('/');
+                break;
+            case 'b':
+                result.push_back('\b');
+                break;
+            case 'f':
+                result.push_back('\f');
+                break;
+            case 'n':
+                result.push_back('\n');
+                break;
+            case 'r':
+                result.push_back('\r');
+                break;
+            case 't':
+                result.push_back('\t');
+                break;
+            case 'u': {
+                uint32_t code_point = ReadHexCodeUnit();
+
+                if (code_point >= 0xD800 && code_point <= 0xDBFF) {
+                    if (_json.substr(_pos, 2) != "\\u") {
+                        Fail("unpaired surrogate");
+                    }
+
+                    _pos += 2;
+                    const uint32_t low_surrogate = ReadHexCodeUnit();
+
+                    if (low_surrogate < 0xDC00 || low_surrogate > 0xDFFF) {
+                        Fail("unpaired surrogate");
+                    }
+
+                    code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low_surrogate - 0xDC00);
+                }
+                else if (code_point >= 0xDC00 && code_point <= 0xDFFF) {
+                    Fail("unpaired surrogate");
+                }
+
+                char utf8_buf[4];
+                const size_t utf8_length = utf8::Encode(code_point, utf8_buf);
+                result.append(utf8_buf, utf8_length);
+                break;
+            }
+            default:
+                Fail("unknown escape");
+            }
+
+            run_start = _pos;
+        }
+    }
+
+    auto ReadPlainNumber() -> AnyData::Value
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        const size_t start = _pos;
+        bool is_float = false;
+
+        while (_pos < _json.size()) {
+            const char c = _json[_pos];
+
+            if (c == '.' || c == 'e' || c == 'E') {
+                is_float = true;
+            }
+            else if ((c < '0' || c > '9') && c != '-' && c != '+') {
+                break;
+            }
+
+            _pos++;
+        }
+
+        const string_view number = _json.substr(start, _pos - start);
+        return is_float ? AnyData::Value(ParseDouble(number)) : AnyData::Value(ParseInteger<int64_t>(number));
+    }
+
+    template<typename T>
+    auto ParseInteger(string_view number) const -> int64_t
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        T value {};
+        auto parse_begin = make_nptr(number.data());
+        ptr<const char> parse_end = parse_begin.offset(number.size());
+        const auto result = std::from_chars(parse_begin.get(), parse_end.get(), value);
+
+        if (number.empty() || result.ec != std::errc() || result.ptr != parse_end.get()) {
+            Fail("invalid integer");
+        }
+
+        return numeric_cast<int64_t>(value);
+    }
+
+    auto ParseDouble(string_view number) const -> float64_t
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        if (number == "Infinity") {
+            return std::numeric_limits<float64_t>::infinity();
+        }
+        if (number == "-Infinity") {
+            return -std::numeric_limits<float64_t>::infinity();
+        }
+        if (number == "NaN") {
+            return std::numeric_limits<float64_t>::quiet_NaN();
+        }
+
+        float64_t value {};
+        auto parse_begin = make_nptr(number.data());
+        ptr<const char> parse_end = parse_begin.offset(number.size());
+        const auto result = std::from_chars(parse_begin.get(), parse_end.get(), value);
+
+        if (number.empty() || result.ec != std::errc() || result.ptr != parse_end.get()) {
+            Fail("invalid double");
+        }
+        if (!std::isfinite(value)) {
+            Fail("invalid double");
+        }
+
+        return value;
+    }
+
+    auto ReadArray(size_t depth) -> AnyData::Array
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        AnyData::Array arr;
+
+        if (Peek() == ']') {
+            _pos++;
+            return arr;
+        }
+
+        while (true) {
+            arr.EmplaceBack(ReadValue(depth + 1));
+
+            if (Peek() == ',') {
+                _pos++;
+                continue;
+            }
+
+            Expect(']');
+            return arr;
+        }
+    }
+
+    // Opening brace is consumed, reads up to and including the closing one
+    void ReadDictEntries(AnyData::Dict& dict, size_t depth)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        if (Peek() == '}') {
+            _pos++;
+            return;
+        }
+
+        while (true) {
+            string key = ReadString();
+            Expect(':');
+
+            auto value = ReadValue(depth + 1);
+
+            // First entry wins
+            dict.Emplace(std::move(key), std::move(value));
+
+            if (Peek() == ',') {
+                _pos++;
+                continue;
+            }
+
+            Expect('}');
+            return;
+        }
+    }
+
+    auto ReadObject(size_t depth) -> AnyData::Value
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        // Extended JSON number wrapper is a single string entry, anything else is read as a regular dict
+        if (Peek() == '"') {
+            const size_t key_pos = _pos;
+            const string key = ReadString();
+
+            if (key == "$numberLong" || key == "$numberInt" || key == "$numberDouble") {
+                Expect(':');
+
+                if (Peek() == '"') {
+                    const string number = ReadString();
+
+                    if (Peek() == '}') {
+                        _pos++;
+
+                        if (key == "$numberLong") {
+                            return ParseInteger<int64_t>(number);
+                        }
+                        if (key == "$numberInt") {
+                            return ParseInteger<int32_t>(number);
+                        }
+
+                        return ParseDouble(number);
+                    }
+                }
+            }
+
+            _pos = key_pos;
+        }
+
+        AnyData::Dict dict;
+        ReadDictEntries(dict, depth);
+        return std::move(dict);
+    }
+
+    auto ReadValue(size_t depth) -> AnyData::Value
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        if (depth > JSON_STORAGE_MAX_DEPTH) {
+            Fail("nesting is too deep");
+        }
+
+        const char c = Peek();
+
+        switch (c) {
+        case '{':
+            _pos++;
+            return ReadObject(depth);
+        case '[':
+            _pos++;
+            return ReadArray(depth);
+        case '"':
+            return ReadString();
+        case 't':
+            ReadLiteral("true");
+            return true;
+        case 'f':
+            ReadLiteral("false");
+            return false;
+        default:
+            if (c == '-' || (c >= '0' && c <= '9')) {
+                return ReadPlainNumber();
+            }
+
+            Fail("unsupported value");
+        }
+    }
+
+    string_view _json;
+    size_t _pos {};
+};
+
+auto JsonStorageToPackedDocument(string_view json) -> AnyData::PackedDocument
+{
+    FO_STACK_TRACE_ENTRY();
+
+    JsonStorageReader reader {json};
+    return reader.ReadDocument();
+}
+
+void JsonStorageToDocument(string_view json, AnyData::Document& doc)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    doc = JsonStorageToPackedDocument(json).ToDocument();
+}
+
 class DbJson final : public DataBaseImpl
 {
 public:
@@ -128,7 +854,7 @@ class DbJson final : public DataBaseImpl
     }
 
 protected:
-    [[nodiscard]] auto GetRecord(hstring collection_name, const DataBaseKey& id) const -> AnyData::Document override
+    [[nodiscard]] auto GetRecord(hstring collection_name, const DataBaseKey& id) const -> AnyData::PackedDocument override
     {
         FO_STACK_TRACE_ENTRY();
 
@@ -142,21 +868,10 @@ class DbJson final : public DataBaseImpl
             return {};
         }
 
-        bson_t bson;
-        bson_error_t error;
-
-        if (!bson_init_from_json(&bson, json->c_str(), numeric_cast<ssize_t>(json->length()), &error)) {
-            throw DataBaseException("DbJson bson_init_from_json", path);
-        }
-
-        AnyData::Document doc;
-        BsonToDocument(&bson, doc);
-
-        bson_destroy(&bson);
-        return doc;
+        return JsonStorageToPackedDocument(*json);
     }
 
-    void InsertRecord(hstring collection_name, const DataBaseKey& id, const AnyData::Document& doc) override
+    void InsertRecord(hstring collection_name, const DataBaseKey& id, const AnyData::PackedDocument& doc) override
     {
         FO_STACK_TRACE_ENTRY();
 
@@ -170,43 +885,10 @@ class DbJson final : public DataBaseImpl
             throw DataBaseException("DbJson File exists for inserting", path);
         }
 
-        bson_t bson;
-        bson_init(&bson);
-        DocumentToBson(doc, &bson);
-
-        size_t length = 0;
-        auto json_lookup = make_nptr(bson_as_canonical_extended_json(&bson, &length));
-
-        if (!json_lookup) {
-            throw DataBaseException("DbJson bson_as_canonical_extended_json", path);
-        }
-
-        auto json = make_unique_del_ptr(json_lookup, [](ptr<char> text) FO_DEFERRED { bson_free(text.get()); });
-        bson_destroy(&bson);
-
-        auto pretty_json = nlohmann::json::parse(json.get());
-        auto pretty_json_dump = pretty_json.dump(_jsonIndent > 0 ? _jsonIndent : -1);
-
-        string dir = strex(path).extract_dir().str();
-
-        if (!dir.empty() && !fs_create_directories(dir)) {
-            throw DataBaseException("DbJson Can't open file", path);
-        }
-
-        string tmp_path = strex("{}.tmp", path).str();
-
-        if (!fs_write_file(tmp_path, pretty_json_dump)) {
-            fs_remove_file(tmp_path);
-            throw DataBaseException("DbJson Can't write file", path);
-        }
-
-        if (!fs_rename(tmp_path, path)) {
-            fs_remove_file(tmp_path);
-            throw DataBaseException("DbJson Can't commit file", path);
-        }
+        WriteRecordFile(path, PackedDocumentToJsonStorage(doc.GetView(), _jsonIndent));
     }
 
-    void UpdateRecord(hstring collection_name, const DataBaseKey& id, const AnyData::Document& doc) override
+    void UpdateRecord(hstring collection_name, const DataBaseKey& id, const AnyData::PackedDocument& doc) override
     {
         FO_STACK_TRACE_ENTRY();
 
@@ -222,27 +904,30 @@ class DbJson final : public DataBaseImpl
             throw DataBaseException("DbJson Can't open file for reading", path);
         }
 
-        bson_t bson;
-        bson_error_t error;
+        // Top level keys of the patch replace stored ones, everything else is kept as is
+        const auto stored_doc = JsonStorageToPackedDocument(*json);
+        const auto merged_doc = AnyData::PackedDocument(stored_doc.GetView(), doc.GetView());
 
-        if (!bson_init_from_json(&bson, json->c_str(), numeric_cast<ssize_t>(json->length()), &error)) {
-            throw DataBaseException("DbJson bson_init_from_json", path);
-        }
+        WriteRecordFile(path, PackedDocumentToJsonStorage(merged_doc.GetView(), _jsonIndent));
+    }
 
-        DocumentToBson(doc, &bson);
+    void DeleteRecord(hstring collection_name, const DataBaseKey& id) override
+    {
+        FO_STACK_TRACE_ENTRY();
 
-        size_t new_length = 0;
-        auto new_json_lookup = make_nptr(bson_as_canonical_extended_json(&bson, &new_length));
+        scoped_lock locker {_storageLocker};
 
-        if (!new_json_lookup) {
-            throw DataBaseException("DbJson bson_as_canonical_extended_json", path);
-        }
+        string path = strex("{}/{}/{}.json", _storageDir, collection_name, FormatJsonStorageDbKey(id, GetCollectionKeyType(collection_name)));
 
-        auto new_json = make_unique_del_ptr(new_json_lookup, [](ptr<char> text) FO_DEFERRED { bson_free(text.get()); });
-        bson_destroy(&bson);
+        if (!fs_remove_file(path)) {
+            throw DataBaseException("DbJson Can't delete file", path);
+        }
+    }
 
-        auto pretty_json = nlohmann::json::parse(new_json.get());
-        auto pretty_json_dump = pretty_json.dump(_jsonIndent > 0 ? _jsonIndent : -1);
+private:
+    static void WriteRecordFile(const string& path, string_view json)
+    {
+        FO_STACK_TRACE_ENTRY();
 
         string dir = strex(path).extract_dir().str();
 
@@ -252,7 +937,7 @@ class DbJson final : public DataBaseImpl
 
         string tmp_path = strex("{}.tmp", path).str();
 
-        if (!fs_write_file(tmp_path, pretty_json_dump)) {
+        if (!fs_write_file(tmp_path, json)) {
             fs_remove_file(tmp_path);
             throw DataBaseException("DbJson Can't write file", path);
         }
@@ -263,20 +948,6 @@ class DbJson final : public DataBaseImpl
         }
     }
 
-    void DeleteRecord(hstring collection_name, const DataBaseKey& id) override
-    {
-        FO_STACK_TRACE_ENTRY();
-
-        scoped_lock locker {_storageLocker};
-
-        string path = strex("{}/{}/{}.json", _storageDir, collection_name, FormatJsonStorageDbKey(id, GetCollectionKeyType(collection_name)));
-
-        if (!fs_remove_file(path)) {
-            throw DataBaseException("DbJson Can't delete file", path);
-        }
-    }
-
-private:
     static auto FormatJsonStorageDbKey(const DataBaseKey& key, DataBaseKeyType key_type) -> string
     {
         if (GetDbKeyType(key) != key_type) {
@@ -308,7 +979,6 @@ class DbJson final : public DataBaseImpl
 
 auto CreateJsonDataBase(ptr<DataBaseSettings> db_settings, string_view storage_dir, DataBasePanicCallback panic_callback) -> unique_ptr<DataBaseImpl>
 {
-    InitializeBsonMemory();
     return SafeAlloc::MakeUnique<DbJson>(db_settings, storage_dir, std::move(panic_callback));
 }
 
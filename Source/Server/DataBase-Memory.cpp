@@ -83,7 +83,7 @@ class DbMemory final : public DataBaseImpl
     }
 
 protected:
-    [[nodiscard]] auto GetRecord(hstring collection_name, const DataBaseKey& id) const -> AnyData::Document override
+    [[nodiscard]] auto GetRecord(hstring collection_name, const DataBaseKey& id) const -> AnyData::PackedDocument override
     {
         FO_STACK_TRACE_ENTRY();
 
@@ -92,10 +92,10 @@ class DbMemory final : public DataBaseImpl
         const auto& collection = _collections.at(collection_name);
 
         auto it = collection.find(id);
-        return it != collection.end() ? it->second.Copy() : AnyData::Document();
+        return it != collection.end() ? it->second.Copy() : AnyData::PackedDocument();
     }
 
-    void InsertRecord(hstring collection_name, const DataBaseKey& id, const AnyData::Document& doc) override
+    void InsertRecord(hstring collection_name, const DataBaseKey& id, const AnyData::PackedDocument& doc) override
     {
         FO_STACK_TRACE_ENTRY();
 
@@ -109,7 +109,7 @@ class DbMemory final : public DataBaseImpl
         collection.emplace(id, doc.Copy());
     }
 
-    void UpdateRecord(hstring collection_name, const DataBaseKey& id, const AnyData::Document& doc) override
+    void UpdateRecord(hstring collection_name, const DataBaseKey& id, const AnyData::PackedDocument& doc) override
     {
         FO_STACK_TRACE_ENTRY();
 
@@ -117,17 +117,8 @@ class DbMemory final : public DataBaseImpl
 
         scoped_lock locker {_storageLocker};
 
-        auto& collection = _collections.at(collection_name);
-
-        auto it_collection = collection.find(id);
-
-        if (it_collection == collection.end()) {
-            throw DataBaseException("DbMemory Document not found for update", collection_name, id);
-        }
-
-        for (auto&& [doc_key, doc_value] : doc) {
-            it_collection->second.Assign(doc_key, doc_value.Copy());
-        }
+        auto& record = FindRecordForUpdate(collection_name, id);
+        record = AnyData::PackedDocument(record.GetView(), doc.GetView());
     }
 
     void DeleteRecord(hstring collection_name, const DataBaseKey& id) override
@@ -196,14 +187,16 @@ class DbMemory final : public DataBaseImpl
             coll_entry.id = static_cast<const void*>(&collection);
             coll_entry.docs.reserve(collection.size());
 
-            for (auto&& [id, doc] : collection) {
+            for (auto&& [id, packed_doc] : collection) {
+                const auto doc = packed_doc.GetView();
+
                 DocEntry doc_entry;
                 doc_entry.label = strex("{} ({} keys)", id, doc.Size()).str();
-                doc_entry.id = static_cast<const void*>(&doc);
+                doc_entry.id = static_cast<const void*>(&packed_doc);
                 doc_entry.fields.reserve(doc.Size());
 
-                for (auto&& [doc_key, doc_value] : doc) {
-                    doc_entry.fields.emplace_back(FieldRow {doc_key, AnyData::ValueToString(doc_value)});
+                for (size_t i = 0; i < doc.Size(); i++) {
+                    doc_entry.fields.emplace_back(FieldRow {string(doc.GetKey(i)), AnyData::ValueToString(doc.GetValue(i).ToValue())});
                 }
 
                 coll_entry.docs.emplace_back(std::move(doc_entry));
@@ -259,8 +252,26 @@ class DbMemory final : public DataBaseImpl
     }
 
 private:
+    // Records are kept packed, one flat buffer per document instead of a tree of values
+    using PackedCollection = unordered_map<DataBaseKey, AnyData::PackedDocument>;
+
+    [[nodiscard]] AnyData::PackedDocument& FindRecordForUpdate(hstring collection_name, const DataBaseKey& id) FO_TSA_REQUIRES(_storageLocker)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        auto& collection = _collections.at(collection_name);
+
+        auto it_collection = collection.find(id);
+
+        if (it_collection == collection.end()) {
+            throw DataBaseException("DbMemory Document not found for update", collection_name, id);
+        }
+
+        return it_collection->second;
+    }
+
     mutable mutex _storageLocker {};
-    DataBase::Collections _collections FO_TSA_GUARDED_BY(_storageLocker) {};
+    unordered_map<hstring, PackedCollection> _collections FO_TSA_GUARDED_BY(_storageLocker) {};
 };
 
 auto CreateMemoryDataBase(ptr<DataBaseSettings> db_settings, DataBasePanicCallback panic_callback) -> unique_ptr<DataBaseImpl>
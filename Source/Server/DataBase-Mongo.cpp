@@ -32,6 +32,7 @@
 //
 
 #include "DataBase.h"
+#include "DataBaseBulkWriter.h"
 
 #if FO_HAVE_MONGO
 FO_DISABLE_WARNINGS_PUSH()
@@ -46,7 +47,7 @@ FO_BEGIN_NAMESPACE
 #if FO_HAVE_MONGO
 FO_CLANG_IGNORE_WARNINGS_PUSH("-Walign-mismatch")
 
-class DbMongo final : public DataBaseImpl
+class DbMongo final : public DataBaseImpl, private DataBaseBulkSink
 {
 public:
     DbMongo(const DbMongo&) = delete;
@@ -56,7 +57,10 @@ class DbMongo final : public DataBaseImpl
 
     explicit DbMongo(ptr<DataBaseSettings> db_settings, string_view uri, string_view db_name, DataBasePanicCallback panic_callback) :
         DataBaseImpl(db_settings, std::move(panic_callback)),
-        _escapeDot {db_settings->MongoEscapeChar.empty() ? '\0' : db_settings->MongoEscapeChar.front()}
+        _escapeDot {db_settings->MongoEscapeChar.empty() ? '\0' : db_settings->MongoEscapeChar.front()},
+        _commitBatchSize {numeric_cast<size_t>(std::max(db_settings->MongoCommitBatchSize, 1))},
+        _commitFlushInterval {std::chrono::milliseconds {std::max(db_settings->MongoCommitFlushInterval, 0)}},
+        _bulkWriter {this}
     {
         FO_STACK_TRACE_ENTRY();
 
@@ -187,6 +191,8 @@ class DbMongo final : public DataBaseImpl
 
 protected:
     [[nodiscard]] auto GetStringKeyEscaping() const noexcept -> DataBaseStringKeyEscaping override { return DataBaseStringKeyEscaping::Raw; }
+    [[nodiscard]] auto GetCommitBatchSize() const noexcept -> size_t override { return _commitBatchSize; }
+    [[nodiscard]] auto GetCommitFlushInterval() const noexcept -> timespan override { return _commitFlushInterval; }
 
     void EnsureCollection(hstring collection_name, DataBaseKeyType key_type) override
     {
@@ -295,7 +301,7 @@ class DbMongo final : public DataBaseImpl
     }
 
 protected:
-    [[nodiscard]] auto GetRecord(hstring collection_name, const DataBaseKey& id) const -> AnyData::Document override
+    [[nodiscard]] auto GetRecord(hstring collection_name, const DataBaseKey& id) const -> AnyData::PackedDocument override
     {
         FO_STACK_TRACE_ENTRY();
 
@@ -331,8 +337,7 @@ class DbMongo final : public DataBaseImpl
         }
 
         FO_VERIFY_AND_THROW(bson, "Cursor returned a null document");
-        AnyData::Document doc;
-        BsonToDocument(bson, doc, _escapeDot);
+        auto doc = BsonToPackedDocument(bson, _escapeDot);
 
         mongoc_cursor_destroy(cursor.get());
         bson_destroy(&filter);
@@ -340,12 +345,17 @@ class DbMongo final : public DataBaseImpl
         return doc;
     }
 
-    void InsertRecord(hstring collection_name, const DataBaseKey& id, const AnyData::Document& doc) override
+    void InsertRecord(hstring collection_name, const DataBaseKey& id, const AnyData::PackedDocument& doc) override
     {
         FO_STACK_TRACE_ENTRY();
 
         FO_VERIFY_AND_THROW(!doc.Empty(), "Mongo database insert received an empty document", collection_name, id);
 
+        if (_bulkWriter.IsOpen()) {
+            _bulkWriter.Add(collection_name, DataBaseBulkOperationType::Insert, id, doc.Copy());
+            return;
+        }
+
         scoped_lock locker {_storageLocker};
 
         ptr<mongoc_collection_t> collection = GetCollection(collection_name);
@@ -355,7 +365,7 @@ class DbMongo final : public DataBaseImpl
 
         AppendMongoDbKey(&insert, id, collection_name);
 
-        DocumentToBson(doc, &insert, _escapeDot);
+        PackedDocumentToBson(doc.GetView(), &insert, _escapeDot);
 
         bson_error_t error;
 
@@ -366,12 +376,17 @@ class DbMongo final : public DataBaseImpl
         bson_destroy(&insert);
     }
 
-    void UpdateRecord(hstring collection_name, const DataBaseKey& id, const AnyData::Document& doc) override
+    void UpdateRecord(hstring collection_name, const DataBaseKey& id, const AnyData::PackedDocument& doc) override
     {
         FO_STACK_TRACE_ENTRY();
 
         FO_VERIFY_AND_THROW(!doc.Empty(), "Mongo database update received an empty document", collection_name, id);
 
+        if (_bulkWriter.IsOpen()) {
+            _bulkWriter.Add(collection_name, DataBaseBulkOperationType::Update, id, doc.Copy());
+            return;
+        }
+
         scoped_lock locker {_storageLocker};
 
         ptr<mongoc_collection_t> collection = GetCollection(collection_name);
@@ -390,7 +405,7 @@ class DbMongo final : public DataBaseImpl
             throw DataBaseException("DbMongo bson_append_document_begin", collection_name, FormatMongoDbKey(id));
         }
 
-        DocumentToBson(doc, &update_set, _escapeDot);
+        PackedDocumentToBson(doc.GetView(), &update_set, _escapeDot);
 
         if (!bson_append_document_end(&update, &update_set)) {
             throw DataBaseException("DbMongo bson_append_document_end", collection_name, FormatMongoDbKey(id));
@@ -410,6 +425,11 @@ class DbMongo final : public DataBaseImpl
     {
         FO_STACK_TRACE_ENTRY();
 
+        if (_bulkWriter.IsOpen()) {
+            _bulkWriter.Add(collection_name, DataBaseBulkOperationType::Delete, id, {});
+            return;
+        }
+
         scoped_lock locker {_storageLocker};
 
         ptr<mongoc_collection_t> collection = GetCollection(collection_name);
@@ -428,6 +448,37 @@ class DbMongo final : public DataBaseImpl
         bson_destroy(&selector);
     }
 
+    void BeginCommitBatch() override
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        if (_commitBatchSize == 1) {
+            return;
+        }
+
+        _bulkWriter.Begin();
+    }
+
+    void EndCommitBatch() override
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        if (!_bulkWriter.IsOpen()) {
+            return;
+        }
+
+        _bulkWriter.Flush();
+    }
+
+    void AbortCommitBatch() noexcept override
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        _bulkWriter.Discard();
+    }
+
+    [[nodiscard]] auto IsCommitBatchOperationApplied(size_t index) const noexcept -> bool override { return _bulkWriter.IsOperationApplied(index); }
+
     auto TryReconnect() -> bool override
     {
         FO_STACK_TRACE_ENTRY();
@@ -457,6 +508,95 @@ class DbMongo final : public DataBaseImpl
     }
 
 private:
+    auto ExecuteBulk(hstring collection_name, const_span<DataBaseBulkOperation> ops) -> optional<DataBaseBulkFailure> override
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        scoped_lock locker {_storageLocker};
+
+        ptr<mongoc_collection_t> collection = GetCollection(collection_name);
+
+        bson_t opts;
+        bson_init(&opts);
+
+        if (!bson_append_bool(&opts, "ordered", 7, true)) {
+            throw DataBaseException("DbMongo bson_append_bool", collection_name);
+        }
+
+        auto bulk = make_nptr(mongoc_collection_create_bulk_operation_with_opts(collection.get(), &opts));
+        bson_destroy(&opts);
+
+        if (!bulk) {
+            throw DataBaseException("DbMongo mongoc_collection_create_bulk_operation_with_opts", collection_name);
+        }
+
+        auto bulk_guard = scope_exit([&]() noexcept { mongoc_bulk_operation_destroy(bulk.get()); });
+        bson_error_t error;
+
+        for (const auto& op : ops) {
+            bson_t selector;
+            bson_init(&selector);
+            auto selector_guard = scope_exit([&]() noexcept { bson_destroy(&selector); });
+
+            AppendMongoDbKey(&selector, op.RecordId, collection_name);
+
+            switch (op.Type) {
+            case DataBaseBulkOperationType::Insert: {
+                PackedDocumentToBson(op.Doc.GetView(), &selector, _escapeDot);
+
+                if (!mongoc_bulk_operation_insert_with_opts(bulk.get(), &selector, nullptr, &error)) {
+                    throw DataBaseException("DbMongo mongoc_bulk_operation_insert_with_opts", collection_name, op.RecordId, error.message);
+                }
+            } break;
+            case DataBaseBulkOperationType::Update: {
+                bson_t update;
+                bson_init(&update);
+                auto update_guard = scope_exit([&]() noexcept { bson_destroy(&update); });
+                bson_t update_set;
+
+                if (!bson_append_document_begin(&update, "$set", 4, &update_set)) {
+                    throw DataBaseException("DbMongo bson_append_document_begin", collection_name, FormatMongoDbKey(op.RecordId));
+                }
+
+                PackedDocumentToBson(op.Doc.GetView(), &update_set, _escapeDot);
+
+                if (!bson_append_document_end(&update, &update_set)) {
+                    throw DataBaseException("DbMongo bson_append_document_end", collection_name, FormatMongoDbKey(op.RecordId));
+                }
+
+                if (!mongoc_bulk_operation_update_one_with_opts(bulk.get(), &selector, &update, nullptr, &error)) {
+                    throw DataBaseException("DbMongo mongoc_bulk_operation_update_one_with_opts", collection_name, op.RecordId, error.message);
+                }
+            } break;
+            case DataBaseBulkOperationType::Delete: {
+                if (!mongoc_bulk_operation_remove_one_with_opts(bulk.get(), &selector, nullptr, &error)) {
+                    throw DataBaseException("DbMongo mongoc_bulk_operation_remove_one_with_opts", collection_name, op.RecordId, error.message);
+                }
+            } break;
+            }
+        }
+
+        // The reply is initialized on failure too; an ordered bulk stops at the first write error and names it by index
+        bson_t reply;
+        const auto server_id = mongoc_bulk_operation_execute(bulk.get(), &reply, &error);
+        auto reply_guard = scope_exit([&]() noexcept { bson_destroy(&reply); });
+
+        if (server_id != 0) {
+            return std::nullopt;
+        }
+
+        DataBaseBulkFailure failure {.Message = error.message};
+        bson_iter_t errors_iter;
+        bson_iter_t error_doc_iter;
+        bson_iter_t error_iter;
+
+        if (bson_iter_init_find(&errors_iter, &reply, "writeErrors") && BSON_ITER_HOLDS_ARRAY(&errors_iter) && bson_iter_recurse(&errors_iter, &error_doc_iter) && bson_iter_next(&error_doc_iter) && BSON_ITER_HOLDS_DOCUMENT(&error_doc_iter) && bson_iter_recurse(&error_doc_iter, &error_iter) && bson_iter_find(&error_iter, "index") && BSON_ITER_HOLDS_INT(&error_iter)) {
+            failure.OperationIndex = numeric_cast<size_t>(bson_iter_as_int64(&error_iter));
+        }
+
+        return failure;
+    }
+
     ptr<mongoc_collection_t> GetCollection(hstring collection_name) const FO_TSA_REQUIRES(_storageLocker)
     {
         FO_STACK_TRACE_ENTRY();
@@ -528,6 +668,9 @@ class DbMongo final : public DataBaseImpl
     nptr<mongoc_database_t> _database FO_TSA_GUARDED_BY(_storageLocker) {};
     unordered_map<string, ptr<mongoc_collection_t>> _collections FO_TSA_GUARDED_BY(_storageLocker) {};
     char _escapeDot {};
+    size_t _commitBatchSize;
+    timespan _commitFlushInterval;
+    DataBaseBulkWriter _bulkWriter;
 };
 
 auto CreateMongoDataBase(ptr<DataBaseSettings> db_settings, string_view uri, string_view db_name, DataBasePanicCallback panic_callback) -> unique_ptr<DataBaseImpl>
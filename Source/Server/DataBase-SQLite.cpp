@@ -207,7 +207,10 @@ class DbSQLite final : public DataBaseImpl
 
     explicit DbSQLite(ptr<DataBaseSettings> db_settings, string_view storage_dir, DataBasePanicCallback panic_callback) :
         DataBaseImpl(db_settings, std::move(panic_callback)),
-        _storageDir {storage_dir}
+        _storageDir {storage_dir},
+        _synchronous {ParseSynchronousLevel(db_settings->SQLiteSynchronous)},
+        _commitBatchSize {numeric_cast<size_t>(std::max(db_settings->SQLiteCommitBatchSize, 1))},
+        _hotKeys {ParseHotProperties(db_settings->SQLiteHotProperties)}
     {
         FO_STACK_TRACE_ENTRY();
 
@@ -228,6 +231,13 @@ class DbSQLite final : public DataBaseImpl
 
         _collections.clear();
 
+        // Cached statements hold the connection open, so they are finalized first
+        for (auto stmt : _cachedStatements) {
+            (void)sqlite3_finalize(stmt.get());
+        }
+
+        _cachedStatements.clear();
+
         if (_db) {
             (void)sqlite3_close(_db.get());
             _db = nullptr;
@@ -236,6 +246,7 @@ class DbSQLite final : public DataBaseImpl
 
 protected:
     [[nodiscard]] auto GetStringKeyEscaping() const noexcept -> DataBaseStringKeyEscaping override { return DataBaseStringKeyEscaping::Hex; }
+    [[nodiscard]] auto GetCommitBatchSize() const noexcept -> size_t override { return _commitBatchSize; }
 
     void EnsureCollection(hstring collection_name, DataBaseKeyType key_type) override
     {
@@ -249,9 +260,45 @@ class DbSQLite final : public DataBaseImpl
             return;
         }
 
-        string sql = strex("CREATE TABLE IF NOT EXISTS {} (key BLOB PRIMARY KEY NOT NULL, value BLOB NOT NULL) WITHOUT ROWID", QuoteIdentifier(collection_name.as_str())).str();
+        string table = QuoteIdentifier(collection_name.as_str());
+        string sql = strex("CREATE TABLE IF NOT EXISTS {} (key BLOB PRIMARY KEY NOT NULL, value BLOB NOT NULL) WITHOUT ROWID", table).str();
         Execute(sql, collection_name);
-        _collections.emplace(collection_name);
+
+        // Columns created for keys since dropped from the setting still hold the newest values, so every existing
+        // hot column keeps being served; configured keys without a column yet get one added
+        vector<string> hot_keys = ReadHotColumnKeys(collection_name);
+
+        if (const auto it = _hotKeys.find(collection_name.as_str()); it != _hotKeys.end()) {
+            for (const auto& hot_key : it->second) {
+                if (std::ranges::find(hot_keys, hot_key) == hot_keys.end()) {
+                    Execute(strex("ALTER TABLE {} ADD COLUMN {} BLOB", table, QuoteIdentifier(MakeHotColumnName(hot_key))).str(), collection_name);
+                    hot_keys.emplace_back(hot_key);
+                }
+            }
+        }
+
+        CollectionData collection;
+        string select_columns = "value";
+        string insert_columns = "key, value";
+        string insert_params = "?1, ?2";
+
+        for (size_t i = 0; i < hot_keys.size(); i++) {
+            string column = QuoteIdentifier(MakeHotColumnName(hot_keys[i]));
+            select_columns += strex(", {}", column).str();
+            insert_columns += strex(", {}", column).str();
+            insert_params += strex(", ?{}", i + 3).str();
+            collection.HotKeyIndices.emplace(hot_keys[i], i);
+            collection.UpdateHotStmts.emplace_back(PrepareCached(strex("UPDATE {} SET {} = ?2 WHERE key = ?1", table, column).str(), collection_name));
+        }
+
+        collection.SelectStmt = PrepareCached(strex("SELECT {} FROM {} WHERE key = ?1", select_columns, table).str(), collection_name);
+        collection.SelectValueStmt = PrepareCached(strex("SELECT value FROM {} WHERE key = ?1", table).str(), collection_name);
+        collection.InsertStmt = PrepareCached(strex("INSERT INTO {} ({}) VALUES ({})", table, insert_columns, insert_params).str(), collection_name);
+        collection.UpdateValueStmt = PrepareCached(strex("UPDATE {} SET value = ?2 WHERE key = ?1", table).str(), collection_name);
+        collection.DeleteStmt = PrepareCached(strex("DELETE FROM {} WHERE key = ?1", table).str(), collection_name);
+        collection.HotKeys = std::move(hot_keys);
+
+        _collections.emplace(collection_name, std::move(collection));
     }
 
     [[nodiscard]] auto GetAllRecordIds(hstring collection_name) const -> vector<DataBaseKey> override
@@ -275,7 +322,7 @@ class DbSQLite final : public DataBaseImpl
         return ids;
     }
 
-    [[nodiscard]] auto GetRecord(hstring collection_name, const DataBaseKey& id) const -> AnyData::Document override
+    [[nodiscard]] auto GetRecord(hstring collection_name, const DataBaseKey& id) const -> AnyData::PackedDocument override
     {
         FO_STACK_TRACE_ENTRY();
 
@@ -284,7 +331,7 @@ class DbSQLite final : public DataBaseImpl
         return GetRecordUnlocked(collection_name, id);
     }
 
-    void InsertRecord(hstring collection_name, const DataBaseKey& id, const AnyData::Document& doc) override
+    void InsertRecord(hstring collection_name, const DataBaseKey& id, const AnyData::PackedDocument& doc) override
     {
         FO_STACK_TRACE_ENTRY();
 
@@ -292,15 +339,10 @@ class DbSQLite final : public DataBaseImpl
 
         scoped_lock locker {_storageLocker};
 
-        VerifyCollection(collection_name);
-
-        auto key = MakeSqliteKey(id, GetCollectionKeyType(collection_name));
-        string sql = strex("INSERT INTO {} (key, value) VALUES (?, ?)", QuoteIdentifier(collection_name.as_str())).str();
-
-        WriteDocument(sql, collection_name, id, key, doc);
+        InsertRecordUnlocked(collection_name, id, doc);
     }
 
-    void UpdateRecord(hstring collection_name, const DataBaseKey& id, const AnyData::Document& doc) override
+    void UpdateRecord(hstring collection_name, const DataBaseKey& id, const AnyData::PackedDocument& doc) override
     {
         FO_STACK_TRACE_ENTRY();
 
@@ -308,22 +350,62 @@ class DbSQLite final : public DataBaseImpl
 
         scoped_lock locker {_storageLocker};
 
-        VerifyCollection(collection_name);
+        const auto& collection = GetCollection(collection_name);
+        auto key = MakeSqliteKey(id, GetCollectionKeyType(collection_name));
+        const auto patch = doc.GetView();
 
-        auto actual_doc = GetRecordUnlocked(collection_name, id);
+        // Hot keys are patched in place through their own columns and never touch the value blob
+        AnyData::PackedDocumentBuilder value_patch_builder;
 
-        if (actual_doc.Empty()) {
-            throw DataBaseException("DbSQLite Document not found", collection_name, FormatSqliteDbKey(id));
+        for (size_t i = 0; i < patch.Size(); i++) {
+            const auto patch_key = patch.GetKey(i);
+
+            if (const auto it = collection.HotKeyIndices.find(string(patch_key)); it != collection.HotKeyIndices.end()) {
+                Statement stmt {*this, collection.UpdateHotStmts[it->second], collection_name};
+                stmt.BindBlob(1, key);
+                stmt.BindBlob(2, EncodeHotValue(patch_key, patch.GetValue(i)).GetData());
+
+                if (!ExecuteWrite(stmt, collection_name, id, false)) {
+                    throw DataBaseException("DbSQLite Document not found", collection_name, FormatSqliteDbKey(id));
+                }
+            }
+            else {
+                value_patch_builder.Add(patch_key, patch.GetValue(i));
+            }
         }
 
-        for (auto&& [doc_key, doc_value] : doc) {
-            actual_doc.Assign(doc_key, doc_value.Copy());
+        if (value_patch_builder.Size() == 0) {
+            return;
         }
 
-        auto key = MakeSqliteKey(id, GetCollectionKeyType(collection_name));
-        string sql = strex("UPDATE {} SET value = ?2 WHERE key = ?1", QuoteIdentifier(collection_name.as_str())).str();
+        const auto value_patch = value_patch_builder.Finish();
+        AnyData::PackedDocument value_doc;
+
+        {
+            Statement stmt {*this, collection.SelectValueStmt, collection_name};
+            stmt.BindBlob(1, key);
 
-        WriteDocument(sql, collection_name, id, key, actual_doc);
+            if (!stmt.Step()) {
+                throw DataBaseException("DbSQLite Document not found", collection_name, FormatSqliteDbKey(id));
+            }
+
+            const auto value_data = stmt.ColumnBlob(0);
+
+            // Packed blobs are merged in place, legacy BSON rows are converted on their first update
+            if (AnyData::PackedDocumentView::IsPacked(value_data)) {
+                value_doc = AnyData::PackedDocument(AnyData::PackedDocumentView(value_data), value_patch.GetView());
+            }
+            else {
+                const auto legacy_doc = DecodeDocument(collection_name, value_data);
+                value_doc = AnyData::PackedDocument(legacy_doc.GetView(), value_patch.GetView());
+            }
+        }
+
+        Statement stmt {*this, collection.UpdateValueStmt, collection_name};
+        stmt.BindBlob(1, key);
+        stmt.BindBlob(2, value_doc.GetData());
+
+        ExecuteWrite(stmt, collection_name, id);
     }
 
     void DeleteRecord(hstring collection_name, const DataBaseKey& id) override
@@ -332,12 +414,10 @@ class DbSQLite final : public DataBaseImpl
 
         scoped_lock locker {_storageLocker};
 
-        VerifyCollection(collection_name);
-
+        const auto& collection = GetCollection(collection_name);
         auto key = MakeSqliteKey(id, GetCollectionKeyType(collection_name));
-        string sql = strex("DELETE FROM {} WHERE key = ?", QuoteIdentifier(collection_name.as_str())).str();
 
-        Statement stmt {*this, sql, collection_name};
+        Statement stmt {*this, collection.DeleteStmt, collection_name};
         stmt.BindBlob(1, key);
 
         while (stmt.Step()) {
@@ -345,6 +425,57 @@ class DbSQLite final : public DataBaseImpl
         }
     }
 
+    void BeginCommitBatch() override
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        if (_commitBatchSize == 1) {
+            return;
+        }
+
+        scoped_lock locker {_storageLocker};
+
+        FO_VERIFY_AND_THROW(!_batchActive, "SQLite commit batch is already active");
+
+        // IMMEDIATE takes the write lock up front, so a busy file fails here rather than halfway through the batch
+        Execute("BEGIN IMMEDIATE", hstring());
+        _batchActive = true;
+    }
+
+    void EndCommitBatch() override
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        scoped_lock locker {_storageLocker};
+
+        if (!_batchActive) {
+            return;
+        }
+
+        Execute("COMMIT", hstring());
+        _batchActive = false;
+    }
+
+    void AbortCommitBatch() noexcept override
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        safe_call([&] {
+            scoped_lock locker {_storageLocker};
+
+            if (!_batchActive) {
+                return;
+            }
+
+            _batchActive = false;
+
+            // A failed COMMIT may already have rolled the transaction back, which leaves nothing to undo
+            if (sqlite3_get_autocommit(GetHandle().get()) == 0) {
+                Execute("ROLLBACK", hstring());
+            }
+        });
+    }
+
     auto TryReconnect() -> bool override
     {
         FO_STACK_TRACE_ENTRY();
@@ -372,18 +503,21 @@ class DbSQLite final : public DataBaseImpl
         {
             FO_STACK_TRACE_ENTRY();
 
-            ptr<sqlite3> db_handle = db.GetHandle();
-            nptr<sqlite3_stmt> stmt;
-            int32_t prepare = sqlite3_prepare_v2(db_handle.get(), sql.data(), numeric_cast<int32_t>(sql.size()), stmt.get_pp(), nullptr);
+            _stmt = db.Prepare(sql, context);
+            _db = db.GetHandle();
+            _context = context;
+        }
 
-            if (prepare != SQLITE_OK) {
-                throw DataBaseException("DbSQLite sqlite3_prepare_v2", context, sql, db.LastError());
-            }
+        // Borrows a statement from the collection cache; it is reset for the next user instead of being finalized
+        Statement(const DbSQLite& db, nptr<sqlite3_stmt> cached_stmt, hstring context) FO_TSA_REQUIRES(db._storageLocker)
+        {
+            FO_STACK_TRACE_ENTRY();
 
-            FO_VERIFY_AND_THROW(stmt, "Prepared statement is null");
-            _stmt = stmt;
-            _db = db_handle;
+            FO_VERIFY_AND_THROW(cached_stmt, "Cached statement is null");
+            _stmt = cached_stmt;
+            _db = db.GetHandle();
             _context = context;
+            _cached = true;
         }
 
         Statement(const Statement&) = delete;
@@ -396,7 +530,13 @@ class DbSQLite final : public DataBaseImpl
             FO_STACK_TRACE_ENTRY();
 
             if (_stmt) {
-                (void)sqlite3_finalize(_stmt.get());
+                if (_cached) {
+                    (void)sqlite3_reset(_stmt.get());
+                    (void)sqlite3_clear_bindings(_stmt.get());
+                }
+                else {
+                    (void)sqlite3_finalize(_stmt.get());
+                }
             }
         }
 
@@ -424,6 +564,17 @@ class DbSQLite final : public DataBaseImpl
             }
         }
 
+        void BindNull(int32_t index)
+        {
+            FO_STACK_TRACE_ENTRY();
+
+            int32_t bind = sqlite3_bind_null(_stmt.get(), index);
+
+            if (bind != SQLITE_OK) {
+                throw DataBaseException("DbSQLite sqlite3_bind_null", _context, LastError());
+            }
+        }
+
         [[nodiscard]] auto Step() -> bool
         {
             FO_STACK_TRACE_ENTRY();
@@ -440,6 +591,13 @@ class DbSQLite final : public DataBaseImpl
             throw DataBaseException("DbSQLite sqlite3_step", _context, LastError());
         }
 
+        [[nodiscard]] auto ColumnIsNull(int32_t index) const -> bool
+        {
+            FO_STACK_TRACE_ENTRY();
+
+            return sqlite3_column_type(make_ptr(_stmt.get_no_const()).get(), index) == SQLITE_NULL;
+        }
+
         [[nodiscard]] auto ColumnBlob(int32_t index) const -> const_span<uint8_t>
         {
             FO_STACK_TRACE_ENTRY();
@@ -470,6 +628,19 @@ class DbSQLite final : public DataBaseImpl
         nptr<sqlite3_stmt> _stmt {};
         nptr<sqlite3> _db {};
         hstring _context {};
+        bool _cached {};
+    };
+
+    struct CollectionData
+    {
+        vector<string> HotKeys {};
+        unordered_map<string, size_t> HotKeyIndices {};
+        nptr<sqlite3_stmt> SelectStmt {};
+        nptr<sqlite3_stmt> SelectValueStmt {};
+        nptr<sqlite3_stmt> InsertStmt {};
+        nptr<sqlite3_stmt> UpdateValueStmt {};
+        vector<nptr<sqlite3_stmt>> UpdateHotStmts {};
+        nptr<sqlite3_stmt> DeleteStmt {};
     };
 
     void OpenDataBase()
@@ -507,7 +678,7 @@ class DbSQLite final : public DataBaseImpl
         Execute("PRAGMA journal_mode = WAL", hstring());
         // NORMAL pairs with WAL: a crash may lose the last transactions but cannot corrupt the database, and
         // FULL closes only that window at a real write cost
-        Execute("PRAGMA synchronous = NORMAL", hstring());
+        Execute(strex("PRAGMA synchronous = {}", _synchronous).str(), hstring());
         Execute("PRAGMA foreign_keys = ON", hstring());
     }
 
@@ -531,82 +702,259 @@ class DbSQLite final : public DataBaseImpl
         return text ? string(text.get()) : string("unknown");
     }
 
-    void Execute(string_view sql, hstring context) const FO_TSA_REQUIRES(_storageLocker)
+    [[nodiscard]] nptr<sqlite3_stmt> Prepare(string_view sql, hstring context) const FO_TSA_REQUIRES(_storageLocker)
     {
         FO_STACK_TRACE_ENTRY();
 
-        Statement stmt {*this, sql, context};
+        nptr<sqlite3_stmt> stmt;
+        int32_t prepare = sqlite3_prepare_v2(GetHandle().get(), sql.data(), numeric_cast<int32_t>(sql.size()), stmt.get_pp(), nullptr);
 
-        while (stmt.Step()) {
-            // Drain any rows a PRAGMA may return
+        if (prepare != SQLITE_OK) {
+            throw DataBaseException("DbSQLite sqlite3_prepare_v2", context, sql, LastError());
         }
+
+        FO_VERIFY_AND_THROW(stmt, "Prepared statement is null");
+        return stmt;
     }
 
-    void WriteDocument(string_view sql, hstring collection_name, const DataBaseKey& id, const vector<uint8_t>& key, const AnyData::Document& doc) FO_TSA_REQUIRES(_storageLocker)
+    [[nodiscard]] nptr<sqlite3_stmt> PrepareCached(string_view sql, hstring context) FO_TSA_REQUIRES(_storageLocker)
     {
         FO_STACK_TRACE_ENTRY();
 
-        bson_t bson;
-        bson_init(&bson);
-        auto destroy_bson = scope_exit([&]() noexcept { bson_destroy(&bson); });
+        _cachedStatements.reserve(_cachedStatements.size() + 1);
+        auto stmt = Prepare(sql, context);
+        _cachedStatements.emplace_back(stmt);
+        return stmt;
+    }
 
-        DocumentToBson(doc, &bson);
+    void Execute(string_view sql, hstring context) const FO_TSA_REQUIRES(_storageLocker)
+    {
+        FO_STACK_TRACE_ENTRY();
 
-        auto bson_data = make_nptr(bson_get_data(&bson));
+        Statement stmt {*this, sql, context};
 
-        if (!bson_data) {
-            throw DataBaseException("DbSQLite bson_get_data", collection_name);
+        while (stmt.Step()) {
+            // Drain any rows a PRAGMA may return
         }
+    }
 
-        Statement stmt {*this, sql, collection_name};
-        stmt.BindBlob(1, key);
-        stmt.BindBlob(2, make_const_span(bson_data.get(), numeric_cast<size_t>(bson.len)));
+    bool ExecuteWrite(Statement& stmt, hstring collection_name, const DataBaseKey& id, bool require_changes = true) const FO_TSA_REQUIRES(_storageLocker)
+    {
+        FO_STACK_TRACE_ENTRY();
 
         while (stmt.Step()) {
             // No rows are produced by INSERT/UPDATE
         }
 
         if (sqlite3_changes(GetHandle().get()) == 0) {
-            throw DataBaseException("DbSQLite write affected no rows", collection_name, FormatSqliteDbKey(id));
+            if (require_changes) {
+                throw DataBaseException("DbSQLite write affected no rows", collection_name, FormatSqliteDbKey(id));
+            }
+
+            return false;
         }
+
+        return true;
     }
 
-    [[nodiscard]] AnyData::Document GetRecordUnlocked(hstring collection_name, const DataBaseKey& id) const FO_TSA_REQUIRES(_storageLocker)
+    void InsertRecordUnlocked(hstring collection_name, const DataBaseKey& id, const AnyData::PackedDocument& doc) FO_TSA_REQUIRES(_storageLocker)
     {
         FO_STACK_TRACE_ENTRY();
 
-        VerifyCollection(collection_name);
+        const auto& collection = GetCollection(collection_name);
+        auto key = MakeSqliteKey(id, GetCollectionKeyType(collection_name));
+
+        Statement stmt {*this, collection.InsertStmt, collection_name};
+        stmt.BindBlob(1, key);
+
+        // Without hot columns the pending packed document is stored as is
+        if (collection.HotKeys.empty()) {
+            stmt.BindBlob(2, doc.GetData());
+            ExecuteWrite(stmt, collection_name, id);
+            return;
+        }
+
+        // Hot keys live only in their columns, everything else goes to the value blob
+        const auto view = doc.GetView();
+        AnyData::PackedDocumentBuilder value_builder;
+        vector<optional<AnyData::PackedDocument>> hot_values(collection.HotKeys.size());
+
+        for (size_t i = 0; i < view.Size(); i++) {
+            const auto doc_key = view.GetKey(i);
+
+            if (const auto it = collection.HotKeyIndices.find(string(doc_key)); it != collection.HotKeyIndices.end()) {
+                hot_values[it->second] = EncodeHotValue(doc_key, view.GetValue(i));
+            }
+            else {
+                value_builder.Add(doc_key, view.GetValue(i));
+            }
+        }
+
+        const auto value_doc = value_builder.Size() != 0 ? value_builder.Finish() : AnyData::PackedDocument(AnyData::Document());
+        stmt.BindBlob(2, value_doc.GetData());
+
+        for (size_t i = 0; i < hot_values.size(); i++) {
+            if (hot_values[i].has_value()) {
+                stmt.BindBlob(numeric_cast<int32_t>(i + 3), hot_values[i]->GetData());
+            }
+            else {
+                stmt.BindNull(numeric_cast<int32_t>(i + 3));
+            }
+        }
+
+        ExecuteWrite(stmt, collection_name, id);
+    }
 
+    [[nodiscard]] AnyData::PackedDocument GetRecordUnlocked(hstring collection_name, const DataBaseKey& id) const FO_TSA_REQUIRES(_storageLocker)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        const auto& collection = GetCollection(collection_name);
         auto key = MakeSqliteKey(id, GetCollectionKeyType(collection_name));
-        string sql = strex("SELECT value FROM {} WHERE key = ?", QuoteIdentifier(collection_name.as_str())).str();
 
-        Statement stmt {*this, sql, collection_name};
+        Statement stmt {*this, collection.SelectStmt, collection_name};
         stmt.BindBlob(1, key);
 
         if (!stmt.Step()) {
             return {};
         }
 
-        auto value = stmt.ColumnBlob(0);
+        auto doc = DecodeDocument(collection_name, stmt.ColumnBlob(0));
 
-        bson_t bson;
+        // A hot column overrides whatever the blob still carries for that key from before the column existed
+        for (size_t i = 0; i < collection.HotKeys.size(); i++) {
+            auto column = numeric_cast<int32_t>(i + 1);
 
-        if (!bson_init_static(&bson, value.data(), value.size())) {
-            throw DataBaseException("DbSQLite bson_init_static", collection_name);
+            if (stmt.ColumnIsNull(column)) {
+                continue;
+            }
+
+            const auto hot_doc = DecodeDocument(collection_name, stmt.ColumnBlob(column));
+            doc = AnyData::PackedDocument(doc.GetView(), hot_doc.GetView());
         }
 
-        AnyData::Document doc;
-        BsonToDocument(&bson, doc);
         return doc;
     }
 
-    void VerifyCollection(hstring collection_name) const FO_TSA_REQUIRES(_storageLocker)
+    [[nodiscard]] const CollectionData& GetCollection(hstring collection_name) const FO_TSA_REQUIRES(_storageLocker)
     {
         FO_STACK_TRACE_ENTRY();
 
-        if (_collections.count(collection_name) == 0) {
+        const auto it = _collections.find(collection_name);
+
+        if (it == _collections.end()) {
             throw DataBaseException("DbSQLite Invalid collection", collection_name);
         }
+
+        return it->second;
+    }
+
+    void VerifyCollection(hstring collection_name) const FO_TSA_REQUIRES(_storageLocker)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        ignore_unused(GetCollection(collection_name));
+    }
+
+    [[nodiscard]] vector<string> ReadHotColumnKeys(hstring collection_name) const FO_TSA_REQUIRES(_storageLocker)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        string sql = strex("PRAGMA table_info({})", QuoteIdentifier(collection_name.as_str())).str();
+        Statement stmt {*this, sql, collection_name};
+
+        vector<string> hot_keys;
+
+        while (stmt.Step()) {
+            // Column 1 of table_info is the column name
+            auto name = span_to_string(stmt.ColumnBlob(1));
+
+            if (name.starts_with(HOT_COLUMN_PREFIX)) {
+                hot_keys.emplace_back(name.substr(HOT_COLUMN_PREFIX.size()));
+            }
+        }
+
+        return hot_keys;
+    }
+
+    [[nodiscard]] static auto DecodeDocument(hstring collection_name, const_span<uint8_t> data) -> AnyData::PackedDocument
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        if (AnyData::PackedDocumentView::IsPacked(data)) {
+            return AnyData::PackedDocument::FromData(vector<uint8_t>(data.begin(), data.end()));
+        }
+
+        // Rows written before the packed encoding hold BSON and are still readable
+        bson_t bson;
+
+        if (!bson_init_static(&bson, data.data(), data.size())) {
+            throw DataBaseException("DbSQLite bson_init_static", collection_name);
+        }
+
+        return BsonToPackedDocument(&bson);
+    }
+
+    // A hot column holds a one-key document, which reuses the blob encoding for every value type
+    [[nodiscard]] static auto EncodeHotValue(string_view key, const AnyData::PackedValue& value) -> AnyData::PackedDocument
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        AnyData::PackedDocumentBuilder hot_builder;
+        hot_builder.Add(key, value);
+        return hot_builder.Finish();
+    }
+
+    [[nodiscard]] static auto MakeHotColumnName(string_view key) -> string
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        return strex("{}{}", HOT_COLUMN_PREFIX, key).str();
+    }
+
+    [[nodiscard]] static auto ParseSynchronousLevel(string_view level) -> string
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        string normalized = strex(level).trim().upper().str();
+
+        if (normalized != "OFF" && normalized != "NORMAL" && normalized != "FULL" && normalized != "EXTRA") {
+            throw DataBaseException("DbSQLite invalid synchronous level", level);
+        }
+
+        return normalized;
+    }
+
+    [[nodiscard]] static auto ParseHotProperties(const vector<string>& entries) -> unordered_map<string, vector<string>>
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        unordered_map<string, vector<string>> hot_keys;
+
+        for (const auto& entry : entries) {
+            auto separator = entry.find(':');
+
+            if (separator == string::npos || entry.find(':', separator + 1) != string::npos) {
+                throw DataBaseException("DbSQLite invalid hot property setting", entry);
+            }
+
+            string collection_name = strex(entry.substr(0, separator)).trim().str();
+            string key = strex(entry.substr(separator + 1)).trim().str();
+
+            if (collection_name.empty() || key.empty()) {
+                throw DataBaseException("DbSQLite invalid hot property setting", entry);
+            }
+
+            auto& collection_keys = hot_keys[collection_name];
+
+            if (std::ranges::find(collection_keys, key) != collection_keys.end()) {
+                throw DataBaseException("DbSQLite duplicate hot property setting", entry);
+            }
+
+            collection_keys.emplace_back(std::move(key));
+        }
+
+        return hot_keys;
     }
 
     // Collection names come from engine metadata rather than user input, but they still reach SQL as
@@ -698,10 +1046,17 @@ class DbSQLite final : public DataBaseImpl
             key);
     }
 
+    static constexpr string_view HOT_COLUMN_PREFIX = "hot_";
+
     string _storageDir {};
+    string _synchronous {};
+    size_t _commitBatchSize {};
+    unordered_map<string, vector<string>> _hotKeys {};
     mutable mutex _storageLocker {};
     nptr<sqlite3> _db FO_TSA_GUARDED_BY(_storageLocker) {};
-    set<hstring> _collections FO_TSA_GUARDED_BY(_storageLocker) {};
+    unordered_map<hstring, CollectionData> _collections FO_TSA_GUARDED_BY(_storageLocker) {};
+    vector<nptr<sqlite3_stmt>> _cachedStatements FO_TSA_GUARDED_BY(_storageLocker) {};
+    bool _batchActive FO_TSA_GUARDED_BY(_storageLocker) {};
 };
 
 auto CreateSQLiteDataBase(ptr<DataBaseSettings> db_settings, string_view storage_dir, DataBasePanicCallback panic_callback) -> unique_ptr<DataBaseImpl>
@@ -55,12 +55,12 @@ FO_CLANG_IGNORE_WARNINGS_PUSH("-Walign-mismatch")
 
 FO_BEGIN_NAMESPACE
 
-static auto AnyDocumentToJson(const AnyData::Document& doc) -> nlohmann::json;
-static auto JsonToAnyDocument(const nlohmann::json& doc_json) -> AnyData::Document;
+static auto PackedDocumentToJson(const AnyData::PackedDocumentView& doc) -> nlohmann::json;
+static auto JsonToPackedDocument(const nlohmann::json& doc_json) -> AnyData::PackedDocument;
 static void ValidateFiniteAnyValue(const AnyData::Value& value);
-static void ValidateFiniteAnyDocument(const AnyData::Document& doc);
-static auto AreDocumentsEqual(const AnyData::Document& left, const AnyData::Document& right) -> bool;
-static auto DoesDocumentContain(const AnyData::Document& target, const AnyData::Document& patch) -> bool;
+static void ValidateFinitePackedDocument(const AnyData::PackedDocumentView& doc);
+static auto AreDocumentsEqual(const AnyData::PackedDocumentView& left, const AnyData::PackedDocumentView& right) -> bool;
+static auto DoesDocumentContain(const AnyData::PackedDocumentView& target, const AnyData::PackedDocumentView& patch) -> bool;
 static auto IsDbKeyValueValid(const DataBaseKey& key) noexcept -> bool;
 static auto DbKeyTypeName(DataBaseKeyType key_type) noexcept -> string_view;
 static auto EncodeStorageDbKey(const DataBaseKey& key, DataBaseKeyType key_type, DataBaseStringKeyEscaping escaping) -> string;
@@ -235,6 +235,14 @@ auto DataBase::Get(hstring collection_name, const DataBaseKey& id) const -> AnyD
 {
     FO_STACK_TRACE_ENTRY();
 
+    FO_VERIFY_AND_THROW(_impl, "Database implementation is null");
+    return _impl->GetDocument(collection_name, id).ToDocument();
+}
+
+auto DataBase::GetPacked(hstring collection_name, const DataBaseKey& id) const -> AnyData::PackedDocument
+{
+    FO_STACK_TRACE_ENTRY();
+
     FO_VERIFY_AND_THROW(_impl, "Database implementation is null");
     return _impl->GetDocument(collection_name, id);
 }
@@ -252,7 +260,15 @@ void DataBase::Insert(hstring collection_name, const DataBaseKey& id, const AnyD
     FO_STACK_TRACE_ENTRY();
 
     FO_VERIFY_AND_THROW(_impl, "Database implementation is null");
-    _impl->Insert(collection_name, id, doc);
+    _impl->Insert(collection_name, id, AnyData::PackedDocument(doc));
+}
+
+void DataBase::Insert(hstring collection_name, const DataBaseKey& id, AnyData::PackedDocument doc)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(_impl, "Database implementation is null");
+    _impl->Insert(collection_name, id, std::move(doc));
 }
 
 void DataBase::Update(hstring collection_name, const DataBaseKey& id, string_view key, const AnyData::Value& value)
@@ -522,17 +538,17 @@ void DataBaseImpl::RestorePendingChanges()
                 }
             }
             else {
-                auto doc = JsonToAnyDocument(nlohmann::json::parse(other));
+                auto doc = JsonToPackedDocument(nlohmann::json::parse(other));
 
                 if (command == "insert") {
                     if (current_doc.Empty()) {
                         InsertRecord(collection_name, storage_record_id, doc);
                     }
-                    else if (!AreDocumentsEqual(current_doc, doc)) {
+                    else if (!AreDocumentsEqual(current_doc.GetView(), doc.GetView())) {
                         throw DataBaseException("Pending database insert replay conflict", record_id, _settings->OpLogPath);
                     }
                 }
-                else if (!DoesDocumentContain(current_doc, doc)) {
+                else if (!DoesDocumentContain(current_doc.GetView(), doc.GetView())) {
                     UpdateRecord(collection_name, storage_record_id, doc);
                 }
             }
@@ -582,7 +598,7 @@ auto DataBaseImpl::GetDbRequestsPerMinute() const -> size_t
     return _dbRequestsPerMinute.load(std::memory_order_relaxed);
 }
 
-auto DataBaseImpl::GetDocument(hstring collection_name, const DataBaseKey& id) const -> AnyData::Document
+auto DataBaseImpl::GetDocument(hstring collection_name, const DataBaseKey& id) const -> AnyData::PackedDocument
 {
     FO_STACK_TRACE_ENTRY();
 
@@ -608,7 +624,7 @@ auto DataBaseImpl::GetDocument(hstring collection_name, const DataBaseKey& id) c
     });
 
     while (true) {
-        AnyData::Document doc;
+        AnyData::PackedDocument doc;
 
         try {
             doc = GetRecord(collection_name, storage_id);
@@ -631,10 +647,20 @@ auto DataBaseImpl::GetDocument(hstring collection_name, const DataBaseKey& id) c
                 continue;
             }
 
-            for (const auto& pending_op : _pendingCommitOperations) {
-                if (pending_op->CollectionName == collection_name && pending_op->RecordId == id) {
-                    pending_ops.emplace_back(pending_op);
+            if (const auto it = _pendingRecordOperations.find({collection_name, id}); it != _pendingRecordOperations.end()) {
+                // Everything before the last insert or delete is overwritten by it
+                const auto& record_ops = it->second;
+                auto first_op = record_ops.end();
+
+                while (first_op != record_ops.begin()) {
+                    --first_op;
+
+                    if ((*first_op)->Type != CommitOperationType::Update) {
+                        break;
+                    }
                 }
+
+                pending_ops.assign(first_op, record_ops.end());
             }
         }
 
@@ -643,9 +669,7 @@ auto DataBaseImpl::GetDocument(hstring collection_name, const DataBaseKey& id) c
                 doc = pending_op->Doc.Copy();
             }
             else if (pending_op->Type == CommitOperationType::Update) {
-                for (const auto& [key, value] : pending_op->Doc) {
-                    doc.Assign(key, value.Copy());
-                }
+                doc = AnyData::PackedDocument(doc.GetView(), pending_op->Doc.GetView());
             }
             else if (pending_op->Type == CommitOperationType::Delete) {
                 doc = {};
@@ -656,7 +680,7 @@ auto DataBaseImpl::GetDocument(hstring collection_name, const DataBaseKey& id) c
     }
 }
 
-void DataBaseImpl::Insert(hstring collection_name, const DataBaseKey& id, const AnyData::Document& doc)
+void DataBaseImpl::Insert(hstring collection_name, const DataBaseKey& id, AnyData::PackedDocument doc)
 {
     FO_STACK_TRACE_ENTRY();
 
@@ -664,7 +688,7 @@ void DataBaseImpl::Insert(hstring collection_name, const DataBaseKey& id, const
         throw DataBaseException("Cannot insert empty document");
     }
 
-    ValidateFiniteAnyDocument(doc);
+    ValidateFinitePackedDocument(doc.GetView());
     ValidateCollectionKey(collection_name, id);
 
     {
@@ -674,8 +698,9 @@ void DataBaseImpl::Insert(hstring collection_name, const DataBaseKey& id, const
         op->Type = CommitOperationType::Insert;
         op->CollectionName = collection_name;
         op->RecordId = id;
-        op->Doc = doc.Copy();
-        _pendingCommitOperations.emplace_back(std::move(op));
+        op->Doc = std::move(doc);
+        op->QueuedTime = nanotime::now();
+        EnqueueCommitOperation(std::move(op));
     }
 
     _commitThreadSignal.notify_one();
@@ -688,6 +713,10 @@ void DataBaseImpl::Update(hstring collection_name, const DataBaseKey& id, string
     ValidateFiniteAnyValue(value);
     ValidateCollectionKey(collection_name, id);
 
+    AnyData::PackedDocumentBuilder patch_builder;
+    patch_builder.Add(key, value);
+    auto packed_patch = patch_builder.Finish();
+
     {
         scoped_lock locker {_stateLocker};
 
@@ -695,8 +724,9 @@ void DataBaseImpl::Update(hstring collection_name, const DataBaseKey& id, string
         op->Type = CommitOperationType::Update;
         op->CollectionName = collection_name;
         op->RecordId = id;
-        op->Doc.Assign(string(key), value.Copy());
-        _pendingCommitOperations.emplace_back(std::move(op));
+        op->Doc = std::move(packed_patch);
+        op->QueuedTime = nanotime::now();
+        EnqueueCommitOperation(std::move(op));
     }
 
     _commitThreadSignal.notify_one();
@@ -715,12 +745,21 @@ void DataBaseImpl::Delete(hstring collection_name, const DataBaseKey& id)
         op->Type = CommitOperationType::Delete;
         op->CollectionName = collection_name;
         op->RecordId = id;
-        _pendingCommitOperations.emplace_back(std::move(op));
+        op->QueuedTime = nanotime::now();
+        EnqueueCommitOperation(std::move(op));
     }
 
     _commitThreadSignal.notify_one();
 }
 
+void DataBaseImpl::EnqueueCommitOperation(shared_ptr<CommitOperationData> op)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _pendingRecordOperations[{op->CollectionName, op->RecordId}].emplace_back(op);
+    _pendingCommitOperations.emplace_back(std::move(op));
+}
+
 void DataBaseImpl::StartCommitChanges()
 {
     FO_STACK_TRACE_ENTRY();
@@ -744,6 +783,11 @@ void DataBaseImpl::WaitCommitChanges()
         return;
     }
 
+    if (!_pendingCommitOperations.empty()) {
+        _commitFlushRequested = true;
+        _commitThreadSignal.notify_one();
+    }
+
     while (!_pendingCommitOperations.empty()) {
         if (!InValidState()) {
             WriteLog("Database is not in valid state, pending commit operations can't be guaranteed to be durably committed");
@@ -761,6 +805,7 @@ void DataBaseImpl::ClearChanges() noexcept
     scoped_lock locker {_stateLocker};
 
     _pendingCommitOperations.clear();
+    _pendingRecordOperations.clear();
 }
 
 void DataBaseImpl::DrawGui()
@@ -910,6 +955,7 @@ void DataBaseImpl::CommitThreadEntry() noexcept
                 unique_lock locker {_stateLocker};
 
                 while ((!_commitThreadActive || _pendingCommitOperations.empty()) && !_commitThreadStopRequested && !_backendFailed) {
+                    _commitFlushRequested = false;
                     _commitThreadDoneSignal.notify_all();
                     _commitThreadSignal.wait(locker);
                 }
@@ -926,13 +972,27 @@ void DataBaseImpl::CommitThreadEntry() noexcept
                     continue;
                 }
 
+                // Let a partial batch gather more changes until it fills up or its oldest change is due
+                if (!_commitThreadStopRequested && !_backendFailed && !_commitFlushRequested && !_pendingCommitOperations.empty()) {
+                    const auto flush_interval = GetCommitFlushInterval();
+
+                    if (flush_interval > timespan::zero && _pendingCommitOperations.size() < GetCommitBatchSize()) {
+                        const auto flush_time = _pendingCommitOperations.front()->QueuedTime + flush_interval;
+
+                        if (nanotime::now() < flush_time) {
+                            _commitThreadSignal.wait_until(locker, flush_time.value());
+                            continue;
+                        }
+                    }
+                }
+
                 has_changes = !_pendingCommitOperations.empty();
                 stop_requested = _commitThreadStopRequested;
             }
 
             if (stop_requested) {
                 while (has_changes) {
-                    CommitNextChange();
+                    CommitNextChanges();
 
                     scoped_lock locker {_stateLocker};
 
@@ -956,7 +1016,7 @@ void DataBaseImpl::CommitThreadEntry() noexcept
                 }
             }
             else if (has_changes) {
-                CommitNextChange();
+                CommitNextChanges();
             }
             else if (_backendFailed) {
                 std::this_thread::sleep_for(std::chrono::milliseconds(10));
@@ -970,41 +1030,67 @@ void DataBaseImpl::CommitThreadEntry() noexcept
     _commitThreadDoneSignal.notify_all();
 }
 
-void DataBaseImpl::CommitNextChange() noexcept
+void DataBaseImpl::CommitNextChanges() noexcept
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_ptr<CommitOperationData> op;
+    vector<shared_ptr<CommitOperationData>> ops;
+
+    try {
+        size_t batch_size = std::max(GetCommitBatchSize(), size_t {1});
 
-    {
         scoped_lock locker {_stateLocker};
 
         if (_pendingCommitOperations.empty()) {
             return;
         }
 
-        op = _pendingCommitOperations.front();
-        _docReadRetryMarkers.erase({op->CollectionName, op->RecordId});
+        ops.reserve(std::min(batch_size, _pendingCommitOperations.size()));
+
+        for (const auto& pending_op : _pendingCommitOperations) {
+            if (ops.size() == batch_size) {
+                break;
+            }
+
+            ops.emplace_back(pending_op);
+            _docReadRetryMarkers.erase({pending_op->CollectionName, pending_op->RecordId});
+        }
     }
+    catch (const std::exception& ex) {
+        ReportExceptionAndContinue(ex);
+        StartPanic("Exception during commit batch collection");
+        return;
+    }
+
+    bool batch_aborted = false;
 
     if (!_backendFailed) {
         try {
-            auto storage_record_id = EncodeBackendDbKey(op->RecordId, GetCollectionKeyType(op->CollectionName), GetStringKeyEscaping());
-
-            switch (op->Type) {
-            case CommitOperationType::Insert:
-                InsertRecord(op->CollectionName, storage_record_id, op->Doc);
-                break;
-            case CommitOperationType::Update:
-                UpdateRecord(op->CollectionName, storage_record_id, op->Doc);
-                break;
-            case CommitOperationType::Delete:
-                DeleteRecord(op->CollectionName, storage_record_id);
-                break;
+            BeginCommitBatch();
+
+            auto abort_batch = scope_fail([&]() noexcept { AbortCommitBatch(); });
+
+            for (const auto& op : ops) {
+                auto storage_record_id = EncodeBackendDbKey(op->RecordId, GetCollectionKeyType(op->CollectionName), GetStringKeyEscaping());
+
+                switch (op->Type) {
+                case CommitOperationType::Insert:
+                    InsertRecord(op->CollectionName, storage_record_id, op->Doc);
+                    break;
+                case CommitOperationType::Update:
+                    UpdateRecord(op->CollectionName, storage_record_id, op->Doc);
+                    break;
+                case CommitOperationType::Delete:
+                    DeleteRecord(op->CollectionName, storage_record_id);
+                    break;
+                }
             }
+
+            EndCommitBatch();
         }
         catch (const std::exception& ex) {
             ReportExceptionAndContinue(ex);
+            batch_aborted = true;
             _backendFailed = true;
             _reconnectRetryTime = nanotime::now() + _reconnectRetryPeriod;
         }
@@ -1017,25 +1103,34 @@ void DataBaseImpl::CommitNextChange() noexcept
                 return;
             }
 
+            // Operations of an aborted batch the backend didn't confirm are spilled in order
             string log_data;
 
-            switch (op->Type) {
-            case CommitOperationType::Insert: {
-                auto doc_json = AnyDocumentToJson(op->Doc).dump();
-                FO_VERIFY_AND_THROW(doc_json.find_first_of("\r\n") == string::npos, "Database insert oplog JSON contains a newline and cannot be stored as a single log command", op->CollectionName, doc_json.size(), doc_json.find_first_of("\r\n"));
-                string key = EncodeStorageDbKey(op->RecordId, GetCollectionKeyType(op->CollectionName), GetStringKeyEscaping());
-                log_data += strex("insert {} {} {}\n", op->CollectionName.as_str(), key, doc_json).str();
-            } break;
-            case CommitOperationType::Update: {
-                auto doc_json = AnyDocumentToJson(op->Doc).dump();
-                FO_VERIFY_AND_THROW(doc_json.find_first_of("\r\n") == string::npos, "Database update oplog JSON contains a newline and cannot be stored as a single log command", op->CollectionName, doc_json.size(), doc_json.find_first_of("\r\n"));
-                string key = EncodeStorageDbKey(op->RecordId, GetCollectionKeyType(op->CollectionName), GetStringKeyEscaping());
-                log_data += strex("update {} {} {}\n", op->CollectionName.as_str(), key, doc_json).str();
-            } break;
-            case CommitOperationType::Delete: {
-                string key = EncodeStorageDbKey(op->RecordId, GetCollectionKeyType(op->CollectionName), GetStringKeyEscaping());
-                log_data += strex("delete {} {}\n", op->CollectionName.as_str(), key).str();
-            } break;
+            for (size_t i = 0; i < ops.size(); i++) {
+                if (batch_aborted && IsCommitBatchOperationApplied(i)) {
+                    continue;
+                }
+
+                const auto& op = ops[i];
+
+                switch (op->Type) {
+                case CommitOperationType::Insert: {
+                    auto doc_json = PackedDocumentToJson(op->Doc.GetView()).dump();
+                    FO_VERIFY_AND_THROW(doc_json.find_first_of("\r\n") == string::npos, "Database insert oplog JSON contains a newline and cannot be stored as a single log command", op->CollectionName, doc_json.size(), doc_json.find_first_of("\r\n"));
+                    string key = EncodeStorageDbKey(op->RecordId, GetCollectionKeyType(op->CollectionName), GetStringKeyEscaping());
+                    log_data += strex("insert {} {} {}\n", op->CollectionName.as_str(), key, doc_json).str();
+                } break;
+                case CommitOperationType::Update: {
+                    auto doc_json = PackedDocumentToJson(op->Doc.GetView()).dump();
+                    FO_VERIFY_AND_THROW(doc_json.find_first_of("\r\n") == string::npos, "Database update oplog JSON contains a newline and cannot be stored as a single log command", op->CollectionName, doc_json.size(), doc_json.find_first_of("\r\n"));
+                    string key = EncodeStorageDbKey(op->RecordId, GetCollectionKeyType(op->CollectionName), GetStringKeyEscaping());
+                    log_data += strex("update {} {} {}\n", op->CollectionName.as_str(), key, doc_json).str();
+                } break;
+                case CommitOperationType::Delete: {
+                    string key = EncodeStorageDbKey(op->RecordId, GetCollectionKeyType(op->CollectionName), GetStringKeyEscaping());
+                    log_data += strex("delete {} {}\n", op->CollectionName.as_str(), key).str();
+                } break;
+                }
             }
 
             if (!_pendingChangesLog->Append(log_data)) {
@@ -1056,7 +1151,7 @@ void DataBaseImpl::CommitNextChange() noexcept
     }
 
     try {
-        RegisterDbRequests(1);
+        RegisterDbRequests(ops.size());
     }
     catch (const std::exception& ex) {
         ReportExceptionAndContinue(ex);
@@ -1065,7 +1160,21 @@ void DataBaseImpl::CommitNextChange() noexcept
     try {
         scoped_lock state_locker {_stateLocker};
 
-        _pendingCommitOperations.pop_front();
+        // ClearChanges may have dropped the queue while the batch was in flight
+        for (const auto& op : ops) {
+            if (!_pendingCommitOperations.empty() && _pendingCommitOperations.front() == op) {
+                _pendingCommitOperations.pop_front();
+
+                const auto it = _pendingRecordOperations.find({op->CollectionName, op->RecordId});
+                FO_STRONG_ASSERT(it != _pendingRecordOperations.end());
+                FO_STRONG_ASSERT(!it->second.empty() && it->second.front() == op);
+                it->second.pop_front();
+
+                if (it->second.empty()) {
+                    _pendingRecordOperations.erase(it);
+                }
+            }
+        }
     }
     catch (const std::exception& ex) {
         ReportExceptionAndContinue(ex);
@@ -1456,7 +1565,7 @@ auto ConnectToDataBase(ptr<DataBaseSettings> db_settings, string_view connection
     throw DataBaseException("Wrong storage options", connection_info);
 }
 
-static void ValueToBson(string_view key, const AnyData::Value& value, ptr<bson_t> bson, char escape_dot)
+static void ValueToBson(string_view key, const AnyData::PackedValue& value, ptr<bson_t> bson, char escape_dot)
 {
     FO_STACK_TRACE_ENTRY();
 
@@ -1501,12 +1610,9 @@ static void ValueToBson(string_view key, const AnyData::Value& value, ptr<bson_t
             throw DataBaseException("ValueToBson bson_append_array_unsafe_begin", key);
         }
 
-        const auto& arr = value.AsArray();
-        size_t arr_index = 0;
-
-        for (const auto& arr_entry : arr) {
-            string arr_key = strex("{}", arr_index++);
-            ValueToBson(arr_key, arr_entry, &bson_arr, escape_dot);
+        for (size_t i = 0; i < value.Size(); i++) {
+            string arr_key = strex("{}", i);
+            ValueToBson(arr_key, value.GetElement(i), &bson_arr, escape_dot);
         }
 
         if (!bson_append_array_end(aligned_bson, &bson_arr)) {
@@ -1520,10 +1626,8 @@ static void ValueToBson(string_view key, const AnyData::Value& value, ptr<bson_t
             throw DataBaseException("ValueToBson bson_append_bool", key);
         }
 
-        const auto& dict = value.AsDict();
-
-        for (auto&& [dict_key, dict_value] : dict) {
-            ValueToBson(dict_key, dict_value, &bson_doc, escape_dot);
+        for (size_t i = 0; i < value.Size(); i++) {
+            ValueToBson(value.GetKey(i), value.GetValue(i), &bson_doc, escape_dot);
         }
 
         if (!bson_append_document_end(aligned_bson, &bson_doc)) {
@@ -1535,15 +1639,22 @@ static void ValueToBson(string_view key, const AnyData::Value& value, ptr<bson_t
     }
 }
 
-void DocumentToBson(const AnyData::Document& doc, ptr<bson_t> bson, char escape_dot)
+void PackedDocumentToBson(const AnyData::PackedDocumentView& doc, ptr<bson_t> bson, char escape_dot)
 {
     FO_STACK_TRACE_ENTRY();
 
-    for (auto&& [doc_key, doc_value] : doc) {
-        ValueToBson(doc_key, doc_value, bson, escape_dot);
+    for (size_t i = 0; i < doc.Size(); i++) {
+        ValueToBson(doc.GetKey(i), doc.GetValue(i), bson, escape_dot);
     }
 }
 
+void DocumentToBson(const AnyData::Document& doc, ptr<bson_t> bson, char escape_dot)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    PackedDocumentToBson(AnyData::PackedDocument(doc).GetView(), bson, escape_dot);
+}
+
 static auto BsonToValue(bson_iter_t* iter, char escape_dot) -> AnyData::Value
 {
     FO_STACK_TRACE_ENTRY();
@@ -1610,7 +1721,7 @@ static auto BsonToValue(bson_iter_t* iter, char escape_dot) -> AnyData::Value
     }
 }
 
-void BsonToDocument(ptr<const bson_t> bson, AnyData::Document& doc, char escape_dot)
+auto BsonToPackedDocument(ptr<const bson_t> bson, char escape_dot) -> AnyData::PackedDocument
 {
     FO_STACK_TRACE_ENTRY();
 
@@ -1618,9 +1729,11 @@ void BsonToDocument(ptr<const bson_t> bson, AnyData::Document& doc, char escape_
     auto aligned_bson = std::assume_aligned<BSON_ALIGN_OF_PTR>(bson.get());
 
     if (!bson_iter_init(&iter, aligned_bson)) {
-        throw DataBaseException("BsonToDocument bson_iter_init");
+        throw DataBaseException("BsonToPackedDocument bson_iter_init");
     }
 
+    AnyData::PackedDocumentBuilder builder;
+
     while (bson_iter_next(&iter)) {
         auto key = make_ptr(bson_iter_key(&iter));
         string_view key_text {key.get()};
@@ -1631,11 +1744,20 @@ void BsonToDocument(ptr<const bson_t> bson, AnyData::Document& doc, char escape_
 
         auto value = BsonToValue(&iter, escape_dot);
         string unescaped_key = escape_dot != 0 ? strex(key_text).replace(escape_dot, '.').str() : string(key_text);
-        doc.Emplace(std::move(unescaped_key), std::move(value));
+        builder.Add(unescaped_key, value);
     }
+
+    return builder.Finish();
 }
 
-static auto AnyValueToJson(const AnyData::Value& value) -> nlohmann::json
+void BsonToDocument(ptr<const bson_t> bson, AnyData::Document& doc, char escape_dot)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    doc = BsonToPackedDocument(bson, escape_dot).ToDocument();
+}
+
+static auto AnyValueToJson(const AnyData::PackedValue& value) -> nlohmann::json
 {
     FO_STACK_TRACE_ENTRY();
 
@@ -1658,8 +1780,8 @@ static auto AnyValueToJson(const AnyData::Value& value) -> nlohmann::json
     case AnyData::ValueType::Array: {
         auto arr_json = nlohmann::json::array();
 
-        for (const auto& arr_entry : value.AsArray()) {
-            arr_json.emplace_back(AnyValueToJson(arr_entry));
+        for (size_t i = 0; i < value.Size(); i++) {
+            arr_json.emplace_back(AnyValueToJson(value.GetElement(i)));
         }
 
         return arr_json;
@@ -1667,9 +1789,8 @@ static auto AnyValueToJson(const AnyData::Value& value) -> nlohmann::json
     case AnyData::ValueType::Dict: {
         auto dict_json = nlohmann::json::object();
 
-        for (auto&& [dict_key, dict_value] : value.AsDict()) {
-            auto dict_key_cstr = make_ptr(dict_key.c_str());
-            dict_json[dict_key_cstr.get()] = AnyValueToJson(dict_value);
+        for (size_t i = 0; i < value.Size(); i++) {
+            dict_json[string(value.GetKey(i))] = AnyValueToJson(value.GetValue(i));
         }
 
         return dict_json;
@@ -1708,12 +1829,41 @@ static void ValidateFiniteAnyValue(const AnyData::Value& value)
     }
 }
 
-static void ValidateFiniteAnyDocument(const AnyData::Document& doc)
+static void ValidateFinitePackedValue(const AnyData::PackedValue& value)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    switch (value.Type()) {
+    case AnyData::ValueType::Float64:
+        if (!std::isfinite(value.AsDouble())) {
+            throw DataBaseException("Database value is not finite", value.AsDouble());
+        }
+        break;
+    case AnyData::ValueType::Array:
+        for (size_t i = 0; i < value.Size(); i++) {
+            ValidateFinitePackedValue(value.GetElement(i));
+        }
+        break;
+    case AnyData::ValueType::Dict:
+        for (size_t i = 0; i < value.Size(); i++) {
+            ValidateFinitePackedValue(value.GetValue(i));
+        }
+        break;
+    case AnyData::ValueType::Int64:
+    case AnyData::ValueType::Bool:
+    case AnyData::ValueType::String:
+        break;
+    default:
+        break;
+    }
+}
+
+static void ValidateFinitePackedDocument(const AnyData::PackedDocumentView& doc)
 {
     FO_STACK_TRACE_ENTRY();
 
-    for (const auto& doc_entry : doc) {
-        ValidateFiniteAnyValue(doc_entry.second);
+    for (size_t i = 0; i < doc.Size(); i++) {
+        ValidateFinitePackedValue(doc.GetValue(i));
     }
 }
 
@@ -1761,21 +1911,20 @@ static auto JsonToAnyValue(const nlohmann::json& value) -> AnyData::Value
     throw DataBaseException("Invalid pending database json value type");
 }
 
-static auto AnyDocumentToJson(const AnyData::Document& doc) -> nlohmann::json
+static auto PackedDocumentToJson(const AnyData::PackedDocumentView& doc) -> nlohmann::json
 {
     FO_STACK_TRACE_ENTRY();
 
     auto doc_json = nlohmann::json::object();
 
-    for (auto&& [doc_key, doc_value] : doc) {
-        auto doc_key_cstr = make_ptr(doc_key.c_str());
-        doc_json[doc_key_cstr.get()] = AnyValueToJson(doc_value);
+    for (size_t i = 0; i < doc.Size(); i++) {
+        doc_json[string(doc.GetKey(i))] = AnyValueToJson(doc.GetValue(i));
     }
 
     return doc_json;
 }
 
-static auto JsonToAnyDocument(const nlohmann::json& doc_json) -> AnyData::Document
+static auto JsonToPackedDocument(const nlohmann::json& doc_json) -> AnyData::PackedDocument
 {
     FO_STACK_TRACE_ENTRY();
 
@@ -1783,31 +1932,77 @@ static auto JsonToAnyDocument(const nlohmann::json& doc_json) -> AnyData::Docume
         throw DataBaseException("Invalid pending database json document");
     }
 
-    AnyData::Document doc;
+    AnyData::PackedDocumentBuilder builder;
 
     for (auto&& [doc_key, doc_value] : doc_json.items()) {
-        doc.Emplace(string(doc_key), JsonToAnyValue(doc_value));
+        builder.Add(doc_key, JsonToAnyValue(doc_value));
     }
 
-    return doc;
+    return builder.Finish();
 }
 
-static auto AreDocumentsEqual(const AnyData::Document& left, const AnyData::Document& right) -> bool
+static auto ArePackedValuesEqual(const AnyData::PackedValue& left, const AnyData::PackedValue& right) -> bool
 {
-    FO_NO_STACK_TRACE_ENTRY();
+    FO_STACK_TRACE_ENTRY();
 
-    return left == right;
-}
+    // Structural comparison, the same content may be laid out with a different key table order
+    if (left.Type() != right.Type()) {
+        return false;
+    }
 
-static auto DoesDocumentContain(const AnyData::Document& target, const AnyData::Document& patch) -> bool
-{
-    FO_NO_STACK_TRACE_ENTRY();
+    switch (left.Type()) {
+    case AnyData::ValueType::Int64:
+        return left.AsInt64() == right.AsInt64();
+    case AnyData::ValueType::Float64:
+        return left.AsDouble() == right.AsDouble();
+    case AnyData::ValueType::Bool:
+        return left.AsBool() == right.AsBool();
+    case AnyData::ValueType::String:
+        return left.AsString() == right.AsString();
+    case AnyData::ValueType::Array:
+        if (left.Size() != right.Size()) {
+            return false;
+        }
+
+        for (size_t i = 0; i < left.Size(); i++) {
+            if (!ArePackedValuesEqual(left.GetElement(i), right.GetElement(i))) {
+                return false;
+            }
+        }
 
-    for (auto&& [patch_key, patch_value] : patch) {
-        if (!target.Contains(patch_key)) {
+        return true;
+    case AnyData::ValueType::Dict:
+        if (left.Size() != right.Size()) {
             return false;
         }
-        if (!(target[patch_key] == patch_value)) {
+
+        for (size_t i = 0; i < left.Size(); i++) {
+            if (left.GetKey(i) != right.GetKey(i) || !ArePackedValuesEqual(left.GetValue(i), right.GetValue(i))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+static auto AreDocumentsEqual(const AnyData::PackedDocumentView& left, const AnyData::PackedDocumentView& right) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    return left.Size() == right.Size() && DoesDocumentContain(left, right);
+}
+
+static auto DoesDocumentContain(const AnyData::PackedDocumentView& target, const AnyData::PackedDocumentView& patch) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    for (size_t i = 0; i < patch.Size(); i++) {
+        const auto target_value = target.Find(patch.GetKey(i));
+
+        if (!target_value.has_value() || !ArePackedValuesEqual(target_value.value(), patch.GetValue(i))) {
             return false;
         }
     }
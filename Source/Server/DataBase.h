@@ -104,9 +104,11 @@ class DataBase
     [[nodiscard]] auto GetAllIntIds(hstring collection_name) const -> vector<ident_t>;
     [[nodiscard]] auto GetAllStringIds(hstring collection_name) const -> vector<string>;
     [[nodiscard]] auto Get(hstring collection_name, const DataBaseKey& id) const -> AnyData::Document;
+    [[nodiscard]] auto GetPacked(hstring collection_name, const DataBaseKey& id) const -> AnyData::PackedDocument;
     [[nodiscard]] auto Valid(hstring collection_name, const DataBaseKey& id) const -> bool;
 
     void Insert(hstring collection_name, const DataBaseKey& id, const AnyData::Document& doc);
+    void Insert(hstring collection_name, const DataBaseKey& id, AnyData::PackedDocument doc);
     void Update(hstring collection_name, const DataBaseKey& id, string_view key, const AnyData::Value& value);
     void Delete(hstring collection_name, const DataBaseKey& id);
     void StartCommitChanges();
@@ -166,12 +168,12 @@ class DataBaseImpl
     [[nodiscard]] auto GetCollectionKeyType(hstring collection_name) const -> DataBaseKeyType;
     [[nodiscard]] virtual auto GetStringKeyEscaping() const noexcept -> DataBaseStringKeyEscaping = 0;
     [[nodiscard]] virtual auto GetAllRecordIds(hstring collection_name) const -> vector<DataBaseKey> = 0;
-    [[nodiscard]] auto GetDocument(hstring collection_name, const DataBaseKey& id) const -> AnyData::Document;
+    [[nodiscard]] auto GetDocument(hstring collection_name, const DataBaseKey& id) const -> AnyData::PackedDocument;
 
     void InitializeCollections(const DataBaseCollectionSchemas& collection_schemas);
     void InitializeOpLogs();
     void RestorePendingChanges();
-    void Insert(hstring collection_name, const DataBaseKey& id, const AnyData::Document& doc);
+    void Insert(hstring collection_name, const DataBaseKey& id, AnyData::PackedDocument doc);
     void Update(hstring collection_name, const DataBaseKey& id, string_view key, const AnyData::Value& value);
     void Delete(hstring collection_name, const DataBaseKey& id);
     void StartCommitChanges();
@@ -184,12 +186,30 @@ class DataBaseImpl
     void StopCommitThread() noexcept;
 
     virtual void EnsureCollection(hstring collection_name, DataBaseKeyType key_type) = 0;
-    virtual auto GetRecord(hstring collection_name, const DataBaseKey& id) const -> AnyData::Document = 0;
-    virtual void InsertRecord(hstring collection_name, const DataBaseKey& id, const AnyData::Document& doc) = 0;
-    virtual void UpdateRecord(hstring collection_name, const DataBaseKey& id, const AnyData::Document& doc) = 0;
+    // Records travel packed all the way, backends with their own encoding (BSON, JSON text) convert at their boundary
+    virtual auto GetRecord(hstring collection_name, const DataBaseKey& id) const -> AnyData::PackedDocument = 0;
+    virtual void InsertRecord(hstring collection_name, const DataBaseKey& id, const AnyData::PackedDocument& doc) = 0;
+    virtual void UpdateRecord(hstring collection_name, const DataBaseKey& id, const AnyData::PackedDocument& doc) = 0;
     virtual void DeleteRecord(hstring collection_name, const DataBaseKey& id) = 0;
     virtual auto TryReconnect() -> bool { return true; }
 
+    // Backends that can group writes (e.g. into one transaction) report a batch size above one; the commit
+    // thread then hands them up to that many pending operations between Begin/End, and on any failure the
+    // whole batch is aborted and spilled to the oplog together, except operations the backend reports as applied
+    [[nodiscard]] virtual auto GetCommitBatchSize() const noexcept -> size_t { return 1; }
+    // A partial batch may wait up to this long since its oldest change for more to arrive, unless changes are waited for
+    [[nodiscard]] virtual auto GetCommitFlushInterval() const noexcept -> timespan { return timespan::zero; }
+    virtual void BeginCommitBatch() { }
+    virtual void EndCommitBatch() { }
+    virtual void AbortCommitBatch() noexcept { }
+    // Backends that can't roll a failed batch back report which of its operations (by position in the batch)
+    // already reached storage, so only the others are spilled to the oplog
+    [[nodiscard]] virtual auto IsCommitBatchOperationApplied(size_t index) const noexcept -> bool
+    {
+        ignore_unused(index);
+        return false;
+    }
+
     virtual void OnCommitOperationWrittenToOpLog() { } // Testing override point for a failed commit operation being durably written to oplog
     virtual void OnPendingChangesRestored() { } // Testing override point for successful pending oplog restore
 
@@ -212,11 +232,13 @@ class DataBaseImpl
         CommitOperationType Type {};
         hstring CollectionName {};
         DataBaseKey RecordId {};
-        AnyData::Document Doc {};
+        AnyData::PackedDocument Doc {};
+        nanotime QueuedTime {};
     };
 
     void ScheduleCommit();
-    void CommitNextChange() noexcept;
+    void EnqueueCommitOperation(shared_ptr<CommitOperationData> op) FO_TSA_REQUIRES(_stateLocker);
+    void CommitNextChanges() noexcept;
     void CommitThreadEntry() noexcept;
     void RegisterDbRequests(size_t request_count) const;
     auto ResolveCollectionName(string_view collection_name) const -> hstring;
@@ -230,7 +252,9 @@ class DataBaseImpl
     std::condition_variable_any _commitThreadDoneSignal {};
     bool _commitThreadStopRequested FO_TSA_GUARDED_BY(_stateLocker) {};
     bool _commitThreadActive FO_TSA_GUARDED_BY(_stateLocker) {};
+    bool _commitFlushRequested FO_TSA_GUARDED_BY(_stateLocker) {};
     deque<shared_ptr<CommitOperationData>> _pendingCommitOperations FO_TSA_GUARDED_BY(_stateLocker) {};
+    unordered_map<pair<hstring, DataBaseKey>, deque<shared_ptr<CommitOperationData>>> _pendingRecordOperations FO_TSA_GUARDED_BY(_stateLocker) {}; // Same ops grouped by record, in queue order
     mutable unordered_set<pair<hstring, DataBaseKey>> _docReadRetryMarkers FO_TSA_GUARDED_BY(_stateLocker) {};
     mutable std::atomic_bool _backendFailed {};
     std::atomic_bool _panicStarted {};
@@ -261,8 +285,15 @@ auto CreateMongoDataBase(ptr<DataBaseSettings> db_settings, string_view uri, str
 #endif
 auto CreateMemoryDataBase(ptr<DataBaseSettings> db_settings, DataBasePanicCallback panic_callback) -> unique_ptr<DataBaseImpl>;
 
+void PackedDocumentToBson(const AnyData::PackedDocumentView& doc, ptr<bson_t> bson, char escape_dot = 0);
+auto BsonToPackedDocument(ptr<const bson_t> bson, char escape_dot = 0) -> AnyData::PackedDocument;
+auto PackedDocumentToJsonStorage(const AnyData::PackedDocumentView& doc, int32_t indent) -> string;
+auto JsonStorageToPackedDocument(string_view json) -> AnyData::PackedDocument;
+// Document forms of the above, for tools and tests
 void DocumentToBson(const AnyData::Document& doc, ptr<bson_t> bson, char escape_dot = 0);
 void BsonToDocument(ptr<const bson_t> bson, AnyData::Document& doc, char escape_dot = 0);
+auto DocumentToJsonStorage(const AnyData::Document& doc, int32_t indent) -> string;
+void JsonStorageToDocument(string_view json, AnyData::Document& doc);
 auto GetDbKeyType(const DataBaseKey& key) noexcept -> DataBaseKeyType;
 
 FO_END_NAMESPACE
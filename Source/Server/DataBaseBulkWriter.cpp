@@ -0,0 +1,159 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "DataBaseBulkWriter.h"
+
+FO_BEGIN_NAMESPACE
+
+static auto GetBulkOperationTypeName(DataBaseBulkOperationType type) noexcept -> string_view
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    switch (type) {
+    case DataBaseBulkOperationType::Insert:
+        return "insert";
+    case DataBaseBulkOperationType::Update:
+        return "update";
+    case DataBaseBulkOperationType::Delete:
+        return "delete";
+    }
+
+    return "unknown";
+}
+
+DataBaseBulkWriter::DataBaseBulkWriter(ptr<DataBaseBulkSink> sink) noexcept :
+    _sink {sink}
+{
+    FO_STACK_TRACE_ENTRY();
+}
+
+void DataBaseBulkWriter::Begin()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(!_open, "Database bulk writer is already open");
+    FO_STRONG_ASSERT(_pendingCount == 0);
+
+    _appliedOps.clear();
+    _open = true;
+}
+
+void DataBaseBulkWriter::Add(hstring collection_name, DataBaseBulkOperationType type, const DataBaseKey& id, AnyData::PackedDocument doc)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(_open, "Database bulk writer is not open", collection_name, id);
+
+    // Batches touch a handful of collections, a linear lookup keeps their first-seen order for free
+    auto it = std::ranges::find_if(_collections, [&](const CollectionOperations& entry) { return entry.CollectionName == collection_name; });
+
+    if (it == _collections.end()) {
+        it = _collections.emplace(_collections.end(), CollectionOperations {.CollectionName = collection_name});
+    }
+
+    it->Ops.emplace_back(DataBaseBulkOperation {.Type = type, .RecordId = id, .Doc = std::move(doc)});
+    it->BatchIndices.emplace_back(_pendingCount);
+    _pendingCount++;
+}
+
+void DataBaseBulkWriter::Flush()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(_open, "Database bulk writer is not open");
+
+    auto collections = std::move(_collections);
+    _collections = {};
+    _appliedOps.assign(_pendingCount, false);
+    _pendingCount = 0;
+    _open = false;
+
+    unordered_set<DataBaseKey> inserted_ids;
+
+    for (const auto& entry : collections) {
+        size_t bulk_begin = 0;
+
+        while (bulk_begin < entry.Ops.size()) {
+            // A record inserted by a bulk gets its next operation in the following one, so when the driver can't
+            // tell how far a failed bulk got, replaying each of its operations alone still finds a consistent record
+            size_t bulk_end = bulk_begin;
+            inserted_ids.clear();
+
+            while (bulk_end < entry.Ops.size() && !inserted_ids.contains(entry.Ops[bulk_end].RecordId)) {
+                if (entry.Ops[bulk_end].Type == DataBaseBulkOperationType::Insert) {
+                    inserted_ids.emplace(entry.Ops[bulk_end].RecordId);
+                }
+
+                bulk_end++;
+            }
+
+            ExecuteBulk(entry, bulk_begin, bulk_end);
+            bulk_begin = bulk_end;
+        }
+    }
+}
+
+void DataBaseBulkWriter::Discard() noexcept
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _collections.clear();
+    _pendingCount = 0;
+    _open = false;
+}
+
+void DataBaseBulkWriter::ExecuteBulk(const CollectionOperations& entry, size_t begin, size_t end)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto ops = const_span<DataBaseBulkOperation> {entry.Ops}.subspan(begin, end - begin);
+    const auto failure = _sink->ExecuteBulk(entry.CollectionName, ops);
+    const size_t applied_count = failure ? std::min(failure->OperationIndex.value_or(0), ops.size()) : ops.size();
+
+    for (size_t i = begin; i < begin + applied_count; i++) {
+        _appliedOps[entry.BatchIndices[i]] = true;
+    }
+
+    if (!failure) {
+        return;
+    }
+
+    if (failure->OperationIndex.has_value() && failure->OperationIndex.value() < ops.size()) {
+        const auto& failed_op = ops[failure->OperationIndex.value()];
+        throw DataBaseException("Database bulk write operation failed", entry.CollectionName, GetBulkOperationTypeName(failed_op.Type), failed_op.RecordId, failure->OperationIndex.value(), ops.size(), failure->Message);
+    }
+
+    throw DataBaseException("Database bulk write failed", entry.CollectionName, ops.size(), failure->Message);
+}
+
+FO_END_NAMESPACE
@@ -0,0 +1,111 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+#include "DataBase.h"
+
+FO_BEGIN_NAMESPACE
+
+enum class DataBaseBulkOperationType : uint8_t
+{
+    Insert,
+    Update,
+    Delete,
+};
+
+struct DataBaseBulkOperation
+{
+    DataBaseBulkOperationType Type {};
+    DataBaseKey RecordId {};
+    AnyData::PackedDocument Doc {};
+};
+
+struct DataBaseBulkFailure
+{
+    optional<size_t> OperationIndex {}; // Empty when the driver could not tell which operation failed
+    string Message {};
+};
+
+// Driver side of a bulk writer: sends one collection's operations as a single ordered request, which stops at the
+// first failing operation, and reports that operation's index within the request
+class DataBaseBulkSink
+{
+public:
+    virtual ~DataBaseBulkSink() = default;
+
+    virtual auto ExecuteBulk(hstring collection_name, const_span<DataBaseBulkOperation> ops) -> optional<DataBaseBulkFailure> = 0;
+};
+
+// Gathers the writes of one commit batch and flushes them as ordered bulk requests per collection, collections in
+// the order they first appear in the batch and operations of a collection in commit order. After a failed flush the
+// writer tells which operations the driver confirmed, so only the rest has to be replayed from the oplog
+class DataBaseBulkWriter final
+{
+public:
+    explicit DataBaseBulkWriter(ptr<DataBaseBulkSink> sink) noexcept;
+    DataBaseBulkWriter(const DataBaseBulkWriter&) = delete;
+    DataBaseBulkWriter(DataBaseBulkWriter&&) noexcept = delete;
+    auto operator=(const DataBaseBulkWriter&) = delete;
+    auto operator=(DataBaseBulkWriter&&) noexcept = delete;
+    ~DataBaseBulkWriter() = default;
+
+    [[nodiscard]] auto IsOpen() const noexcept -> bool { return _open; }
+    [[nodiscard]] auto GetPendingCount() const noexcept -> size_t { return _pendingCount; }
+    [[nodiscard]] auto IsOperationApplied(size_t batch_index) const noexcept -> bool { return batch_index < _appliedOps.size() && _appliedOps[batch_index]; }
+
+    void Begin();
+    void Add(hstring collection_name, DataBaseBulkOperationType type, const DataBaseKey& id, AnyData::PackedDocument doc);
+    void Flush();
+    void Discard() noexcept;
+
+private:
+    struct CollectionOperations
+    {
+        hstring CollectionName {};
+        vector<DataBaseBulkOperation> Ops {};
+        vector<size_t> BatchIndices {};
+    };
+
+    void ExecuteBulk(const CollectionOperations& entry, size_t begin, size_t end);
+
+    ptr<DataBaseBulkSink> _sink;
+    bool _open {};
+    size_t _pendingCount {};
+    vector<CollectionOperations> _collections {};
+    vector<bool> _appliedOps {}; // By batch index, kept from the last flush until the next batch begins
+};
+
+FO_END_NAMESPACE
@@ -64,9 +64,10 @@ auto EntityManager::GetEntity(ident_t id) const noexcept -> refcount_nptr<const
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    const auto& shard = _registry.GetShard(id);
+    shared_lock lock {shard.Lock};
 
-    if (auto it = _allEntities.find(id); it != _allEntities.end()) {
+    if (auto it = shard.Data.Entities.find(id); it != shard.Data.Entities.end()) {
         return it->second;
     }
 
@@ -77,9 +78,10 @@ auto EntityManager::GetEntity(ident_t id) noexcept -> refcount_nptr<ServerEntity
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    auto& shard = _registry.GetShard(id);
+    shared_lock lock {shard.Lock};
 
-    if (auto it = _allEntities.find(id); it != _allEntities.end()) {
+    if (auto it = shard.Data.Entities.find(id); it != shard.Data.Entities.end()) {
         return it->second;
     }
 
@@ -90,13 +92,14 @@ auto EntityManager::GetEntities() noexcept -> vector<refcount_ptr<ServerEntity>>
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
-
     vector<refcount_ptr<ServerEntity>> result;
-    result.reserve(_allEntities.size());
 
-    for (auto& [id, ptr] : _allEntities) {
-        result.emplace_back(ptr);
+    for (auto& shard : _registry.GetShards()) {
+        shared_lock lock {shard.Lock};
+
+        for (auto& [id, ptr] : shard.Data.Entities) {
+            result.emplace_back(ptr);
+        }
     }
 
     return result;
@@ -106,18 +109,24 @@ auto EntityManager::GetEntitiesCount() const noexcept -> size_t
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    size_t count = 0;
+
+    for (const auto& shard : _registry.GetShards()) {
+        shared_lock lock {shard.Lock};
+        count += shard.Data.Entities.size();
+    }
 
-    return _allEntities.size();
+    return count;
 }
 
 auto EntityManager::GetPlayer(ident_t id) const noexcept -> refcount_nptr<const Player>
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    const auto& shard = _registry.GetShard(id);
+    shared_lock lock {shard.Lock};
 
-    if (auto it = _allPlayers.find(id); it != _allPlayers.end()) {
+    if (auto it = shard.Data.Players.find(id); it != shard.Data.Players.end()) {
         return it->second.try_hold_ref();
     }
 
@@ -128,9 +137,10 @@ auto EntityManager::GetPlayer(ident_t id) noexcept -> refcount_nptr<Player>
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    auto& shard = _registry.GetShard(id);
+    shared_lock lock {shard.Lock};
 
-    if (auto it = _allPlayers.find(id); it != _allPlayers.end()) {
+    if (auto it = shard.Data.Players.find(id); it != shard.Data.Players.end()) {
         return it->second.try_hold_ref();
     }
 
@@ -141,13 +151,14 @@ auto EntityManager::GetPlayers() noexcept -> vector<refcount_ptr<Player>>
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
-
     vector<refcount_ptr<Player>> result;
-    result.reserve(_allPlayers.size());
 
-    for (auto& [id, ptr] : _allPlayers) {
-        result.emplace_back(ptr.hold_ref());
+    for (auto& shard : _registry.GetShards()) {
+        shared_lock lock {shard.Lock};
+
+        for (const auto& [id, ptr] : shard.Data.Players) {
+            result.emplace_back(ptr.hold_ref());
+        }
     }
 
     return result;
@@ -157,18 +168,24 @@ auto EntityManager::GetPlayersCount() const noexcept -> size_t
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    size_t count = 0;
+
+    for (const auto& shard : _registry.GetShards()) {
+        shared_lock lock {shard.Lock};
+        count += shard.Data.Players.size();
+    }
 
-    return _allPlayers.size();
+    return count;
 }
 
 auto EntityManager::GetLocation(ident_t id) const noexcept -> refcount_nptr<const Location>
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    const auto& shard = _registry.GetShard(id);
+    shared_lock lock {shard.Lock};
 
-    if (auto it = _allLocations.find(id); it != _allLocations.end()) {
+    if (auto it = shard.Data.Locations.find(id); it != shard.Data.Locations.end()) {
         return it->second.try_hold_ref();
     }
 
@@ -179,9 +196,10 @@ auto EntityManager::GetLocation(ident_t id) noexcept -> refcount_nptr<Location>
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    auto& shard = _registry.GetShard(id);
+    shared_lock lock {shard.Lock};
 
-    if (auto it = _allLocations.find(id); it != _allLocations.end()) {
+    if (auto it = shard.Data.Locations.find(id); it != shard.Data.Locations.end()) {
         return it->second.try_hold_ref();
     }
 
@@ -192,13 +210,14 @@ auto EntityManager::GetLocations() noexcept -> vector<refcount_ptr<Location>>
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
-
     vector<refcount_ptr<Location>> result;
-    result.reserve(_allLocations.size());
 
-    for (const auto& [id, ptr] : _allLocations) {
-        result.emplace_back(ptr.hold_ref());
+    for (auto& shard : _registry.GetShards()) {
+        shared_lock lock {shard.Lock};
+
+        for (const auto& [id, ptr] : shard.Data.Locations) {
+            result.emplace_back(ptr.hold_ref());
+        }
     }
 
     return result;
@@ -208,18 +227,24 @@ auto EntityManager::GetLocationsCount() const noexcept -> size_t
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    size_t count = 0;
+
+    for (const auto& shard : _registry.GetShards()) {
+        shared_lock lock {shard.Lock};
+        count += shard.Data.Locations.size();
+    }
 
-    return _allLocations.size();
+    return count;
 }
 
 auto EntityManager::GetMap(ident_t id) const noexcept -> refcount_nptr<const Map>
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    const auto& shard = _registry.GetShard(id);
+    shared_lock lock {shard.Lock};
 
-    if (auto it = _allMaps.find(id); it != _allMaps.end()) {
+    if (auto it = shard.Data.Maps.find(id); it != shard.Data.Maps.end()) {
         return it->second.try_hold_ref();
     }
 
@@ -230,9 +255,10 @@ auto EntityManager::GetMap(ident_t id) noexcept -> refcount_nptr<Map>
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    auto& shard = _registry.GetShard(id);
+    shared_lock lock {shard.Lock};
 
-    if (auto it = _allMaps.find(id); it != _allMaps.end()) {
+    if (auto it = shard.Data.Maps.find(id); it != shard.Data.Maps.end()) {
         return it->second.try_hold_ref();
     }
 
@@ -243,13 +269,14 @@ auto EntityManager::GetMaps() noexcept -> vector<refcount_ptr<Map>>
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
-
     vector<refcount_ptr<Map>> result;
-    result.reserve(_allMaps.size());
 
-    for (const auto& [id, ptr] : _allMaps) {
-        result.emplace_back(ptr.hold_ref());
+    for (auto& shard : _registry.GetShards()) {
+        shared_lock lock {shard.Lock};
+
+        for (const auto& [id, ptr] : shard.Data.Maps) {
+            result.emplace_back(ptr.hold_ref());
+        }
     }
 
     return result;
@@ -259,18 +286,24 @@ auto EntityManager::GetMapsCount() const noexcept -> size_t
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    size_t count = 0;
+
+    for (const auto& shard : _registry.GetShards()) {
+        shared_lock lock {shard.Lock};
+        count += shard.Data.Maps.size();
+    }
 
-    return _allMaps.size();
+    return count;
 }
 
 auto EntityManager::GetCritter(ident_t id) const noexcept -> refcount_nptr<const Critter>
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    const auto& shard = _registry.GetShard(id);
+    shared_lock lock {shard.Lock};
 
-    if (auto it = _allCritters.find(id); it != _allCritters.end()) {
+    if (auto it = shard.Data.Critters.find(id); it != shard.Data.Critters.end()) {
         return it->second.try_hold_ref();
     }
 
@@ -281,9 +314,10 @@ auto EntityManager::GetCritter(ident_t id) noexcept -> refcount_nptr<Critter>
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    auto& shard = _registry.GetShard(id);
+    shared_lock lock {shard.Lock};
 
-    if (auto it = _allCritters.find(id); it != _allCritters.end()) {
+    if (auto it = shard.Data.Critters.find(id); it != shard.Data.Critters.end()) {
         return it->second.try_hold_ref();
     }
 
@@ -294,13 +328,14 @@ auto EntityManager::GetCritters() noexcept -> vector<refcount_ptr<Critter>>
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
-
     vector<refcount_ptr<Critter>> result;
-    result.reserve(_allCritters.size());
 
-    for (const auto& [id, ptr] : _allCritters) {
-        result.emplace_back(ptr.hold_ref());
+    for (auto& shard : _registry.GetShards()) {
+        shared_lock lock {shard.Lock};
+
+        for (const auto& [id, ptr] : shard.Data.Critters) {
+            result.emplace_back(ptr.hold_ref());
+        }
     }
 
     return result;
@@ -310,18 +345,24 @@ auto EntityManager::GetCrittersCount() const noexcept -> size_t
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    size_t count = 0;
+
+    for (const auto& shard : _registry.GetShards()) {
+        shared_lock lock {shard.Lock};
+        count += shard.Data.Critters.size();
+    }
 
-    return _allCritters.size();
+    return count;
 }
 
 auto EntityManager::GetItem(ident_t id) const noexcept -> refcount_nptr<const Item>
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    const auto& shard = _registry.GetShard(id);
+    shared_lock lock {shard.Lock};
 
-    if (auto it = _allItems.find(id); it != _allItems.end()) {
+    if (auto it = shard.Data.Items.find(id); it != shard.Data.Items.end()) {
         return it->second.try_hold_ref();
     }
 
@@ -332,9 +373,10 @@ auto EntityManager::GetItem(ident_t id) noexcept -> refcount_nptr<Item>
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    auto& shard = _registry.GetShard(id);
+    shared_lock lock {shard.Lock};
 
-    if (auto it = _allItems.find(id); it != _allItems.end()) {
+    if (auto it = shard.Data.Items.find(id); it != shard.Data.Items.end()) {
         return it->second.try_hold_ref();
     }
 
@@ -345,13 +387,14 @@ auto EntityManager::GetItems() noexcept -> vector<refcount_ptr<Item>>
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
-
     vector<refcount_ptr<Item>> result;
-    result.reserve(_allItems.size());
 
-    for (const auto& [id, ptr] : _allItems) {
-        result.emplace_back(ptr.hold_ref());
+    for (auto& shard : _registry.GetShards()) {
+        shared_lock lock {shard.Lock};
+
+        for (const auto& [id, ptr] : shard.Data.Items) {
+            result.emplace_back(ptr.hold_ref());
+        }
     }
 
     return result;
@@ -361,13 +404,18 @@ auto EntityManager::GetItemsCount() const noexcept -> size_t
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    size_t count = 0;
+
+    for (const auto& shard : _registry.GetShards()) {
+        shared_lock lock {shard.Lock};
+        count += shard.Data.Items.size();
+    }
 
-    return _allItems.size();
+    return count;
 }
 
-// Runs single-threaded during init and calls back into the engine, which re-locks the registry, so holding
-// `_registryLock` across it would self-deadlock (Docs/ThreadSafetyAnalysis.md)
+// Runs single-threaded during init and calls back into the engine, which re-locks registry shards and the id
+// generator, so holding any of those locks across it would self-deadlock (Docs/ThreadSafetyAnalysis.md)
 void EntityManager::LoadEntities() FO_TSA_NO_ANALYSIS
 {
     FO_STACK_TRACE_ENTRY();
@@ -400,21 +448,26 @@ void EntityManager::LoadEntities() FO_TSA_NO_ANALYSIS
         throw ServerInitException("Load entities failed");
     }
 
-    WriteLog("Loaded {} locations", _allLocations.size());
-    WriteLog("Loaded {} maps", _allMaps.size());
-    WriteLog("Loaded {} critters", _allCritters.size());
-    WriteLog("Loaded {} items", _allItems.size());
-    WriteLog("Loaded {} other entities", _allEntities.size() - _allLocations.size() - _allMaps.size() - _allCritters.size() - _allItems.size());
+    const size_t locations_count = GetLocationsCount();
+    const size_t maps_count = GetMapsCount();
+    const size_t critters_count = GetCrittersCount();
+    const size_t items_count = GetItemsCount();
+
+    WriteLog("Loaded {} locations", locations_count);
+    WriteLog("Loaded {} maps", maps_count);
+    WriteLog("Loaded {} critters", critters_count);
+    WriteLog("Loaded {} items", items_count);
+    WriteLog("Loaded {} other entities", GetEntitiesCount() - locations_count - maps_count - critters_count - items_count);
 
     WriteLog("Init entities");
 
-    for (ptr<Location> loc : copy_hold_ref(_allLocations)) {
+    for (ptr<Location> loc : GetLocations()) {
         if (!loc->IsDestroyed()) {
             CallInit(loc, false);
         }
     }
 
-    for (ptr<Critter> cr : copy_hold_ref(_allCritters)) {
+    for (ptr<Critter> cr : GetCritters()) {
         if (!cr->IsDestroyed()) {
             _engine->MapMngr.ProcessVisibleCritters(cr);
         }
@@ -428,7 +481,7 @@ void EntityManager::FlushExactEntityId()
 {
     FO_STACK_TRACE_ENTRY();
 
-    scoped_lock lock {_registryLock};
+    scoped_lock lock {_idLock};
 
     _persistedEntityId = _lastEntityId;
     _engine->LockForPropertyAccess();
@@ -456,7 +509,7 @@ auto EntityManager::LoadLocation(ident_t loc_id, bool& is_error) noexcept -> ref
 
     auto loc = SafeAlloc::MakeRefCounted<Location>(_engine, loc_id, loc_proto);
 
-    if (!PropertiesSerializer::LoadFromDocument(loc->GetPropertiesForEdit(), loc_doc, _engine->Hashes, *_engine)) {
+    if (!PropertiesSerializer::LoadFromPackedDocument(loc->GetPropertiesForEdit(), loc_doc.GetView(), _engine->Hashes, *_engine)) {
         WriteLog(LogType::Warning, "Failed to restore location {} {} properties", loc_pid, loc_id);
         is_error = true;
         return nullptr;
@@ -536,7 +589,7 @@ auto EntityManager::LoadMap(ident_t map_id, bool& is_error) noexcept -> refcount
     auto static_map = _engine->MapMngr.GetStaticMap(map_proto);
     auto map = SafeAlloc::MakeRefCounted<Map>(_engine, map_id, map_proto, nullptr, static_map);
 
-    if (!PropertiesSerializer::LoadFromDocument(map->GetPropertiesForEdit(), map_doc, _engine->Hashes, *_engine)) {
+    if (!PropertiesSerializer::LoadFromPackedDocument(map->GetPropertiesForEdit(), map_doc.GetView(), _engine->Hashes, *_engine)) {
         WriteLog(LogType::Warning, "Failed to restore map {} {} properties", map_pid, map_id);
         is_error = true;
         return nullptr;
@@ -640,7 +693,7 @@ auto EntityManager::LoadCritter(ident_t cr_id, bool for_player, bool& is_error)
 
     auto cr = SafeAlloc::MakeRefCounted<Critter>(_engine, cr_id, proto);
 
-    if (!PropertiesSerializer::LoadFromDocument(cr->GetPropertiesForEdit(), cr_doc, _engine->Hashes, *_engine)) {
+    if (!PropertiesSerializer::LoadFromPackedDocument(cr->GetPropertiesForEdit(), cr_doc.GetView(), _engine->Hashes, *_engine)) {
         WriteLog(LogType::Warning, "Failed to restore critter {} {} properties", cr_pid, cr_id);
         is_error = true;
         return nullptr;
@@ -740,7 +793,7 @@ auto EntityManager::LoadItem(ident_t item_id, bool& is_error) noexcept -> refcou
 
     auto item = SafeAlloc::MakeRefCounted<Item>(_engine, item_id, proto);
 
-    if (!PropertiesSerializer::LoadFromDocument(item->GetPropertiesForEdit(), item_doc, _engine->Hashes, *_engine)) {
+    if (!PropertiesSerializer::LoadFromPackedDocument(item->GetPropertiesForEdit(), item_doc.GetView(), _engine->Hashes, *_engine)) {
         WriteLog(LogType::Warning, "Failed to restore item {} {} properties", item_pid, item_id);
         is_error = true;
         return nullptr;
@@ -877,14 +930,14 @@ void EntityManager::LoadInnerEntitiesEntry(ptr<Entity> holder, hstring entry, bo
     }
 }
 
-auto EntityManager::LoadEntityDoc(hstring type_name, hstring collection_name, ident_t id, bool expect_proto, bool& is_error) const noexcept -> tuple<AnyData::Document, hstring>
+auto EntityManager::LoadEntityDoc(hstring type_name, hstring collection_name, ident_t id, bool expect_proto, bool& is_error) const noexcept -> tuple<AnyData::PackedDocument, hstring>
 {
     FO_STACK_TRACE_ENTRY();
 
     try {
         FO_VERIFY_AND_THROW(id.underlying_value() != 0, "Generated entity id is zero");
 
-        auto doc = _engine->DbStorage.Get(collection_name, id);
+        auto doc = _engine->DbStorage.GetPacked(collection_name, id);
 
         if (doc.Empty()) {
             WriteLog(LogType::Warning, "{} document {} not found", collection_name, id);
@@ -892,7 +945,9 @@ auto EntityManager::LoadEntityDoc(hstring type_name, hstring collection_name, id
             return {};
         }
 
-        if (!doc.Contains("_Proto")) {
+        const auto proto_value = doc.GetView().Find("_Proto");
+
+        if (!proto_value.has_value()) {
             if (expect_proto) {
                 WriteLog(LogType::Warning, "{} '_Proto' section not found in entity {}", collection_name, id);
                 is_error = true;
@@ -901,15 +956,13 @@ auto EntityManager::LoadEntityDoc(hstring type_name, hstring collection_name, id
             return {std::move(doc), hstring()};
         }
 
-        const auto& proto_value = doc["_Proto"];
-
-        if (proto_value.Type() != AnyData::ValueType::String) {
-            WriteLog(LogType::Warning, "{} '_Proto' section of entity {} is not string type (but {})", collection_name, id, proto_value.Type());
+        if (proto_value->Type() != AnyData::ValueType::String) {
+            WriteLog(LogType::Warning, "{} '_Proto' section of entity {} is not string type (but {})", collection_name, id, proto_value->Type());
             is_error = true;
             return {};
         }
 
-        string_view proto_name = proto_value.AsString();
+        string_view proto_name = proto_value->AsString();
 
         if (proto_name.empty()) {
             WriteLog(LogType::Warning, "{} '_Proto' section of entity {} is empty", collection_name, id);
@@ -1079,23 +1132,30 @@ void EntityManager::RegisterPlayer(ptr<Player> player, ident_t id, bool persiste
     ident_t assigned_id = player->GetId();
     FO_VERIFY_AND_THROW(!id || !assigned_id || assigned_id == id, "Player is already assigned a different id", assigned_id, id);
     ident_t requested_id = id ? id : assigned_id;
-    scoped_lock lock {_registryLock};
 
-    if (requested_id) {
-        if (_allPlayers.contains(requested_id)) {
-            throw EntityManagerException("Player id is already registered", requested_id);
-        }
+    if (!requested_id) {
+        AssignEntityId(player);
+        requested_id = player->GetId();
+    }
 
-        FO_VERIFY_AND_THROW(!_allEntities.contains(requested_id), "Player registry is inconsistent with the global entity registry", requested_id);
+    auto& shard = _registry.GetShard(requested_id);
+    scoped_lock lock {shard.Lock};
+
+    if (shard.Data.Players.contains(requested_id)) {
+        throw EntityManagerException("Player id is already registered", requested_id);
     }
 
+    FO_VERIFY_AND_THROW(!shard.Data.Entities.contains(requested_id), "Player registry is inconsistent with the global entity registry", requested_id);
+
     if (id) {
         player->SetId(id);
     }
 
-    RegisterEntity(player);
+    AssignEntityId(player); // The id is set by now, so this only tracks it and takes no shard lock
+
+    RegisterEntity(shard, player);
     player->SetPersistent(persistent);
-    const auto [it, inserted] = _allPlayers.emplace(player->GetId(), player);
+    const auto [it, inserted] = shard.Data.Players.emplace(player->GetId(), player);
     FO_STRONG_ASSERT(inserted, "Player id is already registered", player->GetId());
 }
 
@@ -1103,23 +1163,27 @@ void EntityManager::UnregisterPlayer(ptr<Player> player)
 {
     FO_STACK_TRACE_ENTRY();
 
-    scoped_lock lock {_registryLock};
+    auto& shard = _registry.GetShard(player->GetId());
+    scoped_lock lock {shard.Lock};
 
-    auto it = _allPlayers.find(player->GetId());
-    FO_STRONG_ASSERT(it != _allPlayers.end(), "Lookup failed in all players");
-    _allPlayers.erase(it);
-    UnregisterEntity(player, false);
+    auto it = shard.Data.Players.find(player->GetId());
+    FO_STRONG_ASSERT(it != shard.Data.Players.end(), "Lookup failed in all players");
+    shard.Data.Players.erase(it);
+    UnregisterEntity(shard, player, false);
 }
 
 void EntityManager::RegisterLocation(ptr<Location> loc)
 {
     FO_STACK_TRACE_ENTRY();
 
-    scoped_lock lock {_registryLock};
     CaptureFreshEntity(loc);
+    AssignEntityId(loc);
 
-    RegisterEntity(loc);
-    const auto [it, inserted] = _allLocations.emplace(loc->GetId(), loc);
+    auto& shard = _registry.GetShard(loc->GetId());
+    scoped_lock lock {shard.Lock};
+
+    RegisterEntity(shard, loc);
+    const auto [it, inserted] = shard.Data.Locations.emplace(loc->GetId(), loc);
     FO_STRONG_ASSERT(inserted, "Location id is already registered", loc->GetId(), loc->GetProtoId());
 }
 
@@ -1127,23 +1191,27 @@ void EntityManager::UnregisterLocation(ptr<Location> loc)
 {
     FO_STACK_TRACE_ENTRY();
 
-    scoped_lock lock {_registryLock};
+    auto& shard = _registry.GetShard(loc->GetId());
+    scoped_lock lock {shard.Lock};
 
-    auto it = _allLocations.find(loc->GetId());
-    FO_STRONG_ASSERT(it != _allLocations.end(), "Lookup failed in all locations");
-    _allLocations.erase(it);
-    UnregisterEntity(loc, true);
+    auto it = shard.Data.Locations.find(loc->GetId());
+    FO_STRONG_ASSERT(it != shard.Data.Locations.end(), "Lookup failed in all locations");
+    shard.Data.Locations.erase(it);
+    UnregisterEntity(shard, loc, true);
 }
 
 void EntityManager::RegisterMap(ptr<Map> map)
 {
     FO_STACK_TRACE_ENTRY();
 
-    scoped_lock lock {_registryLock};
     CaptureFreshEntity(map);
+    AssignEntityId(map);
+
+    auto& shard = _registry.GetShard(map->GetId());
+    scoped_lock lock {shard.Lock};
 
-    RegisterEntity(map);
-    const auto [it, inserted] = _allMaps.emplace(map->GetId(), map);
+    RegisterEntity(shard, map);
+    const auto [it, inserted] = shard.Data.Maps.emplace(map->GetId(), map);
     FO_STRONG_ASSERT(inserted, "Map id is already registered", map->GetId(), map->GetProtoId());
 }
 
@@ -1151,23 +1219,27 @@ void EntityManager::UnregisterMap(ptr<Map> map)
 {
     FO_STACK_TRACE_ENTRY();
 
-    scoped_lock lock {_registryLock};
+    auto& shard = _registry.GetShard(map->GetId());
+    scoped_lock lock {shard.Lock};
 
-    auto it = _allMaps.find(map->GetId());
-    FO_STRONG_ASSERT(it != _allMaps.end(), "Lookup failed in all maps");
-    _allMaps.erase(it);
-    UnregisterEntity(map, true);
+    auto it = shard.Data.Maps.find(map->GetId());
+    FO_STRONG_ASSERT(it != shard.Data.Maps.end(), "Lookup failed in all maps");
+    shard.Data.Maps.erase(it);
+    UnregisterEntity(shard, map, true);
 }
 
 void EntityManager::RegisterCritter(ptr<Critter> cr)
 {
     FO_STACK_TRACE_ENTRY();
 
-    scoped_lock lock {_registryLock};
     CaptureFreshEntity(cr);
+    AssignEntityId(cr);
 
-    RegisterEntity(cr);
-    const auto [it, inserted] = _allCritters.emplace(cr->GetId(), cr);
+    auto& shard = _registry.GetShard(cr->GetId());
+    scoped_lock lock {shard.Lock};
+
+    RegisterEntity(shard, cr);
+    const auto [it, inserted] = shard.Data.Critters.emplace(cr->GetId(), cr);
     FO_STRONG_ASSERT(inserted, "Critter id is already registered", cr->GetId(), cr->GetProtoId());
 }
 
@@ -1175,23 +1247,27 @@ void EntityManager::UnregisterCritter(ptr<Critter> cr)
 {
     FO_STACK_TRACE_ENTRY();
 
-    scoped_lock lock {_registryLock};
+    auto& shard = _registry.GetShard(cr->GetId());
+    scoped_lock lock {shard.Lock};
 
-    auto it = _allCritters.find(cr->GetId());
-    FO_STRONG_ASSERT(it != _allCritters.end(), "Lookup failed in all critters");
-    _allCritters.erase(it);
-    UnregisterEntity(cr, !cr->GetControlledByPlayer());
+    auto it = shard.Data.Critters.find(cr->GetId());
+    FO_STRONG_ASSERT(it != shard.Data.Critters.end(), "Lookup failed in all critters");
+    shard.Data.Critters.erase(it);
+    UnregisterEntity(shard, cr, !cr->GetControlledByPlayer());
 }
 
 void EntityManager::RegisterItem(ptr<Item> item)
 {
     FO_STACK_TRACE_ENTRY();
 
-    scoped_lock lock {_registryLock};
     CaptureFreshEntity(item);
+    AssignEntityId(item);
+
+    auto& shard = _registry.GetShard(item->GetId());
+    scoped_lock lock {shard.Lock};
 
-    RegisterEntity(item);
-    const auto [it, inserted] = _allItems.emplace(item->GetId(), item);
+    RegisterEntity(shard, item);
+    const auto [it, inserted] = shard.Data.Items.emplace(item->GetId(), item);
     FO_STRONG_ASSERT(inserted, "Item id is already registered", item->GetId(), item->GetProtoId());
 }
 
@@ -1199,12 +1275,13 @@ void EntityManager::UnregisterItem(ptr<Item> item, bool delete_from_db)
 {
     FO_STACK_TRACE_ENTRY();
 
-    scoped_lock lock {_registryLock};
+    auto& shard = _registry.GetShard(item->GetId());
+    scoped_lock lock {shard.Lock};
 
-    auto it = _allItems.find(item->GetId());
-    FO_STRONG_ASSERT(it != _allItems.end(), "Lookup failed in all items");
-    _allItems.erase(it);
-    UnregisterEntity(item, delete_from_db);
+    auto it = shard.Data.Items.find(item->GetId());
+    FO_STRONG_ASSERT(it != shard.Data.Items.end(), "Lookup failed in all items");
+    shard.Data.Items.erase(it);
+    UnregisterEntity(shard, item, delete_from_db);
 }
 
 void EntityManager::RegisterCustomEntity(ptr<CustomEntity> custom_entity)
@@ -1237,11 +1314,14 @@ void EntityManager::RegisterCustomEntity(ptr<CustomEntity> custom_entity)
 
     ValidateEntityAccess(custom_entity);
 
-    scoped_lock lock {_registryLock};
+    AssignEntityId(custom_entity);
+
+    auto& shard = _registry.GetShard(custom_entity->GetId());
+    scoped_lock lock {shard.Lock};
 
-    RegisterEntity(custom_entity);
+    RegisterEntity(shard, custom_entity);
 
-    auto& custom_entities = _allCustomEntities[custom_entity->GetTypeName()];
+    auto& custom_entities = shard.Data.CustomEntities[custom_entity->GetTypeName()];
     const auto [it, inserted] = custom_entities.emplace(custom_entity->GetId(), custom_entity);
     FO_STRONG_ASSERT(inserted, "Custom entity id is already registered", custom_entity->GetTypeName(), custom_entity->GetId());
 }
@@ -1250,13 +1330,14 @@ void EntityManager::UnregisterCustomEntity(ptr<CustomEntity> custom_entity, bool
 {
     FO_STACK_TRACE_ENTRY();
 
-    scoped_lock lock {_registryLock};
+    auto& shard = _registry.GetShard(custom_entity->GetId());
+    scoped_lock lock {shard.Lock};
 
-    auto& custom_entities = _allCustomEntities[custom_entity->GetTypeName()];
+    auto& custom_entities = shard.Data.CustomEntities[custom_entity->GetTypeName()];
     auto it = custom_entities.find(custom_entity->GetId());
     FO_STRONG_ASSERT(it != custom_entities.end(), "Lookup failed in custom entities");
     custom_entities.erase(it);
-    UnregisterEntity(custom_entity, delete_from_db);
+    UnregisterEntity(shard, custom_entity, delete_from_db);
 }
 
 void EntityManager::MakePersistent(ptr<ServerEntity> entity, bool persistent, bool explicitly_requested)
@@ -1382,19 +1463,37 @@ void EntityManager::ForEachPersistentChildEntity(ptr<ServerEntity> entity, const
     }
 }
 
-auto EntityManager::StoreEntityDoc(ptr<ServerEntity> entity) -> AnyData::Document
+auto EntityManager::StoreEntityDoc(ptr<ServerEntity> entity) -> AnyData::PackedDocument
+{
+    FO_STACK_TRACE_ENTRY();
+
+    AnyData::PackedDocumentBuilder builder;
+    StoreEntityDoc(entity, builder);
+    return builder.Finish();
+}
+
+void EntityManager::StoreEntityDoc(ptr<ServerEntity> entity, AnyData::PackedDocumentBuilder& builder)
 {
     FO_STACK_TRACE_ENTRY();
 
     if (auto entity_with_proto = entity.dyn_cast<EntityWithProto>()) {
-        auto proto = entity_with_proto->GetProto();
-        auto doc = PropertiesSerializer::SaveToDocument(entity->GetProperties(), proto->GetProperties(), _engine->Hashes, *_engine);
-        doc.Emplace("_Proto", string(proto->GetName()));
-        return doc;
+        StoreEntityDoc(entity->GetProperties(), entity_with_proto->GetProto(), builder);
+    }
+    else {
+        StoreEntityDoc(entity->GetProperties(), nullptr, builder);
+    }
+}
+
+void EntityManager::StoreEntityDoc(ptr<const Properties> props, nptr<const ProtoEntity> proto, AnyData::PackedDocumentBuilder& builder)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (proto) {
+        PropertiesSerializer::SaveToPackedDocument(props, proto->GetProperties(), builder, _engine->Hashes, *_engine);
+        builder.Add("_Proto", AnyData::Value(string(proto->GetName())));
     }
     else {
-        auto doc = PropertiesSerializer::SaveToDocument(entity->GetProperties(), nullptr, _engine->Hashes, *_engine);
-        return doc;
+        PropertiesSerializer::SaveToPackedDocument(props, nullptr, builder, _engine->Hashes, *_engine);
     }
 }
 
@@ -1402,20 +1501,33 @@ void EntityManager::CaptureFreshEntity(ptr<ServerEntity> entity)
 {
     FO_STACK_TRACE_ENTRY();
 
-    ident_t id = entity->GetId();
-    FO_VERIFY_AND_THROW(!id || !_allEntities.contains(id), "Fresh entity is already published in the global entity registry", entity->GetTypeName(), id);
+    if (ident_t id = entity->GetId()) {
+        const auto& shard = _registry.GetShard(id);
+        shared_lock lock {shard.Lock};
+        FO_VERIFY_AND_THROW(!shard.Data.Entities.contains(id), "Fresh entity is already published in the global entity registry", entity->GetTypeName(), id);
+    }
+
     _engine->RequireCurrentSyncContext()->EnsureFreshEntitySynced(entity);
 }
 
-void EntityManager::RegisterEntity(ptr<ServerEntity> entity)
+void EntityManager::AssignEntityId(ptr<ServerEntity> entity)
 {
     FO_STACK_TRACE_ENTRY();
 
-    // Caller must hold _registryLock (unique)
-    if (!entity->GetId()) {
+    if (ident_t id = entity->GetId()) {
+        scoped_lock lock {_idLock};
+        _lastEntityId = std::max(_lastEntityId, id.underlying_value());
+        return;
+    }
+
+    // The id picks the registry shard, so a fresh one is generated before any shard lock is taken
+    ident_t id;
+
+    {
+        scoped_lock lock {_idLock};
+
         int64_t id_num = ++_lastEntityId;
-        ident_t id {numeric_cast<int64_t>(id_num)};
-        FO_STRONG_ASSERT(_allEntities.count(id) == 0, "Generated entity id is already present in the entity registry", entity->GetTypeName(), id);
+        id = ident_t {numeric_cast<int64_t>(id_num)};
 
         if (id_num > _persistedEntityId) {
             _persistedEntityId = id_num + _engine->Settings->EntityIdReserveBatch - 1;
@@ -1424,31 +1536,39 @@ void EntityManager::RegisterEntity(ptr<ServerEntity> entity)
             auto unlock_prop = scope_exit([this]() noexcept { _engine->UnlockForPropertyAccess(); });
             _engine->SetLastEntityId(ident_t {numeric_cast<int64_t>(_persistedEntityId)});
         }
-
-        entity->SetId(id);
     }
-    else {
-        int64_t id_num = entity->GetId().underlying_value();
-        _lastEntityId = std::max(_lastEntityId, id_num);
+
+    {
+        const auto& shard = _registry.GetShard(id);
+        shared_lock lock {shard.Lock};
+        FO_STRONG_ASSERT(!shard.Data.Entities.contains(id), "Generated entity id is already present in the entity registry", entity->GetTypeName(), id);
     }
 
-    const auto [it, inserted] = _allEntities.emplace(entity->GetId(), entity.hold_ref());
+    entity->SetId(id);
+}
+
+void EntityManager::RegisterEntity(RegistryShard& shard, ptr<ServerEntity> entity)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(entity->GetId(), "Entity id must be assigned before registration", entity->GetTypeName());
+
+    const auto [it, inserted] = shard.Data.Entities.emplace(entity->GetId(), entity.hold_ref());
     FO_VERIFY_AND_THROW(inserted, "Entity id is already registered in the global entity registry", entity->GetTypeName(), entity->GetId());
 }
 
-void EntityManager::UnregisterEntity(ptr<ServerEntity> entity, bool delete_from_db)
+void EntityManager::UnregisterEntity(RegistryShard& shard, ptr<ServerEntity> entity, bool delete_from_db)
 {
     FO_STACK_TRACE_ENTRY();
 
-    // Caller must hold _registryLock (unique) for the erase portion
     ident_t entity_id = entity->GetId();
     hstring type_name_plural = entity->GetTypeNamePlural();
     bool is_persistent = entity->IsPersistent();
     FO_VERIFY_AND_THROW(entity_id, "Missing required entity id");
 
-    auto it = _allEntities.find(entity_id);
-    FO_STRONG_ASSERT(it != _allEntities.end(), "Lookup failed in all entities");
-    _allEntities.erase(it); // This may be the last ptr to the entity, so it may be destroyed here
+    auto it = shard.Data.Entities.find(entity_id);
+    FO_STRONG_ASSERT(it != shard.Data.Entities.end(), "Lookup failed in all entities");
+    shard.Data.Entities.erase(it); // This may be the last ptr to the entity, so it may be destroyed here
 
     if (delete_from_db && is_persistent) {
         _engine->DbStorage.Delete(type_name_plural, entity_id);
@@ -1512,28 +1632,39 @@ void EntityManager::DestroyAllEntities() FO_TSA_NO_ANALYSIS
 {
     FO_STACK_TRACE_ENTRY();
 
-    auto destroy_entities = [this](auto& entities) FO_TSA_NO_ANALYSIS {
+    auto destroy_entities = [](RegistryShard& shard, auto& entities) FO_TSA_NO_ANALYSIS {
         for (auto&& [id, entity] : copy(entities)) {
             entity->SetParent(nullptr);
             entity->MarkAsDestroyed();
             entities.erase(id);
-            _allEntities.erase(id);
+            shard.Data.Entities.erase(id);
         }
 
         FO_VERIFY_AND_THROW(entities.empty(), "Entities must be empty before this operation");
     };
 
-    destroy_entities(_allPlayers);
-    destroy_entities(_allLocations);
-    destroy_entities(_allMaps);
-    destroy_entities(_allCritters);
-    destroy_entities(_allItems);
+    // Same type order as before sharding: players first, custom entities last
+    auto destroy_in_all_shards = [&](auto RegistryShardData::* entities) FO_TSA_NO_ANALYSIS {
+        for (auto& shard : _registry.GetShards()) {
+            destroy_entities(shard, shard.Data.*entities);
+        }
+    };
+
+    destroy_in_all_shards(&RegistryShardData::Players);
+    destroy_in_all_shards(&RegistryShardData::Locations);
+    destroy_in_all_shards(&RegistryShardData::Maps);
+    destroy_in_all_shards(&RegistryShardData::Critters);
+    destroy_in_all_shards(&RegistryShardData::Items);
 
-    for (auto& val : _allCustomEntities | std::views::values) {
-        destroy_entities(val);
+    for (auto& shard : _registry.GetShards()) {
+        for (auto& val : shard.Data.CustomEntities | std::views::values) {
+            destroy_entities(shard, val);
+        }
     }
 
-    FO_VERIFY_AND_THROW(_allEntities.empty(), "All entities must be empty before this operation");
+    for (const auto& shard : _registry.GetShards()) {
+        FO_VERIFY_AND_THROW(shard.Data.Entities.empty(), "All entities must be empty before this operation");
+    }
 }
 
 auto EntityManager::CreateCustomInnerEntity(ptr<Entity> holder, hstring entry, hstring pid) -> ptr<CustomEntity>
@@ -1659,10 +1790,11 @@ auto EntityManager::LoadCustomEntity(ptr<Entity> holder, hstring type_name, iden
         }
 
         {
-            shared_lock lock {_registryLock};
+            const auto& shard = _registry.GetShard(id);
+            shared_lock lock {shard.Lock};
 
-            auto type_it = _allCustomEntities.find(type_name);
-            FO_VERIFY_AND_THROW(type_it == _allCustomEntities.end() || type_it->second.count(id) == 0, "Custom entity id is already registered for this type while loading from storage", type_name, id);
+            auto type_it = shard.Data.CustomEntities.find(type_name);
+            FO_VERIFY_AND_THROW(type_it == shard.Data.CustomEntities.end() || type_it->second.count(id) == 0, "Custom entity id is already registered for this type while loading from storage", type_name, id);
         }
 
         hstring collection_name = _engine->Hashes.ToHashedString(strex("{}s", type_name));
@@ -1702,7 +1834,7 @@ auto EntityManager::LoadCustomEntity(ptr<Entity> holder, hstring type_name, iden
             return SafeAlloc::MakeRefCounted<CustomEntity>(_engine, id, registrar, nullptr);
         }();
 
-        if (!PropertiesSerializer::LoadFromDocument(entity->GetPropertiesForEdit(), doc, _engine->Hashes, *_engine)) {
+        if (!PropertiesSerializer::LoadFromPackedDocument(entity->GetPropertiesForEdit(), doc.GetView(), _engine->Hashes, *_engine)) {
             WriteLog(LogType::Warning, "Failed to load properties for custom entity {} with type {}", id, type_name);
             is_error = true;
             return nullptr;
@@ -1728,11 +1860,12 @@ auto EntityManager::GetCustomEntity(hstring type_name, ident_t id) -> refcount_n
 {
     FO_STACK_TRACE_ENTRY();
 
-    shared_lock lock {_registryLock};
+    const auto& shard = _registry.GetShard(id);
+    shared_lock lock {shard.Lock};
 
-    auto type_it = _allCustomEntities.find(type_name);
+    auto type_it = shard.Data.CustomEntities.find(type_name);
 
-    if (type_it == _allCustomEntities.end()) {
+    if (type_it == shard.Data.CustomEntities.end()) {
         return nullptr;
     }
 
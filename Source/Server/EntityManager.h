@@ -41,6 +41,7 @@
 #include "Location.h"
 #include "Map.h"
 #include "Player.h"
+#include "StripedRegistry.h"
 
 FO_BEGIN_NAMESPACE
 
@@ -86,10 +87,11 @@ class EntityManager final
     [[nodiscard]] auto Get(ident_t id) noexcept -> refcount_nptr<T>
     {
         static_assert(std::is_base_of_v<ServerEntity, T>);
-        shared_lock lock {_registryLock};
-        auto it = _allEntities.find(id);
+        auto& shard = _registry.GetShard(id);
+        shared_lock lock {shard.Lock};
+        auto it = shard.Data.Entities.find(id);
 
-        if (it == _allEntities.end()) {
+        if (it == shard.Data.Entities.end()) {
             return nullptr;
         }
 
@@ -100,10 +102,11 @@ class EntityManager final
     [[nodiscard]] auto Get(ident_t id) const noexcept -> refcount_nptr<const T>
     {
         static_assert(std::is_base_of_v<ServerEntity, T>);
-        shared_lock lock {_registryLock};
-        auto it = _allEntities.find(id);
+        const auto& shard = _registry.GetShard(id);
+        shared_lock lock {shard.Lock};
+        auto it = shard.Data.Entities.find(id);
 
-        if (it == _allEntities.end()) {
+        if (it == shard.Data.Entities.end()) {
             return nullptr;
         }
 
@@ -147,6 +150,10 @@ class EntityManager final
     void DestroyAllEntities();
     void FlushExactEntityId();
 
+    auto StoreEntityDoc(ptr<ServerEntity> entity) -> AnyData::PackedDocument;
+    void StoreEntityDoc(ptr<ServerEntity> entity, AnyData::PackedDocumentBuilder& builder);
+    void StoreEntityDoc(ptr<const Properties> props, nptr<const ProtoEntity> proto, AnyData::PackedDocumentBuilder& builder);
+
 private:
     void MakePersistentRecursive(ptr<ServerEntity> entity, unordered_set<ptr<ServerEntity>>& processed);
     void MakeNonPersistentRecursive(ptr<ServerEntity> entity, unordered_set<ptr<ServerEntity>>& processed);
@@ -154,29 +161,39 @@ class EntityManager final
 
     void LoadInnerEntities(ptr<Entity> holder, bool& is_error) noexcept;
     void LoadInnerEntitiesEntry(ptr<Entity> holder, hstring entry, bool& is_error) noexcept;
-    auto LoadEntityDoc(hstring type_name, hstring collection_name, ident_t id, bool expect_proto, bool& is_error) const noexcept -> tuple<AnyData::Document, hstring>;
-    auto StoreEntityDoc(ptr<ServerEntity> entity) -> AnyData::Document;
+    auto LoadEntityDoc(hstring type_name, hstring collection_name, ident_t id, bool expect_proto, bool& is_error) const noexcept -> tuple<AnyData::PackedDocument, hstring>;
 
     auto ConstructCustomEntity(hstring type_name, hstring pid) -> refcount_ptr<CustomEntity>;
     void AttachCustomEntityToHolder(ptr<CustomEntity> entity, ptr<Entity> holder);
 
-    void CaptureFreshEntity(ptr<ServerEntity> entity) FO_TSA_REQUIRES(_registryLock);
-    void RegisterEntity(ptr<ServerEntity> entity) FO_TSA_REQUIRES(_registryLock);
-    void UnregisterEntity(ptr<ServerEntity> entity, bool delete_from_db) FO_TSA_REQUIRES(_registryLock);
+    static constexpr size_t REGISTRY_SHARDS = 32;
+
+    struct RegistryShardData
+    {
+        unordered_map<ident_t, ptr<Player>> Players {};
+        unordered_map<ident_t, ptr<Location>> Locations {};
+        unordered_map<ident_t, ptr<Map>> Maps {};
+        unordered_map<ident_t, ptr<Critter>> Critters {};
+        unordered_map<ident_t, ptr<Item>> Items {};
+        unordered_map<hstring, unordered_map<ident_t, ptr<CustomEntity>>> CustomEntities {};
+        unordered_map<ident_t, refcount_ptr<ServerEntity>> Entities {};
+    };
+
+    using Registry = StripedRegistry<RegistryShardData, REGISTRY_SHARDS>;
+    using RegistryShard = Registry::Shard;
+
+    void CaptureFreshEntity(ptr<ServerEntity> entity);
+    void AssignEntityId(ptr<ServerEntity> entity);
+    void RegisterEntity(RegistryShard& shard, ptr<ServerEntity> entity) FO_TSA_REQUIRES(shard.Lock);
+    void UnregisterEntity(RegistryShard& shard, ptr<ServerEntity> entity, bool delete_from_db) FO_TSA_REQUIRES(shard.Lock);
 
     ptr<ServerEngine> _engine;
 
-    mutable shared_mutex _registryLock {};
-    unordered_map<ident_t, ptr<Player>> _allPlayers FO_TSA_GUARDED_BY(_registryLock) {};
-    unordered_map<ident_t, ptr<Location>> _allLocations FO_TSA_GUARDED_BY(_registryLock) {};
-    unordered_map<ident_t, ptr<Map>> _allMaps FO_TSA_GUARDED_BY(_registryLock) {};
-    unordered_map<ident_t, ptr<Critter>> _allCritters FO_TSA_GUARDED_BY(_registryLock) {};
-    unordered_map<ident_t, ptr<Item>> _allItems FO_TSA_GUARDED_BY(_registryLock) {};
-    unordered_map<hstring, unordered_map<ident_t, ptr<CustomEntity>>> _allCustomEntities FO_TSA_GUARDED_BY(_registryLock) {};
-    unordered_map<ident_t, refcount_ptr<ServerEntity>> _allEntities FO_TSA_GUARDED_BY(_registryLock) {};
-
-    int64_t _lastEntityId {};
-    int64_t _persistedEntityId {};
+    // Lock order: a shard lock may be followed by `_idLock`, never the reverse
+    Registry _registry {};
+    mutex _idLock {};
+    int64_t _lastEntityId FO_TSA_GUARDED_BY(_idLock) {};
+    int64_t _persistedEntityId FO_TSA_GUARDED_BY(_idLock) {};
 
     const hstring _playerTypeName {};
     const hstring _locationTypeName {};
@@ -61,6 +61,13 @@ static constexpr int32_t BACKOFF_MAX_SHIFT = 6;
 static thread_local nptr<SyncContext> CurrentContext {};
 static std::atomic<uint64_t> TicketCounter {};
 
+// Process-wide and relaxed: contention diagnostics only, nothing decides on them
+static std::atomic<uint64_t> SyncRetryCount {};
+static std::atomic<uint64_t> EnsureRetryCount {};
+static std::atomic<uint64_t> SpinRollbackCount {};
+static std::atomic<uint64_t> FairFallbackCount {};
+static std::atomic<uint64_t> ParkedWaitCount {};
+
 EntityLock::EntityLock()
 {
     FO_STACK_TRACE_ENTRY();
@@ -103,6 +110,7 @@ void EntityLock::Acquire(uint64_t ticket)
     // insert/erase operations so the in-progress `wait(0)` below points at the right atomic
     auto insert_pos = std::ranges::find_if(_waitQueue, [ticket](const auto& e) { return e.Ticket > ticket; });
     auto entry_it = _waitQueue.emplace(insert_pos);
+    ParkedWaitCount.fetch_add(1, std::memory_order_relaxed);
     entry_it->Ticket = ticket;
     entry_it->Waiter = this_thread;
     entry_it->Kind = WaitKind::Exclusive;
@@ -165,6 +173,7 @@ void EntityLock::AcquireShared(uint64_t ticket)
 
     auto insert_pos = std::ranges::find_if(_waitQueue, [ticket](const auto& e) { return e.Ticket > ticket; });
     auto entry_it = _waitQueue.emplace(insert_pos);
+    ParkedWaitCount.fetch_add(1, std::memory_order_relaxed);
     entry_it->Ticket = ticket;
     entry_it->Waiter = this_thread;
     entry_it->Kind = WaitKind::Shared;
@@ -281,6 +290,7 @@ void EntityLock::RegisterDescendantHold(uint64_t ticket)
 
     auto insert_pos = std::ranges::find_if(_waitQueue, [ticket](const auto& e) { return e.Ticket > ticket; });
     auto entry_it = _waitQueue.emplace(insert_pos);
+    ParkedWaitCount.fetch_add(1, std::memory_order_relaxed);
     entry_it->Ticket = ticket;
     entry_it->Waiter = this_thread;
     entry_it->Kind = WaitKind::DescendantHold;
@@ -965,6 +975,7 @@ void SyncContext::SyncEntities(const_span<ptr<ServerEntity>> entities)
 
         // The stale cover is released so other threads are not blocked while waiting, and the back-off keeps
         // the recompute from re-racing the same in-flight transfer
+        SyncRetryCount.fetch_add(1, std::memory_order_relaxed);
         ReleaseLocks();
         BackoffBeforeSyncRetry(attempt);
     }
@@ -1129,6 +1140,7 @@ void FO_TSA_NO_ANALYSIS SyncContext::EnsureEntitySyncedImpl(ptr<ServerEntity> en
                 throw EntitySyncException("EnsureEntitySynced: covered entity lock is contended", entity->GetName(), entity->GetId());
             }
 
+            EnsureRetryCount.fetch_add(1, std::memory_order_relaxed);
             BackoffBeforeSyncRetry(attempt);
         }
 
@@ -1319,11 +1331,13 @@ void SyncContext::AcquireLocks(SyncLockList& locks, vector<refcount_ptr<ServerEn
         }
 
         RollbackOps(ops, acquired, std::numeric_limits<size_t>::max());
+        SpinRollbackCount.fetch_add(1, std::memory_order_relaxed);
 
         std::this_thread::yield();
     }
 
     if (!acquired_all) {
+        FairFallbackCount.fetch_add(1, std::memory_order_relaxed);
         AcquireLocksOrderedFair(locks, holds);
     }
 
@@ -1578,6 +1592,19 @@ auto NextSyncTicket() noexcept -> uint64_t
     return TicketCounter.fetch_add(1, std::memory_order_relaxed);
 }
 
+auto GetSyncContentionStats() noexcept -> SyncContentionStats
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return SyncContentionStats {
+        .SyncRetries = SyncRetryCount.load(std::memory_order_relaxed),
+        .EnsureRetries = EnsureRetryCount.load(std::memory_order_relaxed),
+        .SpinRollbacks = SpinRollbackCount.load(std::memory_order_relaxed),
+        .FairFallbacks = FairFallbackCount.load(std::memory_order_relaxed),
+        .ParkedWaits = ParkedWaitCount.load(std::memory_order_relaxed),
+    };
+}
+
 void EnsureEntitySynced(nptr<ServerEntity> entity)
 {
     FO_STACK_TRACE_ENTRY();
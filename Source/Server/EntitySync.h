@@ -46,6 +46,18 @@ class EntityManager;
 
 [[nodiscard]] auto NextSyncTicket() noexcept -> uint64_t;
 
+// Cumulative process-wide counters of the non-blocking retry paths and parked waits, for measuring contention
+struct SyncContentionStats
+{
+    uint64_t SyncRetries {}; // SyncEntities cover recomputes after a reparent race
+    uint64_t EnsureRetries {}; // EnsureEntitySynced batch back-offs
+    uint64_t SpinRollbacks {}; // Non-parking acquire passes rolled back on a busy lock
+    uint64_t FairFallbacks {}; // Acquires that exhausted the spin budget and went through the ordered fair path
+    uint64_t ParkedWaits {}; // Entity lock requests that had to park in a wait queue
+};
+
+[[nodiscard]] auto GetSyncContentionStats() noexcept -> SyncContentionStats;
+
 // The read-path coverage check — reparenting is stricter and needs the entity's own lock. `diagnose` dumps the
 // parent chain before the caller throws, which the non-throwing Game.IsEntityLocked probe turns off
 [[nodiscard]] auto IsEntityAccessValid(nptr<const ServerEntity> entity, bool diagnose = true) noexcept -> bool;
@@ -0,0 +1,212 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+FO_BEGIN_NAMESPACE
+
+// Items of one critter inventory or item container, bucketed by id, proto and critter slot, so ammo, key and
+// equipment lookups don't walk the whole item list. Each entry keeps the sequence number of its add and buckets stay
+// ordered by it, so a lookup returns the same item a front-to-back scan of the owner's list would. Protos never
+// change on a held item, only slots move, and the owner reports that through `ChangeSlot`. Items added without a slot
+// (container contents) are kept out of slot buckets
+template<typename T>
+class InventoryIndex final
+{
+public:
+    InventoryIndex() = default;
+    InventoryIndex(const InventoryIndex&) = delete;
+    InventoryIndex(InventoryIndex&&) noexcept = delete;
+    auto operator=(const InventoryIndex&) = delete;
+    auto operator=(InventoryIndex&&) noexcept = delete;
+    ~InventoryIndex() = default;
+
+    [[nodiscard]] auto GetCount() const noexcept -> size_t { return _entries.size(); }
+
+    [[nodiscard]] auto Find(ident_t item_id) const noexcept -> nptr<T>
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        const auto it = _entries.find(item_id);
+
+        if (it == _entries.end()) {
+            return nullptr;
+        }
+
+        return it->second.Item;
+    }
+
+    [[nodiscard]] auto FindByPid(hstring pid) const noexcept -> nptr<T>
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        const auto it = _byPid.find(pid);
+
+        if (it == _byPid.end()) {
+            return nullptr;
+        }
+
+        return it->second.front();
+    }
+
+    // Every item of the proto, in add order
+    [[nodiscard]] auto GetByPid(hstring pid) const noexcept -> const_span<ptr<T>>
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        const auto it = _byPid.find(pid);
+
+        if (it == _byPid.end()) {
+            return {};
+        }
+
+        return it->second;
+    }
+
+    [[nodiscard]] auto FindBySlot(CritterItemSlot slot) const noexcept -> nptr<T>
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        const auto it = _bySlot.find(slot);
+
+        if (it == _bySlot.end()) {
+            return nullptr;
+        }
+
+        return it->second.front().Item;
+    }
+
+    void Add(ident_t item_id, ptr<T> item, hstring pid, optional<CritterItemSlot> slot)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        const uint64_t order = ++_lastOrder;
+        const auto [it, inserted] = _entries.emplace(item_id, Entry {.Order = order, .Item = item, .Pid = pid, .Slot = slot});
+        FO_VERIFY_AND_THROW(inserted, "Item is already indexed", item_id);
+
+        // The new entry has the highest order, so appending keeps both buckets sorted
+        _byPid[pid].emplace_back(item);
+
+        if (slot.has_value()) {
+            _bySlot[slot.value()].emplace_back(SlotEntry {.Order = order, .Item = item});
+        }
+    }
+
+    void Remove(ident_t item_id)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        const auto it = _entries.find(item_id);
+        FO_VERIFY_AND_THROW(it != _entries.end(), "Item is not indexed", item_id);
+        const Entry entry = it->second;
+        _entries.erase(it);
+
+        const auto pid_it = _byPid.find(entry.Pid);
+        FO_STRONG_ASSERT(pid_it != _byPid.end(), "Indexed item is missing from its proto bucket", item_id, entry.Pid);
+        vec_remove_unique_value(pid_it->second, entry.Item);
+
+        if (pid_it->second.empty()) {
+            _byPid.erase(pid_it);
+        }
+
+        if (entry.Slot.has_value()) {
+            RemoveFromSlot(item_id, entry);
+        }
+    }
+
+    // False when the item is not indexed here or was added without a slot; slot setters also run on items outside of any inventory
+    auto ChangeSlot(ident_t item_id, CritterItemSlot slot) -> bool
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        const auto it = _entries.find(item_id);
+
+        if (it == _entries.end() || !it->second.Slot.has_value()) {
+            return false;
+        }
+
+        auto& entry = it->second;
+
+        if (entry.Slot.value() != slot) {
+            RemoveFromSlot(item_id, entry);
+            entry.Slot = slot;
+
+            auto& bucket = _bySlot[slot];
+            const auto pos = std::ranges::lower_bound(bucket, entry.Order, {}, &SlotEntry::Order);
+            bucket.emplace(pos, SlotEntry {.Order = entry.Order, .Item = entry.Item});
+        }
+
+        return true;
+    }
+
+private:
+    struct Entry
+    {
+        uint64_t Order {};
+        ptr<T> Item;
+        hstring Pid {};
+        optional<CritterItemSlot> Slot {};
+    };
+
+    struct SlotEntry
+    {
+        uint64_t Order {};
+        ptr<T> Item;
+    };
+
+    void RemoveFromSlot(ident_t item_id, const Entry& entry)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        const auto slot_it = _bySlot.find(entry.Slot.value());
+        FO_STRONG_ASSERT(slot_it != _bySlot.end(), "Indexed item is missing from its slot bucket", item_id);
+
+        auto& bucket = slot_it->second;
+        const auto pos = std::ranges::lower_bound(bucket, entry.Order, {}, &SlotEntry::Order);
+        FO_STRONG_ASSERT(pos != bucket.end() && pos->Order == entry.Order, "Indexed item is missing from its slot bucket", item_id);
+        bucket.erase(pos);
+
+        if (bucket.empty()) {
+            _bySlot.erase(slot_it);
+        }
+    }
+
+    unordered_map<ident_t, Entry> _entries {};
+    unordered_map<hstring, vector<ptr<T>>> _byPid {};
+    unordered_map<CritterItemSlot, vector<SlotEntry>> _bySlot {};
+    uint64_t _lastOrder {};
+};
+
+FO_END_NAMESPACE
@@ -111,13 +111,7 @@ auto Item::GetInnerItem(ident_t item_id) noexcept -> nptr<Item>
         return nullptr;
     }
 
-    for (auto& item : *_innerItems) {
-        if (item->GetId() == item_id) {
-            return item;
-        }
-    }
-
-    return nullptr;
+    return _innerItemsIndex->Find(item_id);
 }
 
 auto Item::GetInnerItemByPid(hstring pid, const any_t& stack_id) noexcept -> nptr<Item>
@@ -130,8 +124,8 @@ auto Item::GetInnerItemByPid(hstring pid, const any_t& stack_id) noexcept -> npt
         return nullptr;
     }
 
-    for (auto& item : *_innerItems) {
-        if (item->GetProtoId() == pid && (stack_id.empty() || item->GetContainerStack() == stack_id)) {
+    for (ptr<Item> item : _innerItemsIndex->GetByPid(pid)) {
+        if (stack_id.empty() || item->GetContainerStack() == stack_id) {
             return item;
         }
     }
@@ -212,6 +206,7 @@ auto Item::TakeAllInnerItems() -> vector<refcount_ptr<Item>>
 
     vector<refcount_ptr<Item>> result = std::move(*_innerItems);
     _innerItems.reset();
+    _innerItemsIndex.reset();
 
     return result;
 }
@@ -225,9 +220,11 @@ void Item::SetItemToContainer(ptr<Item> item)
 
     if (!_innerItems) {
         _innerItems.emplace();
+        _innerItemsIndex = SafeAlloc::MakeUnique<InventoryIndex<Item>>();
     }
 
     vec_add_unique_value(*_innerItems, item.hold_ref());
+    _innerItemsIndex->Add(item->GetId(), item, item->GetProtoId(), std::nullopt);
 
     item->SetOwnership(ItemOwnership::ItemContainer);
     item->SetContainerId(GetId());
@@ -256,10 +253,6 @@ auto Item::AddItemToContainer(ptr<Item> item, const any_t& stack_id) -> ptr<Item
         }
     }
 
-    if (!_innerItems) {
-        _innerItems.emplace();
-    }
-
     item->SetContainerStack(stack_id);
     SetItemToContainer(item);
 
@@ -288,9 +281,11 @@ void Item::RemoveItemFromContainer(ptr<Item> item)
     item->SetContainerStack({});
 
     vec_remove_unique_value(*_innerItems, item.hold_ref());
+    _innerItemsIndex->Remove(item->GetId());
 
     if (_innerItems->empty()) {
         _innerItems.reset();
+        _innerItemsIndex.reset();
     }
 
     auto inner_item_ids = GetInnerItemIds();
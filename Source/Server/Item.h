@@ -38,6 +38,7 @@
 #include "EntityProperties.h"
 #include "EntityProtos.h"
 #include "EntitySync.h"
+#include "InventoryIndex.h"
 #include "ScriptSystem.h"
 #include "ServerEntity.h"
 
@@ -90,6 +91,7 @@ class Item : public ServerEntity, public EntityWithProto, public ItemProperties
 private:
     ptr<const ProtoItem> _protoItem;
     optional<vector<refcount_ptr<Item>>> _innerItems {};
+    unique_nptr<InventoryIndex<Item>> _innerItemsIndex {}; // Exists together with `_innerItems`
     optional<vector<mpos>> _multihexEntries {};
     EntityLock _ownedLock {};
 };
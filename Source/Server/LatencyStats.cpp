@@ -0,0 +1,383 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "LatencyStats.h"
+
+#include "Entity.h"
+
+FO_BEGIN_NAMESPACE
+
+static auto GetJobTypeName(WorkerJobType type) -> string_view
+{
+    FO_STACK_TRACE_ENTRY();
+
+    switch (type) {
+    case WorkerJobType::None:
+        return "Anonymous";
+    case WorkerJobType::Player:
+        return "Player";
+    case WorkerJobType::NotLoggedInPlayer:
+        return "NotLoggedInPlayer";
+    case WorkerJobType::CritterMovement:
+        return "CritterMovement";
+    case WorkerJobType::TimeEvent:
+        return "TimeEvent";
+    }
+
+    return "Unknown";
+}
+
+static auto GetNetMessageName(NetMessage msg) -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    switch (msg) {
+    case NetMessage::Handshake:
+        return "Handshake";
+    case NetMessage::Ping:
+        return "Ping";
+    case NetMessage::GetUpdateFile:
+        return "GetUpdateFile";
+    case NetMessage::GetUpdateFileDelta:
+        return "GetUpdateFileDelta";
+    case NetMessage::SendCritterDir:
+        return "SendCritterDir";
+    case NetMessage::SendCritterMove:
+        return "SendCritterMove";
+    case NetMessage::SendStopCritterMove:
+        return "SendStopCritterMove";
+    case NetMessage::RemoteCall:
+        return "RemoteCall";
+    case NetMessage::SendProperty:
+        return "SendProperty";
+    case NetMessage::UnresolvedHash:
+        return "UnresolvedHash";
+    default:
+        break;
+    }
+
+    return strex("Message{}", static_cast<int32_t>(msg)).str();
+}
+
+auto LatencyHistogram::GetBucketIndex(uint64_t value_ns) noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    value_ns = std::min(value_ns, (uint64_t {1} << MAX_VALUE_BITS) - 1);
+
+    if (value_ns < SUB_BUCKET_COUNT) {
+        return static_cast<size_t>(value_ns);
+    }
+
+    // Top bit selects the power of two, the next SUB_BUCKET_BITS bits select the linear sub-bucket inside it
+    const auto msb = static_cast<size_t>(std::bit_width(value_ns)) - 1;
+    const size_t shift = msb - SUB_BUCKET_BITS;
+    const auto sub_bucket = static_cast<size_t>(value_ns >> shift) & (SUB_BUCKET_COUNT - 1);
+    return (msb - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT + sub_bucket;
+}
+
+auto LatencyHistogram::GetBucketUpperBound(size_t bucket_index) noexcept -> uint64_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (bucket_index < SUB_BUCKET_COUNT) {
+        return bucket_index;
+    }
+
+    const size_t msb = bucket_index / SUB_BUCKET_COUNT + SUB_BUCKET_BITS - 1;
+    const size_t shift = msb - SUB_BUCKET_BITS;
+    const uint64_t lower_bound = (uint64_t {SUB_BUCKET_COUNT} + bucket_index % SUB_BUCKET_COUNT) << shift;
+    return lower_bound + (uint64_t {1} << shift) - 1;
+}
+
+void LatencyHistogram::Record(timespan duration, nanotime now) noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    const int64_t epoch = std::max(now.nanoseconds(), int64_t {0}) / SLOT_DURATION.nanoseconds();
+    Slot& slot = _slots[static_cast<size_t>(epoch) % WINDOW_SLOTS];
+    int64_t slot_epoch = slot.Epoch.load(std::memory_order_acquire);
+
+    if (slot_epoch != epoch) {
+        if (slot_epoch > epoch) {
+            // Sample from a thread preempted across a whole window, its slot already belongs to a newer period
+            return;
+        }
+
+        if (slot.Epoch.compare_exchange_strong(slot_epoch, epoch, std::memory_order_acq_rel)) {
+            for (auto& bucket : slot.Buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+
+            slot.Max.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    const uint64_t value_ns = duration > timespan::zero ? static_cast<uint64_t>(duration.nanoseconds()) : 0;
+    slot.Buckets[GetBucketIndex(value_ns)].fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t cur_max = slot.Max.load(std::memory_order_relaxed);
+
+    while (value_ns > cur_max && !slot.Max.compare_exchange_weak(cur_max, value_ns, std::memory_order_relaxed)) {
+        // Retry with the refreshed maximum
+    }
+}
+
+auto LatencyHistogram::GetSummary(nanotime now) const noexcept -> Summary
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    const int64_t cur_epoch = std::max(now.nanoseconds(), int64_t {0}) / SLOT_DURATION.nanoseconds();
+    array<uint64_t, BUCKET_COUNT> buckets {};
+    Summary summary;
+
+    for (const Slot& slot : _slots) {
+        const int64_t slot_epoch = slot.Epoch.load(std::memory_order_acquire);
+
+        if (slot_epoch < 0 || slot_epoch > cur_epoch || slot_epoch <= cur_epoch - static_cast<int64_t>(WINDOW_SLOTS)) {
+            continue;
+        }
+
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            const uint32_t count = slot.Buckets[i].load(std::memory_order_relaxed);
+            buckets[i] += count;
+            summary.Count += count;
+        }
+
+        summary.Max = std::max(summary.Max, timespan {static_cast<int64_t>(slot.Max.load(std::memory_order_relaxed))});
+    }
+
+    if (summary.Count == 0) {
+        return summary;
+    }
+
+    // Nearest-rank percentiles, reported as the bucket upper bound capped by the observed maximum
+    const uint64_t p50_rank = std::max<uint64_t>((summary.Count * 50 + 99) / 100, 1);
+    const uint64_t p99_rank = std::max<uint64_t>((summary.Count * 99 + 99) / 100, 1);
+    const auto max_ns = static_cast<uint64_t>(summary.Max.nanoseconds());
+    uint64_t cumulative = 0;
+    bool p50_found = false;
+
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+        cumulative += buckets[i];
+
+        if (!p50_found && cumulative >= p50_rank) {
+            summary.P50 = timespan {static_cast<int64_t>(std::min(GetBucketUpperBound(i), max_ns))};
+            p50_found = true;
+        }
+
+        if (cumulative >= p99_rank) {
+            summary.P99 = timespan {static_cast<int64_t>(std::min(GetBucketUpperBound(i), max_ns))};
+            break;
+        }
+    }
+
+    return summary;
+}
+
+void LatencyHistogram::Reset() noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    for (Slot& slot : _slots) {
+        slot.Epoch.store(-1, std::memory_order_release);
+
+        for (auto& bucket : slot.Buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+
+        slot.Max.store(0, std::memory_order_relaxed);
+    }
+}
+
+auto LatencyStats::GetJobHistogram(WorkerJobType type) noexcept -> nptr<LatencyHistogram>
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    const auto index = static_cast<size_t>(type);
+
+    if (!IsEnabled() || index >= JOB_TYPE_COUNT) {
+        return nullptr;
+    }
+
+    return &_jobs[index];
+}
+
+auto LatencyStats::GetNetMessageHistogram(NetMessage msg) noexcept -> nptr<LatencyHistogram>
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (!IsEnabled()) {
+        return nullptr;
+    }
+
+    auto& cached = _netMessages[static_cast<size_t>(msg)];
+
+    if (LatencyHistogram* histogram = cached.load(std::memory_order_acquire); histogram != nullptr) {
+        return histogram;
+    }
+
+    nptr<LatencyHistogram> result;
+
+    safe_call([&] {
+        scoped_lock locker {_storageLocker};
+
+        LatencyHistogram* histogram = cached.load(std::memory_order_acquire);
+
+        if (histogram == nullptr) {
+            auto new_histogram = SafeAlloc::MakeUnique<LatencyHistogram>();
+            histogram = new_histogram.get();
+            _netMessageStorage.emplace_back(std::move(new_histogram));
+            cached.store(histogram, std::memory_order_release);
+        }
+
+        result = histogram;
+    });
+
+    return result;
+}
+
+auto LatencyStats::GetEventHistogram(uint32_t event_id) noexcept -> nptr<LatencyHistogram>
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    const size_t chunk_index = event_id / EVENTS_PER_CHUNK;
+
+    if (!IsEnabled() || chunk_index >= EVENT_CHUNK_COUNT) {
+        return nullptr;
+    }
+
+    // Same lazy publication as net messages, split in chunks since event ids are not bounded by a small enum
+    auto& cached_chunk = _events[chunk_index];
+
+    if (const EventChunk* chunk = cached_chunk.load(std::memory_order_acquire); chunk != nullptr) {
+        if (LatencyHistogram* histogram = (*chunk)[event_id % EVENTS_PER_CHUNK].load(std::memory_order_acquire); histogram != nullptr) {
+            return histogram;
+        }
+    }
+
+    nptr<LatencyHistogram> result;
+
+    safe_call([&] {
+        scoped_lock locker {_storageLocker};
+
+        EventChunk* chunk = cached_chunk.load(std::memory_order_acquire);
+
+        if (chunk == nullptr) {
+            auto new_chunk = SafeAlloc::MakeUnique<EventChunk>();
+            chunk = new_chunk.get();
+            _eventChunkStorage.emplace_back(std::move(new_chunk));
+            cached_chunk.store(chunk, std::memory_order_release);
+        }
+
+        auto& cached = (*chunk)[event_id % EVENTS_PER_CHUNK];
+        LatencyHistogram* histogram = cached.load(std::memory_order_acquire);
+
+        if (histogram == nullptr) {
+            auto new_histogram = SafeAlloc::MakeUnique<LatencyHistogram>();
+            histogram = new_histogram.get();
+            _eventStorage.emplace_back(std::move(new_histogram));
+            cached.store(histogram, std::memory_order_release);
+        }
+
+        result = histogram;
+    });
+
+    return result;
+}
+
+auto LatencyStats::GetEntries(nanotime now) const -> vector<Entry>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    vector<Entry> entries;
+
+    for (size_t i = 0; i < JOB_TYPE_COUNT; i++) {
+        if (auto summary = _jobs[i].GetSummary(now); summary.Count != 0) {
+            entries.emplace_back(Entry {.Group = "Job", .Name = string(GetJobTypeName(static_cast<WorkerJobType>(i))), .Summary = summary});
+        }
+    }
+
+    for (size_t i = 0; i < NET_MESSAGE_COUNT; i++) {
+        if (const LatencyHistogram* histogram = _netMessages[i].load(std::memory_order_acquire); histogram != nullptr) {
+            if (auto summary = histogram->GetSummary(now); summary.Count != 0) {
+                entries.emplace_back(Entry {.Group = "NetMessage", .Name = GetNetMessageName(static_cast<NetMessage>(i)), .Summary = summary});
+            }
+        }
+    }
+
+    vector<Entry> event_entries;
+
+    for (size_t chunk_index = 0; chunk_index < EVENT_CHUNK_COUNT; chunk_index++) {
+        const EventChunk* chunk = _events[chunk_index].load(std::memory_order_acquire);
+
+        if (chunk == nullptr) {
+            continue;
+        }
+
+        for (size_t i = 0; i < EVENTS_PER_CHUNK; i++) {
+            if (const LatencyHistogram* histogram = (*chunk)[i].load(std::memory_order_acquire); histogram != nullptr) {
+                if (auto summary = histogram->GetSummary(now); summary.Count != 0) {
+                    const auto event_id = numeric_cast<uint32_t>(chunk_index * EVENTS_PER_CHUNK + i);
+                    event_entries.emplace_back(Entry {.Group = "Event", .Name = string(Entity::GetEventName(event_id)), .Summary = summary});
+                }
+            }
+        }
+    }
+
+    std::ranges::sort(event_entries, [](const Entry& e1, const Entry& e2) { return e1.Name < e2.Name; });
+    entries.insert(entries.end(), std::make_move_iterator(event_entries.begin()), std::make_move_iterator(event_entries.end()));
+
+    return entries;
+}
+
+void LatencyStats::Reset() noexcept
+{
+    FO_STACK_TRACE_ENTRY();
+
+    for (auto& histogram : _jobs) {
+        histogram.Reset();
+    }
+
+    shared_lock locker {_storageLocker};
+
+    for (const auto& histogram : _netMessageStorage) {
+        histogram->Reset();
+    }
+    for (const auto& histogram : _eventStorage) {
+        histogram->Reset();
+    }
+}
+
+FO_END_NAMESPACE
@@ -0,0 +1,167 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+#include "Common.h"
+
+#include "WorkerPool.h"
+
+FO_BEGIN_NAMESPACE
+
+// Lock-free log-linear latency histogram over a sliding time window
+// Values are bucketed HDR-style: exact below 8ns, then 8 sub-buckets per power of two (<= 12.5% relative error)
+// The window is split into fixed slots; a slot is recycled when its epoch expires, so samples racing with the
+// recycle of their own slot may be dropped - acceptable for diagnostics, never for accounting
+class LatencyHistogram final
+{
+public:
+    static constexpr size_t SUB_BUCKET_BITS = 3;
+    static constexpr size_t SUB_BUCKET_COUNT = size_t {1} << SUB_BUCKET_BITS;
+    static constexpr size_t MAX_VALUE_BITS = 40; // ~18 minutes in nanoseconds, longer samples are clamped
+    static constexpr size_t BUCKET_COUNT = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+    static constexpr size_t WINDOW_SLOTS = 6;
+    static constexpr timespan SLOT_DURATION = std::chrono::seconds {10};
+    static constexpr timespan WINDOW_DURATION = std::chrono::seconds {60};
+
+    struct Summary
+    {
+        uint64_t Count {};
+        timespan P50 {};
+        timespan P99 {};
+        timespan Max {};
+    };
+
+    LatencyHistogram() noexcept = default;
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram(LatencyHistogram&&) noexcept = delete;
+    auto operator=(const LatencyHistogram&) = delete;
+    auto operator=(LatencyHistogram&&) noexcept = delete;
+    ~LatencyHistogram() = default;
+
+    [[nodiscard]] auto GetSummary(nanotime now) const noexcept -> Summary;
+
+    void Record(timespan duration, nanotime now) noexcept;
+    void Reset() noexcept;
+
+    [[nodiscard]] static auto GetBucketIndex(uint64_t value_ns) noexcept -> size_t;
+    [[nodiscard]] static auto GetBucketUpperBound(size_t bucket_index) noexcept -> uint64_t;
+
+private:
+    struct Slot
+    {
+        std::atomic<int64_t> Epoch {-1};
+        std::atomic<uint64_t> Max {};
+        array<std::atomic<uint32_t>, BUCKET_COUNT> Buckets {};
+    };
+
+    array<Slot, WINDOW_SLOTS> _slots {};
+};
+
+// Per-hot-path latency registry: worker job types, inbound net messages and script events
+// Disabled collection costs one relaxed load per call site
+class LatencyStats final
+{
+public:
+    static constexpr size_t JOB_TYPE_COUNT = static_cast<size_t>(WorkerJobType::TimeEvent) + 1;
+    static constexpr size_t NET_MESSAGE_COUNT = size_t {std::numeric_limits<std::underlying_type_t<NetMessage>>::max()} + 1;
+    static constexpr size_t EVENTS_PER_CHUNK = 256;
+    static constexpr size_t EVENT_CHUNK_COUNT = 256; // Ids past the last chunk are not sampled
+
+    struct Entry
+    {
+        string Group {};
+        string Name {};
+        LatencyHistogram::Summary Summary {};
+    };
+
+    LatencyStats() noexcept = default;
+    LatencyStats(const LatencyStats&) = delete;
+    LatencyStats(LatencyStats&&) noexcept = delete;
+    auto operator=(const LatencyStats&) = delete;
+    auto operator=(LatencyStats&&) noexcept = delete;
+    ~LatencyStats() = default;
+
+    [[nodiscard]] auto IsEnabled() const noexcept -> bool { return _enabled.load(std::memory_order_relaxed); }
+    [[nodiscard]] auto GetJobHistogram(WorkerJobType type) noexcept -> nptr<LatencyHistogram>;
+    [[nodiscard]] auto GetNetMessageHistogram(NetMessage msg) noexcept -> nptr<LatencyHistogram>;
+    [[nodiscard]] auto GetEventHistogram(uint32_t event_id) noexcept -> nptr<LatencyHistogram>;
+    [[nodiscard]] auto GetEntries(nanotime now) const -> vector<Entry>;
+
+    void SetEnabled(bool enabled) noexcept { _enabled.store(enabled, std::memory_order_relaxed); }
+    void Reset() noexcept;
+
+private:
+    using EventChunk = array<std::atomic<LatencyHistogram*>, EVENTS_PER_CHUNK>;
+
+    std::atomic_bool _enabled {};
+    array<LatencyHistogram, JOB_TYPE_COUNT> _jobs {};
+    array<std::atomic<LatencyHistogram*>, NET_MESSAGE_COUNT> _netMessages {}; // Lazily created, owned by _netMessageStorage
+    mutable shared_mutex _storageLocker {};
+    vector<unique_ptr<LatencyHistogram>> _netMessageStorage FO_TSA_GUARDED_BY(_storageLocker) {};
+    array<std::atomic<EventChunk*>, EVENT_CHUNK_COUNT> _events {}; // Indexed by interned event id, lazily created, owned by the storages below
+    vector<unique_ptr<EventChunk>> _eventChunkStorage FO_TSA_GUARDED_BY(_storageLocker) {};
+    vector<unique_ptr<LatencyHistogram>> _eventStorage FO_TSA_GUARDED_BY(_storageLocker) {};
+};
+
+// Measures the enclosing scope into a histogram, no-op when the histogram is null (collection disabled)
+class LatencySample final
+{
+public:
+    explicit LatencySample(nptr<LatencyHistogram> histogram) noexcept :
+        _histogram {histogram},
+        _start {histogram ? nanotime::now() : nanotime::zero}
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+    }
+    LatencySample(const LatencySample&) = delete;
+    LatencySample(LatencySample&&) noexcept = delete;
+    auto operator=(const LatencySample&) = delete;
+    auto operator=(LatencySample&&) noexcept = delete;
+    ~LatencySample()
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        if (_histogram) {
+            nanotime now = nanotime::now();
+            _histogram->Record(now - _start, now);
+        }
+    }
+
+private:
+    nptr<LatencyHistogram> _histogram;
+    nanotime _start;
+};
+
+FO_END_NAMESPACE
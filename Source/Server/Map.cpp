@@ -50,6 +50,8 @@ Map::Map(ptr<ServerEngine> engine, ident_t id, ptr<const ProtoMap> proto, nptr<L
     _staticMap {static_map},
     _mapSize {GetSize()},
     _hexField {CreateHexField(_mapSize, engine->Settings->MapInstanceStaticGrid)},
+    _itemIndex {_mapSize},
+    _sightCache {_mapSize, &static_map->ShootBlocks, engine->Settings->MapSightCache},
     _mapLocation {location}
 {
     FO_STACK_TRACE_ENTRY();
@@ -435,7 +437,7 @@ void Map::AddCritterToField(ptr<Critter> cr)
     auto field = _hexField->GetCellForWriting(hex);
 
     vec_add_unique_value(field->Critters, cr);
-    RecacheHexFlags(field);
+    RecacheHexFlags(hex, field);
     SetMultihexCritter(cr, true);
 }
 
@@ -450,7 +452,7 @@ void Map::RemoveCritterFromField(ptr<Critter> cr)
     auto field = _hexField->GetCellForWriting(hex);
 
     vec_remove_unique_value(field->Critters, cr);
-    RecacheHexFlags(field);
+    RecacheHexFlags(hex, field);
     SetMultihexCritter(cr, false);
 }
 
@@ -476,7 +478,7 @@ void Map::SetMultihexCritter(ptr<Critter> cr, bool set)
                     vec_remove_unique_value(field->Critters, cr);
                 }
 
-                RecacheHexFlags(field);
+                RecacheHexFlags(hex_around, field);
             }
         }
     }
@@ -550,6 +552,7 @@ void Map::SetItem(ptr<Item> item)
 
     _itemsMap.emplace(item->GetId(), item);
     vec_add_unique_value(_items, item);
+    _itemIndex.Add(item->GetId(), item->GetHex());
     item->SetParent(this);
 
     auto hex = item->GetHex();
@@ -557,7 +560,7 @@ void Map::SetItem(ptr<Item> item)
 
     vec_add_unique_value(field->Items, item);
 
-    RecacheHexFlags(field);
+    RecacheHexFlags(hex, field);
 
     if (item->IsNonEmptyMultihexLines() || item->IsNonEmptyMultihexMesh()) {
         vector<mpos> multihex_entries;
@@ -569,7 +572,7 @@ void Map::SetItem(ptr<Item> item)
             auto multihex_field = _hexField->GetCellForWriting(multihex);
 
             if (vec_safe_add_unique_value(multihex_field->Items, item)) {
-                RecacheHexFlags(multihex_field);
+                RecacheHexFlags(multihex, multihex_field);
                 multihex_entries.emplace_back(multihex);
             }
         });
@@ -579,7 +582,7 @@ void Map::SetItem(ptr<Item> item)
                 auto multihex_field = _hexField->GetCellForWriting(multihex);
 
                 if (vec_safe_add_unique_value(multihex_field->Items, item)) {
-                    RecacheHexFlags(multihex_field);
+                    RecacheHexFlags(multihex, multihex_field);
                     multihex_entries.emplace_back(multihex);
                 }
             }
@@ -608,6 +611,7 @@ void Map::RemoveItem(ident_t item_id)
     _itemsMap.erase(it);
 
     vec_remove_unique_value(_items, item);
+    _itemIndex.Remove(item_id);
 
     auto hex = item->GetHex();
     auto field = _hexField->GetCellForWriting(hex);
@@ -627,7 +631,7 @@ void Map::RemoveItem(ident_t item_id)
         _engine->EntityMngr.MakePersistent(item, false);
     }
 
-    RecacheHexFlags(field);
+    RecacheHexFlags(hex, field);
 
     if (item->HasMultihexEntries()) {
         auto multihex_entries = item->GetMultihexEntries();
@@ -636,7 +640,7 @@ void Map::RemoveItem(ident_t item_id)
         for (auto multihex : *multihex_entries) {
             auto multihex_field = _hexField->GetCellForWriting(multihex);
             vec_remove_unique_value(multihex_field->Items, item);
-            RecacheHexFlags(multihex_field);
+            RecacheHexFlags(multihex, multihex_field);
         }
 
         item->SetMultihexEntries({});
@@ -750,10 +754,7 @@ auto Map::IsHexShootable(mpos hex) const noexcept -> bool
 
     FO_VALIDATE_ENTITY(LOCKED, NOT_DESTROYED);
 
-    const auto& field = _hexField->GetCellForReading(hex);
-    const auto& static_field = _staticMap->HexField->GetCellForReading(hex);
-
-    return !field.ShootBlocked && !static_field.ShootBlocked;
+    return _sightCache.IsShootable(hex);
 }
 
 auto Map::IsHexesMovable(mpos hex, int32_t radius) const -> bool
@@ -774,6 +775,15 @@ auto Map::IsHexesMovable(mpos hex, int32_t radius) const -> bool
     return true;
 }
 
+auto Map::GetSightSegment(mpos start_hex, mpos target_hex, float32_t angle, int32_t dist) const -> shared_ptr<const MapSightCache::Segment>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VALIDATE_ENTITY(LOCKED, NOT_DESTROYED);
+
+    return _sightCache.GetSegment(start_hex, target_hex, angle, dist);
+}
+
 auto Map::HasLivingCritter(mpos hex, nptr<const Critter> ignore_cr) const noexcept -> bool
 {
     FO_NO_STACK_TRACE_ENTRY();
@@ -971,6 +981,18 @@ auto Map::GetItemsInRadius(mpos hex, int32_t radius) -> vector<ptr<Item>>
     return items;
 }
 
+auto Map::GetItemsForView(mpos hex, int32_t radius, const unordered_set<ident_t>& visible_ids) -> vector<ptr<Item>>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VALIDATE_ENTITY(LOCKED, NOT_DESTROYED);
+
+    // Same order as GetItems(), so a view update over these behaves like one over the whole list
+    auto item_ids = _itemIndex.CollectNear(hex, radius, visible_ids);
+
+    return vec_transform(item_ids, [this](ident_t item_id) -> ptr<Item> { return _itemsMap.at(item_id); });
+}
+
 auto Map::GetTriggerItemsOnHex(mpos hex) noexcept -> vector<ptr<Item>>
 {
     FO_STACK_TRACE_ENTRY();
@@ -1017,10 +1039,10 @@ void Map::RecacheHexFlags(mpos hex)
     FO_VALIDATE_ENTITY(LOCKED, NOT_DESTROYED, NOT_DESTROYING);
     auto field = _hexField->GetCellForWriting(hex);
 
-    RecacheHexFlags(field);
+    RecacheHexFlags(hex, field);
 }
 
-void Map::RecacheHexFlags(ptr<Field> field)
+void Map::RecacheHexFlags(mpos hex, ptr<Field> field)
 {
     FO_STACK_TRACE_ENTRY();
 
@@ -1052,6 +1074,8 @@ void Map::RecacheHexFlags(ptr<Field> field)
     field->ShootBlocked = field->HasNoShootItem || (field->ManualBlock && field->ManualBlockFull);
     field->MoveBlocked = field->ShootBlocked || field->HasNoMoveItem || field->ManualBlock;
     field->MovableWithGag = field->MovableWithGag && (field->HasNoMoveItem || field->HasNoShootItem);
+
+    _sightCache.SetDynamicBlocked(hex, field->ShootBlocked);
 }
 
 void Map::SetHexManualBlock(mpos hex, bool enable, bool full)
@@ -1064,7 +1088,7 @@ void Map::SetHexManualBlock(mpos hex, bool enable, bool full)
     field->ManualBlock = enable;
     field->ManualBlockFull = full;
 
-    RecacheHexFlags(field);
+    RecacheHexFlags(hex, field);
 }
 
 auto Map::IsCritterOnHex(mpos hex, CritterFindType find_type) const -> bool
@@ -39,7 +39,9 @@
 #include "EntityProtos.h"
 #include "EntitySync.h"
 #include "Geometry.h"
+#include "MapItemIndex.h"
 #include "MapLoader.h"
+#include "MapSightCache.h"
 #include "ScriptSystem.h"
 #include "ServerEntity.h"
 #include "TwoDimensionalGrid.h"
@@ -65,7 +67,8 @@ struct StaticMap
 
     StaticMap() = delete;
     StaticMap(msize map_size, bool static_grid) :
-        HexField {CreateHexField(map_size, static_grid)}
+        HexField {CreateHexField(map_size, static_grid)},
+        ShootBlocks {map_size}
     {
         FO_STACK_TRACE_ENTRY();
     }
@@ -82,6 +85,7 @@ struct StaticMap
     }
 
     unique_ptr<TwoDimensionalGrid<Field, mpos, msize>> HexField;
+    HexBitGrid ShootBlocks; // Mirrors Field::ShootBlocked
     vector<pair<ident_t, refcount_ptr<Critter>>> CritterBillets {};
     vector<pair<ident_t, refcount_ptr<StaticItem>>> ItemBillets {};
     vector<pair<ident_t, ptr<StaticItem>>> HexItemBillets {};
@@ -109,6 +113,7 @@ class Map final : public ServerEntity, public EntityWithProto, public MapPropert
     [[nodiscard]] auto IsHexMovable(mpos hex) const noexcept -> bool;
     [[nodiscard]] auto IsHexShootable(mpos hex) const noexcept -> bool;
     [[nodiscard]] auto IsHexesMovable(mpos hex, int32_t radius) const -> bool;
+    [[nodiscard]] auto GetSightSegment(mpos start_hex, mpos target_hex, float32_t angle, int32_t dist) const -> shared_ptr<const MapSightCache::Segment>;
     [[nodiscard]] auto HasLivingCritter(mpos hex, nptr<const Critter> ignore_cr) const noexcept -> bool;
     [[nodiscard]] auto IsBlockItemOnHex(mpos hex) const noexcept -> bool;
     [[nodiscard]] auto IsTriggerItemOnHex(mpos hex) const noexcept -> bool;
@@ -119,6 +124,7 @@ class Map final : public ServerEntity, public EntityWithProto, public MapPropert
     [[nodiscard]] auto GetItems() const noexcept -> const_span<ptr<Item>>;
     [[nodiscard]] auto GetItemsOnHex(mpos hex) noexcept -> vector<ptr<Item>>;
     [[nodiscard]] auto GetItemsInRadius(mpos hex, int32_t radius) -> vector<ptr<Item>>;
+    [[nodiscard]] auto GetItemsForView(mpos hex, int32_t radius, const unordered_set<ident_t>& visible_ids) -> vector<ptr<Item>>;
     [[nodiscard]] auto GetTriggerItemsOnHex(mpos hex) noexcept -> vector<ptr<Item>>;
     [[nodiscard]] auto IsValidPlaceForItem(mpos hex, ptr<const ProtoItem> proto_item) const -> bool;
     [[nodiscard]] auto FindStartHex(mpos hex, int32_t multihex, int32_t seek_radius, bool skip_unsafe) const -> optional<mpos>;
@@ -198,7 +204,7 @@ class Map final : public ServerEntity, public EntityWithProto, public MapPropert
     static auto CreateHexField(msize map_size, bool static_grid) -> unique_ptr<TwoDimensionalGrid<Field, mpos, msize>>;
 
     void SetMultihexCritter(ptr<Critter> cr, bool set);
-    void RecacheHexFlags(ptr<Field> field);
+    void RecacheHexFlags(mpos hex, ptr<Field> field);
     auto IsMapItemContextChanged(ptr<const Item> item, ident_t map_id, mpos hex) const -> bool;
 
     ptr<const ProtoMap> _protoMap;
@@ -211,6 +217,8 @@ class Map final : public ServerEntity, public EntityWithProto, public MapPropert
     vector<ptr<Critter>> _nonPlayerCritters {};
     vector<ptr<Item>> _items {};
     unordered_map<ident_t, ptr<Item>> _itemsMap {};
+    MapItemIndex _itemIndex;
+    MapSightCache _sightCache;
     nptr<Location> _mapLocation {};
     // Declared before _spectatorPlayers so it outlives the data it guards
     shared_mutex _spectatorLock {};
@@ -0,0 +1,127 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "MapItemIndex.h"
+
+FO_BEGIN_NAMESPACE
+
+MapItemIndex::MapItemIndex(msize map_size) :
+    _mapSize {map_size},
+    _chunksWidth {(map_size.width + CHUNK_SIZE - 1) / CHUNK_SIZE},
+    _chunksHeight {(map_size.height + CHUNK_SIZE - 1) / CHUNK_SIZE}
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _chunks.resize(numeric_cast<size_t>(_chunksWidth) * numeric_cast<size_t>(_chunksHeight));
+}
+
+auto MapItemIndex::GetChunkIndex(mpos hex) const noexcept -> size_t
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    return static_cast<size_t>(static_cast<int64_t>(hex.y / CHUNK_SIZE) * _chunksWidth + hex.x / CHUNK_SIZE);
+}
+
+void MapItemIndex::Add(ident_t item_id, mpos hex)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(_mapSize.is_valid_pos(hex), "Indexed item hex is outside map bounds", item_id, hex, _mapSize);
+    FO_VERIFY_AND_THROW(!_entries.contains(item_id), "Item is already indexed", item_id);
+
+    size_t chunk = GetChunkIndex(hex);
+    uint64_t order = ++_orderCounter;
+
+    _chunks[chunk].emplace_back(ChunkEntry {.Order = order, .Id = item_id, .Hex = hex});
+    _entries.emplace(item_id, EntryLocation {.Chunk = chunk, .Order = order, .Hex = hex});
+}
+
+void MapItemIndex::Remove(ident_t item_id)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto it = _entries.find(item_id);
+    FO_VERIFY_AND_THROW(it != _entries.end(), "Item is not indexed", item_id);
+
+    auto& chunk = _chunks[it->second.Chunk];
+    auto chunk_it = std::ranges::find_if(chunk, [item_id](const ChunkEntry& entry) { return entry.Id == item_id; });
+    FO_VERIFY_AND_THROW(chunk_it != chunk.end(), "Indexed item is missing from its chunk", item_id);
+
+    // Chunk order is irrelevant, results are sorted by the stored order
+    *chunk_it = chunk.back();
+    chunk.pop_back();
+
+    _entries.erase(it);
+}
+
+auto MapItemIndex::CollectNear(mpos hex, int32_t radius, const unordered_set<ident_t>& extra_ids) const -> vector<ident_t>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    vector<ChunkEntry> found;
+
+    if (radius >= 0) {
+        // A hex within the distance never lies farther than the distance along either axis
+        int32_t from_x = std::max(hex.x - radius, 0) / CHUNK_SIZE;
+        int32_t from_y = std::max(hex.y - radius, 0) / CHUNK_SIZE;
+        int32_t to_x = std::min(hex.x + radius, _mapSize.width - 1) / CHUNK_SIZE;
+        int32_t to_y = std::min(hex.y + radius, _mapSize.height - 1) / CHUNK_SIZE;
+
+        for (int32_t cy = from_y; cy <= to_y; cy++) {
+            for (int32_t cx = from_x; cx <= to_x; cx++) {
+                const auto& chunk = _chunks[static_cast<size_t>(static_cast<int64_t>(cy) * _chunksWidth + cx)];
+
+                for (const auto& entry : chunk) {
+                    if (GeometryHelper::GetDistance(hex, entry.Hex) <= radius) {
+                        found.emplace_back(entry);
+                    }
+                }
+            }
+        }
+    }
+
+    for (const auto item_id : extra_ids) {
+        if (auto it = _entries.find(item_id); it != _entries.end()) {
+            // Items inside the radius are already collected above
+            if (radius < 0 || GeometryHelper::GetDistance(hex, it->second.Hex) > radius) {
+                found.emplace_back(ChunkEntry {.Order = it->second.Order, .Id = item_id, .Hex = it->second.Hex});
+            }
+        }
+    }
+
+    std::ranges::sort(found, [](const ChunkEntry& e1, const ChunkEntry& e2) { return e1.Order < e2.Order; });
+
+    return vec_transform(found, [](const ChunkEntry& entry) -> ident_t { return entry.Id; });
+}
+
+FO_END_NAMESPACE
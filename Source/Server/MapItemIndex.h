@@ -0,0 +1,91 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+#include "Geometry.h"
+
+FO_BEGIN_NAMESPACE
+
+// Map items bucketed by square hex chunks, so a critter's view update only visits the chunks its look area
+// overlaps instead of every item on the map. Entries remember the order items were put on the map, results come
+// back in that order and view updates notify in the same sequence a full walk over the map items would
+class MapItemIndex final
+{
+public:
+    static constexpr int32_t CHUNK_SIZE = 16;
+
+    explicit MapItemIndex(msize map_size);
+    MapItemIndex(const MapItemIndex&) = delete;
+    MapItemIndex(MapItemIndex&&) noexcept = delete;
+    auto operator=(const MapItemIndex&) = delete;
+    auto operator=(MapItemIndex&&) noexcept = delete;
+    ~MapItemIndex() = default;
+
+    [[nodiscard]] auto GetCount() const noexcept -> size_t { return _entries.size(); }
+    [[nodiscard]] auto Contains(ident_t item_id) const noexcept -> bool { return _entries.contains(item_id); }
+
+    // Items within the radius around the hex, plus every indexed item among the extra ids wherever it lies
+    [[nodiscard]] auto CollectNear(mpos hex, int32_t radius, const unordered_set<ident_t>& extra_ids) const -> vector<ident_t>;
+
+    void Add(ident_t item_id, mpos hex);
+    void Remove(ident_t item_id);
+
+private:
+    struct ChunkEntry
+    {
+        uint64_t Order {};
+        ident_t Id {};
+        mpos Hex {};
+    };
+
+    struct EntryLocation
+    {
+        size_t Chunk {};
+        uint64_t Order {};
+        mpos Hex {};
+    };
+
+    [[nodiscard]] auto GetChunkIndex(mpos hex) const noexcept -> size_t;
+
+    msize _mapSize;
+    int32_t _chunksWidth;
+    int32_t _chunksHeight;
+    vector<vector<ChunkEntry>> _chunks {};
+    unordered_map<ident_t, EntryLocation> _entries {};
+    uint64_t _orderCounter {};
+};
+
+FO_END_NAMESPACE
@@ -35,7 +35,6 @@
 #include "CritterManager.h"
 #include "EntityManager.h"
 #include "ItemManager.h"
-#include "LineTracer.h"
 #include "Player.h"
 #include "ProtoManager.h"
 #include "Server.h"
@@ -200,7 +199,7 @@ void MapManager::LoadFromResources()
                             static_map->StaticItems.emplace_back(item);
                             static_map->StaticItemsById.emplace(item_id, item);
 
-                            auto add_item_to_field = [item_ = ptr<StaticItem> {item}](ptr<StaticMap::Field> static_field) {
+                            auto add_item_to_field = [item_ = ptr<StaticItem> {item}, &static_map](mpos field_hex, ptr<StaticMap::Field> static_field) {
                                 if (!vec_exists(static_field->StaticItems, item_)) {
                                     static_field->StaticItems.reserve(static_field->StaticItems.size() + 1);
                                     static_field->StaticItems.emplace_back(item_);
@@ -216,25 +215,26 @@ void MapManager::LoadFromResources()
                                     if (!item_->GetShootThru()) {
                                         static_field->ShootBlocked = true;
                                         static_field->MoveBlocked = true;
+                                        static_map->ShootBlocks.Set(field_hex, true);
                                     }
                                 }
                             };
 
                             auto hex = item->GetHex();
                             auto static_field = static_map->HexField->GetCellForWriting(hex);
-                            add_item_to_field(static_field);
+                            add_item_to_field(hex, static_field);
 
                             if (item->IsNonEmptyMultihexLines()) {
                                 GeometryHelper::ForEachMultihexLines(item->GetMultihexLines(), hex, map_size, [&](mpos multihex) {
                                     auto multihex_field = static_map->HexField->GetCellForWriting(multihex);
-                                    add_item_to_field(multihex_field);
+                                    add_item_to_field(multihex, multihex_field);
                                 });
                             }
                             if (item->IsNonEmptyMultihexMesh()) {
                                 for (auto multihex : item->GetMultihexMesh()) {
                                     if (multihex != hex && map_size.is_valid_pos(multihex)) {
                                         auto multihex_field = static_map->HexField->GetCellForWriting(multihex);
-                                        add_item_to_field(multihex_field);
+                                        add_item_to_field(multihex, multihex_field);
                                     }
                                 }
                             }
@@ -721,10 +721,11 @@ auto MapManager::TracePath(ptr<const Map> map, mpos start_hex, mpos target_hex,
     output.IsCritterFound = false;
     output.HasLastMovable = false;
 
-    auto map_size = map->GetSize();
     int32_t dist = max_dist != 0 ? max_dist : GeometryHelper::GetDistance(start_hex, target_hex);
 
-    auto tracer = LineTracer(start_hex, target_hex, angle, map_size);
+    // The shoot-blocking walk of the line is cached per map, only the per-call checks run for each hex
+    auto segment = map->GetSightSegment(start_hex, target_hex, angle, dist);
+    const auto& segment_hexes = segment->Hexes;
     mpos next_hex = start_hex;
     mpos prev_hex = next_hex;
     bool last_passed_ok = false;
@@ -735,10 +736,14 @@ auto MapManager::TracePath(ptr<const Map> map, mpos start_hex, mpos target_hex,
             break;
         }
 
-        if (!tracer.GetNextHex(next_hex).has_value()) {
+        const auto step = numeric_cast<size_t>(i);
+
+        if (step >= segment_hexes.size()) {
             break;
         }
 
+        next_hex = segment_hexes[step];
+
         if (check_last_movable && !last_passed_ok) {
             if (map->IsHexMovable(next_hex)) {
                 output.LastMovable = next_hex;
@@ -749,7 +754,7 @@ auto MapManager::TracePath(ptr<const Map> map, mpos start_hex, mpos target_hex,
             }
         }
 
-        if (!map->IsHexShootable(next_hex)) {
+        if (segment->Blocked && step + 1 == segment_hexes.size()) {
             break;
         }
 
@@ -1206,6 +1211,8 @@ void MapManager::AddCritterToMap(ptr<Critter> cr, nptr<Map> map, mpos hex, mdir
 
         cr_group->AddMember(cr);
     }
+
+    _engine->RehomeCritterJobs(cr);
 }
 
 void MapManager::RemoveCritterFromMap(ptr<Critter> cr, nptr<Map> map)
@@ -1543,7 +1550,11 @@ void MapManager::ProcessVisibleItems(ptr<Critter> cr)
     FO_VERIFY_AND_THROW(map, "Missing map instance");
     ValidateEntityAccess(map);
 
-    for (ptr<Item> item : copy_hold_ref(map->GetItems())) {
+    // With bounded item look only items around the critter and the ones it still sees can change state
+    int32_t look_margin = _engine->Settings->ItemLookMargin;
+    auto items = look_margin >= 0 ? copy_hold_ref(map->GetItemsForView(cr->GetHex(), std::max(cr->GetLookDistance(), 0) + look_margin, cr->GetVisibleItems())) : copy_hold_ref(map->GetItems());
+
+    for (ptr<Item> item : items) {
         if (item->IsDestroyed()) {
             continue;
         }
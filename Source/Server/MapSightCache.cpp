@@ -0,0 +1,206 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "MapSightCache.h"
+#include "LineTracer.h"
+
+FO_BEGIN_NAMESPACE
+
+HexBitGrid::HexBitGrid(msize map_size) :
+    _mapSize {map_size}
+{
+    FO_STACK_TRACE_ENTRY();
+
+    _words.resize((numeric_cast<size_t>(map_size.width) * numeric_cast<size_t>(map_size.height) + 63) / 64);
+}
+
+auto HexBitGrid::Get(mpos hex) const noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    const size_t index = GetBitIndex(_mapSize, hex);
+
+    return ((_words[index / 64] >> (index % 64)) & 1) != 0;
+}
+
+auto HexBitGrid::Set(mpos hex, bool value) noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    const size_t index = GetBitIndex(_mapSize, hex);
+    const uint64_t mask = uint64_t {1} << (index % 64);
+    auto& word = _words[index / 64];
+
+    if (((word & mask) != 0) == value) {
+        return false;
+    }
+
+    word ^= mask;
+    return true;
+}
+
+MapSightCache::MapSightCache(msize map_size, ptr<const HexBitGrid> static_blocks, bool caching_enabled) :
+    _mapSize {map_size},
+    _staticBlocks {static_blocks},
+    _dynamicBlocks {map_size},
+    _cachingEnabled {caching_enabled}
+{
+    FO_STACK_TRACE_ENTRY();
+}
+
+auto MapSightCache::IsShootable(mpos hex) const noexcept -> bool
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    // Both grids share the layout, so one word of each answers for the hex
+    const size_t index = HexBitGrid::GetBitIndex(_mapSize, hex);
+    const uint64_t blocked = _staticBlocks->GetWord(index / 64) | _dynamicBlocks.GetWord(index / 64);
+
+    return ((blocked >> (index % 64)) & 1) == 0;
+}
+
+auto MapSightCache::GetCachedSegmentsCount() const -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    scoped_lock locker {_segmentsLocker};
+
+    return _segments.size();
+}
+
+auto MapSightCache::GetSegment(mpos start_hex, mpos target_hex, float32_t angle, int32_t dist) const -> shared_ptr<const Segment>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (!_cachingEnabled) {
+        return TraceSegment(start_hex, target_hex, angle, dist);
+    }
+
+    const auto pack_hex = [](mpos hex) -> uint64_t { return (uint64_t {static_cast<uint16_t>(hex.x)} << 16) | uint64_t {static_cast<uint16_t>(hex.y)}; };
+    const SegmentKey key {(pack_hex(start_hex) << 32) | pack_hex(target_hex), (uint64_t {std::bit_cast<uint32_t>(angle)} << 32) | uint64_t {static_cast<uint32_t>(dist)}};
+
+    {
+        scoped_lock locker {_segmentsLocker};
+
+        if (const auto it = _segments.find(key); it != _segments.end()) {
+            return it->second.Data;
+        }
+    }
+
+    // Trace outside the lock, concurrent readers of other segments are not held up by it
+    auto segment = TraceSegment(start_hex, target_hex, angle, dist);
+
+    scoped_lock locker {_segmentsLocker};
+
+    if (const auto it = _segments.find(key); it != _segments.end()) {
+        return it->second.Data;
+    }
+
+    // Oldest first, order entries of invalidated segments are skipped
+    while (_segments.size() >= MAX_SEGMENTS && !_segmentsOrder.empty()) {
+        const auto [old_key, old_order] = _segmentsOrder.front();
+        _segmentsOrder.pop_front();
+
+        if (const auto it = _segments.find(old_key); it != _segments.end() && it->second.Order == old_order) {
+            _segments.erase(it);
+        }
+    }
+
+    const uint64_t order = ++_orderCounter;
+    _segments.emplace(key, CachedSegment {.Data = segment, .Order = order});
+    _segmentsOrder.emplace_back(key, order);
+
+    if (_segmentsOrder.size() > MAX_SEGMENTS * 2) {
+        std::erase_if(_segmentsOrder, [this](const pair<SegmentKey, uint64_t>& entry) FO_TSA_REQUIRES(_segmentsLocker) {
+            const auto it = _segments.find(entry.first);
+            return it == _segments.end() || it->second.Order != entry.second;
+        });
+    }
+
+    return segment;
+}
+
+auto MapSightCache::TraceSegment(mpos start_hex, mpos target_hex, float32_t angle, int32_t dist) const -> shared_ptr<const Segment>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto segment = SafeAlloc::MakeShared<Segment>();
+    auto tracer = LineTracer(start_hex, target_hex, angle, _mapSize);
+    mpos hex = start_hex;
+
+    for (int32_t i = 0; i < dist; i++) {
+        if (!tracer.GetNextHex(hex).has_value()) {
+            break;
+        }
+
+        segment->Hexes.emplace_back(hex);
+
+        if (!IsShootable(hex)) {
+            segment->Blocked = true;
+            break;
+        }
+    }
+
+    return segment;
+}
+
+void MapSightCache::SetDynamicBlocked(mpos hex, bool blocked)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const bool was_shootable = IsShootable(hex);
+
+    if (!_dynamicBlocks.Set(hex, blocked) || IsShootable(hex) == was_shootable) {
+        return;
+    }
+
+    scoped_lock locker {_segmentsLocker};
+
+    // A hex that became blocked cuts the segments passing through it, a hex that opened extends the segments it ended
+    vector<SegmentKey> stale_keys;
+
+    for (const auto& [key, cached] : _segments) {
+        const auto& segment = *cached.Data;
+        const bool affected = was_shootable ? std::ranges::find(segment.Hexes, hex) != segment.Hexes.end() : segment.Blocked && segment.Hexes.back() == hex;
+
+        if (affected) {
+            stale_keys.emplace_back(key);
+        }
+    }
+
+    for (const auto& key : stale_keys) {
+        _segments.erase(key);
+    }
+}
+
+FO_END_NAMESPACE
@@ -0,0 +1,120 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+#include "Geometry.h"
+
+FO_BEGIN_NAMESPACE
+
+// One bit per hex, rows packed back to back into 64-bit words
+class HexBitGrid final
+{
+public:
+    explicit HexBitGrid(msize map_size);
+    HexBitGrid(const HexBitGrid&) = delete;
+    HexBitGrid(HexBitGrid&&) noexcept = delete;
+    auto operator=(const HexBitGrid&) = delete;
+    auto operator=(HexBitGrid&&) noexcept = delete;
+    ~HexBitGrid() = default;
+
+    [[nodiscard]] auto GetSize() const noexcept -> msize { return _mapSize; }
+    [[nodiscard]] auto GetWord(size_t index) const noexcept -> uint64_t { return _words[index]; }
+    [[nodiscard]] auto Get(mpos hex) const noexcept -> bool;
+
+    static auto GetBitIndex(msize map_size, mpos hex) noexcept -> size_t { return static_cast<size_t>(hex.y) * static_cast<size_t>(map_size.width) + static_cast<size_t>(hex.x); }
+
+    auto Set(mpos hex, bool value) noexcept -> bool;
+
+private:
+    msize _mapSize;
+    vector<uint64_t> _words {};
+};
+
+// Shoot blocking of a map instance: the static blockers shared by every instance of the static map, the blockers
+// of the instance itself (items, manual blocks), and a bounded cache of traced line segments. A segment is the hex
+// sequence a LineTracer walks until the first blocked hex or the distance limit, so repeated traces between the
+// same hexes skip both the tracer math and the per-hex field lookups. Toggling a dynamic blocker drops exactly the
+// cached segments it changes, so a cached segment always equals a fresh trace. With caching off every call traces
+// afresh over the same blocker grids
+class MapSightCache final
+{
+public:
+    static constexpr size_t MAX_SEGMENTS = 1024;
+
+    struct Segment
+    {
+        vector<mpos> Hexes {}; // Visited hexes, the blocked one last when Blocked
+        bool Blocked {};
+    };
+
+    MapSightCache(msize map_size, ptr<const HexBitGrid> static_blocks, bool caching_enabled = true);
+    MapSightCache(const MapSightCache&) = delete;
+    MapSightCache(MapSightCache&&) noexcept = delete;
+    auto operator=(const MapSightCache&) = delete;
+    auto operator=(MapSightCache&&) noexcept = delete;
+    ~MapSightCache() = default;
+
+    [[nodiscard]] auto IsShootable(mpos hex) const noexcept -> bool;
+    [[nodiscard]] auto IsDynamicBlocked(mpos hex) const noexcept -> bool { return _dynamicBlocks.Get(hex); }
+    [[nodiscard]] auto IsCachingEnabled() const noexcept -> bool { return _cachingEnabled; }
+    [[nodiscard]] auto GetSegment(mpos start_hex, mpos target_hex, float32_t angle, int32_t dist) const -> shared_ptr<const Segment>;
+    [[nodiscard]] auto GetCachedSegmentsCount() const -> size_t;
+
+    void SetDynamicBlocked(mpos hex, bool blocked);
+
+private:
+    using SegmentKey = pair<uint64_t, uint64_t>;
+
+    struct CachedSegment
+    {
+        shared_ptr<const Segment> Data {};
+        uint64_t Order {};
+    };
+
+    [[nodiscard]] auto TraceSegment(mpos start_hex, mpos target_hex, float32_t angle, int32_t dist) const -> shared_ptr<const Segment>;
+
+    msize _mapSize;
+    ptr<const HexBitGrid> _staticBlocks;
+    HexBitGrid _dynamicBlocks;
+    bool _cachingEnabled;
+    // Traces may run concurrently under shared map cover, blocker changes only happen under exclusive cover
+    mutable mutex _segmentsLocker {};
+    mutable unordered_map<SegmentKey, CachedSegment> _segments FO_TSA_GUARDED_BY(_segmentsLocker) {};
+    mutable deque<pair<SegmentKey, uint64_t>> _segmentsOrder FO_TSA_GUARDED_BY(_segmentsLocker) {};
+    mutable uint64_t _orderCounter FO_TSA_GUARDED_BY(_segmentsLocker) {};
+};
+
+FO_END_NAMESPACE
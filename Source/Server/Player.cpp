@@ -821,6 +821,19 @@ void Player::Send_UpdateFileData(const_span<uint8_t> update_data)
     }
 }
 
+void Player::Send_UpdateFileDelta(const_span<UpdateDeltaOp> delta_ops)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VALIDATE_ENTITY(NONE);
+
+    scoped_lock conn_lock {_connectionLock};
+
+    auto out_buf = _connection->WriteMsg(NetMessage::UpdateFileDelta);
+
+    WriteUpdateDeltaOps(*out_buf, delta_ops);
+}
+
 void Player::Send_ViewMap()
 {
     FO_STACK_TRACE_ENTRY();
@@ -41,6 +41,7 @@
 #include "Geometry.h"
 #include "ServerConnection.h"
 #include "ServerEntity.h"
+#include "UpdateDelta.h"
 
 FO_BEGIN_NAMESPACE
 
@@ -108,6 +109,7 @@ class Player final : public ServerEntity, public PlayerProperties
     void Send_HandshakeAnswer(bool compatibility_outdated, bool updater_outdated, bool metadata_outdated, string_view metadata_version, uint32_t out_encrypt_key);
     void Send_InitData(const_span<uint8_t> update_desc);
     void Send_UpdateFileData(const_span<uint8_t> update_data);
+    void Send_UpdateFileDelta(const_span<UpdateDeltaOp> delta_ops);
     void Send_Action(ptr<const Critter> from_cr, CritterAction action, int32_t action_data, nptr<const Item> context_item);
     void Send_MoveItem(ptr<const Critter> from_cr, nptr<const Item> moved_item, CritterAction action, CritterItemSlot prev_slot);
     void Send_ViewMap();
@@ -73,6 +73,8 @@ ServerEngine::ServerEngine(ptr<GlobalSettings> settings, FileSystem&& resources)
     WriteLog("Compatibility version: {}", Settings->CompatibilityVersion);
     WriteLog("Metadata version: {}", GetMetadataVersion());
 
+    Latency.SetEnabled(Settings->LatencyHistograms);
+
     _starter.SetExceptionHandler([this](const std::exception& ex) FO_DEFERRED {
         ignore_unused(ex);
 
@@ -117,7 +119,7 @@ void ServerEngine::RunScriptContext(const function<void()>& callback)
     callback();
 }
 
-auto ServerEngine::FireEvent(const vector<EventCallbackData>& callbacks, FuncCallData& call) noexcept -> EventResult
+auto ServerEngine::FireEvent(uint32_t event_id, const vector<EventCallbackData>& callbacks, FuncCallData& call) noexcept -> EventResult
 {
     FO_STACK_TRACE_ENTRY();
 
@@ -128,6 +130,7 @@ auto ServerEngine::FireEvent(const vector<EventCallbackData>& callbacks, FuncCal
     // Engine-wide invariant: a primary SyncContext is always active when an event fires
     FO_STRONG_ASSERT(GetCurrentSyncContext(), "Server event fired without active sync context");
 
+    LatencySample latency_sample {Latency.GetEventHistogram(event_id)};
     bool had_exception = false;
 
     // Iterate a copy - callbacks vector may be changed/invalidated during cycle work
@@ -502,14 +505,14 @@ auto ServerEngine::InitMetadataJob() -> std::optional<timespan>
             FO_VERIFY_AND_THROW(prop, "Property not found by index");
             prop->AddSetter(std::move(callback));
         };
-        auto set_post_setter = [](nptr<const PropertyRegistrar> registrar, int32_t prop_index, PropertyPostSetCallback callback) {
+        auto set_post_setter = [](nptr<const PropertyRegistrar> registrar, int32_t prop_index, PropertyPostSetCallback callback, bool leading = false) {
             FO_VERIFY_AND_THROW(registrar, "Missing property registrar");
             auto registrar_ptr = registrar;
             FO_VERIFY_AND_THROW(registrar_ptr, "Property registrar pointer is null");
 
             auto prop = registrar_ptr->GetPropertyByIndex(prop_index);
             FO_VERIFY_AND_THROW(prop, "Property not found by index");
-            prop->AddPostSetter(std::move(callback));
+            prop->AddPostSetter(std::move(callback), leading);
         };
 
         set_post_setter(GetPropertyRegistrar(CritterProperties::ENTITY_TYPE_NAME), Critter::LookDistance_RegIndex, wrap_post_setter(&ServerEngine::OnSetCritterLookDistance));
@@ -520,6 +523,8 @@ auto ServerEngine::InitMetadataJob() -> std::optional<timespan>
             OnSetItemCount(entity_ptr, prop, data.GetPtr());
         });
         set_post_setter(GetPropertyRegistrar(ItemProperties::ENTITY_TYPE_NAME), Item::Hidden_RegIndex, wrap_post_setter(&ServerEngine::OnSetItemHidden));
+        // Leading, so script post-setters of the slot already see the holder's slot lookups updated
+        set_post_setter(GetPropertyRegistrar(ItemProperties::ENTITY_TYPE_NAME), Item::CritterSlot_RegIndex, wrap_post_setter(&ServerEngine::OnSetItemCritterSlot), true);
         set_post_setter(GetPropertyRegistrar(ItemProperties::ENTITY_TYPE_NAME), Item::NoBlock_RegIndex, wrap_post_setter(&ServerEngine::OnSetItemRecacheHex));
         set_post_setter(GetPropertyRegistrar(ItemProperties::ENTITY_TYPE_NAME), Item::ShootThru_RegIndex, wrap_post_setter(&ServerEngine::OnSetItemRecacheHex));
         set_post_setter(GetPropertyRegistrar(ItemProperties::ENTITY_TYPE_NAME), Item::IsGag_RegIndex, wrap_post_setter(&ServerEngine::OnSetItemRecacheHex));
@@ -578,16 +583,16 @@ auto ServerEngine::InitGameLogicJob() -> std::optional<timespan>
 
     try {
         // Globals
-        auto globals_doc = DbStorage.Get(GameCollectionName, ident_t {1});
+        auto globals_doc = DbStorage.GetPacked(GameCollectionName, ident_t {1});
 
         if (globals_doc.Empty()) {
-            AnyData::Document doc;
-            doc.Emplace("_Name", string("Globals"));
-            DbStorage.Insert(GameCollectionName, ident_t {1}, doc);
+            AnyData::PackedDocumentBuilder builder;
+            builder.Add("_Name", AnyData::Value(string("Globals")));
+            DbStorage.Insert(GameCollectionName, ident_t {1}, builder.Finish());
             SetSynchronizedTime(synctime(std::chrono::milliseconds {1}));
         }
         else {
-            if (!PropertiesSerializer::LoadFromDocument(GetPropertiesForEdit(), globals_doc, Hashes, *this)) {
+            if (!PropertiesSerializer::LoadFromPackedDocument(GetPropertiesForEdit(), globals_doc.GetView(), Hashes, *this)) {
                 throw ServerInitException("Failed to load globals document");
             }
         }
@@ -597,7 +602,11 @@ auto ServerEngine::InitGameLogicJob() -> std::optional<timespan>
 
         // Worker pool
         int32_t worker_threads = Settings->WorkerThreads != 0 ? Settings->WorkerThreads : 0;
-        _workerPool.emplace("ServerPool", worker_threads, &_shutdownInProgress, /*start_paused*/ true);
+        _workerPool.emplace("ServerPool", worker_threads, &_shutdownInProgress, /*start_paused*/ true, &Latency);
+
+        if (Settings->MapAffinityScheduling) {
+            _workerPool->EnableAffinityScheduling(std::chrono::milliseconds {Settings->MapAffinityStealMs});
+        }
 
         TimeEventManager::DispatcherHooks hooks;
         hooks.Schedule = [this](refcount_ptr<Entity> entity, uint32_t event_id, timespan delay) { OnTimeEventSchedule(std::move(entity), event_id, delay); };
@@ -690,6 +699,11 @@ auto ServerEngine::InitDoneJob() -> std::optional<timespan>
 
     _workerPool->Resume();
 
+    // The backup thread waits for the engine lock on its own, so the game keeps running while a backup is written
+    if (!Settings->WorldBackupDir.empty()) {
+        _worldBackupWriter.AddJob(std::chrono::milliseconds {Settings->WorldBackupPeriodMs}, [this]() FO_DEFERRED { return WorldBackupJob(); });
+    }
+
     // Set started flag AFTER workerPool is resumed and mainWorker has jobs queued so
     // external observers (tests, network OnNewConnection) only see a fully-running server
     _started = true;
@@ -855,9 +869,16 @@ void ServerEngine::OnPlayerLoggedIn(ptr<Player> player, nptr<Player> not_logged_
 
     auto key = WorkerJobKey {.Type = WorkerJobType::Player, .Id = static_cast<size_t>(player->GetId().underlying_value())};
 
+    // OnPlayerLogin may already have attached a critter, whose map then homes the player job from the start
+    size_t affinity = WorkerPool::NO_AFFINITY;
+
+    if (auto cr = player->GetControlledCritter(); cr && IsEntityAccessValid(cr, false)) {
+        affinity = GetCritterJobAffinity(cr.as_ptr());
+    }
+
     player->GetConnection()->SetDataArrivedCallback([this, key]() { _workerPool->Wake(key); });
 
-    _workerPool->Submit(key, [this, player_ = player.hold_ref()]() mutable -> std::optional<timespan> { return PlayerJob(player_); });
+    _workerPool->Submit(key, timespan::zero, [this, player_ = player.hold_ref()]() mutable -> std::optional<timespan> { return PlayerJob(player_); }, affinity);
 }
 
 auto ServerEngine::PlayerJob(ptr<Player> player) -> std::optional<timespan>
@@ -1028,6 +1049,8 @@ void ServerEngine::Shutdown()
     _willFinishDispatcher();
     WriteLog("Shutdown stage: starter.Clear");
     _starter.Clear();
+    WriteLog("Shutdown stage: worldBackupWriter.Clear");
+    _worldBackupWriter.Clear();
 
     // Network IO joins before the worker pool is torn down, because its callbacks reach the pool and would
     // otherwise dereference freed storage
@@ -1252,6 +1275,159 @@ void ServerEngine::SyncWholeWorld(SyncContext& ctx, span<const refcount_ptr<Play
     ctx.SyncEntities(sync_entities);
 }
 
+ServerWorldSnapshot::~ServerWorldSnapshot()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    for (const auto& entry : Entries) {
+        if (entry.Slot) {
+            entry.Slot->Release();
+        }
+    }
+}
+
+auto ServerEngine::TakeWorldSnapshot(optional<timespan> max_wait_time) -> optional<ServerWorldSnapshot>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const nanotime lock_start = nanotime::now();
+
+    if (!Lock(max_wait_time)) {
+        return std::nullopt;
+    }
+
+    ServerWorldSnapshot snapshot;
+    snapshot.LockWaitTime = nanotime::now() - lock_start;
+
+    {
+        auto unlocker = scope_exit([this]() noexcept { safe_call([this] { Unlock(); }); });
+
+        // Nothing is copied while the world is stopped, every persistent record only gets a slot that preserves its
+        // data on the first change, so the pause stays a pointer walk over the entity registry
+        vector<refcount_ptr<ServerEntity>> entities = EntityMngr.GetEntities();
+        snapshot.Entries.reserve(entities.size() + 1);
+
+        const auto add_entry = [&snapshot](hstring collection_name, ident_t id, nptr<const ProtoEntity> proto, refcount_nptr<ServerEntity> holder, ptr<Properties> props) {
+            auto slot = SafeAlloc::MakeShared<PropertiesSnapshotSlot>();
+            props->AttachSnapshotSlot(slot);
+            snapshot.Entries.emplace_back(ServerWorldSnapshot::Entry {.CollectionName = collection_name, .Id = id, .Proto = proto, .Holder = std::move(holder), .Props = props, .Slot = std::move(slot)});
+        };
+
+        add_entry(GameCollectionName, ident_t {1}, nullptr, nullptr, GetPropertiesForEdit());
+
+        for (auto& entity : entities) {
+            if (!entity->IsPersistent()) {
+                continue;
+            }
+
+            nptr<const ProtoEntity> proto;
+
+            if (auto entity_with_proto = entity.as_ptr().dyn_cast<EntityWithProto>()) {
+                proto = entity_with_proto->GetProto();
+            }
+
+            add_entry(entity->GetTypeNamePlural(), entity->GetId(), proto, entity, entity->GetPropertiesForEdit());
+        }
+    }
+
+    snapshot.PauseTime = nanotime::now() - lock_start;
+
+    return snapshot;
+}
+
+auto ServerEngine::SerializeWorldSnapshot(ServerWorldSnapshot snapshot) -> vector<ServerWorldSnapshot::Record>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Needs no engine lock and runs alongside gameplay; a writer touching an entity that is being read here waits
+    // for that one entity only
+    vector<ServerWorldSnapshot::Record> records;
+    records.reserve(snapshot.Entries.size());
+
+    for (const auto& entry : snapshot.Entries) {
+        auto builder = entry.Slot->Read(*entry.Props, [this, &entry](const Properties& props) {
+            AnyData::PackedDocumentBuilder props_builder;
+            EntityMngr.StoreEntityDoc(&props, entry.Proto, props_builder);
+            return props_builder;
+        });
+
+        if (!entry.Holder) {
+            builder.Add("_Name", AnyData::Value(string("Globals")));
+        }
+
+        auto doc = builder.Finish();
+        records.emplace_back(ServerWorldSnapshot::Record {.CollectionName = entry.CollectionName, .Id = entry.Id, .Doc = std::move(doc)});
+    }
+
+    return records;
+}
+
+auto ServerEngine::BackupWorld(string_view backup_dir, optional<timespan> max_wait_time) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto snapshot = TakeWorldSnapshot(max_wait_time);
+
+    if (!snapshot.has_value()) {
+        WriteLog(LogType::Warning, "World backup skipped, engine lock is not acquired in time");
+        return false;
+    }
+
+    const timespan lock_wait_time = snapshot->LockWaitTime;
+    const timespan pause_time = snapshot->PauseTime;
+    const nanotime serialize_start = nanotime::now();
+    const auto records = SerializeWorldSnapshot(std::move(snapshot.value()));
+    const timespan serialize_time = nanotime::now() - serialize_start;
+
+    // Same layout as the JSON storage, so a backup directory can be opened as DbStorage directly; it is written
+    // aside and swapped in whole, so an interrupted backup never leaves a mix of two world states
+    const string tmp_dir = strex("{}.tmp", backup_dir).str();
+    const string old_dir = strex("{}.old", backup_dir).str();
+
+    fs_remove_dir_tree(tmp_dir);
+
+    for (const auto& record : records) {
+        const string record_dir = strex("{}/{}", tmp_dir, record.CollectionName).str();
+        const string record_path = strex("{}/{}.json", record_dir, record.Id).str();
+
+        if (!fs_create_directories(record_dir) || !fs_write_file(record_path, PackedDocumentToJsonStorage(record.Doc.GetView(), Settings->JsonIndent))) {
+            WriteLog(LogType::Warning, "Can't write world backup file '{}'", record_path);
+            fs_remove_dir_tree(tmp_dir);
+            return false;
+        }
+    }
+
+    fs_remove_dir_tree(old_dir);
+
+    if (fs_exists(backup_dir) && !fs_rename(backup_dir, old_dir)) {
+        WriteLog(LogType::Warning, "Can't move previous world backup '{}' aside", backup_dir);
+        fs_remove_dir_tree(tmp_dir);
+        return false;
+    }
+
+    if (!fs_rename(tmp_dir, backup_dir)) {
+        WriteLog(LogType::Warning, "Can't commit world backup '{}'", backup_dir);
+        fs_rename(old_dir, backup_dir);
+        fs_remove_dir_tree(tmp_dir);
+        return false;
+    }
+
+    fs_remove_dir_tree(old_dir);
+
+    WriteLog("World backup '{}' done, records {}, pause {} (lock wait {}), serialization {}", backup_dir, records.size(), pause_time, lock_wait_time, serialize_time);
+
+    return true;
+}
+
+auto ServerEngine::WorldBackupJob() -> std::optional<timespan>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    BackupWorld(Settings->WorldBackupDir, std::chrono::milliseconds {Settings->LockMaxWaitTime});
+
+    return std::chrono::milliseconds {Settings->WorldBackupPeriodMs};
+}
+
 void ServerEngine::Unlock()
 {
     FO_STACK_TRACE_ENTRY();
@@ -1437,6 +1613,7 @@ void ServerEngine::DrawGui()
         WorkThread::Diagnostics health_writer_diagnostics = _healthWriter.GetDiagnostics();
         bool has_worker_pool = !!_workerPool;
         WorkerPool::Diagnostics worker_pool_diagnostics = has_worker_pool ? _workerPool->GetDiagnostics() : WorkerPool::Diagnostics {};
+        SyncContentionStats contention = GetSyncContentionStats();
 
         if (begin_info_table("##PerformanceDetailsTable")) {
             info_row("Jobs per second", strex("{}", _stats.JobsPerSecond).str());
@@ -1459,6 +1636,14 @@ void ServerEngine::DrawGui()
             info_row("Worker pool queued keys", has_worker_pool ? strex("{}", worker_pool_diagnostics.QueuedKeys).str() : string("n/a"));
             info_row("Worker pool active workers", has_worker_pool ? strex("{}", worker_pool_diagnostics.ActiveWorkers).str() : string("n/a"));
             info_row("Worker pool paused", has_worker_pool ? strex("{}", worker_pool_diagnostics.Paused).str() : string("n/a"));
+            info_row("Worker pool map affinity", has_worker_pool ? strex("{}", worker_pool_diagnostics.AffinityScheduling).str() : string("n/a"));
+            info_row("Worker pool affinity keys", has_worker_pool ? strex("{}", worker_pool_diagnostics.AffinityKeys).str() : string("n/a"));
+            info_row("Worker pool stolen jobs", has_worker_pool ? strex("{}", worker_pool_diagnostics.StolenJobs).str() : string("n/a"));
+            info_row("Entity lock sync retries", strex("{}", contention.SyncRetries).str());
+            info_row("Entity lock ensure retries", strex("{}", contention.EnsureRetries).str());
+            info_row("Entity lock spin rollbacks", strex("{}", contention.SpinRollbacks).str());
+            info_row("Entity lock fair fallbacks", strex("{}", contention.FairFallbacks).str());
+            info_row("Entity lock parked waits", strex("{}", contention.ParkedWaits).str());
             info_row("CPU system load", _stats.CpuUsageAvailable ? strex("{:.1f}%", numeric_cast<float64_t>(_stats.CpuSystemLoad)).str() : string("n/a"));
             info_row("CPU process load", _stats.CpuUsageAvailable ? strex("{:.1f}%", numeric_cast<float64_t>(_stats.CpuProcessLoad)).str() : string("n/a"));
             info_row("CPU process core load", _stats.CpuUsageAvailable ? strex("{:.1f}%", numeric_cast<float64_t>(_stats.CpuProcessCoreLoad)).str() : string("n/a"));
@@ -1488,6 +1673,48 @@ void ServerEngine::DrawGui()
         }
     }
 
+    if (ImGui::CollapsingHeader("Hot-path latency")) {
+        bool latency_enabled = Latency.IsEnabled();
+
+        if (ImGui::Checkbox("Collect latency histograms", &latency_enabled)) {
+            Latency.SetEnabled(latency_enabled);
+        }
+
+        ImGui::SameLine();
+
+        if (ImGui::Button("Reset")) {
+            Latency.Reset();
+        }
+
+        if (ImGui::BeginTable("##LatencyTable", 6, table_flags)) {
+            ImGui::TableSetupColumn("Group", ImGuiTableColumnFlags_WidthFixed, 90.0f);
+            ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Count (60s)", ImGuiTableColumnFlags_WidthFixed, 90.0f);
+            ImGui::TableSetupColumn("p50", ImGuiTableColumnFlags_WidthFixed, 90.0f);
+            ImGui::TableSetupColumn("p99", ImGuiTableColumnFlags_WidthFixed, 90.0f);
+            ImGui::TableSetupColumn("Max", ImGuiTableColumnFlags_WidthFixed, 90.0f);
+            ImGui::TableHeadersRow();
+
+            for (const auto& entry : Latency.GetEntries(nanotime::now())) {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGuiTextUnformatted(entry.Group);
+                ImGui::TableSetColumnIndex(1);
+                ImGuiTextUnformatted(entry.Name);
+                ImGui::TableSetColumnIndex(2);
+                ImGuiTextUnformatted(strex("{}", entry.Summary.Count).str());
+                ImGui::TableSetColumnIndex(3);
+                ImGuiTextUnformatted(strex("{}", entry.Summary.P50).str());
+                ImGui::TableSetColumnIndex(4);
+                ImGuiTextUnformatted(strex("{}", entry.Summary.P99).str());
+                ImGui::TableSetColumnIndex(5);
+                ImGuiTextUnformatted(strex("{}", entry.Summary.Max).str());
+            }
+
+            ImGui::EndTable();
+        }
+    }
+
     auto cond_to_str = [](CritterCondition cond) -> string_view {
         switch (cond) {
         case CritterCondition::Alive:
@@ -1811,6 +2038,13 @@ auto ServerEngine::GetHealthInfo() const -> string
     buf += strex("Rejected by rate: {}\n", _stats.RejectedByRate);
     buf += strex("CPU load: {}\n", _stats.CpuUsageAvailable ? strex("system {:.1f}%, process {:.1f}%", numeric_cast<float64_t>(_stats.CpuSystemLoad), numeric_cast<float64_t>(_stats.CpuProcessLoad)).str() : string("n/a"));
     buf += strex("DB requests per minute: {}\n", DbStorage.GetDbRequestsPerMinute());
+    SyncContentionStats contention = GetSyncContentionStats();
+    buf += strex("Entity lock contention: sync retries {}, ensure retries {}, spin rollbacks {}, fair fallbacks {}, parked waits {}\n", contention.SyncRetries, contention.EnsureRetries, contention.SpinRollbacks, contention.FairFallbacks, contention.ParkedWaits);
+    buf += strex("Latency histograms: {}\n", Latency.IsEnabled() ? "enabled" : "disabled");
+
+    for (const auto& entry : Latency.GetEntries(nanotime::now())) {
+        buf += strex("Latency {} {}: count {}, p50 {}, p99 {}, max {}\n", entry.Group, entry.Name, entry.Summary.Count, entry.Summary.P50, entry.Summary.P99, entry.Summary.Max);
+    }
 
     return buf;
 }
@@ -1969,41 +2203,57 @@ void ServerEngine::ProcessNotLoggedInPlayer(ptr<Player> not_logged_in_player)
 
         in_buf.Unlock();
 
-        if (!connection->IsHandshakeComplete()) {
-            if (msg == NetMessage::Handshake) {
-                Process_Handshake(not_logged_in_player);
+        {
+            LatencySample latency_sample {Latency.GetNetMessageHistogram(msg)};
+
+            if (!connection->IsHandshakeComplete()) {
+                if (msg == NetMessage::Handshake) {
+                    Process_Handshake(not_logged_in_player);
+                }
+                else {
+                    throw GenericException("Expected handshake message", msg);
+                }
             }
             else {
-                throw GenericException("Expected handshake message", msg);
-            }
-        }
-        else {
-            switch (msg) {
-            case NetMessage::Ping:
-                Process_Ping(not_logged_in_player);
-                not_logged_in_player->Send_TimeSync();
-                break;
-            case NetMessage::GetUpdateFile: {
-                if (!_updaterBackend) {
-                    WriteLog(LogType::Warning, "Wrong update file request, updater backend disabled, client host '{}'", connection->GetHost());
-                    connection->HardDisconnect(DisconnectReason::UpdaterError);
+                switch (msg) {
+                case NetMessage::Ping:
+                    Process_Ping(not_logged_in_player);
+                    not_logged_in_player->Send_TimeSync();
+                    break;
+                case NetMessage::GetUpdateFile: {
+                    if (!_updaterBackend) {
+                        WriteLog(LogType::Warning, "Wrong update file request, updater backend disabled, client host '{}'", connection->GetHost());
+                        connection->HardDisconnect(DisconnectReason::UpdaterError);
+                        break;
+                    }
+
+                    auto updater_backend = make_ptr(&*_updaterBackend);
+                    updater_backend->ProcessUpdateFile(not_logged_in_player, Settings->UpdateFileMaxPortionSize);
+                    connection->RegisterLoginProgress(GameTime.GetFrameTime());
                     break;
                 }
+                case NetMessage::GetUpdateFileDelta: {
+                    if (!_updaterBackend) {
+                        WriteLog(LogType::Warning, "Wrong update file delta request, updater backend disabled, client host '{}'", connection->GetHost());
+                        connection->HardDisconnect(DisconnectReason::UpdaterError);
+                        break;
+                    }
 
-                auto updater_backend = make_ptr(&*_updaterBackend);
-                updater_backend->ProcessUpdateFile(not_logged_in_player, Settings->UpdateFileMaxPortionSize);
-                connection->RegisterLoginProgress(GameTime.GetFrameTime());
-                break;
-            }
-            case NetMessage::RemoteCall:
-                Process_RemoteCall(not_logged_in_player);
-                connection->RegisterLoginProgress(GameTime.GetFrameTime());
-                break;
-            case NetMessage::UnresolvedHash:
-                Process_UnresolvedHash(connection);
-                break;
-            default:
-                throw GenericException("Unexpected not-logged-in player message", msg);
+                    auto updater_backend = make_ptr(&*_updaterBackend);
+                    updater_backend->ProcessUpdateFileDelta(not_logged_in_player);
+                    connection->RegisterLoginProgress(GameTime.GetFrameTime());
+                    break;
+                }
+                case NetMessage::RemoteCall:
+                    Process_RemoteCall(not_logged_in_player);
+                    connection->RegisterLoginProgress(GameTime.GetFrameTime());
+                    break;
+                case NetMessage::UnresolvedHash:
+                    Process_UnresolvedHash(connection);
+                    break;
+                default:
+                    throw GenericException("Unexpected not-logged-in player message", msg);
+                }
             }
         }
 
@@ -2064,32 +2314,36 @@ void ServerEngine::ProcessPlayer(ptr<Player> player)
 
         in_buf.Unlock();
 
-        switch (msg) {
-        case NetMessage::Ping:
-            Process_Ping(player);
-            player->Send_TimeSync();
-            break;
+        {
+            LatencySample latency_sample {Latency.GetNetMessageHistogram(msg)};
 
-        case NetMessage::SendCritterDir:
-            Process_Dir(player);
-            break;
-        case NetMessage::SendCritterMove:
-            Process_Move(player);
-            break;
-        case NetMessage::SendStopCritterMove:
-            Process_StopMove(player);
-            break;
-        case NetMessage::RemoteCall:
-            Process_RemoteCall(player);
-            break;
-        case NetMessage::SendProperty:
-            Process_Property(player);
-            break;
-        case NetMessage::UnresolvedHash:
-            Process_UnresolvedHash(connection);
-            break;
-        default:
-            throw GenericException("Unexpected player message", msg);
+            switch (msg) {
+            case NetMessage::Ping:
+                Process_Ping(player);
+                player->Send_TimeSync();
+                break;
+
+            case NetMessage::SendCritterDir:
+                Process_Dir(player);
+                break;
+            case NetMessage::SendCritterMove:
+                Process_Move(player);
+                break;
+            case NetMessage::SendStopCritterMove:
+                Process_StopMove(player);
+                break;
+            case NetMessage::RemoteCall:
+                Process_RemoteCall(player);
+                break;
+            case NetMessage::SendProperty:
+                Process_Property(player);
+                break;
+            case NetMessage::UnresolvedHash:
+                Process_UnresolvedHash(connection);
+                break;
+            default:
+                throw GenericException("Unexpected player message", msg);
+            }
         }
 
         in_buf.Lock();
@@ -2413,6 +2667,7 @@ void ServerEngine::SwitchPlayerCritter(ptr<Player> player, nptr<Critter> cr)
 
     SyncContext::RetainEntityPairInCurrentChain(player, cr);
     cr->AttachPlayer(player);
+    RehomeCritterJobs(cr);
 
     SendCritterInitialInfo(cr, prev_cr);
 
@@ -2871,8 +3126,9 @@ auto ServerEngine::LoginPlayerToNewRecord(ptr<Player> not_logged_in_player) -> p
     EntityMngr.RegisterPlayer(player, ident_t {});
     registered_player = true;
 
-    auto player_doc = PropertiesSerializer::SaveToDocument(player->GetProperties(), nullptr, Hashes, *this);
-    DbStorage.Insert(PlayersCollectionName, player->GetId(), player_doc);
+    AnyData::PackedDocumentBuilder player_doc;
+    PropertiesSerializer::SaveToPackedDocument(player->GetProperties(), nullptr, player_doc, Hashes, *this);
+    DbStorage.Insert(PlayersCollectionName, player->GetId(), player_doc.Finish());
     inserted_player_record = true;
 
     player->SetLoggedIn(true);
@@ -2949,12 +3205,12 @@ auto ServerEngine::LoginPlayerToExistentRecord(ptr<Player> not_logged_in_player,
         player = not_logged_in_player;
         FO_VERIFY_AND_THROW(player, "Player must resolve to the not-logged-in player when the stored record is absent");
 
-        auto player_doc = DbStorage.Get(PlayersCollectionName, player_id);
+        auto player_doc = DbStorage.GetPacked(PlayersCollectionName, player_id);
 
         if (player_doc.Empty()) {
             throw GenericException("Player data not found");
         }
-        if (!PropertiesSerializer::LoadFromDocument(player->GetPropertiesForEdit(), player_doc, Hashes, *this)) {
+        if (!PropertiesSerializer::LoadFromPackedDocument(player->GetPropertiesForEdit(), player_doc.GetView(), Hashes, *this)) {
             throw GenericException("Invalid player data");
         }
 
@@ -3930,6 +4186,23 @@ void ServerEngine::OnSetItemHidden(ptr<Entity> entity, ptr<const Property> prop)
     }
 }
 
+void ServerEngine::OnSetItemCritterSlot(ptr<Entity> entity, ptr<const Property> prop)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    ignore_unused(prop);
+
+    // Keeps the holder's slot index current; items outside of an inventory have no index to update
+    auto item = entity.dyn_cast<Item>();
+    FO_VERIFY_AND_THROW(item, "Missing item instance");
+
+    if (item->GetOwnership() == ItemOwnership::CritterInventory) {
+        if (auto cr = item->GetParent<Critter>()) {
+            cr->ReindexItemSlot(item);
+        }
+    }
+}
+
 void ServerEngine::OnSetItemRecacheHex(ptr<Entity> entity, ptr<const Property> prop)
 {
     FO_STACK_TRACE_ENTRY();
@@ -4387,7 +4660,7 @@ void ServerEngine::StartCritterMoving(ptr<Critter> cr, refcount_ptr<MovingContex
     moving_context->ValidateRuntimeState();
     cr->SetMovingSpeed(moving_context->GetSpeed());
 
-    _workerPool->Submit(movement_key, [this, cr_ = cr.hold_ref()]() mutable -> std::optional<timespan> { return CritterMovingJob(cr_); });
+    _workerPool->Submit(movement_key, timespan::zero, [this, cr_ = cr.hold_ref()]() mutable -> std::optional<timespan> { return CritterMovingJob(cr_); }, GetCritterJobAffinity(cr));
 
     cr->SendAndBroadcast(initiator, [cr](ptr<Player> p) { p->Send_Moving(cr); });
 
@@ -4460,6 +4733,40 @@ void ServerEngine::StartCritterMoving(ptr<Critter> cr, uint16_t speed, const vec
     StartCritterMoving(cr, SafeAlloc::MakeRefCounted<MovingContext>(map->GetSize(), speed, steps, control_steps, GameTime.GetFrameTime(), timespan {}, start_hex, cr->GetHexOffset(), end_hex_offset), initiator);
 }
 
+auto ServerEngine::GetCritterJobAffinity(ptr<const Critter> cr) const -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (!Settings->MapAffinityScheduling) {
+        return WorkerPool::NO_AFFINITY;
+    }
+
+    // Global-map critters have no shared hot lock to keep together, so any worker may run their jobs
+    ident_t map_id = cr->GetMapId();
+    return map_id ? static_cast<size_t>(map_id.underlying_value()) : WorkerPool::NO_AFFINITY;
+}
+
+void ServerEngine::RehomeCritterJobs(ptr<Critter> cr)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // Second phase of a map handoff: the transfer itself already ran under both maps' cover, this only moves
+    // the critter's jobs to the new map's worker from their next run on (an in-flight run finishes where it is)
+    if (!Settings->MapAffinityScheduling || !_workerPool) {
+        return;
+    }
+
+    size_t affinity = GetCritterJobAffinity(cr);
+
+    auto movement_key = WorkerJobKey {.Type = WorkerJobType::CritterMovement, .Id = static_cast<size_t>(cr->GetId().underlying_value())};
+    _workerPool->SetKeyAffinity(movement_key, affinity);
+
+    if (auto player = cr->GetPlayer(); player) {
+        auto player_key = WorkerJobKey {.Type = WorkerJobType::Player, .Id = static_cast<size_t>(player->GetId().underlying_value())};
+        _workerPool->SetKeyAffinity(player_key, affinity);
+    }
+}
+
 void ServerEngine::StopCritterMoving(ptr<Critter> cr, MovingState reason, function<void()> customSend)
 {
     FO_STACK_TRACE_ENTRY();
@@ -44,6 +44,7 @@
 #include "ImGuiStuff.h"
 #include "Item.h"
 #include "ItemManager.h"
+#include "LatencyStats.h"
 #include "Location.h"
 #include "Map.h"
 #include "MapManager.h"
@@ -62,6 +63,41 @@ FO_DECLARE_EXCEPTION(ServerInitException);
 
 auto GetServerResources(GlobalSettings& settings) -> FileSystem;
 
+// Copy-on-write view of the persistent world: taking it only attaches a snapshot slot to the properties of every
+// persistent entity and the game globals during a short engine lock. The first data change of an entity afterwards
+// preserves its snapshot-time data, everything else is serialized in place while the world keeps running.
+// Dropping the snapshot releases the slots; it must not outlive the engine
+struct ServerWorldSnapshot
+{
+    struct Entry
+    {
+        hstring CollectionName {};
+        ident_t Id {};
+        nptr<const ProtoEntity> Proto {};
+        refcount_nptr<ServerEntity> Holder {}; // Empty for the game globals
+        nptr<const Properties> Props {};
+        shared_ptr<PropertiesSnapshotSlot> Slot {};
+    };
+
+    struct Record
+    {
+        hstring CollectionName {};
+        ident_t Id {};
+        AnyData::PackedDocument Doc {};
+    };
+
+    ServerWorldSnapshot() = default;
+    ServerWorldSnapshot(const ServerWorldSnapshot&) = delete;
+    ServerWorldSnapshot(ServerWorldSnapshot&&) noexcept = default;
+    auto operator=(const ServerWorldSnapshot&) = delete;
+    auto operator=(ServerWorldSnapshot&&) noexcept -> ServerWorldSnapshot& = default;
+    ~ServerWorldSnapshot();
+
+    vector<Entry> Entries {};
+    timespan LockWaitTime {}; // Part of the pause spent until every job parked at the sync point
+    timespan PauseTime {}; // Whole stop-the-world time, lock acquisition included
+};
+
 class ServerEngine final : public BaseEngine, public EntityManagerApi
 {
     friend class ServerScriptSystem;
@@ -117,6 +153,10 @@ class ServerEngine final : public BaseEngine, public EntityManagerApi
     void Unlock();
     void DrawGui();
 
+    auto TakeWorldSnapshot(optional<timespan> max_wait_time) -> optional<ServerWorldSnapshot>;
+    auto SerializeWorldSnapshot(ServerWorldSnapshot snapshot) -> vector<ServerWorldSnapshot::Record>;
+    auto BackupWorld(string_view backup_dir, optional<timespan> max_wait_time) -> bool;
+
     auto CreateNotLoggedInPlayer(shared_ptr<NetworkServerConnection> net_connection) -> ptr<Player>;
     auto LoginPlayerToNewRecord(ptr<Player> not_logged_in_player) -> ptr<Player>;
     auto LoginPlayerToExistentRecord(ptr<Player> not_logged_in_player, ident_t player_id) -> ptr<Player>;
@@ -133,6 +173,7 @@ class ServerEngine final : public BaseEngine, public EntityManagerApi
     void StartCritterMoving(ptr<Critter> cr, uint16_t speed, const vector<mdir>& steps, const vector<uint16_t>& control_steps, ipos16 end_hex_offset, nptr<const Player> initiator);
     void StopCritterMoving(ptr<Critter> cr, MovingState reason = MovingState::Stopped, function<void()> customSend = nullptr);
     void ChangeCritterMovingSpeed(ptr<Critter> cr, uint16_t speed);
+    void RehomeCritterJobs(ptr<Critter> cr);
 
     ///@ ExportEvent
     FO_ENTITY_EVENT(OnInit);
@@ -209,6 +250,7 @@ class ServerEngine final : public BaseEngine, public EntityManagerApi
     ItemManager ItemMngr;
 
     DataBase DbStorage {};
+    LatencyStats Latency {};
     const hstring GameCollectionName = Hashes.ToHashedString("Game");
     const hstring HistoryCollectionName = Hashes.ToHashedString("History");
     const hstring PlayersCollectionName = Hashes.ToHashedString("Players");
@@ -269,7 +311,8 @@ class ServerEngine final : public BaseEngine, public EntityManagerApi
     void SendAllReportedHashes(ptr<Player> player);
     void BroadcastReportedString(string_view reported_string);
 
-    auto FireEvent(const vector<EventCallbackData>& callbacks, FuncCallData& call) noexcept -> EventResult override;
+    auto FireEvent(uint32_t event_id, const vector<EventCallbackData>& callbacks, FuncCallData& call) noexcept -> EventResult override;
+    [[nodiscard]] auto GetCritterJobAffinity(ptr<const Critter> cr) const -> size_t;
 
     void Process_Handshake(ptr<Player> player);
     void Process_Ping(ptr<Player> player);
@@ -294,6 +337,7 @@ class ServerEngine final : public BaseEngine, public EntityManagerApi
     void OnSetCritterLookDistance(ptr<Entity> entity, ptr<const Property> prop);
     void OnSetItemCount(ptr<Entity> entity, ptr<const Property> prop, ptr<const void> new_value);
     void OnSetItemHidden(ptr<Entity> entity, ptr<const Property> prop);
+    void OnSetItemCritterSlot(ptr<Entity> entity, ptr<const Property> prop);
     void OnSetItemRecacheHex(ptr<Entity> entity, ptr<const Property> prop);
     void OnSetItemMultihexLines(ptr<Entity> entity, ptr<const Property> prop);
 
@@ -306,6 +350,7 @@ class ServerEngine final : public BaseEngine, public EntityManagerApi
     auto InitHealthFileJob() -> std::optional<timespan>;
     auto HealthFileJob() -> std::optional<timespan>;
     auto HealthFileWriteJob(const string& health_info) -> std::optional<timespan>;
+    auto WorldBackupJob() -> std::optional<timespan>;
     auto WriteHealthFile(string_view text) -> bool;
     auto InitScriptSystemJob() -> std::optional<timespan>;
     auto InitNetworkingJob() -> std::optional<timespan>;
@@ -337,6 +382,7 @@ class ServerEngine final : public BaseEngine, public EntityManagerApi
     WorkThread _mainWorker {"ServerWorker"};
     WorkThread _healthWriter {"ServerHealthWriter"};
     string _healthFileName {};
+    WorkThread _worldBackupWriter {"ServerWorldBackup"};
     optional<WorkerPool> _workerPool {};
     std::atomic<uint64_t> _completedServerStatsJobs {};
 
@@ -233,7 +233,7 @@ void ServerEntity::SetParent(nptr<ServerEntity> parent) noexcept
     }
 }
 
-auto ServerEntity::FireEvent(const vector<EventCallbackData>& callbacks, FuncCallData& call) noexcept -> EventResult
+auto ServerEntity::FireEvent(uint32_t event_id, const vector<EventCallbackData>& callbacks, FuncCallData& call) noexcept -> EventResult
 {
     FO_STACK_TRACE_ENTRY();
 
@@ -246,6 +246,7 @@ auto ServerEntity::FireEvent(const vector<EventCallbackData>& callbacks, FuncCal
     // Engine-wide invariant: a primary SyncContext is always active when an event fires
     FO_STRONG_ASSERT(SyncContext::GetCurrentOnThisThread(), "Server entity event fired without active sync context");
 
+    LatencySample latency_sample {_engine->Latency.GetEventHistogram(event_id)};
     bool had_exception = false;
 
     // Iterate a copy — callbacks vector may be changed/invalidated during cycle work
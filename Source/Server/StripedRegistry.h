@@ -0,0 +1,90 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+FO_BEGIN_NAMESPACE
+
+// Registry state split into independently locked shards picked by entity id, so creations, destructions and lookups
+// of unrelated ids contend on different locks. Ids are handed out sequentially and the shard maps hash them again
+// with their own function, so the shard index takes the top bits of a multiplicative mix instead of the low id bits.
+// Global walks visit the shards one by one and see each of them consistently, but not the whole registry at once.
+// Each shard takes a cache line of its own, so writers on neighbouring locks don't invalidate each other's line
+template<typename T, size_t ShardCount>
+class StripedRegistry final
+{
+    static_assert(std::has_single_bit(ShardCount), "Shard count must be a power of two");
+
+public:
+    // Fixed instead of std::hardware_destructive_interference_size, which is ABI-unstable and warns on GCC
+    static constexpr size_t SHARD_ALIGNMENT = 64;
+
+    struct alignas(SHARD_ALIGNMENT) Shard
+    {
+        mutable shared_mutex Lock {};
+        T Data FO_TSA_GUARDED_BY(Lock) {};
+    };
+
+    static constexpr size_t SHARD_COUNT = ShardCount;
+
+    StripedRegistry() = default;
+    StripedRegistry(const StripedRegistry&) = delete;
+    StripedRegistry(StripedRegistry&&) noexcept = delete;
+    auto operator=(const StripedRegistry&) = delete;
+    auto operator=(StripedRegistry&&) noexcept = delete;
+    ~StripedRegistry() = default;
+
+    [[nodiscard]] static constexpr auto GetShardIndex(ident_t id) noexcept -> size_t
+    {
+        constexpr int32_t shard_bits = std::bit_width(ShardCount - 1);
+
+        if constexpr (shard_bits == 0) {
+            return 0;
+        }
+        else {
+            return static_cast<size_t>((static_cast<uint64_t>(id.underlying_value()) * 0x9E3779B97F4A7C15ULL) >> (64 - shard_bits));
+        }
+    }
+
+    [[nodiscard]] auto GetShard(ident_t id) noexcept -> Shard& { return _shards[GetShardIndex(id)]; }
+    [[nodiscard]] auto GetShard(ident_t id) const noexcept -> const Shard& { return _shards[GetShardIndex(id)]; }
+    [[nodiscard]] auto GetShards() noexcept -> span<Shard> { return _shards; }
+    [[nodiscard]] auto GetShards() const noexcept -> const_span<Shard> { return _shards; }
+
+private:
+    array<Shard, ShardCount> _shards {};
+};
+
+FO_END_NAMESPACE
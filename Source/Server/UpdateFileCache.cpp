@@ -0,0 +1,187 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "UpdateFileCache.h"
+#include "DiskFileSystem.h"
+#include "Platform.h"
+#include "SafeArithmetics.h"
+
+FO_BEGIN_NAMESPACE
+
+UpdateFileCache::OpenFile::OpenFile(intptr_t handle, string disk_path) noexcept :
+    Handle {handle},
+    DiskPath {std::move(disk_path)}
+{
+    FO_STACK_TRACE_ENTRY();
+}
+
+UpdateFileCache::OpenFile::~OpenFile()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    Platform::CloseFile(Handle);
+}
+
+auto UpdateFileCache::FileView::Read(uint64_t offset, span<uint8_t> buf) const -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (buf.empty()) {
+        return true;
+    }
+    if (!Holder) {
+        return false;
+    }
+
+    if (Holder->Handle != Platform::INVALID_FILE_HANDLE) {
+        return Platform::ReadFileAt(Holder->Handle, offset, buf);
+    }
+
+    auto file = fs_open_ifstream(Holder->DiskPath);
+
+    if (!file) {
+        return false;
+    }
+
+    file.seekg(numeric_cast<std::streamoff>(offset), std::ios::beg);
+    return file && stream_read_exact(file, buf);
+}
+
+auto UpdateFileCache::GetFileCount() const -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    scoped_lock locker {_locker};
+
+    return _files.size();
+}
+
+auto UpdateFileCache::GetGeneration(size_t file_index) const -> uint32_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    scoped_lock locker {_locker};
+
+    FO_VERIFY_AND_THROW(file_index < _files.size(), "Update file cache index is out of range", file_index, _files.size());
+    return _files[file_index].Generation;
+}
+
+auto UpdateFileCache::GetHeldCount() const -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    scoped_lock locker {_locker};
+
+    return numeric_cast<size_t>(std::ranges::count_if(_files, [](const CachedFile& file) { return !!file.Descriptor; }));
+}
+
+auto UpdateFileCache::AddFile(string_view disk_path, uint64_t size) -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    CachedFile file;
+    file.DiskPath = string(disk_path);
+    file.Size = size;
+    file.WriteTime = fs_last_write_time(disk_path);
+
+    scoped_lock locker {_locker};
+
+    _files.emplace_back(std::move(file));
+    return _files.size() - 1;
+}
+
+auto UpdateFileCache::IsFileAsAnnounced(string_view disk_path, uint64_t announced_size, uint64_t announced_write_time) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto disk_size = fs_file_size(disk_path);
+    return disk_size.has_value() && *disk_size == announced_size && fs_last_write_time(disk_path) == announced_write_time;
+}
+
+auto UpdateFileCache::GetFileView(size_t file_index) -> optional<FileView>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    string disk_path;
+    uint64_t announced_size;
+    uint64_t announced_write_time;
+
+    {
+        scoped_lock locker {_locker};
+
+        FO_VERIFY_AND_THROW(file_index < _files.size(), "Update file cache index is out of range", file_index, _files.size());
+        disk_path = _files[file_index].DiskPath;
+        announced_size = _files[file_index].Size;
+        announced_write_time = _files[file_index].WriteTime;
+    }
+
+    // Checked on every request and outside the lock: a file rewritten in place would hand out bytes that no longer
+    // match the announced hash. A change after the check only fails the read, the descriptor can't fault like a mapping
+    bool disk_matches = IsFileAsAnnounced(disk_path, announced_size, announced_write_time);
+
+    scoped_lock locker {_locker};
+
+    auto& file = _files[file_index];
+
+    if (!disk_matches) {
+        // Views already handed out keep their holder, so requests in flight finish on the file they were checked against
+        file.Descriptor.reset();
+        return std::nullopt;
+    }
+
+    if (file.Size == 0) {
+        return FileView {.Holder = {}, .Generation = file.Generation};
+    }
+
+    if (!file.Descriptor) {
+        intptr_t handle = Platform::OpenReadOnlyFile(file.DiskPath);
+
+        if (handle != Platform::INVALID_FILE_HANDLE) {
+            _openCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        auto descriptor = SafeAlloc::MakeShared<const OpenFile>(handle, file.DiskPath);
+
+        // The check above ran before the open, so a file replaced in between shows up only on a second look
+        if (!IsFileAsAnnounced(file.DiskPath, file.Size, file.WriteTime)) {
+            return std::nullopt;
+        }
+
+        file.Descriptor = std::move(descriptor);
+        file.Generation++;
+    }
+
+    return FileView {.Holder = file.Descriptor, .Generation = file.Generation};
+}
+
+FO_END_NAMESPACE
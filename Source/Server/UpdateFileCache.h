@@ -0,0 +1,106 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+#include "Common.h"
+
+FO_BEGIN_NAMESPACE
+
+// Read-only descriptors of the update files served from disk, one per file and shared by every connection
+// downloading it, so a portion request costs a stat and a positional read instead of an open, a seek and a read.
+// A view is only handed out while the file on disk still has the size and write time it was announced with; once
+// that changes the descriptor is dropped, and reopening a restored file starts a new generation. Reads go through the
+// descriptor rather than a mapping, so a file truncated under a read fails the read instead of faulting the process,
+// and a held descriptor never blocks replacing the file
+class UpdateFileCache final
+{
+    struct OpenFile;
+
+public:
+    struct FileView
+    {
+        shared_ptr<const OpenFile> Holder {}; // Keeps the descriptor open while the bytes are read, even past a drop
+        uint32_t Generation {};
+
+        // Reads the file the view was checked against, false on any failure or a short read
+        [[nodiscard]] auto Read(uint64_t offset, span<uint8_t> buf) const -> bool;
+    };
+
+    UpdateFileCache() = default;
+    UpdateFileCache(const UpdateFileCache&) = delete;
+    UpdateFileCache(UpdateFileCache&&) noexcept = delete;
+    auto operator=(const UpdateFileCache&) = delete;
+    auto operator=(UpdateFileCache&&) noexcept = delete;
+    ~UpdateFileCache() = default;
+
+    [[nodiscard]] auto GetFileCount() const -> size_t;
+    [[nodiscard]] auto GetGeneration(size_t file_index) const -> uint32_t;
+    [[nodiscard]] auto GetHeldCount() const -> size_t;
+    [[nodiscard]] auto GetOpenCount() const noexcept -> size_t { return _openCount.load(std::memory_order_relaxed); }
+
+    // Files are registered while loading, before any view is requested
+    auto AddFile(string_view disk_path, uint64_t size) -> size_t;
+    auto GetFileView(size_t file_index) -> optional<FileView>;
+
+private:
+    struct OpenFile
+    {
+        OpenFile(intptr_t handle, string disk_path) noexcept;
+        OpenFile(const OpenFile&) = delete;
+        OpenFile(OpenFile&&) noexcept = delete;
+        auto operator=(const OpenFile&) = delete;
+        auto operator=(OpenFile&&) noexcept = delete;
+        ~OpenFile();
+
+        intptr_t Handle; // Platform::INVALID_FILE_HANDLE where positional reads are unsupported, read by path instead
+        string DiskPath;
+    };
+
+    struct CachedFile
+    {
+        string DiskPath {};
+        uint64_t Size {};
+        uint64_t WriteTime {};
+        shared_ptr<const OpenFile> Descriptor {};
+        uint32_t Generation {};
+    };
+
+    [[nodiscard]] static auto IsFileAsAnnounced(string_view disk_path, uint64_t announced_size, uint64_t announced_write_time) -> bool;
+
+    mutable mutex _locker {};
+    vector<CachedFile> _files FO_TSA_GUARDED_BY(_locker) {};
+    std::atomic_size_t _openCount {};
+};
+
+FO_END_NAMESPACE
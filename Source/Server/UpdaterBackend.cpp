@@ -41,6 +41,7 @@
 #include "SafeArithmetics.h"
 #include "ServerConnection.h"
 #include "StringUtils.h"
+#include "UpdateDelta.h"
 
 FO_BEGIN_NAMESPACE
 
@@ -57,8 +58,9 @@ void UpdaterBackend::LoadFromClientResources(const GlobalSettings& settings, str
     vector<uint8_t> common_update_files_desc;
     map<string, vector<UpdateFileInfo>> binary_target_update_files;
     map<string, vector<uint8_t>> binary_target_update_files_desc;
+    auto disk_file_cache = SafeAlloc::MakeUnique<UpdateFileCache>();
 
-    auto add_sync_file = [&settings, &update_files](string_view disk_path, string_view client_path, UpdateFileTarget target) -> UpdateFileInfo {
+    auto add_sync_file = [&settings, &update_files, &disk_file_cache](string_view disk_path, string_view client_path, UpdateFileTarget target) -> UpdateFileInfo {
         UpdateFileData data {};
 
         auto file = fs_open_ifstream(disk_path);
@@ -83,6 +85,9 @@ void UpdaterBackend::LoadFromClientResources(const GlobalSettings& settings, str
         else {
             data.DiskPath = string(disk_path);
             data.Size = numeric_cast<uint64_t>(file_size);
+
+            // Registered before hashing, so a file rewritten while being hashed is never served under that hash
+            data.CacheIndex = disk_file_cache->AddFile(disk_path, data.Size);
             auto file_hash = fs_hash_file(disk_path);
 
             if (!file_hash.has_value()) {
@@ -178,6 +183,17 @@ void UpdaterBackend::LoadFromClientResources(const GlobalSettings& settings, str
     _commonUpdateFilesDesc.swap(common_update_files_desc);
     _binaryTargetUpdateFiles.swap(binary_target_update_files);
     _binaryTargetUpdateFilesDesc.swap(binary_target_update_files_desc);
+    _diskFileCache.swap(disk_file_cache);
+
+    _deltaMaxFileSize = numeric_cast<uint64_t>(std::max(settings.UpdateDeltaMaxFileSize, 0));
+    _deltaCacheSize = numeric_cast<size_t>(std::max(settings.UpdateDeltaCacheSize, 0));
+
+    {
+        // Cached deltas describe the previous files
+        scoped_lock locker {_deltaCacheLocker};
+        _deltaCache.clear();
+        _deltaCacheOrder.clear();
+    }
 }
 
 void UpdaterBackend::VerifyClientResourcesMetadata(const GlobalSettings& settings, string_view server_metadata_version)
@@ -216,6 +232,7 @@ void UpdaterBackend::ProcessUpdateFile(ptr<Player> player, int32_t update_file_m
 
     auto file_index = in_buf->Read<uint32_t>();
     auto start_offset = in_buf->Read<uint64_t>();
+    auto size_limit = in_buf->Read<uint64_t>();
 
     in_buf.Unlock();
 
@@ -242,63 +259,205 @@ void UpdaterBackend::ProcessUpdateFile(ptr<Player> player, int32_t update_file_m
 
     uint64_t update_portion_limit = numeric_cast<uint64_t>(update_file_max_portion_size);
     uint64_t remaining_size = file_size - start_offset;
-    uint64_t update_portion = std::min(update_portion_limit, remaining_size);
-    size_t update_portion_size = numeric_cast<size_t>(update_portion);
+    uint64_t update_portion = std::min({update_portion_limit, remaining_size, size_limit});
+    auto update_data = GetFilePortion(file_index, start_offset, numeric_cast<size_t>(update_portion));
+
+    if (!update_data.has_value()) {
+        WriteLog(LogType::Warning, "Can't serve update file portion, file index {}, offset {}, client host '{}'", file_index, start_offset, connection->GetHost());
+        connection->HardDisconnect(DisconnectReason::UpdaterError);
+        return;
+    }
+
+    player->Send_UpdateFileData(*update_data);
+}
+
+auto UpdaterBackend::GetFilePortion(uint32_t file_index, uint64_t offset, size_t size) -> optional<const_span<uint8_t>>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(file_index < _updateFiles.size(), "Update file index is out of range", file_index, _updateFiles.size());
+
+    const auto& update_file = _updateFiles[file_index];
+    FO_VERIFY_AND_THROW(offset <= update_file.Size && size <= update_file.Size - offset, "Update file portion is out of range", file_index, offset, size, update_file.Size);
+
+    if (size == 0) {
+        return const_span<uint8_t> {};
+    }
+
+    if (update_file.InMemory) {
+        return const_span<uint8_t> {update_file.MemoryData.data() + numeric_cast<size_t>(offset), size};
+    }
+
+    // The announcement is a start-time snapshot while the bytes are read now, so a pack replaced under a live
+    // server would travel to the client under the hash announced for the previous one
+    auto disk_view = _diskFileCache->GetFileView(update_file.CacheIndex);
+
+    if (!disk_view.has_value()) {
+        WriteLog(LogType::Warning, "Update file '{}' changed on disk since startup, announced size {}, current size {}", update_file.DiskPath, update_file.Size, fs_file_size(update_file.DiskPath).value_or(0));
+        return std::nullopt;
+    }
+
+    // Reused by the worker thread across requests, so a portion costs a positional read and no allocation
+    static thread_local vector<uint8_t> disk_portion_buf;
 
-    vector<uint8_t> disk_update_data {};
+    if (disk_portion_buf.size() < size) {
+        disk_portion_buf.resize(size);
+    }
+
+    if (!disk_view->Read(offset, {disk_portion_buf.data(), size})) {
+        WriteLog(LogType::Warning, "Can't read update file '{}', file index {}, offset {}", update_file.DiskPath, file_index, offset);
+        return std::nullopt;
+    }
+
+    return const_span<uint8_t> {disk_portion_buf.data(), size};
+}
+
+void UpdaterBackend::ProcessUpdateFileDelta(ptr<Player> player)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    auto connection = player->GetConnection();
+    auto in_buf = connection->ReadBuf();
+
+    auto file_index = in_buf->Read<uint32_t>();
+    auto basis_signatures = ReadUpdateBlockSignatures(*in_buf);
+
+    in_buf.Unlock();
+
+    if (file_index >= _updateFiles.size()) {
+        WriteLog(LogType::Warning, "Wrong delta file index {}, from host '{}'", file_index, connection->GetHost());
+        connection->HardDisconnect(DisconnectReason::UpdaterError);
+        return;
+    }
 
-    if (update_portion_size != 0 && !update_file.InMemory) {
-        // The descriptor is a start-time snapshot while the bytes are read now, so a pack replaced under a
-        // live server would travel to the client under the hash announced for the previous one
-        auto current_disk_size = fs_file_size(update_file.DiskPath);
+    if (!basis_signatures.has_value()) {
+        WriteLog(LogType::Warning, "Wrong delta block signatures, file index {}, client host '{}'", file_index, connection->GetHost());
+        connection->HardDisconnect(DisconnectReason::UpdaterError);
+        return;
+    }
 
-        if (!current_disk_size.has_value() || *current_disk_size != update_file.Size) {
-            WriteLog(LogType::Warning, "Update file '{}' changed on disk since startup, announced size {}, current size {}, client host '{}'", update_file.DiskPath, update_file.Size, current_disk_size.value_or(0), connection->GetHost());
-            connection->HardDisconnect(DisconnectReason::UpdaterError);
-            return;
+    // The client derives the block size from the announced size, any other one only makes distinct bases to scan
+    if (uint32_t expected_block_size = GetUpdateDeltaBlockSize(_updateFiles[file_index].Size); basis_signatures->BlockSize != expected_block_size) {
+        WriteLog(LogType::Warning, "Wrong delta block size {}, expected {}, file index {}, client host '{}'", basis_signatures->BlockSize, expected_block_size, file_index, connection->GetHost());
+        connection->HardDisconnect(DisconnectReason::UpdaterError);
+        return;
+    }
+
+    auto delta_ops = MakeFileDelta(file_index, *basis_signatures);
+
+    if (!delta_ops) {
+        WriteLog(LogType::Warning, "Can't make update delta, file index {}, client host '{}'", file_index, connection->GetHost());
+        connection->HardDisconnect(DisconnectReason::UpdaterError);
+        return;
+    }
+
+    player->Send_UpdateFileDelta(*delta_ops);
+}
+
+auto UpdaterBackend::MakeFileDelta(uint32_t file_index, const UpdateBlockSignatures& basis) -> shared_ptr<const vector<UpdateDeltaOp>>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    FO_VERIFY_AND_THROW(file_index < _updateFiles.size(), "Update delta file index is out of range", file_index, _updateFiles.size());
+
+    const auto& update_file = _updateFiles[file_index];
+    UpdateFileCache::FileView disk_view {};
+
+    if (!update_file.InMemory) {
+        // Literal ranges are fetched later by offset, so a replaced pack must be caught here as well, even when
+        // the delta itself comes from the cache
+        auto cached_disk_view = _diskFileCache->GetFileView(update_file.CacheIndex);
+
+        if (!cached_disk_view.has_value()) {
+            WriteLog(LogType::Warning, "Update file '{}' changed on disk since startup, announced size {}, current size {}", update_file.DiskPath, update_file.Size, fs_file_size(update_file.DiskPath).value_or(0));
+            return nullptr;
         }
 
-        disk_update_data.resize(update_portion_size);
+        disk_view = std::move(*cached_disk_view);
+    }
 
-        auto read_update_file_portion = [](string_view disk_path, uint64_t start_offset, vector<uint8_t>& data) {
-            FO_STACK_TRACE_ENTRY();
+    // Scanning costs a full pass over the file per distinct basis, past the cap resending it whole is cheaper
+    if (_deltaMaxFileSize != 0 && update_file.Size > _deltaMaxFileSize) {
+        vector<UpdateDeltaOp> whole_file_ops {{.Type = UpdateDeltaOpType::Literal, .Offset = 0, .Size = update_file.Size}};
+        return SafeAlloc::MakeShared<const vector<UpdateDeltaOp>>(std::move(whole_file_ops));
+    }
 
-            auto file = fs_open_ifstream(disk_path);
+    if (_deltaCacheSize == 0) {
+        auto delta_ops = ScanFileDelta(file_index, disk_view, basis);
+        return delta_ops.has_value() ? SafeAlloc::MakeShared<const vector<UpdateDeltaOp>>(std::move(*delta_ops)) : nullptr;
+    }
 
-            if (!file) {
-                return false;
-            }
+    const DeltaCacheKey key {update_file.Hash, HashUpdateBlockSignatures(basis)};
+    shared_ptr<DeltaCacheEntry> entry;
 
-            file.seekg(numeric_cast<std::streamoff>(start_offset), std::ios::beg);
+    {
+        scoped_lock locker {_deltaCacheLocker};
 
-            if (!file) {
-                return false;
-            }
+        auto& cached_entry = _deltaCache[key];
 
-            return stream_read_exact(file, data);
-        };
+        if (!cached_entry) {
+            cached_entry = SafeAlloc::MakeShared<DeltaCacheEntry>();
+            _deltaCacheOrder.emplace_back(key);
+        }
 
-        if (!read_update_file_portion(update_file.DiskPath, start_offset, disk_update_data)) {
-            WriteLog(LogType::Warning, "Can't read update file '{}', file index {}, client host '{}'", update_file.DiskPath, file_index, connection->GetHost());
-            connection->HardDisconnect(DisconnectReason::UpdaterError);
-            return;
+        entry = cached_entry;
+
+        while (_deltaCacheOrder.size() > _deltaCacheSize) {
+            _deltaCache.erase(_deltaCacheOrder.front());
+            _deltaCacheOrder.pop_front();
         }
     }
 
-    const_span<uint8_t> update_data {};
+    std::call_once(entry->Computed, [&] {
+        auto delta_ops = ScanFileDelta(file_index, disk_view, basis);
 
-    if (update_portion_size != 0) {
-        if (update_file.InMemory) {
-            size_t offset = numeric_cast<size_t>(start_offset);
-            FO_STRONG_ASSERT(offset < update_file.MemoryData.size(), "Byte offset is past the end of the update data buffer");
-            update_data = {update_file.MemoryData.data() + offset, update_portion_size};
+        if (delta_ops.has_value()) {
+            entry->Ops = SafeAlloc::MakeShared<const vector<UpdateDeltaOp>>(std::move(*delta_ops));
         }
-        else {
-            update_data = {disk_update_data.data(), update_portion_size};
+    });
+
+    if (!entry->Ops) {
+        // A failed read is not remembered, the next request for this basis scans again
+        scoped_lock locker {_deltaCacheLocker};
+
+        if (const auto it = _deltaCache.find(key); it != _deltaCache.end() && it->second == entry) {
+            _deltaCache.erase(it);
+            _deltaCacheOrder.erase(std::ranges::find(_deltaCacheOrder, key));
         }
     }
 
-    player->Send_UpdateFileData(update_data);
+    return entry->Ops;
+}
+
+auto UpdaterBackend::ScanFileDelta(uint32_t file_index, const UpdateFileCache::FileView& disk_view, const UpdateBlockSignatures& basis) -> optional<vector<UpdateDeltaOp>>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    const auto& update_file = _updateFiles[file_index];
+
+    ++_deltaScanCount;
+
+    if (update_file.InMemory) {
+        return MakeUpdateDelta(update_file.MemoryData, basis);
+    }
+
+    auto read_target = [&disk_view](uint64_t offset, span<uint8_t> buf) -> bool { return disk_view.Read(offset, buf); };
+
+    auto delta_ops = MakeUpdateDelta(update_file.Size, read_target, basis);
+
+    if (!delta_ops.has_value()) {
+        WriteLog(LogType::Warning, "Can't read update file '{}' for delta, file index {}", update_file.DiskPath, file_index);
+    }
+
+    return delta_ops;
+}
+
+auto UpdaterBackend::GetCachedDeltaCount() const -> size_t
+{
+    FO_STACK_TRACE_ENTRY();
+
+    scoped_lock locker {_deltaCacheLocker};
+    return _deltaCache.size();
 }
 
 FO_END_NAMESPACE
@@ -36,6 +36,8 @@
 #include "Common.h"
 
 #include "Settings.h"
+#include "UpdateDelta.h"
+#include "UpdateFileCache.h"
 
 FO_BEGIN_NAMESPACE
 
@@ -53,18 +55,33 @@ class UpdaterBackend final
     auto operator=(UpdaterBackend&&) -> UpdaterBackend& = delete;
 
     [[nodiscard]] auto GetUpdateDescriptor(string_view binary_target_name) const -> const_span<uint8_t>;
+    [[nodiscard]] auto GetUpdateFileCount() const noexcept -> size_t { return _updateFiles.size(); }
+    [[nodiscard]] auto GetDeltaScanCount() const noexcept -> size_t { return _deltaScanCount.load(std::memory_order_relaxed); }
+    [[nodiscard]] auto GetCachedDeltaCount() const -> size_t;
 
     void LoadFromClientResources(const GlobalSettings& settings, string_view server_metadata_version);
     void ProcessUpdateFile(ptr<Player> player, int32_t update_file_max_portion_size);
+    void ProcessUpdateFileDelta(ptr<Player> player);
+
+    // Bytes of the announced file, none when the file no longer matches its announcement or can't be read. Disk-mode
+    // bytes live in a per-thread buffer that the next call on the same thread overwrites
+    [[nodiscard]] auto GetFilePortion(uint32_t file_index, uint64_t offset, size_t size) -> optional<const_span<uint8_t>>;
+
+    // Delta of the announced file against the client's basis, shared between clients that hold the same outdated
+    // file; null when the file no longer matches its announcement or can't be read
+    [[nodiscard]] auto MakeFileDelta(uint32_t file_index, const UpdateBlockSignatures& basis) -> shared_ptr<const vector<UpdateDeltaOp>>;
 
 private:
     static void VerifyClientResourcesMetadata(const GlobalSettings& settings, string_view server_metadata_version);
 
+    [[nodiscard]] auto ScanFileDelta(uint32_t file_index, const UpdateFileCache::FileView& disk_view, const UpdateBlockSignatures& basis) -> optional<vector<UpdateDeltaOp>>;
+
     struct UpdateFileData
     {
         bool InMemory {};
         string DiskPath;
         vector<uint8_t> MemoryData {};
+        size_t CacheIndex {};
         uint64_t Size {};
         uint64_t Hash {};
     };
@@ -81,6 +98,24 @@ class UpdaterBackend final
     vector<uint8_t> _commonUpdateFilesDesc {};
     map<string, vector<UpdateFileInfo>> _binaryTargetUpdateFiles {};
     map<string, vector<uint8_t>> _binaryTargetUpdateFilesDesc {};
+    unique_ptr<UpdateFileCache> _diskFileCache {SafeAlloc::MakeUnique<UpdateFileCache>()};
+
+    // Keyed by the file hash and the basis signatures hash, the first request computes under the once flag while
+    // the same ones arriving meanwhile wait for it instead of scanning the file again
+    struct DeltaCacheEntry
+    {
+        std::once_flag Computed {};
+        shared_ptr<const vector<UpdateDeltaOp>> Ops {};
+    };
+
+    using DeltaCacheKey = pair<uint64_t, uint64_t>;
+
+    uint64_t _deltaMaxFileSize {};
+    size_t _deltaCacheSize {};
+    mutable mutex _deltaCacheLocker {};
+    map<DeltaCacheKey, shared_ptr<DeltaCacheEntry>> _deltaCache FO_TSA_GUARDED_BY(_deltaCacheLocker) {};
+    deque<DeltaCacheKey> _deltaCacheOrder FO_TSA_GUARDED_BY(_deltaCacheLocker) {}; // Insertion order, the oldest delta is evicted first
+    std::atomic_size_t _deltaScanCount {};
 };
 
 FO_END_NAMESPACE
@@ -33,13 +33,15 @@
 
 #include "WorkerPool.h"
 
+#include "LatencyStats.h"
 #include "WorkThread.h"
 
 FO_BEGIN_NAMESPACE
 
-WorkerPool::WorkerPool(string_view name, int32_t thread_count, ptr<const std::atomic<bool>> shutdown_flag, bool start_paused) :
+WorkerPool::WorkerPool(string_view name, int32_t thread_count, ptr<const std::atomic<bool>> shutdown_flag, bool start_paused, nptr<LatencyStats> latency_stats) :
     _name {name},
     _shutdownFlag {shutdown_flag},
+    _latencyStats {latency_stats},
     _paused {start_paused}
 {
     FO_STACK_TRACE_ENTRY();
@@ -50,6 +52,16 @@ WorkerPool::WorkerPool(string_view name, int32_t thread_count, ptr<const std::at
 
     _workers.reserve(numeric_cast<size_t>(thread_count));
 
+    for (int32_t i = 0; i < thread_count; i++) {
+        _workerSignals.emplace_back();
+    }
+
+    {
+        scoped_lock locker {_mutex};
+
+        _sleepingWorkers.resize(numeric_cast<size_t>(thread_count));
+    }
+
     try {
         for (int32_t i = 0; i < thread_count; i++) {
             _workers.emplace_back(run_thread(strex("{}-{}", _name, i), [this, i] { WorkerEntry(i); }));
@@ -80,7 +92,7 @@ void WorkerPool::StopWorkers() noexcept
         _finish = true;
     }
 
-    _workSignal.notify_all();
+    WakeAllWorkers();
 
     for (auto& worker : _workers) {
         if (worker.joinable()) {
@@ -98,6 +110,8 @@ void WorkerPool::Submit(timespan delay, Job job)
 {
     FO_STACK_TRACE_ENTRY();
 
+    optional<size_t> wake_worker;
+
     {
         scoped_lock locker {_mutex};
 
@@ -106,9 +120,10 @@ void WorkerPool::Submit(timespan delay, Job job)
         }
 
         EnqueueJob(nanotime::now() + delay, ANONYMOUS_JOB, std::move(job));
+        wake_worker = PickWorkerToWake(ANONYMOUS_JOB);
     }
 
-    _workSignal.notify_one();
+    WakeWorker(wake_worker);
 }
 
 void WorkerPool::Submit(JobKey key, Job job)
@@ -117,6 +132,11 @@ void WorkerPool::Submit(JobKey key, Job job)
 }
 
 void WorkerPool::Submit(JobKey key, timespan delay, Job job)
+{
+    Submit(key, delay, std::move(job), NO_AFFINITY);
+}
+
+void WorkerPool::Submit(JobKey key, timespan delay, Job job, size_t affinity)
 {
     FO_STACK_TRACE_ENTRY();
 
@@ -125,7 +145,7 @@ void WorkerPool::Submit(JobKey key, timespan delay, Job job)
         return;
     }
 
-    bool needs_notify = false;
+    optional<size_t> wake_worker;
 
     {
         scoped_lock locker {_mutex};
@@ -134,6 +154,11 @@ void WorkerPool::Submit(JobKey key, timespan delay, Job job)
             throw EntitySyncException("Cannot submit job to a stopped WorkerPool");
         }
 
+        // Without an explicit affinity the key keeps whatever it was homed to
+        if (affinity != NO_AFFINITY) {
+            _keyAffinity[key] = affinity;
+        }
+
         if (_runningKeys.contains(key)) {
             _pendingRerun[key] = ScheduledJob {nanotime::now() + delay, key, std::move(job)};
             _cancelOnFinish.erase(key);
@@ -141,13 +166,11 @@ void WorkerPool::Submit(JobKey key, timespan delay, Job job)
         else if (!_queuedKeys.contains(key)) {
             EnqueueJob(nanotime::now() + delay, key, std::move(job));
             _queuedKeys.insert(key);
-            needs_notify = true;
+            wake_worker = PickWorkerToWake(key);
         }
     }
 
-    if (needs_notify) {
-        _workSignal.notify_one();
-    }
+    WakeWorker(wake_worker);
 }
 
 auto WorkerPool::Wake(JobKey key) -> bool
@@ -158,15 +181,15 @@ auto WorkerPool::Wake(JobKey key) -> bool
         return false;
     }
 
-    bool wake_signal = false;
+    optional<size_t> wake_worker;
     bool result = false;
 
     {
         scoped_lock locker {_mutex};
 
         if (_queuedKeys.contains(key)) {
-            // Pull the queued entry out, set its FireTime to now, and re-insert sorted so workers
-            // that are wait_until-ing on the previous front fire time get woken to pick it up
+            // Pull the queued entry out, set its FireTime to now, and re-insert sorted, then wake a worker that
+            // may take it, which may be sleeping until the previous fire time
             for (auto it = _jobs.begin(); it != _jobs.end(); ++it) {
                 if (it->Key == key) {
                     auto entry = std::move(*it);
@@ -177,7 +200,7 @@ auto WorkerPool::Wake(JobKey key) -> bool
                 }
             }
 
-            wake_signal = true;
+            wake_worker = PickWorkerToWake(key);
             result = true;
         }
         else if (_runningKeys.contains(key)) {
@@ -188,9 +211,7 @@ auto WorkerPool::Wake(JobKey key) -> bool
         }
     }
 
-    if (wake_signal) {
-        _workSignal.notify_all();
-    }
+    WakeWorker(wake_worker);
 
     return result;
 }
@@ -204,7 +225,6 @@ auto WorkerPool::Cancel(JobKey key) -> bool
     }
 
     bool removed = false;
-    bool wake = false;
 
     {
         scoped_lock locker {_mutex};
@@ -216,8 +236,8 @@ auto WorkerPool::Cancel(JobKey key) -> bool
                     break;
                 }
             }
+            // Workers sleeping until its fire time find nothing then and go back to sleep, so none is woken now
             removed = true;
-            wake = true;
         }
 
         if (_pendingRerun.erase(key) != 0) {
@@ -232,10 +252,11 @@ auto WorkerPool::Cancel(JobKey key) -> bool
 
         // Cancel supersedes any pending wake
         _wakeRequests.erase(key);
-    }
 
-    if (wake) {
-        _workSignal.notify_all();
+        // An in-flight run still needs its home until it finalizes
+        if (!_runningKeys.contains(key)) {
+            _keyAffinity.erase(key);
+        }
     }
 
     return removed;
@@ -251,6 +272,7 @@ void WorkerPool::Clear()
     _queuedKeys.clear();
     _pendingRerun.clear();
     _wakeRequests.clear();
+    std::erase_if(_keyAffinity, [this](const auto& entry) FO_TSA_NO_ANALYSIS { return !_runningKeys.contains(entry.first); });
 
     // Any in-flight run should drop its self-reschedule. We can't know its key from here, so mark
     // every currently-running key
@@ -301,7 +323,7 @@ void WorkerPool::Resume()
         _paused = false;
     }
 
-    _workSignal.notify_all();
+    WakeAllWorkers();
 }
 
 void WorkerPool::Pause()
@@ -341,6 +363,9 @@ auto WorkerPool::GetDiagnostics() const -> Diagnostics
         .ActiveWorkers = _activeWorkers,
         .Paused = _paused,
         .CompletedJobs = _completedJobs,
+        .AffinityScheduling = _affinityScheduling.load(std::memory_order_relaxed),
+        .AffinityKeys = _keyAffinity.size(),
+        .StolenJobs = _stolenJobs,
     };
 }
 
@@ -354,7 +379,102 @@ auto WorkerPool::IsKeyActive(JobKey key) const -> bool
 
     scoped_lock locker {_mutex};
 
-    return _queuedKeys.contains(key) || _runningKeys.contains(key) || _pendingRerun.contains(key);
+    return IsKeyActiveUnlocked(key);
+}
+
+void WorkerPool::EnableAffinityScheduling(timespan steal_delay)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    {
+        scoped_lock locker {_mutex};
+
+        _affinityStealDelay = steal_delay;
+        _affinityScheduling.store(true, std::memory_order_relaxed);
+    }
+
+    WakeAllWorkers();
+}
+
+auto WorkerPool::SetKeyAffinity(JobKey key, size_t affinity) -> bool
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (key == ANONYMOUS_JOB) {
+        return false;
+    }
+
+    optional<size_t> wake_worker;
+
+    {
+        scoped_lock locker {_mutex};
+
+        if (!IsKeyActiveUnlocked(key)) {
+            return false;
+        }
+
+        if (affinity != NO_AFFINITY) {
+            _keyAffinity[key] = affinity;
+        }
+        else {
+            _keyAffinity.erase(key);
+        }
+
+        // A queued job may now belong to a worker that is sleeping past its fire time
+        if (_queuedKeys.contains(key)) {
+            wake_worker = PickWorkerToWake(key);
+        }
+    }
+
+    WakeWorker(wake_worker);
+    return true;
+}
+
+auto WorkerPool::PickWorkerToWake(JobKey key) noexcept -> optional<size_t>
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    // An affine job wakes its home worker. When that one is busy, any sleeper wakes instead and arms the steal
+    // deadline, so the job still runs on time if the home worker stays busy
+    if (key != ANONYMOUS_JOB && _affinityScheduling.load(std::memory_order_relaxed)) {
+        if (const auto it = _keyAffinity.find(key); it != _keyAffinity.end()) {
+            const size_t home_worker = it->second % _workers.size();
+
+            if (_sleepingWorkers[home_worker]) {
+                _sleepingWorkers[home_worker] = false;
+                return home_worker;
+            }
+        }
+    }
+
+    // A claimed worker is no longer counted as sleeping, so the next job goes to another one
+    for (size_t i = 0; i < _sleepingWorkers.size(); i++) {
+        if (_sleepingWorkers[i]) {
+            _sleepingWorkers[i] = false;
+            return i;
+        }
+    }
+
+    // Everyone is running a job and looks at the queue again when it finishes
+    return std::nullopt;
+}
+
+void WorkerPool::WakeWorker(optional<size_t> worker_index) noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    if (worker_index.has_value()) {
+        _workerSignals[worker_index.value()].notify_one();
+    }
+}
+
+void WorkerPool::WakeAllWorkers() noexcept
+{
+    FO_NO_STACK_TRACE_ENTRY();
+
+    for (auto& signal : _workerSignals) {
+        signal.notify_one();
+    }
 }
 
 void WorkerPool::EnqueueJob(nanotime fire_time, JobKey key, Job job) noexcept
@@ -386,12 +506,57 @@ auto WorkerPool::IsBarrierIdle() const noexcept -> bool
     return !IsAnyJobReadyNow() && _activeWorkers == 0 && _pendingRerun.empty();
 }
 
+auto WorkerPool::IsKeyActiveUnlocked(JobKey key) const noexcept -> bool
+{
+    return _queuedKeys.contains(key) || _runningKeys.contains(key) || _pendingRerun.contains(key);
+}
+
+auto WorkerPool::FindAffinityJob(int32_t worker_index, nanotime now, nanotime& next_fire, bool& stolen) const noexcept -> size_t
+{
+    // `_jobs` is sorted by fire time, so the scan stops at the first job that is not due yet
+    for (size_t i = 0; i < _jobs.size(); i++) {
+        const ScheduledJob& job = _jobs[i];
+
+        if (job.FireTime > now) {
+            if (!next_fire || job.FireTime < next_fire) {
+                next_fire = job.FireTime;
+            }
+
+            break;
+        }
+
+        auto it = job.Key != ANONYMOUS_JOB ? _keyAffinity.find(job.Key) : _keyAffinity.end();
+
+        if (it == _keyAffinity.end() || it->second % _workers.size() == static_cast<size_t>(worker_index)) {
+            stolen = false;
+            return i;
+        }
+
+        // Its home worker is busy or asleep; past the steal delay any worker takes it to bound the latency
+        const nanotime steal_time = job.FireTime + _affinityStealDelay;
+
+        if (steal_time <= now) {
+            stolen = true;
+            return i;
+        }
+
+        if (!next_fire || steal_time < next_fire) {
+            next_fire = steal_time;
+        }
+    }
+
+    return _jobs.size();
+}
+
 void WorkerPool::WorkerEntry(int32_t worker_index) noexcept
 {
     FO_NO_STACK_TRACE_ENTRY();
 
     set_this_thread_name(strex("{}-{}", _name, worker_index));
 
+    const auto worker_slot = numeric_cast<size_t>(worker_index);
+    auto& work_signal = _workerSignals[worker_slot];
+
     while (true) {
         ScheduledJob job;
         bool got_job = false;
@@ -400,36 +565,55 @@ void WorkerPool::WorkerEntry(int32_t worker_index) noexcept
             unique_lock locker {_mutex};
 
             while (!_finish) {
-                if (_paused) {
-                    _workSignal.wait(locker);
-                    continue;
-                }
+                // Zero sleeps until this worker is picked or woken
+                nanotime wake_time {};
 
-                if (_jobs.empty()) {
-                    _workSignal.wait(locker);
-                    continue;
-                }
+                if (!_paused && !_jobs.empty()) {
+                    nanotime now = nanotime::now();
+                    size_t job_index = _jobs.size();
+
+                    if (_affinityScheduling.load(std::memory_order_relaxed)) {
+                        bool stolen = false;
+                        job_index = FindAffinityJob(worker_index, now, wake_time, stolen);
 
-                nanotime front_fire = _jobs.front().FireTime;
-                nanotime now = nanotime::now();
+                        if (job_index != _jobs.size() && stolen) {
+                            _stolenJobs++;
+                        }
+                    }
+                    else if (_jobs.front().FireTime <= now) {
+                        job_index = 0;
+                    }
+                    else {
+                        wake_time = _jobs.front().FireTime;
+                    }
 
-                if (front_fire > now) {
-                    // Wait until the earliest job becomes due, or until something nearer arrives
-                    _workSignal.wait_until(locker, front_fire.value());
-                    continue;
+                    if (job_index != _jobs.size()) {
+                        job = std::move(_jobs[job_index]);
+                        _jobs.erase(_jobs.begin() + numeric_cast<ptrdiff_t>(job_index));
+
+                        if (job.Key != ANONYMOUS_JOB) {
+                            _queuedKeys.erase(job.Key);
+                            _runningKeys.insert(job.Key);
+                        }
+
+                        _activeWorkers++;
+                        got_job = true;
+                        break;
+                    }
                 }
 
-                job = std::move(_jobs.front());
-                _jobs.erase(_jobs.begin());
+                // Nothing this worker may take yet; sleep until its next own job or steal deadline, or until a
+                // submitter picks it for a nearer one
+                _sleepingWorkers[worker_slot] = true;
 
-                if (job.Key != ANONYMOUS_JOB) {
-                    _queuedKeys.erase(job.Key);
-                    _runningKeys.insert(job.Key);
+                if (wake_time) {
+                    work_signal.wait_until(locker, wake_time.value());
+                }
+                else {
+                    work_signal.wait(locker);
                 }
 
-                _activeWorkers++;
-                got_job = true;
-                break;
+                _sleepingWorkers[worker_slot] = false;
             }
 
             if (_finish && !got_job) {
@@ -449,6 +633,7 @@ void WorkerPool::WorkerEntry(int32_t worker_index) noexcept
                 job_executed = true;
 
                 try {
+                    LatencySample latency_sample {_latencyStats ? _latencyStats->GetJobHistogram(job.Key.Type) : nullptr};
                     next_delay = job.Body();
                 }
                 catch (const std::exception& ex) {
@@ -462,7 +647,7 @@ void WorkerPool::WorkerEntry(int32_t worker_index) noexcept
             }
         }
 
-        bool need_wake = false;
+        optional<size_t> wake_worker;
         bool body_rescheduled = false;
 
         {
@@ -484,20 +669,23 @@ void WorkerPool::WorkerEntry(int32_t worker_index) noexcept
 
                     EnqueueJob(entry.FireTime, entry.Key, std::move(entry.Body));
                     _queuedKeys.insert(job.Key);
-                    need_wake = true;
+                    wake_worker = PickWorkerToWake(job.Key);
                 }
                 else if (next_delay.has_value() && !cancelled) {
                     timespan reschedule_delay = wake_requested ? timespan::zero : next_delay.value();
                     EnqueueJob(nanotime::now() + reschedule_delay, job.Key, std::move(job.Body));
                     body_rescheduled = true;
                     _queuedKeys.insert(job.Key);
-                    need_wake = true;
+                    wake_worker = PickWorkerToWake(job.Key);
+                }
+                else {
+                    _keyAffinity.erase(job.Key);
                 }
             }
             else if (next_delay.has_value()) {
                 EnqueueJob(nanotime::now() + next_delay.value(), ANONYMOUS_JOB, std::move(job.Body));
                 body_rescheduled = true;
-                need_wake = true;
+                wake_worker = PickWorkerToWake(ANONYMOUS_JOB);
             }
 
             if (job_executed) {
@@ -515,9 +703,7 @@ void WorkerPool::WorkerEntry(int32_t worker_index) noexcept
             job.Body = {};
         }
 
-        if (need_wake) {
-            _workSignal.notify_one();
-        }
+        WakeWorker(wake_worker);
 
         _idleSignal.notify_all();
     }
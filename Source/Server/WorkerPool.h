@@ -39,6 +39,8 @@
 
 FO_BEGIN_NAMESPACE
 
+class LatencyStats;
+
 enum class WorkerJobType : size_t
 {
     None = 0,
@@ -75,11 +77,15 @@ class WorkerPool final
         int32_t ActiveWorkers {};
         bool Paused {};
         uint64_t CompletedJobs {};
+        bool AffinityScheduling {};
+        size_t AffinityKeys {};
+        uint64_t StolenJobs {};
     };
 
     static constexpr JobKey ANONYMOUS_JOB {};
+    static constexpr size_t NO_AFFINITY = std::numeric_limits<size_t>::max();
 
-    explicit WorkerPool(string_view name, int32_t thread_count, ptr<const std::atomic<bool>> shutdown_flag, bool start_paused = false);
+    explicit WorkerPool(string_view name, int32_t thread_count, ptr<const std::atomic<bool>> shutdown_flag, bool start_paused = false, nptr<LatencyStats> latency_stats = nullptr);
     WorkerPool(const WorkerPool&) = delete;
     WorkerPool(WorkerPool&&) noexcept = delete;
     auto operator=(const WorkerPool&) = delete;
@@ -97,9 +103,16 @@ class WorkerPool final
     void Submit(timespan delay, Job job);
     void Submit(JobKey key, Job job);
     void Submit(JobKey key, timespan delay, Job job);
+    void Submit(JobKey key, timespan delay, Job job, size_t affinity);
     auto Wake(JobKey key) -> bool;
     auto Cancel(JobKey key) -> bool;
     void Clear();
+    // Affinity mode pins keyed jobs to the worker `affinity % thread count`, so jobs sharing an affinity (the
+    // server uses the map id) run serially on one thread instead of contending for the same entity locks.
+    // Another worker may steal a job once it has been due for `steal_delay`. Call before jobs are submitted
+    void EnableAffinityScheduling(timespan steal_delay);
+    // Re-homes an active key; the new affinity applies from its next run, an in-flight run finishes where it is
+    auto SetKeyAffinity(JobKey key, size_t affinity) -> bool;
     void WaitIdle() const;
     auto WaitIdle(timespan timeout) const -> bool;
 
@@ -113,13 +126,20 @@ class WorkerPool final
 
     [[nodiscard]] bool IsAnyJobReadyNow() const noexcept FO_TSA_REQUIRES(_mutex);
     [[nodiscard]] bool IsBarrierIdle() const noexcept FO_TSA_REQUIRES(_mutex);
+    [[nodiscard]] bool IsKeyActiveUnlocked(JobKey key) const noexcept FO_TSA_REQUIRES(_mutex);
+    [[nodiscard]] size_t FindAffinityJob(int32_t worker_index, nanotime now, nanotime& next_fire, bool& stolen) const noexcept FO_TSA_REQUIRES(_mutex);
 
     void EnqueueJob(nanotime fire_time, JobKey key, Job job) noexcept FO_TSA_REQUIRES(_mutex);
     void WorkerEntry(int32_t worker_index) noexcept;
     void StopWorkers() noexcept;
+    // Claims the sleeping worker that should look at a newly due job of the key, the signal goes out after the unlock
+    [[nodiscard]] optional<size_t> PickWorkerToWake(JobKey key) noexcept FO_TSA_REQUIRES(_mutex);
+    void WakeWorker(optional<size_t> worker_index) noexcept;
+    void WakeAllWorkers() noexcept;
 
     string _name;
     ptr<const std::atomic<bool>> _shutdownFlag;
+    nptr<LatencyStats> _latencyStats;
     vector<thread> _workers {};
     mutable mutex _mutex {};
     vector<ScheduledJob> _jobs FO_TSA_GUARDED_BY(_mutex) {}; // Sorted ascending by FireTime
@@ -129,7 +149,13 @@ class WorkerPool final
     unordered_set<JobKey> _cancelOnFinish FO_TSA_GUARDED_BY(_mutex) {};
     unordered_set<JobKey> _wakeRequests FO_TSA_GUARDED_BY(_mutex) {};
     uint64_t _completedJobs FO_TSA_GUARDED_BY(_mutex) {};
-    std::condition_variable_any _workSignal {};
+    std::atomic_bool _affinityScheduling {};
+    timespan _affinityStealDelay FO_TSA_GUARDED_BY(_mutex) {};
+    unordered_map<JobKey, size_t> _keyAffinity FO_TSA_GUARDED_BY(_mutex) {};
+    uint64_t _stolenJobs FO_TSA_GUARDED_BY(_mutex) {};
+    // Every worker sleeps on its own signal, so a job wakes one worker (its home one under affinity) instead of all
+    deque<std::condition_variable_any> _workerSignals {};
+    vector<bool> _sleepingWorkers FO_TSA_GUARDED_BY(_mutex) {};
     mutable std::condition_variable_any _idleSignal {};
     int32_t _activeWorkers FO_TSA_GUARDED_BY(_mutex) {};
     bool _finish FO_TSA_GUARDED_BY(_mutex) {};
@@ -0,0 +1,596 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <filesystem>
+#include <fstream>
+
+#include "catch_amalgamated.hpp"
+
+#include "Common.h"
+
+#if FO_ANGELSCRIPT_SCRIPTING
+#include "AngelScriptAot.h"
+#include "Test_AngelScriptAotFixtures.h"
+
+#include <angelscript.h>
+#endif
+
+FO_BEGIN_NAMESPACE
+
+#if FO_ANGELSCRIPT_SCRIPTING
+
+// Runs every suite function interpreted and translated, and requires identical results. The translation of the suite
+// is checked in as Test_AngelScriptAotFixtures.h, so a change to the script, the translator or the vendored compiler
+// shows up as stale functions here; regenerate the fixture with the hidden `[.aot]` test
+namespace
+{
+    using namespace AngelScript;
+
+    constexpr string_view AotSuiteScript = R"(
+namespace Hot
+{
+    int8 Small8 = 120;
+    int16 Small16 = -32760;
+    int64 Wide = 0;
+    float Ratio = 0.5f;
+    double Precise = 1.0;
+    int Counter = 0;
+
+    class Accumulator
+    {
+        int Total = 0;
+        int64 Mixed = 1;
+
+        void Add(int value)
+        {
+            Total += value * 3 - 1;
+            Mixed = Mixed * 31 + value;
+        }
+    }
+
+    int64 Fibonacci(int64 n)
+    {
+        int64 a = 0;
+        int64 b = 1;
+        for (int64 i = 0; i < n; i++) {
+            int64 t = a + b;
+            a = b;
+            b = t;
+        }
+        return a;
+    }
+
+    int64 Collatz(int64 start)
+    {
+        int n = int(start);
+        int steps = 0;
+        while (n > 1) {
+            if (n % 2 == 0) {
+                n /= 2;
+            }
+            else {
+                n = n * 3 + 1;
+            }
+            steps++;
+        }
+        return steps;
+    }
+
+    int64 Divide(int64 seed)
+    {
+        int a = int(seed) * 7;
+        int b = int(seed) - 3;
+        uint ua = uint(a);
+        uint ub = uint(b);
+        int64 wa = seed * 1000003;
+        int64 wb = seed - 5;
+        return (a / b) + (a % b) + int64(ua / ub) + int64(ua % ub) + wa / wb + wa % wb;
+    }
+
+    int64 IntMin(int64 seed)
+    {
+        int a = -2147483647 - 1;
+        int b = int(seed);
+        return a / b;
+    }
+
+    int64 Bits(int64 seed)
+    {
+        uint x = uint(seed) + 0x9E3779B9;
+        for (int i = 0; i < 16; i++) {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+        }
+        int s = int(x);
+        int64 w = seed * 0x12345678;
+        uint64 uw = uint64(w);
+        return int64(x & 0xFFFF) + (s >> 3) + (w >> 5) + int64(uw >> 7) + (w << 2) + int64(~x) + int64(~uw) + int64(x | 3) + (w ^ 0x55);
+    }
+
+    int64 Conversions(int64 seed)
+    {
+        double d = double(seed) * 1.75 - 3.25;
+        float f = float(d);
+        int i = int(f);
+        int64 l = int64(d * 1000);
+        uint u = uint(d < 0 ? -d : d);
+        uint64 ul = uint64(f < 0 ? -f * 10 : f * 10);
+        uint8 b = uint8(i);
+        int8 sb = int8(i);
+        int16 sw = int16(l);
+        uint16 uw = uint16(l);
+        double back = double(l) + double(ul) + double(u) + float(l) + float(ul);
+        return i + int64(u) + l + int64(ul) + b + sb + sw + uw + int64(back) + int64(uint(f) & 0xFFFF);
+    }
+
+    double Polynomial(double x)
+    {
+        double r = 0;
+        for (int i = 0; i < 10; i++) {
+            r = r * x + i * 0.5;
+        }
+        return r - x / 3.0 + (r % 7.5);
+    }
+
+    double FloatMath(double x)
+    {
+        float a = float(x);
+        float b = a * 0.25f + 1.5f;
+        float c = -a;
+        c += 2.0f;
+        c *= 3.0f;
+        c -= 0.125f;
+        return a * b - a / b + (a % b) + c + (b > a ? 1 : 0) + (a == b ? 2 : 0);
+    }
+
+    bool Truth(int a, int b)
+    {
+        return (a > b && !(a == 3)) || (b < 0 && a != b) || (a <= -b);
+    }
+
+    int64 Logic(int64 seed)
+    {
+        int count = 0;
+        for (int a = -5; a < 5; a++) {
+            for (int b = -3; b < int(seed); b++) {
+                if (Truth(a, b)) {
+                    count++;
+                }
+                bool x = a >= b;
+                bool y = !x;
+                if (y != (a < b)) {
+                    count += 100;
+                }
+            }
+        }
+        return count;
+    }
+
+    int64 Globals(int64 seed)
+    {
+        for (int i = 0; i < int(seed); i++) {
+            Small8++;
+            Small16--;
+            Wide--;
+            Ratio++;
+            Precise--;
+            Counter += i;
+        }
+        return Small8 + Small16 + Wide + int64(Ratio * 4) + int64(Precise) + Counter;
+    }
+
+    int64 Switches(int64 seed)
+    {
+        int64 total = 0;
+        for (int i = 0; i < int(seed); i++) {
+            switch (i % 7) {
+            case 0:
+                total += 10;
+                break;
+            case 1:
+                total -= 3;
+                break;
+            case 5:
+                total *= 2;
+                break;
+            default:
+                total += i;
+            }
+        }
+        return total;
+    }
+
+    int64 Calls(int64 seed)
+    {
+        int64 total = 0;
+        for (int i = 0; i < int(seed); i++) {
+            total += Native(i) + Cold(i);
+        }
+        return total;
+    }
+
+    int64 Objects(int64 seed)
+    {
+        Accumulator acc;
+        for (int i = 0; i < int(seed); i++) {
+            acc.Add(i);
+        }
+        return acc.Total + acc.Mixed;
+    }
+
+    void Outputs(int a, int &out sum, double &out half, int8 &out low)
+    {
+        sum = a + 1;
+        half = a / 2.0;
+        low = int8(a);
+    }
+
+    int64 References(int64 seed)
+    {
+        int sum;
+        double half;
+        int8 low;
+        Outputs(int(seed), sum, half, low);
+        return sum + int64(half * 2) + low;
+    }
+}
+
+int Cold(int a)
+{
+    return a * 7 - 1;
+}
+)";
+
+    struct AotSuiteResult
+    {
+        vector<string> Values {};
+        size_t AttachedCount {};
+        size_t StaleCount {};
+    };
+
+    class AotBytecodeStream final : public asIBinaryStream
+    {
+    public:
+        auto Read(void* raw_data, asUINT size) -> int override
+        {
+            if (_readPos + size > _buf.size()) {
+                return -1;
+            }
+
+            MemCopy(raw_data, _buf.data() + _readPos, size);
+            _readPos += size;
+            return 0;
+        }
+
+        auto Write(const void* raw_data, asUINT size) -> int override
+        {
+            const auto* bytes = static_cast<const asBYTE*>(raw_data);
+            _buf.insert(_buf.end(), bytes, bytes + size);
+            return 0;
+        }
+
+    private:
+        vector<asBYTE> _buf {};
+        size_t _readPos {};
+    };
+
+    thread_local nptr<vector<string>> AotNativeTrace {};
+
+    static void AotNative(asIScriptGeneric* gen)
+    {
+        const auto value = static_cast<int32_t>(gen->GetArgDWord(0));
+
+        if (AotNativeTrace) {
+            AotNativeTrace->emplace_back(strex("Native({})", value));
+        }
+
+        gen->SetReturnDWord(static_cast<asDWORD>(value * value - 1));
+    }
+
+    static void AotMessageCallback(const asSMessageInfo* msg, void* param)
+    {
+        ignore_unused(param);
+
+        if (msg->type == asMSGTYPE_ERROR) {
+            FAIL(msg->section << ':' << msg->row << ' ' << msg->message);
+        }
+    }
+
+    static void ReleaseAotEngine(ptr<asIScriptEngine> engine) noexcept
+    {
+        FO_NO_STACK_TRACE_ENTRY();
+
+        engine->ShutDownAndRelease();
+    }
+
+    static auto MakeAotEngine(nptr<AngelScriptAotCompiler> compiler) -> unique_del_ptr<asIScriptEngine>
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        auto engine = make_nptr(asCreateScriptEngine());
+        REQUIRE(engine);
+        auto engine_owner = take_not_null(make_unique_del_ptr(engine, ReleaseAotEngine));
+
+        CHECK(engine_owner->SetMessageCallback(asFUNCTION(AotMessageCallback), nullptr, asCALL_CDECL) >= 0);
+        CHECK(engine_owner->SetEngineProperty(asEP_INCLUDE_JIT_INSTRUCTIONS, 1) >= 0);
+        CHECK(engine_owner->RegisterGlobalFunction("int Native(int)", asFUNCTION(AotNative), asCALL_GENERIC) >= 0);
+
+        if (compiler) {
+            CHECK(engine_owner->SetJITCompiler(compiler.get()) >= 0);
+        }
+
+        return engine_owner;
+    }
+
+    static auto BuildAotSuite(ptr<asIScriptEngine> engine) -> ptr<asIScriptModule>
+    {
+        nptr<asIScriptModule> mod = engine->GetModule("AotSuite", asGM_ALWAYS_CREATE);
+        REQUIRE(mod);
+        CHECK(mod->AddScriptSection("AotSuite", AotSuiteScript.data(), AotSuiteScript.size()) >= 0);
+        REQUIRE(mod->Build() >= 0);
+        return mod;
+    }
+
+    static auto ReloadAotSuite(ptr<asIScriptEngine> engine, AotBytecodeStream& stream) -> ptr<asIScriptModule>
+    {
+        nptr<asIScriptModule> mod = engine->GetModule("AotSuite", asGM_ALWAYS_CREATE);
+        REQUIRE(mod);
+        REQUIRE(mod->LoadByteCode(&stream) >= 0);
+        return mod;
+    }
+
+    static auto DescribeAotCall(ptr<asIScriptContext> ctx, int result) -> string
+    {
+        if (result == asEXECUTION_FINISHED) {
+            return "";
+        }
+        if (result == asEXECUTION_EXCEPTION) {
+            return strex("exception '{}' at line {}", ctx->GetExceptionString(), ctx->GetExceptionLineNumber());
+        }
+
+        return strex("result {}", result);
+    }
+
+    static auto RunAotSuite(ptr<asIScriptModule> mod) -> vector<string>
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        vector<string> values;
+        AotNativeTrace = &values;
+        auto clear_trace = scope_exit([]() noexcept { AotNativeTrace = nullptr; });
+
+        nptr<asIScriptContext> ctx = mod->GetEngine()->CreateContext();
+        REQUIRE(ctx);
+        auto release_ctx = scope_exit([&]() noexcept { ctx->Release(); });
+
+        // Seeds include zero and negatives so the division guards and the unsigned conversions of negative values
+        // leave translated code through the same exceptions as the VM
+        constexpr array<int64_t, 9> int_seeds {1, 3, 5, 27, 40, 90, -1, -7, 0};
+        constexpr array<string_view, 12> int_functions {"Fibonacci", "Collatz", "Divide", "IntMin", "Bits", "Conversions", "Logic", "Globals", "Switches", "Calls", "Objects", "References"};
+
+        for (const auto name : int_functions) {
+            nptr<asIScriptFunction> func = mod->GetFunctionByDecl(strex("int64 Hot::{}(int64)", name).c_str());
+            REQUIRE(func);
+
+            for (const auto seed : int_seeds) {
+                CHECK(ctx->Prepare(func.get()) >= 0);
+                CHECK(ctx->SetArgQWord(0, static_cast<asQWORD>(seed)) >= 0);
+                const int result = ctx->Execute();
+                const auto outcome = DescribeAotCall(ctx, result);
+                values.emplace_back(strex("{}({}) = {}", name, seed, outcome.empty() ? strex("{}", static_cast<int64_t>(ctx->GetReturnQWord())).str() : outcome));
+            }
+        }
+
+        constexpr array<float64_t, 6> float_seeds {0.0, 1.5, -2.25, 3.0, 1e10, -0.0};
+        constexpr array<string_view, 2> float_functions {"Polynomial", "FloatMath"};
+
+        for (const auto name : float_functions) {
+            nptr<asIScriptFunction> func = mod->GetFunctionByDecl(strex("double Hot::{}(double)", name).c_str());
+            REQUIRE(func);
+
+            for (const auto seed : float_seeds) {
+                CHECK(ctx->Prepare(func.get()) >= 0);
+                CHECK(ctx->SetArgDouble(0, seed) >= 0);
+                const int result = ctx->Execute();
+                const auto outcome = DescribeAotCall(ctx, result);
+                // Compare bit patterns, translated floating point must not differ even in the sign of zero
+                values.emplace_back(strex("{}({}) = {}", name, seed, outcome.empty() ? strex("{}", std::bit_cast<uint64_t>(ctx->GetReturnDouble())).str() : outcome));
+            }
+        }
+
+        return values;
+    }
+
+    static auto RunAotSuite(bool translated, bool reload_bytecode) -> AotSuiteResult
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        AngelScriptAotCompiler compiler;
+        const nptr<AngelScriptAotCompiler> attach_compiler = translated ? &compiler : nullptr;
+        auto engine = MakeAotEngine(reload_bytecode ? nullptr : attach_compiler);
+        auto mod = BuildAotSuite(engine.get());
+
+        if (reload_bytecode) {
+            AotBytecodeStream stream;
+            CHECK(mod->SaveByteCode(&stream) >= 0);
+            engine = MakeAotEngine(attach_compiler);
+            mod = ReloadAotSuite(engine.get(), stream);
+        }
+
+        AotSuiteResult result;
+        result.Values = RunAotSuite(mod);
+        result.AttachedCount = compiler.GetAttachedCount();
+        result.StaleCount = compiler.GetStaleCount();
+        return result;
+    }
+
+    // The translation begins at the generated banner, the license and notes above it are hand-kept
+    constexpr string_view AOT_FIXTURE_TRANSLATION_BANNER = "// Generated by the AngelScript baker";
+
+    static auto GetAotFixturePath() -> std::filesystem::path
+    {
+        return std::filesystem::absolute(std::filesystem::path {__FILE__}).parent_path() / "Test_AngelScriptAotFixtures.h";
+    }
+
+    static auto ReadAotFixture(const std::filesystem::path& path) -> string
+    {
+        std::ifstream file {path, std::ios::binary};
+        REQUIRE(file.is_open());
+
+        string content {std::istreambuf_iterator<char> {file}, std::istreambuf_iterator<char> {}};
+        std::erase(content, '\r');
+        return content;
+    }
+
+    static auto TranslateAotSuite() -> string
+    {
+        auto engine = MakeAotEngine(nullptr);
+        auto mod = BuildAotSuite(engine.get());
+
+        return TranslateAngelScriptModule(mod, {"Hot"});
+    }
+}
+
+TEST_CASE("AngelScriptAot", "[angelscript][aot]")
+{
+    // 108 integer and 12 floating point results, plus one line for each of the 166 native calls
+    const auto interpreted = RunAotSuite(false, false);
+    REQUIRE(interpreted.Values.size() == 286);
+
+    // The fixture is translated from 64-bit bytecode, other pointer sizes hash differently and stay interpreted
+    constexpr bool fixture_applies = AS_PTR_SIZE == 2;
+
+    SECTION("TranslatedFunctionsMatchInterpreter")
+    {
+        const auto translated = RunAotSuite(true, false);
+
+        CHECK(translated.Values == interpreted.Values);
+
+        if constexpr (fixture_applies) {
+            CHECK(translated.AttachedCount == AotFunctions.size());
+            CHECK(translated.StaleCount == 0);
+        }
+    }
+
+    SECTION("TranslationsAttachToReloadedBytecode")
+    {
+        const auto translated = RunAotSuite(true, true);
+
+        CHECK(translated.Values == interpreted.Values);
+
+        if constexpr (fixture_applies) {
+            CHECK(translated.AttachedCount == AotFunctions.size());
+            CHECK(translated.StaleCount == 0);
+        }
+    }
+
+    SECTION("ChangedBytecodeStaysInterpreted")
+    {
+        AngelScriptAotCompiler compiler;
+        auto engine = MakeAotEngine(&compiler);
+
+        constexpr string_view changed_script = R"(
+namespace Hot
+{
+    int64 Fibonacci(int64 n)
+    {
+        return n * 2 + 1;
+    }
+}
+)";
+
+        nptr<asIScriptModule> mod = engine->GetModule("Changed", asGM_ALWAYS_CREATE);
+        REQUIRE(mod);
+        CHECK(mod->AddScriptSection("Changed", changed_script.data(), changed_script.size()) >= 0);
+        REQUIRE(mod->Build() >= 0);
+
+        nptr<asIScriptFunction> func = mod->GetFunctionByDecl("int64 Hot::Fibonacci(int64)");
+        REQUIRE(func);
+        nptr<asIScriptContext> ctx = engine->CreateContext();
+        REQUIRE(ctx);
+        CHECK(ctx->Prepare(func.get()) >= 0);
+        CHECK(ctx->SetArgQWord(0, 20) >= 0);
+        CHECK(ctx->Execute() == asEXECUTION_FINISHED);
+        CHECK(ctx->GetReturnQWord() == 41);
+        ctx->Release();
+
+        CHECK(compiler.GetAttachedCount() == 0);
+        CHECK(compiler.GetStaleCount() == 1);
+    }
+}
+
+TEST_CASE("AngelScriptAot fixture is up to date", "[angelscript][aot]")
+{
+    // The fixture is translated from 64-bit bytecode, other pointer sizes translate differently
+    if constexpr (AS_PTR_SIZE != 2) {
+        SKIP("The AOT fixture is generated from 64-bit bytecode");
+    }
+
+    const auto fixture_path = GetAotFixturePath();
+
+    if (!std::filesystem::exists(fixture_path)) {
+        SKIP("Test sources are not available next to the test binary");
+    }
+
+    const string fixture = ReadAotFixture(fixture_path);
+    const size_t banner_pos = fixture.find(AOT_FIXTURE_TRANSLATION_BANNER);
+    REQUIRE(banner_pos != string::npos);
+
+    // Refresh with the hidden `[.aot]` test when this fails after an engine or suite change
+    CHECK(string_view {fixture}.substr(banner_pos) == TranslateAotSuite());
+}
+
+// Rewrites the translation part of Test_AngelScriptAotFixtures.h in the source tree
+TEST_CASE("AngelScriptAot fixture translation", "[.aot]")
+{
+    const auto fixture_path = GetAotFixturePath();
+    const string fixture = ReadAotFixture(fixture_path);
+    const size_t banner_pos = fixture.find(AOT_FIXTURE_TRANSLATION_BANNER);
+    REQUIRE(banner_pos != string::npos);
+
+    const string translation = TranslateAotSuite();
+
+    {
+        std::ofstream file {fixture_path, std::ios::binary | std::ios::trunc};
+        REQUIRE(file.is_open());
+        file << string_view {fixture}.substr(0, banner_pos) << translation;
+        REQUIRE(file.good());
+    }
+
+    WriteLog("AOT fixture written to {}", fs_path_to_string(fixture_path));
+}
+
+#endif
+
+FO_END_NAMESPACE
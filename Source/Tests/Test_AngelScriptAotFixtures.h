@@ -0,0 +1,3521 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#pragma once
+
+// Translation of AotSuiteScript from Test_AngelScriptAot.cpp, rewritten below the generated banner by the hidden
+// `[.aot]` test of that file and compared against a fresh translation by its fixture test
+
+// Generated by the AngelScript baker from script bytecode, do not edit
+// Bytecode hashes tie every function to the exact build it was translated from
+
+#include "AngelScriptAot.h"
+
+#if FO_ANGELSCRIPT_SCRIPTING
+
+FO_BEGIN_NAMESPACE
+
+namespace
+{
+
+// int64 Hot::Fibonacci(int64)
+static void AotFunc0(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 4;
+        goto bc_7;
+    case 3:
+        l_base -= 13;
+        goto bc_16;
+    case 4:
+        l_base -= 22;
+        goto bc_25;
+    case 5:
+        l_base -= 26;
+        goto bc_29;
+    case 6:
+        l_base -= 37;
+        goto bc_40;
+    case 7:
+        l_base -= 41;
+        goto bc_44;
+    case 8:
+        l_base -= 45;
+        goto bc_48;
+    case 9:
+        l_base -= 53;
+        goto bc_56;
+    case 10:
+        l_base -= 59;
+        goto bc_62;
+    case 11:
+        l_base -= 65;
+        goto bc_68;
+    case 12:
+        l_base -= 71;
+        goto bc_74;
+    case 13:
+        l_base -= 79;
+        goto bc_82;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+
+bc_7:
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 4, 0ull);
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 2, AotVar<uint64_t>(l_fp, 4));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 12, l_sp, l_reg);
+        }
+    }
+
+bc_16:
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 4, 1ull);
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 6, AotVar<uint64_t>(l_fp, 4));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 21, l_sp, l_reg);
+        }
+    }
+
+bc_25:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 25, l_sp, l_reg);
+        }
+    }
+
+bc_29:
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 4, 0ull);
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 8, AotVar<uint64_t>(l_fp, 4));
+    }
+    { // JMP
+        goto bc_70;
+    }
+
+bc_36:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 36, l_sp, l_reg);
+        }
+    }
+
+bc_40:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 40, l_sp, l_reg);
+        }
+    }
+
+bc_44:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 44, l_sp, l_reg);
+        }
+    }
+
+bc_48:
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 2) + AotVar<uint64_t>(l_fp, 6));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 12, AotVar<uint64_t>(l_fp, 4));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 52, l_sp, l_reg);
+        }
+    }
+
+bc_56:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 2, AotVar<uint64_t>(l_fp, 6));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 58, l_sp, l_reg);
+        }
+    }
+
+bc_62:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 6, AotVar<uint64_t>(l_fp, 12));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 64, l_sp, l_reg);
+        }
+    }
+
+bc_68:
+    { // LDV
+        AotSetReg<AngelScript::asDWORD*>(l_reg, l_fp - 8);
+    }
+    { // INCi64
+        AotSetRef<uint64_t>(l_reg, static_cast<uint64_t>(AotRef<uint64_t>(l_reg) + 1ull));
+    }
+
+bc_70:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 70, l_sp, l_reg);
+        }
+    }
+
+bc_74:
+    { // CMPi64
+        AotSetReg<int32_t>(l_reg, AotCompare<int64_t>(AotVar<int64_t>(l_fp, 8), AotVar<int64_t>(l_fp, 0)));
+    }
+    { // JS
+        if (AotReg<int32_t>(l_reg) < 0) {
+            goto bc_36;
+        }
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 78, l_sp, l_reg);
+        }
+    }
+
+bc_82:
+    { // CpyVtoR8
+        l_reg = AotVar<uint64_t>(l_fp, 2);
+    }
+    { // RET
+        return AotLeave(regs, l_base + 83, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 13> AotEntries0 {0, 4, 13, 22, 26, 37, 41, 45, 53, 59, 65, 71, 79};
+
+// int64 Hot::Collatz(int64)
+static void AotFunc1(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 4;
+        goto bc_7;
+    case 3:
+        l_base -= 14;
+        goto bc_17;
+    case 4:
+        l_base -= 20;
+        goto bc_23;
+    case 5:
+        l_base -= 28;
+        goto bc_31;
+    case 6:
+        l_base -= 32;
+        goto bc_35;
+    case 7:
+        l_base -= 36;
+        goto bc_39;
+    case 8:
+        l_base -= 48;
+        goto bc_51;
+    case 9:
+        l_base -= 52;
+        goto bc_55;
+    case 10:
+        l_base -= 62;
+        goto bc_65;
+    case 11:
+        l_base -= 66;
+        goto bc_69;
+    case 12:
+        l_base -= 76;
+        goto bc_79;
+    case 13:
+        l_base -= 83;
+        goto bc_86;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+
+bc_7:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 0));
+    }
+    { // i64TOi
+        AotSetVar<int32_t>(l_fp, 5, static_cast<int32_t>(AotVar<int64_t>(l_fp, 4)));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 5));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 13, l_sp, l_reg);
+        }
+    }
+
+bc_17:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 6, 0u);
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 19, l_sp, l_reg);
+        }
+    }
+
+bc_23:
+    { // CMPIi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 1), 1));
+    }
+    { // JNP
+        if (AotReg<int32_t>(l_reg) <= 0) {
+            goto bc_82;
+        }
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 27, l_sp, l_reg);
+        }
+    }
+
+bc_31:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 31, l_sp, l_reg);
+        }
+    }
+
+bc_35:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 35, l_sp, l_reg);
+        }
+    }
+
+bc_39:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 5, 2u);
+    }
+    { // MODi
+        if (AotVar<int32_t>(l_fp, 5) == 0 || (AotVar<int32_t>(l_fp, 5) == -1 && AotVar<int32_t>(l_fp, 1) == std::numeric_limits<int32_t>::min())) {
+            return AotLeave(regs, l_base + 41, l_sp, l_reg);
+        }
+        AotSetVar<int32_t>(l_fp, 5, AotVar<int32_t>(l_fp, 1) % AotVar<int32_t>(l_fp, 5));
+    }
+    { // CMPIi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 5), 0));
+    }
+    { // JNZ
+        if (AotReg<int32_t>(l_reg) != 0) {
+            goto bc_61;
+        }
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 47, l_sp, l_reg);
+        }
+    }
+
+bc_51:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 51, l_sp, l_reg);
+        }
+    }
+
+bc_55:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 7, 2u);
+    }
+    { // DIVi
+        if (AotVar<int32_t>(l_fp, 7) == 0 || (AotVar<int32_t>(l_fp, 7) == -1 && AotVar<int32_t>(l_fp, 1) == std::numeric_limits<int32_t>::min())) {
+            return AotLeave(regs, l_base + 57, l_sp, l_reg);
+        }
+        AotSetVar<int32_t>(l_fp, 1, AotVar<int32_t>(l_fp, 1) / AotVar<int32_t>(l_fp, 7));
+    }
+    { // JMP
+        goto bc_75;
+    }
+
+bc_61:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 61, l_sp, l_reg);
+        }
+    }
+
+bc_65:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 65, l_sp, l_reg);
+        }
+    }
+
+bc_69:
+    { // MULIi
+        AotSetVar<uint32_t>(l_fp, 5, AotVar<uint32_t>(l_fp, 1) * 3u);
+    }
+    { // ADDIi
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 5) + 1u);
+    }
+
+bc_75:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 75, l_sp, l_reg);
+        }
+    }
+
+bc_79:
+    { // IncVi
+        AotSetVar<uint32_t>(l_fp, 6, AotVar<uint32_t>(l_fp, 6) + 1u);
+    }
+    { // JMP
+        goto bc_23;
+    }
+
+bc_82:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 82, l_sp, l_reg);
+        }
+    }
+
+bc_86:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 7, AotVar<uint32_t>(l_fp, 6));
+    }
+    { // iTOi64
+        AotSetVar<int64_t>(l_fp, 4, static_cast<int64_t>(AotVar<int32_t>(l_fp, 7)));
+    }
+    { // CpyVtoR8
+        l_reg = AotVar<uint64_t>(l_fp, 4);
+    }
+    { // RET
+        return AotLeave(regs, l_base + 91, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 13> AotEntries1 {0, 4, 14, 20, 28, 32, 36, 48, 52, 62, 66, 76, 83};
+
+// int64 Hot::Divide(int64)
+static void AotFunc2(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 4;
+        goto bc_7;
+    case 3:
+        l_base -= 15;
+        goto bc_18;
+    case 4:
+        l_base -= 26;
+        goto bc_29;
+    case 5:
+        l_base -= 32;
+        goto bc_35;
+    case 6:
+        l_base -= 38;
+        goto bc_41;
+    case 7:
+        l_base -= 49;
+        goto bc_52;
+    case 8:
+        l_base -= 60;
+        goto bc_63;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+
+bc_7:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 0));
+    }
+    { // i64TOi
+        AotSetVar<int32_t>(l_fp, 5, static_cast<int32_t>(AotVar<int64_t>(l_fp, 4)));
+    }
+    { // MULIi
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 5) * 7u);
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 14, l_sp, l_reg);
+        }
+    }
+
+bc_18:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 0));
+    }
+    { // i64TOi
+        AotSetVar<int32_t>(l_fp, 5, static_cast<int32_t>(AotVar<int64_t>(l_fp, 4)));
+    }
+    { // SUBIi
+        AotSetVar<uint32_t>(l_fp, 7, AotVar<uint32_t>(l_fp, 5) - 3u);
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 25, l_sp, l_reg);
+        }
+    }
+
+bc_29:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 8, AotVar<uint32_t>(l_fp, 1));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 31, l_sp, l_reg);
+        }
+    }
+
+bc_35:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 9, AotVar<uint32_t>(l_fp, 7));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 37, l_sp, l_reg);
+        }
+    }
+
+bc_41:
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 4, 1000003ull);
+    }
+    { // MULi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 0) * AotVar<uint64_t>(l_fp, 4));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 12, AotVar<uint64_t>(l_fp, 4));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 48, l_sp, l_reg);
+        }
+    }
+
+bc_52:
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 4, 5ull);
+    }
+    { // SUBi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 0) - AotVar<uint64_t>(l_fp, 4));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 14, AotVar<uint64_t>(l_fp, 4));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 59, l_sp, l_reg);
+        }
+    }
+
+bc_63:
+    { // DIVi
+        if (AotVar<int32_t>(l_fp, 7) == 0 || (AotVar<int32_t>(l_fp, 7) == -1 && AotVar<int32_t>(l_fp, 1) == std::numeric_limits<int32_t>::min())) {
+            return AotLeave(regs, l_base + 63, l_sp, l_reg);
+        }
+        AotSetVar<int32_t>(l_fp, 5, AotVar<int32_t>(l_fp, 1) / AotVar<int32_t>(l_fp, 7));
+    }
+    { // MODi
+        if (AotVar<int32_t>(l_fp, 7) == 0 || (AotVar<int32_t>(l_fp, 7) == -1 && AotVar<int32_t>(l_fp, 1) == std::numeric_limits<int32_t>::min())) {
+            return AotLeave(regs, l_base + 65, l_sp, l_reg);
+        }
+        AotSetVar<int32_t>(l_fp, 6, AotVar<int32_t>(l_fp, 1) % AotVar<int32_t>(l_fp, 7));
+    }
+    { // ADDi
+        AotSetVar<uint32_t>(l_fp, 5, AotVar<uint32_t>(l_fp, 5) + AotVar<uint32_t>(l_fp, 6));
+    }
+    { // iTOi64
+        AotSetVar<int64_t>(l_fp, 16, static_cast<int64_t>(AotVar<int32_t>(l_fp, 5)));
+    }
+    { // DIVu
+        if (AotVar<uint32_t>(l_fp, 9) == 0) {
+            return AotLeave(regs, l_base + 71, l_sp, l_reg);
+        }
+        AotSetVar<uint32_t>(l_fp, 6, AotVar<uint32_t>(l_fp, 8) / AotVar<uint32_t>(l_fp, 9));
+    }
+    { // uTOi64
+        AotSetVar<int64_t>(l_fp, 4, static_cast<int64_t>(AotVar<uint32_t>(l_fp, 6)));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 16, AotVar<uint64_t>(l_fp, 16) + AotVar<uint64_t>(l_fp, 4));
+    }
+    { // MODu
+        if (AotVar<uint32_t>(l_fp, 9) == 0) {
+            return AotLeave(regs, l_base + 77, l_sp, l_reg);
+        }
+        AotSetVar<uint32_t>(l_fp, 6, AotVar<uint32_t>(l_fp, 8) % AotVar<uint32_t>(l_fp, 9));
+    }
+    { // uTOi64
+        AotSetVar<int64_t>(l_fp, 4, static_cast<int64_t>(AotVar<uint32_t>(l_fp, 6)));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 16, AotVar<uint64_t>(l_fp, 16) + AotVar<uint64_t>(l_fp, 4));
+    }
+    { // DIVi64
+        if (AotVar<int64_t>(l_fp, 14) == 0 || (AotVar<int64_t>(l_fp, 14) == -1 && AotVar<int64_t>(l_fp, 12) == std::numeric_limits<int64_t>::min())) {
+            return AotLeave(regs, l_base + 83, l_sp, l_reg);
+        }
+        AotSetVar<int64_t>(l_fp, 4, AotVar<int64_t>(l_fp, 12) / AotVar<int64_t>(l_fp, 14));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 16, AotVar<uint64_t>(l_fp, 16) + AotVar<uint64_t>(l_fp, 4));
+    }
+    { // MODi64
+        if (AotVar<int64_t>(l_fp, 14) == 0 || (AotVar<int64_t>(l_fp, 14) == -1 && AotVar<int64_t>(l_fp, 12) == std::numeric_limits<int64_t>::min())) {
+            return AotLeave(regs, l_base + 87, l_sp, l_reg);
+        }
+        AotSetVar<int64_t>(l_fp, 4, AotVar<int64_t>(l_fp, 12) % AotVar<int64_t>(l_fp, 14));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 16, AotVar<uint64_t>(l_fp, 16) + AotVar<uint64_t>(l_fp, 4));
+    }
+    { // CpyVtoR8
+        l_reg = AotVar<uint64_t>(l_fp, 16);
+    }
+    { // RET
+        return AotLeave(regs, l_base + 92, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 8> AotEntries2 {0, 4, 15, 26, 32, 38, 49, 60};
+
+// int64 Hot::IntMin(int64)
+static void AotFunc3(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 4;
+        goto bc_7;
+    case 3:
+        l_base -= 10;
+        goto bc_13;
+    case 4:
+        l_base -= 20;
+        goto bc_23;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+
+bc_7:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 1, 2147483648u);
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 9, l_sp, l_reg);
+        }
+    }
+
+bc_13:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 6, AotVar<uint64_t>(l_fp, 0));
+    }
+    { // i64TOi
+        AotSetVar<int32_t>(l_fp, 2, static_cast<int32_t>(AotVar<int64_t>(l_fp, 6)));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 3, AotVar<uint32_t>(l_fp, 2));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 19, l_sp, l_reg);
+        }
+    }
+
+bc_23:
+    { // DIVi
+        if (AotVar<int32_t>(l_fp, 3) == 0 || (AotVar<int32_t>(l_fp, 3) == -1 && AotVar<int32_t>(l_fp, 1) == std::numeric_limits<int32_t>::min())) {
+            return AotLeave(regs, l_base + 23, l_sp, l_reg);
+        }
+        AotSetVar<int32_t>(l_fp, 2, AotVar<int32_t>(l_fp, 1) / AotVar<int32_t>(l_fp, 3));
+    }
+    { // iTOi64
+        AotSetVar<int64_t>(l_fp, 6, static_cast<int64_t>(AotVar<int32_t>(l_fp, 2)));
+    }
+    { // CpyVtoR8
+        l_reg = AotVar<uint64_t>(l_fp, 6);
+    }
+    { // RET
+        return AotLeave(regs, l_base + 28, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 4> AotEntries3 {0, 4, 10, 20};
+
+// int64 Hot::Bits(int64)
+static void AotFunc4(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 4;
+        goto bc_7;
+    case 3:
+        l_base -= 15;
+        goto bc_18;
+    case 4:
+        l_base -= 19;
+        goto bc_22;
+    case 5:
+        l_base -= 27;
+        goto bc_30;
+    case 6:
+        l_base -= 31;
+        goto bc_34;
+    case 7:
+        l_base -= 35;
+        goto bc_38;
+    case 8:
+        l_base -= 45;
+        goto bc_48;
+    case 9:
+        l_base -= 55;
+        goto bc_58;
+    case 10:
+        l_base -= 65;
+        goto bc_68;
+    case 11:
+        l_base -= 70;
+        goto bc_73;
+    case 12:
+        l_base -= 78;
+        goto bc_81;
+    case 13:
+        l_base -= 84;
+        goto bc_87;
+    case 14:
+        l_base -= 95;
+        goto bc_98;
+    case 15:
+        l_base -= 101;
+        goto bc_104;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+
+bc_7:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 0));
+    }
+    { // i64TOi
+        AotSetVar<int32_t>(l_fp, 5, static_cast<int32_t>(AotVar<int64_t>(l_fp, 4)));
+    }
+    { // ADDIi
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 5) + 2654435769u);
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 14, l_sp, l_reg);
+        }
+    }
+
+bc_18:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 18, l_sp, l_reg);
+        }
+    }
+
+bc_22:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 7, 0u);
+    }
+    { // JMP
+        goto bc_69;
+    }
+
+bc_26:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 26, l_sp, l_reg);
+        }
+    }
+
+bc_30:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 30, l_sp, l_reg);
+        }
+    }
+
+bc_34:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 34, l_sp, l_reg);
+        }
+    }
+
+bc_38:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 6, 13u);
+    }
+    { // BSLL
+        AotSetVar<uint32_t>(l_fp, 5, AotVar<uint32_t>(l_fp, 1) << AotVar<uint32_t>(l_fp, 6));
+    }
+    { // BXOR
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 1) ^ AotVar<uint32_t>(l_fp, 5));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 44, l_sp, l_reg);
+        }
+    }
+
+bc_48:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 5, 17u);
+    }
+    { // BSRL
+        AotSetVar<uint32_t>(l_fp, 6, AotVar<uint32_t>(l_fp, 1) >> AotVar<uint32_t>(l_fp, 5));
+    }
+    { // BXOR
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 1) ^ AotVar<uint32_t>(l_fp, 6));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 54, l_sp, l_reg);
+        }
+    }
+
+bc_58:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 6, 5u);
+    }
+    { // BSLL
+        AotSetVar<uint32_t>(l_fp, 5, AotVar<uint32_t>(l_fp, 1) << AotVar<uint32_t>(l_fp, 6));
+    }
+    { // BXOR
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 1) ^ AotVar<uint32_t>(l_fp, 5));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 64, l_sp, l_reg);
+        }
+    }
+
+bc_68:
+    { // IncVi
+        AotSetVar<uint32_t>(l_fp, 7, AotVar<uint32_t>(l_fp, 7) + 1u);
+    }
+
+bc_69:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 69, l_sp, l_reg);
+        }
+    }
+
+bc_73:
+    { // CMPIi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 7), 16));
+    }
+    { // JS
+        if (AotReg<int32_t>(l_reg) < 0) {
+            goto bc_26;
+        }
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 77, l_sp, l_reg);
+        }
+    }
+
+bc_81:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 7, AotVar<uint32_t>(l_fp, 1));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 83, l_sp, l_reg);
+        }
+    }
+
+bc_87:
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 4, 305419896ull);
+    }
+    { // MULi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 0) * AotVar<uint64_t>(l_fp, 4));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 10, AotVar<uint64_t>(l_fp, 4));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 94, l_sp, l_reg);
+        }
+    }
+
+bc_98:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 12, AotVar<uint64_t>(l_fp, 10));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 100, l_sp, l_reg);
+        }
+    }
+
+bc_104:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 6, 65535u);
+    }
+    { // BAND
+        AotSetVar<uint32_t>(l_fp, 5, AotVar<uint32_t>(l_fp, 1) & AotVar<uint32_t>(l_fp, 6));
+    }
+    { // uTOi64
+        AotSetVar<int64_t>(l_fp, 4, static_cast<int64_t>(AotVar<uint32_t>(l_fp, 5)));
+    }
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 5, 3u);
+    }
+    { // BSRL
+        AotSetVar<uint32_t>(l_fp, 6, AotVar<uint32_t>(l_fp, 7) >> AotVar<uint32_t>(l_fp, 5));
+    }
+    { // iTOi64
+        AotSetVar<int64_t>(l_fp, 14, static_cast<int64_t>(AotVar<int32_t>(l_fp, 6)));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 4) + AotVar<uint64_t>(l_fp, 14));
+    }
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 5, 5u);
+    }
+    { // BSRL64
+        AotSetVar<uint64_t>(l_fp, 14, AotVar<uint64_t>(l_fp, 10) >> AotVar<uint32_t>(l_fp, 5));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 4) + AotVar<uint64_t>(l_fp, 14));
+    }
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 5, 7u);
+    }
+    { // BSRL64
+        AotSetVar<uint64_t>(l_fp, 14, AotVar<uint64_t>(l_fp, 12) >> AotVar<uint32_t>(l_fp, 5));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 4) + AotVar<uint64_t>(l_fp, 14));
+    }
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 5, 2u);
+    }
+    { // BSLL64
+        AotSetVar<uint64_t>(l_fp, 14, AotVar<uint64_t>(l_fp, 10) << AotVar<uint32_t>(l_fp, 5));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 4) + AotVar<uint64_t>(l_fp, 14));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 5, AotVar<uint32_t>(l_fp, 1));
+    }
+    { // BNOT
+        AotSetVar<uint32_t>(l_fp, 5, ~AotVar<uint32_t>(l_fp, 5));
+    }
+    { // uTOi64
+        AotSetVar<int64_t>(l_fp, 14, static_cast<int64_t>(AotVar<uint32_t>(l_fp, 5)));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 4) + AotVar<uint64_t>(l_fp, 14));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 14, AotVar<uint64_t>(l_fp, 12));
+    }
+    { // BNOT64
+        AotSetVar<uint64_t>(l_fp, 14, ~AotVar<uint64_t>(l_fp, 14));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 4) + AotVar<uint64_t>(l_fp, 14));
+    }
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 5, 3u);
+    }
+    { // BOR
+        AotSetVar<uint32_t>(l_fp, 6, AotVar<uint32_t>(l_fp, 1) | AotVar<uint32_t>(l_fp, 5));
+    }
+    { // uTOi64
+        AotSetVar<int64_t>(l_fp, 14, static_cast<int64_t>(AotVar<uint32_t>(l_fp, 6)));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 4) + AotVar<uint64_t>(l_fp, 14));
+    }
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 14, 85ull);
+    }
+    { // BXOR64
+        AotSetVar<uint64_t>(l_fp, 14, AotVar<uint64_t>(l_fp, 10) ^ AotVar<uint64_t>(l_fp, 14));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 4) + AotVar<uint64_t>(l_fp, 14));
+    }
+    { // CpyVtoR8
+        l_reg = AotVar<uint64_t>(l_fp, 4);
+    }
+    { // RET
+        return AotLeave(regs, l_base + 164, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 15> AotEntries4 {0, 4, 15, 19, 27, 31, 35, 45, 55, 65, 70, 78, 84, 95, 101};
+
+// int64 Hot::Conversions(int64)
+static void AotFunc5(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 4;
+        goto bc_7;
+    case 3:
+        l_base -= 23;
+        goto bc_26;
+    case 4:
+        l_base -= 33;
+        goto bc_36;
+    case 5:
+        l_base -= 42;
+        goto bc_45;
+    case 6:
+        l_base -= 54;
+        goto bc_57;
+    case 7:
+        l_base -= 78;
+        goto bc_81;
+    case 8:
+        l_base -= 101;
+        goto bc_104;
+    case 9:
+        l_base -= 110;
+        goto bc_113;
+    case 10:
+        l_base -= 119;
+        goto bc_122;
+    case 11:
+        l_base -= 130;
+        goto bc_133;
+    case 12:
+        l_base -= 141;
+        goto bc_144;
+    case 13:
+        l_base -= 177;
+        goto bc_180;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+
+bc_7:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 0));
+    }
+    { // i64TOd
+        AotSetVar<float64_t>(l_fp, 4, static_cast<float64_t>(AotVar<int64_t>(l_fp, 4)));
+    }
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 6, 4610560118520545281ull);
+    }
+    { // MULd
+        AotSetVar<float64_t>(l_fp, 4, AotVar<float64_t>(l_fp, 4) * AotVar<float64_t>(l_fp, 6));
+    }
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 8, 4614500768194494464ull);
+    }
+    { // SUBd
+        AotSetVar<float64_t>(l_fp, 6, AotVar<float64_t>(l_fp, 4) - AotVar<float64_t>(l_fp, 8));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 2, AotVar<uint64_t>(l_fp, 6));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 22, l_sp, l_reg);
+        }
+    }
+
+bc_26:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 8, AotVar<uint64_t>(l_fp, 2));
+    }
+    { // dTOf
+        AotSetVar<float32_t>(l_fp, 10, static_cast<float32_t>(AotVar<float64_t>(l_fp, 8)));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 9, AotVar<uint32_t>(l_fp, 10));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 32, l_sp, l_reg);
+        }
+    }
+
+bc_36:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 10, AotVar<uint32_t>(l_fp, 9));
+    }
+    { // fTOi
+        AotSetVar<int32_t>(l_fp, 10, static_cast<int32_t>(AotVar<float32_t>(l_fp, 10)));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 11, AotVar<uint32_t>(l_fp, 10));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 41, l_sp, l_reg);
+        }
+    }
+
+bc_45:
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 6, 4652007308841189376ull);
+    }
+    { // MULd
+        AotSetVar<float64_t>(l_fp, 4, AotVar<float64_t>(l_fp, 2) * AotVar<float64_t>(l_fp, 6));
+    }
+    { // dTOi64
+        AotSetVar<int64_t>(l_fp, 4, static_cast<int64_t>(AotVar<float64_t>(l_fp, 4)));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 14, AotVar<uint64_t>(l_fp, 4));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 53, l_sp, l_reg);
+        }
+    }
+
+bc_57:
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 6, 0ull);
+    }
+    { // CMPd
+        AotSetReg<int32_t>(l_reg, AotCompare<float64_t>(AotVar<float64_t>(l_fp, 2), AotVar<float64_t>(l_fp, 6)));
+    }
+    { // JNS
+        if (AotReg<int32_t>(l_reg) >= 0) {
+            goto bc_71;
+        }
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 6, AotVar<uint64_t>(l_fp, 2));
+    }
+    { // NEGd
+        AotSetVar<float64_t>(l_fp, 6, -AotVar<float64_t>(l_fp, 6));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 8, AotVar<uint64_t>(l_fp, 6));
+    }
+    { // JMP
+        goto bc_73;
+    }
+
+bc_71:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 8, AotVar<uint64_t>(l_fp, 2));
+    }
+
+bc_73:
+    { // dTOu
+        AotSetVar<uint32_t>(l_fp, 10, AotToUnsigned<uint32_t, int32_t>(AotVar<float64_t>(l_fp, 8)));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 15, AotVar<uint32_t>(l_fp, 10));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 77, l_sp, l_reg);
+        }
+    }
+
+bc_81:
+    { // CMPIf
+        AotSetReg<int32_t>(l_reg, AotCompare<float32_t>(AotVar<float32_t>(l_fp, 9), std::bit_cast<float32_t>(0u)));
+    }
+    { // JNS
+        if (AotReg<int32_t>(l_reg) >= 0) {
+            goto bc_93;
+        }
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 19, AotVar<uint32_t>(l_fp, 9));
+    }
+    { // NEGf
+        AotSetVar<float32_t>(l_fp, 19, -AotVar<float32_t>(l_fp, 19));
+    }
+    { // MULIf
+        AotSetVar<float32_t>(l_fp, 21, AotVar<float32_t>(l_fp, 19) * std::bit_cast<float32_t>(1092616192u));
+    }
+    { // JMP
+        goto bc_96;
+    }
+
+bc_93:
+    { // MULIf
+        AotSetVar<float32_t>(l_fp, 21, AotVar<float32_t>(l_fp, 9) * std::bit_cast<float32_t>(1092616192u));
+    }
+
+bc_96:
+    { // fTOu64
+        AotSetVar<uint64_t>(l_fp, 4, AotToUnsigned<uint64_t, int64_t>(AotVar<float32_t>(l_fp, 21)));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 18, AotVar<uint64_t>(l_fp, 4));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 100, l_sp, l_reg);
+        }
+    }
+
+bc_104:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 21, AotVar<uint32_t>(l_fp, 11));
+    }
+    { // iTOb
+        AotSetVarLow<uint8_t>(l_fp, 21, static_cast<uint8_t>(AotVar<uint32_t>(l_fp, 21)));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 22, AotVar<uint32_t>(l_fp, 21));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 109, l_sp, l_reg);
+        }
+    }
+
+bc_113:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 10, AotVar<uint32_t>(l_fp, 11));
+    }
+    { // iTOb
+        AotSetVarLow<uint8_t>(l_fp, 10, static_cast<uint8_t>(AotVar<uint32_t>(l_fp, 10)));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 23, AotVar<uint32_t>(l_fp, 10));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 118, l_sp, l_reg);
+        }
+    }
+
+bc_122:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 14));
+    }
+    { // i64TOi
+        AotSetVar<int32_t>(l_fp, 10, static_cast<int32_t>(AotVar<int64_t>(l_fp, 4)));
+    }
+    { // iTOw
+        AotSetVarLow<uint16_t>(l_fp, 10, static_cast<uint16_t>(AotVar<uint32_t>(l_fp, 10)));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 24, AotVar<uint32_t>(l_fp, 10));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 129, l_sp, l_reg);
+        }
+    }
+
+bc_133:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 14));
+    }
+    { // i64TOi
+        AotSetVar<int32_t>(l_fp, 10, static_cast<int32_t>(AotVar<int64_t>(l_fp, 4)));
+    }
+    { // iTOw
+        AotSetVarLow<uint16_t>(l_fp, 10, static_cast<uint16_t>(AotVar<uint32_t>(l_fp, 10)));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 25, AotVar<uint32_t>(l_fp, 10));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 140, l_sp, l_reg);
+        }
+    }
+
+bc_144:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 14));
+    }
+    { // i64TOd
+        AotSetVar<float64_t>(l_fp, 4, static_cast<float64_t>(AotVar<int64_t>(l_fp, 4)));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 8, AotVar<uint64_t>(l_fp, 18));
+    }
+    { // u64TOd
+        AotSetVar<float64_t>(l_fp, 8, static_cast<float64_t>(AotVar<uint64_t>(l_fp, 8)));
+    }
+    { // ADDd
+        AotSetVar<float64_t>(l_fp, 6, AotVar<float64_t>(l_fp, 4) + AotVar<float64_t>(l_fp, 8));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 10, AotVar<uint32_t>(l_fp, 15));
+    }
+    { // uTOd
+        AotSetVar<float64_t>(l_fp, 4, static_cast<float64_t>(AotVar<uint32_t>(l_fp, 10)));
+    }
+    { // ADDd
+        AotSetVar<float64_t>(l_fp, 8, AotVar<float64_t>(l_fp, 6) + AotVar<float64_t>(l_fp, 4));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 14));
+    }
+    { // i64TOf
+        AotSetVar<float32_t>(l_fp, 10, static_cast<float32_t>(AotVar<int64_t>(l_fp, 4)));
+    }
+    { // fTOd
+        AotSetVar<float64_t>(l_fp, 30, static_cast<float64_t>(AotVar<float32_t>(l_fp, 10)));
+    }
+    { // ADDd
+        AotSetVar<float64_t>(l_fp, 4, AotVar<float64_t>(l_fp, 8) + AotVar<float64_t>(l_fp, 30));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 30, AotVar<uint64_t>(l_fp, 18));
+    }
+    { // u64TOf
+        AotSetVar<float32_t>(l_fp, 20, static_cast<float32_t>(AotVar<uint64_t>(l_fp, 30)));
+    }
+    { // fTOd
+        AotSetVar<float64_t>(l_fp, 32, static_cast<float64_t>(AotVar<float32_t>(l_fp, 20)));
+    }
+    { // ADDd
+        AotSetVar<float64_t>(l_fp, 8, AotVar<float64_t>(l_fp, 4) + AotVar<float64_t>(l_fp, 32));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 28, AotVar<uint64_t>(l_fp, 8));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 176, l_sp, l_reg);
+        }
+    }
+
+bc_180:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 19, AotVar<uint32_t>(l_fp, 11));
+    }
+    { // iTOi64
+        AotSetVar<int64_t>(l_fp, 30, static_cast<int64_t>(AotVar<int32_t>(l_fp, 19)));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 21, AotVar<uint32_t>(l_fp, 15));
+    }
+    { // uTOi64
+        AotSetVar<int64_t>(l_fp, 32, static_cast<int64_t>(AotVar<uint32_t>(l_fp, 21)));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 6, AotVar<uint64_t>(l_fp, 30) + AotVar<uint64_t>(l_fp, 32));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 32, AotVar<uint64_t>(l_fp, 6) + AotVar<uint64_t>(l_fp, 14));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 6, AotVar<uint64_t>(l_fp, 32) + AotVar<uint64_t>(l_fp, 18));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 10, AotVar<uint32_t>(l_fp, 22));
+    }
+    { // ubTOi
+        AotSetVar<uint32_t>(l_fp, 10, static_cast<uint32_t>(AotVar<uint8_t>(l_fp, 10)));
+    }
+    { // uTOi64
+        AotSetVar<int64_t>(l_fp, 8, static_cast<int64_t>(AotVar<uint32_t>(l_fp, 10)));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 32, AotVar<uint64_t>(l_fp, 6) + AotVar<uint64_t>(l_fp, 8));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 20, AotVar<uint32_t>(l_fp, 23));
+    }
+    { // sbTOi
+        AotSetVar<int32_t>(l_fp, 20, static_cast<int32_t>(AotVar<int8_t>(l_fp, 20)));
+    }
+    { // iTOi64
+        AotSetVar<int64_t>(l_fp, 4, static_cast<int64_t>(AotVar<int32_t>(l_fp, 20)));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 8, AotVar<uint64_t>(l_fp, 32) + AotVar<uint64_t>(l_fp, 4));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 33, AotVar<uint32_t>(l_fp, 24));
+    }
+    { // swTOi
+        AotSetVar<int32_t>(l_fp, 33, static_cast<int32_t>(AotVar<int16_t>(l_fp, 33)));
+    }
+    { // iTOi64
+        AotSetVar<int64_t>(l_fp, 36, static_cast<int64_t>(AotVar<int32_t>(l_fp, 33)));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 8) + AotVar<uint64_t>(l_fp, 36));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 37, AotVar<uint32_t>(l_fp, 25));
+    }
+    { // uwTOi
+        AotSetVar<uint32_t>(l_fp, 37, static_cast<uint32_t>(AotVar<uint16_t>(l_fp, 37)));
+    }
+    { // uTOi64
+        AotSetVar<int64_t>(l_fp, 40, static_cast<int64_t>(AotVar<uint32_t>(l_fp, 37)));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 36, AotVar<uint64_t>(l_fp, 4) + AotVar<uint64_t>(l_fp, 40));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 40, AotVar<uint64_t>(l_fp, 28));
+    }
+    { // dTOi64
+        AotSetVar<int64_t>(l_fp, 40, static_cast<int64_t>(AotVar<float64_t>(l_fp, 40)));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 36) + AotVar<uint64_t>(l_fp, 40));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 21, AotVar<uint32_t>(l_fp, 9));
+    }
+    { // fTOu
+        AotSetVar<uint32_t>(l_fp, 21, AotToUnsigned<uint32_t, int32_t>(AotVar<float32_t>(l_fp, 21)));
+    }
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 19, 65535u);
+    }
+    { // BAND
+        AotSetVar<uint32_t>(l_fp, 37, AotVar<uint32_t>(l_fp, 21) & AotVar<uint32_t>(l_fp, 19));
+    }
+    { // uTOi64
+        AotSetVar<int64_t>(l_fp, 36, static_cast<int64_t>(AotVar<uint32_t>(l_fp, 37)));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 40, AotVar<uint64_t>(l_fp, 4) + AotVar<uint64_t>(l_fp, 36));
+    }
+    { // CpyVtoR8
+        l_reg = AotVar<uint64_t>(l_fp, 40);
+    }
+    { // RET
+        return AotLeave(regs, l_base + 239, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 13> AotEntries5 {0, 4, 23, 33, 42, 54, 78, 101, 110, 119, 130, 141, 177};
+
+// double Hot::Polynomial(double)
+static void AotFunc6(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 4;
+        goto bc_7;
+    case 3:
+        l_base -= 13;
+        goto bc_16;
+    case 4:
+        l_base -= 17;
+        goto bc_20;
+    case 5:
+        l_base -= 25;
+        goto bc_28;
+    case 6:
+        l_base -= 29;
+        goto bc_32;
+    case 7:
+        l_base -= 33;
+        goto bc_36;
+    case 8:
+        l_base -= 52;
+        goto bc_55;
+    case 9:
+        l_base -= 57;
+        goto bc_60;
+    case 10:
+        l_base -= 65;
+        goto bc_68;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+
+bc_7:
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 4, 0ull);
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 2, AotVar<uint64_t>(l_fp, 4));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 12, l_sp, l_reg);
+        }
+    }
+
+bc_16:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 16, l_sp, l_reg);
+        }
+    }
+
+bc_20:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 5, 0u);
+    }
+    { // JMP
+        goto bc_56;
+    }
+
+bc_24:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 24, l_sp, l_reg);
+        }
+    }
+
+bc_28:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 28, l_sp, l_reg);
+        }
+    }
+
+bc_32:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 32, l_sp, l_reg);
+        }
+    }
+
+bc_36:
+    { // MULd
+        AotSetVar<float64_t>(l_fp, 4, AotVar<float64_t>(l_fp, 2) * AotVar<float64_t>(l_fp, 0));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 6, AotVar<uint32_t>(l_fp, 5));
+    }
+    { // iTOd
+        AotSetVar<float64_t>(l_fp, 8, static_cast<float64_t>(AotVar<int32_t>(l_fp, 6)));
+    }
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 10, 4602678819172646912ull);
+    }
+    { // MULd
+        AotSetVar<float64_t>(l_fp, 8, AotVar<float64_t>(l_fp, 8) * AotVar<float64_t>(l_fp, 10));
+    }
+    { // ADDd
+        AotSetVar<float64_t>(l_fp, 10, AotVar<float64_t>(l_fp, 4) + AotVar<float64_t>(l_fp, 8));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 2, AotVar<uint64_t>(l_fp, 10));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 51, l_sp, l_reg);
+        }
+    }
+
+bc_55:
+    { // IncVi
+        AotSetVar<uint32_t>(l_fp, 5, AotVar<uint32_t>(l_fp, 5) + 1u);
+    }
+
+bc_56:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 56, l_sp, l_reg);
+        }
+    }
+
+bc_60:
+    { // CMPIi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 5), 10));
+    }
+    { // JS
+        if (AotReg<int32_t>(l_reg) < 0) {
+            goto bc_24;
+        }
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 64, l_sp, l_reg);
+        }
+    }
+
+bc_68:
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 8, 4613937818241073152ull);
+    }
+    { // DIVd
+        if (AotVar<float64_t>(l_fp, 8) == 0) {
+            return AotLeave(regs, l_base + 71, l_sp, l_reg);
+        }
+        AotSetVar<float64_t>(l_fp, 4, AotVar<float64_t>(l_fp, 0) / AotVar<float64_t>(l_fp, 8));
+    }
+    { // SUBd
+        AotSetVar<float64_t>(l_fp, 8, AotVar<float64_t>(l_fp, 2) - AotVar<float64_t>(l_fp, 4));
+    }
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 4, 4620130267728707584ull);
+    }
+    { // MODd
+        if (AotVar<float64_t>(l_fp, 4) == 0) {
+            return AotLeave(regs, l_base + 78, l_sp, l_reg);
+        }
+        AotSetVar<float64_t>(l_fp, 10, std::fmod(AotVar<float64_t>(l_fp, 2), AotVar<float64_t>(l_fp, 4)));
+    }
+    { // ADDd
+        AotSetVar<float64_t>(l_fp, 4, AotVar<float64_t>(l_fp, 8) + AotVar<float64_t>(l_fp, 10));
+    }
+    { // CpyVtoR8
+        l_reg = AotVar<uint64_t>(l_fp, 4);
+    }
+    { // RET
+        return AotLeave(regs, l_base + 83, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 10> AotEntries6 {0, 4, 13, 17, 25, 29, 33, 52, 57, 65};
+
+// double Hot::FloatMath(double)
+static void AotFunc7(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 4;
+        goto bc_7;
+    case 3:
+        l_base -= 14;
+        goto bc_17;
+    case 4:
+        l_base -= 24;
+        goto bc_27;
+    case 5:
+        l_base -= 33;
+        goto bc_36;
+    case 6:
+        l_base -= 40;
+        goto bc_43;
+    case 7:
+        l_base -= 47;
+        goto bc_50;
+    case 8:
+        l_base -= 54;
+        goto bc_57;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+
+bc_7:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 0));
+    }
+    { // dTOf
+        AotSetVar<float32_t>(l_fp, 5, static_cast<float32_t>(AotVar<float64_t>(l_fp, 4)));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 5));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 13, l_sp, l_reg);
+        }
+    }
+
+bc_17:
+    { // MULIf
+        AotSetVar<float32_t>(l_fp, 5, AotVar<float32_t>(l_fp, 1) * std::bit_cast<float32_t>(1048576000u));
+    }
+    { // ADDIf
+        AotSetVar<float32_t>(l_fp, 6, AotVar<float32_t>(l_fp, 5) + std::bit_cast<float32_t>(1069547520u));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 23, l_sp, l_reg);
+        }
+    }
+
+bc_27:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 7, AotVar<uint32_t>(l_fp, 1));
+    }
+    { // NEGf
+        AotSetVar<float32_t>(l_fp, 7, -AotVar<float32_t>(l_fp, 7));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 8, AotVar<uint32_t>(l_fp, 7));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 32, l_sp, l_reg);
+        }
+    }
+
+bc_36:
+    { // ADDIf
+        AotSetVar<float32_t>(l_fp, 8, AotVar<float32_t>(l_fp, 8) + std::bit_cast<float32_t>(1073741824u));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 39, l_sp, l_reg);
+        }
+    }
+
+bc_43:
+    { // MULIf
+        AotSetVar<float32_t>(l_fp, 8, AotVar<float32_t>(l_fp, 8) * std::bit_cast<float32_t>(1077936128u));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 46, l_sp, l_reg);
+        }
+    }
+
+bc_50:
+    { // SUBIf
+        AotSetVar<float32_t>(l_fp, 8, AotVar<float32_t>(l_fp, 8) - std::bit_cast<float32_t>(1040187392u));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 53, l_sp, l_reg);
+        }
+    }
+
+bc_57:
+    { // MULf
+        AotSetVar<float32_t>(l_fp, 5, AotVar<float32_t>(l_fp, 1) * AotVar<float32_t>(l_fp, 6));
+    }
+    { // DIVf
+        if (AotVar<float32_t>(l_fp, 6) == 0) {
+            return AotLeave(regs, l_base + 59, l_sp, l_reg);
+        }
+        AotSetVar<float32_t>(l_fp, 7, AotVar<float32_t>(l_fp, 1) / AotVar<float32_t>(l_fp, 6));
+    }
+    { // SUBf
+        AotSetVar<float32_t>(l_fp, 5, AotVar<float32_t>(l_fp, 5) - AotVar<float32_t>(l_fp, 7));
+    }
+    { // MODf
+        if (AotVar<float32_t>(l_fp, 6) == 0) {
+            return AotLeave(regs, l_base + 63, l_sp, l_reg);
+        }
+        AotSetVar<float32_t>(l_fp, 7, std::fmod(AotVar<float32_t>(l_fp, 1), AotVar<float32_t>(l_fp, 6)));
+    }
+    { // ADDf
+        AotSetVar<float32_t>(l_fp, 5, AotVar<float32_t>(l_fp, 5) + AotVar<float32_t>(l_fp, 7));
+    }
+    { // ADDf
+        AotSetVar<float32_t>(l_fp, 7, AotVar<float32_t>(l_fp, 5) + AotVar<float32_t>(l_fp, 8));
+    }
+    { // CMPf
+        AotSetReg<int32_t>(l_reg, AotCompare<float32_t>(AotVar<float32_t>(l_fp, 6), AotVar<float32_t>(l_fp, 1)));
+    }
+    { // JNP
+        if (AotReg<int32_t>(l_reg) <= 0) {
+            goto bc_77;
+        }
+    }
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 9, 1u);
+    }
+    { // JMP
+        goto bc_79;
+    }
+
+bc_77:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 9, 0u);
+    }
+
+bc_79:
+    { // iTOf
+        AotSetVar<float32_t>(l_fp, 9, static_cast<float32_t>(AotVar<int32_t>(l_fp, 9)));
+    }
+    { // ADDf
+        AotSetVar<float32_t>(l_fp, 5, AotVar<float32_t>(l_fp, 7) + AotVar<float32_t>(l_fp, 9));
+    }
+    { // CMPf
+        AotSetReg<int32_t>(l_reg, AotCompare<float32_t>(AotVar<float32_t>(l_fp, 1), AotVar<float32_t>(l_fp, 6)));
+    }
+    { // JNZ
+        if (AotReg<int32_t>(l_reg) != 0) {
+            goto bc_90;
+        }
+    }
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 7, 2u);
+    }
+    { // JMP
+        goto bc_92;
+    }
+
+bc_90:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 7, 0u);
+    }
+
+bc_92:
+    { // iTOf
+        AotSetVar<float32_t>(l_fp, 7, static_cast<float32_t>(AotVar<int32_t>(l_fp, 7)));
+    }
+    { // ADDf
+        AotSetVar<float32_t>(l_fp, 9, AotVar<float32_t>(l_fp, 5) + AotVar<float32_t>(l_fp, 7));
+    }
+    { // fTOd
+        AotSetVar<float64_t>(l_fp, 4, static_cast<float64_t>(AotVar<float32_t>(l_fp, 9)));
+    }
+    { // CpyVtoR8
+        l_reg = AotVar<uint64_t>(l_fp, 4);
+    }
+    { // RET
+        return AotLeave(regs, l_base + 98, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 8> AotEntries7 {0, 4, 14, 24, 33, 40, 47, 54};
+
+// bool Hot::Truth(int, int)
+static void AotFunc8(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 4;
+        goto bc_7;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+
+bc_7:
+    { // CMPi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 0), AotVar<int32_t>(l_fp, -2)));
+    }
+    { // JP
+        if (AotReg<int32_t>(l_reg) > 0) {
+            goto bc_15;
+        }
+    }
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 1, 0u);
+    }
+    { // JMP
+        goto bc_22;
+    }
+
+bc_15:
+    { // CMPIi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 0), 3));
+    }
+    { // TZ
+        AotSetRegBool(l_reg, AotReg<int32_t>(l_reg) == 0);
+    }
+    { // CpyRtoV4
+        AotSetVar<uint32_t>(l_fp, 2, AotReg<uint32_t>(l_reg));
+    }
+    { // NOT
+        AotSetVarBool(l_fp, 2, AotVar<uint8_t>(l_fp, 2) == 0);
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 2));
+    }
+
+bc_22:
+    { // CpyVtoR4
+        AotSetReg<uint32_t>(l_reg, AotVar<uint32_t>(l_fp, 1));
+    }
+    { // JLowZ
+        if (AotReg<uint8_t>(l_reg) == 0) {
+            goto bc_29;
+        }
+    }
+    { // SetV1
+        AotSetVar<uint32_t>(l_fp, 3, 1u);
+    }
+    { // JMP
+        goto bc_45;
+    }
+
+bc_29:
+    { // CMPIi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, -2), 0));
+    }
+    { // JS
+        if (AotReg<int32_t>(l_reg) < 0) {
+            goto bc_37;
+        }
+    }
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 2, 0u);
+    }
+    { // JMP
+        goto bc_43;
+    }
+
+bc_37:
+    { // CMPi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 0), AotVar<int32_t>(l_fp, -2)));
+    }
+    { // TNZ
+        AotSetRegBool(l_reg, AotReg<int32_t>(l_reg) != 0);
+    }
+    { // CpyRtoV4
+        AotSetVar<uint32_t>(l_fp, 3, AotReg<uint32_t>(l_reg));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 2, AotVar<uint32_t>(l_fp, 3));
+    }
+
+bc_43:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 3, AotVar<uint32_t>(l_fp, 2));
+    }
+
+bc_45:
+    { // CpyVtoR4
+        AotSetReg<uint32_t>(l_reg, AotVar<uint32_t>(l_fp, 3));
+    }
+    { // JLowZ
+        if (AotReg<uint8_t>(l_reg) == 0) {
+            goto bc_52;
+        }
+    }
+    { // SetV1
+        AotSetVar<uint32_t>(l_fp, 1, 1u);
+    }
+    { // JMP
+        goto bc_61;
+    }
+
+bc_52:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, -2));
+    }
+    { // NEGi
+        AotSetVar<uint32_t>(l_fp, 1, 0u - AotVar<uint32_t>(l_fp, 1));
+    }
+    { // CMPi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 0), AotVar<int32_t>(l_fp, 1)));
+    }
+    { // TNP
+        AotSetRegBool(l_reg, AotReg<int32_t>(l_reg) <= 0);
+    }
+    { // CpyRtoV4
+        AotSetVar<uint32_t>(l_fp, 2, AotReg<uint32_t>(l_reg));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 2));
+    }
+
+bc_61:
+    { // CpyVtoR4
+        AotSetReg<uint32_t>(l_reg, AotVar<uint32_t>(l_fp, 1));
+    }
+    { // RET
+        return AotLeave(regs, l_base + 62, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 2> AotEntries8 {0, 4};
+
+// int64 Hot::Logic(int64)
+static void AotFunc9(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 4;
+        goto bc_7;
+    case 3:
+        l_base -= 10;
+        goto bc_13;
+    case 4:
+        l_base -= 14;
+        goto bc_17;
+    case 5:
+        l_base -= 22;
+        goto bc_25;
+    case 6:
+        l_base -= 26;
+        goto bc_29;
+    case 7:
+        l_base -= 30;
+        goto bc_33;
+    case 8:
+        l_base -= 34;
+        goto bc_37;
+    case 9:
+        l_base -= 42;
+        goto bc_45;
+    case 10:
+        l_base -= 46;
+        goto bc_49;
+    case 11:
+        l_base -= 50;
+        goto bc_53;
+    case 12:
+        l_base -= 61;
+        goto bc_64;
+    case 13:
+        l_base -= 67;
+        goto bc_70;
+    case 14:
+        l_base -= 71;
+        goto bc_74;
+    case 15:
+        l_base -= 76;
+        goto bc_79;
+    case 16:
+        l_base -= 86;
+        goto bc_89;
+    case 17:
+        l_base -= 95;
+        goto bc_98;
+    case 18:
+        l_base -= 111;
+        goto bc_114;
+    case 19:
+        l_base -= 115;
+        goto bc_118;
+    case 20:
+        l_base -= 122;
+        goto bc_125;
+    case 21:
+        l_base -= 127;
+        goto bc_130;
+    case 22:
+        l_base -= 139;
+        goto bc_142;
+    case 23:
+        l_base -= 144;
+        goto bc_147;
+    case 24:
+        l_base -= 152;
+        goto bc_155;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+
+bc_7:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 1, 0u);
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 9, l_sp, l_reg);
+        }
+    }
+
+bc_13:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 13, l_sp, l_reg);
+        }
+    }
+
+bc_17:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 3, 4294967291u);
+    }
+    { // JMP
+        goto bc_143;
+    }
+
+bc_21:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 21, l_sp, l_reg);
+        }
+    }
+
+bc_25:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 25, l_sp, l_reg);
+        }
+    }
+
+bc_29:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 29, l_sp, l_reg);
+        }
+    }
+
+bc_33:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 33, l_sp, l_reg);
+        }
+    }
+
+bc_37:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 4, 4294967293u);
+    }
+    { // JMP
+        goto bc_126;
+    }
+
+bc_41:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 41, l_sp, l_reg);
+        }
+    }
+
+bc_45:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 45, l_sp, l_reg);
+        }
+    }
+
+bc_49:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 49, l_sp, l_reg);
+        }
+    }
+
+bc_53:
+    { // PshC4
+        AotPush<uint32_t>(l_sp, 0u);
+    }
+    { // PshV4
+        AotPush<uint32_t>(l_sp, AotVar<uint32_t>(l_fp, 4));
+    }
+    { // PshC4
+        AotPush<uint32_t>(l_sp, 0u);
+    }
+    { // PshV4
+        AotPush<uint32_t>(l_sp, AotVar<uint32_t>(l_fp, 3));
+    }
+    { // CALL
+        return AotLeave(regs, l_base + 59, l_sp, l_reg);
+    }
+
+bc_64:
+    { // JLowZ
+        if (AotReg<uint8_t>(l_reg) == 0) {
+            goto bc_75;
+        }
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 66, l_sp, l_reg);
+        }
+    }
+
+bc_70:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 70, l_sp, l_reg);
+        }
+    }
+
+bc_74:
+    { // IncVi
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 1) + 1u);
+    }
+
+bc_75:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 75, l_sp, l_reg);
+        }
+    }
+
+bc_79:
+    { // CMPi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 3), AotVar<int32_t>(l_fp, 4)));
+    }
+    { // TNS
+        AotSetRegBool(l_reg, AotReg<int32_t>(l_reg) >= 0);
+    }
+    { // CpyRtoV4
+        AotSetVar<uint32_t>(l_fp, 2, AotReg<uint32_t>(l_reg));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 7, AotVar<uint32_t>(l_fp, 2));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 85, l_sp, l_reg);
+        }
+    }
+
+bc_89:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 2, AotVar<uint32_t>(l_fp, 7));
+    }
+    { // NOT
+        AotSetVarBool(l_fp, 2, AotVar<uint8_t>(l_fp, 2) == 0);
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 8, AotVar<uint32_t>(l_fp, 2));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 94, l_sp, l_reg);
+        }
+    }
+
+bc_98:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 9, AotVar<uint32_t>(l_fp, 8));
+    }
+    { // NOT
+        AotSetVarBool(l_fp, 9, AotVar<uint8_t>(l_fp, 9) == 0);
+    }
+    { // CMPi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 3), AotVar<int32_t>(l_fp, 4)));
+    }
+    { // TS
+        AotSetRegBool(l_reg, AotReg<int32_t>(l_reg) < 0);
+    }
+    { // CpyRtoV4
+        AotSetVar<uint32_t>(l_fp, 2, AotReg<uint32_t>(l_reg));
+    }
+    { // NOT
+        AotSetVarBool(l_fp, 2, AotVar<uint8_t>(l_fp, 2) == 0);
+    }
+    { // CMPi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 9), AotVar<int32_t>(l_fp, 2)));
+    }
+    { // JZ
+        if (AotReg<int32_t>(l_reg) == 0) {
+            goto bc_121;
+        }
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 110, l_sp, l_reg);
+        }
+    }
+
+bc_114:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 114, l_sp, l_reg);
+        }
+    }
+
+bc_118:
+    { // ADDIi
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 1) + 100u);
+    }
+
+bc_121:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 121, l_sp, l_reg);
+        }
+    }
+
+bc_125:
+    { // IncVi
+        AotSetVar<uint32_t>(l_fp, 4, AotVar<uint32_t>(l_fp, 4) + 1u);
+    }
+
+bc_126:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 126, l_sp, l_reg);
+        }
+    }
+
+bc_130:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 6, AotVar<uint64_t>(l_fp, 0));
+    }
+    { // i64TOi
+        AotSetVar<int32_t>(l_fp, 2, static_cast<int32_t>(AotVar<int64_t>(l_fp, 6)));
+    }
+    { // CMPi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 4), AotVar<int32_t>(l_fp, 2)));
+    }
+    { // JS
+        if (AotReg<int32_t>(l_reg) < 0) {
+            goto bc_41;
+        }
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 138, l_sp, l_reg);
+        }
+    }
+
+bc_142:
+    { // IncVi
+        AotSetVar<uint32_t>(l_fp, 3, AotVar<uint32_t>(l_fp, 3) + 1u);
+    }
+
+bc_143:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 143, l_sp, l_reg);
+        }
+    }
+
+bc_147:
+    { // CMPIi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 3), 5));
+    }
+    { // JS
+        if (AotReg<int32_t>(l_reg) < 0) {
+            goto bc_21;
+        }
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 151, l_sp, l_reg);
+        }
+    }
+
+bc_155:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 2, AotVar<uint32_t>(l_fp, 1));
+    }
+    { // iTOi64
+        AotSetVar<int64_t>(l_fp, 6, static_cast<int64_t>(AotVar<int32_t>(l_fp, 2)));
+    }
+    { // CpyVtoR8
+        l_reg = AotVar<uint64_t>(l_fp, 6);
+    }
+    { // RET
+        return AotLeave(regs, l_base + 160, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 24> AotEntries9 {0, 4, 10, 14, 22, 26, 30, 34, 42, 46, 50, 61, 67, 71, 76, 86, 95, 111, 115, 122, 127, 139, 144, 152};
+
+// int64 Hot::Globals(int64)
+static void AotFunc10(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 4;
+        goto bc_7;
+    case 3:
+        l_base -= 8;
+        goto bc_11;
+    case 4:
+        l_base -= 16;
+        goto bc_19;
+    case 5:
+        l_base -= 20;
+        goto bc_23;
+    case 6:
+        l_base -= 74;
+        goto bc_77;
+    case 7:
+        l_base -= 79;
+        goto bc_82;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+
+bc_7:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 7, l_sp, l_reg);
+        }
+    }
+
+bc_11:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 1, 0u);
+    }
+    { // JMP
+        goto bc_78;
+    }
+
+bc_15:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 15, l_sp, l_reg);
+        }
+    }
+
+bc_19:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 19, l_sp, l_reg);
+        }
+    }
+
+bc_23:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 23, l_sp, l_reg);
+        }
+    }
+    { // LDG
+        return AotLeave(regs, l_base + 27, l_sp, l_reg);
+    }
+
+bc_77:
+    { // IncVi
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 1) + 1u);
+    }
+
+bc_78:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 78, l_sp, l_reg);
+        }
+    }
+
+bc_82:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 0));
+    }
+    { // i64TOi
+        AotSetVar<int32_t>(l_fp, 2, static_cast<int32_t>(AotVar<int64_t>(l_fp, 4)));
+    }
+    { // CMPi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 1), AotVar<int32_t>(l_fp, 2)));
+    }
+    { // JS
+        if (AotReg<int32_t>(l_reg) < 0) {
+            goto bc_15;
+        }
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 90, l_sp, l_reg);
+        }
+    }
+    { // LDG
+        return AotLeave(regs, l_base + 94, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 7> AotEntries10 {0, 4, 8, 16, 20, 74, 79};
+
+// int64 Hot::Switches(int64)
+static void AotFunc11(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 4;
+        goto bc_7;
+    case 3:
+        l_base -= 13;
+        goto bc_16;
+    case 4:
+        l_base -= 17;
+        goto bc_20;
+    case 5:
+        l_base -= 25;
+        goto bc_28;
+    case 6:
+        l_base -= 29;
+        goto bc_32;
+    case 7:
+        l_base -= 33;
+        goto bc_36;
+    case 8:
+        l_base -= 65;
+        goto bc_68;
+    case 9:
+        l_base -= 76;
+        goto bc_79;
+    case 10:
+        l_base -= 82;
+        goto bc_85;
+    case 11:
+        l_base -= 93;
+        goto bc_96;
+    case 12:
+        l_base -= 99;
+        goto bc_102;
+    case 13:
+        l_base -= 110;
+        goto bc_113;
+    case 14:
+        l_base -= 116;
+        goto bc_119;
+    case 15:
+        l_base -= 128;
+        goto bc_131;
+    case 16:
+        l_base -= 133;
+        goto bc_136;
+    case 17:
+        l_base -= 145;
+        goto bc_148;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+
+bc_7:
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 4, 0ull);
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 2, AotVar<uint64_t>(l_fp, 4));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 12, l_sp, l_reg);
+        }
+    }
+
+bc_16:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 16, l_sp, l_reg);
+        }
+    }
+
+bc_20:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 5, 0u);
+    }
+    { // JMP
+        goto bc_132;
+    }
+
+bc_24:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 24, l_sp, l_reg);
+        }
+    }
+
+bc_28:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 28, l_sp, l_reg);
+        }
+    }
+
+bc_32:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 32, l_sp, l_reg);
+        }
+    }
+
+bc_36:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 6, 7u);
+    }
+    { // MODi
+        if (AotVar<int32_t>(l_fp, 6) == 0 || (AotVar<int32_t>(l_fp, 6) == -1 && AotVar<int32_t>(l_fp, 5) == std::numeric_limits<int32_t>::min())) {
+            return AotLeave(regs, l_base + 38, l_sp, l_reg);
+        }
+        AotSetVar<int32_t>(l_fp, 6, AotVar<int32_t>(l_fp, 5) % AotVar<int32_t>(l_fp, 6));
+    }
+    { // CMPIi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 6), 5));
+    }
+    { // JP
+        if (AotReg<int32_t>(l_reg) > 0) {
+            goto bc_115;
+        }
+    }
+    { // CMPIi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 6), 0));
+    }
+    { // JS
+        if (AotReg<int32_t>(l_reg) < 0) {
+            goto bc_115;
+        }
+    }
+    { // SUBIi
+        AotSetVar<uint32_t>(l_fp, 7, AotVar<uint32_t>(l_fp, 6) - 0u);
+    }
+    { // JMPP
+        return AotLeave(regs, l_base + 51, l_sp, l_reg);
+    }
+
+bc_68:
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 4, 10ull);
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 2) + AotVar<uint64_t>(l_fp, 4));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 2, AotVar<uint64_t>(l_fp, 4));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 75, l_sp, l_reg);
+        }
+    }
+
+bc_79:
+    { // JMP
+        goto bc_127;
+    }
+
+bc_85:
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 4, 3ull);
+    }
+    { // SUBi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 2) - AotVar<uint64_t>(l_fp, 4));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 2, AotVar<uint64_t>(l_fp, 4));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 92, l_sp, l_reg);
+        }
+    }
+
+bc_96:
+    { // JMP
+        goto bc_127;
+    }
+
+bc_102:
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 4, 2ull);
+    }
+    { // MULi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 2) * AotVar<uint64_t>(l_fp, 4));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 2, AotVar<uint64_t>(l_fp, 4));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 109, l_sp, l_reg);
+        }
+    }
+
+bc_113:
+    { // JMP
+        goto bc_127;
+    }
+
+bc_115:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 115, l_sp, l_reg);
+        }
+    }
+
+bc_119:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 6, AotVar<uint32_t>(l_fp, 5));
+    }
+    { // iTOi64
+        AotSetVar<int64_t>(l_fp, 4, static_cast<int64_t>(AotVar<int32_t>(l_fp, 6)));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 2) + AotVar<uint64_t>(l_fp, 4));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 2, AotVar<uint64_t>(l_fp, 4));
+    }
+
+bc_127:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 127, l_sp, l_reg);
+        }
+    }
+
+bc_131:
+    { // IncVi
+        AotSetVar<uint32_t>(l_fp, 5, AotVar<uint32_t>(l_fp, 5) + 1u);
+    }
+
+bc_132:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 132, l_sp, l_reg);
+        }
+    }
+
+bc_136:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 0));
+    }
+    { // i64TOi
+        AotSetVar<int32_t>(l_fp, 6, static_cast<int32_t>(AotVar<int64_t>(l_fp, 4)));
+    }
+    { // CMPi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 5), AotVar<int32_t>(l_fp, 6)));
+    }
+    { // JS
+        if (AotReg<int32_t>(l_reg) < 0) {
+            goto bc_24;
+        }
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 144, l_sp, l_reg);
+        }
+    }
+
+bc_148:
+    { // CpyVtoR8
+        l_reg = AotVar<uint64_t>(l_fp, 2);
+    }
+    { // RET
+        return AotLeave(regs, l_base + 149, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 17> AotEntries11 {0, 4, 13, 17, 25, 29, 33, 65, 76, 82, 93, 99, 110, 116, 128, 133, 145};
+
+// int64 Hot::Calls(int64)
+static void AotFunc12(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 4;
+        goto bc_7;
+    case 3:
+        l_base -= 13;
+        goto bc_16;
+    case 4:
+        l_base -= 17;
+        goto bc_20;
+    case 5:
+        l_base -= 25;
+        goto bc_28;
+    case 6:
+        l_base -= 29;
+        goto bc_32;
+    case 7:
+        l_base -= 33;
+        goto bc_36;
+    case 8:
+        l_base -= 41;
+        goto bc_44;
+    case 9:
+        l_base -= 50;
+        goto bc_53;
+    case 10:
+        l_base -= 63;
+        goto bc_66;
+    case 11:
+        l_base -= 68;
+        goto bc_71;
+    case 12:
+        l_base -= 80;
+        goto bc_83;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+
+bc_7:
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 4, 0ull);
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 2, AotVar<uint64_t>(l_fp, 4));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 12, l_sp, l_reg);
+        }
+    }
+
+bc_16:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 16, l_sp, l_reg);
+        }
+    }
+
+bc_20:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 5, 0u);
+    }
+    { // JMP
+        goto bc_67;
+    }
+
+bc_24:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 24, l_sp, l_reg);
+        }
+    }
+
+bc_28:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 28, l_sp, l_reg);
+        }
+    }
+
+bc_32:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 32, l_sp, l_reg);
+        }
+    }
+
+bc_36:
+    { // PshC4
+        AotPush<uint32_t>(l_sp, 0u);
+    }
+    { // PshV4
+        AotPush<uint32_t>(l_sp, AotVar<uint32_t>(l_fp, 5));
+    }
+    { // CALLSYS
+        return AotLeave(regs, l_base + 39, l_sp, l_reg);
+    }
+
+bc_44:
+    { // CpyRtoV4
+        AotSetVar<uint32_t>(l_fp, 6, AotReg<uint32_t>(l_reg));
+    }
+    { // PshC4
+        AotPush<uint32_t>(l_sp, 0u);
+    }
+    { // PshV4
+        AotPush<uint32_t>(l_sp, AotVar<uint32_t>(l_fp, 5));
+    }
+    { // CALL
+        return AotLeave(regs, l_base + 48, l_sp, l_reg);
+    }
+
+bc_53:
+    { // CpyRtoV4
+        AotSetVar<uint32_t>(l_fp, 7, AotReg<uint32_t>(l_reg));
+    }
+    { // ADDi
+        AotSetVar<uint32_t>(l_fp, 6, AotVar<uint32_t>(l_fp, 6) + AotVar<uint32_t>(l_fp, 7));
+    }
+    { // iTOi64
+        AotSetVar<int64_t>(l_fp, 4, static_cast<int64_t>(AotVar<int32_t>(l_fp, 6)));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 2) + AotVar<uint64_t>(l_fp, 4));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 2, AotVar<uint64_t>(l_fp, 4));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 62, l_sp, l_reg);
+        }
+    }
+
+bc_66:
+    { // IncVi
+        AotSetVar<uint32_t>(l_fp, 5, AotVar<uint32_t>(l_fp, 5) + 1u);
+    }
+
+bc_67:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 67, l_sp, l_reg);
+        }
+    }
+
+bc_71:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 0));
+    }
+    { // i64TOi
+        AotSetVar<int32_t>(l_fp, 6, static_cast<int32_t>(AotVar<int64_t>(l_fp, 4)));
+    }
+    { // CMPi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 5), AotVar<int32_t>(l_fp, 6)));
+    }
+    { // JS
+        if (AotReg<int32_t>(l_reg) < 0) {
+            goto bc_24;
+        }
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 79, l_sp, l_reg);
+        }
+    }
+
+bc_83:
+    { // CpyVtoR8
+        l_reg = AotVar<uint64_t>(l_fp, 2);
+    }
+    { // RET
+        return AotLeave(regs, l_base + 84, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 12> AotEntries12 {0, 4, 13, 17, 25, 29, 33, 41, 50, 63, 68, 80};
+
+// int64 Hot::Objects(int64)
+static void AotFunc13(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 14;
+        goto bc_17;
+    case 3:
+        l_base -= 18;
+        goto bc_21;
+    case 4:
+        l_base -= 26;
+        goto bc_29;
+    case 5:
+        l_base -= 30;
+        goto bc_33;
+    case 6:
+        l_base -= 34;
+        goto bc_37;
+    case 7:
+        l_base -= 43;
+        goto bc_46;
+    case 8:
+        l_base -= 47;
+        goto bc_50;
+    case 9:
+        l_base -= 52;
+        goto bc_55;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+    { // CALL
+        return AotLeave(regs, l_base + 7, l_sp, l_reg);
+    }
+
+bc_17:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 17, l_sp, l_reg);
+        }
+    }
+
+bc_21:
+    { // SetV4
+        AotSetVar<uint32_t>(l_fp, 3, 0u);
+    }
+    { // JMP
+        goto bc_51;
+    }
+
+bc_25:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 25, l_sp, l_reg);
+        }
+    }
+
+bc_29:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 29, l_sp, l_reg);
+        }
+    }
+
+bc_33:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 33, l_sp, l_reg);
+        }
+    }
+
+bc_37:
+    { // PshC4
+        AotPush<uint32_t>(l_sp, 0u);
+    }
+    { // PshV4
+        AotPush<uint32_t>(l_sp, AotVar<uint32_t>(l_fp, 3));
+    }
+    { // PshVPtr
+        return AotLeave(regs, l_base + 40, l_sp, l_reg);
+    }
+
+bc_46:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 46, l_sp, l_reg);
+        }
+    }
+
+bc_50:
+    { // IncVi
+        AotSetVar<uint32_t>(l_fp, 3, AotVar<uint32_t>(l_fp, 3) + 1u);
+    }
+
+bc_51:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 51, l_sp, l_reg);
+        }
+    }
+
+bc_55:
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 6, AotVar<uint64_t>(l_fp, 0));
+    }
+    { // i64TOi
+        AotSetVar<int32_t>(l_fp, 4, static_cast<int32_t>(AotVar<int64_t>(l_fp, 6)));
+    }
+    { // CMPi
+        AotSetReg<int32_t>(l_reg, AotCompare<int32_t>(AotVar<int32_t>(l_fp, 3), AotVar<int32_t>(l_fp, 4)));
+    }
+    { // JS
+        if (AotReg<int32_t>(l_reg) < 0) {
+            goto bc_25;
+        }
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 63, l_sp, l_reg);
+        }
+    }
+    { // LoadRObjR
+        return AotLeave(regs, l_base + 67, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 9> AotEntries13 {0, 14, 18, 26, 30, 34, 43, 47, 52};
+
+// void Hot::Outputs(int, int&out, double&out, int8&out)
+static void AotFunc14(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 4;
+        goto bc_7;
+    case 3:
+        l_base -= 14;
+        goto bc_17;
+    case 4:
+        l_base -= 30;
+        goto bc_33;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+
+bc_7:
+    { // ADDIi
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 0) + 1u);
+    }
+    { // PshVPtr
+        return AotLeave(regs, l_base + 10, l_sp, l_reg);
+    }
+
+bc_17:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 0));
+    }
+    { // iTOd
+        AotSetVar<float64_t>(l_fp, 4, static_cast<float64_t>(AotVar<int32_t>(l_fp, 1)));
+    }
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 6, 4611686018427387904ull);
+    }
+    { // DIVd
+        if (AotVar<float64_t>(l_fp, 6) == 0) {
+            return AotLeave(regs, l_base + 24, l_sp, l_reg);
+        }
+        AotSetVar<float64_t>(l_fp, 4, AotVar<float64_t>(l_fp, 4) / AotVar<float64_t>(l_fp, 6));
+    }
+    { // PshVPtr
+        return AotLeave(regs, l_base + 26, l_sp, l_reg);
+    }
+
+bc_33:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 0));
+    }
+    { // iTOb
+        AotSetVarLow<uint8_t>(l_fp, 1, static_cast<uint8_t>(AotVar<uint32_t>(l_fp, 1)));
+    }
+    { // PshVPtr
+        return AotLeave(regs, l_base + 36, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 4> AotEntries14 {0, 4, 14, 30};
+
+// int64 Hot::References(int64)
+static void AotFunc15(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 4;
+        goto bc_7;
+    case 3:
+        l_base -= 8;
+        goto bc_11;
+    case 4:
+        l_base -= 12;
+        goto bc_15;
+    case 5:
+        l_base -= 16;
+        goto bc_19;
+    case 6:
+        l_base -= 34;
+        goto bc_37;
+    case 7:
+        l_base -= 44;
+        goto bc_47;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+
+bc_7:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 7, l_sp, l_reg);
+        }
+    }
+
+bc_11:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 11, l_sp, l_reg);
+        }
+    }
+
+bc_15:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 15, l_sp, l_reg);
+        }
+    }
+
+bc_19:
+    { // VAR
+        AotPush<AngelScript::asPWORD>(l_sp, static_cast<AngelScript::asPWORD>(10));
+    }
+    { // VAR
+        AotPush<AngelScript::asPWORD>(l_sp, static_cast<AngelScript::asPWORD>(12));
+    }
+    { // VAR
+        AotPush<AngelScript::asPWORD>(l_sp, static_cast<AngelScript::asPWORD>(13));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 8, AotVar<uint64_t>(l_fp, 0));
+    }
+    { // i64TOi
+        AotSetVar<int32_t>(l_fp, 9, static_cast<int32_t>(AotVar<int64_t>(l_fp, 8)));
+    }
+    { // PshC4
+        AotPush<uint32_t>(l_sp, 0u);
+    }
+    { // PshV4
+        AotPush<uint32_t>(l_sp, AotVar<uint32_t>(l_fp, 9));
+    }
+    { // GETREF
+        return AotLeave(regs, l_base + 29, l_sp, l_reg);
+    }
+
+bc_37:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 5, AotVar<uint32_t>(l_fp, 10));
+    }
+    { // CpyVtoV8
+        AotSetVar<uint64_t>(l_fp, 4, AotVar<uint64_t>(l_fp, 12));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 13));
+    }
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 43, l_sp, l_reg);
+        }
+    }
+
+bc_47:
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 13, AotVar<uint32_t>(l_fp, 1));
+    }
+    { // iTOi64
+        AotSetVar<int64_t>(l_fp, 16, static_cast<int64_t>(AotVar<int32_t>(l_fp, 13)));
+    }
+    { // SetV8
+        AotSetVar<uint64_t>(l_fp, 8, 4611686018427387904ull);
+    }
+    { // MULd
+        AotSetVar<float64_t>(l_fp, 12, AotVar<float64_t>(l_fp, 4) * AotVar<float64_t>(l_fp, 8));
+    }
+    { // dTOi64
+        AotSetVar<int64_t>(l_fp, 12, static_cast<int64_t>(AotVar<float64_t>(l_fp, 12)));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 8, AotVar<uint64_t>(l_fp, 16) + AotVar<uint64_t>(l_fp, 12));
+    }
+    { // CpyVtoV4
+        AotSetVar<uint32_t>(l_fp, 9, AotVar<uint32_t>(l_fp, 5));
+    }
+    { // sbTOi
+        AotSetVar<int32_t>(l_fp, 9, static_cast<int32_t>(AotVar<int8_t>(l_fp, 9)));
+    }
+    { // iTOi64
+        AotSetVar<int64_t>(l_fp, 18, static_cast<int64_t>(AotVar<int32_t>(l_fp, 9)));
+    }
+    { // ADDi64
+        AotSetVar<uint64_t>(l_fp, 12, AotVar<uint64_t>(l_fp, 8) + AotVar<uint64_t>(l_fp, 18));
+    }
+    { // CpyVtoR8
+        l_reg = AotVar<uint64_t>(l_fp, 12);
+    }
+    { // RET
+        return AotLeave(regs, l_base + 67, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 7> AotEntries15 {0, 4, 8, 12, 16, 34, 44};
+
+// void Hot::Accumulator::Add(int)
+static void AotFunc16(AngelScript::asSVMRegisters* regs, AngelScript::asPWORD entry)
+{
+    AngelScript::asDWORD* l_base = regs->programPointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_fp = regs->stackFramePointer;
+    [[maybe_unused]] AngelScript::asDWORD* l_sp = regs->stackPointer;
+    [[maybe_unused]] AngelScript::asQWORD l_reg = regs->valueRegister;
+
+    switch (entry) {
+    case 1:
+        l_base -= 0;
+        goto bc_3;
+    case 2:
+        l_base -= 4;
+        goto bc_7;
+    default:
+        regs->programPointer += 1 + AS_PTR_SIZE;
+        return;
+    }
+
+bc_3:
+    { // SUSPEND
+        if (AotShouldSuspend(regs)) {
+            return AotLeave(regs, l_base + 3, l_sp, l_reg);
+        }
+    }
+
+bc_7:
+    { // MULIi
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, -2) * 3u);
+    }
+    { // SUBIi
+        AotSetVar<uint32_t>(l_fp, 1, AotVar<uint32_t>(l_fp, 1) - 1u);
+    }
+    { // LoadThisR
+        return AotLeave(regs, l_base + 13, l_sp, l_reg);
+    }
+}
+
+constexpr array<uint32_t, 2> AotEntries16 {0, 4};
+
+const array<AngelScriptAotFunction, 17> AotFunctions {
+    AngelScriptAotFunction {.Declaration = "int64 Hot::Fibonacci(int64)", .BytecodeHash = 9039252293181854945ull, .Entry = &AotFunc0, .EntryPoints = AotEntries0},
+    AngelScriptAotFunction {.Declaration = "int64 Hot::Collatz(int64)", .BytecodeHash = 1446836964697291398ull, .Entry = &AotFunc1, .EntryPoints = AotEntries1},
+    AngelScriptAotFunction {.Declaration = "int64 Hot::Divide(int64)", .BytecodeHash = 2271884434405916361ull, .Entry = &AotFunc2, .EntryPoints = AotEntries2},
+    AngelScriptAotFunction {.Declaration = "int64 Hot::IntMin(int64)", .BytecodeHash = 5487376593644893568ull, .Entry = &AotFunc3, .EntryPoints = AotEntries3},
+    AngelScriptAotFunction {.Declaration = "int64 Hot::Bits(int64)", .BytecodeHash = 15176691537627380252ull, .Entry = &AotFunc4, .EntryPoints = AotEntries4},
+    AngelScriptAotFunction {.Declaration = "int64 Hot::Conversions(int64)", .BytecodeHash = 3571996469174084041ull, .Entry = &AotFunc5, .EntryPoints = AotEntries5},
+    AngelScriptAotFunction {.Declaration = "double Hot::Polynomial(double)", .BytecodeHash = 1977491071768558223ull, .Entry = &AotFunc6, .EntryPoints = AotEntries6},
+    AngelScriptAotFunction {.Declaration = "double Hot::FloatMath(double)", .BytecodeHash = 13798952810582882568ull, .Entry = &AotFunc7, .EntryPoints = AotEntries7},
+    AngelScriptAotFunction {.Declaration = "bool Hot::Truth(int, int)", .BytecodeHash = 14781078264065110360ull, .Entry = &AotFunc8, .EntryPoints = AotEntries8},
+    AngelScriptAotFunction {.Declaration = "int64 Hot::Logic(int64)", .BytecodeHash = 5071709057700836392ull, .Entry = &AotFunc9, .EntryPoints = AotEntries9},
+    AngelScriptAotFunction {.Declaration = "int64 Hot::Globals(int64)", .BytecodeHash = 2556091105826975773ull, .Entry = &AotFunc10, .EntryPoints = AotEntries10},
+    AngelScriptAotFunction {.Declaration = "int64 Hot::Switches(int64)", .BytecodeHash = 11586773065063243304ull, .Entry = &AotFunc11, .EntryPoints = AotEntries11},
+    AngelScriptAotFunction {.Declaration = "int64 Hot::Calls(int64)", .BytecodeHash = 13508416626512195854ull, .Entry = &AotFunc12, .EntryPoints = AotEntries12},
+    AngelScriptAotFunction {.Declaration = "int64 Hot::Objects(int64)", .BytecodeHash = 7400958016488857515ull, .Entry = &AotFunc13, .EntryPoints = AotEntries13},
+    AngelScriptAotFunction {.Declaration = "void Hot::Outputs(int, int&out, double&out, int8&out)", .BytecodeHash = 9912379548971159585ull, .Entry = &AotFunc14, .EntryPoints = AotEntries14},
+    AngelScriptAotFunction {.Declaration = "int64 Hot::References(int64)", .BytecodeHash = 3209378704505046721ull, .Entry = &AotFunc15, .EntryPoints = AotEntries15},
+    AngelScriptAotFunction {.Declaration = "void Hot::Accumulator::Add(int)", .BytecodeHash = 4741715692656981215ull, .Entry = &AotFunc16, .EntryPoints = AotEntries16},
+};
+
+const AngelScriptAotRegistrar AotRegistrar {AotFunctions};
+}
+
+FO_END_NAMESPACE
+
+#endif
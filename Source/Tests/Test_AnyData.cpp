@@ -337,4 +337,157 @@ TEST_CASE("AnyData")
     }
 }
 
+TEST_CASE("AnyDataPackedDocument")
+{
+    auto make_doc = []() {
+        AnyData::Array arr;
+        arr.EmplaceBack(numeric_cast<int64_t>(1));
+        arr.EmplaceBack(string("two"));
+        arr.EmplaceBack(true);
+
+        AnyData::Dict nested;
+        nested.Emplace("x", 0.5);
+        nested.Emplace("name", string("name"));
+
+        AnyData::Document doc;
+        doc.Emplace("int", numeric_cast<int64_t>(-42));
+        doc.Emplace("float", 3.25);
+        doc.Emplace("bool", false);
+        doc.Emplace("str", string("hello world"));
+        doc.Emplace("arr", std::move(arr));
+        doc.Emplace("dict", std::move(nested));
+        doc.Emplace("empty", AnyData::Array());
+        return doc;
+    };
+
+    SECTION("RoundTrip")
+    {
+        const auto doc = make_doc();
+        const auto packed = AnyData::PackedDocument(doc);
+
+        CHECK(AnyData::PackedDocumentView::IsPacked(packed.GetData()));
+        CHECK(packed.ToDocument() == doc);
+        CHECK(AnyData::PackedDocument::FromData(vector<uint8_t>(packed.GetData().begin(), packed.GetData().end())).ToDocument() == doc);
+        CHECK(packed.Copy().ToDocument() == doc);
+    }
+
+    SECTION("ViewReadsInPlace")
+    {
+        const auto packed = AnyData::PackedDocument(make_doc());
+        const auto view = packed.GetView();
+
+        REQUIRE(view.Size() == 7);
+        CHECK(view.GetKey(0) == "arr");
+        CHECK(view.Find("int")->AsInt64() == -42);
+        CHECK(is_float_equal(view.Find("float")->AsDouble(), 3.25));
+        CHECK(view.Find("str")->AsString() == "hello world");
+        CHECK_FALSE(view.Find("missing").has_value());
+
+        const auto arr = *view.Find("arr");
+        REQUIRE(arr.Size() == 3);
+        CHECK(arr.GetElement(1).AsString() == "two");
+        CHECK(arr.GetElement(2).AsBool());
+        CHECK_THROWS_AS(arr.GetElement(3), AnyDataException);
+
+        const auto nested = *view.Find("dict");
+        CHECK(is_float_equal(nested.Find("x")->AsDouble(), 0.5));
+        CHECK(nested.Find("name")->AsString() == "name");
+        CHECK_THROWS_AS(nested.Find("x")->AsInt64(), AnyDataException);
+    }
+
+    SECTION("MergeReplacesAndAddsKeys")
+    {
+        const auto base = AnyData::PackedDocument(make_doc());
+
+        AnyData::Document patch;
+        patch.Emplace("int", string("replaced"));
+        patch.Emplace("added", numeric_cast<int64_t>(7));
+        patch.Emplace("zzz", true);
+
+        const auto merged = AnyData::PackedDocument(base.GetView(), patch);
+
+        auto expected = make_doc();
+        expected.Assign("int", string("replaced"));
+        expected.Assign("added", numeric_cast<int64_t>(7));
+        expected.Assign("zzz", true);
+
+        CHECK(merged.ToDocument() == expected);
+        CHECK(AnyData::PackedDocument(AnyData::PackedDocumentView(), patch).ToDocument() == patch);
+
+        const auto packed_patch = AnyData::PackedDocument(patch);
+        CHECK(AnyData::PackedDocument(base.GetView(), packed_patch.GetView()).ToDocument() == expected);
+        CHECK(AnyData::PackedDocument(AnyData::PackedDocumentView(), packed_patch.GetView()).ToDocument() == patch);
+    }
+
+    SECTION("BuilderMatchesPackedDocument")
+    {
+        const auto source = AnyData::PackedDocument(make_doc());
+
+        // Entries arrive out of key order, containers come both unpacked and as packed values
+        AnyData::PackedDocumentBuilder builder;
+        builder.Add("str", AnyData::Value(string("hello world")));
+        builder.Add("dict", source.GetView().Find("dict").value());
+        builder.Add("int", AnyData::Value(numeric_cast<int64_t>(-42)));
+        builder.Add("arr", source.GetView().Find("arr").value().ToValue());
+        builder.Add("float", AnyData::Value(3.25));
+        builder.Add("empty", AnyData::Value(AnyData::Array()));
+        builder.Add("bool", AnyData::Value(false));
+        CHECK(builder.Size() == 7);
+
+        const auto built = builder.Finish();
+
+        CHECK(built.GetData().size() == source.GetData().size());
+        CHECK(built.ToDocument() == make_doc());
+        CHECK(AnyData::PackedDocument::FromData(vector<uint8_t>(built.GetData().begin(), built.GetData().end())).ToDocument() == make_doc());
+
+        AnyData::PackedDocumentBuilder duplicate_builder;
+        duplicate_builder.Add("key", AnyData::Value(true));
+        duplicate_builder.Add("key", AnyData::Value(false));
+        CHECK_THROWS_AS(duplicate_builder.Finish(), AnyDataException);
+
+        CHECK(AnyData::PackedDocumentBuilder().Finish().Empty());
+    }
+
+    SECTION("EmptyDocument")
+    {
+        const auto packed = AnyData::PackedDocument(AnyData::Document());
+
+        CHECK(packed.Empty());
+        CHECK(packed.ToDocument().Empty());
+        CHECK(AnyData::PackedDocument().Empty());
+        CHECK(AnyData::PackedDocumentView(const_span<uint8_t>()).Empty());
+    }
+
+    SECTION("CorruptedDataRejected")
+    {
+        const auto packed = AnyData::PackedDocument(make_doc());
+        const auto valid_data = vector<uint8_t>(packed.GetData().begin(), packed.GetData().end());
+
+        auto truncated = valid_data;
+        truncated.pop_back();
+        CHECK_THROWS_AS(AnyData::PackedDocument::FromData(truncated), AnyDataException);
+
+        auto bad_magic = valid_data;
+        bad_magic[0] = 'X';
+        CHECK_FALSE(AnyData::PackedDocumentView::IsPacked(bad_magic));
+        CHECK_THROWS_AS(AnyData::PackedDocument::FromData(bad_magic), AnyDataException);
+
+        auto bad_type = valid_data;
+        bad_type[16] = 0xFF;
+        CHECK_THROWS_AS(AnyData::PackedDocument::FromData(bad_type), AnyDataException);
+
+        // First dict entry points back at the root itself
+        auto bad_offset = valid_data;
+        bad_offset[16 + 5 + 4] = 16;
+        bad_offset[16 + 5 + 5] = 0;
+        bad_offset[16 + 5 + 6] = 0;
+        bad_offset[16 + 5 + 7] = 0;
+        CHECK_THROWS_AS(AnyData::PackedDocument::FromData(bad_offset), AnyDataException);
+
+        auto trailing = valid_data;
+        trailing.push_back(0);
+        CHECK_THROWS_AS(AnyData::PackedDocument::FromData(trailing), AnyDataException);
+    }
+}
+
 FO_END_NAMESPACE
@@ -209,18 +209,14 @@ namespace BakerTests
     }
 
     // Several protos of one type in a single pack, with a configure callback invoked before serialization so a
-    // caller can vary each proto's defaults
+    // caller can vary each proto's defaults. Hashed strings the values reference are written to the pack's hash
+    // section, so a loader with its own hash storage can resolve them
     template<typename ProtoType>
     inline auto MakeMultiProtoResourceBlob(EngineMetadata& meta, hstring type_name, const vector<pair<string, function<void(ProtoType&)>>>& protos) -> vector<uint8_t>
     {
-        vector<uint8_t> protos_data;
-        auto writer = DataWriter(protos_data);
-
-        writer.Write<uint32_t>(uint32_t {0});
-        writer.Write<uint32_t>(uint32_t {1});
-        writer.Write<uint32_t>(numeric_cast<uint32_t>(protos.size()));
-        writer.Write<uint16_t>(numeric_cast<uint16_t>(type_name.as_str().length()));
-        writer.WriteStringBytes(type_name.as_str());
+        vector<uint8_t> records_data;
+        auto records_writer = DataWriter(records_data);
+        set<hstring> str_hashes;
 
         for (const auto& [proto_name, configure] : protos) {
             ProtoType proto {meta.Hashes.ToHashedString(proto_name), meta.GetPropertyRegistrar(type_name)};
@@ -230,16 +226,30 @@ namespace BakerTests
             }
 
             vector<uint8_t> props_data;
-            set<hstring> str_hashes;
             proto.GetProperties()->StoreAllData(props_data, str_hashes);
-            ignore_unused(str_hashes);
 
-            writer.Write<uint16_t>(numeric_cast<uint16_t>(proto_name.length()));
-            writer.WriteStringBytes(proto_name);
-            writer.Write<uint32_t>(numeric_cast<uint32_t>(props_data.size()));
-            writer.WriteBytes(props_data);
+            records_writer.Write<uint16_t>(numeric_cast<uint16_t>(proto_name.length()));
+            records_writer.WriteStringBytes(proto_name);
+            records_writer.Write<uint32_t>(numeric_cast<uint32_t>(props_data.size()));
+            records_writer.WriteBytes(props_data);
+        }
+
+        vector<uint8_t> protos_data;
+        auto writer = DataWriter(protos_data);
+
+        writer.Write<uint32_t>(numeric_cast<uint32_t>(str_hashes.size()));
+
+        for (const auto& str : str_hashes) {
+            writer.Write<uint32_t>(numeric_cast<uint32_t>(str.as_str().length()));
+            writer.WriteStringBytes(str.as_str());
         }
 
+        writer.Write<uint32_t>(uint32_t {1});
+        writer.Write<uint32_t>(numeric_cast<uint32_t>(protos.size()));
+        writer.Write<uint16_t>(numeric_cast<uint16_t>(type_name.as_str().length()));
+        writer.WriteStringBytes(type_name.as_str());
+        writer.WriteBytes(records_data);
+
         return protos_data;
     }
 
@@ -2521,6 +2521,156 @@ TEST_CASE("ModelManagerInstantiatesABakedModel")
         REQUIRE_NOTHROW(sprite->Stop());
     }
 }
+
+TEST_CASE("ModelManagerPosesSpriteFramesOnAnimationWorkers")
+{
+    // Posing on the animation workers and merging on the render thread must leave exactly the joint matrices
+    // the serial path produces for the same scripted state changes
+    constexpr string_view MESH_PATH = "Models/RuntimeInstance.fbx";
+    constexpr string_view MODEL_PATH = "Models/RuntimeInstance.fo3d";
+    constexpr size_t MODEL_COUNT = 6;
+
+    vector<pair<string, vector<uint8_t>>> model_resources;
+    vector<uint8_t> mesh_blob = MakeRuntimeModelTriangleMesh();
+
+    model_resources.emplace_back(string {"ModelAnimationInfo.foinfo"}, MakeUnitTestModelAnimationInfo(MODEL_PATH));
+    model_resources.emplace_back(string {MESH_PATH}, mesh_blob);
+    model_resources.emplace_back(string {MODEL_PATH}, MakeRuntimeModelDescription(MODEL_PATH, MESH_PATH, mesh_blob));
+
+    auto settings = MakeClientTestSettings();
+    settings.AnimationWorkerThreads = 3;
+    auto client = MakeClientEngine(settings, MakeClientTestResources(std::move(model_resources)));
+
+    auto shutdown = scope_exit([&client]() noexcept { safe_call([&client] { client->Shutdown(); }); });
+
+    auto factory = client->SprMngr.GetSpriteFactory(typeid(ModelSpriteFactory)).dyn_cast<ModelSpriteFactory>();
+    REQUIRE(factory);
+
+    auto model_mngr = factory->GetModelMngr();
+    REQUIRE_NOTHROW(model_mngr->PreloadModel(MODEL_PATH));
+
+    vector<unique_ptr<ModelInstance>> serial_models;
+    vector<unique_ptr<ModelInstance>> parallel_models;
+
+    for (size_t i = 0; i < MODEL_COUNT; i++) {
+        auto serial_model = model_mngr->CreateModel(MODEL_PATH);
+        auto parallel_model = model_mngr->CreateModel(MODEL_PATH);
+        REQUIRE(static_cast<bool>(serial_model));
+        REQUIRE(static_cast<bool>(parallel_model));
+
+        serial_models.emplace_back(serial_model.take_not_null());
+        parallel_models.emplace_back(parallel_model.take_not_null());
+    }
+
+    vector<ptr<ModelInstance>> parallel_model_ptrs;
+
+    for (auto& model : parallel_models) {
+        parallel_model_ptrs.emplace_back(model.as_ptr());
+    }
+
+    auto apply_frame_state = [](ptr<ModelInstance> model, size_t index, int32_t frame) {
+        model->SetupFrame(isize32 {128, 128}, ipos32 {64, 96});
+        model->PrepareFrameLayout();
+        model->SetDir(mdir {numeric_cast<uint8_t>((numeric_cast<size_t>(frame) + index) % 6)}, false);
+        model->SetSpeed(1.0f + numeric_cast<float32_t>(index) * 0.25f);
+        model->SetMovementState(frame % 3 == 0, frame % 3 == 1, numeric_cast<int32_t>(index) * 10);
+        model->RequestRedraw();
+    };
+
+    for (int32_t frame = 0; frame < 8; frame++) {
+        for (size_t i = 0; i < MODEL_COUNT; i++) {
+            apply_frame_state(serial_models[i].as_ptr(), i, frame);
+            apply_frame_state(parallel_models[i].as_ptr(), i, frame);
+        }
+
+        REQUIRE_NOTHROW(model_mngr->PrepareSpriteFramePoses(parallel_model_ptrs));
+
+        for (size_t i = 0; i < MODEL_COUNT; i++) {
+            CHECK(parallel_models[i]->HasPreparedPose());
+
+            REQUIRE_NOTHROW(serial_models[i]->PoseSpriteFrame(true));
+            REQUIRE_NOTHROW(parallel_models[i]->PoseSpriteFrame(true));
+
+            CHECK_FALSE(parallel_models[i]->HasPreparedPose());
+
+            const_span<mat44> serial_matrices = serial_models[i]->GetWorldMatrices();
+            const_span<mat44> parallel_matrices = parallel_models[i]->GetWorldMatrices();
+            REQUIRE(serial_matrices.size() == parallel_matrices.size());
+
+            for (size_t j = 0; j < serial_matrices.size(); j++) {
+                CHECK(serial_matrices[j] == parallel_matrices[j]);
+            }
+        }
+
+        client->GameTime.FrameAdvance(false);
+    }
+}
+
+TEST_CASE("ModelSpriteFactoryReusesIdenticallyPosedFrames")
+{
+    // Two instances of one model in the same pose share a single atlas frame: the second draw is a cache hit and
+    // skips the offscreen render, and the idle frame is evicted once no sprite shows it
+    constexpr string_view MESH_PATH = "Models/RuntimeInstance.fbx";
+    constexpr string_view MODEL_PATH = "Models/RuntimeInstance.fo3d";
+
+    vector<pair<string, vector<uint8_t>>> model_resources;
+    vector<uint8_t> mesh_blob = MakeRuntimeModelTriangleMesh();
+
+    model_resources.emplace_back(string {"ModelAnimationInfo.foinfo"}, MakeUnitTestModelAnimationInfo(MODEL_PATH));
+    model_resources.emplace_back(string {MESH_PATH}, mesh_blob);
+    model_resources.emplace_back(string {MODEL_PATH}, MakeRuntimeModelDescription(MODEL_PATH, MESH_PATH, mesh_blob));
+
+    auto settings = MakeClientTestSettings();
+    settings.ModelFrameCacheBudget = 4 * 1024 * 1024;
+    auto client = MakeClientEngine(settings, MakeClientTestResources(std::move(model_resources)));
+
+    auto shutdown = scope_exit([&client]() noexcept { safe_call([&client] { client->Shutdown(); }); });
+
+    auto factory = client->SprMngr.GetSpriteFactory(typeid(ModelSpriteFactory)).dyn_cast<ModelSpriteFactory>();
+    REQUIRE(factory);
+
+    shared_ptr<Sprite> first = client->SprMngr.LoadSprite(client->Hashes.ToHashedString(MODEL_PATH), AtlasType::MapSprites, true);
+    shared_ptr<Sprite> second = client->SprMngr.LoadSprite(client->Hashes.ToHashedString(MODEL_PATH), AtlasType::MapSprites, true);
+    REQUIRE(static_cast<bool>(first));
+    REQUIRE(static_cast<bool>(second));
+
+    auto* first_spr = dynamic_cast<ModelSprite*>(first.get());
+    auto* second_spr = dynamic_cast<ModelSprite*>(second.get());
+    REQUIRE(first_spr != nullptr);
+    REQUIRE(second_spr != nullptr);
+
+    for (ModelSprite* spr : {first_spr, second_spr}) {
+        spr->GetModel()->SetDir(mdir {uint8_t {2}}, false);
+        spr->GetModel()->RequestRedraw();
+        REQUIRE_NOTHROW(spr->PlayDefault());
+    }
+
+    REQUIRE_NOTHROW(first->Update());
+    REQUIRE_NOTHROW(second->Update());
+
+    ModelSpriteFrameCacheStats stats = factory->GetFrameCacheStats();
+    CHECK(stats.Misses == 1);
+    CHECK(stats.Hits == 1);
+    CHECK(stats.Entries == 1);
+    CHECK(stats.Pixels > 0);
+    CHECK(first_spr->GetAtlas() == second_spr->GetAtlas());
+    CHECK(first_spr->GetAtlasRect().x == second_spr->GetAtlasRect().x);
+    CHECK(first_spr->GetAtlasRect().y == second_spr->GetAtlasRect().y);
+    CHECK(first_spr->GetSize() == second_spr->GetSize());
+
+    // A frame still shown by a sprite is pinned
+    client->SprMngr.CleanupSpriteCache();
+    CHECK(factory->GetFrameCacheStats().Entries == 1);
+
+    first = nullptr;
+    second = nullptr;
+    client->SprMngr.CleanupSpriteCache();
+
+    stats = factory->GetFrameCacheStats();
+    CHECK(stats.Entries == 0);
+    CHECK(stats.Pixels == 0);
+    CHECK(stats.Evictions == 1);
+}
 #endif
 
 #if FO_ANGELSCRIPT_SCRIPTING
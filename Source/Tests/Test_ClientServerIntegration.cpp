@@ -45,6 +45,7 @@
 #include "ImGuiStuff.h"
 #include "Server.h"
 #include "Test_BakerHelpers.h"
+#include "UpdateDelta.h"
 #include "Updater.h"
 
 FO_BEGIN_NAMESPACE
@@ -1078,6 +1079,177 @@ End
 
         return false;
     }
+
+    // Stands in for the server backend on the interthread transport: announces one resource file and answers
+    // portion and delta requests with the same helpers the backend uses, counting the bytes each way
+    struct UpdaterFileServerStub
+    {
+        string FileName {};
+        vector<uint8_t> FileData {};
+        int32_t MaxPortionSize {};
+        size_t BytesSent {};
+        size_t BytesReceived {};
+        size_t DeltaRequests {};
+        size_t ProtocolErrors {};
+    };
+
+    static void ListenAsUpdaterFileServer(uint16_t port, shared_ptr<UpdaterFileServerStub> stub)
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        InterthreadListeners.emplace(port, [stub](InterthreadDataCallback send_to_client) -> InterthreadDataCallback {
+            auto in_buf = SafeAlloc::MakeShared<NetInBuffer>(1024);
+            auto out_buf = SafeAlloc::MakeShared<NetOutBuffer>(1024);
+
+            return [stub, send_to_client, in_buf, out_buf](const_span<uint8_t> data) {
+                if (data.empty()) {
+                    return;
+                }
+
+                stub->BytesReceived += data.size();
+                in_buf->AddData(data);
+
+                while (in_buf->NeedProcess()) {
+                    switch (in_buf->ReadMsg()) {
+                    case NetMessage::Handshake: {
+                        ignore_unused(in_buf->Read<string>());
+                        ignore_unused(in_buf->Read<string>());
+                        ignore_unused(in_buf->Read<uint32_t>());
+                        ignore_unused(in_buf->Read<string>());
+                        in_buf->SetEncryptKey(in_buf->Read<uint32_t>());
+
+                        constexpr uint32_t out_encrypt_key = 0x5A3C1E2D;
+                        out_buf->StartMsg(NetMessage::HandshakeAnswer);
+                        out_buf->Write(false);
+                        out_buf->Write(false);
+                        out_buf->Write(false);
+                        out_buf->Write(string(BakerTests::TEST_METADATA_VERSION));
+                        out_buf->Write(out_encrypt_key);
+                        out_buf->EndMsg();
+                        out_buf->SetEncryptKey(out_encrypt_key);
+
+                        vector<uint8_t> update_desc;
+                        auto writer = DataWriter(update_desc);
+                        writer.Write<int16_t>(numeric_cast<int16_t>(stub->FileName.length()));
+                        writer.WriteStringBytes(stub->FileName);
+                        writer.Write<uint64_t>(numeric_cast<uint64_t>(stub->FileData.size()));
+                        writer.Write<uint64_t>(fs_hash_data(stub->FileData));
+                        writer.Write<UpdateFileTarget>(UpdateFileTarget::ClientResources);
+                        writer.Write<uint32_t>(uint32_t {0});
+                        writer.Write<int16_t>(const_numeric_cast<int16_t>(-1));
+
+                        out_buf->StartMsg(NetMessage::InitData);
+                        out_buf->Write(numeric_cast<uint32_t>(update_desc.size()));
+                        out_buf->Push(update_desc);
+                        out_buf->Write<uint16_t>(0);
+                        out_buf->Write(synctime {});
+                        out_buf->EndMsg();
+                        break;
+                    }
+                    case NetMessage::Ping:
+                        ignore_unused(in_buf->Read<bool>());
+                        break;
+                    case NetMessage::GetUpdateFile: {
+                        auto file_index = in_buf->Read<uint32_t>();
+                        auto start_offset = in_buf->Read<uint64_t>();
+                        auto size_limit = in_buf->Read<uint64_t>();
+
+                        if (file_index != 0 || start_offset > stub->FileData.size()) {
+                            stub->ProtocolErrors++;
+                            break;
+                        }
+
+                        auto portion = numeric_cast<size_t>(std::min({numeric_cast<uint64_t>(stub->MaxPortionSize), numeric_cast<uint64_t>(stub->FileData.size()) - start_offset, size_limit}));
+                        out_buf->StartMsg(NetMessage::UpdateFileData);
+                        out_buf->Write(numeric_cast<int32_t>(portion));
+
+                        if (portion != 0) {
+                            out_buf->Push(const_span<uint8_t> {stub->FileData.data() + numeric_cast<size_t>(start_offset), portion});
+                        }
+
+                        out_buf->EndMsg();
+                        break;
+                    }
+                    case NetMessage::GetUpdateFileDelta: {
+                        auto file_index = in_buf->Read<uint32_t>();
+                        auto basis_signatures = ReadUpdateBlockSignatures(*in_buf);
+
+                        if (file_index != 0 || !basis_signatures.has_value()) {
+                            stub->ProtocolErrors++;
+                            break;
+                        }
+
+                        stub->DeltaRequests++;
+                        auto delta_ops = MakeUpdateDelta(stub->FileData, *basis_signatures);
+                        out_buf->StartMsg(NetMessage::UpdateFileDelta);
+                        WriteUpdateDeltaOps(*out_buf, delta_ops);
+                        out_buf->EndMsg();
+                        break;
+                    }
+                    default:
+                        stub->ProtocolErrors++;
+                        break;
+                    }
+                }
+
+                in_buf->ShrinkReadBuf();
+
+                if (!out_buf->IsEmpty()) {
+                    stub->BytesSent += out_buf->GetDataSize();
+                    send_to_client(out_buf->GetData());
+                    out_buf->ResetBuf();
+                }
+            };
+        });
+    }
+
+    // Runs one resource sync of the stub's file over a client that starts from the given local copy and returns
+    // the stub with its byte counters
+    static auto SyncFileThroughUpdater(const vector<uint8_t>& local_data, const vector<uint8_t>& server_data) -> shared_ptr<UpdaterFileServerStub>
+    {
+        FO_STACK_TRACE_ENTRY();
+
+        uint16_t port = IntegrationTestPort.fetch_add(1);
+
+        auto stub = SafeAlloc::MakeShared<UpdaterFileServerStub>();
+        stub->FileName = "DeltaPack.zip";
+        stub->FileData = server_data;
+        stub->MaxPortionSize = 256 * 1024;
+
+        ListenAsUpdaterFileServer(port, stub);
+        auto remove_listener = scope_exit([port]() noexcept { safe_call([port] { InterthreadListeners.erase(port); }); });
+
+        string updater_bake_output = PrepareClientUpdaterBakeOutput();
+        auto cleanup_updater_bake_output = scope_exit([&updater_bake_output]() noexcept { fs_remove_dir_tree(updater_bake_output); });
+        string resources_dir = MakeTempClientUpdaterBakeDir("delta");
+        auto cleanup_resources_dir = scope_exit([&resources_dir]() noexcept { fs_remove_dir_tree(resources_dir); });
+        string pack_path = strex(resources_dir).combine_path(stub->FileName).str();
+
+        REQUIRE(fs_create_directories(resources_dir));
+
+        if (!local_data.empty()) {
+            REQUIRE(fs_write_file(pack_path, local_data));
+        }
+
+        auto client_settings = MakeClientTestSettings(port);
+        BakerTests::OverrideSetting(client_settings.BakeOutput, updater_bake_output);
+        BakerTests::OverrideSetting(client_settings.ClientResources, resources_dir);
+        BakerTests::OverrideSetting(client_settings.DisableZlibCompression, true);
+        BakerTests::OverrideSetting(client_settings.ForceMetadataVersion, string(BakerTests::TEST_METADATA_VERSION));
+
+        {
+            Updater updater {&client_settings, &GetApp()->MainWindow};
+            REQUIRE(WaitForUpdaterResult(updater));
+            CHECK(updater.GetResult() == UpdaterResult::ResourcesReady);
+            CHECK_FALSE(updater.IsAborted());
+        }
+
+        CHECK(stub->ProtocolErrors == 0);
+        CHECK(fs_compare_file_content(pack_path, server_data));
+        CHECK_FALSE(fs_exists(strex(resources_dir).combine_path(strex("~{}", stub->FileName)).str()));
+
+        return stub;
+    }
 }
 
 TEST_CASE("ClientAndServerHandshakeOverInterthreadTransport")
@@ -1989,6 +2161,50 @@ TEST_CASE("ClientUpdaterConsumesReportedHashListDuringHandshake")
     CHECK_FALSE(updater.IsAborted());
 }
 
+TEST_CASE("ClientUpdaterTransfersOnlyChangedBlocks")
+{
+    using namespace TestClientServerIntegration;
+
+    constexpr size_t file_size = 4 * 1024 * 1024;
+    constexpr size_t rewritten_size = 256 * 1024;
+
+    vector<uint8_t> old_data(file_size);
+    std::mt19937 rnd {38};
+
+    for (auto& byte : old_data) {
+        byte = numeric_cast<uint8_t>(rnd() & 0xFF);
+    }
+
+    auto one_byte_changed = old_data;
+    one_byte_changed[file_size / 2] ^= 0x5A;
+
+    auto region_rewritten = old_data;
+
+    for (size_t i = 0; i < rewritten_size; i++) {
+        region_rewritten[file_size / 4 + i] = numeric_cast<uint8_t>(rnd() & 0xFF);
+    }
+
+    auto full = SyncFileThroughUpdater({}, one_byte_changed);
+    auto tiny = SyncFileThroughUpdater(old_data, one_byte_changed);
+    auto region = SyncFileThroughUpdater(old_data, region_rewritten);
+
+    // Without a local copy there is nothing to describe, so the whole file travels
+    CHECK(full->DeltaRequests == 0);
+    CHECK(full->BytesSent >= file_size);
+
+    // A one-byte edit costs about one block down plus the signature list up
+    CHECK(tiny->DeltaRequests == 1);
+    CHECK(tiny->BytesSent < 16 * 1024);
+    CHECK(tiny->BytesSent + tiny->BytesReceived < file_size / 50);
+
+    // A rewritten region costs about its own size, still far below the whole file
+    CHECK(region->DeltaRequests == 1);
+    CHECK(region->BytesSent >= rewritten_size);
+    CHECK(region->BytesSent < rewritten_size + 16 * 1024);
+    CHECK(region->BytesSent > tiny->BytesSent);
+    CHECK(region->BytesSent < full->BytesSent / 8);
+}
+
 TEST_CASE("ClientReportsLazyUnresolvedHashAndLearnsWithoutDisconnect")
 {
     using namespace TestClientServerIntegration;
@@ -399,6 +399,30 @@ TEST_CASE("ConfigFile")
         CHECK(config.GetAsStr("Good", "Key") == "Value");
     }
 
+    SECTION("LineReaderJoinsContinuationsAndReportsOffsets")
+    {
+        string source = "  First  \r\n\nJoined \\\n  tail\n[Section]";
+        ConfigLineReader reader {source};
+
+        REQUIRE(reader.ReadLine());
+        CHECK(reader.GetLine() == "First");
+        CHECK(reader.IsLineStable());
+        CHECK(reader.GetLineOffset() == 0);
+
+        REQUIRE(reader.ReadLine());
+        CHECK(reader.GetLine() == "Joined tail");
+        CHECK_FALSE(reader.IsLineStable());
+        CHECK(reader.GetLineOffset() == 12);
+        CHECK(reader.GetNextOffset() == 28);
+
+        REQUIRE(reader.ReadLine());
+        CHECK(reader.GetLine() == "[Section]");
+        CHECK(ConfigFile::ParseSectionNameLine(reader.GetLine()) == "Section");
+        CHECK(reader.GetNextOffset() == source.length());
+
+        CHECK_FALSE(reader.ReadLine());
+    }
+
     string benchmark_input = BuildConfigBenchmarkInput(128, 12);
 
     BENCHMARK("ParseLargeConfig")
@@ -36,6 +36,11 @@
 #include "DataBase.h"
 #include "DiskFileSystem.h"
 
+FO_DISABLE_WARNINGS_PUSH()
+#include <bson/bson.h>
+#include <json.hpp>
+FO_DISABLE_WARNINGS_POP()
+
 #if FO_HAVE_SQLITE
 FO_DISABLE_WARNINGS_PUSH()
 #include "sqlite3.h"
@@ -162,6 +167,20 @@ namespace
             _failBackendWrites = enabled;
         }
 
+        // Must be set before changes are committed; batches are not rolled back on failure, like on Mongo
+        void SetCommitBatching(size_t batch_size, timespan flush_interval = timespan::zero)
+        {
+            _commitBatchSize = batch_size;
+            _commitFlushInterval = flush_interval;
+        }
+
+        // The next batch applies that many operations, then fails the rest as if the backend went away
+        void SetBatchWriteFailureAfter(size_t applied_ops)
+        {
+            scoped_lock locker {_collectionsLocker};
+            _batchFailAfterOps = applied_ops;
+        }
+
         void WaitUntilCommitOperationWrittenToOpLog()
         {
             unique_lock locker {_mirrorLocker};
@@ -199,6 +218,21 @@ namespace
         }
 
     protected:
+        [[nodiscard]] auto GetCommitBatchSize() const noexcept -> size_t override { return _commitBatchSize; }
+        [[nodiscard]] auto GetCommitFlushInterval() const noexcept -> timespan override { return _commitFlushInterval; }
+
+        void BeginCommitBatch() override
+        {
+            scoped_lock locker {_collectionsLocker};
+            _batchAppliedOps = 0;
+        }
+
+        [[nodiscard]] auto IsCommitBatchOperationApplied(size_t index) const noexcept -> bool override
+        {
+            scoped_lock locker {_collectionsLocker};
+            return index < _batchAppliedOps;
+        }
+
         void EnsureCollection(hstring collection_name, DataBaseKeyType key_type) override
         {
             ignore_unused(key_type);
@@ -233,7 +267,7 @@ namespace
             _restoreCv.notify_all();
         }
 
-        auto GetRecord(hstring collection_name, const DataBaseKey& id) const -> AnyData::Document override
+        auto GetRecord(hstring collection_name, const DataBaseKey& id) const -> AnyData::PackedDocument override
         {
             {
                 scoped_lock locker {_readStatsLocker};
@@ -271,13 +305,15 @@ namespace
 
             const auto& collection = _collections.at(collection_name);
             auto it = collection.find(id);
-            return it != collection.end() ? it->second.Copy() : AnyData::Document {};
+            return it != collection.end() ? AnyData::PackedDocument(it->second) : AnyData::PackedDocument {};
         }
 
-        void InsertRecord(hstring collection_name, const DataBaseKey& id, const AnyData::Document& doc) override
+        void InsertRecord(hstring collection_name, const DataBaseKey& id, const AnyData::PackedDocument& doc) override
         {
             scoped_lock locker {_collectionsLocker};
 
+            InjectBatchWriteFailure();
+
             if (_failBackendWrites) {
                 throw DataBaseException("Simulated database write failure");
             }
@@ -288,13 +324,16 @@ namespace
                 throw DataBaseException("Strict test insert duplicate");
             }
 
-            collection.emplace(id, doc.Copy());
+            collection.emplace(id, doc.ToDocument());
+            _batchAppliedOps++;
         }
 
-        void UpdateRecord(hstring collection_name, const DataBaseKey& id, const AnyData::Document& doc) override
+        void UpdateRecord(hstring collection_name, const DataBaseKey& id, const AnyData::PackedDocument& doc) override
         {
             scoped_lock locker {_collectionsLocker};
 
+            InjectBatchWriteFailure();
+
             if (_failBackendWrites) {
                 throw DataBaseException("Simulated database write failure");
             }
@@ -307,15 +346,21 @@ namespace
 
             auto& target_doc = collection[id];
 
-            for (auto&& [doc_key, doc_value] : doc) {
-                target_doc.Assign(doc_key, doc_value.Copy());
+            const auto patch = doc.GetView();
+
+            for (size_t i = 0; i < patch.Size(); i++) {
+                target_doc.Assign(string(patch.GetKey(i)), patch.GetValue(i).ToValue());
             }
+
+            _batchAppliedOps++;
         }
 
         void DeleteRecord(hstring collection_name, const DataBaseKey& id) override
         {
             scoped_lock locker {_collectionsLocker};
 
+            InjectBatchWriteFailure();
+
             if (_failBackendWrites) {
                 throw DataBaseException("Simulated database write failure");
             }
@@ -329,6 +374,8 @@ namespace
             if (_collections.count(collection_name) != 0) {
                 collection.erase(id);
             }
+
+            _batchAppliedOps++;
         }
 
     private:
@@ -339,6 +386,14 @@ namespace
             return &settings;
         }
 
+        void InjectBatchWriteFailure() FO_TSA_REQUIRES(_collectionsLocker)
+        {
+            if (_batchFailAfterOps.has_value() && _batchAppliedOps == _batchFailAfterOps.value()) {
+                _batchFailAfterOps.reset();
+                _failBackendWrites = true;
+            }
+        }
+
         HashStorage _hashes {};
         DataBaseStringKeyEscaping _stringKeyEscaping {};
         mutable mutex _collectionsLocker {};
@@ -360,6 +415,10 @@ namespace
         bool _pendingChangesRestored FO_TSA_GUARDED_BY(_restoreLocker) {};
         bool _strictRecordSemantics FO_TSA_GUARDED_BY(_collectionsLocker) {};
         bool _failBackendWrites FO_TSA_GUARDED_BY(_collectionsLocker) {};
+        optional<size_t> _batchFailAfterOps FO_TSA_GUARDED_BY(_collectionsLocker) {};
+        size_t _batchAppliedOps FO_TSA_GUARDED_BY(_collectionsLocker) {};
+        size_t _commitBatchSize {1};
+        timespan _commitFlushInterval {};
     };
 
     auto MakeDoc(std::initializer_list<pair<string_view, int64_t>> values) -> AnyData::Document
@@ -418,6 +477,75 @@ namespace
         CHECK(nested["score"].AsInt64() == 9);
     }
 
+    // The conversion chain the JSON backend used before it wrote storage files directly
+    auto MakeLegacyJsonStorage(const AnyData::Document& doc, int32_t indent) -> string
+    {
+        bson_t bson;
+        bson_init(&bson);
+        auto destroy_bson = scope_exit([&]() noexcept { bson_destroy(&bson); });
+        DocumentToBson(doc, &bson);
+
+        size_t length = 0;
+        auto json = make_nptr(bson_as_canonical_extended_json(&bson, &length));
+        REQUIRE(json);
+        auto free_json = scope_exit([&]() noexcept { bson_free(json.get()); });
+
+        return nlohmann::json::parse(json.get()).dump(indent > 0 ? indent : -1);
+    }
+
+    auto MakeSyntheticJsonDoc(uint64_t seed, size_t entries) -> AnyData::Document
+    {
+        static const vector<string> texts = {"", "plain", "quote\"", "back\\slash", "line\nbreak", "tab\t", string("\x01\x1f\x7f", 3), "\xc3\xa9\xe6\x97\xa5\xf0\x9f\x98\x80", "/path"};
+        uint64_t state = seed;
+        auto next = [&state]() {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            return state >> 17;
+        };
+
+        function<AnyData::Value(size_t)> make_value = [&](size_t depth) -> AnyData::Value {
+            switch (next() % (depth < 3 ? 6 : 4)) {
+            case 0:
+                return static_cast<int64_t>(next()) - static_cast<int64_t>(next());
+            case 1:
+                return std::bit_cast<float64_t>((next() & 0x3FFFFFFFFFFFFull) | (static_cast<uint64_t>(next() % 0x7FE) << 52));
+            case 2:
+                return next() % 2 == 0;
+            case 3:
+                return texts[next() % texts.size()] + texts[next() % texts.size()];
+            case 4: {
+                AnyData::Array arr;
+
+                for (size_t i = next() % 4; i != 0; i--) {
+                    arr.EmplaceBack(make_value(depth + 1));
+                }
+
+                return std::move(arr);
+            }
+            default: {
+                AnyData::Dict dict;
+
+                for (size_t i = next() % 4; i != 0; i--) {
+                    dict.Emplace(strex("{}{}", texts[next() % texts.size()], next() % 100).str(), make_value(depth + 1));
+                }
+
+                return std::move(dict);
+            }
+            }
+        };
+
+        AnyData::Document doc;
+
+        for (size_t i = 0; i < entries; i++) {
+            doc.Assign(strex("key_{}", i).str(), make_value(0));
+        }
+
+        doc.Assign("whole_double", 100.0);
+        doc.Assign("negative_zero", -0.0);
+        doc.Assign("denormal", 5e-324);
+        doc.Assign("min_int", std::numeric_limits<int64_t>::min());
+        return doc;
+    }
+
     class ScopedRecoveryLogs final
     {
     public:
@@ -536,7 +664,7 @@ TEST_CASE("DataBaseCommitOperationsPreserveOrder")
     hstring collection = hashes.ToHashedString("test_collection");
     ident_t record_id = ident_t {1001};
 
-    db.Insert(collection, record_id, MakeDoc({{"a", 1}}));
+    db.Insert(collection, record_id, AnyData::PackedDocument(MakeDoc({{"a", 1}})));
     db.Update(collection, record_id, "b", numeric_cast<int64_t>(2));
     db.Update(collection, record_id, "a", numeric_cast<int64_t>(3));
 
@@ -576,7 +704,7 @@ TEST_CASE("DataBaseRejectsNonFiniteFloatDocuments")
 
     AnyData::Document plain_doc;
     plain_doc.Assign("value", std::numeric_limits<float64_t>::infinity());
-    CHECK_THROWS_AS(db.Insert(collection, ident_t {1001}, plain_doc), DataBaseException);
+    CHECK_THROWS_AS(db.Insert(collection, ident_t {1001}, AnyData::PackedDocument(plain_doc)), DataBaseException);
 
     AnyData::Array values;
     values.EmplaceBack(numeric_cast<int64_t>(1));
@@ -584,7 +712,7 @@ TEST_CASE("DataBaseRejectsNonFiniteFloatDocuments")
 
     AnyData::Document array_doc;
     array_doc.Assign("values", AnyData::Value {std::move(values)});
-    CHECK_THROWS_AS(db.Insert(collection, ident_t {1002}, array_doc), DataBaseException);
+    CHECK_THROWS_AS(db.Insert(collection, ident_t {1002}, AnyData::PackedDocument(array_doc)), DataBaseException);
 
     AnyData::Dict nested;
     nested.Emplace("value", std::numeric_limits<float64_t>::infinity());
@@ -602,7 +730,7 @@ TEST_CASE("DataBaseGetDocumentAppliesConcurrentPendingChange")
     db.PrimeRecord(collection, record_id, MakeDoc({{"value", 1}}));
     db.SetOnGetRecord([&] { db.Update(collection, record_id, "value", numeric_cast<int64_t>(2)); });
 
-    auto doc = db.GetDocument(collection, record_id);
+    auto doc = db.GetDocument(collection, record_id).ToDocument();
 
     REQUIRE(!doc.Empty());
     CHECK(doc["value"].AsInt64() == 2);
@@ -636,7 +764,7 @@ TEST_CASE("DataBaseGetDocumentAppliesSameRecordChangesUnderLoad")
     auto doc_future = doc_promise.get_future();
     std::thread reader {[&] {
         try {
-            doc_promise.set_value(db.GetDocument(collection, record_id));
+            doc_promise.set_value(db.GetDocument(collection, record_id).ToDocument());
         }
         catch (...) {
             doc_promise.set_exception(std::current_exception());
@@ -689,7 +817,7 @@ TEST_CASE("DataBaseGetDocumentAppliesCommittedChangeCompletedDuringRead")
     auto doc_future = doc_promise.get_future();
     std::thread reader {[&] {
         try {
-            doc_promise.set_value(db.GetDocument(collection, record_id));
+            doc_promise.set_value(db.GetDocument(collection, record_id).ToDocument());
         }
         catch (...) {
             doc_promise.set_exception(std::current_exception());
@@ -722,7 +850,7 @@ TEST_CASE("DataBaseGetDocumentIgnoresOtherRecordChanges")
     db.PrimeRecord(collection, other_id, MakeDoc({{"value", 10}}));
     db.SetOnGetRecord([&] { db.Update(collection, other_id, "value", numeric_cast<int64_t>(20)); });
 
-    auto doc = db.GetDocument(collection, target_id);
+    auto doc = db.GetDocument(collection, target_id).ToDocument();
 
     REQUIRE(!doc.Empty());
     CHECK(doc["value"].AsInt64() == 1);
@@ -731,6 +859,59 @@ TEST_CASE("DataBaseGetDocumentIgnoresOtherRecordChanges")
     db.ClearChanges();
 }
 
+TEST_CASE("DataBaseGetDocumentReplaysOnlyOwnRecordChanges")
+{
+    GlobalSettings settings {false};
+    HashStorage hashes;
+    TestDataBase db {settings};
+    hstring collection = hashes.ToHashedString("test_collection");
+    ident_t replaced_id = ident_t {1001};
+    ident_t patched_id = ident_t {1002};
+    ident_t deleted_id = ident_t {1003};
+
+    db.PrimeRecord(collection, patched_id, MakeDoc({{"x", 1}, {"y", 2}}));
+    db.PrimeRecord(collection, deleted_id, MakeDoc({{"z", 1}}));
+
+    // Deep queue of unrelated changes around the interesting ones
+    auto queue_noise = [&](int64_t base) {
+        for (int64_t i = 0; i < 500; i++) {
+            db.Update(collection, ident_t {numeric_cast<int64_t>(5000 + i)}, "noise", base + i);
+        }
+    };
+
+    queue_noise(0);
+    db.Insert(collection, replaced_id, AnyData::PackedDocument(MakeDoc({{"a", 1}})));
+    db.Update(collection, replaced_id, "b", numeric_cast<int64_t>(2));
+    db.Update(collection, patched_id, "x", numeric_cast<int64_t>(5));
+    queue_noise(1000);
+    db.Delete(collection, replaced_id);
+    db.Delete(collection, deleted_id);
+    db.Insert(collection, replaced_id, AnyData::PackedDocument(MakeDoc({{"c", 3}})));
+    queue_noise(2000);
+    db.Update(collection, replaced_id, "c", numeric_cast<int64_t>(4));
+
+    auto check_docs = [&] {
+        auto replaced_doc = db.GetDocument(collection, replaced_id).ToDocument();
+        REQUIRE(replaced_doc.Size() == 1);
+        CHECK(replaced_doc["c"].AsInt64() == 4);
+
+        auto patched_doc = db.GetDocument(collection, patched_id).ToDocument();
+        REQUIRE(patched_doc.Size() == 2);
+        CHECK(patched_doc["x"].AsInt64() == 5);
+        CHECK(patched_doc["y"].AsInt64() == 2);
+
+        CHECK(db.GetDocument(collection, deleted_id).ToDocument().Empty());
+    };
+
+    check_docs();
+
+    db.StartCommitChanges();
+    db.WaitCommitChanges();
+
+    check_docs();
+    CHECK(db.SnapshotRecord(collection, replaced_id)["c"].AsInt64() == 4);
+}
+
 TEST_CASE("DataBaseGetDocumentIgnoresOtherRecordChangesUnderLoad")
 {
     GlobalSettings settings {false};
@@ -757,7 +938,7 @@ TEST_CASE("DataBaseGetDocumentIgnoresOtherRecordChangesUnderLoad")
     auto target_future = target_promise.get_future();
     std::thread target_reader {[&] {
         try {
-            target_promise.set_value(db.GetDocument(collection, target_id));
+            target_promise.set_value(db.GetDocument(collection, target_id).ToDocument());
         }
         catch (...) {
             target_promise.set_exception(std::current_exception());
@@ -816,7 +997,7 @@ TEST_CASE("DataBaseConcurrentProducersCommitAllRecords")
         workers.emplace_back([&, thread_index] {
             for (size_t record_index = 0; record_index < records_per_thread; record_index++) {
                 ident_t id = ident_t {numeric_cast<int64_t>(thread_index * 100 + record_index + 1)};
-                db.Insert(collection, id, MakeDoc({{"thread", numeric_cast<int64_t>(thread_index)}}));
+                db.Insert(collection, id, AnyData::PackedDocument(MakeDoc({{"thread", numeric_cast<int64_t>(thread_index)}})));
                 db.Update(collection, id, "record", numeric_cast<int64_t>(record_index));
                 db.Update(collection, id, "value", numeric_cast<int64_t>(thread_index * 1000 + record_index));
             }
@@ -859,7 +1040,7 @@ TEST_CASE("DataBaseSlowReadDoesNotBlockOtherReads")
     auto blocked_future = blocked_promise.get_future();
     std::thread blocked_reader {[&] {
         try {
-            blocked_promise.set_value(db.GetDocument(collection, blocked_id));
+            blocked_promise.set_value(db.GetDocument(collection, blocked_id).ToDocument());
         }
         catch (...) {
             blocked_promise.set_exception(std::current_exception());
@@ -872,7 +1053,7 @@ TEST_CASE("DataBaseSlowReadDoesNotBlockOtherReads")
     auto free_future = free_promise.get_future();
     std::thread free_reader {[&] {
         try {
-            free_promise.set_value(db.GetDocument(collection, free_id));
+            free_promise.set_value(db.GetDocument(collection, free_id).ToDocument());
         }
         catch (...) {
             free_promise.set_exception(std::current_exception());
@@ -1104,7 +1285,7 @@ TEST_CASE("DataBaseWaitCommitChangesReturnsAfterSpillToOplog")
         db.InitializeOpLogs();
         db.SetBackendWriteFailure();
         db.StartCommitChanges();
-        db.Insert(collection, ident_t {1001}, MakeDoc({{"value", 1}}));
+        db.Insert(collection, ident_t {1001}, AnyData::PackedDocument(MakeDoc({{"value", 1}})));
         db.WaitUntilCommitOperationWrittenToOpLog();
 
         mutex fallback_locker;
@@ -1138,6 +1319,87 @@ TEST_CASE("DataBaseWaitCommitChangesReturnsAfterSpillToOplog")
     CHECK(!pending_content->empty());
 }
 
+TEST_CASE("DataBaseAbortedBatchSpillsOnlyUnappliedOperations")
+{
+    GlobalSettings settings {false};
+    HashStorage hashes;
+    ScopedRecoveryLogs recovery_logs {"batch-partial-spill"};
+    ScopedCurrentPath current_path {*recovery_logs.Dir()};
+    ConfigureRecoverySettings(settings, recovery_logs.PendingPath());
+    hstring collection = hashes.ToHashedString("test_collection");
+
+    {
+        TestDataBase db {settings};
+        db.SetCommitBatching(8);
+        db.InitializeOpLogs();
+        db.SetBatchWriteFailureAfter(2);
+
+        // Replaying the applied insert over the updated record would be a conflict, so it must not reach the oplog
+        db.Insert(collection, ident_t {1001}, AnyData::PackedDocument(MakeDoc({{"value", 1}})));
+        db.Update(collection, ident_t {1001}, "value", numeric_cast<int64_t>(2));
+        db.Insert(collection, ident_t {1002}, AnyData::PackedDocument(MakeDoc({{"value", 3}})));
+        db.StartCommitChanges();
+        db.WaitUntilCommitOperationWrittenToOpLog();
+
+        auto pending_content = fs_read_file(recovery_logs.PendingPath());
+        REQUIRE(pending_content.has_value());
+        CHECK(std::ranges::count(*pending_content, '\n') == 1);
+        CHECK(pending_content->starts_with("insert test_collection 1002 "));
+        CHECK(db.SnapshotRecord(collection, ident_t {1001})["value"].AsInt64() == 2);
+        CHECK(db.SnapshotRecord(collection, ident_t {1002}).Empty());
+
+        db.SetBackendWriteFailure(false);
+        db.WaitUntilPendingChangesRestored();
+        db.WaitCommitChanges();
+
+        CHECK(db.GetDocument(collection, ident_t {1001}).ToDocument()["value"].AsInt64() == 2);
+        CHECK(db.GetDocument(collection, ident_t {1002}).ToDocument()["value"].AsInt64() == 3);
+    }
+
+    CheckRecoveryLogsCleared(recovery_logs);
+}
+
+TEST_CASE("DataBaseFlushIntervalHoldsPartialBatch")
+{
+    GlobalSettings settings {false};
+    HashStorage hashes;
+    TestDataBase db {settings};
+    hstring collection = hashes.ToHashedString("test_collection");
+
+    db.SetCommitBatching(4, std::chrono::seconds {30});
+    db.StartCommitChanges();
+
+    SECTION("WaitCommitChangesFlushesImmediately")
+    {
+        db.Insert(collection, ident_t {1001}, AnyData::PackedDocument(MakeDoc({{"value", 1}})));
+        std::this_thread::sleep_for(std::chrono::milliseconds {50});
+
+        CHECK(db.SnapshotRecord(collection, ident_t {1001}).Empty());
+
+        auto start = std::chrono::steady_clock::now();
+        db.WaitCommitChanges();
+
+        CHECK(std::chrono::steady_clock::now() - start < std::chrono::seconds {5});
+        CHECK(db.SnapshotRecord(collection, ident_t {1001})["value"].AsInt64() == 1);
+    }
+
+    SECTION("FullBatchIsCommittedWithoutWaiting")
+    {
+        for (int64_t i = 0; i < 4; i++) {
+            db.Insert(collection, ident_t {1001 + i}, AnyData::PackedDocument(MakeDoc({{"value", i}})));
+        }
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds {5};
+
+        while (db.SnapshotRecord(collection, ident_t {1004}).Empty() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds {1});
+        }
+
+        CHECK(db.SnapshotRecord(collection, ident_t {1001})["value"].AsInt64() == 0);
+        CHECK(db.SnapshotRecord(collection, ident_t {1004})["value"].AsInt64() == 3);
+    }
+}
+
 TEST_CASE("DataBaseSupportsStringKeys")
 {
     GlobalSettings settings {false};
@@ -1147,7 +1409,7 @@ TEST_CASE("DataBaseSupportsStringKeys")
     DataBaseKey record_id {string("steam:user-123")};
 
     db.StartCommitChanges();
-    db.Insert(collection, record_id, MakeDoc({{"value", 1}}));
+    db.Insert(collection, record_id, AnyData::PackedDocument(MakeDoc({{"value", 1}})));
     db.WaitCommitChanges();
 
     auto doc = db.SnapshotRecord(collection, record_id);
@@ -1179,7 +1441,7 @@ TEST_CASE("DataBaseJsonGetAllStringIdsDecodesStoredKeys")
 
     auto db = ConnectToDataBase(&settings, connection_info, collection_schemas, {});
 
-    db.Insert(collection, record_id, MakeDoc({{"value", 1}}));
+    db.Insert(collection, record_id, AnyData::PackedDocument(MakeDoc({{"value", 1}})));
     db.StartCommitChanges();
     db.WaitCommitChanges();
 
@@ -1262,7 +1524,7 @@ TEST_CASE("DataBaseRejectsInvalidUtf8StringKeys")
     hstring collection = hashes.ToHashedString("test_string_collection");
     DataBaseKey invalid_record_id {string(1, static_cast<char>(0xC3))};
 
-    REQUIRE_THROWS_AS(db.Insert(collection, invalid_record_id, MakeDoc({{"value", 1}})), DataBaseException);
+    REQUIRE_THROWS_AS(db.Insert(collection, invalid_record_id, AnyData::PackedDocument(MakeDoc({{"value", 1}}))), DataBaseException);
 }
 
 TEST_CASE("DataBaseRelaxedStringKeysKeepRawBackendIds")
@@ -1274,14 +1536,14 @@ TEST_CASE("DataBaseRelaxedStringKeysKeepRawBackendIds")
     DataBaseKey record_id {string("steam% user\n123")};
 
     db.StartCommitChanges();
-    db.Insert(collection, record_id, MakeDoc({{"value", 1}}));
+    db.Insert(collection, record_id, AnyData::PackedDocument(MakeDoc({{"value", 1}})));
     db.WaitCommitChanges();
 
     auto stored_ids = db.GetAllRecordIds(collection);
     REQUIRE(stored_ids.size() == 1);
     CHECK(stored_ids.front() == record_id);
 
-    auto doc = db.GetDocument(collection, record_id);
+    auto doc = db.GetDocument(collection, record_id).ToDocument();
     REQUIRE(!doc.Empty());
     CHECK(doc["value"].AsInt64() == 1);
 }
@@ -1295,7 +1557,7 @@ TEST_CASE("DataBaseFileStringKeysEncodeBackendIds")
     DataBaseKey record_id {string("steam user/123")};
 
     db.StartCommitChanges();
-    db.Insert(collection, record_id, MakeDoc({{"value", 1}}));
+    db.Insert(collection, record_id, AnyData::PackedDocument(MakeDoc({{"value", 1}})));
     db.WaitCommitChanges();
 
     auto stored_ids = db.GetAllRecordIds(collection);
@@ -1303,7 +1565,7 @@ TEST_CASE("DataBaseFileStringKeysEncodeBackendIds")
     REQUIRE(std::holds_alternative<string>(stored_ids.front()));
     CHECK(std::get<string>(stored_ids.front()) == "steam%20user%2f123");
 
-    auto doc = db.GetDocument(collection, record_id);
+    auto doc = db.GetDocument(collection, record_id).ToDocument();
     REQUIRE(!doc.Empty());
     CHECK(doc["value"].AsInt64() == 1);
 }
@@ -1317,7 +1579,7 @@ TEST_CASE("DataBaseHexStringKeysEncodeBackendIds")
     DataBaseKey record_id {string("steam:user-123")};
 
     db.StartCommitChanges();
-    db.Insert(collection, record_id, MakeDoc({{"value", 1}}));
+    db.Insert(collection, record_id, AnyData::PackedDocument(MakeDoc({{"value", 1}})));
     db.WaitCommitChanges();
 
     auto stored_ids = db.GetAllRecordIds(collection);
@@ -1325,7 +1587,7 @@ TEST_CASE("DataBaseHexStringKeysEncodeBackendIds")
     REQUIRE(std::holds_alternative<string>(stored_ids.front()));
     CHECK(std::get<string>(stored_ids.front()) == "s_737465616d3a757365722d313233");
 
-    auto doc = db.GetDocument(collection, record_id);
+    auto doc = db.GetDocument(collection, record_id).ToDocument();
     REQUIRE(!doc.Empty());
     CHECK(doc["value"].AsInt64() == 1);
 }
@@ -1345,7 +1607,7 @@ TEST_CASE("DataBaseReconnectRestoresPendingChangesFromOplog")
         db.InitializeOpLogs();
         db.SetBackendWriteFailure();
         db.StartCommitChanges();
-        db.Insert(collection, record_id, MakeDoc({{"value", 1}}));
+        db.Insert(collection, record_id, AnyData::PackedDocument(MakeDoc({{"value", 1}})));
         db.WaitUntilCommitOperationWrittenToOpLog();
 
         CHECK(db.SnapshotRecord(collection, record_id).Empty());
@@ -1354,7 +1616,7 @@ TEST_CASE("DataBaseReconnectRestoresPendingChangesFromOplog")
         db.WaitUntilPendingChangesRestored();
         db.WaitCommitChanges();
 
-        auto doc = db.GetDocument(collection, record_id);
+        auto doc = db.GetDocument(collection, record_id).ToDocument();
         REQUIRE(!doc.Empty());
         CHECK(doc["value"].AsInt64() == 1);
     }
@@ -1377,7 +1639,7 @@ TEST_CASE("DataBaseReconnectRestoresComplexDocumentFromOplog")
         db.InitializeOpLogs();
         db.SetBackendWriteFailure();
         db.StartCommitChanges();
-        db.Insert(collection, record_id, MakeComplexDoc());
+        db.Insert(collection, record_id, AnyData::PackedDocument(MakeComplexDoc()));
         db.WaitUntilCommitOperationWrittenToOpLog();
 
         CHECK(db.SnapshotRecord(collection, record_id).Empty());
@@ -1386,7 +1648,7 @@ TEST_CASE("DataBaseReconnectRestoresComplexDocumentFromOplog")
         db.WaitUntilPendingChangesRestored();
         db.WaitCommitChanges();
 
-        CheckComplexDoc(db.GetDocument(collection, record_id));
+        CheckComplexDoc(db.GetDocument(collection, record_id).ToDocument());
     }
 
     CheckRecoveryLogsCleared(recovery_logs);
@@ -1407,7 +1669,7 @@ TEST_CASE("DataBaseReconnectRestoresStringKeyChangesFromOplog")
         db.InitializeOpLogs();
         db.SetBackendWriteFailure();
         db.StartCommitChanges();
-        db.Insert(collection, record_id, MakeDoc({{"value", 1}}));
+        db.Insert(collection, record_id, AnyData::PackedDocument(MakeDoc({{"value", 1}})));
         db.WaitUntilCommitOperationWrittenToOpLog();
 
         CHECK(db.SnapshotRecord(collection, record_id).Empty());
@@ -1416,7 +1678,7 @@ TEST_CASE("DataBaseReconnectRestoresStringKeyChangesFromOplog")
         db.WaitUntilPendingChangesRestored();
         db.WaitCommitChanges();
 
-        auto doc = db.GetDocument(collection, record_id);
+        auto doc = db.GetDocument(collection, record_id).ToDocument();
         REQUIRE(!doc.Empty());
         CHECK(doc["value"].AsInt64() == 1);
     }
@@ -1439,7 +1701,7 @@ TEST_CASE("DataBaseReconnectRestoresRelaxedStringKeysFromOplog")
         db.InitializeOpLogs();
         db.SetBackendWriteFailure();
         db.StartCommitChanges();
-        db.Insert(collection, record_id, MakeDoc({{"value", 1}}));
+        db.Insert(collection, record_id, AnyData::PackedDocument(MakeDoc({{"value", 1}})));
         db.WaitUntilCommitOperationWrittenToOpLog();
 
         CHECK(db.SnapshotRecord(collection, record_id).Empty());
@@ -1452,7 +1714,7 @@ TEST_CASE("DataBaseReconnectRestoresRelaxedStringKeysFromOplog")
         REQUIRE(stored_ids.size() == 1);
         CHECK(stored_ids.front() == record_id);
 
-        auto doc = db.GetDocument(collection, record_id);
+        auto doc = db.GetDocument(collection, record_id).ToDocument();
         REQUIRE(!doc.Empty());
         CHECK(doc["value"].AsInt64() == 1);
     }
@@ -1475,7 +1737,7 @@ TEST_CASE("DataBaseReconnectRestoresFileStringKeysFromOplog")
         db.InitializeOpLogs();
         db.SetBackendWriteFailure();
         db.StartCommitChanges();
-        db.Insert(collection, record_id, MakeDoc({{"value", 1}}));
+        db.Insert(collection, record_id, AnyData::PackedDocument(MakeDoc({{"value", 1}})));
         db.WaitUntilCommitOperationWrittenToOpLog();
 
         CHECK(db.SnapshotRecord(collection, record_id).Empty());
@@ -1489,7 +1751,7 @@ TEST_CASE("DataBaseReconnectRestoresFileStringKeysFromOplog")
         REQUIRE(std::holds_alternative<string>(stored_ids.front()));
         CHECK(std::get<string>(stored_ids.front()) == "steam%25%20user%2f123");
 
-        auto doc = db.GetDocument(collection, record_id);
+        auto doc = db.GetDocument(collection, record_id).ToDocument();
         REQUIRE(!doc.Empty());
         CHECK(doc["value"].AsInt64() == 1);
     }
@@ -1512,7 +1774,7 @@ TEST_CASE("DataBaseReconnectRestoresHexStringKeysFromOplog")
         db.InitializeOpLogs();
         db.SetBackendWriteFailure();
         db.StartCommitChanges();
-        db.Insert(collection, record_id, MakeDoc({{"value", 1}}));
+        db.Insert(collection, record_id, AnyData::PackedDocument(MakeDoc({{"value", 1}})));
         db.WaitUntilCommitOperationWrittenToOpLog();
 
         CHECK(db.SnapshotRecord(collection, record_id).Empty());
@@ -1526,7 +1788,7 @@ TEST_CASE("DataBaseReconnectRestoresHexStringKeysFromOplog")
         REQUIRE(std::holds_alternative<string>(stored_ids.front()));
         CHECK(std::get<string>(stored_ids.front()) == "s_737465616d253a757365722d313233");
 
-        auto doc = db.GetDocument(collection, record_id);
+        auto doc = db.GetDocument(collection, record_id).ToDocument();
         REQUIRE(!doc.Empty());
         CHECK(doc["value"].AsInt64() == 1);
     }
@@ -1548,9 +1810,9 @@ TEST_CASE("JsonDataBaseRoundTripsDocumentsAndIds")
     *FixedSettingForOverride(settings.JsonIndent) = 2;
     auto db = ConnectToDataBase(&settings, strex("JSON {}", storage_dir).str(), collection_schemas, {});
 
-    db.Insert(collection, first_id, MakeDoc({{"value", 1}, {"other", 7}}));
-    db.Insert(collection, second_id, MakeDoc({{"value", 2}}));
-    db.Insert(collection, complex_id, MakeComplexDoc());
+    db.Insert(collection, first_id, AnyData::PackedDocument(MakeDoc({{"value", 1}, {"other", 7}})));
+    db.Insert(collection, second_id, AnyData::PackedDocument(MakeDoc({{"value", 2}})));
+    db.Insert(collection, complex_id, AnyData::PackedDocument(MakeComplexDoc()));
     db.StartCommitChanges();
     db.WaitCommitChanges();
 
@@ -1610,6 +1872,186 @@ TEST_CASE("JsonDataBaseRejectsBrokenStorageFiles")
     REQUIRE_THROWS_AS(db.Get(collection, ident_t {1001}), DataBaseException);
 }
 
+TEST_CASE("JsonStorageFormatMatchesGoldenFile")
+{
+    AnyData::Document doc = MakeComplexDoc();
+    doc.Assign("escaped", string {"q\"b\\n\n\x01 \xc3\xa9"});
+    doc.Assign("whole", 100.0);
+    doc.Assign("neg", numeric_cast<int64_t>(-5));
+    doc.Assign("empty", AnyData::Value {AnyData::Array {}});
+
+    constexpr string_view pretty_golden = R"({
+  "array": [
+    {
+      "$numberLong": "7"
+    },
+    {
+      "$numberDouble": "2.5"
+    },
+    false,
+    "array"
+  ],
+  "bool": true,
+  "dict": {
+    "flag": true,
+    "label": "nested",
+    "score": {
+      "$numberLong": "9"
+    }
+  },
+  "empty": [],
+  "escaped": "q\"b\\n\n\u0001 é",
+  "float": {
+    "$numberDouble": "3.25"
+  },
+  "int": {
+    "$numberLong": "42"
+  },
+  "neg": {
+    "$numberLong": "-5"
+  },
+  "string": "text",
+  "whole": {
+    "$numberDouble": "100.0"
+  }
+})";
+    constexpr string_view compact_golden =
+        R"({"array":[{"$numberLong":"7"},{"$numberDouble":"2.5"},false,"array"],"bool":true,"dict":{"flag":true,"label":"nested","score":{"$numberLong":"9"}},"empty":[],"escaped":"q\"b\\n\n\u0001 é","float":{"$numberDouble":"3.25"},"int":{"$numberLong":"42"},"neg":{"$numberLong":"-5"},"string":"text","whole":{"$numberDouble":"100.0"}})";
+
+    CHECK(DocumentToJsonStorage(doc, 2) == pretty_golden);
+    CHECK(DocumentToJsonStorage(doc, 0) == compact_golden);
+    CHECK(MakeLegacyJsonStorage(doc, 2) == pretty_golden);
+    CHECK(MakeLegacyJsonStorage(doc, 0) == compact_golden);
+}
+
+TEST_CASE("JsonStorageFormatKeepsNonFiniteDoubles")
+{
+    AnyData::Document doc;
+    doc.Assign("inf", std::numeric_limits<float64_t>::infinity());
+    doc.Assign("nan", std::numeric_limits<float64_t>::quiet_NaN());
+    doc.Assign("neg_inf", -std::numeric_limits<float64_t>::infinity());
+
+    constexpr string_view compact_golden = R"({"inf":{"$numberDouble":"Infinity"},"nan":{"$numberDouble":"NaN"},"neg_inf":{"$numberDouble":"-Infinity"}})";
+
+    // Canonical extended JSON spelling, as libbson wrote and read these values for the storage files
+    CHECK(DocumentToJsonStorage(doc, 0) == compact_golden);
+
+    AnyData::Document parsed;
+    JsonStorageToDocument(DocumentToJsonStorage(doc, 2), parsed);
+
+    REQUIRE(parsed.Size() == 3);
+    CHECK(parsed["inf"].AsDouble() == std::numeric_limits<float64_t>::infinity());
+    CHECK(parsed["neg_inf"].AsDouble() == -std::numeric_limits<float64_t>::infinity());
+    CHECK(std::isnan(parsed["nan"].AsDouble()));
+}
+
+TEST_CASE("JsonStorageFormatMatchesLegacyConversion")
+{
+    for (uint64_t seed = 1; seed <= 200; seed++) {
+        auto doc = MakeSyntheticJsonDoc(seed, 12);
+
+        for (int32_t indent : {0, 2, 4}) {
+            string json = DocumentToJsonStorage(doc, indent);
+            REQUIRE(json == MakeLegacyJsonStorage(doc, indent));
+
+            AnyData::Document parsed;
+            JsonStorageToDocument(json, parsed);
+            REQUIRE(parsed == doc);
+        }
+    }
+}
+
+TEST_CASE("JsonStorageReaderAcceptsLegacyFormsAndRejectsBrokenInput")
+{
+    AnyData::Document doc;
+    JsonStorageToDocument(R"({"_id": {"$oid": "0"}, "plain": 5, "real": -1.5e3, "int32": {"$numberInt": "-7"}, "text": "é😀\/", "dict": {"$numberLong": 1}})", doc);
+
+    REQUIRE(doc.Size() == 5);
+    CHECK_FALSE(doc.Contains("_id"));
+    CHECK(doc["plain"].AsInt64() == 5);
+    CHECK(doc["real"].AsDouble() == -1500.0);
+    CHECK(doc["int32"].AsInt64() == -7);
+    CHECK(doc["text"].AsString() == "\xc3\xa9\xf0\x9f\x98\x80/");
+    CHECK(doc["dict"].AsDict()["$numberLong"].AsInt64() == 1);
+
+    for (string_view broken : {"{", "[]", R"({"a": null})", R"({"a": 1} x)", R"({"a": "\ud800"})", R"({"a": {"$numberDouble": "inf"}})", "{\"a\": \"\xff\"}"}) {
+        AnyData::Document broken_doc;
+        CHECK_THROWS_AS(JsonStorageToDocument(broken, broken_doc), DataBaseException);
+    }
+
+    AnyData::Document invalid_utf8;
+    invalid_utf8.Assign("text", string {"\xed\xa0\x80"});
+    CHECK_THROWS_AS(DocumentToJsonStorage(invalid_utf8, 2), DataBaseException);
+}
+
+TEST_CASE("JsonStorageSerializationPerformance", "[!benchmark][database]")
+{
+    vector<AnyData::Document> docs;
+
+    for (uint64_t seed = 1; seed <= 100; seed++) {
+        docs.emplace_back(MakeSyntheticJsonDoc(seed, 64));
+    }
+
+    vector<string> stored;
+
+    for (const auto& doc : docs) {
+        stored.emplace_back(DocumentToJsonStorage(doc, 4));
+    }
+
+    BENCHMARK("Write 100 documents, streaming")
+    {
+        size_t total = 0;
+
+        for (const auto& doc : docs) {
+            total += DocumentToJsonStorage(doc, 4).size();
+        }
+
+        return total;
+    };
+
+    BENCHMARK("Write 100 documents, bson and nlohmann chain")
+    {
+        size_t total = 0;
+
+        for (const auto& doc : docs) {
+            total += MakeLegacyJsonStorage(doc, 4).size();
+        }
+
+        return total;
+    };
+
+    BENCHMARK("Read 100 documents, streaming")
+    {
+        size_t total = 0;
+
+        for (const auto& json : stored) {
+            AnyData::Document doc;
+            JsonStorageToDocument(json, doc);
+            total += doc.Size();
+        }
+
+        return total;
+    };
+
+    BENCHMARK("Read 100 documents, bson")
+    {
+        size_t total = 0;
+
+        for (const auto& json : stored) {
+            bson_t bson;
+            bson_error_t error;
+            REQUIRE(bson_init_from_json(&bson, json.c_str(), numeric_cast<ssize_t>(json.length()), &error));
+            auto destroy_bson = scope_exit([&]() noexcept { bson_destroy(&bson); });
+
+            AnyData::Document doc;
+            BsonToDocument(&bson, doc);
+            total += doc.Size();
+        }
+
+        return total;
+    };
+}
+
 TEST_CASE("MemoryDataBaseRoundTripsDocumentsAndIds")
 {
     GlobalSettings settings {false};
@@ -1626,8 +2068,8 @@ TEST_CASE("MemoryDataBaseRoundTripsDocumentsAndIds")
     CHECK(db.Get(collection, first_id).Empty());
 
     db.StartCommitChanges();
-    db.Insert(collection, first_id, MakeDoc({{"value", 1}, {"other", 7}}));
-    db.Insert(collection, second_id, MakeDoc({{"value", 2}}));
+    db.Insert(collection, first_id, AnyData::PackedDocument(MakeDoc({{"value", 1}, {"other", 7}})));
+    db.Insert(collection, second_id, AnyData::PackedDocument(MakeDoc({{"value", 2}})));
     db.WaitCommitChanges();
 
     auto ids = db.GetAllIntIds(collection);
@@ -1672,7 +2114,7 @@ TEST_CASE("DataBaseConnectionValidationAndMetrics")
 
     auto db = ConnectToDataBase(&settings, "Memory", collection_schemas, {});
     db.StartCommitChanges();
-    db.Insert(collection, record_id, MakeDoc({{"value", 1}}));
+    db.Insert(collection, record_id, AnyData::PackedDocument(MakeDoc({{"value", 1}})));
     db.WaitCommitChanges();
 
     auto doc = db.Get(collection, record_id);
@@ -1700,8 +2142,8 @@ TEST_CASE("SQLiteDataBaseRoundTripsDocumentsAndIds")
     CHECK(db.Get(collection, first_id).Empty());
 
     db.StartCommitChanges();
-    db.Insert(collection, first_id, MakeDoc({{"value", 1}, {"other", 7}}));
-    db.Insert(collection, second_id, MakeDoc({{"value", 2}}));
+    db.Insert(collection, first_id, AnyData::PackedDocument(MakeDoc({{"value", 1}, {"other", 7}})));
+    db.Insert(collection, second_id, AnyData::PackedDocument(MakeDoc({{"value", 2}})));
     db.WaitCommitChanges();
 
     auto ids = db.GetAllIntIds(collection);
@@ -1753,8 +2195,8 @@ TEST_CASE("SQLiteDataBasePersistsDocumentsAcrossReconnects")
         auto db = ConnectToDataBase(&settings, connection_info, collection_schemas, {});
 
         db.StartCommitChanges();
-        db.Insert(int_collection, int_id, MakeDoc({{"value", 1}}));
-        db.Insert(string_collection, string_id, MakeDoc({{"value", 2}}));
+        db.Insert(int_collection, int_id, AnyData::PackedDocument(MakeDoc({{"value", 1}})));
+        db.Insert(string_collection, string_id, AnyData::PackedDocument(MakeDoc({{"value", 2}})));
         db.WaitCommitChanges();
 
         db.Update(int_collection, int_id, "patched", numeric_cast<int64_t>(7));
@@ -1839,6 +2281,252 @@ TEST_CASE("SQLiteDataBaseRejectsCorruptedStoredKeys")
         REQUIRE_THROWS_AS(db.GetAllStringIds(string_collection), DataBaseException);
     }
 }
+
+TEST_CASE("SQLiteDataBaseCommitsBatchedChangesInOrder")
+{
+    GlobalSettings settings {false};
+    HashStorage hashes;
+    ScopedRecoveryLogs storage_dir_scope {"sqlite-batches"};
+    string storage_dir = fs_path_to_string(*storage_dir_scope.Dir() / "storage");
+    hstring collection = hashes.ToHashedString("test_collection");
+    auto collection_schemas = DataBaseCollectionSchemas {{collection, DataBaseKeyType::IntId}};
+
+    *FixedSettingForOverride(settings.SQLiteCommitBatchSize) = 4;
+    *FixedSettingForOverride(settings.SQLiteSynchronous) = "full";
+
+    auto db = ConnectToDataBase(&settings, strex("DbSQLite {}", storage_dir).str(), collection_schemas, {});
+
+    for (int64_t i = 1; i <= 10; i++) {
+        db.Insert(collection, ident_t {1000 + i}, AnyData::PackedDocument(MakeDoc({{"value", i}})));
+        db.Update(collection, ident_t {1000 + i}, "value", numeric_cast<int64_t>(i * 10));
+    }
+
+    db.Delete(collection, ident_t {1001});
+
+    db.StartCommitChanges();
+    db.WaitCommitChanges();
+
+    CHECK(db.InValidState());
+    CHECK(db.GetAllIntIds(collection).size() == 9);
+    CHECK_FALSE(db.Valid(collection, ident_t {1001}));
+
+    for (int64_t i = 2; i <= 10; i++) {
+        auto doc = db.Get(collection, ident_t {1000 + i});
+        REQUIRE(!doc.Empty());
+        CHECK(doc["value"].AsInt64() == i * 10);
+    }
+}
+
+TEST_CASE("SQLiteDataBaseRejectsInvalidSettings")
+{
+    GlobalSettings settings {false};
+    HashStorage hashes;
+    ScopedRecoveryLogs storage_dir_scope {"sqlite-invalid-settings"};
+    string storage_dir = fs_path_to_string(*storage_dir_scope.Dir() / "storage");
+    auto collection_schemas = DataBaseCollectionSchemas {{hashes.ToHashedString("test_collection"), DataBaseKeyType::IntId}};
+
+    SECTION("Unknown synchronous level")
+    {
+        *FixedSettingForOverride(settings.SQLiteSynchronous) = "SOMETIMES";
+
+        REQUIRE_THROWS_AS(ConnectToDataBase(&settings, strex("DbSQLite {}", storage_dir).str(), collection_schemas, {}), DataBaseException);
+    }
+
+    SECTION("Malformed hot property")
+    {
+        *FixedSettingForOverride(settings.SQLiteHotProperties) = vector<string> {"test_collection"};
+
+        REQUIRE_THROWS_AS(ConnectToDataBase(&settings, strex("DbSQLite {}", storage_dir).str(), collection_schemas, {}), DataBaseException);
+    }
+
+    SECTION("Duplicate hot property")
+    {
+        *FixedSettingForOverride(settings.SQLiteHotProperties) = vector<string> {"test_collection:hot", " test_collection : hot "};
+
+        REQUIRE_THROWS_AS(ConnectToDataBase(&settings, strex("DbSQLite {}", storage_dir).str(), collection_schemas, {}), DataBaseException);
+    }
+}
+
+TEST_CASE("SQLiteDataBaseStoresHotPropertiesInOwnColumns")
+{
+    GlobalSettings settings {false};
+    HashStorage hashes;
+    ScopedRecoveryLogs storage_dir_scope {"sqlite-hot-columns"};
+    string storage_dir = fs_path_to_string(*storage_dir_scope.Dir() / "storage");
+    hstring collection = hashes.ToHashedString("test_collection");
+    auto collection_schemas = DataBaseCollectionSchemas {{collection, DataBaseKeyType::IntId}};
+    string connection_info = strex("DbSQLite {}", storage_dir).str();
+    ident_t record_id = ident_t {1001};
+    ident_t legacy_id = ident_t {1002};
+
+    // A record written before the hot layout keeps its value in the blob until the column is first written
+    {
+        auto db = ConnectToDataBase(&settings, connection_info, collection_schemas, {});
+
+        db.StartCommitChanges();
+        db.Insert(collection, legacy_id, AnyData::PackedDocument(MakeDoc({{"hot", 1}, {"cold", 2}})));
+        db.WaitCommitChanges();
+    }
+
+    *FixedSettingForOverride(settings.SQLiteHotProperties) = vector<string> {"test_collection:hot"};
+
+    {
+        auto db = ConnectToDataBase(&settings, connection_info, collection_schemas, {});
+
+        db.StartCommitChanges();
+        db.Insert(collection, record_id, AnyData::PackedDocument(MakeDoc({{"hot", 3}, {"cold", 4}})));
+        db.Update(collection, record_id, "hot", numeric_cast<int64_t>(5));
+        db.Update(collection, record_id, "cold", numeric_cast<int64_t>(6));
+        db.WaitCommitChanges();
+
+        auto doc = db.Get(collection, record_id);
+        REQUIRE(doc.Size() == 2);
+        CHECK(doc["hot"].AsInt64() == 5);
+        CHECK(doc["cold"].AsInt64() == 6);
+
+        doc = db.Get(collection, legacy_id);
+        REQUIRE(doc.Size() == 2);
+        CHECK(doc["hot"].AsInt64() == 1);
+
+        db.Update(collection, legacy_id, "hot", numeric_cast<int64_t>(7));
+        db.WaitCommitChanges();
+
+        doc = db.Get(collection, legacy_id);
+        CHECK(doc["hot"].AsInt64() == 7);
+        CHECK(doc["cold"].AsInt64() == 2);
+        CHECK(db.InValidState());
+    }
+
+    {
+        string db_path = fs_path_to_string(*storage_dir_scope.Dir() / "storage" / "Storage.sqlite");
+        sqlite3* raw_db = nullptr;
+        REQUIRE(sqlite3_open_v2(db_path.c_str(), &raw_db, SQLITE_OPEN_READONLY, nullptr) == SQLITE_OK);
+
+        auto close_db = scope_exit([&]() noexcept { (void)sqlite3_close(raw_db); });
+
+        sqlite3_stmt* stmt = nullptr;
+        REQUIRE(sqlite3_prepare_v2(raw_db, R"(SELECT COUNT(*) FROM "test_collection" WHERE "hot_hot" IS NOT NULL)", -1, &stmt, nullptr) == SQLITE_OK);
+
+        auto finalize_stmt = scope_exit([&]() noexcept { (void)sqlite3_finalize(stmt); });
+
+        REQUIRE(sqlite3_step(stmt) == SQLITE_ROW);
+        CHECK(sqlite3_column_int(stmt, 0) == 2);
+    }
+
+    // Existing hot columns keep being served after the key is dropped from settings
+    *FixedSettingForOverride(settings.SQLiteHotProperties) = vector<string> {};
+
+    {
+        auto db = ConnectToDataBase(&settings, connection_info, collection_schemas, {});
+
+        auto doc = db.Get(collection, record_id);
+        CHECK(doc["hot"].AsInt64() == 5);
+        CHECK(doc["cold"].AsInt64() == 6);
+
+        doc = db.Get(collection, legacy_id);
+        CHECK(doc["hot"].AsInt64() == 7);
+    }
+}
+
+TEST_CASE("SQLiteDataBaseReadsLegacyBsonRows")
+{
+    GlobalSettings settings {false};
+    HashStorage hashes;
+    ScopedRecoveryLogs storage_dir_scope {"sqlite-legacy-bson"};
+    string storage_dir = fs_path_to_string(*storage_dir_scope.Dir() / "storage");
+    hstring collection = hashes.ToHashedString("test_collection");
+    auto collection_schemas = DataBaseCollectionSchemas {{collection, DataBaseKeyType::IntId}};
+    ident_t record_id = ident_t {1001};
+
+    {
+        bson_t bson;
+        bson_init(&bson);
+        auto destroy_bson = scope_exit([&]() noexcept { bson_destroy(&bson); });
+        DocumentToBson(MakeDoc({{"a", 1}, {"b", 2}}), &bson);
+
+        vector<uint8_t> key_data(sizeof(int64_t));
+        int64_t key_value = record_id.underlying_value();
+        MemCopy(key_data.data(), &key_value, sizeof(key_value));
+
+        StoreRawSQLiteRecord(*storage_dir_scope.Dir() / "storage", "test_collection", key_data, span_to_string(make_const_span(bson_get_data(&bson), bson.len)));
+    }
+
+    auto db = ConnectToDataBase(&settings, strex("DbSQLite {}", storage_dir).str(), collection_schemas, {});
+
+    auto doc = db.Get(collection, record_id);
+    REQUIRE(doc.Size() == 2);
+    CHECK(doc["a"].AsInt64() == 1);
+    CHECK(doc["b"].AsInt64() == 2);
+
+    // The first update rewrites the row in packed form, the result stays readable
+    db.StartCommitChanges();
+    db.Update(collection, record_id, "b", numeric_cast<int64_t>(3));
+    db.WaitCommitChanges();
+
+    doc = db.Get(collection, record_id);
+    REQUIRE(doc.Size() == 2);
+    CHECK(doc["a"].AsInt64() == 1);
+    CHECK(doc["b"].AsInt64() == 3);
+    CHECK(db.InValidState());
+}
+
+TEST_CASE("SQLiteDataBaseUpdatePerformance", "[!benchmark][database]")
+{
+    constexpr int64_t record_count = 1000;
+    constexpr int64_t update_count = 100000;
+
+    auto make_record = [](int64_t index) {
+        AnyData::Document doc;
+        doc.Assign("hot", index);
+
+        // A few kilobytes of cold payload, like a persisted critter with inventory and script state
+        for (int64_t i = 0; i < 64; i++) {
+            doc.Assign(strex("cold_{}", i).str(), string(48, static_cast<char>('a' + i % 26)));
+        }
+
+        return doc;
+    };
+
+    auto run_scenario = [&](string_view name, int32_t batch_size, vector<string> hot_properties) {
+        GlobalSettings settings {false};
+        HashStorage hashes;
+        ScopedRecoveryLogs storage_dir_scope {strex("sqlite-perf-{}", batch_size).str()};
+        string storage_dir = fs_path_to_string(*storage_dir_scope.Dir() / "storage");
+        hstring collection = hashes.ToHashedString("test_collection");
+        auto collection_schemas = DataBaseCollectionSchemas {{collection, DataBaseKeyType::IntId}};
+
+        *FixedSettingForOverride(settings.SQLiteCommitBatchSize) = batch_size;
+        *FixedSettingForOverride(settings.SQLiteHotProperties) = std::move(hot_properties);
+
+        auto db = ConnectToDataBase(&settings, strex("DbSQLite {}", storage_dir).str(), collection_schemas, {});
+
+        db.StartCommitChanges();
+
+        for (int64_t i = 1; i <= record_count; i++) {
+            db.Insert(collection, ident_t {i}, AnyData::PackedDocument(make_record(i)));
+        }
+
+        db.WaitCommitChanges();
+
+        BENCHMARK_ADVANCED(string(name))(Catch::Benchmark::Chronometer meter)
+        {
+            meter.measure([&] {
+                for (int64_t i = 0; i < update_count; i++) {
+                    db.Update(collection, ident_t {i % record_count + 1}, "hot", i);
+                }
+
+                db.WaitCommitChanges();
+                return db.GetDbRequestsPerMinute();
+            });
+        };
+
+        CHECK(db.InValidState());
+    };
+
+    run_scenario("100k updates, statement per change", 1, {});
+    run_scenario("100k updates, batched transactions", 256, {});
+    run_scenario("100k updates, batched transactions with hot column", 256, {"test_collection:hot"});
+}
 #endif
 
 FO_END_NAMESPACE
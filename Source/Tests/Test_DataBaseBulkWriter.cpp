@@ -0,0 +1,192 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "DataBaseBulkWriter.h"
+
+FO_BEGIN_NAMESPACE
+
+namespace
+{
+    // Stands in for the driver: remembers every bulk request and can fail one of them at a given operation
+    class RecordingBulkSink final : public DataBaseBulkSink
+    {
+    public:
+        struct Request
+        {
+            hstring CollectionName {};
+            vector<pair<DataBaseBulkOperationType, DataBaseKey>> Ops {};
+        };
+
+        auto ExecuteBulk(hstring collection_name, const_span<DataBaseBulkOperation> ops) -> optional<DataBaseBulkFailure> override
+        {
+            auto& request = Requests.emplace_back();
+            request.CollectionName = collection_name;
+
+            for (const auto& op : ops) {
+                request.Ops.emplace_back(op.Type, op.RecordId);
+            }
+
+            if (FailRequest.has_value() && FailRequest.value() == Requests.size() - 1) {
+                return DataBaseBulkFailure {.OperationIndex = FailOperation, .Message = "simulated"};
+            }
+
+            return std::nullopt;
+        }
+
+        vector<Request> Requests {};
+        optional<size_t> FailRequest {};
+        optional<size_t> FailOperation {};
+    };
+
+    auto MakeBulkDoc(int64_t value) -> AnyData::PackedDocument
+    {
+        AnyData::PackedDocumentBuilder builder;
+        builder.Add("value", value);
+        return builder.Finish();
+    }
+} // namespace
+
+TEST_CASE("DataBaseBulkWriter")
+{
+    HashStorage hashes;
+    hstring critters = hashes.ToHashedString("Critters");
+    hstring items = hashes.ToHashedString("Items");
+    RecordingBulkSink sink;
+    DataBaseBulkWriter writer {&sink};
+
+    SECTION("GroupsOperationsPerCollectionInCommitOrder")
+    {
+        writer.Begin();
+        writer.Add(critters, DataBaseBulkOperationType::Update, ident_t {1}, MakeBulkDoc(1));
+        writer.Add(items, DataBaseBulkOperationType::Update, ident_t {10}, MakeBulkDoc(2));
+        writer.Add(critters, DataBaseBulkOperationType::Update, ident_t {2}, MakeBulkDoc(3));
+        writer.Add(items, DataBaseBulkOperationType::Delete, ident_t {11}, {});
+        writer.Add(critters, DataBaseBulkOperationType::Update, ident_t {1}, MakeBulkDoc(4));
+
+        CHECK(writer.GetPendingCount() == 5);
+
+        writer.Flush();
+
+        CHECK_FALSE(writer.IsOpen());
+        CHECK(writer.GetPendingCount() == 0);
+        REQUIRE(sink.Requests.size() == 2);
+        CHECK(sink.Requests[0].CollectionName == critters);
+        CHECK(sink.Requests[0].Ops == vector<pair<DataBaseBulkOperationType, DataBaseKey>> {{DataBaseBulkOperationType::Update, ident_t {1}}, {DataBaseBulkOperationType::Update, ident_t {2}}, {DataBaseBulkOperationType::Update, ident_t {1}}});
+        CHECK(sink.Requests[1].CollectionName == items);
+        CHECK(sink.Requests[1].Ops == vector<pair<DataBaseBulkOperationType, DataBaseKey>> {{DataBaseBulkOperationType::Update, ident_t {10}}, {DataBaseBulkOperationType::Delete, ident_t {11}}});
+
+        for (size_t i = 0; i < 5; i++) {
+            CHECK(writer.IsOperationApplied(i));
+        }
+    }
+
+    SECTION("InsertedRecordIsNotTouchedAgainInTheSameRequest")
+    {
+        writer.Begin();
+        writer.Add(critters, DataBaseBulkOperationType::Insert, ident_t {1}, MakeBulkDoc(1));
+        writer.Add(critters, DataBaseBulkOperationType::Insert, ident_t {2}, MakeBulkDoc(1));
+        writer.Add(critters, DataBaseBulkOperationType::Update, ident_t {3}, MakeBulkDoc(1));
+        writer.Add(critters, DataBaseBulkOperationType::Update, ident_t {1}, MakeBulkDoc(2));
+        writer.Add(critters, DataBaseBulkOperationType::Update, ident_t {2}, MakeBulkDoc(2));
+        writer.Add(critters, DataBaseBulkOperationType::Update, ident_t {1}, MakeBulkDoc(3));
+        writer.Flush();
+
+        REQUIRE(sink.Requests.size() == 2);
+        CHECK(sink.Requests[0].Ops.size() == 3);
+        CHECK(sink.Requests[1].Ops == vector<pair<DataBaseBulkOperationType, DataBaseKey>> {{DataBaseBulkOperationType::Update, ident_t {1}}, {DataBaseBulkOperationType::Update, ident_t {2}}, {DataBaseBulkOperationType::Update, ident_t {1}}});
+    }
+
+    SECTION("FailedOperationIsReportedAndEarlierOnesStayApplied")
+    {
+        sink.FailRequest = 1;
+        sink.FailOperation = 1;
+
+        writer.Begin();
+        writer.Add(critters, DataBaseBulkOperationType::Update, ident_t {1}, MakeBulkDoc(1));
+        writer.Add(items, DataBaseBulkOperationType::Update, ident_t {10}, MakeBulkDoc(1));
+        writer.Add(items, DataBaseBulkOperationType::Delete, ident_t {11}, {});
+        writer.Add(items, DataBaseBulkOperationType::Update, ident_t {12}, MakeBulkDoc(1));
+        writer.Add(critters, DataBaseBulkOperationType::Update, ident_t {2}, MakeBulkDoc(1));
+
+        CHECK_THROWS_WITH(writer.Flush(), Catch::Matchers::ContainsSubstring("Database bulk write operation failed"));
+
+        // Critters went first and fully through, the items request stopped at its second operation
+        CHECK(writer.IsOperationApplied(0));
+        CHECK(writer.IsOperationApplied(1));
+        CHECK_FALSE(writer.IsOperationApplied(2));
+        CHECK_FALSE(writer.IsOperationApplied(3));
+        CHECK(writer.IsOperationApplied(4));
+
+        writer.Discard();
+
+        CHECK(writer.IsOperationApplied(1));
+
+        writer.Begin();
+
+        CHECK_FALSE(writer.IsOperationApplied(1));
+    }
+
+    SECTION("FailureWithoutOperationIndexConfirmsNothingOfTheRequest")
+    {
+        sink.FailRequest = 0;
+
+        writer.Begin();
+        writer.Add(critters, DataBaseBulkOperationType::Update, ident_t {1}, MakeBulkDoc(1));
+        writer.Add(items, DataBaseBulkOperationType::Update, ident_t {10}, MakeBulkDoc(1));
+
+        CHECK_THROWS_WITH(writer.Flush(), Catch::Matchers::ContainsSubstring("Database bulk write failed"));
+        CHECK(sink.Requests.size() == 1);
+        CHECK_FALSE(writer.IsOperationApplied(0));
+        CHECK_FALSE(writer.IsOperationApplied(1));
+    }
+
+    SECTION("DiscardDropsPendingOperations")
+    {
+        writer.Begin();
+        writer.Add(critters, DataBaseBulkOperationType::Delete, ident_t {1}, {});
+        writer.Discard();
+
+        CHECK_FALSE(writer.IsOpen());
+        CHECK(writer.GetPendingCount() == 0);
+        CHECK_THROWS_AS(writer.Add(critters, DataBaseBulkOperationType::Delete, ident_t {1}, {}), DataBaseException);
+
+        writer.Begin();
+        writer.Flush();
+
+        CHECK(sink.Requests.empty());
+    }
+}
+
+FO_END_NAMESPACE
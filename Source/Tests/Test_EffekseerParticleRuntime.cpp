@@ -146,8 +146,11 @@ class EffekseerRuntimeTestRig final
     [[nodiscard]] auto GetDraws() const -> const vector<CapturedEffekseerDraw>&;
     [[nodiscard]] auto GetTextureRequests() const -> const vector<string>&;
     [[nodiscard]] auto GetSceneBackground() const -> nptr<const RenderTexture>;
+    [[nodiscard]] auto GetSettings() -> GlobalSettings& { return _settings; }
+    [[nodiscard]] auto GetParticleFrameStats() const -> ParticleFrameStats { return _particleManager->GetFrameStats(); }
     void SetSceneBackgroundMode(TestSceneBackgroundMode mode);
     void ClearDraws();
+    void AdvanceFrame(std::chrono::milliseconds frame_duration);
 
 private:
     [[nodiscard]] auto ProvideSceneBackground() const -> ParticleSceneBackgroundResult;
@@ -495,6 +498,14 @@ auto EffekseerRuntimeTestRig::GetTextureRequests() const -> const vector<string>
     return _textureRequests;
 }
 
+void EffekseerRuntimeTestRig::AdvanceFrame(std::chrono::milliseconds frame_duration)
+{
+    FO_STACK_TRACE_ENTRY();
+
+    std::this_thread::sleep_for(frame_duration);
+    _gameTimer->FrameAdvance(false);
+}
+
 auto EffekseerRuntimeTestRig::GetSceneBackground() const -> nptr<const RenderTexture>
 {
     FO_STACK_TRACE_ENTRY();
@@ -996,6 +1007,210 @@ TEST_CASE("Particle facade advances a model-attached effect from an explicit fra
     CheckEffekseerFixtureGeometry(rig.GetDraws());
 }
 
+static auto MakeScheduledEffekseerSystem(EffekseerRuntimeTestRig& rig) -> optional<ParticleSystem>
+{
+    FO_STACK_TRACE_ENTRY();
+
+    // A timer that never advanced reports its epoch, the first frame delta would cover the whole uptime
+    rig.AdvanceFrame(std::chrono::milliseconds {1});
+
+    optional<ParticleSystem> created_system = rig.CreateManagedSystem();
+
+    if (created_system) {
+        ParticleRuntimeSetup setup = MakeEffekseerIdentitySetup();
+        created_system->Setup(setup.Projection, setup.World, setup.PositionOffset, setup.LookDirectionAngle, setup.ViewOffset, setup.TiltInProjection);
+
+        if (!created_system->Respawn(977)) {
+            return std::nullopt;
+        }
+    }
+
+    return created_system;
+}
+
+TEST_CASE("Particle manager keeps culled systems at full rate by default", "[particle][effekseer-runtime]")
+{
+    EffekseerRuntimeTestRig rig;
+    CHECK(rig.GetSettings().ParticleOffscreenUpdateRate < 0);
+
+    optional<ParticleSystem> created_system = MakeScheduledEffekseerSystem(rig);
+    REQUIRE(created_system);
+    ParticleSystem& system = *created_system;
+
+    system.SetInView(false);
+
+    for (int32_t frame = 0; frame < 4; frame++) {
+        float32_t elapsed_before = system.GetElapsedTime();
+        rig.AdvanceFrame(std::chrono::milliseconds {20});
+        system.Update();
+        system.SetInView(false);
+
+        ParticleFrameStats stats = rig.GetParticleFrameStats();
+        CHECK(system.IsCulled());
+        CHECK(stats.CulledSystems == 1);
+        CHECK(stats.SimulatedSystems == 1);
+        CHECK(stats.DeferredSystems == 0);
+        CHECK(system.GetElapsedTime() > elapsed_before);
+    }
+}
+
+TEST_CASE("Particle manager suspends a culled system and catches it up back in view", "[particle][effekseer-runtime]")
+{
+    EffekseerRuntimeTestRig rig;
+    rig.GetSettings().ParticleOffscreenUpdateRate = 0;
+    rig.GetSettings().ParticleMaxCatchUpTime = 10000;
+    rig.GetSettings().ParticleMaxStepsPerFrame = 0;
+
+    optional<ParticleSystem> created_system = MakeScheduledEffekseerSystem(rig);
+    REQUIRE(created_system);
+    ParticleSystem& system = *created_system;
+
+    rig.AdvanceFrame(std::chrono::milliseconds {10});
+    system.Update();
+    float32_t elapsed_in_view = system.GetElapsedTime();
+    CHECK(elapsed_in_view > 0.0f);
+    CHECK(rig.GetParticleFrameStats().SimulatedSystems == 1);
+    CHECK(rig.GetParticleFrameStats().CulledSystems == 0);
+
+    // The map view reports the system outside of it after every update, so the frame time stays held back
+    system.SetInView(false);
+
+    for (int32_t frame = 0; frame < 4; frame++) {
+        rig.AdvanceFrame(std::chrono::milliseconds {20});
+        system.Update();
+        system.SetInView(false);
+
+        CHECK(system.IsCulled());
+        CHECK(system.GetElapsedTime() == elapsed_in_view);
+
+        ParticleFrameStats stats = rig.GetParticleFrameStats();
+        CHECK(stats.CulledSystems == 1);
+        CHECK(stats.DeferredSystems == 1);
+        CHECK(stats.SimulatedSystems == 0);
+        CHECK(stats.SimulationSteps == 0);
+    }
+
+    // Back in view the held back time is replayed in regular steps before the system is drawn again
+    system.SetInView(true);
+    rig.AdvanceFrame(std::chrono::milliseconds {20});
+    system.Update();
+    REQUIRE(system.IsActive());
+
+    ParticleFrameStats stats = rig.GetParticleFrameStats();
+    CHECK_FALSE(system.IsCulled());
+    CHECK(stats.SimulatedSystems == 1);
+    CHECK(stats.CulledSystems == 0);
+    CHECK(stats.DeferredSystems == 0);
+    CHECK(stats.SimulationSteps > 1);
+    CHECK(system.GetElapsedTime() >= elapsed_in_view + 0.1f);
+}
+
+TEST_CASE("Particle manager spreads catch-up steps over the frame budget", "[particle][effekseer-runtime]")
+{
+    EffekseerRuntimeTestRig rig;
+    rig.GetSettings().ParticleOffscreenUpdateRate = 0;
+    rig.GetSettings().ParticleMaxCatchUpTime = 10000;
+    rig.GetSettings().ParticleMaxStepsPerFrame = 2;
+
+    optional<ParticleSystem> created_system = MakeScheduledEffekseerSystem(rig);
+    REQUIRE(created_system);
+    ParticleSystem& system = *created_system;
+
+    system.SetInView(false);
+    rig.AdvanceFrame(std::chrono::milliseconds {300});
+    system.Update();
+    float32_t elapsed_culled = system.GetElapsedTime();
+
+    system.SetInView(true);
+    rig.AdvanceFrame(std::chrono::milliseconds {1});
+    system.Update();
+    REQUIRE(system.IsActive());
+
+    ParticleFrameStats stats = rig.GetParticleFrameStats();
+    CHECK(stats.SimulationSteps == 2);
+    CHECK(stats.DeferredSystems == 1);
+    float32_t elapsed_first_frame = system.GetElapsedTime();
+    CHECK(elapsed_first_frame > elapsed_culled);
+
+    // The rest of the held back time continues on the following frames
+    for (int32_t frame = 0; frame < 20 && rig.GetParticleFrameStats().DeferredSystems != 0; frame++) {
+        system.SetInView(true);
+        rig.AdvanceFrame(std::chrono::milliseconds {1});
+        system.Update();
+        CHECK(rig.GetParticleFrameStats().SimulationSteps <= 2);
+    }
+
+    CHECK(rig.GetParticleFrameStats().DeferredSystems == 0);
+    CHECK(system.GetElapsedTime() >= elapsed_culled + 0.3f);
+}
+
+TEST_CASE("Particle manager updates a culled system at the reduced rate", "[particle][effekseer-runtime]")
+{
+    EffekseerRuntimeTestRig rig;
+    rig.GetSettings().ParticleOffscreenUpdateRate = 10;
+    rig.GetSettings().ParticleMaxCatchUpTime = 10000;
+    rig.GetSettings().ParticleMaxStepsPerFrame = 0;
+
+    optional<ParticleSystem> created_system = MakeScheduledEffekseerSystem(rig);
+    REQUIRE(created_system);
+    ParticleSystem& system = *created_system;
+
+    system.SetInView(false);
+    float32_t elapsed_before = system.GetElapsedTime();
+    bool simulated = false;
+
+    for (int32_t frame = 0; frame < 50 && !simulated; frame++) {
+        rig.AdvanceFrame(std::chrono::milliseconds {10});
+        system.Update();
+        system.SetInView(false);
+
+        ParticleFrameStats stats = rig.GetParticleFrameStats();
+        CHECK(stats.CulledSystems == 1);
+
+        if (stats.SimulatedSystems != 0) {
+            // One coarse step covers everything since the previous off-screen update
+            CHECK(stats.SimulationSteps == 1);
+            CHECK(stats.DeferredSystems == 0);
+            CHECK(system.GetElapsedTime() >= elapsed_before + 0.1f);
+            simulated = true;
+        }
+        else {
+            CHECK(system.GetElapsedTime() == elapsed_before);
+        }
+    }
+
+    CHECK(simulated);
+}
+
+TEST_CASE("Particle system without a fresh map view report counts as in view", "[particle][effekseer-runtime]")
+{
+    EffekseerRuntimeTestRig rig;
+
+    optional<ParticleSystem> created_system = MakeScheduledEffekseerSystem(rig);
+    REQUIRE(created_system);
+    ParticleSystem& system = *created_system;
+
+    CHECK_FALSE(system.IsCulled());
+    system.SetInView(false);
+    CHECK(system.IsCulled());
+
+    // Several map sprites may show one system, any of them being in view keeps it in view
+    system.SetInView(true);
+    system.SetInView(false);
+    CHECK_FALSE(system.IsCulled());
+
+    rig.AdvanceFrame(std::chrono::milliseconds {1});
+    system.SetInView(false);
+    rig.AdvanceFrame(std::chrono::milliseconds {1});
+    system.Update();
+    CHECK(system.IsCulled());
+
+    // The map is not drawn anymore, so the last report expires
+    rig.AdvanceFrame(std::chrono::milliseconds {1});
+    system.Update();
+    CHECK_FALSE(system.IsCulled());
+}
+
 TEST_CASE("Effekseer particle runtime rejects a missing color texture", "[particle][effekseer-runtime]")
 {
     EffekseerRuntimeTestRig rig {false};
@@ -1325,6 +1325,27 @@ TEST_CASE("EntityLockContention")
         CHECK(counter.load() == threads_count * increments_per_thread);
     }
 
+    SECTION("ParkedWaitIsCounted")
+    {
+        EntityLock lock;
+        lock.Acquire(1);
+
+        SyncContentionStats before = GetSyncContentionStats();
+        std::thread waiter([&lock]() {
+            lock.Acquire(2);
+            lock.Release();
+        });
+
+        while (lock.WaiterCount() == 0) {
+            std::this_thread::yield();
+        }
+
+        CHECK(GetSyncContentionStats().ParkedWaits > before.ParkedWaits);
+
+        lock.Release();
+        waiter.join();
+    }
+
     SECTION("MultipleLocksSortedAcquisition")
     {
         EntityLock lock_a;
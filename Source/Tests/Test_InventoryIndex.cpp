@@ -0,0 +1,245 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "InventoryIndex.h"
+
+FO_BEGIN_NAMESPACE
+
+namespace
+{
+    struct TestItem
+    {
+        ident_t Id {};
+        hstring Pid {};
+        CritterItemSlot Slot {};
+    };
+
+    // The owner's item list, scanned front to back the way lookups worked before the index
+    struct BruteForceInventory
+    {
+        [[nodiscard]] auto Find(ident_t id) const -> nptr<TestItem>
+        {
+            const auto it = std::ranges::find_if(Items, [&](ptr<TestItem> item) { return item->Id == id; });
+            return it != Items.end() ? it->as_nptr() : nullptr;
+        }
+
+        [[nodiscard]] auto FindByPid(hstring pid) const -> nptr<TestItem>
+        {
+            const auto it = std::ranges::find_if(Items, [&](ptr<TestItem> item) { return item->Pid == pid; });
+            return it != Items.end() ? it->as_nptr() : nullptr;
+        }
+
+        [[nodiscard]] auto FindBySlot(CritterItemSlot slot) const -> nptr<TestItem>
+        {
+            const auto it = std::ranges::find_if(Items, [&](ptr<TestItem> item) { return item->Slot == slot; });
+            return it != Items.end() ? it->as_nptr() : nullptr;
+        }
+
+        [[nodiscard]] auto GetByPid(hstring pid) const -> vector<ptr<TestItem>>
+        {
+            vector<ptr<TestItem>> result;
+
+            for (ptr<TestItem> item : Items) {
+                if (item->Pid == pid) {
+                    result.emplace_back(item);
+                }
+            }
+
+            return result;
+        }
+
+        vector<ptr<TestItem>> Items {};
+    };
+
+    auto ToVector(const_span<ptr<TestItem>> items) -> vector<ptr<TestItem>>
+    {
+        return {items.begin(), items.end()};
+    }
+}
+
+TEST_CASE("InventoryIndex")
+{
+    HashStorage hashes;
+    const hstring ammo = hashes.ToHashedString("Ammo");
+    const hstring key = hashes.ToHashedString("Key");
+    const hstring armor = hashes.ToHashedString("Armor");
+
+    SECTION("LookupsReturnFirstItemInAddOrder")
+    {
+        array<TestItem, 4> items {{
+            {.Id = ident_t {40}, .Pid = ammo, .Slot = CritterItemSlot::Inventory},
+            {.Id = ident_t {10}, .Pid = key, .Slot = CritterItemSlot::Main},
+            {.Id = ident_t {30}, .Pid = ammo, .Slot = CritterItemSlot::Main},
+            {.Id = ident_t {20}, .Pid = armor, .Slot = CritterItemSlot::Inventory},
+        }};
+        InventoryIndex<TestItem> index;
+
+        for (auto& item : items) {
+            index.Add(item.Id, &item, item.Pid, item.Slot);
+        }
+
+        CHECK(index.GetCount() == 4);
+        CHECK(index.Find(ident_t {30}) == &items[2]);
+        CHECK(!index.Find(ident_t {50}));
+        CHECK(index.FindByPid(ammo) == &items[0]);
+        CHECK(!index.FindByPid(hashes.ToHashedString("Missing")));
+        CHECK(ToVector(index.GetByPid(ammo)) == vector<ptr<TestItem>> {&items[0], &items[2]});
+        CHECK(index.GetByPid(hashes.ToHashedString("Missing")).empty());
+        CHECK(index.FindBySlot(CritterItemSlot::Main) == &items[1]);
+        CHECK(index.FindBySlot(CritterItemSlot::Inventory) == &items[0]);
+        CHECK(!index.FindBySlot(CritterItemSlot::Outside));
+    }
+
+    SECTION("SlotChangeKeepsAddOrderWithinTheNewSlot")
+    {
+        array<TestItem, 3> items {{
+            {.Id = ident_t {1}, .Pid = ammo, .Slot = CritterItemSlot::Inventory},
+            {.Id = ident_t {2}, .Pid = ammo, .Slot = CritterItemSlot::Main},
+            {.Id = ident_t {3}, .Pid = ammo, .Slot = CritterItemSlot::Inventory},
+        }};
+        InventoryIndex<TestItem> index;
+
+        for (auto& item : items) {
+            index.Add(item.Id, &item, item.Pid, item.Slot);
+        }
+
+        // The first item joins a slot that already has a later item, and must come out first
+        CHECK(index.ChangeSlot(ident_t {1}, CritterItemSlot::Main));
+        CHECK(index.FindBySlot(CritterItemSlot::Main) == &items[0]);
+        CHECK(index.FindBySlot(CritterItemSlot::Inventory) == &items[2]);
+
+        CHECK(index.ChangeSlot(ident_t {1}, CritterItemSlot::Main));
+        CHECK(!index.ChangeSlot(ident_t {4}, CritterItemSlot::Main));
+
+        index.Remove(ident_t {1});
+        CHECK(index.FindBySlot(CritterItemSlot::Main) == &items[1]);
+        CHECK(ToVector(index.GetByPid(ammo)) == vector<ptr<TestItem>> {&items[1], &items[2]});
+    }
+
+    SECTION("DuplicateAndMissingItemsAreRejected")
+    {
+        TestItem item {.Id = ident_t {7}, .Pid = key, .Slot = CritterItemSlot::Inventory};
+        InventoryIndex<TestItem> index;
+
+        index.Add(item.Id, &item, item.Pid, item.Slot);
+        CHECK_THROWS(index.Add(item.Id, &item, item.Pid, item.Slot));
+        CHECK_THROWS(index.Remove(ident_t {8}));
+
+        index.Remove(item.Id);
+        CHECK(index.GetCount() == 0);
+        CHECK(!index.FindByPid(key));
+        CHECK(!index.FindBySlot(CritterItemSlot::Inventory));
+    }
+
+    SECTION("ItemsWithoutSlotStayOutOfSlotBuckets")
+    {
+        array<TestItem, 2> items {{
+            {.Id = ident_t {1}, .Pid = ammo, .Slot = CritterItemSlot::Inventory},
+            {.Id = ident_t {2}, .Pid = ammo, .Slot = CritterItemSlot::Inventory},
+        }};
+        InventoryIndex<TestItem> index;
+
+        index.Add(items[0].Id, &items[0], items[0].Pid, std::nullopt);
+        index.Add(items[1].Id, &items[1], items[1].Pid, items[1].Slot);
+
+        CHECK(index.FindBySlot(CritterItemSlot::Inventory) == &items[1]);
+        CHECK(!index.ChangeSlot(items[0].Id, CritterItemSlot::Main));
+        CHECK(!index.FindBySlot(CritterItemSlot::Main));
+        CHECK(ToVector(index.GetByPid(ammo)) == vector<ptr<TestItem>> {&items[0], &items[1]});
+
+        index.Remove(items[0].Id);
+        index.Remove(items[1].Id);
+        CHECK(index.GetCount() == 0);
+        CHECK(!index.FindBySlot(CritterItemSlot::Inventory));
+    }
+
+    SECTION("RandomMutationsMatchBruteForceScan")
+    {
+        std::mt19937 rnd {20261019}; // NOLINT(cert-msc51-cpp)
+        const array<hstring, 5> pids {ammo, key, armor, hashes.ToHashedString("Quest"), hashes.ToHashedString("Stimpak")};
+        const array<CritterItemSlot, 4> slots {CritterItemSlot::Inventory, CritterItemSlot::Main, static_cast<CritterItemSlot>(2), static_cast<CritterItemSlot>(3)};
+
+        constexpr size_t pool_size = 300;
+        vector<TestItem> pool(pool_size);
+        vector<bool> held(pool_size);
+
+        for (size_t i = 0; i < pool_size; i++) {
+            pool[i].Id = ident_t {numeric_cast<int64_t>(i + 1)};
+        }
+
+        InventoryIndex<TestItem> index;
+        BruteForceInventory brute;
+
+        for (int32_t step = 0; step < 5000; step++) {
+            auto& item = pool[rnd() % pool_size];
+            const size_t item_index = numeric_cast<size_t>(&item - pool.data());
+
+            if (!held[item_index]) {
+                item.Pid = pids[rnd() % pids.size()];
+                item.Slot = slots[rnd() % slots.size()];
+                index.Add(item.Id, &item, item.Pid, item.Slot);
+                brute.Items.emplace_back(&item);
+                held[item_index] = true;
+            }
+            else if (rnd() % 3 == 0) {
+                index.Remove(item.Id);
+                vec_remove_unique_value(brute.Items, ptr<TestItem> {&item});
+                held[item_index] = false;
+            }
+            else {
+                item.Slot = slots[rnd() % slots.size()];
+                CHECK(index.ChangeSlot(item.Id, item.Slot));
+            }
+
+            REQUIRE(index.GetCount() == brute.Items.size());
+
+            for (const auto pid : pids) {
+                REQUIRE(index.FindByPid(pid) == brute.FindByPid(pid));
+                REQUIRE(ToVector(index.GetByPid(pid)) == brute.GetByPid(pid));
+            }
+            for (const auto slot : slots) {
+                REQUIRE(index.FindBySlot(slot) == brute.FindBySlot(slot));
+            }
+
+            if (step % 50 == 0) {
+                for (const auto& probe : pool) {
+                    REQUIRE(index.Find(probe.Id) == brute.Find(probe.Id));
+                }
+            }
+        }
+    }
+}
+
+FO_END_NAMESPACE
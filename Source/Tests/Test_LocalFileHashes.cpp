@@ -0,0 +1,168 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "CacheStorage.h"
+#include "DiskFileSystem.h"
+#include "LocalFileHashes.h"
+
+FO_BEGIN_NAMESPACE
+
+namespace LocalFileHashesTests
+{
+    static auto MakeTempDir(string_view name) -> string
+    {
+        auto base = std::filesystem::temp_directory_path() / std::format("lf_{}_{}", name, std::chrono::steady_clock::now().time_since_epoch().count());
+        return fs_path_to_string(base);
+    }
+
+    // Files of mixed sizes, from empty to a few megabytes, so several hashers finish at different times
+    static auto MakeSyntheticFiles(string_view dir, size_t count) -> vector<string>
+    {
+        vector<string> paths;
+        std::mt19937 rnd {40};
+
+        for (size_t i = 0; i < count; i++) {
+            size_t size = i % 7 == 0 ? 0 : numeric_cast<size_t>(rnd() % (i % 5 == 0 ? 3 * 1024 * 1024 : 64 * 1024));
+            vector<uint8_t> data(size);
+
+            for (auto& byte : data) {
+                byte = numeric_cast<uint8_t>(rnd() & 0xFF);
+            }
+
+            string path = strex(dir).combine_path(strex("Pack{}/File{}.bin", i % 3, i)).str();
+            REQUIRE(fs_create_directories(strex(path).extract_dir()));
+            REQUIRE(fs_write_file(path, data));
+            paths.emplace_back(std::move(path));
+        }
+
+        return paths;
+    }
+}
+
+TEST_CASE("LocalFileHashes")
+{
+    using namespace LocalFileHashesTests;
+
+    string files_dir = MakeTempDir("local_file_hashes_files");
+    string cache_dir = MakeTempDir("local_file_hashes_cache");
+    auto cleanup = scope_exit([&files_dir, &cache_dir]() noexcept {
+        fs_remove_dir_tree(files_dir);
+        fs_remove_dir_tree(cache_dir);
+    });
+
+    auto paths = MakeSyntheticFiles(files_dir, 40);
+
+    vector<uint64_t> serial_hashes;
+
+    for (const auto& path : paths) {
+        auto hash = fs_hash_file(path);
+        REQUIRE(hash.has_value());
+        serial_hashes.emplace_back(*hash);
+    }
+
+    SECTION("ParallelPrefetchMatchesSerialHashing")
+    {
+        CacheStorage cache {cache_dir};
+        LocalFileHashes hashes {&cache, 4};
+
+        auto requested = paths;
+        requested.emplace_back(paths.front()); // Duplicates are hashed once
+        requested.emplace_back(strex(files_dir).combine_path("Missing.bin").str()); // Missing files are skipped
+        hashes.Prefetch(requested);
+
+        CHECK(hashes.GetHashedCount() == paths.size());
+
+        for (size_t i = 0; i < paths.size(); i++) {
+            auto hash = hashes.GetHash(paths[i]);
+            REQUIRE(hash.has_value());
+            CHECK(*hash == serial_hashes[i]);
+        }
+
+        CHECK(hashes.GetHashedCount() == paths.size());
+        CHECK_FALSE(hashes.GetHash(strex(files_dir).combine_path("Missing.bin").str()).has_value());
+    }
+
+    SECTION("SerialPathMatchesWithoutWorkers")
+    {
+        CacheStorage cache {cache_dir};
+        LocalFileHashes hashes {&cache, 0};
+
+        hashes.Prefetch(paths);
+
+        for (size_t i = 0; i < paths.size(); i++) {
+            CHECK(hashes.GetHash(paths[i]) == serial_hashes[i]);
+        }
+
+        CHECK(hashes.GetHashedCount() == paths.size());
+    }
+
+    SECTION("UnchangedFilesSkipRehashingOnNextLaunch")
+    {
+        {
+            CacheStorage cache {cache_dir};
+            LocalFileHashes hashes {&cache, 4};
+            hashes.Prefetch(paths);
+            CHECK(hashes.GetHashedCount() == paths.size());
+        }
+
+        // A file rewritten with other content of the same size still gets a new write time
+        string changed_path = paths[1];
+        auto changed_write_time = std::filesystem::last_write_time(std::filesystem::path {fs_make_path(changed_path)});
+        auto changed_data = fs_read_file(changed_path);
+        REQUIRE(changed_data.has_value());
+        REQUIRE_FALSE(changed_data->empty());
+        (*changed_data)[0] = static_cast<char>((*changed_data)[0] ^ 0x5A);
+        REQUIRE(fs_write_file(changed_path, *changed_data));
+        std::filesystem::last_write_time(std::filesystem::path {fs_make_path(changed_path)}, changed_write_time + std::chrono::seconds {2});
+
+        CacheStorage cache {cache_dir};
+        LocalFileHashes hashes {&cache, 4};
+        hashes.Prefetch(paths);
+
+        CHECK(hashes.GetHashedCount() == 1);
+        CHECK(hashes.GetHash(changed_path) == fs_hash_file(changed_path));
+        CHECK(hashes.GetHash(changed_path) != serial_hashes[1]);
+
+        for (size_t i = 0; i < paths.size(); i++) {
+            if (i != 1) {
+                CHECK(hashes.GetHash(paths[i]) == serial_hashes[i]);
+            }
+        }
+
+        CHECK(hashes.GetHashedCount() == 1);
+    }
+}
+
+FO_END_NAMESPACE
@@ -869,10 +869,43 @@ namespace LocEntity
     {
         return SafeAlloc::MakeRefCounted<ServerEngine>(&settings, MakeResources());
     }
+
+    static auto MakeItemLookSettings() -> GlobalSettings
+    {
+        auto settings = MakeSettings();
+
+        BakerTests::OverrideSetting(settings.ItemLookMargin, 2);
+
+        return settings;
+    }
+
+    // Deterministic hexes spread over the whole map in an order unrelated to their position
+    static auto MakeScatteredHexes(size_t count, msize map_size) -> vector<mpos>
+    {
+        vector<mpos> hexes;
+        hexes.reserve(count);
+        uint32_t state = 12345;
+
+        for (size_t i = 0; i < count; i++) {
+            state = state * 1664525 + 1013904223;
+            hexes.emplace_back(numeric_cast<int16_t>((state >> 8) % numeric_cast<uint32_t>(map_size.width)), numeric_cast<int16_t>((state >> 20) % numeric_cast<uint32_t>(map_size.height)));
+        }
+
+        return hexes;
+    }
+
+    static void StepCritter(ptr<Map> map, ptr<Critter> cr, mpos hex)
+    {
+        map->RemoveCritterFromField(cr);
+        cr->SetHex(hex);
+        map->AddCritterToField(cr);
+    }
 }
 
-#define MAKE_LEM_SERVER() \
-    auto settings = MakeSettings(); \
+#define MAKE_LEM_SERVER() MAKE_LEM_SERVER_WITH(MakeSettings)
+
+#define MAKE_LEM_SERVER_WITH(make_settings) \
+    auto settings = make_settings(); \
     refcount_ptr<ServerEngine> server = MakeServerEngine(settings); \
     auto shutdown = scope_exit([&server]() noexcept { \
         safe_call([&server] { \
@@ -2151,18 +2184,17 @@ TEST_CASE("TimeEventManagerFiresScriptCallbacks")
 
     auto cr = server->CreateCritter(get_func("TestCritter"), false).hold_ref();
 
+    // Client-style processing: without a Schedule hook the manager fires events from its own deadline queue
+    server->TimeEventMngr.ClearDispatcherHooks();
+
     auto start_self_event = [&server, &cr](string_view func_name, timespan repeat) {
         auto timer_func = server->FindFunc<void, ptr<ScriptSelfEntity>>(server->Hashes.ToHashedString(func_name));
         REQUIRE(timer_func);
-        return server->TimeEventMngr.StartTimeEvent(cr, Entity::TimeEventData::FuncType {std::move(timer_func)}, timespan {std::chrono::seconds {60}}, repeat, {});
+        return server->TimeEventMngr.StartTimeEvent(cr, Entity::TimeEventData::FuncType {std::move(timer_func)}, TimeEventManager::MIN_REPEAT_TIME, repeat, {});
     };
-    auto backdate_all_events = [&cr]() {
-        auto time_events = cr->GetTimeEvents();
-        REQUIRE(time_events);
-
-        for (auto& te : *time_events) {
-            te->FireTime = nanotime {};
-        }
+    auto advance_past_deadlines = [&server]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds {5});
+        server->GameTime.FrameAdvance(false);
     };
 
     int32_t base_look = cr->GetLookDistance();
@@ -2172,7 +2204,7 @@ TEST_CASE("TimeEventManagerFiresScriptCallbacks")
         uint32_t event_id = start_self_event("LocEntity::OnCritterTickTimer", timespan {std::chrono::seconds {5}});
         CHECK(event_id != 0);
 
-        backdate_all_events();
+        advance_past_deadlines();
         server->TimeEventMngr.ProcessTimeEvents();
 
         CHECK(cr->GetLookDistance() == base_look + 1);
@@ -2189,7 +2221,7 @@ TEST_CASE("TimeEventManagerFiresScriptCallbacks")
         uint32_t event_id = start_self_event("LocEntity::OnCritterTickTimer", {});
         CHECK(event_id != 0);
 
-        backdate_all_events();
+        advance_past_deadlines();
         server->TimeEventMngr.ProcessTimeEvents();
 
         CHECK(cr->GetLookDistance() == base_look + 1);
@@ -2204,7 +2236,7 @@ TEST_CASE("TimeEventManagerFiresScriptCallbacks")
         SetExceptionCallback([](string_view, const CatchedStackTraceData&, bool) { });
         auto restore_callback = scope_exit([prev = std::move(prev_callback)]() mutable noexcept { SetExceptionCallback(std::move(prev)); });
 
-        backdate_all_events();
+        advance_past_deadlines();
         server->TimeEventMngr.ProcessTimeEvents();
 
         CHECK(cr->GetLookDistance() == base_look + 1000);
@@ -2216,7 +2248,7 @@ TEST_CASE("TimeEventManagerFiresScriptCallbacks")
     {
         uint32_t event_id = start_self_event("LocEntity::OnCritterTickTimer", timespan {std::chrono::seconds {5}});
 
-        backdate_all_events();
+        advance_past_deadlines();
         auto next_delay = server->TimeEventMngr.FireAndAdvance(cr, event_id);
 
         CHECK(cr->GetLookDistance() == base_look + 1);
@@ -2225,7 +2257,7 @@ TEST_CASE("TimeEventManagerFiresScriptCallbacks")
 
         // A one-shot event reports no follow-up delay because it is gone after firing
         uint32_t once_id = start_self_event("LocEntity::OnCritterTickTimer", {});
-        backdate_all_events();
+        advance_past_deadlines();
         CHECK_FALSE(server->TimeEventMngr.FireAndAdvance(cr, once_id).has_value());
     }
 
@@ -2233,13 +2265,23 @@ TEST_CASE("TimeEventManagerFiresScriptCallbacks")
     server->CrMngr.DestroyCritter(cr);
 }
 
-TEST_CASE("TimeEventManagerCollectsReadyEventsAndNotifiesDispatcher")
+TEST_CASE("TimeEventManagerHandsDeadlinesToDispatcher")
 {
     MAKE_LEM_SERVER();
 
     auto cr = server->CreateCritter(get_func("TestCritter"), false).hold_ref();
     hstring timer_name = get_func("LocEntity::OnUnloadTimer");
 
+    auto start_event = [&server, &cr, &timer_name](timespan delay, timespan repeat) {
+        auto timer_func = server->FindFunc<void>(timer_name);
+        REQUIRE(timer_func);
+        return server->TimeEventMngr.StartTimeEvent(cr, Entity::TimeEventData::FuncType {std::move(timer_func)}, delay, repeat, {});
+    };
+
+    // Queued by the manager itself while no dispatcher is attached
+    server->TimeEventMngr.ClearDispatcherHooks();
+    uint32_t queued_id = start_event(timespan {std::chrono::seconds {600}}, {});
+
     vector<uint32_t> scheduled_ids;
     vector<timespan> scheduled_delays;
     vector<uint32_t> cancelled_ids;
@@ -2253,11 +2295,14 @@ TEST_CASE("TimeEventManagerCollectsReadyEventsAndNotifiesDispatcher")
     server->TimeEventMngr.SetDispatcherHooks(std::move(hooks));
     auto clear_dispatcher_hooks = scope_exit([&server]() noexcept { safe_call([&server] { server->TimeEventMngr.ClearDispatcherHooks(); }); });
 
-    auto start_event = [&server, &cr, &timer_name](timespan delay, timespan repeat) {
-        auto timer_func = server->FindFunc<void>(timer_name);
-        REQUIRE(timer_func);
-        return server->TimeEventMngr.StartTimeEvent(cr, Entity::TimeEventData::FuncType {std::move(timer_func)}, delay, repeat, {});
-    };
+    // Attaching the dispatcher hands it the queued deadline, and from then on the manager keeps no queue
+    REQUIRE(scheduled_ids.size() == 1);
+    CHECK(scheduled_ids[0] == queued_id);
+    CHECK(scheduled_delays[0] > timespan {});
+    CHECK(scheduled_delays[0] <= timespan {std::chrono::seconds {600}});
+
+    scheduled_ids.clear();
+    scheduled_delays.clear();
 
     uint32_t ready_id = start_event(TimeEventManager::MIN_REPEAT_TIME, {});
     uint32_t future_id = start_event(timespan {std::chrono::seconds {600}}, {});
@@ -2268,6 +2313,12 @@ TEST_CASE("TimeEventManagerCollectsReadyEventsAndNotifiesDispatcher")
     CHECK(scheduled_delays[0] == TimeEventManager::MIN_REPEAT_TIME);
     CHECK(scheduled_delays[1] == timespan {std::chrono::seconds {600}});
 
+    {
+        optional<timespan> time_until_next;
+        CHECK(server->TimeEventMngr.CollectReadyTimeEvents(time_until_next).empty());
+        CHECK_FALSE(time_until_next.has_value());
+    }
+
     // Retiming an event cancels the old dispatcher entry before scheduling the new one
     scheduled_ids.clear();
     scheduled_delays.clear();
@@ -2278,35 +2329,6 @@ TEST_CASE("TimeEventManagerCollectsReadyEventsAndNotifiesDispatcher")
     CHECK(scheduled_ids[0] == future_id);
     CHECK(scheduled_delays[0] == timespan {std::chrono::seconds {300}});
 
-    // Nothing is due yet, so the collector only reports how long the dispatcher may sleep
-    {
-        optional<timespan> time_until_pending;
-        CHECK(server->TimeEventMngr.CollectReadyTimeEvents(time_until_pending).empty());
-        REQUIRE(time_until_pending.has_value());
-        CHECK(time_until_pending.value() > timespan {});
-    }
-
-    // Backdate one event instead of waiting on the frame clock, so readiness is deterministic
-    {
-        auto time_events = cr->GetTimeEvents();
-        REQUIRE(time_events);
-
-        for (auto& te : *time_events) {
-            if (te->Id == ready_id) {
-                te->FireTime = nanotime {};
-            }
-        }
-    }
-
-    optional<timespan> time_until_next;
-    auto ready = server->TimeEventMngr.CollectReadyTimeEvents(time_until_next);
-
-    REQUIRE(ready.size() == 1);
-    CHECK(ready.front().Event->Id == ready_id);
-    CHECK(ready.front().OwnerEntity == cr);
-    REQUIRE(time_until_next.has_value());
-    CHECK(time_until_next.value() > timespan {});
-
     // A paused dispatcher stops delivering notifications without losing the hooks themselves
     cancelled_ids.clear();
     scheduled_ids.clear();
@@ -2319,15 +2341,176 @@ TEST_CASE("TimeEventManagerCollectsReadyEventsAndNotifiesDispatcher")
     server->TimeEventMngr.ClearDispatcherHooks();
     clear_dispatcher_hooks.release();
 
-    // Clearing drops every pending event across all polled entities
-    server->TimeEventMngr.ClearTimeEvents();
+    server->TimeEventMngr.CancelAllForEntity(cr);
     CHECK_FALSE(cr->HasTimeEvents());
 
-    optional<timespan> time_until_next_after_clear;
-    CHECK(server->TimeEventMngr.CollectReadyTimeEvents(time_until_next_after_clear).empty());
-    CHECK_FALSE(time_until_next_after_clear.has_value());
+    server->CrMngr.DestroyCritter(cr);
+}
 
+TEST_CASE("TimeEventManagerProcessesOnlyDueEvents")
+{
+    MAKE_LEM_SERVER();
+
+    // Client-style processing: without a Schedule hook the manager fires events from its own deadline queue
+    server->TimeEventMngr.ClearDispatcherHooks();
+
+    auto cr = server->CreateCritter(get_func("TestCritter"), false).hold_ref();
+
+    auto start_self_event = [&server, &cr, &get_func](timespan delay, timespan repeat) {
+        auto timer_func = server->FindFunc<void, ptr<ScriptSelfEntity>>(get_func("LocEntity::OnCritterTickTimer"));
+        REQUIRE(timer_func);
+        return server->TimeEventMngr.StartTimeEvent(cr, Entity::TimeEventData::FuncType {std::move(timer_func)}, delay, repeat, {});
+    };
+    auto advance_past_deadlines = [&server]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds {5});
+        server->GameTime.FrameAdvance(false);
+    };
+
+    int32_t base_look = cr->GetLookDistance();
+    uint32_t due_id = start_self_event(TimeEventManager::MIN_REPEAT_TIME, timespan {std::chrono::seconds {5}});
+    uint32_t stopped_id = start_self_event(TimeEventManager::MIN_REPEAT_TIME, {});
+    uint32_t idle_id = start_self_event(timespan {std::chrono::seconds {60}}, {});
+
+    server->TimeEventMngr.StopTimeEvent(cr, ScriptFuncName(), stopped_id);
+    advance_past_deadlines();
+
+    server->TimeEventMngr.ProcessTimeEvents();
+
+    // Only the due event fires; the stopped one left the deadline queue together with the entity list
+    CHECK(cr->GetLookDistance() == base_look + 1);
+    CHECK(server->TimeEventMngr.CountTimeEvent(cr, ScriptFuncName(), due_id) == 1);
+    CHECK(server->TimeEventMngr.CountTimeEvent(cr, ScriptFuncName(), stopped_id) == 0);
+    CHECK(server->TimeEventMngr.CountTimeEvent(cr, ScriptFuncName(), idle_id) == 1);
+
+    // The repeating event was requeued past the current frame, so the same frame fires nothing more
+    server->TimeEventMngr.ProcessTimeEvents();
+    CHECK(cr->GetLookDistance() == base_look + 1);
+
+    // Data-only changes keep the deadline, retiming moves the queue entry
+    server->TimeEventMngr.ModifyTimeEvent(cr, ScriptFuncName(), idle_id, std::nullopt, vector<any_t> {any_t {"payload"}});
+    server->TimeEventMngr.ModifyTimeEvent(cr, ScriptFuncName(), due_id, timespan {std::chrono::seconds {120}}, std::nullopt);
+
+    optional<timespan> time_until_next;
+    CHECK(server->TimeEventMngr.CollectReadyTimeEvents(time_until_next).empty());
+    REQUIRE(time_until_next.has_value());
+    CHECK(time_until_next.value() <= timespan {std::chrono::seconds {60}});
+
+    server->TimeEventMngr.ModifyTimeEvent(cr, ScriptFuncName(), idle_id, TimeEventManager::MIN_REPEAT_TIME, std::nullopt);
+    advance_past_deadlines();
+    auto ready = server->TimeEventMngr.CollectReadyTimeEvents(time_until_next);
+    REQUIRE(ready.size() == 1);
+    CHECK(ready.front().Event->Id == idle_id);
+    REQUIRE(time_until_next.has_value());
+    CHECK(time_until_next.value() > timespan {std::chrono::seconds {60}});
+    ready.clear();
+
+    // Dropping the entity's list removes its queue entries too, even ones already due
+    cr->ClearAllTimeEvents();
+    CHECK(server->TimeEventMngr.CollectReadyTimeEvents(time_until_next).empty());
+    CHECK_FALSE(time_until_next.has_value());
+
+    // Destroying the owner drops its queue entries together with its list
+    (void)start_self_event(TimeEventManager::MIN_REPEAT_TIME, {});
+    advance_past_deadlines();
     server->CrMngr.DestroyCritter(cr);
+    CHECK_FALSE(cr->HasTimeEvents());
+    CHECK(server->TimeEventMngr.CollectReadyTimeEvents(time_until_next).empty());
+    CHECK_FALSE(time_until_next.has_value());
+}
+
+TEST_CASE("TimeEventManagerIdleTimersPerformance", "[!benchmark][server]")
+{
+    MAKE_LEM_SERVER();
+
+    // Client-style processing, so the manager queues the timers itself instead of handing them to worker-pool jobs
+    server->TimeEventMngr.ClearDispatcherHooks();
+
+    constexpr size_t critter_count = 1000;
+    constexpr size_t timers_per_critter = 1000;
+    hstring timer_name = get_func("LocEntity::OnUnloadTimer");
+    vector<refcount_ptr<Critter>> critters;
+    critters.reserve(critter_count);
+
+    for (size_t i = 0; i < critter_count; i++) {
+        auto cr = server->CreateCritter(get_func("TestCritter"), false).hold_ref();
+
+        for (size_t j = 0; j < timers_per_critter; j++) {
+            auto timer_func = server->FindFunc<void>(timer_name);
+            FO_VERIFY_AND_THROW(timer_func, "Benchmark timer function not found");
+            (void)server->TimeEventMngr.StartTimeEvent(cr, Entity::TimeEventData::FuncType {std::move(timer_func)}, timespan {std::chrono::hours {1}}, {}, {});
+        }
+
+        critters.emplace_back(std::move(cr));
+    }
+
+    BENCHMARK("Deadline queue tick, 1M idle timers")
+    {
+        server->TimeEventMngr.ProcessTimeEvents();
+    };
+
+    // The removed TimeEventManager::ProcessTimeEvents/ProcessEntityTimeEvents pair, kept verbatim minus the firing
+    // (nothing is due): copy the polled entity set under the manager lock, then lock again per entity to rescan
+    // its event list and once more to check whether it leaves polling
+    std::recursive_mutex polling_locker;
+    unordered_set<refcount_ptr<Entity>> polled_entities;
+
+    for (const auto& cr : critters) {
+        polled_entities.emplace(cr);
+    }
+
+    BENCHMARK("Polling tick, 1M idle timers")
+    {
+        auto entities = [&] {
+            std::scoped_lock lock {polling_locker};
+
+            return copy_hold_ref(polled_entities);
+        }();
+
+        size_t due_count = 0;
+
+        for (ptr<Entity> entity : entities) {
+            if (entity->IsDestroyed()) {
+                continue;
+            }
+
+            small_vector<shared_ptr<Entity::TimeEventData>, 8> ready_events;
+            nanotime time = server->GameTime.GetFrameTime();
+
+            {
+                std::scoped_lock lock {polling_locker};
+
+                auto time_events = entity->GetTimeEvents();
+
+                if (!time_events || time_events->empty()) {
+                    continue;
+                }
+
+                ready_events.reserve(time_events->size());
+
+                for (auto& te : *time_events) {
+                    if (te->FireTime <= time) {
+                        ready_events.emplace_back(te);
+                    }
+                }
+            }
+
+            due_count += ready_events.size();
+
+            std::scoped_lock lock {polling_locker};
+
+            if (!entity->HasTimeEvents()) {
+                due_count++;
+            }
+        }
+
+        return due_count;
+    };
+
+    server->TimeEventMngr.ClearTimeEvents();
+
+    for (auto& cr : critters) {
+        server->CrMngr.DestroyCritter(cr);
+    }
 }
 
 TEST_CASE("DestroyingEntityRejectsNewTimeEvents")
@@ -2367,4 +2550,497 @@ TEST_CASE("DestroyingEntityRejectsNewTimeEvents")
     CHECK_FALSE(cr->HasTimeEvents());
 }
 
+TEST_CASE("MapItemViewIndexKeepsNotificationSequence", "[server]")
+{
+    MAKE_LEM_SERVER_WITH(MakeItemLookSettings);
+
+    vector<hstring> map_pids {get_func("TestMap")};
+    auto loc = server->MapMngr.CreateLocation(get_func("TestLocation"), map_pids);
+    auto map = loc->GetMaps().front();
+
+    for (const auto hex : MakeScatteredHexes(3000, map->GetSize())) {
+        (void)server->ItemMngr.CreateItemOnHex(map, hex, get_func("TestItem"), 1, nullptr);
+    }
+
+    auto cr = server->CreateCritter(get_func("TestCritter"), false);
+    cr->SetLookDistance(10);
+    server->MapMngr.AddCritterToMap(cr, map, mpos {5, 100}, mdir {0}, ident_t {});
+
+    vector<pair<bool, ident_t>> notified;
+
+    Entity::EventCallbackData appeared_callback;
+    appeared_callback.Callback = [&notified](FuncCallData& call) {
+        notified.emplace_back(true, (*cast_from_void<Entity**>(call.ArgsData[1]))->GetId());
+        return Entity::EventResult::ContinueChain;
+    };
+    appeared_callback.SubscriptionPtr = reinterpret_cast<uintptr_t>(&notified);
+    cr->OnItemOnMapAppeared.Subscribe(std::move(appeared_callback));
+
+    Entity::EventCallbackData disappeared_callback;
+    disappeared_callback.Callback = [&notified](FuncCallData& call) {
+        notified.emplace_back(false, (*cast_from_void<Entity**>(call.ArgsData[1]))->GetId());
+        return Entity::EventResult::ContinueChain;
+    };
+    disappeared_callback.SubscriptionPtr = reinterpret_cast<uintptr_t>(&notified);
+    cr->OnItemOnMapDisappeared.Subscribe(std::move(disappeared_callback));
+
+    // What the former walk over every map item reports for the current position, in map item order
+    auto expect_notifications = [&map, &cr]() {
+        vector<pair<bool, ident_t>> expected;
+
+        for (ptr<Item> item : map->GetItems()) {
+            bool was_seen = cr->CheckVisibleItem(item->GetId());
+            bool can_see = cr->CanSeeItemOnMap(item);
+
+            if (can_see && !was_seen) {
+                expected.emplace_back(true, item->GetId());
+            }
+            else if (!can_see && was_seen) {
+                expected.emplace_back(false, item->GetId());
+            }
+        }
+
+        return expected;
+    };
+
+    size_t mismatched_steps = 0;
+    size_t notified_total = 0;
+
+    for (int16_t x = 5; x < 195; x++) {
+        // Churn the map around the critter so the index sees adds, removals and moves between view updates
+        if (x % 40 == 20) {
+            auto items = to_vector(map->GetItems());
+
+            for (size_t i = 0; i < 15; i++) {
+                server->ItemMngr.DestroyItem(items[i * 7]);
+            }
+            for (int32_t i = 0; i < 15; i++) {
+                auto hex = map->GetSize().clamp_pos(cr->GetHex().x + i % 5 - 2, cr->GetHex().y + i / 5 - 1);
+                (void)server->ItemMngr.CreateItemOnHex(map, hex, get_func("TestItem"), 1, nullptr);
+            }
+            for (size_t i = 0; i < 10; i++) {
+                auto hex = map->GetSize().clamp_pos(cr->GetHex().x + 6, cr->GetHex().y + numeric_cast<int32_t>(i) - 5);
+                (void)server->ItemMngr.MoveItem(items[200 + i * 11], 1, map, hex);
+            }
+        }
+
+        StepCritter(map, cr, mpos {x, numeric_cast<int16_t>(100 + x % 7 - 3)});
+
+        auto expected = expect_notifications();
+        notified.clear();
+        server->MapMngr.ProcessVisibleItems(cr);
+
+        if (notified != expected) {
+            mismatched_steps++;
+        }
+
+        notified_total += notified.size();
+    }
+
+    CHECK(mismatched_steps == 0);
+    CHECK(notified_total > 100);
+
+    // Nothing outside the bounded look area stays visible, nothing inside is missed
+    size_t wrong_visibility = 0;
+
+    for (ptr<Item> item : map->GetItems()) {
+        bool in_range = GeometryHelper::GetDistance(cr->GetHex(), item->GetHex()) <= cr->GetLookDistance() + 2;
+
+        if (cr->CheckVisibleItem(item->GetId()) != in_range) {
+            wrong_visibility++;
+        }
+    }
+
+    CHECK(wrong_visibility == 0);
+
+    cr->OnItemOnMapAppeared.Unsubscribe(reinterpret_cast<uintptr_t>(&notified));
+    cr->OnItemOnMapDisappeared.Unsubscribe(reinterpret_cast<uintptr_t>(&notified));
+    server->MapMngr.DestroyLocation(loc);
+}
+
+TEST_CASE("EntityEventIdsMatchNameApi", "[server]")
+{
+    MAKE_LEM_SERVER();
+
+    auto cr = server->CreateCritter(get_func("TestCritter"), false);
+    auto other = server->CreateCritter(get_func("TestCritter"), false);
+
+    // Native event members intern their names on construction, lookups alone never intern
+    const auto appeared_id = Entity::FindEventId("OnCritterAppeared");
+    REQUIRE(appeared_id.has_value());
+    CHECK(Entity::GetEventName(appeared_id.value()) == "OnCritterAppeared");
+    CHECK(Entity::RegisterEventName("OnCritterAppeared") == appeared_id.value());
+
+    // Interning is process-wide and permanent, so the name-only event is unique per run to keep the absence check valid
+    const string undeclared_event = strex("OnEventNobodyDeclared{}", std::chrono::steady_clock::now().time_since_epoch().count()).str();
+    CHECK_FALSE(cr->HasEventCallbacks(undeclared_event));
+    CHECK_FALSE(Entity::FindEventId(undeclared_event).has_value());
+
+    vector<int32_t> calls;
+    auto make_callback = [&calls](int32_t tag, Entity::EventPriority priority) {
+        Entity::EventCallbackData callback;
+        callback.Callback = [&calls, tag](FuncCallData&) {
+            calls.emplace_back(tag);
+            return Entity::EventResult::ContinueChain;
+        };
+        callback.SubscriptionPtr = numeric_cast<uintptr_t>(tag);
+        callback.Priority = priority;
+        return callback;
+    };
+
+    // Name, id and member subscriptions land in the same callback list and keep priority order
+    cr->SubscribeEvent("OnCritterAppeared", make_callback(1, Entity::EventPriority::Normal));
+    cr->SubscribeEvent(appeared_id.value(), make_callback(2, Entity::EventPriority::High));
+    cr->OnCritterAppeared.Subscribe(make_callback(3, Entity::EventPriority::Low));
+    CHECK(cr->HasEventCallbacks("OnCritterAppeared"));
+    CHECK(cr->HasEventCallbacks(appeared_id.value()));
+    CHECK_FALSE(other->HasEventCallbacks(appeared_id.value()));
+
+    (void)cr->OnCritterAppeared.Fire(other);
+    CHECK(calls == vector<int32_t> {2, 1, 3});
+
+    cr->UnsubscribeEvent("OnCritterAppeared", 1);
+    cr->UnsubscribeEvent(appeared_id.value(), 2);
+    calls.clear();
+    (void)cr->OnCritterAppeared.Fire(other);
+    CHECK(calls == vector<int32_t> {3});
+
+    // Events only known by name still work through the compatibility layer
+    cr->SubscribeEvent(undeclared_event, make_callback(4, Entity::EventPriority::Normal));
+    const auto undeclared_id = Entity::FindEventId(undeclared_event);
+    REQUIRE(undeclared_id.has_value());
+    CHECK(Entity::GetEventName(undeclared_id.value()) == undeclared_event);
+    CHECK(cr->HasEventCallbacks(undeclared_event));
+
+    // The table only holds subscribed ids, a lower id subscribed later goes in front of a higher one
+    other->SubscribeEvent(undeclared_id.value(), make_callback(5, Entity::EventPriority::Normal));
+    other->SubscribeEvent(appeared_id.value(), make_callback(6, Entity::EventPriority::Normal));
+    CHECK(other->HasEventCallbacks(undeclared_id.value()));
+    CHECK(other->HasEventCallbacks(appeared_id.value()));
+    calls.clear();
+    (void)other->OnCritterAppeared.Fire(cr);
+    CHECK(calls == vector<int32_t> {6});
+    other->UnsubscribeAllEvents();
+    CHECK_FALSE(other->HasEventCallbacks(undeclared_id.value()));
+
+    cr->OnCritterAppeared.UnsubscribeAll();
+    cr->UnsubscribeAllEvent(undeclared_event);
+    CHECK_FALSE(cr->HasEventCallbacks(appeared_id.value()));
+    CHECK_FALSE(cr->HasEventCallbacks(undeclared_event));
+
+    calls.clear();
+    (void)cr->OnCritterAppeared.Fire(other);
+    CHECK(calls.empty());
+
+    server->CrMngr.DestroyCritter(cr);
+    server->CrMngr.DestroyCritter(other);
+}
+
+// Drives the striped entity registry through the real managers: worker threads create, look up and destroy free items
+// and custom inner entities under their own sync contexts while peeking at each other's ids, then the global walks
+// must report exactly the survivors
+TEST_CASE("EntityRegistryConcurrentCreateLookupDestroy", "[server]")
+{
+    MAKE_LEM_SERVER();
+
+    constexpr int32_t THREADS_COUNT = 6;
+    constexpr int32_t OPS_PER_THREAD = 3000;
+
+    hstring item_pid = get_func("TestItem");
+    hstring custom_type = get_func("CoverageTarget");
+    hstring custom_entry = get_func("CoverageItems");
+
+    const auto collect_ids = [&server, custom_type]() {
+        pair<vector<ident_t>, vector<ident_t>> ids;
+
+        for (const auto& item : server->EntityMngr.GetItems()) {
+            ids.first.emplace_back(item->GetId());
+        }
+        for (const auto& entity : server->EntityMngr.GetEntities()) {
+            if (entity->GetTypeName() == custom_type) {
+                ids.second.emplace_back(entity->GetId());
+            }
+        }
+
+        std::ranges::sort(ids.first);
+        std::ranges::sort(ids.second);
+        return ids;
+    };
+
+    // Every thread owns a holder critter, so custom entity publication contends on the registry shards only
+    vector<ptr<Critter>> holders;
+
+    for (int32_t i = 0; i < THREADS_COUNT; i++) {
+        holders.emplace_back(server->CreateCritter(get_func("TestCritter"), false));
+    }
+
+    const auto [base_item_ids, base_custom_ids] = collect_ids();
+
+    server->Unlock();
+
+    struct ThreadResult
+    {
+        vector<refcount_ptr<Item>> Items {};
+        vector<refcount_ptr<CustomEntity>> Customs {};
+        vector<ident_t> DestroyedIds {};
+        int32_t Failures {};
+        string FirstError {};
+    };
+
+    vector<ThreadResult> results(numeric_cast<size_t>(THREADS_COUNT));
+    std::atomic<int64_t> last_item_id {0};
+    std::atomic<int64_t> last_custom_id {0};
+
+    auto worker_fn = [&](int32_t tid) {
+        auto& result = results[numeric_cast<size_t>(tid)];
+        auto holder = holders[numeric_cast<size_t>(tid)];
+        uint64_t rng = numeric_cast<uint64_t>(tid) * 0x9E3779B97F4A7C15ULL + 1U;
+
+        SyncContext ctx;
+        ctx.Activate();
+
+        const auto fail = [&result](string_view what) {
+            if (result.Failures++ == 0) {
+                result.FirstError = what;
+            }
+        };
+
+        for (int32_t op = 0; op < OPS_PER_THREAD; op++) {
+            rng = rng * 6364136223846793005ULL + 1442695040888963407ULL;
+            const auto roll = (rng >> 33) % 100;
+
+            try {
+                if (roll < 30 || (result.Items.empty() && result.Customs.empty())) {
+                    if ((rng >> 20) % 2 == 0) {
+                        auto item = server->ItemMngr.CreateItem(item_pid, 1, nullptr);
+                        last_item_id.store(item->GetId().underlying_value(), std::memory_order_relaxed);
+                        result.Items.emplace_back(item);
+                    }
+                    else {
+                        ctx.SyncEntity(holder);
+                        auto custom = server->EntityMngr.CreateCustomInnerEntity(holder, custom_entry, {});
+                        last_custom_id.store(custom->GetId().underlying_value(), std::memory_order_relaxed);
+                        result.Customs.emplace_back(custom);
+                    }
+                }
+                else if (roll < 80) {
+                    // Own entities must be found, foreign recent ids may be in any state but must not break the lookup
+                    for (const auto& item : result.Items) {
+                        if (server->EntityMngr.GetItem(item->GetId()) != item.get()) {
+                            fail("Live item lookup mismatch");
+                        }
+                    }
+                    for (const auto& custom : result.Customs) {
+                        if (server->EntityMngr.GetCustomEntity(custom_type, custom->GetId()) != custom.get()) {
+                            fail("Live custom entity lookup mismatch");
+                        }
+                    }
+                    for (const auto id : result.DestroyedIds) {
+                        if (server->EntityMngr.GetEntity(id) != nullptr) {
+                            fail("Destroyed entity is still registered");
+                        }
+                    }
+
+                    ignore_unused(server->EntityMngr.GetItem(ident_t {last_item_id.load(std::memory_order_relaxed)}));
+                    ignore_unused(server->EntityMngr.GetEntity(ident_t {last_custom_id.load(std::memory_order_relaxed)}));
+                }
+                else if (!result.Items.empty() && ((rng >> 20) % 2 == 0 || result.Customs.empty())) {
+                    const auto index = numeric_cast<size_t>((rng >> 40) % numeric_cast<uint64_t>(result.Items.size()));
+                    auto item = result.Items[index];
+                    result.Items.erase(result.Items.begin() + numeric_cast<ptrdiff_t>(index));
+
+                    ctx.SyncEntity(item.get());
+                    server->ItemMngr.DestroyItem(item.get());
+                    result.DestroyedIds.emplace_back(item->GetId());
+                }
+                else if (!result.Customs.empty()) {
+                    const auto index = numeric_cast<size_t>((rng >> 40) % numeric_cast<uint64_t>(result.Customs.size()));
+                    auto custom = result.Customs[index];
+                    result.Customs.erase(result.Customs.begin() + numeric_cast<ptrdiff_t>(index));
+
+                    ctx.SyncEntity(holder);
+                    server->EntityMngr.DestroyEntity(custom.get());
+                    result.DestroyedIds.emplace_back(custom->GetId());
+                }
+            }
+            catch (const std::exception& ex) {
+                fail(ex.what());
+            }
+
+            ctx.Release();
+        }
+
+        ctx.Deactivate();
+    };
+
+    vector<std::thread> workers;
+
+    for (int32_t i = 0; i < THREADS_COUNT; i++) {
+        workers.emplace_back(worker_fn, i);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    REQUIRE(server->Lock(timespan {std::chrono::seconds {10}}));
+
+    vector<ident_t> expected_item_ids = base_item_ids;
+    vector<ident_t> expected_custom_ids = base_custom_ids;
+
+    for (const auto& result : results) {
+        INFO(result.FirstError);
+        CHECK(result.Failures == 0);
+
+        for (const auto& item : result.Items) {
+            expected_item_ids.emplace_back(item->GetId());
+        }
+        for (const auto& custom : result.Customs) {
+            expected_custom_ids.emplace_back(custom->GetId());
+        }
+    }
+
+    std::ranges::sort(expected_item_ids);
+    std::ranges::sort(expected_custom_ids);
+
+    const auto [item_ids, custom_ids] = collect_ids();
+    CHECK(item_ids == expected_item_ids);
+    CHECK(custom_ids == expected_custom_ids);
+    CHECK(server->EntityMngr.GetItemsCount() == item_ids.size());
+    CHECK(expected_item_ids.size() > base_item_ids.size());
+    CHECK(expected_custom_ids.size() > base_custom_ids.size());
+
+    auto sync = server->RequireCurrentSyncContext();
+
+    for (auto& result : results) {
+        for (const auto& item : result.Items) {
+            sync->SyncEntity(item.get());
+            server->ItemMngr.DestroyItem(item.get());
+        }
+
+        result.Items.clear();
+        result.Customs.clear();
+    }
+
+    for (auto holder : holders) {
+        sync->SyncEntity(holder);
+        server->CrMngr.DestroyCritter(holder);
+    }
+}
+
+TEST_CASE("MapItemViewIndexPerformance", "[!benchmark][server]")
+{
+    MAKE_LEM_SERVER_WITH(MakeItemLookSettings);
+
+    vector<hstring> map_pids {get_func("TestMap")};
+    auto loc = server->MapMngr.CreateLocation(get_func("TestLocation"), map_pids);
+    auto map = loc->GetMaps().front();
+
+    for (const auto hex : MakeScatteredHexes(50000, map->GetSize())) {
+        (void)server->ItemMngr.CreateItemOnHex(map, hex, get_func("TestItem"), 1, nullptr);
+    }
+
+    auto cr = server->CreateCritter(get_func("TestCritter"), false);
+    cr->SetLookDistance(20);
+    server->MapMngr.AddCritterToMap(cr, map, mpos {10, 100}, mdir {0}, ident_t {});
+
+    // Every measured iteration is one step along a row crossing the map and back
+    int16_t step = 0;
+    auto next_hex = [&step]() {
+        step = numeric_cast<int16_t>((step + 1) % 360);
+        return mpos {numeric_cast<int16_t>(10 + (step < 180 ? step : 359 - step)), 100};
+    };
+
+    BENCHMARK("Indexed view update, 50k map items")
+    {
+        StepCritter(map, cr, next_hex());
+        server->MapMngr.ProcessVisibleItems(cr);
+        return cr->GetVisibleItems().size();
+    };
+
+    // Replays the former update: every item on the map is checked on every step
+    BENCHMARK("Full scan view update, 50k map items")
+    {
+        StepCritter(map, cr, next_hex());
+
+        for (ptr<Item> item : copy_hold_ref(map->GetItems())) {
+            if (cr->CanSeeItemOnMap(item)) {
+                if (cr->AddVisibleItem(item->GetId())) {
+                    cr->Send_AddItemOnMap(item);
+                }
+            }
+            else if (cr->RemoveVisibleItem(item->GetId())) {
+                cr->Send_RemoveItemFromMap(item);
+            }
+        }
+
+        return cr->GetVisibleItems().size();
+    };
+
+    server->MapMngr.DestroyLocation(loc);
+}
+
+TEST_CASE("EntityEventDispatchPerformance", "[!benchmark][server]")
+{
+    MAKE_LEM_SERVER();
+
+    auto none_cr = server->CreateCritter(get_func("TestCritter"), false);
+    auto one_cr = server->CreateCritter(get_func("TestCritter"), false);
+    auto many_cr = server->CreateCritter(get_func("TestCritter"), false);
+    auto other = server->CreateCritter(get_func("TestCritter"), false);
+
+    size_t calls = 0;
+    auto make_callback = [&calls](uintptr_t subscription) {
+        Entity::EventCallbackData callback;
+        callback.Callback = [&calls](FuncCallData&) {
+            calls++;
+            return Entity::EventResult::ContinueChain;
+        };
+        callback.SubscriptionPtr = subscription;
+        return callback;
+    };
+
+    one_cr->OnCritterAppeared.Subscribe(make_callback(1));
+
+    for (uintptr_t i = 1; i <= 16; i++) {
+        many_cr->OnCritterAppeared.Subscribe(make_callback(i));
+        many_cr->OnCritterDisappeared.Subscribe(make_callback(i));
+        many_cr->OnItemOnMapAppeared.Subscribe(make_callback(i));
+    }
+
+    BENCHMARK("Fire, no subscriptions")
+    {
+        return none_cr->OnCritterAppeared.Fire(other);
+    };
+
+    BENCHMARK("Fire, one subscription")
+    {
+        return one_cr->OnCritterAppeared.Fire(other);
+    };
+
+    BENCHMARK("Fire, 16 subscriptions")
+    {
+        return many_cr->OnCritterAppeared.Fire(other);
+    };
+
+    // Cost of the name based compatibility layer against the interned id for the same check
+    const auto appeared_id = Entity::FindEventId("OnCritterAppeared").value();
+
+    BENCHMARK("HasEventCallbacks by name")
+    {
+        return many_cr->HasEventCallbacks("OnCritterAppeared");
+    };
+
+    BENCHMARK("HasEventCallbacks by id")
+    {
+        return many_cr->HasEventCallbacks(appeared_id);
+    };
+
+    CHECK(calls != 0);
+
+    server->CrMngr.DestroyCritter(none_cr);
+    server->CrMngr.DestroyCritter(one_cr);
+    server->CrMngr.DestroyCritter(many_cr);
+    server->CrMngr.DestroyCritter(other);
+}
+
 FO_END_NAMESPACE
@@ -0,0 +1,122 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "Geometry.h"
+#include "MapItemIndex.h"
+
+FO_BEGIN_NAMESPACE
+
+TEST_CASE("MapItemIndex")
+{
+    constexpr msize map_size {100, 80};
+
+    SECTION("CollectNearReturnsItemsWithinRadiusInInsertionOrder")
+    {
+        MapItemIndex index {map_size};
+        vector<pair<ident_t, mpos>> items;
+
+        // Spread over many chunks, inserted in an order unrelated to their position
+        for (int32_t i = 0; i < 400; i++) {
+            auto hex = mpos {numeric_cast<int16_t>((i * 37) % map_size.width), numeric_cast<int16_t>((i * 53) % map_size.height)};
+            auto item_id = ident_t {numeric_cast<int64_t>(1000 - i)};
+            index.Add(item_id, hex);
+            items.emplace_back(item_id, hex);
+        }
+
+        CHECK(index.GetCount() == items.size());
+
+        for (const auto center : {mpos {0, 0}, mpos {50, 40}, mpos {99, 79}, mpos {15, 16}}) {
+            for (const int32_t radius : {0, 5, 16, 40, 200}) {
+                vector<ident_t> expected;
+
+                for (const auto& [item_id, hex] : items) {
+                    if (GeometryHelper::GetDistance(center, hex) <= radius) {
+                        expected.emplace_back(item_id);
+                    }
+                }
+
+                CHECK(index.CollectNear(center, radius, {}) == expected);
+            }
+        }
+    }
+
+    SECTION("ExtraIdsAreIncludedOnceWhereverTheyLie")
+    {
+        MapItemIndex index {map_size};
+        index.Add(ident_t {1}, mpos {10, 10});
+        index.Add(ident_t {2}, mpos {90, 70});
+        index.Add(ident_t {3}, mpos {11, 10});
+        index.Add(ident_t {4}, mpos {60, 10});
+
+        // Near item listed as extra is not duplicated, unknown ids are ignored, far extras keep their order
+        unordered_set<ident_t> extra_ids {ident_t {3}, ident_t {2}, ident_t {77}};
+
+        CHECK(index.CollectNear(mpos {10, 10}, 3, extra_ids) == vector<ident_t> {ident_t {1}, ident_t {2}, ident_t {3}});
+        CHECK(index.CollectNear(mpos {10, 10}, -1, extra_ids) == vector<ident_t> {ident_t {2}, ident_t {3}});
+    }
+
+    SECTION("RemovedAndReaddedItemsMoveToTheEnd")
+    {
+        MapItemIndex index {map_size};
+        index.Add(ident_t {1}, mpos {20, 20});
+        index.Add(ident_t {2}, mpos {21, 20});
+        index.Add(ident_t {3}, mpos {22, 20});
+
+        // A move is a removal followed by an add, which matches the map item list order
+        index.Remove(ident_t {1});
+        index.Add(ident_t {1}, mpos {23, 21});
+
+        CHECK(index.GetCount() == 3);
+        CHECK(index.CollectNear(mpos {21, 20}, 5, {}) == vector<ident_t> {ident_t {2}, ident_t {3}, ident_t {1}});
+
+        index.Remove(ident_t {2});
+
+        CHECK_FALSE(index.Contains(ident_t {2}));
+        CHECK(index.CollectNear(mpos {21, 20}, 5, {}) == vector<ident_t> {ident_t {3}, ident_t {1}});
+        CHECK(index.CollectNear(mpos {21, 20}, 0, {}).empty());
+    }
+
+    SECTION("InvalidOperationsThrow")
+    {
+        MapItemIndex index {map_size};
+        index.Add(ident_t {1}, mpos {0, 0});
+
+        CHECK_THROWS(index.Add(ident_t {1}, mpos {1, 1}));
+        CHECK_THROWS(index.Add(ident_t {2}, mpos {100, 0}));
+        CHECK_THROWS(index.Remove(ident_t {3}));
+    }
+}
+
+FO_END_NAMESPACE
@@ -33,9 +33,11 @@
 
 #include "catch_amalgamated.hpp"
 
+#include "ConfigFile.h"
 #include "EngineBase.h"
 #include "EntityProtos.h"
 #include "MapLoader.h"
+#include "Test_BakerHelpers.h"
 
 FO_BEGIN_NAMESPACE
 
@@ -53,6 +55,17 @@ static auto GetTestMapLoaderRegistrar(EngineMetadata& meta, string_view type_nam
     return registrar;
 }
 
+static auto BuildMapLoaderBenchmarkInput(int32_t entity_count) -> string
+{
+    string input = "[ProtoMap]\n$Name = BenchMap\nWidth = 500\nHeight = 500\n";
+
+    for (int32_t i = 0; i < entity_count; i++) {
+        input += strex("[$Name/{}]\n$Id = {}\n$Proto = {}\nHex = {} {}\nDir = {}\n", i % 2 == 0 ? "Critter" : "Item", i + 1, i % 2 == 0 ? "TestCritter" : "TestItem", i % 500, i / 500, i % 6);
+    }
+
+    return input;
+}
+
 TEST_CASE("MapLoader")
 {
     SECTION("RejectsMapsWithoutProtoMapSection")
@@ -345,6 +358,178 @@ TEST_CASE("MapLoader")
 
         CHECK(item_calls == 1);
     }
+
+    SECTION("StreamingLoadMatchesConfigFileSections")
+    {
+        EngineMetadata meta {[] { }};
+        InitTestMapLoaderMetadata(meta);
+        auto critter_proto = SafeAlloc::MakeRefCounted<ProtoCritter>(meta.Hashes.ToHashedString("TestCritter"), GetTestMapLoaderRegistrar(meta, "Critter"));
+        auto item_proto = SafeAlloc::MakeRefCounted<ProtoItem>(meta.Hashes.ToHashedString("TestItem"), GetTestMapLoaderRegistrar(meta, "Item"));
+        meta.RegisterProto(meta.Hashes.ToHashedString("Critter"), critter_proto);
+        meta.RegisterProto(meta.Hashes.ToHashedString("Item"), item_proto);
+
+        HashStorage hashes {};
+
+        // Comments, quoting, appends, continuations, CRLF and malformed lines all take the ConfigFile path
+        string map_buf = "# Leading comment\n"
+                         "[ProtoMap]\r\n"
+                         "$Name = TestMap # trailing comment\n"
+                         "[$Name/Critter]\n"
+                         "$Id = 5\n"
+                         "$Proto = TestCritter\n"
+                         "Text = \"quoted # not a comment\"\n"
+                         "Text += tail\n"
+                         "Joined = first \\\n"
+                         "   second\n"
+                         "[Broken\n"
+                         "NoSeparator\n"
+                         "[OtherMap/Item]\n"
+                         "$Proto = TestItem\n"
+                         "[$Name/Item]\r\n"
+                         "$Proto = TestItem\r\n"
+                         "Kind = A\n"
+                         "Kind = B\n"
+                         "Empty +=\n"
+                         "[ProtoMap]\n"
+                         "$Name = OtherMap\n";
+
+        vector<map<string, string>> loaded_sections;
+        auto copy_kv = [](const map<string_view, string_view>& kv) {
+            map<string, string> result;
+
+            for (const auto& [key, value] : kv) {
+                result.emplace(key, value);
+            }
+
+            return result;
+        };
+
+        CHECK_NOTHROW(MapLoader::Load(
+            "TestMap", "TestMap.fomap", map_buf, meta, hashes, [&](ident_t, ptr<const ProtoCritter>, ptr<const map<string_view, string_view>> kv) { loaded_sections.emplace_back(copy_kv(*kv)); }, [&](ident_t, ptr<const ProtoItem>, ptr<const map<string_view, string_view>> kv) { loaded_sections.emplace_back(copy_kv(*kv)); }));
+
+        ConfigFile config {map_buf};
+        vector<map<string, string>> expected_sections;
+
+        for (string_view section_type : {"$Name/Critter", "$Name/Item"}) {
+            for (const auto& [section_name, section_kv] : config.GetOrderedSections()) {
+                if (section_name == section_type) {
+                    expected_sections.emplace_back(copy_kv(*section_kv));
+                }
+            }
+        }
+
+        REQUIRE(expected_sections.size() == 2);
+        CHECK(loaded_sections == expected_sections);
+        CHECK(loaded_sections[0].at("Text") == "\"quoted # not a comment\" tail");
+        CHECK(loaded_sections[0].at("Joined") == "first second");
+        CHECK(loaded_sections[1].at("Kind") == "B");
+
+        CHECK(MapLoader::EnumerateMaps("TestMap.fomap", map_buf) == vector<string> {"TestMap", "OtherMap"});
+    }
+}
+
+TEST_CASE("MapNameCatalog")
+{
+    auto source = SafeAlloc::MakeUnique<BakerTests::MemoryDataSource>("MapCatalogPack");
+    ptr<BakerTests::MemoryDataSource> source_ptr = source.get();
+    source_ptr->AddFile("Maps/Multi.fomap", string_view {"[ProtoMap]\n$Name = MapOne\n[ProtoMap]\n$Name = MapTwo\n"}, 100);
+    source_ptr->AddFile("Maps/Plain.fopro", string_view {"[ProtoItem]\n$Name = Knife\n"}, 100);
+
+    FileSystem resources;
+    resources.AddCustomSource(std::move(source));
+
+    SECTION("UnchangedFilesAreServedWithoutRescan")
+    {
+        MapNameCatalog catalog;
+
+        CHECK(catalog.GetMapNames(resources.ReadFileHeader("Maps/Multi.fomap")) == vector<string> {"MapOne", "MapTwo"});
+        CHECK(catalog.GetMapNames(resources.ReadFile("Maps/Plain.fopro")).empty());
+        CHECK(catalog.GetEntriesCount() == 2);
+        CHECK(catalog.IsChanged());
+
+        // Same size and write time: the stale content is deliberately not looked at
+        source_ptr->AddFile("Maps/Multi.fomap", string_view {"[ProtoMap]\n$Name = MapXxx\n[ProtoMap]\n$Name = MapTwo\n"}, 100);
+        CHECK(catalog.GetMapNames(resources.ReadFileHeader("Maps/Multi.fomap")) == vector<string> {"MapOne", "MapTwo"});
+
+        source_ptr->AddFile("Maps/Multi.fomap", string_view {"[ProtoMap]\n$Name = MapXxx\n[ProtoMap]\n$Name = MapTwo\n"}, 101);
+        CHECK(catalog.GetMapNames(resources.ReadFileHeader("Maps/Multi.fomap")) == vector<string> {"MapXxx", "MapTwo"});
+
+        catalog.Forget("Maps/Multi.fomap");
+        catalog.RetainPaths({});
+        CHECK(catalog.GetEntriesCount() == 0);
+    }
+
+    SECTION("FilesWithoutWriteTimeAreAlwaysScanned")
+    {
+        source_ptr->AddFile("Maps/Untimed.fomap", string_view {"[ProtoMap]\n$Name = Untimed\n"}, 0);
+
+        MapNameCatalog catalog;
+        CHECK(catalog.GetMapNames(resources.ReadFileHeader("Maps/Untimed.fomap")) == vector<string> {"Untimed"});
+        CHECK(catalog.GetEntriesCount() == 0);
+        CHECK_FALSE(catalog.IsChanged());
+    }
+
+    SECTION("TextRoundTripKeepsEntries")
+    {
+        MapNameCatalog catalog;
+        (void)catalog.GetMapNames(resources.ReadFileHeader("Maps/Multi.fomap"));
+        (void)catalog.GetMapNames(resources.ReadFileHeader("Maps/Plain.fopro"));
+
+        string text = catalog.SaveToText();
+        catalog.MarkSaved();
+        CHECK_FALSE(catalog.IsChanged());
+
+        MapNameCatalog restored;
+        restored.LoadFromText(text);
+        CHECK(restored.GetEntriesCount() == 2);
+        CHECK_FALSE(restored.IsChanged());
+        CHECK(restored.SaveToText() == text);
+
+        source_ptr->AddFile("Maps/Multi.fomap", string_view {"[ProtoMap]\n$Name = MapXxx\n[ProtoMap]\n$Name = MapTwo\n"}, 100);
+        CHECK(restored.GetMapNames(resources.ReadFileHeader("Maps/Multi.fomap")) == vector<string> {"MapOne", "MapTwo"});
+        CHECK_FALSE(restored.IsChanged());
+    }
+
+    SECTION("DamagedTextIsDropped")
+    {
+        MapNameCatalog catalog;
+        catalog.LoadFromText("FONLINE_MAP_NAME_CATALOG_V1\nMaps/Multi.fomap\t61\t100\tMapOne\nMaps/Broken.fomap\tbad\n");
+        CHECK(catalog.GetEntriesCount() == 0);
+
+        catalog.LoadFromText("SOMETHING_ELSE\n");
+        CHECK(catalog.GetEntriesCount() == 0);
+    }
+}
+
+TEST_CASE("MapLoaderPerformance", "[!benchmark][maps]")
+{
+    EngineMetadata meta {[] { }};
+    InitTestMapLoaderMetadata(meta);
+    auto critter_proto = SafeAlloc::MakeRefCounted<ProtoCritter>(meta.Hashes.ToHashedString("TestCritter"), GetTestMapLoaderRegistrar(meta, "Critter"));
+    auto item_proto = SafeAlloc::MakeRefCounted<ProtoItem>(meta.Hashes.ToHashedString("TestItem"), GetTestMapLoaderRegistrar(meta, "Item"));
+    meta.RegisterProto(meta.Hashes.ToHashedString("Critter"), critter_proto);
+    meta.RegisterProto(meta.Hashes.ToHashedString("Item"), item_proto);
+
+    HashStorage hashes {};
+    string benchmark_input = BuildMapLoaderBenchmarkInput(100000);
+
+    BENCHMARK("LoadLargeMap")
+    {
+        size_t entities = 0;
+        MapLoader::Load("BenchMap", "BenchMap.fomap", benchmark_input, meta, hashes, [&](ident_t, ptr<const ProtoCritter>, ptr<const map<string_view, string_view>> kv) { entities += kv->size(); }, [&](ident_t, ptr<const ProtoItem>, ptr<const map<string_view, string_view>> kv) { entities += kv->size(); });
+        return entities;
+    };
+
+    BENCHMARK("ParseLargeMapAsConfigFile")
+    {
+        ConfigFile config {benchmark_input};
+        return config.GetOrderedSections().size();
+    };
+
+    BENCHMARK("EnumerateLargeMap")
+    {
+        return MapLoader::EnumerateMaps("BenchMap.fomap", benchmark_input).size();
+    };
 }
 
 FO_END_NAMESPACE
@@ -0,0 +1,223 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "LineTracer.h"
+#include "MapSightCache.h"
+
+FO_BEGIN_NAMESPACE
+
+namespace
+{
+    // The line walk before the cache, straight over the blocker flags, in the shape of a cached segment. How
+    // MapManager::TracePath consumes segments is covered by the server-level comparison in Test_ServerEngine.cpp
+    static auto TraceUncached(msize map_size, const vector<bool>& blocked, mpos start_hex, mpos target_hex, float32_t angle, int32_t dist) -> MapSightCache::Segment
+    {
+        MapSightCache::Segment result;
+        auto tracer = LineTracer(start_hex, target_hex, angle, map_size);
+        mpos hex = start_hex;
+
+        for (int32_t i = 0; i < dist; i++) {
+            if (!tracer.GetNextHex(hex).has_value()) {
+                break;
+            }
+
+            result.Hexes.emplace_back(hex);
+
+            if (blocked[HexBitGrid::GetBitIndex(map_size, hex)]) {
+                result.Blocked = true;
+                break;
+            }
+        }
+
+        return result;
+    }
+}
+
+TEST_CASE("MapSightCache")
+{
+    SECTION("HexBitGridStoresOneBitPerHex")
+    {
+        constexpr msize map_size {70, 3};
+        HexBitGrid grid {map_size};
+
+        CHECK(grid.Set(mpos {63, 0}, true));
+        CHECK(grid.Set(mpos {0, 1}, true));
+        CHECK_FALSE(grid.Set(mpos {0, 1}, true));
+
+        CHECK(grid.Get(mpos {63, 0}));
+        CHECK(grid.Get(mpos {0, 1}));
+        CHECK_FALSE(grid.Get(mpos {64, 0}));
+        CHECK(grid.GetWord(0) == uint64_t {1} << 63);
+        CHECK(grid.GetWord(1) == uint64_t {1} << 6);
+
+        CHECK(grid.Set(mpos {63, 0}, false));
+        CHECK(grid.GetWord(0) == 0);
+    }
+
+    SECTION("RandomTracesMatchUncachedTracesWhileBlockersToggle")
+    {
+        std::mt19937 rnd {4242}; // NOLINT(cert-msc51-cpp)
+
+        for (const auto map_size : {msize {17, 13}, msize {64, 64}, msize {100, 37}}) {
+            HexBitGrid static_blocks {map_size};
+            vector<bool> static_blocked(numeric_cast<size_t>(map_size.width) * numeric_cast<size_t>(map_size.height));
+            vector<bool> dynamic_blocked(static_blocked.size());
+
+            auto random_hex = [&]() -> mpos { return mpos {numeric_cast<int16_t>(rnd() % numeric_cast<uint32_t>(map_size.width)), numeric_cast<int16_t>(rnd() % numeric_cast<uint32_t>(map_size.height))}; };
+
+            for (size_t i = 0; i < static_blocked.size() / 20; i++) {
+                auto hex = random_hex();
+                static_blocks.Set(hex, true);
+                static_blocked[HexBitGrid::GetBitIndex(map_size, hex)] = true;
+            }
+
+            MapSightCache cache {map_size, &static_blocks};
+
+            // A small pool of endpoints makes most traces repeat, the way paired visibility checks do
+            vector<mpos> endpoints;
+
+            for (int32_t i = 0; i < 12; i++) {
+                endpoints.emplace_back(random_hex());
+            }
+
+            constexpr array<float32_t, 3> angles {0.0f, 7.5f, -20.0f};
+            constexpr array<int32_t, 3> max_dists {0, 6, 1000};
+
+            for (int32_t op = 0; op < 4000; op++) {
+                if (rnd() % 5 == 0) {
+                    // Doors and items toggling their shootability, sometimes on a static blocker
+                    auto hex = rnd() % 2 == 0 ? endpoints[rnd() % endpoints.size()] : random_hex();
+                    const bool blocked = rnd() % 2 == 0;
+                    cache.SetDynamicBlocked(hex, blocked);
+                    dynamic_blocked[HexBitGrid::GetBitIndex(map_size, hex)] = blocked;
+                    continue;
+                }
+
+                const auto start_hex = endpoints[rnd() % endpoints.size()];
+                const auto target_hex = rnd() % 4 == 0 ? random_hex() : endpoints[rnd() % endpoints.size()];
+                const auto angle = angles[rnd() % angles.size()];
+                const auto max_dist = max_dists[rnd() % max_dists.size()];
+                const int32_t dist = max_dist != 0 ? max_dist : GeometryHelper::GetDistance(start_hex, target_hex);
+
+                vector<bool> blocked(static_blocked.size());
+
+                for (size_t i = 0; i < blocked.size(); i++) {
+                    blocked[i] = static_blocked[i] || dynamic_blocked[i];
+                }
+
+                const auto expected = TraceUncached(map_size, blocked, start_hex, target_hex, angle, dist);
+                const auto actual = cache.GetSegment(start_hex, target_hex, angle, dist);
+
+                CHECK(actual->Hexes == expected.Hexes);
+                CHECK(actual->Blocked == expected.Blocked);
+                CHECK(cache.IsShootable(target_hex) == !blocked[HexBitGrid::GetBitIndex(map_size, target_hex)]);
+            }
+
+            CHECK(cache.GetCachedSegmentsCount() <= MapSightCache::MAX_SEGMENTS);
+        }
+    }
+
+    SECTION("TogglingBlockerDropsOnlySegmentsItChanges")
+    {
+        constexpr msize map_size {40, 40};
+        HexBitGrid static_blocks {map_size};
+        static_blocks.Set(mpos {20, 30}, true);
+        MapSightCache cache {map_size, &static_blocks};
+
+        // Distinct lines, one ends at the static blocker
+        auto crossing = cache.GetSegment(mpos {5, 10}, mpos {30, 10}, 0.0f, 25);
+        auto elsewhere = cache.GetSegment(mpos {5, 20}, mpos {30, 20}, 0.0f, 25);
+        auto to_static = cache.GetSegment(mpos {20, 25}, mpos {20, 35}, 0.0f, 10);
+        REQUIRE(cache.GetCachedSegmentsCount() == 3);
+        REQUIRE_FALSE(crossing->Blocked);
+        REQUIRE(to_static->Blocked);
+
+        const auto middle_hex = crossing->Hexes[crossing->Hexes.size() / 2];
+        REQUIRE(std::ranges::find(elsewhere->Hexes, middle_hex) == elsewhere->Hexes.end());
+
+        cache.SetDynamicBlocked(middle_hex, true);
+        CHECK(cache.GetCachedSegmentsCount() == 2);
+        CHECK(cache.GetSegment(mpos {5, 10}, mpos {30, 10}, 0.0f, 25)->Blocked);
+
+        // Opening it again drops the segment that now ends there
+        cache.SetDynamicBlocked(middle_hex, false);
+        CHECK(cache.GetCachedSegmentsCount() == 2);
+        CHECK(cache.GetSegment(mpos {5, 10}, mpos {30, 10}, 0.0f, 25)->Hexes == crossing->Hexes);
+
+        // A dynamic blocker over a static one changes nothing
+        cache.SetDynamicBlocked(mpos {20, 30}, true);
+        CHECK(cache.GetCachedSegmentsCount() == 3);
+        CHECK(cache.IsDynamicBlocked(mpos {20, 30}));
+        CHECK_FALSE(cache.IsShootable(mpos {20, 30}));
+    }
+
+    SECTION("DisabledCachingTracesEveryCall")
+    {
+        constexpr msize map_size {40, 40};
+        HexBitGrid static_blocks {map_size};
+        MapSightCache cache {map_size, &static_blocks, false};
+        CHECK_FALSE(cache.IsCachingEnabled());
+
+        auto open = cache.GetSegment(mpos {5, 10}, mpos {30, 10}, 0.0f, 25);
+        REQUIRE_FALSE(open->Blocked);
+        CHECK(cache.GetCachedSegmentsCount() == 0);
+
+        const auto middle_hex = open->Hexes[open->Hexes.size() / 2];
+        cache.SetDynamicBlocked(middle_hex, true);
+
+        auto cut = cache.GetSegment(mpos {5, 10}, mpos {30, 10}, 0.0f, 25);
+        CHECK(cut->Blocked);
+        CHECK(cut->Hexes.back() == middle_hex);
+        CHECK(cache.GetCachedSegmentsCount() == 0);
+    }
+
+    SECTION("CacheStaysBounded")
+    {
+        constexpr msize map_size {200, 200};
+        HexBitGrid static_blocks {map_size};
+        MapSightCache cache {map_size, &static_blocks};
+
+        for (int16_t x = 0; x < 60; x++) {
+            for (int16_t y = 0; y < 40; y++) {
+                auto segment = cache.GetSegment(mpos {100, 100}, mpos {x, y}, 0.0f, 4);
+                CHECK(segment->Hexes.size() == 4);
+            }
+        }
+
+        CHECK(cache.GetCachedSegmentsCount() == MapSightCache::MAX_SEGMENTS);
+    }
+}
+
+FO_END_NAMESPACE
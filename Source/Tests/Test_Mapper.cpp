@@ -2910,6 +2910,9 @@ TEST_CASE("MapperSavesMapsToADiskMapsRoot")
         // Re-saving the same name overwrites in place instead of appending a second container
         REQUIRE_NOTHROW(mapper->SaveMapToDir(map.as_ptr(), "Generated", "SavedByTest"));
         CHECK(std::filesystem::exists(maps_dir / "Generated" / "SavedByTest.fomap"));
+
+        // The rewritten container's catalog entry is dropped and the catalog is persisted right away
+        CHECK_FALSE(mapper->MapCatalog.IsChanged());
     }
 
     SECTION("SavingUnderTheReferenceContainerSplicesIntoIt")
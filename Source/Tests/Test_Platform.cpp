@@ -39,6 +39,7 @@
 #include <unistd.h>
 #endif
 
+#include "DiskFileSystem.h"
 #include "Platform.h"
 #include "StringUtils.h"
 
@@ -135,6 +136,47 @@ TEST_CASE("Platform")
         Platform::UnloadModule(nullptr);
     }
 
+    SECTION("ReadFileAtReadsThroughAHeldHandle")
+    {
+        auto temp_root = std::filesystem::temp_directory_path() / "lf_platform_tests" / std::to_string(std::random_device {}());
+        std::filesystem::create_directories(temp_root);
+
+        string data_path = fs_path_to_string(temp_root / "data.bin");
+        vector<uint8_t> data(70000);
+
+        for (size_t i = 0; i < data.size(); i++) {
+            data[i] = static_cast<uint8_t>(i * 31 + 7);
+        }
+
+        REQUIRE(fs_write_file(data_path, data));
+
+        CHECK(Platform::OpenReadOnlyFile(fs_path_to_string(temp_root / "missing.bin")) == Platform::INVALID_FILE_HANDLE);
+
+        intptr_t file_handle = Platform::OpenReadOnlyFile(data_path);
+        vector<uint8_t> read_data(1000);
+
+#if FO_WINDOWS || FO_LINUX || FO_MAC
+        REQUIRE(file_handle != Platform::INVALID_FILE_HANDLE);
+
+        REQUIRE(Platform::ReadFileAt(file_handle, 12345, read_data));
+        CHECK(std::equal(read_data.begin(), read_data.end(), data.begin() + 12345));
+
+        // Short reads at the end fail as a whole
+        CHECK_FALSE(Platform::ReadFileAt(file_handle, data.size() - 10, read_data));
+
+        // The handle shares writing, so the file can still be rewritten while it is held
+        REQUIRE(fs_write_file(data_path, string_view {"short"}));
+        CHECK_FALSE(Platform::ReadFileAt(file_handle, 12345, read_data));
+#else
+        CHECK(file_handle == Platform::INVALID_FILE_HANDLE);
+#endif
+
+        CHECK_FALSE(Platform::ReadFileAt(Platform::INVALID_FILE_HANDLE, 0, read_data));
+        Platform::CloseFile(file_handle);
+
+        CHECK(std::filesystem::remove_all(temp_root) > 0);
+    }
+
     SECTION("CpuUsageSnapshotIsWellFormed")
     {
         Platform::CpuUsageSnapshot snapshot = Platform::GetCpuUsageSnapshot();
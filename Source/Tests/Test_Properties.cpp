@@ -2312,6 +2312,30 @@ TEST_CASE("PropertiesCustomAccessors")
     CHECK(post_setter_calls == 2);
 }
 
+TEST_CASE("PropertyPostSetterOrder")
+{
+    HashStorage hashes {};
+    TestNameResolver resolver;
+    PropertyRegistrar registrar("PostSetterEntity", EngineSideKind::ServerSide, &hashes, &resolver);
+
+    auto prop = registrar.RegisterProperty({"Common", "int32", "Value", "Mutable"});
+
+    Properties props(&registrar);
+    props.SetEntity(reinterpret_cast<Entity*>(size_t {1}));
+
+    string order;
+
+    prop->AddPostSetter([&](nptr<Entity>, ptr<const Property>) { order += "a"; });
+    prop->AddPostSetter([&](nptr<Entity>, ptr<const Property>) { order += "L"; }, true);
+    prop->AddPostSetter([&](nptr<Entity>, ptr<const Property>) { order += "b"; });
+    prop->AddPostSetter([&](nptr<Entity>, ptr<const Property>) { order += "M"; }, true);
+
+    // Leading ones go first whenever they were added, each group runs from its last added
+    props.SetValue<int32_t>(prop, 1);
+    CHECK(order == "MLba");
+    CHECK(prop->GetPostSetters()->size() == 4);
+}
+
 TEST_CASE("PropertyRawDataStorageModes")
 {
     SECTION("SmallAllocAndSetAsUseOwnedStorage")
@@ -48,6 +48,21 @@ static void InitProtoTestMetadata(EngineMetadata& meta)
     meta.RegisterEntityType("Location", true, false, true, true, true);
 }
 
+// Plain, flag, text, hash and collection values, so a restore that mixed up records or hashes shows in the data
+static void RegisterProtoLoadTestProperties(EngineMetadata& meta)
+{
+    for (const auto* type_name : {"Item", "Critter"}) {
+        auto registrar = meta.GetPropertyRegistrarForEdit(type_name);
+        registrar->RegisterProperty({"Common", "bool", "Hidden", "Mutable", "Persistent"});
+        registrar->RegisterProperty({"Common", "int32", "Value", "Mutable", "Persistent"});
+        registrar->RegisterProperty({"Common", "string", "Text", "Mutable", "Persistent"});
+        registrar->RegisterProperty({"Common", "hstring", "Tag", "Mutable", "Persistent"});
+        registrar->RegisterProperty({"Common", "int32[]", "Numbers", "Mutable", "Persistent"});
+        registrar->RegisterProperty({"Common", "hstring[]", "Tags", "Mutable", "Persistent"});
+        registrar->RegisterProperty({"Common", "string=>int32", "Counters", "Mutable", "Persistent"});
+    }
+}
+
 static auto GetTestRegistrar(EngineMetadata& meta, hstring type_name) -> ptr<const PropertyRegistrar>
 {
     auto registrar = meta.GetPropertyRegistrar(type_name);
@@ -190,6 +205,123 @@ TEST_CASE("ProtoManager")
         CHECK(IsSameProtoPtr(meta.GetProtoEntity(proto_item_type, loaded_pid), meta.GetProtoItem(loaded_pid)));
         CHECK(meta.GetProtoItems().contains(loaded_pid));
     }
+
+    SECTION("ParallelLoadMatchesSerialLoad")
+    {
+        // Every load gets its own metadata, so interning order and hash storage are not shared between the runs
+        EngineMetadata source_meta {[] { }};
+        EngineMetadata serial_meta {[] { }};
+        EngineMetadata parallel_meta {[] { }};
+
+        for (auto* meta : {&source_meta, &serial_meta, &parallel_meta}) {
+            InitProtoTestMetadata(*meta);
+            RegisterProtoLoadTestProperties(*meta);
+        }
+
+        auto source = SafeAlloc::MakeUnique<BakerTests::MemoryDataSource>("ProtoTestPack");
+
+        for (const auto* type_name : {"Item", "Critter"}) {
+            auto registrar = GetTestRegistrar(source_meta, source_meta.Hashes.ToHashedString(type_name));
+
+            for (int32_t file_index = 0; file_index < 6; file_index++) {
+                vector<pair<string, function<void(ProtoItem&)>>> protos;
+
+                for (int32_t proto_index = 0; proto_index < 50; proto_index++) {
+                    const int32_t n = file_index * 50 + proto_index;
+
+                    protos.emplace_back(strex("{}_{}_{}", type_name, file_index, proto_index), [&source_meta, registrar, type_name, n](ProtoItem& proto) {
+                        auto props = proto.GetPropertiesForEdit();
+                        props->SetValue<bool>(registrar->FindProperty("Hidden").as_ptr(), true);
+                        props->SetValue<int32_t>(registrar->FindProperty("Value").as_ptr(), n + 1);
+                        props->SetValue<string>(registrar->FindProperty("Text").as_ptr(), strex("{} text {}", type_name, n).str());
+                        props->SetValue<hstring>(registrar->FindProperty("Tag").as_ptr(), source_meta.Hashes.ToHashedString(strex("{}Tag{}", type_name, n)));
+                        props->SetValue(registrar->FindProperty("Numbers").as_ptr(), vector<int32_t> {n, n * 2, -n});
+                        props->SetValue(registrar->FindProperty("Tags").as_ptr(), vector<hstring> {source_meta.Hashes.ToHashedString(strex("Shared{}", n % 7)), source_meta.Hashes.ToHashedString(strex("Own{}{}", type_name, n))});
+                        props->ApplyPropertyFromText(registrar->FindProperty("Counters").as_ptr(), strex("first {} second {}", n, n + 100));
+                    });
+                }
+
+                source->AddFile(strex("{}{}.fopro-bin-server", type_name, file_index), BakerTests::MakeMultiProtoResourceBlob<ProtoItem>(source_meta, source_meta.Hashes.ToHashedString(type_name), protos));
+            }
+        }
+
+        FileSystem resources;
+        resources.AddCustomSource(std::move(source));
+
+        ProtoManager serial {make_ptr(&serial_meta)};
+        ProtoManager parallel {make_ptr(&parallel_meta)};
+        serial.LoadFromResources(resources, 1);
+        parallel.LoadFromResources(resources, 8);
+
+        REQUIRE(serial.GetAllProtos().size() == parallel.GetAllProtos().size());
+        CHECK(serial.GetProtoItems().size() == 300);
+        CHECK(serial.GetProtoCritters().size() == 300);
+
+        const auto to_strings = [](const set<hstring>& hashes) {
+            vector<string> strings;
+
+            for (const auto& hstr : hashes) {
+                strings.emplace_back(hstr.as_str());
+            }
+
+            std::ranges::sort(strings);
+            return strings;
+        };
+
+        for (const auto& [serial_type_name, serial_protos] : serial.GetAllProtos()) {
+            const auto& parallel_protos = parallel.GetProtoEntities(parallel_meta.Hashes.ToHashedString(serial_type_name.as_str()));
+            REQUIRE(serial_protos.size() == parallel_protos.size());
+
+            for (const auto& [serial_pid, serial_proto] : serial_protos) {
+                const auto it = parallel_protos.find(parallel_meta.Hashes.ToHashedString(serial_pid.as_str()));
+                REQUIRE(it != parallel_protos.end());
+                const auto& parallel_proto = it->second;
+                CHECK(parallel_proto->GetTypeName().as_str() == serial_proto->GetTypeName().as_str());
+
+                vector<uint8_t> serial_data;
+                vector<uint8_t> parallel_data;
+                set<hstring> serial_hashes;
+                set<hstring> parallel_hashes;
+                serial_proto->GetProperties()->StoreAllData(serial_data, serial_hashes);
+                parallel_proto->GetProperties()->StoreAllData(parallel_data, parallel_hashes);
+                CHECK(serial_data == parallel_data);
+                CHECK(to_strings(serial_hashes) == to_strings(parallel_hashes));
+                CHECK(serial_hashes.size() == 3);
+
+                // The loaded values are the generated ones, not defaults that would compare equal on any thread count
+                auto registrar = parallel_proto->GetProperties()->GetRegistrar();
+                CHECK(parallel_proto->GetProperties()->GetValue<bool>(registrar->FindProperty("Hidden").as_ptr()));
+                CHECK(parallel_proto->GetProperties()->GetValue<int32_t>(registrar->FindProperty("Value").as_ptr()) > 0);
+                CHECK(parallel_proto->GetProperties()->GetValue<string>(registrar->FindProperty("Text").as_ptr()).starts_with(serial_type_name.as_str()));
+                CHECK(parallel_proto->GetProperties()->GetValue<hstring>(registrar->FindProperty("Tag").as_ptr()).as_str().starts_with(serial_type_name.as_str()));
+                CHECK(parallel_proto->GetProperties()->GetValue<vector<int32_t>>(registrar->FindProperty("Numbers").as_ptr()).size() == 3);
+                CHECK(parallel_proto->GetProperties()->SavePropertyToText(registrar->FindProperty("Counters").as_ptr()) == serial_proto->GetProperties()->SavePropertyToText(serial_proto->GetProperties()->GetRegistrar()->FindProperty("Counters").as_ptr()));
+            }
+        }
+    }
+
+    SECTION("ParallelLoadReportsBrokenFileLikeSerialLoad")
+    {
+        EngineMetadata meta {[] { }};
+        InitProtoTestMetadata(meta);
+
+        auto broken_blob = BakerTests::MakeSingleProtoResourceBlob<ProtoItem>(meta, meta.Hashes.ToHashedString("Item"), "BrokenKnife");
+        broken_blob.resize(broken_blob.size() - 1);
+
+        auto source = SafeAlloc::MakeUnique<BakerTests::MemoryDataSource>("ProtoTestPack");
+        source->AddFile("a.fopro-bin-server", BakerTests::MakeSingleProtoResourceBlob<ProtoItem>(meta, meta.Hashes.ToHashedString("Item"), "GoodKnife"));
+        source->AddFile("b.fopro-bin-server", broken_blob);
+
+        FileSystem resources;
+        resources.AddCustomSource(std::move(source));
+
+        ProtoManager serial {make_ptr(&meta)};
+        ProtoManager parallel {make_ptr(&meta)};
+        CHECK_THROWS(serial.LoadFromResources(resources, 1));
+        CHECK_THROWS(parallel.LoadFromResources(resources, 8));
+        CHECK(serial.GetProtoItems().empty());
+        CHECK(parallel.GetProtoItems().empty());
+    }
 }
 
 FO_END_NAMESPACE
@@ -42,6 +42,7 @@
 #include "ImGuiStuff.h"
 #include "Logging.h"
 #include "Movement.h"
+#include "PropertiesSerializer.h"
 #include "Server.h"
 #include "Test_BakerHelpers.h"
 
@@ -2477,6 +2478,8 @@ TEST_CASE("ServerEngineConcurrentItemTransferConservesTotal")
     }
 }
 
+// MapManager::TracePath over a real map instance must give the same results with the sight cache on and off, also
+// after manual blocks flip dynamic blockers through RecacheHexFlags between repeated traces of the same lines
 // The deterministic counterpart of the stress above: a handler mutates the source stack between SplitItem's
 // count read and its write, pinning both the fresh-read invariant and the post-yield cleanup branch
 
@@ -2571,6 +2574,419 @@ TEST_CASE("ServerEngineSplitItemUsesFreshCountAfterInitYield")
     h2->SetParent(nullptr);
 }
 
+TEST_CASE("ServerEngineTracePathMatchesWithAndWithoutSightCache")
+{
+    struct TraceRecord
+    {
+        bool FullyTraced {};
+        bool HasLastMovable {};
+        mpos PreBlock {};
+        mpos Block {};
+        mpos LastMovable {};
+
+        auto operator==(const TraceRecord& other) const -> bool = default;
+    };
+
+    const auto run_traces = [](bool sight_cache) -> vector<TraceRecord> {
+        auto settings = MakeServerTestSettings();
+        BakerTests::OverrideSetting(settings.MapSightCache, sight_cache);
+        auto server = SafeAlloc::MakeRefCounted<ServerEngine>(ptr<GlobalSettings> {&settings}, MakeServerTestResources());
+
+        auto shutdown = scope_exit([&server]() noexcept {
+            safe_call([&server] {
+                if (server->IsStarted()) {
+                    server->Shutdown();
+                }
+            });
+        });
+
+        string startup_error = WaitForServerStart(server.get());
+        INFO(startup_error);
+        REQUIRE(startup_error.empty());
+        REQUIRE(server->Lock(timespan {std::chrono::seconds {10}}));
+        auto unlock = scope_exit([&server]() noexcept { safe_call([&server] { server->Unlock(); }); });
+
+        auto loc = server->MapMngr.CreateLocation(server->Hashes.ToHashedString("UnitTestLocation"), vector<hstring> {server->Hashes.ToHashedString("UnitTestMap")});
+        auto map = loc->GetMapByIndex(0);
+
+        // Same seed for both runs, so both walk the same script of traces and blocker flips
+        std::mt19937 rnd {1717}; // NOLINT(cert-msc51-cpp)
+        auto random_hex = [&rnd]() -> mpos { return mpos {numeric_cast<int16_t>(40 + rnd() % 40), numeric_cast<int16_t>(40 + rnd() % 40)}; };
+
+        // A small pool of endpoints makes most traces repeat, so the cached run answers them from stored segments
+        vector<mpos> endpoints;
+
+        for (int32_t i = 0; i < 10; i++) {
+            endpoints.emplace_back(random_hex());
+        }
+
+        constexpr array<float32_t, 3> angles {0.0f, 7.5f, -20.0f};
+        constexpr array<int32_t, 3> max_dists {0, 6, 200};
+
+        vector<TraceRecord> records;
+        TraceRecord last {};
+
+        for (int32_t op = 0; op < 3000; op++) {
+            if (rnd() % 5 == 0) {
+                // Flip a hex on the last traced line or anywhere in the area, full blocks stop shooting
+                const auto pick = rnd() % 3;
+                const auto hex = pick == 0 ? last.Block : pick == 1 ? last.PreBlock : random_hex();
+                map->SetHexManualBlock(hex, rnd() % 2 == 0, true);
+                continue;
+            }
+
+            const auto start_hex = endpoints[rnd() % endpoints.size()];
+            const auto target_hex = rnd() % 4 == 0 ? random_hex() : endpoints[rnd() % endpoints.size()];
+            const auto angle = angles[rnd() % angles.size()];
+            const auto max_dist = max_dists[rnd() % max_dists.size()];
+
+            const auto result = server->MapMngr.TracePath(map, start_hex, target_hex, max_dist, angle, nullptr, CritterFindType::Any, true);
+
+            last = TraceRecord {
+                .FullyTraced = result.FullyTraced,
+                .HasLastMovable = result.HasLastMovable,
+                .PreBlock = result.PreBlock,
+                .Block = result.Block,
+                .LastMovable = result.LastMovable,
+            };
+            records.emplace_back(last);
+        }
+
+        server->MapMngr.DestroyLocation(loc);
+        return records;
+    };
+
+    const auto cached = run_traces(true);
+    const auto uncached = run_traces(false);
+
+    REQUIRE(cached.size() == uncached.size());
+    REQUIRE_FALSE(cached.empty());
+
+    size_t mismatches = 0;
+    size_t blocked = 0;
+
+    for (size_t i = 0; i < cached.size(); i++) {
+        if (!(cached[i] == uncached[i])) {
+            mismatches++;
+        }
+        if (!uncached[i].FullyTraced) {
+            blocked++;
+        }
+    }
+
+    CHECK(mismatches == 0);
+    // The flips must actually cut lines, or the comparison would only cover open ground
+    CHECK(blocked != 0);
+    CHECK(blocked != uncached.size());
+}
+
+// The engine's slot bookkeeping is a leading post-setter, so a post-setter added after startup, as scripts add theirs,
+// already reads the item from its new slot
+
+TEST_CASE("ServerEngineCritterSlotPostSettersSeeUpdatedSlotLookups")
+{
+    // Outlive the server, the post-setter stays on the property until shutdown
+    int32_t post_setter_calls = 0;
+    int32_t stale_lookups = 0;
+
+    auto settings = MakeServerTestSettings();
+    auto server = MakeServerEngine(settings);
+
+    auto shutdown = scope_exit([&server]() noexcept {
+        safe_call([&server] {
+            if (server->IsStarted()) {
+                server->Shutdown();
+            }
+        });
+    });
+
+    string startup_error = WaitForServerStart(server);
+    INFO(startup_error);
+    REQUIRE(startup_error.empty());
+    REQUIRE(server->Lock(timespan {std::chrono::seconds {10}}));
+    auto unlock = scope_exit([&server]() noexcept { safe_call([&server] { server->Unlock(); }); });
+
+    auto registrar = server->GetPropertyRegistrar(ItemProperties::ENTITY_TYPE_NAME);
+    REQUIRE(registrar);
+    auto slot_prop = registrar->GetPropertyByIndex(Item::CritterSlot_RegIndex);
+    REQUIRE(slot_prop);
+
+    slot_prop->AddPostSetter([&post_setter_calls, &stale_lookups](nptr<Entity> entity, ptr<const Property>) {
+        auto item = entity.dyn_cast<Item>();
+
+        if (!item || item->GetOwnership() != ItemOwnership::CritterInventory) {
+            return;
+        }
+
+        auto holder = item->GetParent<Critter>();
+
+        if (!holder) {
+            return;
+        }
+
+        post_setter_calls++;
+
+        for (const auto slot : {CritterItemSlot::Inventory, CritterItemSlot::Main}) {
+            nptr<Item> first_in_slot;
+
+            for (ptr<Item> inv_item : holder->GetInvItems()) {
+                if (inv_item->GetCritterSlot() == slot) {
+                    first_in_slot = inv_item;
+                    break;
+                }
+            }
+
+            if (holder->GetInvItemBySlot(slot) != first_in_slot) {
+                stale_lookups++;
+            }
+        }
+    });
+
+    auto loc = server->MapMngr.CreateLocation(server->Hashes.ToHashedString("UnitTestLocation"), vector<hstring> {server->Hashes.ToHashedString("UnitTestMap")});
+    auto map = loc->GetMapByIndex(0);
+    REQUIRE(map);
+
+    auto cr = server->CreateCritter(server->Hashes.ToHashedString("UnitTestRat"), false);
+    server->MapMngr.TransferToMap(cr, map, mpos {10, 10}, mdir {}, std::nullopt);
+
+    const hstring item_pid = server->Hashes.ToHashedString("TestItem");
+    auto armor = server->CrMngr.AddItemToCritter(cr, server->ItemMngr.CreateItem(item_pid, 1, nullptr), false);
+    auto weapon = server->CrMngr.AddItemToCritter(cr, server->ItemMngr.CreateItem(item_pid, 1, nullptr), false);
+
+    weapon->SetCritterSlot(CritterItemSlot::Main);
+    CHECK(cr->GetInvItemBySlot(CritterItemSlot::Main) == weapon);
+    CHECK(cr->GetInvItemBySlot(CritterItemSlot::Inventory) == armor);
+
+    // The earlier added item takes the slot over
+    weapon->SetCritterSlot(CritterItemSlot::Inventory);
+    armor->SetCritterSlot(CritterItemSlot::Main);
+    CHECK(cr->GetInvItemBySlot(CritterItemSlot::Inventory) == weapon);
+    CHECK(cr->GetInvItemBySlot(CritterItemSlot::Main) == armor);
+
+    weapon->SetCritterSlot(CritterItemSlot::Main);
+    CHECK(cr->GetInvItemBySlot(CritterItemSlot::Main) == armor);
+    CHECK(!cr->GetInvItemBySlot(CritterItemSlot::Inventory));
+
+    // Removal resets the slot after the item left the index, which the post-setter must skip
+    server->CrMngr.RemoveItemFromCritter(cr, armor, false);
+    CHECK(armor->GetCritterSlot() == CritterItemSlot::Inventory);
+    CHECK(cr->GetInvItemBySlot(CritterItemSlot::Main) == weapon);
+    server->ItemMngr.DestroyItem(armor);
+
+    CHECK(post_setter_calls == 4);
+    CHECK(stale_lookups == 0);
+
+    server->UnloadCritter(cr);
+    server->MapMngr.DestroyLocation(loc);
+}
+
+// Drives the inventory and container indexes only through the engine paths that change them, and checks every
+// lookup against a scan of the item lists they replaced
+
+TEST_CASE("ServerEngineInventoryLookupsMatchItemListScans")
+{
+    auto settings = MakeServerTestSettings();
+    auto server = MakeServerEngine(settings);
+
+    auto shutdown = scope_exit([&server]() noexcept {
+        safe_call([&server] {
+            if (server->IsStarted()) {
+                server->Shutdown();
+            }
+        });
+    });
+
+    string startup_error = WaitForServerStart(server);
+    INFO(startup_error);
+    REQUIRE(startup_error.empty());
+    REQUIRE(server->Lock(timespan {std::chrono::seconds {10}}));
+    auto unlock = scope_exit([&server]() noexcept { safe_call([&server] { server->Unlock(); }); });
+
+    const hstring plain_pid = server->Hashes.ToHashedString("TestItem");
+    const hstring stackable_pid = server->Hashes.ToHashedString("UnitTestStackable");
+    const array<hstring, 2> pids {plain_pid, stackable_pid};
+    const array<CritterItemSlot, 3> slots {CritterItemSlot::Inventory, CritterItemSlot::Main, static_cast<CritterItemSlot>(2)};
+    const array<any_t, 2> stacks {any_t {}, any_t {"stack"}};
+
+    auto loc = server->MapMngr.CreateLocation(server->Hashes.ToHashedString("UnitTestLocation"), vector<hstring> {server->Hashes.ToHashedString("UnitTestMap")});
+    auto map = loc->GetMapByIndex(0);
+    REQUIRE(map);
+
+    auto cr = server->CreateCritter(server->Hashes.ToHashedString("UnitTestRat"), false);
+    auto other_cr = server->CreateCritter(server->Hashes.ToHashedString("UnitTestRat"), false);
+    server->MapMngr.TransferToMap(cr, map, mpos {10, 10}, mdir {}, std::nullopt);
+    server->MapMngr.TransferToMap(other_cr, map, mpos {12, 12}, mdir {}, std::nullopt);
+
+    // Containers stay in the first critter's inventory for the whole run, only their contents move
+    array<ptr<Item>, 2> containers {
+        server->CrMngr.AddItemToCritter(cr, server->ItemMngr.CreateItem(plain_pid, 1, nullptr), false),
+        server->CrMngr.AddItemToCritter(cr, server->ItemMngr.CreateItem(plain_pid, 1, nullptr), false),
+    };
+    const auto is_container = [&containers](ptr<const Item> item) { return item == containers[0] || item == containers[1]; };
+
+    vector<ident_t> seen_ids;
+    size_t mismatches = 0;
+
+    const auto check_critter = [&](ptr<Critter> holder) {
+        const auto inv_items = holder->GetInvItems();
+
+        for (const auto pid : pids) {
+            nptr<Item> first;
+            nptr<Item> first_in_inventory;
+            nptr<Item> last;
+            int32_t count = 0;
+
+            for (ptr<Item> item : inv_items) {
+                if (item->GetProtoId() != pid) {
+                    continue;
+                }
+
+                first = first ? first : item.as_nptr();
+                first_in_inventory = first_in_inventory || item->GetCritterSlot() != CritterItemSlot::Inventory ? first_in_inventory : item.as_nptr();
+                last = item;
+                count += item->GetCount();
+            }
+
+            const auto priority = pid == stackable_pid ? first : first_in_inventory ? first_in_inventory : last;
+            mismatches += holder->GetInvItemByPid(pid) != first ? 1 : 0;
+            mismatches += holder->GetItemByPidInvPriority(pid) != priority ? 1 : 0;
+            mismatches += holder->CountInvItemByPid(pid) != count ? 1 : 0;
+        }
+
+        for (const auto slot : slots) {
+            const auto it = std::ranges::find_if(inv_items, [slot](ptr<Item> item) { return item->GetCritterSlot() == slot; });
+            mismatches += holder->GetInvItemBySlot(slot) != (it != inv_items.end() ? it->as_nptr() : nullptr) ? 1 : 0;
+        }
+
+        for (const auto id : seen_ids) {
+            const auto it = std::ranges::find_if(inv_items, [id](ptr<Item> item) { return item->GetId() == id; });
+            mismatches += holder->GetInvItem(id) != (it != inv_items.end() ? it->as_nptr() : nullptr) ? 1 : 0;
+        }
+    };
+
+    const auto check_container = [&](ptr<Item> cont) {
+        const auto inner_items = cont->HasInnerItems() ? cont->GetAllInnerItems() : vector<ptr<Item>> {};
+
+        for (const auto pid : pids) {
+            for (const auto& stack : stacks) {
+                const auto it = std::ranges::find_if(inner_items, [&](ptr<Item> item) { return item->GetProtoId() == pid && (stack.empty() || item->GetContainerStack() == stack); });
+                mismatches += cont->GetInnerItemByPid(pid, stack) != (it != inner_items.end() ? it->as_nptr() : nullptr) ? 1 : 0;
+            }
+        }
+
+        for (const auto id : seen_ids) {
+            const auto it = std::ranges::find_if(inner_items, [id](ptr<Item> item) { return item->GetId() == id; });
+            mismatches += cont->GetInnerItem(id) != (it != inner_items.end() ? it->as_nptr() : nullptr) ? 1 : 0;
+        }
+    };
+
+    const auto pick = [](auto& rnd, const vector<ptr<Item>>& items) -> nptr<Item> { return items.empty() ? nullptr : items[rnd() % items.size()].as_nptr(); };
+
+    std::mt19937 rnd {5050}; // NOLINT(cert-msc51-cpp)
+
+    for (int32_t step = 0; step < 1500; step++) {
+        vector<ptr<Item>> movable;
+
+        for (ptr<Item> item : cr->GetInvItems()) {
+            if (!is_container(item)) {
+                movable.emplace_back(item);
+            }
+        }
+
+        auto& cont = containers[rnd() % containers.size()];
+        const auto inner_items = cont->HasInnerItems() ? cont->GetAllInnerItems() : vector<ptr<Item>> {};
+        const auto op = rnd() % 8;
+
+        if (op == 0 || movable.empty()) {
+            // A free item with a stale slot, which AddItemToCritter resets to the inventory slot
+            const auto pid = pids[rnd() % pids.size()];
+            auto item = server->ItemMngr.CreateItem(pid, numeric_cast<int32_t>(1 + rnd() % 3), nullptr);
+            item->SetCritterSlot(slots[rnd() % slots.size()]);
+            seen_ids.emplace_back(item->GetId());
+            server->CrMngr.AddItemToCritter(rnd() % 4 == 0 ? other_cr : cr, item, false);
+        }
+        else if (op == 1) {
+            auto item = pick(rnd, movable);
+            item->SetCritterSlot(slots[rnd() % slots.size()]);
+        }
+        else if (op == 2) {
+            auto item = pick(rnd, movable);
+            server->ItemMngr.MoveItem(item, numeric_cast<int32_t>(1 + rnd() % numeric_cast<uint32_t>(item->GetCount())), cont, stacks[rnd() % stacks.size()]);
+        }
+        else if (op == 3 && !inner_items.empty()) {
+            // Slot changes inside a container are not tracked, the item takes the inventory slot once it's back
+            auto item = pick(rnd, inner_items);
+            item->SetCritterSlot(slots[rnd() % slots.size()]);
+            server->ItemMngr.MoveItem(item, item->GetCount(), cr);
+        }
+        else if (op == 4 && !inner_items.empty()) {
+            // Emptying a container drops its index, refilling builds a new one
+            for (ptr<Item> item : inner_items) {
+                server->ItemMngr.DestroyItem(item);
+            }
+        }
+        else if (op == 5) {
+            auto item = pick(rnd, movable);
+            server->ItemMngr.MoveItem(item, numeric_cast<int32_t>(1 + rnd() % numeric_cast<uint32_t>(item->GetCount())), other_cr);
+        }
+        else if (op == 6) {
+            auto item = pick(rnd, other_cr->GetInvItems());
+
+            if (item) {
+                server->ItemMngr.MoveItem(item, item->GetCount(), cr);
+            }
+        }
+        else {
+            auto item = pick(rnd, movable);
+            server->CrMngr.RemoveItemFromCritter(cr, item, false);
+            server->ItemMngr.DestroyItem(item);
+        }
+
+        for (ptr<Item> item : cr->GetInvItems()) {
+            if (!vec_exists(seen_ids, item->GetId())) {
+                seen_ids.emplace_back(item->GetId());
+            }
+        }
+
+        check_critter(cr);
+        check_critter(other_cr);
+        check_container(containers[0]);
+        check_container(containers[1]);
+    }
+
+    CHECK(mismatches == 0);
+
+    // Unloading takes every container's contents and removes each item from the inventory index
+    for (ptr<Item> item : cr->GetInvItems()) {
+        if (!is_container(item) && rnd() % 2 == 0) {
+            server->ItemMngr.MoveItem(item, item->GetCount(), containers[0], {});
+        }
+    }
+
+    REQUIRE(containers[0]->HasInnerItems());
+
+    vector<ident_t> unloaded_ids;
+
+    for (ptr<Item> item : cr->GetInvItems()) {
+        unloaded_ids.emplace_back(item->GetId());
+
+        if (item->HasInnerItems()) {
+            for (ptr<Item> inner_item : item->GetAllInnerItems()) {
+                unloaded_ids.emplace_back(inner_item->GetId());
+            }
+        }
+    }
+
+    REQUIRE_NOTHROW(server->UnloadCritter(cr));
+
+    for (const auto id : unloaded_ids) {
+        CHECK_FALSE(server->EntityMngr.GetItem(id));
+    }
+
+    server->UnloadCritter(other_cr);
+    server->MapMngr.DestroyLocation(loc);
+}
+
 // An ancestor cover grants access to a descendant but must not exclude another thread's own lock on it —
 // isolated here, where ReparentStress only exercises it under noise
 
@@ -3118,4 +3534,254 @@ TEST_CASE("ServerEngineDrawsDiagnosticGuiHeadlessly")
     CHECK(drawn_text.find("NotLoggedIn players (1)") != string::npos);
 }
 
+TEST_CASE("ServerEngineWorldSnapshotIsDetachedFromLiveWorld")
+{
+    auto settings = MakeServerTestSettings();
+    auto server = MakeServerEngine(settings);
+
+    auto shutdown = scope_exit([&server]() noexcept {
+        safe_call([&server] {
+            if (server->IsStarted()) {
+                server->Shutdown();
+            }
+        });
+    });
+
+    string startup_error = WaitForServerStart(server);
+    INFO(startup_error);
+    REQUIRE(startup_error.empty());
+
+    hstring critter_pid = server->Hashes.ToHashedString("UnitTestRat");
+    nptr<Critter> cr;
+    nptr<Critter> untouched_cr;
+    nptr<Critter> transient_cr;
+
+    {
+        REQUIRE(server->Lock(timespan {std::chrono::seconds {10}}));
+
+        auto unlock = scope_exit([&server]() noexcept { safe_call([&server] { server->Unlock(); }); });
+
+        cr = server->CreateCritter(critter_pid, false);
+        untouched_cr = server->CreateCritter(critter_pid, false);
+        transient_cr = server->CreateCritter(critter_pid, false);
+        server->EntityMngr.MakePersistent(cr.as_ptr(), true, true);
+        server->EntityMngr.MakePersistent(untouched_cr.as_ptr(), true, true);
+        server->EntityMngr.MakePersistent(transient_cr.as_ptr(), false, true);
+    }
+
+    REQUIRE(cr);
+    REQUIRE(untouched_cr);
+    REQUIRE(transient_cr);
+
+    auto snapshot = server->TakeWorldSnapshot(timespan {std::chrono::seconds {10}});
+    REQUIRE(snapshot.has_value());
+    CHECK(snapshot->PauseTime >= snapshot->LockWaitTime);
+
+    const auto has_entry = [&snapshot](ident_t id) { return std::ranges::any_of(snapshot->Entries, [id](const ServerWorldSnapshot::Entry& entry) { return entry.Id == id; }); };
+    CHECK(has_entry(cr->GetId()));
+    CHECK(has_entry(untouched_cr->GetId()));
+    CHECK_FALSE(has_entry(transient_cr->GetId()));
+
+    // Gameplay keeps mutating the world after the snapshot was taken
+    {
+        REQUIRE(server->Lock(timespan {std::chrono::seconds {10}}));
+
+        auto unlock = scope_exit([&server]() noexcept { safe_call([&server] { server->Unlock(); }); });
+
+        server->RequireCurrentSyncContext()->SyncEntity(cr.as_ptr());
+        cr->SetCondition(CritterCondition::Dead);
+    }
+
+    const auto find_doc = [](const vector<ServerWorldSnapshot::Record>& records, hstring collection_name, ident_t id) -> nptr<const AnyData::PackedDocument> {
+        for (const auto& record : records) {
+            if (record.CollectionName == collection_name && record.Id == id) {
+                return &record.Doc;
+            }
+        }
+
+        return nullptr;
+    };
+
+    // Serialization runs on its own thread without locking the engine
+    vector<ServerWorldSnapshot::Record> snapshot_records;
+    std::thread serializer {[&] { snapshot_records = server->SerializeWorldSnapshot(std::move(snapshot.value())); }};
+    serializer.join();
+    snapshot.reset();
+
+    auto live_snapshot = server->TakeWorldSnapshot(timespan {std::chrono::seconds {10}});
+    REQUIRE(live_snapshot.has_value());
+    auto live_records = server->SerializeWorldSnapshot(std::move(live_snapshot.value()));
+
+    const hstring critters_collection = cr->GetTypeNamePlural();
+    auto snapshot_doc = find_doc(snapshot_records, critters_collection, cr->GetId());
+    auto live_doc = find_doc(live_records, critters_collection, cr->GetId());
+    REQUIRE(snapshot_doc);
+    REQUIRE(live_doc);
+
+    const auto snapshot_proto = snapshot_doc->GetView().Find("_Proto");
+    REQUIRE(snapshot_proto.has_value());
+    CHECK(snapshot_proto->AsString() == "UnitTestRat");
+    const auto live_condition = live_doc->GetView().Find("Condition");
+    const auto snapshot_condition = snapshot_doc->GetView().Find("Condition");
+    REQUIRE(live_condition.has_value());
+    CHECK((!snapshot_condition.has_value() || !(snapshot_condition->ToValue() == live_condition->ToValue())));
+
+    // An entity nobody touched is read in place and matches the persistence document of the live entity
+    auto untouched_doc = find_doc(snapshot_records, critters_collection, untouched_cr->GetId());
+    REQUIRE(untouched_doc);
+    CHECK(PackedDocumentToJsonStorage(untouched_doc->GetView(), 0) == PackedDocumentToJsonStorage(server->EntityMngr.StoreEntityDoc(untouched_cr.as_ptr()).GetView(), 0));
+
+    auto globals_doc = find_doc(snapshot_records, server->GameCollectionName, ident_t {1});
+    REQUIRE(globals_doc);
+    const auto globals_name = globals_doc->GetView().Find("_Name");
+    REQUIRE(globals_name.has_value());
+    CHECK(globals_name->AsString() == "Globals");
+}
+
+TEST_CASE("ServerEngineBackupWorldWritesSnapshotInJsonStorageLayout")
+{
+    auto settings = MakeServerTestSettings();
+    auto server = MakeServerEngine(settings);
+
+    auto shutdown = scope_exit([&server]() noexcept {
+        safe_call([&server] {
+            if (server->IsStarted()) {
+                server->Shutdown();
+            }
+        });
+    });
+
+    string startup_error = WaitForServerStart(server);
+    INFO(startup_error);
+    REQUIRE(startup_error.empty());
+
+    auto backup_root = std::filesystem::temp_directory_path() / std::format("lf_world_backup_{}", std::chrono::steady_clock::now().time_since_epoch().count());
+    auto remove_backup_root = scope_exit([&backup_root]() noexcept {
+        std::error_code ec;
+        std::filesystem::remove_all(backup_root, ec);
+    });
+
+    const string backup_dir = fs_path_to_string(backup_root / "World");
+
+    hstring critter_pid = server->Hashes.ToHashedString("UnitTestRat");
+    nptr<Critter> cr;
+
+    {
+        REQUIRE(server->Lock(timespan {std::chrono::seconds {10}}));
+
+        auto unlock = scope_exit([&server]() noexcept { safe_call([&server] { server->Unlock(); }); });
+
+        cr = server->CreateCritter(critter_pid, false);
+        server->EntityMngr.MakePersistent(cr.as_ptr(), true, true);
+    }
+
+    REQUIRE(cr);
+
+    const string record_path = strex("{}/{}/{}.json", backup_dir, cr->GetTypeNamePlural(), cr->GetId()).str();
+
+    const auto read_record = [&record_path]() {
+        auto json = fs_read_file(record_path);
+        REQUIRE(json.has_value());
+        AnyData::Document doc;
+        JsonStorageToDocument(json.value(), doc);
+        return doc;
+    };
+
+    REQUIRE(server->BackupWorld(backup_dir, timespan {std::chrono::seconds {10}}));
+    CHECK(fs_exists(strex("{}/{}/1.json", backup_dir, server->GameCollectionName).str()));
+    CHECK_FALSE(read_record().Contains("Condition"));
+
+    {
+        REQUIRE(server->Lock(timespan {std::chrono::seconds {10}}));
+
+        auto unlock = scope_exit([&server]() noexcept { safe_call([&server] { server->Unlock(); }); });
+
+        server->RequireCurrentSyncContext()->SyncEntity(cr.as_ptr());
+        cr->SetCondition(CritterCondition::Dead);
+    }
+
+    // The second backup replaces the first one whole
+    REQUIRE(server->BackupWorld(backup_dir, timespan {std::chrono::seconds {10}}));
+    CHECK(read_record().Contains("Condition"));
+    CHECK_FALSE(fs_exists(strex("{}.tmp", backup_dir).str()));
+    CHECK_FALSE(fs_exists(strex("{}.old", backup_dir).str()));
+}
+
+TEST_CASE("ServerEngineWorldSavePausePerformance", "[!benchmark][server]")
+{
+    auto settings = MakeServerTestSettings();
+    auto server = MakeServerEngine(settings);
+
+    auto shutdown = scope_exit([&server]() noexcept {
+        safe_call([&server] {
+            if (server->IsStarted()) {
+                server->Shutdown();
+            }
+        });
+    });
+
+    string startup_error = WaitForServerStart(server);
+    INFO(startup_error);
+    REQUIRE(startup_error.empty());
+
+    {
+        REQUIRE(server->Lock(timespan {std::chrono::seconds {10}}));
+
+        auto unlock = scope_exit([&server]() noexcept { safe_call([&server] { server->Unlock(); }); });
+
+        hstring critter_pid = server->Hashes.ToHashedString("UnitTestRat");
+
+        for (int32_t i = 0; i < 2000; i++) {
+            auto cr = server->CreateCritter(critter_pid, false);
+            server->EntityMngr.MakePersistent(cr, true, true);
+        }
+    }
+
+    // Both sides build the same persistence documents (proto base included); the measured pause always starts
+    // before the lock request, so the wait for every job to park at the sync point counts too
+    timespan max_locked_pause_time {};
+
+    BENCHMARK("Locked world serialization pause")
+    {
+        const nanotime pause_start = nanotime::now();
+
+        REQUIRE(server->Lock(timespan {std::chrono::seconds {10}}));
+
+        size_t doc_count = 0;
+
+        {
+            auto unlock = scope_exit([&server]() noexcept { safe_call([&server] { server->Unlock(); }); });
+
+            for (auto& entity : server->EntityMngr.GetEntities()) {
+                if (entity->IsPersistent()) {
+                    auto doc = server->EntityMngr.StoreEntityDoc(entity.as_ptr());
+                    doc_count += doc.GetView().Size();
+                }
+            }
+        }
+
+        max_locked_pause_time = std::max(max_locked_pause_time, timespan {nanotime::now() - pause_start});
+        return doc_count;
+    };
+
+    timespan max_snapshot_pause_time {};
+
+    BENCHMARK("Snapshot capture pause")
+    {
+        auto snapshot = server->TakeWorldSnapshot(timespan {std::chrono::seconds {10}});
+        REQUIRE(snapshot.has_value());
+        max_snapshot_pause_time = std::max(max_snapshot_pause_time, snapshot->PauseTime);
+        return snapshot->Entries.size();
+    };
+
+    BENCHMARK("Snapshot background serialization")
+    {
+        auto snapshot = server->TakeWorldSnapshot(timespan {std::chrono::seconds {10}});
+        REQUIRE(snapshot.has_value());
+        return server->SerializeWorldSnapshot(std::move(snapshot.value())).size();
+    };
+
+    WARN(strex("Max locked save pause: {}, max snapshot pause: {}", max_locked_pause_time, max_snapshot_pause_time).str());
+}
+
 FO_END_NAMESPACE
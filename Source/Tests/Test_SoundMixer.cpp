@@ -0,0 +1,287 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "SoundMixer.h"
+
+FO_BEGIN_NAMESPACE
+
+namespace
+{
+    auto GetSilence(SoundSampleFormat format) -> uint8_t
+    {
+        return format == SoundSampleFormat::U8 ? uint8_t {0x80} : uint8_t {0};
+    }
+
+    // Quiet synthetic PCM, so even every voice at full gain stays clear of saturation
+    auto MakeVoice(SoundSampleFormat format, size_t samples, std::mt19937& rnd) -> vector<uint8_t>
+    {
+        vector<uint8_t> voice(samples * SoundMixer::GetSampleSize(format));
+
+        for (size_t i = 0; i < samples; i++) {
+            switch (format) {
+            case SoundSampleFormat::U8:
+                voice[i] = static_cast<uint8_t>(128 + std::uniform_int_distribution<int32_t> {-4, 4}(rnd));
+                break;
+            case SoundSampleFormat::S16: {
+                auto sample = static_cast<int16_t>(std::uniform_int_distribution<int32_t> {-1000, 1000}(rnd));
+                MemCopy(voice.data() + i * sizeof(int16_t), &sample, sizeof(int16_t));
+            } break;
+            case SoundSampleFormat::F32: {
+                float32_t sample = std::uniform_real_distribution<float32_t> {-0.03f, 0.03f}(rnd);
+                MemCopy(voice.data() + i * sizeof(float32_t), &sample, sizeof(float32_t));
+            } break;
+            }
+        }
+
+        return voice;
+    }
+
+    // Golden samples are integers; float samples are stored in 1/1024 steps and read back in 1/4096 steps,
+    // which keeps every scaled and summed value exact
+    auto EncodeSamples(SoundSampleFormat format, const vector<int32_t>& samples) -> vector<uint8_t>
+    {
+        vector<uint8_t> buf(samples.size() * SoundMixer::GetSampleSize(format));
+
+        for (size_t i = 0; i < samples.size(); i++) {
+            switch (format) {
+            case SoundSampleFormat::U8:
+                buf[i] = static_cast<uint8_t>(samples[i]);
+                break;
+            case SoundSampleFormat::S16: {
+                auto sample = static_cast<int16_t>(samples[i]);
+                MemCopy(buf.data() + i * sizeof(int16_t), &sample, sizeof(int16_t));
+            } break;
+            case SoundSampleFormat::F32: {
+                float32_t sample = static_cast<float32_t>(samples[i]) / 1024.0f;
+                MemCopy(buf.data() + i * sizeof(float32_t), &sample, sizeof(float32_t));
+            } break;
+            }
+        }
+
+        return buf;
+    }
+
+    auto DecodeSamples(SoundSampleFormat format, const_span<uint8_t> buf) -> vector<float32_t>
+    {
+        size_t sample_size = SoundMixer::GetSampleSize(format);
+        vector<float32_t> samples(buf.size() / sample_size);
+
+        for (size_t i = 0; i < samples.size(); i++) {
+            switch (format) {
+            case SoundSampleFormat::U8:
+                samples[i] = static_cast<float32_t>(buf[i]);
+                break;
+            case SoundSampleFormat::S16: {
+                int16_t sample;
+                MemCopy(&sample, buf.data() + i * sizeof(int16_t), sizeof(int16_t));
+                samples[i] = static_cast<float32_t>(sample);
+            } break;
+            case SoundSampleFormat::F32: {
+                float32_t sample;
+                MemCopy(&sample, buf.data() + i * sizeof(float32_t), sizeof(float32_t));
+                samples[i] = sample * 4096.0f;
+            } break;
+            }
+        }
+
+        return samples;
+    }
+}
+
+TEST_CASE("SoundMixerMatchesPerVoiceDeviceMixing")
+{
+    // Expected buffers were produced by SDL_MixAudio, which the former path called once per voice after padding short
+    // voices with silence to the whole buffer (device volumes 100, 50, 25 and 50). Nineteen samples run every wide
+    // loop at least once next to a scalar tail, and negative centered samples at gains below one pin the rounding
+    constexpr size_t buffer_samples = 19;
+    const array<float32_t, 4> gains = {1.0f, 0.5f, 0.25f, 0.5f};
+
+    struct GoldenMix
+    {
+        SoundSampleFormat Format;
+        array<vector<int32_t>, 4> Voices;
+        vector<int32_t> Expected;
+    };
+
+    const array<GoldenMix, 3> goldens = {{
+        {.Format = SoundSampleFormat::U8,
+            .Voices = {{
+                {116, 102, 119, 120, 90, 123, 131, 148, 165, 123, 145, 110, 140, 122, 133, 159, 165, 165, 139},
+                {150, 149, 102, 139, 131, 128, 141, 161, 100, 122, 140, 126},
+                {95, 164, 111, 140, 112, 99, 159, 115, 135, 159, 97, 162, 103, 147, 164, 164, 144, 146, 142},
+                {135, 121, 168, 93, 160},
+            }},
+            .Expected = {122, 118, 122, 111, 103, 116, 144, 161, 152, 127, 144, 117, 134, 126, 142, 168, 169, 169, 142}},
+        {.Format = SoundSampleFormat::S16,
+            .Voices = {{
+                {-104, -1422, -1068, 588, 1982, 1556, -1737, 322, -1082, 547, 1669, -1629, -1443, 408, -981, -115, -785, -57, 132},
+                {841, 842, 571, -2000, -1247, -873, -212, -347, -799, 1355, 1632, -1664},
+                {607, -1559, 1586, -1414, 1939, 1823, 1779, -113, 122, 1442, 401, 1793, -1459, -1433, -1828, 1254, -382, -74, 1387},
+                {314, 1759, -1913, -1083, 1474},
+            }},
+            .Expected = {624, -511, -1343, -1306, 2580, 1575, -1399, 121, -1451, 1584, 2585, -2013, -1807, 50, -1438, 198, -880, -75, 478}},
+        {.Format = SoundSampleFormat::F32,
+            .Voices = {{
+                {-19, -30, 7, -2, 42, 70, -15, 17, 25, 29, 73, -29, 30, 60, 29, -31, -43, -19, -42},
+                {59, -23, 7, 54, 41, -1, 54, -57, 76, 8, 74, 74},
+                {68, 75, 54, -15, -34, -59, 59, 40, 49, -2, 44, 13, 42, -14, 15, 69, -53, -38, -20},
+                {-29, 28, -15, 31, 15},
+            }},
+            .Expected = {52, -35, 66, 147, 246, 219, 107, -6, 301, 130, 484, 45, 162, 226, 131, -55, -225, -114, -188}},
+    }};
+
+    for (const auto& golden : goldens) {
+        CAPTURE(static_cast<int32_t>(golden.Format));
+
+        vector<uint8_t> output(buffer_samples * SoundMixer::GetSampleSize(golden.Format), GetSilence(golden.Format));
+        SoundMixer mixer {golden.Format};
+        mixer.Begin(output);
+
+        for (size_t v = 0; v < golden.Voices.size(); v++) {
+            mixer.AddVoice(0, EncodeSamples(golden.Format, golden.Voices[v]), gains[v]);
+        }
+
+        mixer.Resolve(output);
+
+        vector<float32_t> expected;
+
+        for (int32_t sample : golden.Expected) {
+            expected.emplace_back(static_cast<float32_t>(sample));
+        }
+
+        CHECK(DecodeSamples(golden.Format, output) == expected);
+    }
+}
+
+TEST_CASE("SoundMixerAddsVoicesAtAnOffset")
+{
+    SoundMixer mixer {SoundSampleFormat::S16};
+    vector<uint8_t> output(8 * sizeof(int16_t), 0);
+    mixer.Begin(output);
+
+    vector<int16_t> voice_samples = {100, -200, 300};
+    vector<uint8_t> voice(voice_samples.size() * sizeof(int16_t));
+    MemCopy(voice.data(), voice_samples.data(), voice.size());
+
+    mixer.AddVoice(4 * sizeof(int16_t), voice, 1.0f);
+    mixer.Resolve(output);
+
+    vector<int16_t> mixed(8);
+    MemCopy(mixed.data(), output.data(), output.size());
+    CHECK(mixed == vector<int16_t> {0, 0, 0, 0, 100, -200, 300, 0});
+
+    CHECK_THROWS(mixer.AddVoice(6 * sizeof(int16_t), voice, 1.0f));
+    CHECK_THROWS(mixer.AddVoice(1, voice, 1.0f));
+}
+
+TEST_CASE("SoundMixerSaturatesOnceAfterSummingAllVoices")
+{
+    // Per-voice saturation lost the headroom a later negative voice would have restored
+    for (SoundSampleFormat format : {SoundSampleFormat::U8, SoundSampleFormat::S16, SoundSampleFormat::F32}) {
+        CAPTURE(static_cast<int32_t>(format));
+
+        size_t sample_size = SoundMixer::GetSampleSize(format);
+        vector<uint8_t> output(16 * sample_size, format == SoundSampleFormat::F32 ? uint8_t {} : GetSilence(format));
+        SoundMixer mixer {format};
+        mixer.Begin(output);
+
+        auto make_constant_voice = [&](int32_t sign) {
+            vector<uint8_t> voice(output.size());
+
+            for (size_t i = 0; i < 16; i++) {
+                if (format == SoundSampleFormat::U8) {
+                    voice[i] = static_cast<uint8_t>(128 + sign * 114);
+                }
+                else if (format == SoundSampleFormat::S16) {
+                    auto sample = static_cast<int16_t>(sign * 29490);
+                    MemCopy(voice.data() + i * sizeof(int16_t), &sample, sizeof(int16_t));
+                }
+                else {
+                    float32_t sample = static_cast<float32_t>(sign) * 0.9f;
+                    MemCopy(voice.data() + i * sizeof(float32_t), &sample, sizeof(float32_t));
+                }
+            }
+
+            return voice;
+        };
+
+        mixer.AddVoice(0, make_constant_voice(1), 1.0f);
+        mixer.AddVoice(0, make_constant_voice(1), 1.0f);
+        mixer.AddVoice(0, make_constant_voice(-1), 1.0f);
+        mixer.Resolve(output);
+
+        vector<uint8_t> single = make_constant_voice(1);
+
+        if (format == SoundSampleFormat::F32) {
+            float32_t sample;
+            MemCopy(&sample, output.data(), sizeof(float32_t));
+            CHECK(sample == Catch::Approx(0.9f).margin(1.0e-6));
+        }
+        else {
+            CHECK(output == single);
+        }
+    }
+}
+
+TEST_CASE("SoundMixerPerformance", "[!benchmark][client]")
+{
+    constexpr size_t buffer_samples = 4096;
+    constexpr size_t voice_count = 48;
+
+    std::mt19937 rnd; // NOLINT(cert-msc51-cpp)
+    vector<vector<uint8_t>> voices;
+
+    for (size_t v = 0; v < voice_count; v++) {
+        voices.emplace_back(MakeVoice(SoundSampleFormat::S16, buffer_samples, rnd));
+    }
+
+    vector<uint8_t> output(buffer_samples * sizeof(int16_t));
+    SoundMixer mixer {SoundSampleFormat::S16};
+
+    BENCHMARK("One-pass mixer, 48 voices")
+    {
+        std::ranges::fill(output, uint8_t {});
+        mixer.Begin(output);
+
+        for (const auto& voice : voices) {
+            mixer.AddVoice(0, voice, 0.7f);
+        }
+
+        mixer.Resolve(output);
+        return output[0];
+    };
+}
+
+FO_END_NAMESPACE
@@ -0,0 +1,258 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "catch_amalgamated.hpp"
+
+#include "SoundStream.h"
+#include "WorkThread.h"
+
+FO_BEGIN_NAMESPACE
+
+namespace
+{
+    struct SlowSourceStats
+    {
+        std::atomic_size_t Decodes {};
+        std::atomic_size_t ConsumerDecodes {};
+        std::atomic_size_t Rewinds {};
+    };
+
+    // Stands in for a data source behind slow storage: every decoded portion costs a fixed delay
+    class SlowSoundStreamSource final : public SoundStreamSource
+    {
+    public:
+        SlowSoundStreamSource(size_t portion, size_t total, timespan delay, std::thread::id consumer, ptr<SlowSourceStats> stats) :
+            _portion {portion},
+            _total {total},
+            _delay {delay},
+            _consumer {consumer},
+            _stats {stats}
+        {
+        }
+
+        auto Decode(vector<uint8_t>& output) -> bool override
+        {
+            _stats->Decodes.fetch_add(1);
+
+            if (std::this_thread::get_id() == _consumer) {
+                _stats->ConsumerDecodes.fetch_add(1);
+            }
+
+            std::this_thread::sleep_for(_delay.value());
+
+            if (_pos == _total) {
+                return false;
+            }
+
+            output.resize(std::min(_portion, _total - _pos));
+
+            for (size_t i = 0; i < output.size(); i++) {
+                output[i] = static_cast<uint8_t>((_pos + i) % 251);
+            }
+
+            _pos += output.size();
+            return true;
+        }
+
+        auto Rewind() -> bool override
+        {
+            _stats->Rewinds.fetch_add(1);
+            _pos = 0;
+            return true;
+        }
+
+    private:
+        size_t _portion;
+        size_t _total;
+        timespan _delay;
+        std::thread::id _consumer;
+        ptr<SlowSourceStats> _stats;
+        size_t _pos {};
+    };
+
+    // Reads like the audio callback does and checks the bytes continue the source pattern
+    auto ReadPattern(SoundStream& stream, size_t size, size_t& pattern_pos) -> size_t
+    {
+        bool matches = true;
+
+        size_t count = stream.Read(size, [&](size_t offset, const_span<uint8_t> data) {
+            for (size_t i = 0; i < data.size(); i++) {
+                matches = matches && data[i] == static_cast<uint8_t>((pattern_pos + offset + i) % 251);
+            }
+        });
+
+        CHECK(matches);
+        pattern_pos += count;
+        return count;
+    }
+
+    auto WaitForBuffered(const SoundStream& stream, size_t size) -> bool
+    {
+        nanotime deadline = nanotime::now() + std::chrono::seconds {10};
+
+        while (stream.GetBufferedSize() < size) {
+            if (nanotime::now() > deadline) {
+                return false;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds {1});
+        }
+
+        return true;
+    }
+}
+
+TEST_CASE("SoundStreamKeepsSlowSourceAheadOfPlayback")
+{
+    constexpr size_t capacity = 32 * 1024;
+    constexpr size_t callback_size = 512;
+    constexpr size_t callbacks = 200;
+
+    // The source needs 2 ms for every 4 KB, and playback drains 512 bytes every millisecond
+    SlowSourceStats stats;
+    auto source = SafeAlloc::MakeUnique<SlowSoundStreamSource>(4 * 1024, 1024 * 1024, std::chrono::milliseconds {2}, std::this_thread::get_id(), &stats);
+    auto stream = SafeAlloc::MakeShared<SoundStream>(capacity, std::chrono::milliseconds {64}, false, std::move(source));
+    WorkThread decoder {"SoundDecoder"};
+
+    decoder.AddJob([stream]() { return stream->Fill(); });
+    REQUIRE(WaitForBuffered(*stream, capacity));
+
+    size_t pattern_pos = 0;
+
+    for (size_t i = 0; i < callbacks; i++) {
+        CHECK(ReadPattern(*stream, callback_size, pattern_pos) == callback_size);
+        std::this_thread::sleep_for(std::chrono::milliseconds {1});
+    }
+
+    stream->Cancel();
+    decoder.Wait();
+
+    CHECK(stream->GetUnderruns() == 0);
+    CHECK(stats.Decodes.load() != 0);
+    CHECK(stats.ConsumerDecodes.load() == 0);
+}
+
+TEST_CASE("SoundStreamBacksOffWhileRingIsFull")
+{
+    constexpr size_t capacity = 32 * 1024;
+
+    // The full ring plays for 400 ms, so the worker sleeps about 200 ms between checks instead of polling
+    SlowSourceStats stats;
+    auto source = SafeAlloc::MakeUnique<SlowSoundStreamSource>(4 * 1024, 1024 * 1024, timespan::zero, std::this_thread::get_id(), &stats);
+    auto stream = SafeAlloc::MakeShared<SoundStream>(capacity, std::chrono::milliseconds {400}, false, std::move(source));
+    WorkThread decoder {"SoundDecoder"};
+
+    decoder.AddJob([stream]() { return stream->Fill(); });
+    REQUIRE(WaitForBuffered(*stream, capacity));
+
+    uint64_t jobs_when_full = decoder.GetDiagnostics().CompletedJobs;
+    std::this_thread::sleep_for(std::chrono::milliseconds {300});
+    uint64_t jobs_while_full = decoder.GetDiagnostics().CompletedJobs - jobs_when_full;
+
+    stream->Cancel();
+    decoder.Wait();
+
+    CHECK(jobs_while_full <= 3);
+    CHECK(stream->GetBufferedSize() == capacity);
+}
+
+TEST_CASE("SoundStreamRewindsRepeatingSourceAheadOfLoopRestart")
+{
+    constexpr size_t pass_size = 10 * 1024;
+
+    SlowSourceStats stats;
+    auto source = SafeAlloc::MakeUnique<SlowSoundStreamSource>(4 * 1024, pass_size, timespan::zero, std::this_thread::get_id(), &stats);
+    auto stream = SafeAlloc::MakeShared<SoundStream>(64 * 1024, std::chrono::milliseconds {128}, true, std::move(source));
+    WorkThread decoder {"SoundDecoder"};
+
+    // The worker decodes the first pass, rewinds, decodes the second one and then waits for the consumer
+    decoder.AddJob([stream]() { return stream->Fill(); });
+    REQUIRE(WaitForBuffered(*stream, pass_size * 2));
+
+    size_t pattern_pos = 0;
+    CHECK(ReadPattern(*stream, 64 * 1024, pattern_pos) == pass_size);
+    CHECK(stream->IsPassFinished());
+    CHECK(stats.Rewinds.load() == 1);
+
+    // The restart is a memory copy of the already decoded next pass
+    REQUIRE(stream->StartNextPass());
+    CHECK_FALSE(stream->IsPassFinished());
+    pattern_pos = 0;
+    CHECK(ReadPattern(*stream, pass_size, pattern_pos) == pass_size);
+
+    stream->Cancel();
+    decoder.Wait();
+
+    CHECK(stream->GetUnderruns() == 0);
+    CHECK(stats.ConsumerDecodes.load() == 0);
+}
+
+TEST_CASE("SoundStreamEndsNonRepeatingSource")
+{
+    constexpr size_t pass_size = 10 * 1024;
+
+    SlowSourceStats stats;
+    auto source = SafeAlloc::MakeUnique<SlowSoundStreamSource>(4 * 1024, pass_size, timespan::zero, std::this_thread::get_id(), &stats);
+    auto stream = SafeAlloc::MakeShared<SoundStream>(64 * 1024, std::chrono::milliseconds {128}, false, std::move(source));
+    WorkThread decoder {"SoundDecoder"};
+
+    decoder.AddJob([stream]() { return stream->Fill(); });
+    decoder.Wait();
+
+    size_t pattern_pos = 0;
+    CHECK(ReadPattern(*stream, 64 * 1024, pattern_pos) == pass_size);
+    CHECK(stream->IsPassFinished());
+    CHECK_FALSE(stream->StartNextPass());
+    CHECK(stream->GetUnderruns() == 0);
+    CHECK(stats.Rewinds.load() == 0);
+}
+
+TEST_CASE("SoundStreamCountsUnderruns")
+{
+    SlowSourceStats stats;
+    auto source = SafeAlloc::MakeUnique<SlowSoundStreamSource>(1024, 4 * 1024, timespan::zero, std::this_thread::get_id(), &stats);
+    SoundStream stream {8 * 1024, std::chrono::milliseconds {16}, false, std::move(source)};
+
+    stream.Prime(vector<uint8_t>(100, uint8_t {0}));
+
+    CHECK(stream.Read(64, [](size_t, const_span<uint8_t>) { }) == 64);
+    CHECK(stream.GetUnderruns() == 0);
+
+    // Playback asks for more than the decoder has produced and the stream has not ended
+    CHECK(stream.Read(64, [](size_t, const_span<uint8_t>) { }) == 36);
+    CHECK(stream.GetUnderruns() == 1);
+    CHECK_FALSE(stream.IsPassFinished());
+}
+
+FO_END_NAMESPACE
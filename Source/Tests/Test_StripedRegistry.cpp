@@ -0,0 +1,269 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include "StripedRegistry.h"
+
+FO_BEGIN_NAMESPACE
+
+namespace
+{
+    // Mirrors the entity manager layout: a global id map plus a typed map that must always agree with it
+    struct TestShardData
+    {
+        unordered_map<ident_t, size_t> Entities {};
+        unordered_map<ident_t, size_t> Items {};
+    };
+
+    struct WorkloadResult
+    {
+        size_t Failures {};
+        size_t LiveCount {};
+        timespan Elapsed {};
+    };
+
+    template<size_t ShardCount>
+    auto RunMixedWorkload(size_t threads_count, size_t ops_per_thread) -> WorkloadResult
+    {
+        StripedRegistry<TestShardData, ShardCount> registry;
+        std::atomic_int64_t last_id {};
+        std::atomic_size_t failures {};
+        vector<vector<ident_t>> live_ids(threads_count);
+
+        auto worker = [&](size_t thread_index) FO_TSA_NO_ANALYSIS {
+            // Per-thread deterministic LCG, no shared RNG state
+            uint32_t rng = 0xC0FFEEU + numeric_cast<uint32_t>(thread_index) * 2654435761U;
+            auto next = [&rng]() {
+                rng = rng * 1664525U + 1013904223U;
+                return rng >> 8;
+            };
+
+            auto& own_ids = live_ids[thread_index];
+
+            for (size_t i = 0; i < ops_per_thread; i++) {
+                const uint32_t op = next() % 10;
+
+                if (op < 4 || own_ids.empty()) {
+                    const ident_t id {++last_id};
+                    auto& shard = registry.GetShard(id);
+                    scoped_lock lock {shard.Lock};
+
+                    const bool inserted_entity = shard.Data.Entities.emplace(id, thread_index).second;
+                    const bool inserted_item = shard.Data.Items.emplace(id, thread_index).second;
+
+                    if (!inserted_entity || !inserted_item) {
+                        ++failures;
+                    }
+
+                    own_ids.emplace_back(id);
+                }
+                else if (op < 8) {
+                    // Half of the lookups hit an own live id, the rest any id ever handed out
+                    const bool own = (op & 1) != 0;
+                    const ident_t id = own ? own_ids[next() % own_ids.size()] : ident_t {numeric_cast<int64_t>(next() % numeric_cast<uint32_t>(last_id.load())) + 1};
+                    const auto& shard = registry.GetShard(id);
+                    shared_lock lock {shard.Lock};
+
+                    const auto entity_it = shard.Data.Entities.find(id);
+                    const auto item_it = shard.Data.Items.find(id);
+                    const bool has_entity = entity_it != shard.Data.Entities.end();
+                    const bool has_item = item_it != shard.Data.Items.end();
+
+                    if (has_entity != has_item || (has_entity && entity_it->second != item_it->second)) {
+                        ++failures;
+                    }
+                    if (own && (!has_entity || entity_it->second != thread_index)) {
+                        ++failures;
+                    }
+                }
+                else {
+                    const size_t index = next() % own_ids.size();
+                    const ident_t id = own_ids[index];
+                    own_ids[index] = own_ids.back();
+                    own_ids.pop_back();
+
+                    auto& shard = registry.GetShard(id);
+                    scoped_lock lock {shard.Lock};
+
+                    if (shard.Data.Items.erase(id) != 1 || shard.Data.Entities.erase(id) != 1) {
+                        ++failures;
+                    }
+                }
+            }
+        };
+
+        const nanotime start = nanotime::now();
+
+        {
+            vector<std::thread> threads;
+            threads.reserve(threads_count);
+
+            for (size_t t = 0; t < threads_count; t++) {
+                threads.emplace_back(worker, t);
+            }
+
+            for (auto& t : threads) {
+                t.join();
+            }
+        }
+
+        WorkloadResult result;
+        result.Elapsed = nanotime::now() - start;
+        result.Failures = failures.load();
+
+        // Cross-shard walk must see exactly the ids every thread still owns, each in the shard its id maps to
+        unordered_map<ident_t, size_t> expected;
+
+        for (size_t t = 0; t < threads_count; t++) {
+            for (const auto id : live_ids[t]) {
+                expected.emplace(id, t);
+            }
+        }
+
+        for (size_t shard_index = 0; shard_index < registry.GetShards().size(); shard_index++) {
+            auto& shard = registry.GetShards()[shard_index];
+            shared_lock lock {shard.Lock};
+
+            for (const auto& [id, owner] : shard.Data.Entities) {
+                const auto it = expected.find(id);
+
+                if (it == expected.end() || it->second != owner || StripedRegistry<TestShardData, ShardCount>::GetShardIndex(id) != shard_index) {
+                    result.Failures++;
+                }
+            }
+
+            result.LiveCount += shard.Data.Entities.size();
+
+            if (shard.Data.Items.size() != shard.Data.Entities.size()) {
+                result.Failures++;
+            }
+        }
+
+        if (result.LiveCount != expected.size()) {
+            result.Failures++;
+        }
+
+        return result;
+    }
+
+    auto GetStressThreadsCount() -> size_t
+    {
+        return std::clamp<size_t>(std::thread::hardware_concurrency(), 4, 16);
+    }
+}
+
+TEST_CASE("StripedRegistry")
+{
+    SECTION("ShardIndexIsStableAndSpread")
+    {
+        using Registry = StripedRegistry<TestShardData, 32>;
+        array<size_t, Registry::SHARD_COUNT> per_shard {};
+        constexpr int64_t ids_count = 32 * 1024;
+
+        for (int64_t i = 1; i <= ids_count; i++) {
+            const size_t index = Registry::GetShardIndex(ident_t {i});
+            REQUIRE(index < Registry::SHARD_COUNT);
+            CHECK(index == Registry::GetShardIndex(ident_t {i}));
+            per_shard[index]++;
+        }
+
+        // Sequential ids must not pile up in a few shards
+        for (const size_t count : per_shard) {
+            CHECK(count > ids_count / 32 / 2);
+            CHECK(count < ids_count / 32 * 2);
+        }
+
+        CHECK(StripedRegistry<TestShardData, 1>::GetShardIndex(ident_t {12345}) == 0);
+    }
+
+    SECTION("ShardAddressesMatchIndex")
+    {
+        StripedRegistry<TestShardData, 8> registry;
+
+        for (int64_t i = 1; i <= 64; i++) {
+            const ident_t id {i};
+            CHECK(&registry.GetShard(id) == &registry.GetShards()[decltype(registry)::GetShardIndex(id)]);
+        }
+    }
+
+    SECTION("ShardsDoNotShareCacheLines")
+    {
+        using Registry = StripedRegistry<TestShardData, 8>;
+        static_assert(alignof(Registry::Shard) >= Registry::SHARD_ALIGNMENT);
+        static_assert(sizeof(Registry::Shard) % Registry::SHARD_ALIGNMENT == 0);
+
+        Registry registry;
+
+        for (const auto& shard : registry.GetShards()) {
+            CHECK(reinterpret_cast<uintptr_t>(&shard) % Registry::SHARD_ALIGNMENT == 0);
+        }
+    }
+
+    SECTION("SingleThreadedWorkloadIsConsistent")
+    {
+        const auto result = RunMixedWorkload<32>(1, 20000);
+        CHECK(result.Failures == 0);
+        CHECK(result.LiveCount != 0);
+    }
+
+    SECTION("ConcurrentCreateLookupDestroyIsConsistent")
+    {
+        const auto result = RunMixedWorkload<32>(GetStressThreadsCount(), 20000);
+        CHECK(result.Failures == 0);
+        CHECK(result.LiveCount != 0);
+    }
+
+    SECTION("SingleShardStaysCorrectUnderContention")
+    {
+        const auto result = RunMixedWorkload<1>(GetStressThreadsCount(), 5000);
+        CHECK(result.Failures == 0);
+    }
+}
+
+// Timing report rather than a gate, run on demand by passing `[.scaling]` to the unit tests executable
+TEST_CASE("StripedRegistryScaling", "[.scaling]")
+{
+    constexpr size_t ops_per_thread = 200000;
+
+    for (size_t threads_count = 1; threads_count <= GetStressThreadsCount(); threads_count *= 2) {
+        const auto single = RunMixedWorkload<1>(threads_count, ops_per_thread);
+        const auto striped = RunMixedWorkload<32>(threads_count, ops_per_thread);
+        CHECK(single.Failures == 0);
+        CHECK(striped.Failures == 0);
+
+        WriteLog("Registry threads {}: single lock {} ms, 32 shards {} ms", threads_count, single.Elapsed.to_ms<int64_t>(), striped.Elapsed.to_ms<int64_t>());
+    }
+}
+
+FO_END_NAMESPACE
@@ -0,0 +1,305 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "catch_amalgamated.hpp"
+
+#include "UpdateDelta.h"
+
+FO_BEGIN_NAMESPACE
+
+namespace UpdateDeltaTests
+{
+    static auto MakeRandomData(size_t size, uint32_t seed) -> vector<uint8_t>
+    {
+        std::mt19937 rnd {seed};
+        vector<uint8_t> data(size);
+
+        for (auto& byte : data) {
+            byte = numeric_cast<uint8_t>(rnd() & 0xFF);
+        }
+
+        return data;
+    }
+
+    static auto ApplyDelta(const vector<uint8_t>& basis, const vector<uint8_t>& target, const vector<UpdateDeltaOp>& ops, uint64_t& literal_size) -> vector<uint8_t>
+    {
+        vector<uint8_t> output;
+        literal_size = 0;
+
+        for (const auto& op : ops) {
+            auto offset = numeric_cast<size_t>(op.Offset);
+            auto size = numeric_cast<size_t>(op.Size);
+
+            if (op.Type == UpdateDeltaOpType::CopyBlocks) {
+                REQUIRE(offset + size <= basis.size());
+                output.insert(output.end(), basis.begin() + numeric_cast<ptrdiff_t>(offset), basis.begin() + numeric_cast<ptrdiff_t>(offset + size));
+            }
+            else {
+                REQUIRE(offset == output.size());
+                REQUIRE(offset + size <= target.size());
+                output.insert(output.end(), target.begin() + numeric_cast<ptrdiff_t>(offset), target.begin() + numeric_cast<ptrdiff_t>(offset + size));
+                literal_size += op.Size;
+            }
+        }
+
+        return output;
+    }
+}
+
+TEST_CASE("UpdateDelta")
+{
+    using namespace UpdateDeltaTests;
+
+    SECTION("RollingChecksumMatchesFreshSumAtEveryOffset")
+    {
+        auto data = MakeRandomData(4096, 1);
+        constexpr size_t window_size = 1024;
+
+        UpdateRollingChecksum rolling;
+        rolling.Reset({data.data(), window_size});
+
+        for (size_t i = 1; i + window_size <= data.size(); i++) {
+            rolling.Roll(data[i - 1], data[i + window_size - 1]);
+
+            UpdateRollingChecksum fresh;
+            fresh.Reset({data.data() + i, window_size});
+            REQUIRE(rolling.GetValue() == fresh.GetValue());
+        }
+    }
+
+    SECTION("BlockSizeFollowsFileSizeWithinLimits")
+    {
+        CHECK(GetUpdateDeltaBlockSize(0) == UPDATE_DELTA_MIN_BLOCK_SIZE);
+        CHECK(GetUpdateDeltaBlockSize(1024 * 1024) == 1024);
+        CHECK(GetUpdateDeltaBlockSize(uint64_t {500} * 1024 * 1024) == 32768);
+        CHECK(GetUpdateDeltaBlockSize(uint64_t {4} * 1024 * 1024 * 1024) == 131072);
+        CHECK(GetUpdateDeltaBlockSize(uint64_t {1} << 40) == UPDATE_DELTA_MAX_BLOCK_SIZE);
+
+        for (uint64_t size : {uint64_t {1} << 20, uint64_t {3} << 30, uint64_t {7} << 32}) {
+            uint32_t block_size = GetUpdateDeltaBlockSize(size);
+            CHECK(IsValidUpdateDeltaBlockSize(block_size));
+            CHECK(size / block_size <= UPDATE_DELTA_MAX_BLOCKS);
+        }
+
+        CHECK_FALSE(IsValidUpdateDeltaBlockSize(1000));
+        CHECK_FALSE(IsValidUpdateDeltaBlockSize(512));
+        CHECK_FALSE(IsValidUpdateDeltaBlockSize(UPDATE_DELTA_MAX_BLOCK_SIZE * 2));
+    }
+
+    SECTION("IdenticalFileIsOneCopy")
+    {
+        auto data = MakeRandomData(200 * 1024 + 123, 2);
+        auto signatures = MakeUpdateBlockSignatures(data, 1024);
+        auto ops = MakeUpdateDelta(data, signatures);
+
+        // The trailing partial block is never described, so it is the only literal
+        REQUIRE(ops.size() == 2);
+        CHECK(ops[0].Type == UpdateDeltaOpType::CopyBlocks);
+        CHECK(ops[0].Offset == 0);
+        CHECK(ops[0].Size == 200 * 1024);
+        CHECK(ops[1].Type == UpdateDeltaOpType::Literal);
+        CHECK(ops[1].Size == 123);
+    }
+
+    SECTION("EditsCostLiteralsProportionalToTheChange")
+    {
+        auto basis = MakeRandomData(1024 * 1024, 3);
+        auto signatures = MakeUpdateBlockSignatures(basis, 1024);
+
+        auto flipped = basis;
+        flipped[500000] ^= 0x5A;
+
+        auto inserted = basis;
+        auto insertion = MakeRandomData(3000, 4);
+        inserted.insert(inserted.begin() + 300000, insertion.begin(), insertion.end());
+
+        auto erased = basis;
+        erased.erase(erased.begin() + 700000, erased.begin() + 710000);
+
+        for (const auto* target : {&flipped, &inserted, &erased}) {
+            auto ops = MakeUpdateDelta(*target, signatures);
+            uint64_t literal_size = 0;
+
+            CHECK(ApplyDelta(basis, *target, ops, literal_size) == *target);
+            CHECK(literal_size <= 3000 + 2 * 1024);
+            CHECK(ops.size() <= 4);
+        }
+    }
+
+    SECTION("UnrelatedFileIsOneLiteral")
+    {
+        auto basis = MakeRandomData(64 * 1024, 5);
+        auto target = MakeRandomData(64 * 1024, 6);
+        auto ops = MakeUpdateDelta(target, MakeUpdateBlockSignatures(basis, 1024));
+
+        REQUIRE(ops.size() == 1);
+        CHECK(ops[0].Type == UpdateDeltaOpType::Literal);
+        CHECK(ops[0].Offset == 0);
+        CHECK(ops[0].Size == target.size());
+    }
+
+    SECTION("FailedStrongMatchesStopTheScan")
+    {
+        // Every window of the zero run hits the weak sum of the first basis block and none hits its strong hash,
+        // so the budget runs out long before the genuine block at the end is reached
+        auto real_block = MakeRandomData(1024, 7);
+        vector<uint8_t> target(64 * 1024, 0);
+        target.insert(target.end(), real_block.begin(), real_block.end());
+
+        UpdateBlockSignatures basis = MakeUpdateBlockSignatures(real_block, 1024);
+        UpdateBlockSignature fake_block = MakeUpdateBlockSignature(const_span<uint8_t> {target.data(), 1024});
+        fake_block.Strong ^= 1;
+        basis.Blocks.insert(basis.Blocks.begin(), fake_block);
+
+        auto ops = MakeUpdateDelta(target, basis);
+
+        REQUIRE(ops.size() == 1);
+        CHECK(ops[0].Type == UpdateDeltaOpType::Literal);
+        CHECK(ops[0].Size == target.size());
+
+        // Without the crafted block the same target finds the genuine one
+        auto honest_ops = MakeUpdateDelta(target, MakeUpdateBlockSignatures(real_block, 1024));
+        CHECK(std::ranges::any_of(honest_ops, [](const UpdateDeltaOp& op) { return op.Type == UpdateDeltaOpType::CopyBlocks; }));
+    }
+
+    SECTION("StreamedTargetMatchesInMemoryScan")
+    {
+        // Larger than one scan chunk, so the sliding buffer refills mid-file and across matched blocks
+        auto basis = MakeRandomData(3 * 1024 * 1024 + 77, 7);
+        auto target = basis;
+        target[1024 * 1024 + 5] ^= 0xFF;
+        target.erase(target.begin() + 2 * 1024 * 1024, target.begin() + 2 * 1024 * 1024 + 100);
+
+        auto signatures = MakeUpdateBlockSignatures(basis, 2048);
+        auto in_memory_ops = MakeUpdateDelta(target, signatures);
+
+        size_t reads = 0;
+        auto read_target = [&](uint64_t offset, span<uint8_t> buf) -> bool {
+            reads++;
+            MemCopy(buf.data(), target.data() + numeric_cast<size_t>(offset), buf.size());
+            return true;
+        };
+
+        auto streamed_ops = MakeUpdateDelta(numeric_cast<uint64_t>(target.size()), read_target, signatures);
+
+        REQUIRE(streamed_ops.has_value());
+        REQUIRE(streamed_ops->size() == in_memory_ops.size());
+        CHECK(reads > 1);
+
+        for (size_t i = 0; i < in_memory_ops.size(); i++) {
+            CHECK(streamed_ops->at(i).Type == in_memory_ops[i].Type);
+            CHECK(streamed_ops->at(i).Offset == in_memory_ops[i].Offset);
+            CHECK(streamed_ops->at(i).Size == in_memory_ops[i].Size);
+        }
+
+        uint64_t literal_size = 0;
+        CHECK(ApplyDelta(basis, target, in_memory_ops, literal_size) == target);
+
+        auto failing_read = [](uint64_t, span<uint8_t>) -> bool { return false; };
+        CHECK_FALSE(MakeUpdateDelta(numeric_cast<uint64_t>(target.size()), failing_read, signatures).has_value());
+    }
+
+    SECTION("SignaturesAndOpsRoundTripThroughNetBuffers")
+    {
+        auto basis = MakeRandomData(8 * 1024, 8);
+        auto target = basis;
+        target[100] ^= 1;
+
+        auto signatures = MakeUpdateBlockSignatures(basis, 1024);
+        auto ops = MakeUpdateDelta(target, signatures);
+
+        NetOutBuffer out_buf {1024};
+        WriteUpdateBlockSignatures(out_buf, signatures);
+        WriteUpdateDeltaOps(out_buf, ops);
+
+        NetInBuffer in_buf {1024};
+        in_buf.AddData(out_buf.GetData());
+
+        auto read_signatures = ReadUpdateBlockSignatures(in_buf);
+        REQUIRE(read_signatures.has_value());
+        CHECK(read_signatures->BlockSize == 1024);
+        REQUIRE(read_signatures->Blocks.size() == signatures.Blocks.size());
+
+        for (size_t i = 0; i < signatures.Blocks.size(); i++) {
+            CHECK(read_signatures->Blocks[i].Weak == signatures.Blocks[i].Weak);
+            CHECK(read_signatures->Blocks[i].Strong == signatures.Blocks[i].Strong);
+        }
+
+        auto read_ops = ReadUpdateDeltaOps(in_buf);
+        REQUIRE(read_ops.size() == ops.size());
+
+        for (size_t i = 0; i < ops.size(); i++) {
+            CHECK(read_ops[i].Type == ops[i].Type);
+            CHECK(read_ops[i].Offset == ops[i].Offset);
+            CHECK(read_ops[i].Size == ops[i].Size);
+        }
+
+        CHECK(in_buf.GetUnreadSize() == 0);
+    }
+
+    SECTION("MalformedSignatureHeaderIsRejected")
+    {
+        NetOutBuffer out_buf {64};
+        out_buf.Write<uint32_t>(1000);
+        out_buf.Write<uint32_t>(0);
+
+        NetInBuffer in_buf {64};
+        in_buf.AddData(out_buf.GetData());
+        CHECK_FALSE(ReadUpdateBlockSignatures(in_buf).has_value());
+    }
+
+    SECTION("SignaturesHashCoversEveryField")
+    {
+        auto data = MakeRandomData(64 * 1024, 9);
+        auto signatures = MakeUpdateBlockSignatures(data, UPDATE_DELTA_MIN_BLOCK_SIZE);
+        const uint64_t hash = HashUpdateBlockSignatures(signatures);
+
+        CHECK(HashUpdateBlockSignatures(MakeUpdateBlockSignatures(data, UPDATE_DELTA_MIN_BLOCK_SIZE)) == hash);
+        CHECK(HashUpdateBlockSignatures(MakeUpdateBlockSignatures(data, UPDATE_DELTA_MIN_BLOCK_SIZE * 2)) != hash);
+
+        auto changed_weak = signatures;
+        changed_weak.Blocks.back().Weak++;
+        CHECK(HashUpdateBlockSignatures(changed_weak) != hash);
+
+        auto changed_strong = signatures;
+        changed_strong.Blocks.front().Strong++;
+        CHECK(HashUpdateBlockSignatures(changed_strong) != hash);
+
+        auto shorter = signatures;
+        shorter.Blocks.pop_back();
+        CHECK(HashUpdateBlockSignatures(shorter) != hash);
+    }
+}
+
+FO_END_NAMESPACE
@@ -0,0 +1,240 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "catch_amalgamated.hpp"
+
+#include <filesystem>
+
+#include "DiskFileSystem.h"
+#include "UpdateFileCache.h"
+
+FO_BEGIN_NAMESPACE
+
+namespace UpdateFileCacheTests
+{
+    static auto MakeTempDir() -> string
+    {
+        auto temp_root = std::filesystem::temp_directory_path() / "lf_update_file_cache_tests" / std::to_string(std::random_device {}());
+        std::filesystem::create_directories(temp_root);
+        return fs_path_to_string(temp_root);
+    }
+
+    static auto MakeFileData(size_t size, uint32_t seed) -> vector<uint8_t>
+    {
+        vector<uint8_t> data(size);
+        std::mt19937 rnd {seed};
+
+        for (auto& byte : data) {
+            byte = static_cast<uint8_t>(rnd() & 0xFF);
+        }
+
+        return data;
+    }
+
+    // Downloads the whole file in portions of varying size, the way a client resumes from its written offset
+    static auto DownloadThroughCache(UpdateFileCache& cache, size_t file_index, size_t file_size, uint32_t seed) -> optional<vector<uint8_t>>
+    {
+        vector<uint8_t> received;
+        std::mt19937 rnd {seed};
+
+        while (received.size() < file_size) {
+            auto view = cache.GetFileView(file_index);
+
+            if (!view.has_value()) {
+                return std::nullopt;
+            }
+
+            size_t portion = std::min(file_size - received.size(), static_cast<size_t>(16 * 1024 + rnd() % (256 * 1024)));
+            size_t portion_offset = received.size();
+            received.resize(portion_offset + portion);
+
+            if (!view->Read(portion_offset, {received.data() + portion_offset, portion})) {
+                return std::nullopt;
+            }
+        }
+
+        return received;
+    }
+}
+
+TEST_CASE("UpdateFileCache")
+{
+    using namespace UpdateFileCacheTests;
+
+    string temp_dir = MakeTempDir();
+    auto cleanup = scope_exit([&temp_dir]() noexcept { fs_remove_dir_tree(temp_dir); });
+
+    string big_path = strex(temp_dir).combine_path("Big.zip").str();
+    string small_path = strex(temp_dir).combine_path("Small.zip").str();
+    string empty_path = strex(temp_dir).combine_path("Empty.zip").str();
+    auto big_data = MakeFileData(3 * 1024 * 1024 + 123, 39);
+    auto small_data = MakeFileData(1, 40);
+
+    REQUIRE(fs_write_file(big_path, big_data));
+    REQUIRE(fs_write_file(small_path, small_data));
+    REQUIRE(fs_write_file(empty_path, string_view {}));
+
+    UpdateFileCache cache;
+    size_t big_index = cache.AddFile(big_path, big_data.size());
+    size_t small_index = cache.AddFile(small_path, small_data.size());
+    size_t empty_index = cache.AddFile(empty_path, 0);
+
+    CHECK(cache.GetFileCount() == 3);
+    CHECK(cache.GetOpenCount() == 0);
+    CHECK(cache.GetHeldCount() == 0);
+
+    SECTION("EmptyFileIsServedWithoutOpening")
+    {
+        auto view = cache.GetFileView(empty_index);
+
+        REQUIRE(view.has_value());
+        CHECK(view->Read(0, {}));
+        CHECK(cache.GetOpenCount() == 0);
+        CHECK(cache.GetHeldCount() == 0);
+    }
+
+    SECTION("ReadPastTheEndFails")
+    {
+        auto view = cache.GetFileView(small_index);
+        array<uint8_t, 2> buf {};
+
+        REQUIRE(view.has_value());
+        CHECK_FALSE(view->Read(0, buf));
+        CHECK_FALSE(view->Read(small_data.size(), {buf.data(), 1}));
+        CHECK(view->Read(0, {buf.data(), 1}));
+        CHECK(buf[0] == small_data[0]);
+    }
+
+    SECTION("ViewOutlivesTheCache")
+    {
+        optional<UpdateFileCache::FileView> view;
+
+        {
+            UpdateFileCache short_lived_cache;
+            size_t index = short_lived_cache.AddFile(big_path, big_data.size());
+            view = short_lived_cache.GetFileView(index);
+        }
+
+        REQUIRE(view.has_value());
+
+        vector<uint8_t> read_data(big_data.size());
+        REQUIRE(view->Read(0, read_data));
+        CHECK(read_data == big_data);
+    }
+
+#if FO_WINDOWS || FO_LINUX || FO_MAC
+    SECTION("ConcurrentClientsShareOneDescriptorPerFile")
+    {
+        constexpr size_t client_count = 24;
+
+        std::atomic_size_t mismatches {};
+        vector<std::thread> clients;
+
+        for (size_t i = 0; i < client_count; i++) {
+            clients.emplace_back([&, i]() {
+                auto big = DownloadThroughCache(cache, big_index, big_data.size(), static_cast<uint32_t>(i));
+                auto small = DownloadThroughCache(cache, small_index, small_data.size(), static_cast<uint32_t>(i + client_count));
+
+                if (!big.has_value() || *big != big_data || !small.has_value() || *small != small_data) {
+                    ++mismatches;
+                }
+            });
+        }
+
+        for (auto& client : clients) {
+            client.join();
+        }
+
+        CHECK(mismatches == 0);
+
+        // Every client and every portion went through the same two descriptors
+        CHECK(cache.GetOpenCount() == 2);
+        CHECK(cache.GetHeldCount() == 2);
+        CHECK(cache.GetGeneration(big_index) == 1);
+        CHECK(cache.GetGeneration(small_index) == 1);
+    }
+
+    // A mapping faulted the whole process when the file shrank under it, a descriptor only fails the read
+    SECTION("FileTruncatedUnderAViewFailsTheRead")
+    {
+        auto in_flight = cache.GetFileView(big_index);
+        REQUIRE(in_flight.has_value());
+
+        REQUIRE(fs_write_file(big_path, MakeFileData(1024, 41)));
+
+        vector<uint8_t> tail(4096);
+        CHECK_FALSE(in_flight->Read(big_data.size() - tail.size(), tail));
+        CHECK_FALSE(cache.GetFileView(big_index).has_value());
+        CHECK(cache.GetHeldCount() == 0);
+    }
+#endif
+
+#if FO_LINUX || FO_MAC
+    // Renaming over a file held open needs POSIX rename semantics, which not every Windows file system provides
+    SECTION("ReplacedFileStartsNewGeneration")
+    {
+        auto original_write_time = std::filesystem::last_write_time(std::filesystem::path {fs_make_path(big_path)});
+        auto in_flight = cache.GetFileView(big_index);
+
+        REQUIRE(in_flight.has_value());
+        CHECK(in_flight->Generation == 1);
+
+        auto replacement_data = MakeFileData(big_data.size() + 1, 41);
+        string replacement_path = strex(temp_dir).combine_path("Big.zip.new").str();
+        REQUIRE(fs_write_file(replacement_path, replacement_data));
+        REQUIRE(fs_rename(replacement_path, big_path));
+
+        // The new bytes were never announced, so nothing is served and the stale descriptor is dropped
+        CHECK_FALSE(cache.GetFileView(big_index).has_value());
+        CHECK(cache.GetHeldCount() == 0);
+
+        // The request in flight still finishes on the file it was checked against
+        vector<uint8_t> in_flight_data(big_data.size());
+        REQUIRE(in_flight->Read(0, in_flight_data));
+        CHECK(in_flight_data == big_data);
+
+        // Putting the announced file back serves it again from a fresh descriptor
+        REQUIRE(fs_write_file(big_path, big_data));
+        std::filesystem::last_write_time(std::filesystem::path {fs_make_path(big_path)}, original_write_time);
+
+        auto restored = DownloadThroughCache(cache, big_index, big_data.size(), 42);
+
+        REQUIRE(restored.has_value());
+        CHECK(*restored == big_data);
+        CHECK(cache.GetGeneration(big_index) == 2);
+        CHECK(cache.GetOpenCount() == 2);
+    }
+#endif
+}
+
+FO_END_NAMESPACE
@@ -0,0 +1,354 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "catch_amalgamated.hpp"
+
+#include <filesystem>
+
+#include "DiskFileSystem.h"
+#include "MetadataRegistration.h"
+#include "Test_BakerHelpers.h"
+#include "UpdaterBackend.h"
+
+FO_BEGIN_NAMESPACE
+
+namespace UpdaterBackendTests
+{
+    static auto MakeTempDir() -> string
+    {
+        auto temp_root = std::filesystem::temp_directory_path() / "lf_updater_backend_tests" / std::to_string(std::random_device {}());
+        std::filesystem::create_directories(temp_root);
+        return fs_path_to_string(temp_root);
+    }
+
+    static auto MakeRandomData(size_t size, uint32_t seed) -> vector<uint8_t>
+    {
+        std::mt19937 rnd {seed};
+        vector<uint8_t> data(size);
+
+        for (auto& byte : data) {
+            byte = numeric_cast<uint8_t>(rnd() & 0xFF);
+        }
+
+        return data;
+    }
+
+    // An older build of the pack: a patched range and a few inserted bytes, so most blocks still match
+    static auto MakeOutdatedData(const vector<uint8_t>& data, uint32_t seed) -> vector<uint8_t>
+    {
+        auto outdated = data;
+        auto patch = MakeRandomData(4096, seed);
+        size_t patch_offset = (outdated.size() / 3 + seed * 7919) % (outdated.size() - patch.size());
+        std::ranges::copy(patch, outdated.begin() + numeric_cast<ptrdiff_t>(patch_offset));
+        outdated.insert(outdated.begin() + numeric_cast<ptrdiff_t>(outdated.size() / 2), patch.begin(), patch.begin() + 100);
+        return outdated;
+    }
+
+    static auto MakeSignatures(const vector<uint8_t>& basis) -> UpdateBlockSignatures
+    {
+        return MakeUpdateBlockSignatures(basis, GetUpdateDeltaBlockSize(basis.size()));
+    }
+
+    // Not asserting inside, so clients running on their own threads can use it too
+    static auto ApplyDelta(const vector<uint8_t>& basis, const vector<uint8_t>& target, const vector<UpdateDeltaOp>& ops) -> optional<vector<uint8_t>>
+    {
+        vector<uint8_t> output;
+
+        for (const auto& op : ops) {
+            auto offset = numeric_cast<size_t>(op.Offset);
+            auto size = numeric_cast<size_t>(op.Size);
+            const auto& source = op.Type == UpdateDeltaOpType::CopyBlocks ? basis : target;
+
+            if (offset > source.size() || size > source.size() - offset) {
+                return std::nullopt;
+            }
+
+            output.insert(output.end(), source.begin() + numeric_cast<ptrdiff_t>(offset), source.begin() + numeric_cast<ptrdiff_t>(offset + size));
+        }
+
+        return output;
+    }
+
+    // Downloads the whole file in portions of varying size, the way a client resumes from its written offset
+    static auto DownloadThroughBackend(UpdaterBackend& backend, size_t file_size, uint32_t seed, std::atomic_size_t& served_portions) -> optional<vector<uint8_t>>
+    {
+        vector<uint8_t> received;
+        std::mt19937 rnd {seed};
+
+        while (received.size() < file_size) {
+            size_t portion = std::min(file_size - received.size(), static_cast<size_t>(16 * 1024 + rnd() % (256 * 1024)));
+            auto portion_data = backend.GetFilePortion(0, received.size(), portion);
+
+            if (!portion_data.has_value()) {
+                return std::nullopt;
+            }
+
+            received.insert(received.end(), portion_data->begin(), portion_data->end());
+            ++served_portions;
+        }
+
+        return received;
+    }
+
+    // The distributed pack as the updater reads it: the zip it sends and, beside it, the unpacked directory the
+    // metadata check mounts in non-packaged builds
+    static void MakeClientResources(GlobalSettings& settings, string_view dir, const vector<uint8_t>& pack_data)
+    {
+        REQUIRE(fs_write_file(strex(dir).combine_path("Pack.zip").str(), pack_data));
+        REQUIRE(fs_write_file(strex(dir).combine_path("Pack").combine_path("Metadata.fometa-client").str(), MakeMetadataHeader(BakerTests::TEST_METADATA_VERSION)));
+
+        settings.ApplyDefaultSettings();
+
+        BakerTests::OverrideSetting(settings.ClientResources, string(dir));
+        BakerTests::OverrideSetting(settings.ClientResourceEntries, vector<string> {"Pack"});
+        BakerTests::OverrideSetting(settings.PlatformBinaries, strex(dir).combine_path("NoPlatformBinaries").str());
+    }
+}
+
+TEST_CASE("UpdaterBackend")
+{
+    using namespace UpdaterBackendTests;
+
+    string temp_dir = MakeTempDir();
+    auto cleanup = scope_exit([&temp_dir]() noexcept { fs_remove_dir_tree(temp_dir); });
+
+    const bool in_memory = GENERATE(true, false);
+    CAPTURE(in_memory);
+
+    auto pack_data = MakeRandomData(3 * 1024 * 1024 + 123, 38);
+    GlobalSettings settings {false};
+    MakeClientResources(settings, temp_dir, pack_data);
+    BakerTests::OverrideSetting(settings.UpdateFilesInMemory, in_memory);
+    BakerTests::OverrideSetting(settings.UpdateDeltaCacheSize, 2);
+
+    auto outdated_a = MakeOutdatedData(pack_data, 1);
+    auto outdated_b = MakeOutdatedData(pack_data, 2);
+    auto outdated_c = MakeOutdatedData(pack_data, 3);
+
+    SECTION("DeltaRebuildsTheAnnouncedFile")
+    {
+        UpdaterBackend backend;
+        backend.LoadFromClientResources(settings, BakerTests::TEST_METADATA_VERSION);
+        REQUIRE(backend.GetUpdateFileCount() == 1);
+
+        auto delta_ops = backend.MakeFileDelta(0, MakeSignatures(outdated_a));
+
+        REQUIRE(delta_ops);
+        CHECK(ApplyDelta(outdated_a, pack_data, *delta_ops) == pack_data);
+        CHECK(std::ranges::any_of(*delta_ops, [](const UpdateDeltaOp& op) { return op.Type == UpdateDeltaOpType::CopyBlocks; }));
+        CHECK(backend.GetDeltaScanCount() == 1);
+        CHECK_THROWS(backend.MakeFileDelta(1, MakeSignatures(outdated_a)));
+    }
+
+    SECTION("PortionsRebuildTheAnnouncedFile")
+    {
+        UpdaterBackend backend;
+        backend.LoadFromClientResources(settings, BakerTests::TEST_METADATA_VERSION);
+
+        std::atomic_size_t served_portions {};
+        auto received = DownloadThroughBackend(backend, pack_data.size(), 5, served_portions);
+
+        REQUIRE(received.has_value());
+        CHECK(*received == pack_data);
+        CHECK(backend.GetFilePortion(0, pack_data.size(), 0).has_value());
+        CHECK_THROWS(backend.GetFilePortion(0, pack_data.size() - 1, 2));
+    }
+
+    SECTION("ConcurrentClientsWithOneBasisShareOneScan")
+    {
+        UpdaterBackend backend;
+        backend.LoadFromClientResources(settings, BakerTests::TEST_METADATA_VERSION);
+
+        constexpr size_t client_count = 16;
+        const auto signatures = MakeSignatures(outdated_a);
+        vector<shared_ptr<const vector<UpdateDeltaOp>>> client_deltas(client_count);
+        vector<std::thread> clients;
+
+        for (size_t i = 0; i < client_count; i++) {
+            clients.emplace_back([&, i]() { client_deltas[i] = backend.MakeFileDelta(0, signatures); });
+        }
+
+        for (auto& client : clients) {
+            client.join();
+        }
+
+        CHECK(backend.GetDeltaScanCount() == 1);
+        CHECK(backend.GetCachedDeltaCount() == 1);
+
+        for (const auto& delta_ops : client_deltas) {
+            REQUIRE(delta_ops);
+            CHECK(delta_ops.get() == client_deltas.front().get());
+        }
+
+        CHECK(ApplyDelta(outdated_a, pack_data, *client_deltas.front()) == pack_data);
+    }
+
+    SECTION("OldestBasisIsEvictedFirst")
+    {
+        UpdaterBackend backend;
+        backend.LoadFromClientResources(settings, BakerTests::TEST_METADATA_VERSION);
+
+        REQUIRE(backend.MakeFileDelta(0, MakeSignatures(outdated_a)));
+        REQUIRE(backend.MakeFileDelta(0, MakeSignatures(outdated_b)));
+        REQUIRE(backend.MakeFileDelta(0, MakeSignatures(outdated_b)));
+        CHECK(backend.GetDeltaScanCount() == 2);
+
+        REQUIRE(backend.MakeFileDelta(0, MakeSignatures(outdated_c)));
+        CHECK(backend.GetCachedDeltaCount() == 2);
+        CHECK(backend.GetDeltaScanCount() == 3);
+
+        auto delta_ops = backend.MakeFileDelta(0, MakeSignatures(outdated_a));
+        REQUIRE(delta_ops);
+        CHECK(backend.GetDeltaScanCount() == 4);
+        CHECK(ApplyDelta(outdated_a, pack_data, *delta_ops) == pack_data);
+
+        // Reloading may announce other files under the same indices
+        backend.LoadFromClientResources(settings, BakerTests::TEST_METADATA_VERSION);
+        CHECK(backend.GetCachedDeltaCount() == 0);
+    }
+
+    SECTION("DisabledCacheScansEveryRequest")
+    {
+        BakerTests::OverrideSetting(settings.UpdateDeltaCacheSize, 0);
+
+        UpdaterBackend backend;
+        backend.LoadFromClientResources(settings, BakerTests::TEST_METADATA_VERSION);
+
+        REQUIRE(backend.MakeFileDelta(0, MakeSignatures(outdated_a)));
+        REQUIRE(backend.MakeFileDelta(0, MakeSignatures(outdated_a)));
+        CHECK(backend.GetDeltaScanCount() == 2);
+        CHECK(backend.GetCachedDeltaCount() == 0);
+    }
+
+    SECTION("FileOverTheScanCapIsSentWhole")
+    {
+        BakerTests::OverrideSetting(settings.UpdateDeltaMaxFileSize, 1024 * 1024);
+
+        UpdaterBackend backend;
+        backend.LoadFromClientResources(settings, BakerTests::TEST_METADATA_VERSION);
+
+        auto delta_ops = backend.MakeFileDelta(0, MakeSignatures(outdated_a));
+
+        REQUIRE(delta_ops);
+        REQUIRE(delta_ops->size() == 1);
+        CHECK(delta_ops->front().Type == UpdateDeltaOpType::Literal);
+        CHECK(delta_ops->front().Offset == 0);
+        CHECK(delta_ops->front().Size == pack_data.size());
+        CHECK(backend.GetDeltaScanCount() == 0);
+    }
+}
+
+// A disk-mode pack cut short on disk while clients download it, the way an interrupted deploy copy leaves it
+TEST_CASE("UpdaterBackendPackTruncatedWhileServed")
+{
+    using namespace UpdaterBackendTests;
+
+    string temp_dir = MakeTempDir();
+    auto cleanup = scope_exit([&temp_dir]() noexcept { fs_remove_dir_tree(temp_dir); });
+
+    auto pack_data = MakeRandomData(3 * 1024 * 1024 + 123, 39);
+    GlobalSettings settings {false};
+    MakeClientResources(settings, temp_dir, pack_data);
+    BakerTests::OverrideSetting(settings.UpdateFilesInMemory, false);
+
+    UpdaterBackend backend;
+    backend.LoadFromClientResources(settings, BakerTests::TEST_METADATA_VERSION);
+
+    string pack_path = strex(temp_dir).combine_path("Pack.zip").str();
+    auto original_write_time = std::filesystem::last_write_time(std::filesystem::path {fs_make_path(pack_path)});
+    auto outdated = MakeOutdatedData(pack_data, 1);
+    const auto signatures = MakeSignatures(outdated);
+
+    constexpr size_t client_count = 16;
+    std::atomic_size_t served_portions {};
+    std::atomic_size_t mismatches {};
+    std::atomic_size_t stopped_clients {};
+    vector<std::thread> clients;
+
+    // Each client downloads again and again until the truncation stops it; what it does get must be the announced bytes
+    for (size_t i = 0; i < client_count; i++) {
+        clients.emplace_back([&, i]() {
+            auto count_stop = scope_exit([&stopped_clients]() noexcept { ++stopped_clients; });
+
+            for (uint32_t round = 0;; round++) {
+                if (i % 2 == 0) {
+                    auto delta_ops = backend.MakeFileDelta(0, signatures);
+
+                    if (!delta_ops) {
+                        return;
+                    }
+                    if (ApplyDelta(outdated, pack_data, *delta_ops) != pack_data) {
+                        ++mismatches;
+                    }
+                }
+
+                auto received = DownloadThroughBackend(backend, pack_data.size(), numeric_cast<uint32_t>(i * 1000 + round), served_portions);
+
+                if (!received.has_value()) {
+                    return;
+                }
+                if (*received != pack_data) {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+
+    while (served_portions < client_count * 4 && stopped_clients == 0) {
+        std::this_thread::yield();
+    }
+
+    // Cut in place to the first half, so whatever a read still returns is a prefix of the announced bytes
+    REQUIRE(fs_write_file(pack_path, const_span<uint8_t> {pack_data.data(), pack_data.size() / 2}));
+
+    for (auto& client : clients) {
+        client.join();
+    }
+
+    CHECK(mismatches == 0);
+    CHECK_FALSE(backend.GetFilePortion(0, 0, 1).has_value());
+    CHECK_FALSE(backend.MakeFileDelta(0, signatures));
+
+    // Once the deploy completes with the announced pack, serving resumes
+    REQUIRE(fs_write_file(pack_path, pack_data));
+    std::filesystem::last_write_time(std::filesystem::path {fs_make_path(pack_path)}, original_write_time);
+
+    auto restored = DownloadThroughBackend(backend, pack_data.size(), 7, served_portions);
+    REQUIRE(restored.has_value());
+    CHECK(*restored == pack_data);
+
+    auto delta_ops = backend.MakeFileDelta(0, signatures);
+    REQUIRE(delta_ops);
+    CHECK(ApplyDelta(outdated, pack_data, *delta_ops) == pack_data);
+}
+
+FO_END_NAMESPACE
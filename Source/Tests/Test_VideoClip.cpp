@@ -0,0 +1,204 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "catch_amalgamated.hpp"
+
+#include "Test_VideoFixtures.h"
+#include "VideoClip.h"
+#include "VideoColorConverter.h"
+
+FO_BEGIN_NAMESPACE
+
+namespace
+{
+    auto HashFrame(const vector<ucolor>& pixels) -> uint64_t
+    {
+        uint64_t hash = 14695981039346656037ULL;
+
+        for (const ucolor& pixel : pixels) {
+            for (uint8_t value : {pixel.comp.r, pixel.comp.g, pixel.comp.b, pixel.comp.a}) {
+                hash ^= value;
+                hash *= 1099511628211ULL;
+            }
+        }
+
+        return hash;
+    }
+
+    auto MakeTinyClip() -> VideoClip
+    {
+        return VideoClip(vector<uint8_t>(VideoTests::TinyTheoraClip.begin(), VideoTests::TinyTheoraClip.end()));
+    }
+
+    auto GetFrameTime(int32_t frame) -> timespan
+    {
+        return std::chrono::microseconds {frame * 1000000 / VideoTests::TinyTheoraClipFramesPerSecond};
+    }
+
+    // Frames are decoded on a worker, so rendering a paused clip picks the requested frame up once it is ready
+    template<typename Predicate>
+    auto RenderUntil(VideoClip& clip, Predicate predicate) -> bool
+    {
+        nanotime deadline = nanotime::now() + std::chrono::seconds {10};
+
+        while (!predicate()) {
+            if (nanotime::now() > deadline) {
+                return false;
+            }
+
+            (void)clip.RenderFrame();
+            std::this_thread::sleep_for(std::chrono::milliseconds {1});
+        }
+
+        return true;
+    }
+
+    auto MakePlane(size_t width, size_t height, size_t stride, std::mt19937& rnd) -> vector<uint8_t>
+    {
+        std::uniform_int_distribution<int32_t> dist {0, 255};
+        vector<uint8_t> plane((height - 1) * stride + width);
+
+        for (auto& value : plane) {
+            value = static_cast<uint8_t>(dist(rnd));
+        }
+
+        return plane;
+    }
+}
+
+TEST_CASE("VideoClipRendersEveryFramePixelExact")
+{
+    auto clip = MakeTinyClip();
+    CHECK(clip.GetSize().width == 30);
+    CHECK(clip.GetSize().height == 14);
+
+    clip.Pause();
+
+    for (int32_t frame = 1; frame <= VideoTests::TinyTheoraClipFrames; frame++) {
+        clip.SetTime(GetFrameTime(frame));
+        REQUIRE(RenderUntil(clip, [&] { return clip.GetFrameIndex() == frame; }));
+
+        const auto& pixels = clip.RenderFrame();
+        REQUIRE(pixels.size() == size_t {30} * 14);
+        CHECK(HashFrame(pixels) == VideoTests::TinyTheoraClipFrameHashes[frame - 1]);
+    }
+
+    CHECK(clip.IsStopped());
+}
+
+TEST_CASE("VideoClipSkipsStraightToDueFrame")
+{
+    auto clip = MakeTinyClip();
+    clip.Pause();
+    clip.SetTime(GetFrameTime(5));
+
+    REQUIRE(RenderUntil(clip, [&] { return clip.GetFrameIndex() == 5; }));
+    CHECK(HashFrame(clip.RenderFrame()) == VideoTests::TinyTheoraClipFrameHashes[4]);
+    CHECK_FALSE(clip.IsStopped());
+}
+
+TEST_CASE("VideoClipLoopReplaysFromFirstFrame")
+{
+    auto clip = MakeTinyClip();
+    clip.SetLooped(true);
+    clip.Pause();
+    clip.SetTime(GetFrameTime(VideoTests::TinyTheoraClipFrames));
+
+    // Reaching the last frame restarts a looped clip, the texture still shows that frame until the next one is due
+    REQUIRE(RenderUntil(clip, [&] { return clip.IsPlaying(); }));
+    CHECK(clip.GetFrameIndex() == 0);
+    CHECK(HashFrame(clip.RenderFrame()) == VideoTests::TinyTheoraClipFrameHashes.back());
+
+    clip.Pause();
+    clip.SetTime(GetFrameTime(1));
+
+    REQUIRE(RenderUntil(clip, [&] { return clip.GetFrameIndex() == 1; }));
+    CHECK(HashFrame(clip.RenderFrame()) == VideoTests::TinyTheoraClipFrameHashes.front());
+}
+
+TEST_CASE("VideoClipLoopEnabledNearEndWakesParkedDecoder")
+{
+    auto clip = MakeTinyClip();
+    clip.Pause();
+    clip.SetTime(GetFrameTime(VideoTests::TinyTheoraClipFrames - 1));
+
+    // The decoder has queued the last frame by now and parks at end of stream until looping is enabled
+    REQUIRE(RenderUntil(clip, [&] { return clip.GetFrameIndex() == VideoTests::TinyTheoraClipFrames - 1; }));
+    std::this_thread::sleep_for(std::chrono::milliseconds {20});
+
+    clip.SetLooped(true);
+    clip.SetTime(GetFrameTime(VideoTests::TinyTheoraClipFrames));
+
+    REQUIRE(RenderUntil(clip, [&] { return clip.IsPlaying(); }));
+    CHECK(clip.GetFrameIndex() == 0);
+
+    clip.Pause();
+    clip.SetTime(GetFrameTime(1));
+
+    REQUIRE(RenderUntil(clip, [&] { return clip.GetFrameIndex() == 1; }));
+    CHECK(HashFrame(clip.RenderFrame()) == VideoTests::TinyTheoraClipFrameHashes.front());
+}
+
+TEST_CASE("VideoColorConverterMatchesScalarPath")
+{
+    std::mt19937 rnd; // NOLINT(cert-msc51-cpp)
+
+    for (auto layout : {VideoChromaLayout::Yuv420, VideoChromaLayout::Yuv422, VideoChromaLayout::Yuv444}) {
+        for (isize32 size : {isize32 {1, 1}, isize32 {7, 3}, isize32 {30, 14}, isize32 {33, 17}, isize32 {64, 9}}) {
+            size_t w = numeric_cast<size_t>(size.width);
+            size_t h = numeric_cast<size_t>(size.height);
+            size_t chroma_w = layout == VideoChromaLayout::Yuv444 ? w : (w + 1) / 2;
+            size_t chroma_h = layout == VideoChromaLayout::Yuv420 ? (h + 1) / 2 : h;
+
+            // Decoded planes are padded past the picture, like Theora frames are
+            auto luma = MakePlane(w, h, w + 5, rnd);
+            auto cb = MakePlane(chroma_w, chroma_h, chroma_w + 3, rnd);
+            auto cr = MakePlane(chroma_w, chroma_h, chroma_w + 3, rnd);
+
+            array<VideoPicturePlane, 3> planes;
+            planes[0] = VideoPicturePlane {.Data = luma, .Stride = w + 5};
+            planes[1] = VideoPicturePlane {.Data = cb, .Stride = chroma_w + 3};
+            planes[2] = VideoPicturePlane {.Data = cr, .Stride = chroma_w + 3};
+
+            vector<ucolor> converted(w * h);
+            vector<ucolor> expected(w * h);
+            ConvertVideoPicture(layout, planes, size, converted);
+            ConvertVideoPictureScalar(layout, planes, size, expected);
+
+            CHECK(converted == expected);
+        }
+    }
+}
+
+FO_END_NAMESPACE
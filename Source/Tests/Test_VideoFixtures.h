@@ -0,0 +1,302 @@
+//      __________        ___               ______            _
+//     / ____/ __ \____  / (_)___  ___     / ____/___  ____ _(_)___  ___
+//    / /_  / / / / __ \/ / / __ \/ _ \   / __/ / __ \/ __ `/ / __ \/ _ `
+//   / __/ / /_/ / / / / / / / / /  __/  / /___/ / / / /_/ / / / / /  __/
+//  /_/    \____/_/ /_/_/_/_/ /_/\___/  /_____/_/ /_/\__, /_/_/ /_/\___/
+//                                                  /____/
+// FOnline Engine
+// https://fonline.ru
+// https://github.com/cvet/fonline
+//
+// MIT License
+//
+// Copyright (c) 2006 - 2026, Anton Tsvetinskiy aka cvet <aka.cvet@gmail.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+#include "Common.h"
+
+FO_BEGIN_NAMESPACE
+
+namespace VideoTests
+{
+    // Theora 4:2:0 clip, 30x14 picture in a 32x16 frame, 24 fps, 6 frames, encoded with the bundled libtheora
+    // from a moving gradient. Keeps the playback tests independent of game resources
+    inline constexpr array<uint8_t, 3809> TinyTheoraClip = {
+        0x4F, 0x67, 0x67, 0x53, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xA9, 0x6E, 0x4F, 0x01, 0x2A, 0x80, 0x74, 0x68, 0x65,
+        0x6F, 0x72, 0x61, 0x03, 0x02, 0x01, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0E,
+        0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01,
+        0x00, 0x00, 0x00, 0x00, 0x28, 0xC0, 0x4F, 0x67, 0x67, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFA, 0xBB, 0xCA, 0xD3,
+        0x0E, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x88, 0x81,
+        0x74, 0x68, 0x65, 0x6F, 0x72, 0x61, 0x2F, 0x00, 0x00, 0x00, 0x58, 0x69, 0x70, 0x68, 0x2E, 0x4F,
+        0x72, 0x67, 0x20, 0x6C, 0x69, 0x62, 0x74, 0x68, 0x65, 0x6F, 0x72, 0x61, 0x20, 0x31, 0x2E, 0x32,
+        0x2E, 0x30, 0x20, 0x32, 0x30, 0x32, 0x35, 0x30, 0x33, 0x32, 0x39, 0x20, 0x28, 0x50, 0x74, 0x61,
+        0x6C, 0x61, 0x72, 0x62, 0x76, 0x6F, 0x72, 0x6D, 0x29, 0x00, 0x00, 0x00, 0x00, 0x82, 0x74, 0x68,
+        0x65, 0x6F, 0x72, 0x61, 0x9F, 0x93, 0x0C, 0xCA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x88, 0x88, 0x86,
+        0x66, 0x66, 0x66, 0x66, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x11, 0x6D, 0xAE, 0x53, 0x67, 0x92, 0xC8, 0xFC, 0x56, 0x12, 0xFC, 0x78,
+        0x39, 0x5B, 0x6C, 0xE6, 0x2A, 0xF5, 0x68, 0xAB, 0x54, 0x28, 0x13, 0x29, 0x24, 0x5A, 0x10, 0xFE,
+        0x79, 0x39, 0x9B, 0x8D, 0x66, 0x53, 0x09, 0x78, 0xB2, 0x55, 0x29, 0x93, 0x89, 0x24, 0x82, 0x19,
+        0x08, 0x7C, 0x3C, 0x1D, 0x8E, 0x06, 0xA3, 0x41, 0x80, 0xBC, 0x56, 0x2A, 0x14, 0x09, 0x04, 0x62,
+        0x21, 0x08, 0x7C, 0x3C, 0x1C, 0x0C, 0x86, 0x02, 0xC1, 0x40, 0x88, 0x38, 0x15, 0x16, 0xDA, 0xE5,
+        0x36, 0x79, 0x2C, 0x8F, 0xC5, 0x61, 0x2F, 0xC7, 0x83, 0x95, 0xB6, 0xCE, 0x62, 0xAF, 0x56, 0x8A,
+        0xB5, 0x42, 0x81, 0x32, 0x92, 0x45, 0xA1, 0x0F, 0xE7, 0x93, 0x99, 0xB8, 0xD6, 0x65, 0x30, 0x97,
+        0x8B, 0x25, 0x52, 0x99, 0x38, 0x92, 0x48, 0x21, 0x90, 0x87, 0xC3, 0xC1, 0xD8, 0xE0, 0x6A, 0x34,
+        0x18, 0x0B, 0xC5, 0x62, 0xA1, 0x40, 0x90, 0x46, 0x22, 0x10, 0x87, 0xC3, 0xC1, 0xC0, 0xC8, 0x60,
+        0x2C, 0x14, 0x08, 0x83, 0x81, 0x40, 0xB0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+        0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+        0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+        0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+        0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC0, 0xC0, 0xF1, 0x21, 0x41, 0x41, 0x50, 0xD0,
+        0xD0, 0xE1, 0x11, 0x21, 0x51, 0x51, 0x40, 0xE0, 0xE0, 0xF1, 0x21, 0x41, 0x51, 0x51, 0x50, 0xE1,
+        0x01, 0x11, 0x31, 0x41, 0x51, 0x51, 0x51, 0x01, 0x11, 0x41, 0x51, 0x51, 0x51, 0x51, 0x51, 0x21,
+        0x31, 0x41, 0x51, 0x51, 0x51, 0x51, 0x51, 0x41, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+        0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x00, 0xC0, 0xB1, 0x01, 0x41, 0x91, 0xB1, 0xC0, 0xD0,
+        0xD0, 0xE1, 0x21, 0x51, 0xC1, 0xC1, 0xB0, 0xE0, 0xD1, 0x01, 0x41, 0x91, 0xC1, 0xC1, 0xC0, 0xE1,
+        0x01, 0x31, 0x61, 0xB1, 0xD1, 0xD1, 0xC1, 0x11, 0x31, 0x91, 0xC1, 0xC1, 0xE1, 0xE1, 0xD1, 0x41,
+        0x81, 0xB1, 0xC1, 0xD1, 0xE1, 0xE1, 0xD1, 0xB1, 0xC1, 0xD1, 0xD1, 0xE1, 0xE1, 0xE1, 0xE1, 0xD1,
+        0xD1, 0xD1, 0xD1, 0xE1, 0xE1, 0xE1, 0xD1, 0x00, 0xB0, 0xA1, 0x01, 0x82, 0x83, 0x33, 0xD0, 0xC0,
+        0xC0, 0xE1, 0x31, 0xA3, 0xA3, 0xC3, 0x70, 0xE0, 0xD1, 0x01, 0x82, 0x83, 0x94, 0x53, 0x80, 0xE1,
+        0x11, 0x61, 0xD3, 0x35, 0x75, 0x03, 0xE1, 0x21, 0x62, 0x53, 0xA4, 0x46, 0xD6, 0x74, 0xD1, 0x82,
+        0x33, 0x74, 0x05, 0x16, 0x87, 0x15, 0xC3, 0x14, 0x04, 0xE5, 0x76, 0x77, 0x97, 0x86, 0x54, 0x85,
+        0xC5, 0xF6, 0x27, 0x06, 0x46, 0x76, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+        0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+        0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+        0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,
+        0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x21, 0x21, 0x51, 0x91, 0xA1, 0xA1, 0xA1, 0xA1, 0x21,
+        0x41, 0x61, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0x51, 0x61, 0x91, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0x91,
+        0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+        0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1,
+        0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0xA1, 0x11, 0x21, 0x61, 0xF2, 0x42, 0x42, 0x42, 0x41, 0x21,
+        0x41, 0x82, 0x22, 0x42, 0x42, 0x42, 0x41, 0x61, 0x82, 0x12, 0x42, 0x42, 0x42, 0x42, 0x41, 0xF2,
+        0x22, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+        0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+        0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x41, 0x11, 0x21, 0x82, 0xF6, 0x36, 0x36, 0x36, 0x31, 0x21,
+        0x51, 0xA4, 0x26, 0x36, 0x36, 0x36, 0x31, 0x81, 0xA3, 0x86, 0x36, 0x36, 0x36, 0x36, 0x32, 0xF4,
+        0x26, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+        0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+        0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x31, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+        0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+        0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+        0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,
+        0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x21, 0x21, 0x21, 0x51, 0x71, 0x81, 0x91, 0xB1, 0x21,
+        0x21, 0x51, 0x71, 0x81, 0x91, 0xB1, 0xC1, 0x21, 0x51, 0x71, 0x81, 0x91, 0xB1, 0xC1, 0xD1, 0x51,
+        0x71, 0x81, 0x91, 0xB1, 0xC1, 0xD1, 0xD1, 0x71, 0x81, 0x91, 0xB1, 0xC1, 0xD1, 0xD1, 0xD1, 0x81,
+        0x91, 0xB1, 0xC1, 0xD1, 0xD1, 0xD1, 0xE1, 0x91, 0xB1, 0xC1, 0xD1, 0xD1, 0xD1, 0xE1, 0xE1, 0xB1,
+        0xC1, 0xD1, 0xD1, 0xD1, 0xE1, 0xE1, 0xE1, 0x11, 0x11, 0x11, 0x41, 0x71, 0xA1, 0xC2, 0x01, 0x11,
+        0x11, 0x41, 0x71, 0xA1, 0xC2, 0x02, 0x21, 0x11, 0x41, 0x71, 0xA1, 0xC2, 0x02, 0x22, 0x51, 0x41,
+        0x71, 0xA1, 0xC2, 0x02, 0x22, 0x52, 0x51, 0x71, 0xA1, 0xC2, 0x02, 0x22, 0x52, 0x52, 0x51, 0xA1,
+        0xC2, 0x02, 0x22, 0x52, 0x52, 0x52, 0x91, 0xC2, 0x02, 0x22, 0x52, 0x52, 0x52, 0x92, 0xA2, 0x02,
+        0x22, 0x52, 0x52, 0x52, 0x92, 0xA2, 0xA1, 0x01, 0x01, 0x01, 0x41, 0x81, 0xC2, 0x02, 0x81, 0x01,
+        0x01, 0x41, 0x81, 0xC2, 0x02, 0x83, 0x01, 0x01, 0x41, 0x81, 0xC2, 0x02, 0x83, 0x04, 0x01, 0x41,
+        0x81, 0xC2, 0x02, 0x83, 0x04, 0x04, 0x01, 0x81, 0xC2, 0x02, 0x83, 0x04, 0x04, 0x04, 0x01, 0xC2,
+        0x02, 0x83, 0x04, 0x04, 0x04, 0x06, 0x02, 0x02, 0x83, 0x04, 0x04, 0x04, 0x06, 0x08, 0x02, 0x83,
+        0x04, 0x04, 0x04, 0x06, 0x08, 0x08, 0x00, 0x7C, 0x5E, 0x5C, 0x74, 0x7D, 0x5E, 0xDC, 0xEC, 0x3F,
+        0x2F, 0xAE, 0xB0, 0x1A, 0x66, 0x27, 0x7C, 0x85, 0x1B, 0xC1, 0xD5, 0x13, 0x7B, 0x72, 0xCC, 0x45,
+        0xBA, 0x8E, 0x37, 0xC0, 0x7E, 0xE5, 0x12, 0x44, 0xBD, 0xC1, 0xB1, 0x92, 0xFA, 0xD5, 0x52, 0x34,
+        0xCC, 0xAE, 0xC5, 0xD8, 0x84, 0x09, 0xC8, 0xC1, 0xED, 0x1D, 0x4C, 0x97, 0xCE, 0x61, 0xB5, 0xAB,
+        0x0D, 0x8C, 0xAA, 0x52, 0xBC, 0xFB, 0x77, 0x0F, 0xC9, 0x3B, 0x88, 0x69, 0x99, 0x5D, 0x8B, 0xB1,
+        0x04, 0x2F, 0x91, 0x47, 0x86, 0xAB, 0x50, 0x6C, 0x64, 0xBC, 0x7E, 0x72, 0xEE, 0x62, 0x57, 0x47,
+        0xB4, 0x79, 0x27, 0x09, 0xF7, 0x55, 0x48, 0x41, 0x8A, 0xE6, 0xA9, 0xF7, 0x55, 0x48, 0xAE, 0xC6,
+        0x82, 0x33, 0x94, 0xD2, 0x83, 0xDA, 0x3C, 0xEB, 0xB9, 0x21, 0xC0, 0xCA, 0xD6, 0x63, 0x6F, 0x9C,
+        0x3F, 0x8A, 0xF0, 0xBC, 0x12, 0xF3, 0xB7, 0xFC, 0x27, 0x1D, 0xA6, 0x1E, 0xD1, 0xE7, 0x52, 0x44,
+        0xC6, 0x02, 0xEA, 0xD6, 0x66, 0x53, 0x50, 0x6B, 0xBE, 0x19, 0x2D, 0x21, 0x47, 0xF6, 0x81, 0x7A,
+        0x14, 0xF1, 0xB1, 0xCC, 0xBB, 0x23, 0x40, 0xEE, 0x50, 0x7B, 0x47, 0x9D, 0x72, 0x9B, 0x6D, 0x77,
+        0xB0, 0x57, 0x05, 0x2A, 0x8C, 0x08, 0xBE, 0x24, 0xFF, 0x8B, 0x45, 0xAC, 0x72, 0x0F, 0xB8, 0x44,
+        0x3B, 0x9B, 0x5F, 0xEE, 0x21, 0x69, 0x1B, 0x0C, 0xC5, 0x95, 0xA0, 0x37, 0x4E, 0x4A, 0xE4, 0x50,
+        0xF7, 0x6F, 0x3A, 0x92, 0xF5, 0x54, 0x95, 0x08, 0xF3, 0x38, 0x4E, 0x95, 0xAC, 0xD8, 0x2E, 0x37,
+        0x8A, 0x11, 0x5D, 0x81, 0xA4, 0x81, 0xC9, 0xE2, 0x87, 0xBB, 0x75, 0xDF, 0xFF, 0x64, 0xC6, 0xF2,
+        0xD8, 0x29, 0x07, 0xB3, 0xC0, 0xB4, 0xEB, 0x3B, 0x8E, 0x2C, 0x56, 0x63, 0x0F, 0x80, 0xCA, 0x8E,
+        0x46, 0x8D, 0x44, 0xD2, 0xC9, 0xB5, 0xFF, 0xD4, 0xA5, 0xB9, 0xD9, 0x1C, 0x58, 0x7C, 0x1F, 0x27,
+        0x04, 0xD2, 0xC9, 0xB4, 0x78, 0x2D, 0xE0, 0x33, 0xEA, 0xE8, 0x16, 0x56, 0x04, 0x5A, 0x63, 0xC9,
+        0x95, 0xFF, 0xD4, 0xA5, 0xB9, 0x09, 0xAD, 0x1E, 0xBC, 0xEC, 0x06, 0xD4, 0x45, 0xFF, 0x03, 0xD8,
+        0xF9, 0x7D, 0x09, 0xB9, 0x84, 0xEC, 0xFA, 0x5B, 0x60, 0xAD, 0x70, 0x26, 0x96, 0x4D, 0x74, 0xC5,
+        0x01, 0xE6, 0x4E, 0xEF, 0x55, 0x48, 0x80, 0x24, 0xD7, 0xEB, 0xDC, 0xBD, 0x4E, 0x26, 0x97, 0x6A,
+        0x0D, 0xCE, 0xB3, 0x61, 0x12, 0xD4, 0x37, 0x0B, 0x2B, 0x0D, 0x3F, 0xC5, 0x1E, 0x47, 0x7E, 0x70,
+        0xAA, 0x92, 0x94, 0x05, 0xD1, 0x9D, 0x64, 0xC4, 0xA3, 0x5F, 0x85, 0x95, 0x8B, 0xC9, 0xC9, 0xA5,
+        0xDA, 0x47, 0x9D, 0xB8, 0x73, 0x10, 0x87, 0x71, 0xEE, 0x6C, 0x1F, 0xE9, 0x6D, 0x45, 0x28, 0x08,
+        0xAE, 0x70, 0xC5, 0xEB, 0x59, 0x45, 0x95, 0x8F, 0x24, 0x5F, 0xDB, 0x77, 0x21, 0x36, 0xD4, 0x7D,
+        0x98, 0x8C, 0xC3, 0xA1, 0x3F, 0xFA, 0x64, 0xB6, 0x1A, 0x8A, 0x50, 0x23, 0x84, 0x59, 0x59, 0xBA,
+        0xF3, 0xED, 0x49, 0xE6, 0x7E, 0xDA, 0x84, 0x44, 0xB9, 0xB0, 0xE8, 0x5A, 0x64, 0xF7, 0x4E, 0x0B,
+        0x98, 0xF8, 0x91, 0xCF, 0x75, 0x15, 0x52, 0x2C, 0xAC, 0x5F, 0x28, 0x7D, 0xEF, 0x80, 0xDA, 0x89,
+        0xFF, 0xD7, 0xA6, 0x78, 0x46, 0x22, 0x90, 0x65, 0xC3, 0x14, 0xDC, 0xDA, 0x2E, 0x3B, 0xD3, 0x78,
+        0x60, 0x0B, 0xEB, 0x59, 0xA8, 0x80, 0xEA, 0x1E, 0x1B, 0x7C, 0xBA, 0xA1, 0x4E, 0x2B, 0x5B, 0x9E,
+        0x72, 0x76, 0x88, 0xF4, 0x95, 0x44, 0xD2, 0x47, 0xF9, 0xA6, 0x46, 0x13, 0xE6, 0x17, 0xCE, 0xAE,
+        0xC0, 0x87, 0xF3, 0xA7, 0x71, 0x6D, 0x8A, 0xE7, 0xD0, 0x0A, 0x6A, 0x69, 0x68, 0x70, 0xE5, 0x18,
+        0x4D, 0x2B, 0xDA, 0x24, 0xF3, 0x5C, 0x8C, 0x37, 0xCC, 0x1A, 0xB9, 0x86, 0xF6, 0x93, 0x95, 0xD8,
+        0xC6, 0xE0, 0x23, 0xDB, 0xF7, 0x07, 0x71, 0x02, 0x67, 0xB4, 0x4B, 0x27, 0x9D, 0x54, 0xA7, 0x33,
+        0x27, 0xD0, 0x2D, 0x61, 0xB8, 0x0F, 0x3B, 0x36, 0x0A, 0x26, 0xF6, 0x59, 0x22, 0x6B, 0x0D, 0xED,
+        0xE7, 0x2B, 0xC5, 0x66, 0x60, 0xE5, 0xD4, 0x7A, 0x64, 0xB8, 0xFF, 0x8F, 0x8A, 0xA9, 0x5A, 0xC2,
+        0x00, 0xFA, 0xF6, 0x30, 0x13, 0xE4, 0xDC, 0x6B, 0xDA, 0x2E, 0x9C, 0xC2, 0x2C, 0xAD, 0x73, 0x01,
+        0xE1, 0x2B, 0x62, 0x89, 0xBD, 0x92, 0x3D, 0x0B, 0x59, 0xBF, 0xE1, 0x55, 0x22, 0x97, 0xC4, 0x6F,
+        0x3B, 0xFC, 0x9D, 0xC6, 0x68, 0x2C, 0x15, 0xDC, 0xDD, 0x80, 0x6A, 0x4C, 0x6D, 0x47, 0xB2, 0xC9,
+        0x13, 0x4E, 0x8B, 0x59, 0x39, 0x84, 0xC6, 0xFA, 0x85, 0x54, 0x8C, 0xB9, 0x3A, 0xCE, 0x13, 0xFC,
+        0x6E, 0x0E, 0x11, 0x84, 0xC5, 0x0D, 0xB5, 0xF6, 0x5D, 0x3B, 0xB1, 0x5D, 0xA4, 0x1B, 0x97, 0xCE,
+        0x12, 0x79, 0x16, 0x1F, 0x08, 0x2A, 0x52, 0x46, 0xEF, 0x0B, 0x43, 0xF6, 0x29, 0x3C, 0xAD, 0x63,
+        0x89, 0xC7, 0x2E, 0xA2, 0x43, 0x73, 0x70, 0xCC, 0x1A, 0x50, 0xDB, 0x5F, 0x66, 0x97, 0x2B, 0xFE,
+        0x14, 0xB8, 0x9C, 0x62, 0xCD, 0xA2, 0x24, 0x64, 0x84, 0xD2, 0xED, 0xAD, 0xC7, 0x37, 0x9D, 0xFB,
+        0xE0, 0xFA, 0xD5, 0x95, 0x82, 0x88, 0x70, 0xFF, 0x71, 0x97, 0x50, 0x54, 0x2A, 0xA4, 0x3B, 0x68,
+        0x09, 0xA5, 0xDA, 0x4D, 0x68, 0xE6, 0xE1, 0x9C, 0x37, 0xC0, 0x3E, 0xB4, 0xFC, 0xF5, 0x1C, 0x5D,
+        0x58, 0x56, 0x79, 0x84, 0xED, 0xCC, 0xB1, 0xE0, 0x52, 0x22, 0x50, 0x0D, 0xA6, 0x97, 0x59, 0x34,
+        0x85, 0x7F, 0x47, 0x07, 0xB9, 0x78, 0xB4, 0xC3, 0xBE, 0x47, 0xD6, 0x2B, 0x31, 0x67, 0x1F, 0xE4,
+        0x09, 0xEE, 0x6F, 0x50, 0x59, 0x5D, 0x4A, 0x77, 0x09, 0xEE, 0x23, 0x04, 0xCD, 0xB5, 0x97, 0x49,
+        0x32, 0x85, 0xC1, 0x7F, 0xBE, 0x0E, 0x85, 0x19, 0xE1, 0xDA, 0xDF, 0x8E, 0x4C, 0x62, 0xFE, 0x01,
+        0x55, 0x27, 0x22, 0x4C, 0x98, 0x63, 0xE4, 0x06, 0xEE, 0x0F, 0x62, 0xB4, 0x75, 0xF2, 0x17, 0x73,
+        0x88, 0xCA, 0x01, 0xB6, 0xB3, 0x69, 0x2E, 0x77, 0xAE, 0xFD, 0x65, 0x62, 0xAA, 0x48, 0x56, 0xBD,
+        0x9F, 0x72, 0x07, 0x0F, 0xA3, 0x1E, 0x2E, 0xFD, 0x65, 0x67, 0x45, 0xF2, 0x76, 0xE4, 0x61, 0x88,
+        0x34, 0x6D, 0xAC, 0xD9, 0xCA, 0xA3, 0x28, 0x85, 0x54, 0xB7, 0x01, 0x9B, 0x46, 0xDA, 0xE5, 0x8C,
+        0xB7, 0x7D, 0x09, 0x03, 0x87, 0x85, 0xEC, 0x14, 0x4D, 0xF8, 0x8A, 0xC5, 0x69, 0x3B, 0x3A, 0x5A,
+        0xF6, 0x74, 0x7C, 0x88, 0x2A, 0x52, 0xE0, 0x7A, 0x31, 0x1B, 0x6A, 0xC9, 0xA6, 0x74, 0x61, 0x7F,
+        0x76, 0x1B, 0xA1, 0x56, 0xB5, 0x3D, 0xC4, 0x68, 0xBA, 0x1E, 0x4B, 0x20, 0x9B, 0xFF, 0xB9, 0x07,
+        0x0F, 0x35, 0xDD, 0x3D, 0xE6, 0x27, 0x24, 0x4D, 0xA8, 0x86, 0x06, 0x75, 0x8B, 0x29, 0x55, 0x91,
+        0x73, 0x43, 0xA7, 0x61, 0x34, 0xB2, 0x7B, 0x1F, 0xE7, 0xD8, 0x5A, 0x1F, 0x10, 0xF9, 0xC3, 0x1B,
+        0xCC, 0xB7, 0x3F, 0x3B, 0x47, 0xAF, 0x33, 0x8B, 0x2B, 0x5C, 0x68, 0xE9, 0x10, 0x26, 0x97, 0x69,
+        0x3D, 0xA3, 0x02, 0x9A, 0x8C, 0xE0, 0xB4, 0x5A, 0xBE, 0x03, 0xE7, 0x1F, 0xB7, 0x9C, 0x0D, 0x14,
+        0x12, 0x12, 0xB6, 0x9B, 0x5F, 0x7C, 0xC2, 0xE0, 0x47, 0x17, 0x7C, 0xE5, 0x59, 0x65, 0x4A, 0x58,
+        0xB3, 0x75, 0x08, 0x7C, 0xCB, 0x0A, 0x55, 0x1F, 0xBA, 0x86, 0x01, 0x73, 0x1E, 0x1B, 0xD6, 0x59,
+        0x69, 0x78, 0x12, 0xA6, 0x6D, 0xAC, 0x9A, 0x47, 0x9F, 0x27, 0x8E, 0xD1, 0x3D, 0xA2, 0x70, 0xFA,
+        0xEA, 0x55, 0x1C, 0xB2, 0x0D, 0x12, 0xA6, 0x6D, 0xAC, 0x9E, 0xC6, 0xFE, 0xF0, 0x76, 0x89, 0x46,
+        0x7E, 0x1D, 0x61, 0xC2, 0xDB, 0x0A, 0xE0, 0x6E, 0x63, 0x0C, 0xE2, 0x07, 0xCF, 0xF9, 0x53, 0x50,
+        0xB5, 0x0C, 0xE3, 0xB3, 0xDA, 0x06, 0x63, 0x49, 0x9B, 0x6B, 0x2C, 0x99, 0x3A, 0xBE, 0xB2, 0xC5,
+        0xDE, 0x1C, 0x18, 0xE0, 0x8A, 0x3D, 0xC6, 0xE4, 0xFF, 0xAE, 0xE5, 0x05, 0x45, 0x20, 0x64, 0x36,
+        0xD5, 0x33, 0x4C, 0xE5, 0xA1, 0x8E, 0x1D, 0xBA, 0x8A, 0xB2, 0xC4, 0x3F, 0x1E, 0x23, 0x3D, 0x92,
+        0xF7, 0x16, 0x8D, 0xD0, 0xAD, 0x17, 0xA8, 0x19, 0x34, 0xCC, 0xDB, 0x5C, 0x58, 0x4D, 0x3F, 0x68,
+        0x15, 0xD8, 0x53, 0x50, 0x8B, 0xE3, 0xA9, 0x39, 0x1F, 0x92, 0xFB, 0x74, 0x6F, 0x38, 0x15, 0x52,
+        0x3A, 0xBF, 0x84, 0xE6, 0x18, 0xF2, 0x3E, 0xB4, 0x21, 0xA3, 0xBF, 0xD0, 0x0C, 0xD1, 0x06, 0xDA,
+        0xA4, 0x4D, 0x2E, 0x91, 0xE5, 0xE9, 0x65, 0x65, 0xDE, 0x6E, 0x29, 0xDC, 0xF3, 0x85, 0xBF, 0x01,
+        0x16, 0x50, 0xDD, 0x01, 0xCA, 0xF0, 0x90, 0x4D, 0x2B, 0x6D, 0x74, 0xCE, 0x3C, 0x1F, 0xBB, 0x63,
+        0x41, 0x65, 0x64, 0xEF, 0x7A, 0xA8, 0x52, 0xF8, 0x62, 0x48, 0x36, 0xD5, 0x2B, 0x49, 0xB3, 0xCA,
+        0x88, 0x5B, 0xB8, 0x75, 0xE8, 0x7E, 0x61, 0x1A, 0x2B, 0xFC, 0x57, 0x60, 0x9F, 0x95, 0xAB, 0xBB,
+        0x41, 0x50, 0xDE, 0xA5, 0x30, 0x07, 0x6B, 0xA2, 0xE0, 0xB7, 0xA7, 0xDE, 0x88, 0x4B, 0xC9, 0x0C,
+        0xCD, 0xB5, 0x4A, 0xD2, 0x6C, 0x98, 0xE1, 0xFF, 0x87, 0x29, 0xD4, 0x46, 0xB2, 0xB1, 0xBD, 0x4A,
+        0x50, 0xF0, 0x11, 0xF4, 0x24, 0x5E, 0xC1, 0x8B, 0x21, 0xB6, 0xA9, 0x9A, 0x67, 0x2F, 0xFE, 0xC0,
+        0x39, 0x4E, 0xBA, 0x82, 0xDF, 0xAB, 0x78, 0xB1, 0x17, 0x63, 0xCA, 0x55, 0x38, 0x24, 0x2F, 0x4A,
+        0xC0, 0x6D, 0xA9, 0x94, 0xCD, 0x33, 0xC6, 0xE4, 0xF6, 0x88, 0x51, 0x73, 0x00, 0xF5, 0xF2, 0x8F,
+        0xD6, 0x56, 0x46, 0xEF, 0xAD, 0xC7, 0x95, 0x29, 0x16, 0xFD, 0x23, 0x9F, 0x48, 0x10, 0xAC, 0xAC,
+        0x8C, 0x17, 0x93, 0x32, 0x69, 0x9B, 0x03, 0x6D, 0x71, 0xBB, 0xFE, 0xA2, 0x1D, 0xA7, 0x4B, 0x47,
+        0x1B, 0x88, 0xCE, 0x42, 0xE9, 0x8B, 0xCC, 0x19, 0x62, 0x69, 0x9B, 0x6D, 0x68, 0xB7, 0xD9, 0x15,
+        0x40, 0x52, 0x3A, 0xEE, 0xC5, 0x69, 0x49, 0xFF, 0xF8, 0x85, 0xC4, 0x4D, 0xFC, 0x14, 0x8F, 0x61,
+        0x34, 0xA3, 0xA8, 0x09, 0xD8, 0x70, 0x7F, 0x97, 0xC3, 0x7B, 0x8C, 0x59, 0xF3, 0x59, 0x60, 0x44,
+        0x48, 0x4A, 0xDA, 0x6D, 0x63, 0xEF, 0xCB, 0xD6, 0xD4, 0x2A, 0xA4, 0xB8, 0xCB, 0xBF, 0x02, 0x30,
+        0x4D, 0x2B, 0x6D, 0x74, 0x93, 0x34, 0x54, 0x5F, 0xF0, 0x7E, 0xEB, 0xD7, 0x0C, 0x31, 0x41, 0xB9,
+        0x6D, 0x8A, 0xC8, 0x79, 0x9C, 0x55, 0x48, 0x46, 0x48, 0x4A, 0x69, 0x33, 0x6D, 0x73, 0xA2, 0xF7,
+        0x2C, 0x70, 0x21, 0xF3, 0xE0, 0x76, 0xCA, 0x2F, 0xED, 0x1E, 0xF5, 0xC6, 0xE2, 0x7B, 0xAC, 0x57,
+        0x00, 0x0A, 0x31, 0xBF, 0xF4, 0xFC, 0xC0, 0xA6, 0xA1, 0x6A, 0xEF, 0x01, 0x20, 0xCC, 0xD2, 0x66,
+        0xDA, 0xCB, 0x96, 0x11, 0x23, 0xEE, 0xC2, 0xB4, 0x2F, 0x7A, 0x38, 0xFB, 0x71, 0xB9, 0xD0, 0xC4,
+        0xC9, 0x31, 0xA6, 0x6D, 0xB5, 0x95, 0x46, 0x09, 0x2F, 0x47, 0xCA, 0x9A, 0x88, 0x0F, 0x3E, 0xAC,
+        0xB0, 0x9F, 0xB7, 0xB7, 0x16, 0xF0, 0x7F, 0x14, 0x23, 0x71, 0x3C, 0x9F, 0x39, 0x89, 0x55, 0x24,
+        0x08, 0x4F, 0x7F, 0xB4, 0xB2, 0xB1, 0xDF, 0x51, 0xB8, 0x0A, 0x03, 0x6D, 0x59, 0x34, 0xCF, 0x16,
+        0x13, 0x2F, 0x96, 0xEF, 0x06, 0xE3, 0xF4, 0xEB, 0x81, 0xA6, 0x6D, 0xB5, 0x30, 0xA1, 0x96, 0x37,
+        0xCD, 0x24, 0x68, 0x0E, 0x4F, 0x65, 0xFA, 0x12, 0xAA, 0x44, 0x4F, 0x2D, 0xAD, 0x61, 0xDF, 0x5C,
+        0x08, 0x12, 0x38, 0x94, 0x85, 0xC9, 0xD7, 0xFD, 0xEE, 0x55, 0x49, 0x65, 0x64, 0x42, 0x73, 0xE1,
+        0xB6, 0xAA, 0x18, 0x5E, 0xB8, 0xCB, 0x16, 0x99, 0xFB, 0x33, 0xCB, 0x63, 0x07, 0x5E, 0xF1, 0x4A,
+        0xA7, 0xD6, 0x82, 0x80, 0x36, 0xD5, 0x2B, 0x49, 0xA4, 0xCE, 0x3C, 0x79, 0x21, 0xBE, 0xE4, 0x0F,
+        0xDD, 0xB0, 0x65, 0x10, 0x9F, 0xCB, 0x15, 0xEE, 0x29, 0xA9, 0x03, 0x87, 0x50, 0x8F, 0x13, 0xF2,
+        0xAE, 0xC0, 0x5F, 0x1D, 0xDF, 0x2D, 0x50, 0x60, 0x48, 0x25, 0x69, 0x31, 0xB6, 0xB9, 0xE5, 0x8C,
+        0x4D, 0xDE, 0xBB, 0xFC, 0x53, 0x50, 0xEF, 0xE7, 0x56, 0xC0, 0x3D, 0x23, 0x8B, 0x95, 0x95, 0x9E,
+        0x6E, 0x42, 0xFC, 0xBD, 0x23, 0x06, 0x23, 0x6D, 0x65, 0x26, 0x69, 0x9E, 0x57, 0x13, 0xD1, 0xC0,
+        0x59, 0x59, 0x17, 0x50, 0xA9, 0xA8, 0x23, 0x7C, 0xB8, 0xBC, 0x32, 0x99, 0xA6, 0x72, 0x8D, 0xB5,
+        0xC7, 0x09, 0x1C, 0xAD, 0xA2, 0x03, 0xCD, 0xDE, 0x8F, 0xE7, 0xEF, 0x80, 0x8D, 0xCA, 0x47, 0xD3,
+        0xFA, 0xAA, 0x91, 0xBF, 0x90, 0x10, 0x94, 0x77, 0x11, 0xC5, 0x8A, 0xC2, 0xE4, 0xAB, 0xC6, 0x99,
+        0xB6, 0xD4, 0xC2, 0x66, 0x58, 0xFF, 0x6F, 0x41, 0xBC, 0x5E, 0x82, 0xD7, 0xFF, 0x77, 0xC7, 0x85,
+        0x95, 0x82, 0x55, 0xC3, 0x2C, 0x5A, 0x66, 0x6D, 0xAA, 0x66, 0x17, 0xCF, 0x47, 0x29, 0x3A, 0x20,
+        0x47, 0x0A, 0xAA, 0x4A, 0x51, 0x9B, 0xBB, 0xEA, 0x22, 0x02, 0x47, 0x16, 0x15, 0xB9, 0x25, 0x0B,
+        0xA6, 0x61, 0x7F, 0xE3, 0x6D, 0x4C, 0xB1, 0x69, 0x9F, 0xCA, 0x16, 0xCF, 0xE1, 0xEC, 0x35, 0x15,
+        0x52, 0x80, 0x8C, 0x59, 0x58, 0xE3, 0x7E, 0xC9, 0x5C, 0x89, 0x94, 0x4E, 0x6D, 0xAB, 0xFF, 0x86,
+        0x58, 0xB4, 0xCC, 0xBA, 0xD6, 0x17, 0xF5, 0xE9, 0x13, 0xC9, 0x21, 0x10, 0x3C, 0xB5, 0x4D, 0x41,
+        0x0D, 0xCE, 0x7F, 0x27, 0x30, 0x24, 0x13, 0x34, 0xCC, 0xDB, 0x59, 0x72, 0xC7, 0xBB, 0x0A, 0xF7,
+        0x0A, 0x23, 0x45, 0x7F, 0xCE, 0x1D, 0x7A, 0x0E, 0xBF, 0x4E, 0x48, 0x0D, 0xB5, 0x32, 0x99, 0xA6,
+        0x72, 0xB1, 0xC2, 0xFB, 0xAA, 0x53, 0x00, 0xF1, 0xCF, 0xC2, 0x88, 0xAD, 0xDC, 0xB1, 0xC7, 0xAA,
+        0xCE, 0xE3, 0x84, 0x53, 0x51, 0x0F, 0xA5, 0xBC, 0xF8, 0x40, 0x46, 0xA1, 0x21, 0x28, 0x69, 0x9B,
+        0x6D, 0x4C, 0x26, 0x65, 0x8D, 0xF7, 0x6E, 0x1F, 0xF7, 0xC5, 0x8A, 0xC9, 0xFE, 0x75, 0x10, 0x46,
+        0x01, 0x96, 0x2D, 0x33, 0x36, 0xD5, 0x33, 0x0B, 0xEE, 0x97, 0xF4, 0xFF, 0x72, 0xB2, 0xB5, 0x35,
+        0x08, 0x7C, 0x80, 0xDD, 0x12, 0x45, 0x16, 0xBD, 0x70, 0xEB, 0xB1, 0xE9, 0xC9, 0x42, 0xD3, 0xF9,
+        0x83, 0x2C, 0x5A, 0x66, 0x6D, 0xAA, 0xE6, 0x17, 0xCF, 0xDE, 0xE8, 0x2A, 0x29, 0x78, 0xE2, 0xC2,
+        0x35, 0x6E, 0x92, 0xFC, 0x85, 0x14, 0x83, 0x78, 0xC9, 0x21, 0x88, 0x80, 0x70, 0x3A, 0x0C, 0x70,
+        0x67, 0x91, 0x6C, 0xEB, 0xEE, 0x4C, 0xF8, 0xD7, 0x47, 0xFB, 0x72, 0xA3, 0xBF, 0x4B, 0x2B, 0x79,
+        0x2A, 0xAA, 0x46, 0xF1, 0x92, 0x43, 0x11, 0x00, 0xE0, 0x74, 0x18, 0xE0, 0xCF, 0x22, 0xD9, 0xD7,
+        0xDC, 0x99, 0xF1, 0xAE, 0x8F, 0xF6, 0xE5, 0x47, 0x7E, 0x96, 0x56, 0xF2, 0x55, 0x54, 0x8D, 0xE3,
+        0x24, 0x86, 0x22, 0x01, 0xC0, 0xE8, 0x31, 0xC1, 0x9E, 0x45, 0xB3, 0xAF, 0xB9, 0x33, 0xE3, 0x5D,
+        0x1F, 0xED, 0xCA, 0x8E, 0xFD, 0x2C, 0xAD, 0xE4, 0xAA, 0xA9, 0x15, 0x52, 0x70, 0x9F, 0xA8, 0x01,
+        0x12, 0xF0, 0x4C, 0xD3, 0x33, 0x6D, 0x65, 0xCA, 0x46, 0x38, 0x43, 0xE2, 0xCA, 0xC5, 0xBC, 0xBE,
+        0xF4, 0x5D, 0xD9, 0x1D, 0x1F, 0xEE, 0x0B, 0x63, 0x86, 0xA5, 0x2F, 0x5C, 0xBF, 0xA0, 0x59, 0x5C,
+        0x07, 0x9B, 0x85, 0xC9, 0x0C, 0x18, 0x8C, 0xA6, 0x69, 0x99, 0xB6, 0xB2, 0xDF, 0x3F, 0x07, 0x7F,
+        0x22, 0xE8, 0x0F, 0xE7, 0xE7, 0xCA, 0x55, 0x2C, 0xAC, 0x1F, 0x51, 0x17, 0xAD, 0xE1, 0x40, 0x70,
+        0x48, 0x5E, 0x94, 0x69, 0x9B, 0x6D, 0x49, 0x99, 0x63, 0x85, 0xDD, 0xA3, 0x5B, 0xD0, 0x59, 0x59,
+        0xCA, 0xD7, 0xD3, 0xF8, 0x46, 0xE1, 0x27, 0x6D, 0xFD, 0x20, 0x42, 0x74, 0x7E, 0x94, 0x30, 0x99,
+        0x96, 0x2B, 0xCD, 0x33, 0x6D, 0xAD, 0xD4, 0x44, 0xA6, 0xA2, 0x93, 0xC8, 0x81, 0xF4, 0xF4, 0x76,
+        0xE3, 0x9F, 0x42, 0xBB, 0x23, 0x80, 0x6E, 0x2D, 0x3F, 0x19, 0x62, 0xD3, 0x32, 0x66, 0x17, 0x9B,
+        0x6B, 0x74, 0xBD, 0x49, 0x0D, 0x42, 0x14, 0x4F, 0x56, 0x57, 0x4A, 0xA4, 0x03, 0x79, 0x1E, 0x01,
+        0xF2, 0x65, 0xF7, 0x4E, 0xB4, 0x6B, 0xA3, 0xFD, 0x8C, 0x70, 0x67, 0x94, 0xBC, 0xBB, 0x70, 0xA3,
+        0xA8, 0xC8, 0x10, 0xA3, 0x24, 0x09, 0x45, 0xD6, 0xB0, 0xBC, 0x99, 0x44, 0xE7, 0x7D, 0x3F, 0xFA,
+        0xC5, 0x60, 0xDB, 0x57, 0x3C, 0x19, 0x62, 0xD3, 0x3D, 0xFD, 0xF2, 0x25, 0x54, 0x95, 0x52, 0x80,
+        0x8C, 0x59, 0x58, 0xE3, 0x7E, 0xC9, 0x5C, 0x89, 0x94, 0x4E, 0x6D, 0xAB, 0xFF, 0x86, 0x58, 0xB4,
+        0xCC, 0xBA, 0xD6, 0x17, 0xF5, 0xE9, 0x13, 0xC9, 0x21, 0x4F, 0x67, 0x67, 0x53, 0x00, 0x04, 0x45,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6E,
+        0xA3, 0xFC, 0x28, 0x06, 0x41, 0x32, 0x4D, 0x56, 0x4D, 0x34, 0x0A, 0x00, 0x1C, 0xA4, 0x90, 0x32,
+        0x07, 0x6C, 0x88, 0xEE, 0x60, 0x24, 0x7C, 0x88, 0x63, 0x18, 0xD8, 0x1B, 0xF1, 0x35, 0xEA, 0x22,
+        0x27, 0x38, 0xDF, 0x29, 0xAA, 0xAC, 0xF9, 0xE0, 0x0F, 0xDC, 0xD4, 0x03, 0x15, 0x65, 0xEC, 0xB3,
+        0x8D, 0x0C, 0x9C, 0xB9, 0x65, 0xD9, 0xE0, 0xAD, 0xDB, 0x9B, 0x33, 0xC0, 0xD1, 0x2A, 0x1D, 0xEA,
+        0x2D, 0xE8, 0x51, 0x04, 0x6F, 0xDB, 0x5F, 0x76, 0xD0, 0xE9, 0x80, 0x4A, 0x2E, 0xF5, 0xD5, 0x2B,
+        0x03, 0x5A, 0x6F, 0x6B, 0x78, 0xD8, 0xC5, 0xE6, 0x33, 0x06, 0x0B, 0x21, 0x3B, 0xB4, 0x18, 0xA5,
+        0x16, 0xFA, 0xD7, 0x13, 0xDA, 0x37, 0xF0, 0xB1, 0x39, 0x0B, 0xCB, 0x6D, 0xDC, 0x80, 0x85, 0x2D,
+        0xE2, 0xDB, 0x5B, 0x9E, 0x60, 0x68, 0x13, 0x6D, 0x51, 0x22, 0x71, 0x9A, 0x00, 0x4A, 0x2E, 0xF4,
+        0x55, 0x20, 0x64, 0xE0, 0x44, 0xBF, 0x19, 0x05, 0xD4, 0x11, 0x8A, 0x1C, 0x41, 0x7F, 0xE5, 0x90,
+        0x63, 0x4C, 0x44, 0xDE, 0x49, 0xC8, 0x2F, 0x99, 0x85, 0xD5, 0x5A, 0xF8, 0x52, 0x2C, 0xFC, 0xFE,
+        0xE0, 0x4B, 0x54, 0x3B, 0x57, 0xF5, 0xAC, 0x96, 0x36, 0xDB, 0x4A, 0xC5, 0x3F, 0x6F, 0x19, 0xE4,
+        0xC8, 0xC5, 0x99, 0x77, 0x3D, 0xFE, 0x2E, 0x23, 0xEE, 0x9A, 0x74, 0xFC, 0xC5, 0xCC, 0xBA, 0x7B,
+        0x9D, 0x3D, 0x2C, 0x5E, 0x5C, 0x6D, 0xBA, 0xFB, 0x14, 0xE8, 0x4A, 0x2E, 0xFE, 0x56, 0x0B, 0x05,
+        0x82, 0xC0, 0x06, 0x9C, 0x0D, 0x02, 0x1B, 0xAA, 0x33, 0x41, 0xF2, 0x97, 0xD8, 0xF8, 0xF7, 0x9A,
+        0xF9, 0x90, 0x68, 0x25, 0xAB, 0x72, 0x9B, 0x39, 0xE0, 0xC1, 0x92, 0x6D, 0xD8, 0xD8, 0xC2, 0x92,
+        0x21, 0xA0, 0xAD, 0x02, 0x1A, 0xD7, 0x4A, 0x28, 0x3C, 0x6C, 0x8B, 0xF0, 0x04, 0x05, 0xC1, 0x0B,
+        0xDF, 0xA1, 0x76, 0x00, 0xE8, 0x2A, 0xF5, 0x67, 0xA1, 0xD1, 0x28, 0xBB, 0xA0, 0x90, 0xA8, 0xC3,
+        0xA2, 0xBA, 0xA9, 0x17, 0xA1, 0x5F, 0x50, 0x5A, 0x35, 0xC2, 0xBD, 0x99, 0x07, 0x39, 0xEB, 0xD0,
+        0x4A, 0x2E, 0xF2, 0x96, 0x03, 0x4C, 0x47, 0x0E, 0x2C, 0x8C, 0xEC, 0x0C, 0x08, 0x6C, 0x45, 0x23,
+        0xB1, 0x18, 0xE6, 0x7C, 0x37, 0x69, 0xEF, 0x38, 0x18, 0x7D, 0x83, 0xB4, 0x0C, 0x78, 0x2D, 0x92,
+        0xD9, 0xC9, 0xE5, 0xBC, 0x5E, 0xD7, 0xD5, 0xC2, 0x0E, 0xE1, 0xAB, 0x74, 0x33, 0x0C, 0xF3, 0x07,
+        0x3E, 0xEA, 0xD0, 0xA7, 0x51, 0x48, 0xC2, 0x39, 0xAC, 0x6A, 0x08, 0x2E, 0xF8, 0x23, 0x81, 0xE2,
+        0xB0, 0xF1, 0x0D, 0x2B, 0x69, 0x4C, 0x25, 0x28, 0x52, 0xAE, 0x09, 0x3F, 0x20, 0x4A, 0x2E, 0xFC,
+        0x9F, 0x46, 0xC1, 0x8C, 0xAC, 0xE8, 0xC4, 0x9F, 0x50, 0x58, 0xA9, 0xC9, 0x96, 0x1A, 0xEC, 0xB6,
+        0xEC, 0x19, 0x41, 0xF1, 0x58, 0xBE, 0xA8, 0x9B, 0x7C, 0x6A, 0x40, 0xCE, 0xE3, 0xD8, 0x93, 0x6E,
+        0x34, 0x5C, 0x2A, 0xE5, 0x96, 0xC3, 0x8F, 0x63, 0x49, 0xA1, 0xED, 0xED, 0xEC, 0xC4, 0xAC, 0x91,
+        0x38,
+    };
+
+    inline constexpr int32_t TinyTheoraClipFrames = 6;
+    inline constexpr int32_t TinyTheoraClipFramesPerSecond = 24;
+
+    // FNV-1a 64 over the r, g, b, a bytes of every converted frame, recorded from the per-pixel float converter the
+    // clip player used before the vectorized one
+    inline constexpr array<uint64_t, TinyTheoraClipFrames> TinyTheoraClipFrameHashes = {
+        0xFBD56E9CEA69451CULL,
+        0x91DB20AAD50EAAC3ULL,
+        0xFA66FD7CCD2438BFULL,
+        0x66B44FA4141F38D3ULL,
+        0x0BE1155D5E432C40ULL,
+        0x0D4C6AAA5AB2F3C7ULL,
+    };
+}
+
+FO_END_NAMESPACE
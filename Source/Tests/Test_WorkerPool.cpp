@@ -33,6 +33,8 @@
 
 #include "catch_amalgamated.hpp"
 
+#include "Entity.h"
+#include "LatencyStats.h"
 #include "WorkerPool.h"
 
 FO_BEGIN_NAMESPACE
@@ -712,4 +714,335 @@ TEST_CASE("WorkerPoolDiagnostics")
     }
 }
 
+// ============================================================================
+// WorkerPool — map affinity
+// ============================================================================
+
+TEST_CASE("WorkerPoolAffinity")
+{
+    SECTION("SameAffinityRunsOnOneWorker")
+    {
+        std::atomic<bool> shutdown_flag {false};
+        WorkerPool pool {"test", 4, &shutdown_flag, true};
+        pool.EnableAffinityScheduling(std::chrono::seconds {10});
+
+        mutex threads_locker;
+        map<size_t, vector<std::thread::id>> threads_by_affinity;
+
+        for (size_t i = 0; i < 32; i++) {
+            size_t affinity = i % 4;
+
+            pool.Submit(WorkerJobKey {WorkerJobType::CritterMovement, i + 1}, timespan::zero, [&, affinity]() -> std::optional<timespan> {
+                scoped_lock locker {threads_locker};
+                vec_add_unique_value(threads_by_affinity[affinity], std::this_thread::get_id());
+                return std::nullopt;
+            }, affinity);
+        }
+
+        pool.Resume();
+        pool.WaitIdle();
+
+        scoped_lock locker {threads_locker};
+        REQUIRE(threads_by_affinity.size() == 4);
+
+        vector<std::thread::id> distinct_threads;
+
+        for (const auto& [affinity, threads] : threads_by_affinity) {
+            CHECK(threads.size() == 1);
+            vec_add_unique_value(distinct_threads, threads.front());
+        }
+
+        CHECK(distinct_threads.size() == 4);
+        CHECK(pool.GetDiagnostics().StolenJobs == 0);
+        CHECK(pool.GetDiagnostics().AffinityKeys == 0);
+    }
+
+    SECTION("BusyHomeWorkerGetsStolenFrom")
+    {
+        std::atomic<bool> shutdown_flag {false};
+        std::atomic<bool> release_blocker {false};
+        std::atomic<bool> blocker_started {false};
+        std::atomic<std::thread::id> blocker_thread {};
+        std::atomic<std::thread::id> stolen_thread {};
+        WorkerPool pool {"test", 2, &shutdown_flag};
+        pool.EnableAffinityScheduling(std::chrono::milliseconds {1});
+
+        pool.Submit(WorkerJobKey {WorkerJobType::CritterMovement, 1}, timespan::zero, [&]() -> std::optional<timespan> {
+            blocker_thread = std::this_thread::get_id();
+            blocker_started = true;
+
+            while (!release_blocker.load()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds {1});
+            }
+
+            return std::nullopt;
+        }, 0);
+
+        REQUIRE(WaitFor([&] { return blocker_started.load(); }));
+
+        pool.Submit(WorkerJobKey {WorkerJobType::CritterMovement, 2}, timespan::zero, [&]() -> std::optional<timespan> {
+            stolen_thread = std::this_thread::get_id();
+            return std::nullopt;
+        }, 2);
+
+        REQUIRE(WaitFor([&] { return stolen_thread.load() != std::thread::id {}; }));
+        release_blocker = true;
+        pool.WaitIdle();
+
+        CHECK(stolen_thread.load() != blocker_thread.load());
+        CHECK(pool.GetDiagnostics().StolenJobs == 1);
+    }
+
+    SECTION("SetKeyAffinityRequiresActiveKey")
+    {
+        std::atomic<bool> shutdown_flag {false};
+        WorkerPool pool {"test", 2, &shutdown_flag, true};
+        pool.EnableAffinityScheduling(std::chrono::milliseconds {1});
+
+        WorkerJobKey key {WorkerJobType::Player, 7};
+        CHECK_FALSE(pool.SetKeyAffinity(key, 1));
+
+        pool.Submit(key, []() -> std::optional<timespan> { return std::nullopt; });
+        CHECK(pool.SetKeyAffinity(key, 1));
+        CHECK(pool.GetDiagnostics().AffinityKeys == 1);
+
+        CHECK(pool.Cancel(key));
+        CHECK(pool.GetDiagnostics().AffinityKeys == 0);
+    }
+}
+
+// Jobs of four maps hammer their map's entity lock on four workers. With affinity every map's jobs stay on one
+// worker, without it they meet on the locks; contended acquisitions are reported next to the timings
+TEST_CASE("WorkerPoolAffinityLockContention", "[!benchmark][server]")
+{
+    constexpr size_t MAP_COUNT = 4;
+    constexpr size_t JOBS_PER_MAP = 16;
+    constexpr int32_t RUNS_PER_JOB = 8;
+
+    const auto run_maps = [](bool affinity) -> uint64_t {
+        std::atomic<bool> shutdown_flag {false};
+        WorkerPool pool {"bench", numeric_cast<int32_t>(MAP_COUNT), &shutdown_flag, true};
+
+        if (affinity) {
+            // Long enough that nothing is stolen, so contention only comes from the scheduling itself
+            pool.EnableAffinityScheduling(std::chrono::seconds {10});
+        }
+
+        array<EntityLock, MAP_COUNT> map_locks;
+        std::atomic<uint64_t> contended {0};
+
+        for (size_t i = 0; i < MAP_COUNT * JOBS_PER_MAP; i++) {
+            const size_t map_index = i % MAP_COUNT;
+            auto runs_left = SafeAlloc::MakeShared<int32_t>(RUNS_PER_JOB);
+
+            pool.Submit(WorkerJobKey {WorkerJobType::CritterMovement, i + 1}, timespan::zero, [&, map_index, runs_left]() -> std::optional<timespan> {
+                auto& map_lock = map_locks[map_index];
+
+                if (!map_lock.TryAcquire()) {
+                    contended.fetch_add(1, std::memory_order_relaxed);
+                    map_lock.Acquire(0);
+                }
+
+                // A short critical section standing in for a movement step
+                const auto busy_until = nanotime::now() + std::chrono::microseconds {20};
+
+                while (nanotime::now() < busy_until) {
+                }
+
+                map_lock.Release();
+
+                return --*runs_left > 0 ? std::optional<timespan> {timespan::zero} : std::nullopt;
+            }, map_index);
+        }
+
+        pool.Resume();
+        pool.WaitIdle();
+
+        return contended.load();
+    };
+
+    const uint64_t contended_without_affinity = run_maps(false);
+    const uint64_t contended_with_affinity = run_maps(true);
+    WARN("Contended map lock acquisitions: without affinity " << contended_without_affinity << ", with affinity " << contended_with_affinity);
+    CHECK(contended_with_affinity == 0);
+
+    BENCHMARK("Map jobs, affinity off")
+    {
+        return run_maps(false);
+    };
+
+    BENCHMARK("Map jobs, affinity on")
+    {
+        return run_maps(true);
+    };
+}
+
+// ============================================================================
+// Latency histograms
+// ============================================================================
+
+TEST_CASE("LatencyHistogram")
+{
+    nanotime now = nanotime {std::chrono::hours {1}};
+
+    SECTION("BucketBoundsCoverValues")
+    {
+        for (uint64_t value : {uint64_t {0}, uint64_t {7}, uint64_t {8}, uint64_t {15}, uint64_t {16}, uint64_t {1000}, uint64_t {123456789}}) {
+            size_t index = LatencyHistogram::GetBucketIndex(value);
+            CHECK(index < LatencyHistogram::BUCKET_COUNT);
+            CHECK(LatencyHistogram::GetBucketUpperBound(index) >= value);
+            CHECK(LatencyHistogram::GetBucketUpperBound(index) - value <= value / LatencyHistogram::SUB_BUCKET_COUNT);
+
+            if (index != 0) {
+                CHECK(LatencyHistogram::GetBucketUpperBound(index - 1) < value);
+            }
+        }
+
+        CHECK(LatencyHistogram::GetBucketIndex(std::numeric_limits<uint64_t>::max()) == LatencyHistogram::BUCKET_COUNT - 1);
+    }
+
+    SECTION("Percentiles")
+    {
+        LatencyHistogram histogram;
+
+        for (int32_t i = 1; i <= 100; i++) {
+            histogram.Record(std::chrono::microseconds {i}, now);
+        }
+
+        LatencyHistogram::Summary summary = histogram.GetSummary(now);
+        CHECK(summary.Count == 100);
+        CHECK(summary.Max == timespan {std::chrono::microseconds {100}});
+        CHECK(summary.P50 >= timespan {std::chrono::microseconds {50}});
+        CHECK(summary.P50 <= timespan {std::chrono::nanoseconds {56250}});
+        CHECK(summary.P99 >= timespan {std::chrono::microseconds {99}});
+        CHECK(summary.P99 <= summary.Max);
+    }
+
+    SECTION("SlidingWindowExpiresOldSamples")
+    {
+        LatencyHistogram histogram;
+
+        histogram.Record(std::chrono::milliseconds {5}, now);
+        histogram.Record(std::chrono::microseconds {10}, now + std::chrono::seconds {30});
+
+        LatencyHistogram::Summary recent = histogram.GetSummary(now + std::chrono::seconds {30});
+        CHECK(recent.Count == 2);
+        CHECK(recent.Max == timespan {std::chrono::milliseconds {5}});
+
+        LatencyHistogram::Summary expired = histogram.GetSummary(now + LatencyHistogram::WINDOW_DURATION + std::chrono::seconds {5});
+        CHECK(expired.Count == 1);
+        CHECK(expired.Max == timespan {std::chrono::microseconds {10}});
+
+        histogram.Reset();
+        CHECK(histogram.GetSummary(now + std::chrono::seconds {30}).Count == 0);
+    }
+}
+
+TEST_CASE("LatencyStats")
+{
+    SECTION("DisabledReturnsNoHistograms")
+    {
+        LatencyStats stats;
+
+        CHECK_FALSE(stats.GetJobHistogram(WorkerJobType::Player));
+        CHECK_FALSE(stats.GetNetMessageHistogram(NetMessage::Ping));
+        CHECK_FALSE(stats.GetEventHistogram(Entity::RegisterEventName("OnTest")));
+        CHECK(stats.GetEntries(nanotime::now()).empty());
+    }
+
+    SECTION("NamedHistogramsAreStable")
+    {
+        LatencyStats stats;
+        stats.SetEnabled(true);
+
+        const uint32_t test_event_id = Entity::RegisterEventName("OnTest");
+        const uint32_t other_event_id = Entity::RegisterEventName("OnOther");
+
+        auto event_histogram = stats.GetEventHistogram(test_event_id);
+        REQUIRE(event_histogram);
+        CHECK(stats.GetEventHistogram(test_event_id) == event_histogram);
+        CHECK(stats.GetEventHistogram(other_event_id) != event_histogram);
+
+        // Ids in a later chunk are published independently, ids past the table are not sampled
+        auto far_histogram = stats.GetEventHistogram(numeric_cast<uint32_t>(LatencyStats::EVENTS_PER_CHUNK * 3 + 1));
+        REQUIRE(far_histogram);
+        CHECK(far_histogram != event_histogram);
+        CHECK_FALSE(stats.GetEventHistogram(numeric_cast<uint32_t>(LatencyStats::EVENTS_PER_CHUNK * LatencyStats::EVENT_CHUNK_COUNT)));
+
+        auto msg_histogram = stats.GetNetMessageHistogram(NetMessage::Ping);
+        REQUIRE(msg_histogram);
+        CHECK(stats.GetNetMessageHistogram(NetMessage::Ping) == msg_histogram);
+
+        nanotime now = nanotime::now();
+        event_histogram->Record(std::chrono::microseconds {3}, now);
+        msg_histogram->Record(std::chrono::microseconds {4}, now);
+
+        vector<LatencyStats::Entry> entries = stats.GetEntries(now);
+        REQUIRE(entries.size() == 2);
+        CHECK(entries[0].Group == "NetMessage");
+        CHECK(entries[0].Name == "Ping");
+        CHECK(entries[1].Group == "Event");
+        CHECK(entries[1].Name == "OnTest");
+    }
+
+    SECTION("WorkerPoolRecordsPerJobType")
+    {
+        std::atomic<bool> shutdown_flag {false};
+        LatencyStats stats;
+        stats.SetEnabled(true);
+        WorkerPool pool {"test", 2, &shutdown_flag, false, &stats};
+
+        pool.Submit(WorkerJobKey {WorkerJobType::CritterMovement, 1}, [&]() -> std::optional<timespan> {
+            std::this_thread::sleep_for(std::chrono::milliseconds {2});
+            return std::nullopt;
+        });
+        pool.Submit([]() -> std::optional<timespan> { return std::nullopt; });
+        pool.WaitIdle();
+
+        nanotime now = nanotime::now();
+        auto movement = stats.GetJobHistogram(WorkerJobType::CritterMovement)->GetSummary(now);
+        CHECK(movement.Count == 1);
+        CHECK(movement.Max >= timespan {std::chrono::milliseconds {2}});
+        CHECK(stats.GetJobHistogram(WorkerJobType::None)->GetSummary(now).Count == 1);
+        CHECK(stats.GetJobHistogram(WorkerJobType::Player)->GetSummary(now).Count == 0);
+
+        stats.SetEnabled(false);
+        pool.Submit([]() -> std::optional<timespan> { return std::nullopt; });
+        pool.WaitIdle();
+        stats.SetEnabled(true);
+        CHECK(stats.GetJobHistogram(WorkerJobType::None)->GetSummary(now).Count == 1);
+    }
+}
+
+TEST_CASE("LatencyHistogramPerformance", "[!benchmark][server]")
+{
+    LatencyHistogram histogram;
+    nanotime now = nanotime::now();
+    int64_t value = 0;
+
+    // Budget: well under 50ns per sample on the recording path
+    BENCHMARK("Record")
+    {
+        value = (value + 7919) % 10000000;
+        histogram.Record(timespan {value}, now);
+        return value;
+    };
+
+    BENCHMARK("Timed sample scope")
+    {
+        LatencySample sample {&histogram};
+        return value;
+    };
+
+    LatencyStats stats;
+    stats.SetEnabled(true);
+    const uint32_t benchmark_event_id = Entity::RegisterEventName("OnBenchmark");
+    ignore_unused(stats.GetEventHistogram(benchmark_event_id));
+
+    BENCHMARK("Event histogram lookup")
+    {
+        return stats.GetEventHistogram(benchmark_event_id);
+    };
+}
+
 FO_END_NAMESPACE
@@ -40,6 +40,18 @@
 
 FO_BEGIN_NAMESPACE
 
+// Lives in the baker cache so output reconciliation keeps it, the server build picks it up through FO_ANGELSCRIPT_AOT_SERVER_SOURCE
+static auto GetAotSourcePath(const BakingContext& context) -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (context.Settings->BakeOutput.empty()) {
+        return {};
+    }
+
+    return strex(context.Settings->BakeOutput).combine_path(BAKER_CACHE_DIR).combine_path("AngelScript").combine_path(strex("{}.Server.cpp", context.PackName));
+}
+
 AngelScriptBaker::AngelScriptBaker(shared_ptr<BakingContext> ctx) :
     BaseBaker(std::move(ctx), NAME)
 {
@@ -105,8 +117,14 @@ void AngelScriptBaker::BakeFiles(const FileCollection& files, string_view target
     if (bake_server) {
         file_bakings.emplace_back(run_async(GetAsyncMode(), "BakeAngelScript-Server", [&] {
             auto engine = BakerServerEngine(*_context->BakedFiles);
-            auto data = CompileAngelScript(&engine, *_context->Settings, filtered_files, message_callback);
+            string aot_source_path = !_context->Settings->AotNamespaces.empty() ? GetAotSourcePath(*_context) : string();
+            string aot_source;
+            auto data = CompileAngelScript(&engine, *_context->Settings, filtered_files, message_callback, !aot_source_path.empty() ? &aot_source : nullptr);
             _context->WriteData(_context->PackName + ".fos-bin-server", data);
+
+            if (!aot_source_path.empty() && !fs_write_file(aot_source_path, aot_source)) {
+                WriteLog(LogType::Warning, "Unable to write AngelScript native translation {}", aot_source_path);
+            }
         }));
     }
     if (bake_client) {
@@ -40,6 +40,17 @@
 
 FO_BEGIN_NAMESPACE
 
+static auto GetMapNameCatalogPath(const BakingContext& context) -> string
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (context.Settings->BakeOutput.empty()) {
+        return {};
+    }
+
+    return strex(context.Settings->BakeOutput).combine_path(BAKER_CACHE_DIR).combine_path("Maps").combine_path(strex("{}.catalog", context.PackName));
+}
+
 MapBaker::MapBaker(shared_ptr<BakingContext> ctx) :
     BaseBaker(std::move(ctx), NAME)
 {
@@ -64,6 +75,26 @@ void MapBaker::BakeFiles(const FileCollection& files, string_view target_path) c
     // Collect map files
     vector<MapBakeEntry> filtered_files;
 
+    // Maps declared by unchanged sources come from the catalog, so those files are neither read nor scanned
+    MapNameCatalog map_catalog;
+    string map_catalog_path = GetMapNameCatalogPath(*_context);
+
+    if (!map_catalog_path.empty()) {
+        if (optional<string> catalog_text = fs_read_file(map_catalog_path)) {
+            map_catalog.LoadFromText(*catalog_text);
+        }
+    }
+
+    auto save_map_catalog = [&] {
+        if (!map_catalog_path.empty() && map_catalog.IsChanged()) {
+            if (!fs_write_file(map_catalog_path, map_catalog.SaveToText())) {
+                WriteLog(LogType::Warning, "Unable to write map name catalog {}", map_catalog_path);
+            }
+
+            map_catalog.MarkSaved();
+        }
+    };
+
     auto check_file = [&](const FileHeader& file_header, string_view map_name) -> bool {
         bool server_side = _context->BakeChecker(strex("{}.fomap-bin-server", map_name), file_header.GetWriteTime());
         bool client_side = _context->BakeChecker(strex("{}.fomap-bin-client", map_name), file_header.GetWriteTime());
@@ -83,6 +114,8 @@ void MapBaker::BakeFiles(const FileCollection& files, string_view target_path) c
     const auto& proto_file_extensions = _context->Settings->ProtoFileExtensions;
 
     if (target_path.empty()) {
+        unordered_set<string> source_paths;
+
         for (const auto& file_header : files) {
             string ext = strex(file_header.GetPath()).get_file_extension();
 
@@ -90,8 +123,8 @@ void MapBaker::BakeFiles(const FileCollection& files, string_view target_path) c
                 continue;
             }
 
-            File file = File::Load(file_header);
-            vector<string> map_names = ResolveMapNames(file);
+            source_paths.emplace(file_header.GetPath());
+            vector<string> map_names = map_catalog.GetMapNames(file_header);
 
             if (map_names.empty()) {
                 // Not a map container: no [ProtoMap] anchors declared
@@ -110,8 +143,11 @@ void MapBaker::BakeFiles(const FileCollection& files, string_view target_path) c
                 continue;
             }
 
-            filtered_files.emplace_back(MapBakeEntry {std::move(file), std::move(stale_map_names)});
+            filtered_files.emplace_back(MapBakeEntry {File::Load(file_header), std::move(stale_map_names)});
         }
+
+        map_catalog.RetainPaths(source_paths);
+        save_map_catalog();
     }
     else {
         if (!strex(target_path).get_file_extension().starts_with("fomap-")) {
@@ -124,7 +160,7 @@ void MapBaker::BakeFiles(const FileCollection& files, string_view target_path) c
 
         for (const auto& proto_ext : proto_file_extensions) {
             if (auto exact_file = files.FindFileByPath(strex(target_path).change_file_extension(proto_ext))) {
-                auto exact_file_map_names = ResolveMapNames(exact_file);
+                auto exact_file_map_names = map_catalog.GetMapNames(exact_file);
 
                 if (std::ranges::find(exact_file_map_names, target_map_name) != exact_file_map_names.end()) {
                     file = std::move(exact_file);
@@ -142,17 +178,18 @@ void MapBaker::BakeFiles(const FileCollection& files, string_view target_path) c
                     continue;
                 }
 
-                File candidate_file = File::Load(file_header);
-                auto candidate_map_names = ResolveMapNames(candidate_file);
+                auto candidate_map_names = map_catalog.GetMapNames(file_header);
 
                 if (std::ranges::find(candidate_map_names, target_map_name) != candidate_map_names.end()) {
-                    file = std::move(candidate_file);
+                    file = File::Load(file_header);
                     file_found = true;
                     break;
                 }
             }
         }
 
+        save_map_catalog();
+
         if (!file_found) {
             return;
         }
@@ -190,7 +227,7 @@ void MapBaker::BakeFiles(const FileCollection& files, string_view target_path) c
 
     // Bake maps
     auto bake_map = [&](const File& file, const string& map_name) {
-        string file_content = file.GetStr();
+        string_view file_content = file.GetStrView();
 
         vector<uint8_t> props_data;
         uint32_t map_cr_count = 0;
@@ -337,11 +374,4 @@ void MapBaker::BakeFiles(const FileCollection& files, string_view target_path) c
     }
 }
 
-auto MapBaker::ResolveMapNames(const File& file) -> vector<string>
-{
-    FO_STACK_TRACE_ENTRY();
-
-    return MapLoader::EnumerateMaps(file.GetPath(), file.GetStr());
-}
-
 FO_END_NAMESPACE
@@ -58,9 +58,6 @@ class MapBaker final : public BaseBaker
     [[nodiscard]] auto GetOrder() const -> int32_t override { return 8; }
 
     void BakeFiles(const FileCollection& files, string_view target_path) const override;
-
-private:
-    static auto ResolveMapNames(const File& file) -> vector<string>;
 };
 
 FO_END_NAMESPACE
@@ -45,6 +45,7 @@ FO_BEGIN_NAMESPACE
 
 static constexpr ipos32 MAPPER_CONSOLE_WINDOW_OFFSET = {0, 6};
 static constexpr string_view MAPPER_IMGUI_SETTINGS_KEY = "ImGuiLayout";
+static constexpr string_view MAP_CATALOG_ENTRY = "mapper_map_catalog.txt";
 static constexpr int32_t DAY_TIME_WRAP_MINUTES = 1440;
 static constexpr int32_t DAY_TIME_VISIBLE_UPPER_BOUND = DAY_TIME_WRAP_MINUTES * 2;
 
@@ -182,6 +183,10 @@ MapperEngine::MapperEngine(ptr<GlobalSettings> settings, FileSystem&& resources,
     }
 
     ConsoleHistoryCur = numeric_cast<int32_t>(ConsoleHistory.size());
+
+    // Declared map names outlive the session, so lookups after a restart scan only map files changed since
+    MapCatalog.LoadFromText(Cache.GetString(MAP_CATALOG_ENTRY));
+
     MapperWindowFocused = SprMngr.IsWindowFocused();
 }
 
@@ -2298,17 +2303,21 @@ void MapperEngine::DrawMapListWindowImGui()
         MapBrowserNames.clear();
 
         auto map_files = MapsFileSys.FilterFiles("");
+        unordered_set<string> map_file_paths;
 
         for (const auto& map_file_header : map_files) {
             if (!IsProtoFileExtension(map_file_header.GetPath())) {
                 continue;
             }
 
-            File map_file = File::Load(map_file_header);
-            auto declared_maps = MapLoader::EnumerateMaps(map_file.GetPath(), map_file.GetStr());
+            map_file_paths.emplace(map_file_header.GetPath());
+            auto declared_maps = MapCatalog.GetMapNames(map_file_header);
             MapBrowserNames.insert(MapBrowserNames.end(), std::make_move_iterator(declared_maps.begin()), std::make_move_iterator(declared_maps.end()));
         }
 
+        MapCatalog.RetainPaths(map_file_paths);
+        SaveMapCatalog();
+
         std::ranges::sort(MapBrowserNames);
         MapBrowserNamesStale = false;
     }
@@ -6073,8 +6082,7 @@ void MapperEngine::ParseCommand(string_view command)
                     continue;
                 }
 
-                File map_file = File::Load(map_file_header);
-                auto declared_maps = MapLoader::EnumerateMaps(map_file.GetPath(), map_file.GetStr());
+                auto declared_maps = MapCatalog.GetMapNames(map_file_header);
 
                 for (const auto& map_name : declared_maps) {
                     if (auto map = LoadMap(map_name)) {
@@ -6086,6 +6094,8 @@ void MapperEngine::ParseCommand(string_view command)
                     }
                 }
             }
+
+            SaveMapCatalog();
         }
         else if (command_ext == "reverse-light" && _curMap) {
             string before_snapshot = !UndoRedoInProgress ? CaptureMapSnapshot(GetCurMap()) : string {};
@@ -6160,6 +6170,16 @@ auto MapperEngine::IsProtoFileExtension(string_view path) const -> bool
     return std::ranges::find(Settings->ProtoFileExtensions, ext) != Settings->ProtoFileExtensions.end();
 }
 
+void MapperEngine::SaveMapCatalog()
+{
+    FO_STACK_TRACE_ENTRY();
+
+    if (MapCatalog.IsChanged()) {
+        Cache.SetString(MAP_CATALOG_ENTRY, MapCatalog.SaveToText());
+        MapCatalog.MarkSaved();
+    }
+}
+
 auto MapperEngine::LoadMapFromText(string_view map_name, string_view file_name, const string& map_text) -> nptr<MapView>
 {
     FO_STACK_TRACE_ENTRY();
@@ -6243,8 +6263,8 @@ auto MapperEngine::LoadMap(string_view map_name) -> nptr<MapView>
     File map_file;
     string resolved_map_name;
 
-    auto resolve_declared_map = [&](const File& candidate) -> bool {
-        auto declared_maps = MapLoader::EnumerateMaps(candidate.GetPath(), candidate.GetStr());
+    auto resolve_declared_map = [&](const auto& candidate) -> bool {
+        auto declared_maps = MapCatalog.GetMapNames(candidate);
 
         if (std::ranges::find(declared_maps, string {map_name}) != declared_maps.end()) {
             resolved_map_name = string {map_name};
@@ -6283,15 +6303,15 @@ auto MapperEngine::LoadMap(string_view map_name) -> nptr<MapView>
                 continue;
             }
 
-            File candidate_file = File::Load(file_header);
-
-            if (resolve_declared_map(candidate_file)) {
-                map_file = std::move(candidate_file);
+            if (resolve_declared_map(file_header)) {
+                map_file = File::Load(file_header);
                 break;
             }
         }
     }
 
+    SaveMapCatalog();
+
     if (!map_file) {
         AddMess("Map file not found");
         return nullptr;
@@ -6548,29 +6568,30 @@ void MapperEngine::SaveMap(ptr<MapView> map, string_view custom_name)
             continue;
         }
 
-        File candidate_file = File::Load(file_header);
-        auto declared_maps = MapLoader::EnumerateMaps(candidate_file.GetPath(), candidate_file.GetStr());
+        auto declared_maps = MapCatalog.GetMapNames(file_header);
 
         if (declared_maps.empty()) {
             continue;
         }
 
         if (first_container_path.empty()) {
-            first_container_path = candidate_file.GetDiskPath();
+            first_container_path = file_header.GetDiskPath();
         }
         if (original_declaring_path.empty() && std::ranges::find(declared_maps, original_map_name) != declared_maps.end()) {
-            original_declaring_path = candidate_file.GetDiskPath();
+            original_declaring_path = file_header.GetDiskPath();
         }
 
         if (std::ranges::find(declared_maps, fomap_name) != declared_maps.end()) {
-            declaring_file = std::move(candidate_file);
+            declaring_file = File::Load(file_header);
             declaring_file_maps = std::move(declared_maps);
             break;
         }
 
-        FO_VERIFY_AND_THROW(candidate_file.GetNameNoExt() != fomap_name, "Mapper save target file exists but does not declare the saved map", fomap_name, candidate_file.GetPath());
+        FO_VERIFY_AND_THROW(file_header.GetNameNoExt() != fomap_name, "Mapper save target file exists but does not declare the saved map", fomap_name, file_header.GetPath());
     }
 
+    SaveMapCatalog();
+
     if (declaring_file) {
         fomap_path = declaring_file.GetDiskPath();
 
@@ -6614,6 +6635,12 @@ void MapperEngine::SaveMap(ptr<MapView> map, string_view custom_name)
 
     FO_VERIFY_AND_THROW(fomap_file, "Mapper failed to write the map file content", fomap_path, fomap_name, final_content.size());
 
+    // A rewrite within the write time resolution could keep the size too, so the entry is not trusted
+    if (declaring_file) {
+        MapCatalog.Forget(declaring_file.GetPath());
+        SaveMapCatalog();
+    }
+
     MapBrowserNamesStale = true;
 
     OnEditMapSave.Fire(map);
@@ -6652,14 +6679,14 @@ void MapperEngine::SaveMapToDir(ptr<MapView> map, string_view sub_dir, string_vi
             continue;
         }
 
-        File candidate_file = File::Load(file_header);
-
-        if (!MapLoader::EnumerateMaps(candidate_file.GetPath(), candidate_file.GetStr()).empty()) {
-            reference_map_path = candidate_file.GetDiskPath();
+        if (!MapCatalog.GetMapNames(file_header).empty()) {
+            reference_map_path = file_header.GetDiskPath();
             break;
         }
     }
 
+    SaveMapCatalog();
+
     FO_VERIFY_AND_THROW(!reference_map_path.empty(), "No map container found to resolve the maps root directory");
 
     string reference_map_ext = strex(reference_map_path).get_file_extension().str();
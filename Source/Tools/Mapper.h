@@ -294,6 +294,7 @@ class MapperEngine final : public ClientEngine
     auto LoadMap(string_view map_name) -> nptr<MapView>;
     auto LoadMapFromText(string_view map_name, string_view file_name, const string& map_text) -> nptr<MapView>;
     auto IsProtoFileExtension(string_view path) const -> bool;
+    void SaveMapCatalog();
     void ShowMap(ptr<MapView> map);
     auto IsMapDirty(nptr<MapView> map) const -> bool;
     void SetMapDirty(nptr<MapView> map, bool dirty = true);
@@ -329,6 +330,7 @@ class MapperEngine final : public ClientEngine
     FO_ENTITY_EVENT(OnInspectorProperties, ptr<Entity> /*entity*/, vector<int32_t>& /*properties*/);
 
     FileSystem MapsFileSys {};
+    MapNameCatalog MapCatalog {};
     ParticleEditorManager ParticleEditors;
     vector<refcount_ptr<MapView>> LoadedMaps {};
     unordered_set<ptr<MapView>> DirtyMaps {};
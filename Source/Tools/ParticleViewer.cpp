@@ -277,6 +277,12 @@ void ParticleViewer::DrawPreview()
 
     RenderPreview();
 
+    // Counters cover every system of the particle factory, including the ones of a hosting map
+    if (auto factory = _sprMngr->GetSpriteFactory(typeid(ParticleSpriteFactory)).dyn_cast<ParticleSpriteFactory>()) {
+        ParticleFrameStats stats = factory->GetParticleStats();
+        ImGui::Text("Simulated: %d, culled: %d, deferred: %d, steps: %d", numeric_cast<int32_t>(stats.SimulatedSystems), numeric_cast<int32_t>(stats.CulledSystems), numeric_cast<int32_t>(stats.DeferredSystems), numeric_cast<int32_t>(stats.SimulationSteps));
+    }
+
     if (_renderTarget) {
         auto draw_list = make_ptr(ImGui::GetWindowDrawList());
         ImVec2 pos = ImGui::GetCursorScreenPos();